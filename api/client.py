@@ -1,6 +1,7 @@
 from __future__ import annotations
 
 import json
+import struct
 from typing import Any, Dict, Optional
 
 import requests
@@ -48,6 +49,173 @@ class EyeClient:
     def get_ble_ranging(self) -> Dict[str, Any]:
         return self.get("/api/ranging/ble")
 
+    def get_spectrum_frame(
+        self, wide_bins: bool = False, channel: Optional[str] = None, times: bool = False
+    ) -> Dict[str, Any]:
+        params: Dict[str, Any] = {}
+        if wide_bins:
+            params["bins"] = "int16"
+        if channel:
+            params["channel"] = channel
+        if times:
+            params["times"] = 1
+        url = self._resolve_url("/api/spectrum/frame")
+        try:
+            response = requests.get(url, params=params, timeout=self.timeout_seconds)
+        except requests.exceptions.ConnectionError as exc:
+            return {
+                "ok": False,
+                "status_code": 0,
+                "error": "HostUnreachable",
+                "details": str(exc),
+            }
+
+        if response.status_code != 200:
+            return {"ok": False, "status_code": response.status_code, "data": None}
+        try:
+            data = decode_spectrum_frame(response.content)
+        except ValueError as exc:
+            return {"ok": False, "status_code": response.status_code, "error": "BadFrame", "details": str(exc)}
+        return {"ok": True, "status_code": response.status_code, "data": data}
+
+    def get_spectrum_events(self, since: int = 0) -> Dict[str, Any]:
+        return self.get(f"/api/spectrum/events?since={since}")
+
+    def get_spectrum_waterfall(
+        self,
+        last_seconds: Optional[int] = None,
+        from_epoch: Optional[int] = None,
+        to_epoch: Optional[int] = None,
+        time_decimation: int = 1,
+        freq_decimation: int = 1,
+        mode: str = "max",
+    ) -> Dict[str, Any]:
+        params: Dict[str, Any] = {"tdec": time_decimation, "fdec": freq_decimation, "mode": mode}
+        if from_epoch is not None:
+            params["from"] = from_epoch
+        if to_epoch is not None:
+            params["to"] = to_epoch
+        if last_seconds is not None:
+            params["last"] = last_seconds
+        url = self._resolve_url("/api/spectrum/waterfall")
+        try:
+            response = requests.get(url, params=params, timeout=self.timeout_seconds)
+        except requests.exceptions.ConnectionError as exc:
+            return {
+                "ok": False,
+                "status_code": 0,
+                "error": "HostUnreachable",
+                "details": str(exc),
+            }
+
+        if response.status_code != 200:
+            return {"ok": False, "status_code": response.status_code, "data": None}
+        try:
+            data = decode_spectrum_waterfall(response.content)
+        except ValueError as exc:
+            return {"ok": False, "status_code": response.status_code, "error": "BadFrame", "details": str(exc)}
+        return {"ok": True, "status_code": response.status_code, "data": data}
+
     def _resolve_url(self, endpoint: str) -> str:
         normalized = endpoint if endpoint.startswith("/") else f"/{endpoint}"
         return f"http://{self.address}{normalized}"
+
+
+SPECTRUM_FRAME_HEADER_V1 = struct.Struct("<4sBBH6sHIII")
+SPECTRUM_FRAME_CHANNEL = struct.Struct("<BBH")
+SPECTRUM_FRAME_TIMING = struct.Struct("<i")
+SPECTRUM_FRAME_TIMES = 0x01
+SPECTRUM_BINS_INT8 = 1
+SPECTRUM_BINS_INT16 = 2
+SPECTRUM_CHANNELS = (
+    "live", "max_hold", "min_hold", "average", "occupancy_pct", "sample_max", "sample_variance_db2"
+)
+
+
+def decode_spectrum_frame(payload: bytes) -> Dict[str, Any]:
+    """Decode a /api/spectrum/frame payload (layout in firmware SpectrumFrame.h)."""
+    if len(payload) < SPECTRUM_FRAME_HEADER_V1.size:
+        raise ValueError("frame shorter than header")
+    magic, version, bin_format, bin_count, node_id, sweep_seq, epoch, start_khz, step_hz = (
+        SPECTRUM_FRAME_HEADER_V1.unpack_from(payload)
+    )
+    if magic != b"ASEF":
+        raise ValueError("bad magic")
+    offset = SPECTRUM_FRAME_HEADER_V1.size
+    channel, flags, accumulated, start_offset_us = 0, 0, 0, 0
+    if version >= 2:
+        channel, flags, accumulated = SPECTRUM_FRAME_CHANNEL.unpack_from(payload, offset)
+        offset += SPECTRUM_FRAME_CHANNEL.size
+    if version >= 3:
+        (start_offset_us,) = SPECTRUM_FRAME_TIMING.unpack_from(payload, offset)
+        offset += SPECTRUM_FRAME_TIMING.size
+    else:
+        flags = 0
+    if bin_format == SPECTRUM_BINS_INT16:
+        bins = struct.unpack_from(f"<{bin_count}h", payload, offset)
+        rssi = [b / 100.0 for b in bins]
+        offset += 2 * bin_count
+    elif bin_format == SPECTRUM_BINS_INT8:
+        rssi = [float(b) for b in struct.unpack_from(f"<{bin_count}b", payload, offset)]
+        offset += bin_count
+    else:
+        raise ValueError(f"unknown bin format {bin_format}")
+    bin_times_us = None
+    if flags & SPECTRUM_FRAME_TIMES:
+        bin_times_us = list(struct.unpack_from(f"<{bin_count}I", payload, offset))
+
+    return {
+        "version": version,
+        "node_id": node_id.hex(":"),
+        "sweep_seq": sweep_seq,
+        "epoch": epoch,
+        "channel": SPECTRUM_CHANNELS[channel] if channel < len(SPECTRUM_CHANNELS) else str(channel),
+        "accumulated_sweeps": accumulated,
+        "start_offset_us": start_offset_us,
+        "bin_times_us": bin_times_us,
+        "start_mhz": start_khz / 1000.0,
+        "step_mhz": step_hz / 1000000.0,
+        "freq_mhz": [(start_khz * 1000 + i * step_hz) / 1000000.0 for i in range(bin_count)],
+        "rssi_dbm": rssi,
+    }
+
+
+SPECTRUM_WATERFALL_HEADER = struct.Struct("<4sBBHH6sIIIIHH")
+WATERFALL_MODES = {1: "max", 2: "mean"}
+
+
+def decode_spectrum_waterfall(payload: bytes) -> Dict[str, Any]:
+    """Decode a /api/spectrum/waterfall payload (layout in firmware WaterfallStore.h)."""
+    if len(payload) < SPECTRUM_WATERFALL_HEADER.size:
+        raise ValueError("waterfall shorter than header")
+    (magic, version, mode, row_count, col_count, node_id, first_epoch, last_epoch, start_khz, step_hz,
+     time_decimation, freq_decimation) = SPECTRUM_WATERFALL_HEADER.unpack_from(payload)
+    if magic != b"ASEW":
+        raise ValueError("bad magic")
+    row_bytes = 4 + col_count
+    if len(payload) < SPECTRUM_WATERFALL_HEADER.size + row_count * row_bytes:
+        raise ValueError("waterfall truncated")
+
+    epochs = []
+    rows = []
+    offset = SPECTRUM_WATERFALL_HEADER.size
+    for _ in range(row_count):
+        (epoch,) = struct.unpack_from("<I", payload, offset)
+        epochs.append(epoch)
+        rows.append([float(b) for b in struct.unpack_from(f"<{col_count}b", payload, offset + 4)])
+        offset += row_bytes
+
+    return {
+        "version": version,
+        "mode": WATERFALL_MODES.get(mode, str(mode)),
+        "node_id": node_id.hex(":"),
+        "first_epoch": first_epoch,
+        "last_epoch": last_epoch,
+        "start_mhz": start_khz / 1000.0,
+        "step_mhz": step_hz / 1000000.0,
+        "time_decimation": time_decimation,
+        "freq_decimation": freq_decimation,
+        "freq_mhz": [(start_khz * 1000 + i * step_hz) / 1000000.0 for i in range(col_count)],
+        "epochs": epochs,
+        "rssi_dbm": rows,
+    }
@@ -25,7 +25,18 @@ public:
     // API Interaction (Core 0 requests this, usually protected by mutex in Manager)
     // Returns true if data was written to report object
     virtual bool getJsonData(JsonObject report) { return false; } 
+
+    // Binary sweep frame (see SpectrumFrame.h) for /api/spectrum/frame.
+    // channel is a SweepChannel, or -1 for the plugin's primary channel;
+    // withTimes appends per-bin read times.
+    // Returns bytes written to out, 0 if the plugin has no frame to offer.
+    virtual size_t getSpectrumFrame(uint8_t* out, size_t capacity, uint8_t binFormat, int channel = -1,
+                                    bool withTimes = false) { return 0; }
     
+    // Detected emissions (see SpectrumDetector.h) with seq > sinceSeq, for /api/spectrum/events.
+    // Returns false if the plugin does not run a detector.
+    virtual bool getSpectrumEvents(JsonObject out, uint32_t sinceSeq) { return false; }
+
     // Command Handling
     virtual void handleCommand(String command, String value) {}
 };
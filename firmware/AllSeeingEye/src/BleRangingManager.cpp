@@ -2,6 +2,7 @@
 #include "PeerManager.h"
 #include "Logger.h"
 #include "Config.h"
+#include "ClockSync.h"
 #include <time.h>
 #include "esp_mac.h"
 
@@ -40,6 +41,7 @@ BleRangingManager& BleRangingManager::instance() {
 }
 
 void BleRangingManager::begin() {
+    _version++;
     _peerCount = 0;
     _bssidCount = 0;
     _lastScanEpoch = 0;
@@ -83,14 +85,16 @@ void BleRangingManager::loop() {
         return;
     }
 
-    time_t epoch = time(nullptr);
+    // Cluster-consensus seconds, so every node opens the window in the same second
+    time_t epoch = (time_t)(ClockSync::instance().consensusTimeUs() / 1000000ULL);
     if (epoch <= 0) {
         return;
     }
 
-    // Synchronized Scanning Window (UTC % 10 == 0)
+    // Synchronized Scanning Window (consensus UTC % 10 == 0)
     if ((epoch % 10) == 0 && _lastScanEpoch != static_cast<uint32_t>(epoch)) {
         _lastScanEpoch = static_cast<uint32_t>(epoch);
+        _version++;
         
         Logger::instance().info("BleRanging", "Starting Scan (Blocking 1s)");
         
@@ -124,6 +128,7 @@ BleRangingConfig BleRangingManager::getConfig() const {
 }
 
 void BleRangingManager::setConfig(const BleRangingConfig& config) {
+    _version++;
     _config = config;
     Logger::instance().info("BleRanging", "Config updated enabled=%d interval=%lu window=%lu adv=%lu",
         _config.enabled,
@@ -133,6 +138,7 @@ void BleRangingManager::setConfig(const BleRangingConfig& config) {
 }
 
 void BleRangingManager::updatePeer(const BleRangingPeer& peer) {
+    _version++;
     for (uint8_t i = 0; i < _peerCount; ++i) {
         if (_peers[i].peerId == peer.peerId) {
             _peers[i] = peer;
@@ -152,10 +158,12 @@ void BleRangingManager::updatePeer(const BleRangingPeer& peer) {
 }
 
 void BleRangingManager::clearPeers() {
+    _version++;
     _peerCount = 0;
 }
 
 void BleRangingManager::updateBssid(const BleRangingBssid& bssid) {
+    _version++;
     for (uint8_t i = 0; i < _bssidCount; ++i) {
         if (_bssids[i].bssid == bssid.bssid) {
             _bssids[i] = bssid;
@@ -175,6 +183,7 @@ void BleRangingManager::updateBssid(const BleRangingBssid& bssid) {
 }
 
 void BleRangingManager::clearBssids() {
+    _version++;
     _bssidCount = 0;
 }
 
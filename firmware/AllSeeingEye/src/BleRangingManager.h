@@ -52,6 +52,7 @@ public:
     void clearBssids();
 
     void populateStatus(JsonObject& obj) const;
+    uint32_t version() const { return _version; } // Bumped when populateStatus() would change
 
     // Helper for the callback to insert data
     void handleDeviceFound(const String& address, int rssi, int txPower, const String& serviceUUID, const String& name, const std::string& manufacturerData);
@@ -71,6 +72,7 @@ private:
     uint32_t _lastScanMs = 0;
     bool _isScanning = false;
     uint32_t _scanStartTime = 0;
+    volatile uint32_t _version = 0;
     
     BLEScan* _pBLEScan = nullptr;
     BLEAdvertising* _pBLEAdvertising = nullptr;
@@ -0,0 +1,387 @@
+#include "ClockSync.h"
+#include "Kernel.h"
+#include "Logger.h"
+#include "PeerManager.h"
+#include <algorithm>
+#include <math.h>
+
+namespace {
+
+constexpr double kAlpha = 0.25;           // steady-state offset gain
+constexpr double kBeta = kAlpha * kAlpha / (2.0 - kAlpha);  // drift gain (critically damped)
+constexpr double kMaxDrift = 500e-6;      // far beyond any crystal; clamps filter wind-up
+constexpr double kJitterGain = 0.125;
+
+void putU64(uint8_t* out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+uint64_t getU64(const uint8_t* data) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) value = (value << 8) | data[i];
+    return value;
+}
+
+} // namespace
+
+ClockSync& ClockSync::instance() {
+    static ClockSync _instance;
+    return _instance;
+}
+
+ClockSync::ClockSync()
+    : _listening(false), _seq(0), _lastRequest(0), _cursor(0), _queueHead(0), _queueCount(0), _consensusOffsetUs(0),
+      _haveConsensus(false), _voters(0), _localSynced(false) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+uint64_t ClockSync::localUs() {
+    return Kernel::instance().getEpochTimeUs();
+}
+
+bool ClockSync::begin() {
+    if (_listening) return true;
+    if (!_udp.listen(kPort)) {
+        Logger::instance().error("ClockSync", "UDP listen on port %u failed", kPort);
+        return false;
+    }
+    _udp.onPacket([this](AsyncUDPPacket& packet) { handlePacket(packet); });
+    _listening = true;
+    Logger::instance().info("ClockSync", "Peer clock exchange on port %u", kPort);
+    return true;
+}
+
+size_t ClockSync::encode(uint8_t* out, size_t capacity, const Packet& packet) {
+    if (capacity < kPacketBytes) return 0;
+    out[0] = 'A';
+    out[1] = 'C';
+    out[2] = kWireVersion;
+    out[3] = packet.type;
+    out[4] = (uint8_t)packet.seq;
+    out[5] = (uint8_t)(packet.seq >> 8);
+    out[6] = packet.flags;
+    out[7] = 0;
+    putU64(out + 8, packet.t1);
+    putU64(out + 16, packet.t2);
+    putU64(out + 24, packet.t3);
+    return kPacketBytes;
+}
+
+bool ClockSync::decode(const uint8_t* data, size_t length, Packet& out) {
+    if (length < kPacketBytes || data[0] != 'A' || data[1] != 'C' || data[2] != kWireVersion) return false;
+    out.type = data[3];
+    if (out.type != kRequest && out.type != kReply) return false;
+    out.seq = (uint16_t)(data[4] | (data[5] << 8));
+    out.flags = data[6];
+    out.t1 = getU64(data + 8);
+    out.t2 = getU64(data + 16);
+    out.t3 = getU64(data + 24);
+    return true;
+}
+
+// async_udp task. Requests are answered right here so t2 and t3 bracket
+// only our own handling; replies are reduced to a sample for loop().
+void ClockSync::handlePacket(AsyncUDPPacket& packet) {
+    uint64_t arrivedUs = localUs();
+    Packet in;
+    bool valid = decode(packet.data(), packet.length(), in) && arrivedUs != 0;
+
+    if (valid && in.type == kRequest) {
+        Packet reply;
+        reply.type = kReply;
+        reply.seq = in.seq;
+        reply.flags = _localSynced ? kFlagSynced : 0;
+        reply.t1 = in.t1;
+        reply.t2 = arrivedUs;
+        uint8_t datagram[kPacketBytes];
+        encode(datagram, sizeof(datagram), reply);
+        reply.t3 = localUs();
+        putU64(datagram + 24, reply.t3);
+        _udp.writeTo(datagram, sizeof(datagram), packet.remoteIP(), kPort);
+
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+        _stats.replies++;
+        xSemaphoreGive(_mutex);
+        return;
+    }
+
+    Sample sample;
+    if (valid) {
+        // A reply older than its own request or with the peer's stamps reversed is garbage
+        valid = in.t1 != 0 && arrivedUs >= in.t1 && in.t3 >= in.t2;
+    }
+    if (valid) {
+        int64_t roundTrip = (int64_t)(arrivedUs - in.t1) - (int64_t)(in.t3 - in.t2);
+        sample.ip = HostIndex::key(packet.remoteIP());
+        sample.seq = in.seq;
+        sample.synced = (in.flags & kFlagSynced) != 0;
+        sample.t1 = in.t1;
+        sample.offsetUs = (((int64_t)(in.t2 - in.t1)) + ((int64_t)in.t3 - (int64_t)arrivedUs)) / 2;
+        sample.rttUs = roundTrip > 0 ? (uint32_t)roundTrip : 0;
+    }
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    if (!valid || _queueCount >= kQueueDepth) {
+        _stats.dropped++;
+    } else {
+        _queue[(_queueHead + _queueCount) % kQueueDepth] = sample;
+        _queueCount++;
+        _stats.samples++;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void ClockSync::loop() {
+    if (!_listening) return;
+
+    // Samples are applied under the mutex so web readers see whole updates
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) == pdTRUE) {
+        while (_queueCount > 0) {
+            Sample sample = _queue[_queueHead];
+            _queueHead = (uint8_t)((_queueHead + 1) % kQueueDepth);
+            _queueCount--;
+            applySample(sample);
+        }
+        xSemaphoreGive(_mutex);
+    }
+
+    unsigned long now = millis();
+    if (_lastRequest != 0 && now - _lastRequest < kRequestIntervalMs) return;
+    _lastRequest = now;
+    _localSynced = Kernel::instance().isTimeSynced();
+
+    for (auto& peer : _peers) {
+        if (peer.sentAt != 0 && now - peer.sentAt > kReplyTimeoutMs) peer.sentAt = 0;
+    }
+    updateConsensus();
+    sendRequest();
+}
+
+ClockSync::PeerClock* ClockSync::peerClock(uint32_t ip, bool create) {
+    uint16_t idx = _index.find(ip);
+    if (idx != HostIndex::kNone) return &_peers[idx];
+    if (!create || _peers.size() >= HostIndex::kNone) return nullptr;
+    PeerClock peer;
+    peer.ip = ip;
+    _peers.push_back(peer);
+    _index.insert(ip, (uint16_t)(_peers.size() - 1));
+    return &_peers.back();
+}
+
+void ClockSync::sendRequest() {
+    PeerManager::instance().getOnlinePeerAddresses(_targets);
+    if (_targets.empty()) return;
+
+    // Peers still settling go first, then round-robin
+    unsigned long now = millis();
+    size_t pick = _targets.size();
+    for (size_t i = 0; i < _targets.size(); ++i) {
+        size_t at = (_cursor + i) % _targets.size();
+        PeerClock* peer = peerClock(_targets[at], false);
+        if (peer && (peer->sentAt != 0 || now - peer->lastRequest < kPeerIntervalMs)) continue;
+        if (!peer || peer->samples < kSettledSamples) {
+            pick = at;
+            break;
+        }
+        if (pick == _targets.size()) pick = at;
+    }
+    if (pick == _targets.size()) return;
+
+    uint32_t ip = _targets[pick];
+    PeerClock* peer = peerClock(ip, false);
+    if (!peer) {
+        // May reallocate _peers under a web reader
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+        peer = peerClock(ip, true);
+        xSemaphoreGive(_mutex);
+        if (!peer) return;
+    }
+
+    Packet request;
+    request.type = kRequest;
+    request.seq = ++_seq;
+    request.flags = _localSynced ? kFlagSynced : 0;
+    request.t1 = localUs();
+    if (request.t1 == 0) return;
+    uint8_t datagram[kPacketBytes];
+    encode(datagram, sizeof(datagram), request);
+    peer->seq = request.seq;
+    peer->sentAt = now;
+    peer->lastRequest = now;
+    _udp.writeTo(datagram, sizeof(datagram), IPAddress(ip), kPort);
+    _cursor = (pick + 1) % _targets.size();
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    _stats.requests++;
+    xSemaphoreGive(_mutex);
+}
+
+// Called with _mutex held.
+void ClockSync::applySample(const Sample& sample) {
+    PeerClock* peer = peerClock(sample.ip, false);
+    if (!peer || peer->sentAt == 0 || sample.seq != peer->seq) {
+        _stats.dropped++;  // late (already timed out), duplicated or unsolicited
+        return;
+    }
+    peer->sentAt = 0;
+    peer->synced = sample.synced;
+
+    // Popcorn filter: only near-minimum round trips are close to symmetric
+    peer->rtt[peer->rttHead] = sample.rttUs;
+    peer->rttHead = (uint8_t)((peer->rttHead + 1) % kWindow);
+    if (peer->rttCount < kWindow) peer->rttCount++;
+    uint32_t minRtt = sample.rttUs;
+    for (uint8_t i = 0; i < peer->rttCount; ++i) minRtt = min(minRtt, peer->rtt[i]);
+    if (sample.rttUs > minRtt + kRttSlackUs) {
+        peer->rejected++;
+        return;
+    }
+
+    uint64_t atUs = sample.t1 + sample.rttUs / 2;
+    double measured = (double)sample.offsetUs;
+    peer->updatedAt = millis();
+    // Until it settles, an estimate seeded over a slower path than this one is
+    // discarded: the first sample passes the window trivially, spike or not
+    bool reseed = peer->samples < kSettledSamples && sample.rttUs + kRttSlackUs < peer->seedRttUs;
+    if (!peer->haveFilter || reseed) {
+        peer->haveFilter = true;
+        peer->seedRttUs = sample.rttUs;
+        peer->offsetUs = measured;
+        peer->drift = 0.0;
+        peer->jitterSq = 0.0;
+        peer->filterAtUs = atUs;
+        peer->samples = 1;
+        return;
+    }
+
+    double dt = (double)(int64_t)(atUs - peer->filterAtUs);
+    if (dt <= 0) return;
+    double predicted = peer->offsetUs + peer->drift * dt;
+    double residual = measured - predicted;
+    if (fabs(residual) > (double)kStepUs) {
+        // Only a near-minimum round trip gets here, so this is a real step (an
+        // SNTP resync). The crystal rate is unchanged: keep the drift and the
+        // peer's vote, and restart the offset from this sample.
+        Logger::instance().info("ClockSync", "%s clock stepped by %lld us", IPAddress(peer->ip).toString().c_str(),
+                                (long long)residual);
+        peer->offsetUs = measured;
+        peer->jitterSq = 0.0;
+        peer->filterAtUs = atUs;
+        return;
+    }
+
+    // The offset gain starts at 1/n so the first samples converge quickly.
+    // Drift is only learned once settled, at the steady gain: over a one-second
+    // baseline, 100 us of noise reads as 100 ppm.
+    double alpha = max(kAlpha, 1.0 / (peer->samples + 1));
+    peer->offsetUs = predicted + alpha * residual;
+    if (peer->samples >= kSettledSamples) {
+        peer->drift = constrain(peer->drift + kBeta * residual / dt, -kMaxDrift, kMaxDrift);
+    }
+    peer->jitterSq += kJitterGain * (residual * residual - peer->jitterSq);
+    peer->filterAtUs = atUs;
+    if (peer->samples < 0xFFFF) peer->samples++;
+}
+
+bool ClockSync::settled(const PeerClock& peer, unsigned long now) const {
+    return peer.haveFilter && peer.samples >= kSettledSamples && now - peer.updatedAt < kStaleMs;
+}
+
+void ClockSync::updateConsensus() {
+    unsigned long now = millis();
+    uint64_t nowUs = localUs();
+    if (nowUs == 0) return;
+
+    bool anySynced = _localSynced;
+    for (const auto& peer : _peers) {
+        if (settled(peer, now) && peer.synced) anySynced = true;
+    }
+
+    _votes.clear();
+    if (_localSynced || !anySynced) _votes.push_back(0);
+    for (const auto& peer : _peers) {
+        if (!settled(peer, now) || (anySynced && !peer.synced)) continue;
+        double ahead = (double)(int64_t)(nowUs - peer.filterAtUs);
+        _votes.push_back((int64_t)llround(peer.offsetUs + peer.drift * ahead));
+    }
+    if (_votes.empty()) return;
+
+    size_t mid = _votes.size() / 2;
+    std::nth_element(_votes.begin(), _votes.begin() + mid, _votes.end());
+    int64_t target = _votes[mid];
+    if (_votes.size() % 2 == 0) {
+        int64_t lower = *std::max_element(_votes.begin(), _votes.begin() + mid);
+        target = lower + (target - lower) / 2;
+    }
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    int64_t delta = target - _consensusOffsetUs;
+    if (!_haveConsensus || delta > kStepUs || delta < -kStepUs) {
+        if (_haveConsensus) {
+            Logger::instance().info("ClockSync", "Consensus stepped by %lld us", (long long)delta);
+        }
+        _consensusOffsetUs = target;
+        _haveConsensus = true;
+    } else {
+        // Slew, so synchronized windows never jump backwards by more than kSlewUs
+        _consensusOffsetUs += constrain(delta, -kSlewUs, kSlewUs);
+    }
+    _voters = (uint8_t)min(_votes.size(), (size_t)255);
+    xSemaphoreGive(_mutex);
+}
+
+int64_t ClockSync::consensusOffsetUs() {
+    int64_t offset = 0;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) == pdTRUE) {
+        offset = _consensusOffsetUs;
+        xSemaphoreGive(_mutex);
+    }
+    return offset;
+}
+
+uint64_t ClockSync::consensusTimeUs() {
+    uint64_t nowUs = localUs();
+    if (nowUs == 0) return 0;
+    return (uint64_t)((int64_t)nowUs + consensusOffsetUs());
+}
+
+bool ClockSync::estimate(uint32_t ip, ClockEstimate& out) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+    PeerClock* peer = peerClock(ip, false);
+    bool found = peer && peer->haveFilter;
+    if (found) {
+        uint64_t nowUs = localUs();
+        double ahead = nowUs > peer->filterAtUs ? (double)(nowUs - peer->filterAtUs) : 0.0;
+        out.offsetUs = (int64_t)llround(peer->offsetUs + peer->drift * ahead);
+        out.driftPpm = (float)(peer->drift * 1e6);
+        out.rttUs = peer->rtt[0];
+        for (uint8_t i = 1; i < peer->rttCount; ++i) out.rttUs = min(out.rttUs, peer->rtt[i]);
+        out.jitterUs = (uint32_t)sqrt(peer->jitterSq);
+        out.samples = peer->samples;
+        out.rejected = peer->rejected;
+        out.synced = peer->synced;
+        out.ageMs = millis() - peer->updatedAt;
+    }
+    xSemaphoreGive(_mutex);
+    return found;
+}
+
+ClockSyncStats ClockSync::stats() {
+    ClockSyncStats copy;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) == pdTRUE) {
+        copy = _stats;
+        xSemaphoreGive(_mutex);
+    }
+    return copy;
+}
+
+void ClockSync::populateStatus(JsonObject obj) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    obj["offset_us"] = (long long)_consensusOffsetUs;
+    obj["voters"] = _voters;
+    obj["requests"] = _stats.requests;
+    obj["samples"] = _stats.samples;
+    obj["replies"] = _stats.replies;
+    obj["dropped"] = _stats.dropped;
+    xSemaphoreGive(_mutex);
+}
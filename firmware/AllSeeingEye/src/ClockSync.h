@@ -0,0 +1,167 @@
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+#include <vector>
+#include "HostTable.h"
+
+// Peer-to-peer clock offset service and the cluster-consensus clock.
+//
+// SNTP resyncs each node only hourly, and ESP32 crystals drift tens of ppm
+// apart in between. Peers therefore measure each other directly with an
+// NTP-style exchange over unicast UDP. The requester stamps t1 and sends.
+// The peer stamps t2 on receipt and t3 on its immediate reply (both on the
+// async_udp task). The requester stamps t4 on receipt. Then:
+//   offset = ((t2 - t1) + (t3 - t4)) / 2     rtt = (t4 - t1) - (t3 - t2)
+// One peer is asked every kRequestIntervalMs, each at most every
+// kPeerIntervalMs, round-robin over PeerManager's online peers (those whose
+// estimate has not settled yet first).
+//
+// Per peer, a sample only counts if its RTT is within kRttSlackUs of the
+// smallest RTT in the last kWindow samples; queued packets make the path
+// asymmetric, and the offset error grows with the extra delay. Accepted
+// samples drive an alpha-beta filter for offset and drift. A residual beyond
+// kStepUs means one clock stepped (an SNTP resync): the offset restarts from
+// that sample, and the drift, a property of the crystals, is kept.
+//
+// Consensus time is the local clock plus the median offset over this node
+// (0) and every peer with a settled estimate. Every node computes the same
+// median, so the cluster converges on one timeline even if SNTP is lost. If
+// any clock is SNTP-synced, only synced clocks vote. The local correction
+// slews by at most kSlewUs per update, and steps only past kStepUs.
+//
+// Wire format, little-endian, 32 bytes:
+//   'A' 'C' | u8 wire version | u8 type (1 request, 2 reply) | u16 sequence
+//   u8 flags (bit 0: sender's clock is SNTP-synced) | u8 reserved
+//   u64 t1 | u64 t2 | u64 t3      (epoch microseconds; 0 in a request)
+
+struct ClockEstimate {
+    int64_t offsetUs = 0;     // peer clock minus ours, extrapolated to now
+    float driftPpm = 0.0f;    // how fast the offset grows
+    uint32_t rttUs = 0;       // smallest RTT of the recent samples
+    uint32_t jitterUs = 0;    // RMS filter residual
+    uint16_t samples = 0;     // accepted by the filter
+    uint32_t rejected = 0;    // samples dropped for a long RTT
+    bool synced = false;      // peer reported an SNTP-synced clock
+    unsigned long ageMs = 0;  // since the last accepted sample
+};
+
+struct ClockSyncStats {
+    uint32_t requests = 0;
+    uint32_t replies = 0;     // replies sent to peers
+    uint32_t samples = 0;     // replies received
+    uint32_t dropped = 0;     // malformed, unexpected or queue full
+};
+
+class ClockSync {
+public:
+    static constexpr uint16_t kPort = 5455;
+    static constexpr uint8_t kWireVersion = 1;
+    static constexpr size_t kPacketBytes = 32;
+    static constexpr uint32_t kRequestIntervalMs = 100;
+    static constexpr uint32_t kPeerIntervalMs = 1000;
+    static constexpr uint32_t kReplyTimeoutMs = 500;
+    static constexpr uint8_t kWindow = 8;
+    static constexpr uint32_t kRttSlackUs = 400;
+    static constexpr int64_t kStepUs = 50000;
+    static constexpr int64_t kSlewUs = 1000;
+    static constexpr uint16_t kSettledSamples = 4;
+    static constexpr uint32_t kStaleMs = 60000;
+    static constexpr uint8_t kQueueDepth = 16;
+
+    static ClockSync& instance();
+
+    bool begin();
+    void loop();
+
+    // Any task: this node's clock corrected onto the cluster timeline, epoch microseconds.
+    uint64_t consensusTimeUs();
+    int64_t consensusOffsetUs();
+
+    // Loop or web side: the estimate of one peer (HostIndex::key), false if none.
+    bool estimate(uint32_t ip, ClockEstimate& out);
+    void populateStatus(JsonObject obj);
+    ClockSyncStats stats();
+
+    struct Packet {
+        uint8_t type = 0;
+        uint16_t seq = 0;
+        uint8_t flags = 0;
+        uint64_t t1 = 0;
+        uint64_t t2 = 0;
+        uint64_t t3 = 0;
+    };
+    static constexpr uint8_t kRequest = 1;
+    static constexpr uint8_t kReply = 2;
+    static constexpr uint8_t kFlagSynced = 0x01;
+    static size_t encode(uint8_t* out, size_t capacity, const Packet& packet);
+    static bool decode(const uint8_t* data, size_t length, Packet& out);
+
+private:
+    ClockSync();
+
+    struct Sample {
+        uint32_t ip;
+        uint16_t seq;
+        bool synced;
+        uint64_t t1;
+        int64_t offsetUs;
+        uint32_t rttUs;
+    };
+
+    struct PeerClock {
+        uint32_t ip = 0;
+        uint16_t seq = 0;             // of the outstanding request
+        unsigned long sentAt = 0;     // 0: none outstanding
+        unsigned long lastRequest = 0;
+        uint32_t rtt[kWindow];
+        uint8_t rttCount = 0;
+        uint8_t rttHead = 0;
+        bool haveFilter = false;
+        uint32_t seedRttUs = 0;       // RTT of the sample that started the filter
+        uint64_t filterAtUs = 0;      // local clock of the last update
+        double offsetUs = 0.0;
+        double drift = 0.0;           // us per us
+        double jitterSq = 0.0;
+        uint16_t samples = 0;
+        uint32_t rejected = 0;
+        bool synced = false;
+        unsigned long updatedAt = 0;
+    };
+
+    void handlePacket(AsyncUDPPacket& packet);
+    void sendRequest();
+    void applySample(const Sample& sample);
+    void updateConsensus();
+    PeerClock* peerClock(uint32_t ip, bool create);
+    bool settled(const PeerClock& peer, unsigned long now) const;
+    static uint64_t localUs();
+
+    AsyncUDP _udp;
+    bool _listening;
+    uint16_t _seq;
+    unsigned long _lastRequest;
+    size_t _cursor;
+    std::vector<uint32_t> _targets;  // reused each round, no allocation once sized
+
+    HostIndex _index;                // ip -> _peers position
+    std::vector<PeerClock> _peers;
+
+    Sample _queue[kQueueDepth];
+    uint8_t _queueHead;
+    uint8_t _queueCount;
+
+    std::vector<int64_t> _votes;      // reused by updateConsensus()
+    int64_t _consensusOffsetUs;
+    bool _haveConsensus;
+    uint8_t _voters;
+    volatile bool _localSynced;
+    ClockSyncStats _stats;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
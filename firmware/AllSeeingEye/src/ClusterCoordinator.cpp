@@ -0,0 +1,242 @@
+#include "ClusterCoordinator.h"
+#include "ClockSync.h"
+#include "ClusterGossip.h"
+#include "Config.h"
+#include "Logger.h"
+#include "PeerManager.h"
+#include "PluginManager.h"
+#include "SubnetScanner.h"
+#include <WiFi.h>
+
+ClusterCoordinator& ClusterCoordinator::instance() {
+    static ClusterCoordinator _instance;
+    return _instance;
+}
+
+ClusterCoordinator::ClusterCoordinator()
+    : _selfOrigin(0), _leader(0), _isLeader(true), _lastEval(0), _clusterConfigVersion(0), _clusterKnown(false),
+      _havePending(false), _pendingAt(0), _started(false), _newestSeen(0), _version(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void ClusterCoordinator::begin(const String& hostname) {
+    _selfOrigin = ClusterGossip::hash(hostname.c_str());
+    if (_selfOrigin == 0) _selfOrigin = 1;
+}
+
+bool ClusterCoordinator::ipBefore(uint32_t a, uint32_t b) {
+    return SubnetScanner::toHostOrder(IPAddress(a)) < SubnetScanner::toHostOrder(IPAddress(b));
+}
+
+uint32_t ClusterCoordinator::propose(const String& taskId, const String& paramsJson) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return 0;
+    Deployment& d = _pending;
+    d.version = max(_newestSeen, _applied.version) + 1;
+    d.origin = _selfOrigin;
+    d.taskId = taskId;
+    d.paramsJson = paramsJson;
+    d.startAt = 0;
+    _newestSeen = d.version;
+    _havePending = true;
+    _pendingAt = millis();
+    _stats.proposals++;
+    _version++;
+    uint32_t version = d.version;
+    xSemaphoreGive(_mutex);
+    Logger::instance().info("Cluster", "Proposed v%lu: %s", (unsigned long)version, taskId.c_str());
+    return version;
+}
+
+uint32_t ClusterCoordinator::requestStart(uint32_t& startAt) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return 0;
+    Deployment base = _havePending ? _pending : _applied;
+    if (base.version == 0 || base.taskId.length() == 0) {
+        xSemaphoreGive(_mutex);
+        return 0;
+    }
+    // Far enough ahead for the leader and every follower to hear of it
+    startAt = (uint32_t)(ClockSync::instance().consensusTimeUs() / 1000000ULL) + kStartLeadS;
+    _pending = base;
+    _pending.version = max(_newestSeen, _applied.version) + 1;
+    _pending.origin = _selfOrigin;
+    _pending.startAt = startAt;
+    _newestSeen = _pending.version;
+    _havePending = true;
+    _pendingAt = millis();
+    _stats.proposals++;
+    _version++;
+    uint32_t version = _pending.version;
+    xSemaphoreGive(_mutex);
+    Logger::instance().info("Cluster", "Proposed v%lu: start at %lu", (unsigned long)version, (unsigned long)startAt);
+    return version;
+}
+
+void ClusterCoordinator::loop() {
+    checkStart();
+    unsigned long now = millis();
+    if (_lastEval != 0 && now - _lastEval < kEvalIntervalMs) return;
+    _lastEval = now;
+
+    // An NVS read: only after a config change, not every tick
+    uint32_t configVersion = Config::instance().version();
+    if (!_clusterKnown || configVersion != _clusterConfigVersion) {
+        _cluster = Config::instance().getString("cluster", "Default");
+        _clusterConfigVersion = configVersion;
+        _clusterKnown = true;
+    }
+    const String& cluster = _cluster;
+    PeerManager::instance().getClusterMembers(cluster, _members);
+
+    uint32_t self = HostIndex::key(WiFi.localIP());
+    uint32_t leader = self;
+    const ClusterMember* leaderMember = nullptr;
+    for (const auto& m : _members) {
+        if (ipBefore(m.ip, leader)) {
+            leader = m.ip;
+            leaderMember = &m;
+        }
+    }
+    if (leader != _leader && _leader != 0) {
+        Logger::instance().info("Cluster", "Leader of %s is now %s%s", cluster.c_str(), IPAddress(leader).toString().c_str(),
+                                leaderMember ? "" : " (this node)");
+    }
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    bool hadPending = _havePending;
+    uint32_t pendingVersion = _pending.version;
+    if (leader != _leader) _version++;
+    _leader = leader;
+    _isLeader = leaderMember == nullptr;
+    for (const auto& m : _members) _newestSeen = max(_newestSeen, m.deployment.version);
+
+    Deployment next;
+    if (_isLeader) {
+        // Adopt the newest proposal, ours or a follower's, above what we run
+        const Deployment* best = _havePending ? &_pending : nullptr;
+        for (const auto& m : _members) {
+            const Deployment& d = m.deployment;
+            if (d.version <= _applied.version) continue;
+            if (!best || d.version > best->version || (d.version == best->version && d.origin < best->origin)) best = &d;
+        }
+        if (best && best == &_pending && _pending.version <= _applied.version) {
+            _pending.version = _applied.version + 1;  // minted before we knew our own version
+            _newestSeen = max(_newestSeen, _pending.version);
+        }
+        if (best) next = *best;
+        if (best == &_pending) _havePending = false;
+    } else {
+        const Deployment& ruling = leaderMember->deployment;
+        if (_havePending) {
+            if (ruling.sameAs(_pending)) {
+                _havePending = false;  // adopted
+            } else if (millis() - _pendingAt > kProposalTimeoutMs) {
+                Logger::instance().warn("Cluster", "Proposal v%lu (%s) not adopted by the leader, dropped",
+                                        (unsigned long)_pending.version, _pending.taskId.c_str());
+                _havePending = false;
+                _stats.expired++;
+            } else if (ruling.version >= _pending.version) {
+                // The leader took another proposal of this version; go above it
+                _pending.version = max(_newestSeen, ruling.version) + 1;
+                _newestSeen = _pending.version;
+                _stats.superseded++;
+            }
+        }
+        if (ruling.version != 0 && !ruling.sameAs(_applied) && ruling.version >= _applied.version) next = ruling;
+    }
+    if (_havePending != hadPending || _pending.version != pendingVersion) _version++;
+    xSemaphoreGive(_mutex);
+
+    if (next.version != 0) {
+        apply(next);
+        checkStart();  // a start time already passed (late joiner) or no wait at all
+    }
+}
+
+void ClusterCoordinator::apply(const Deployment& d) {
+    bool restage = !d.sameTask(_applied) || _applied.version == 0;
+    Logger::instance().info("Cluster", "Applying v%lu from %08lx: %s%s", (unsigned long)d.version, (unsigned long)d.origin,
+                            d.taskId.c_str(), restage ? "" : " (already staged)");
+    if (restage) {
+        JsonDocument paramsDoc;
+        if (d.paramsJson.length() > 0) deserializeJson(paramsDoc, d.paramsJson);
+        JsonObject params = paramsDoc.as<JsonObject>();
+        if (!PluginManager::instance().deployTask(d.taskId, params)) {
+            Logger::instance().error("Cluster", "Deploy of %s failed", d.taskId.c_str());
+        }
+    }
+
+    if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE) return;
+    _applied = d;
+    if (restage) {
+        _started = false;
+        _stats.deploys++;
+    }
+    _stats.applied++;
+    _version++;
+    xSemaphoreGive(_mutex);
+}
+
+void ClusterCoordinator::checkStart() {
+    if (_started || _applied.startAt == 0) return;
+    uint64_t nowUs = ClockSync::instance().consensusTimeUs();
+    if (nowUs < (uint64_t)_applied.startAt * 1000000ULL) return;
+
+    PluginManager::instance().startStagedTask();
+    Logger::instance().info("Cluster", "Started v%lu (%s), %lu ms after its start time", (unsigned long)_applied.version,
+                            _applied.taskId.c_str(), (unsigned long)((nowUs - (uint64_t)_applied.startAt * 1000000ULL) / 1000ULL));
+    if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE) return;
+    _started = true;
+    _stats.starts++;
+    _version++;
+    xSemaphoreGive(_mutex);
+}
+
+Deployment ClusterCoordinator::published() {
+    Deployment d;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return d;
+    d = _havePending ? _pending : _applied;
+    xSemaphoreGive(_mutex);
+    return d;
+}
+
+Deployment ClusterCoordinator::applied() {
+    Deployment d;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return d;
+    d = _applied;
+    xSemaphoreGive(_mutex);
+    return d;
+}
+
+bool ClusterCoordinator::isStarted() {
+    return _started;
+}
+
+bool ClusterCoordinator::isLeader() {
+    return _isLeader;
+}
+
+uint32_t ClusterCoordinator::leader() {
+    return _leader;
+}
+
+CoordinatorStats ClusterCoordinator::stats() {
+    CoordinatorStats copy;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) == pdTRUE) {
+        copy = _stats;
+        xSemaphoreGive(_mutex);
+    }
+    return copy;
+}
+
+void ClusterCoordinator::populateStatus(JsonObject obj) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    obj["leader"] = _leader != 0 ? IPAddress(_leader).toString() : String("");
+    obj["is_leader"] = _isLeader;
+    obj["applied_version"] = _applied.version;
+    obj["started"] = _started;
+    if (_havePending) obj["proposed_version"] = _pending.version;
+    obj["applied"] = _stats.applied;
+    obj["deploys"] = _stats.deploys;
+    obj["starts"] = _stats.starts;
+    xSemaphoreGive(_mutex);
+}
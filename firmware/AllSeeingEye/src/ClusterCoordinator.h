@@ -0,0 +1,112 @@
+#ifndef CLUSTER_COORDINATOR_H
+#define CLUSTER_COORDINATOR_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+
+// Leader-based, versioned cluster task deployments.
+//
+// A deployment is a task id and params, a version that only grows, the
+// FNV-1a of the hostname that requested it (its origin) and an optional
+// start time in consensus epoch seconds (ClockSync.h; 0: staged only).
+// (version, origin) names a deployment, and each node applies a name once.
+// Applying one whose task and params match what is already staged only arms
+// its start time, so starting a staged task never re-creates the plugin.
+//
+// The leader of a cluster is its coordinated node (this firmware or later)
+// with the lowest IPv4 address among those online. Every node computes the
+// same leader from PeerManager's view, so no election messages are needed.
+// A deploy or start request on any node becomes a proposal one version
+// above the newest it knows, published in its /api/status and gossip. The
+// leader adopts a proposal newer than its own deployment, and followers
+// apply only what the leader publishes. A proposer that lost a race (the
+// leader adopted another proposal of that version) re-proposes above it
+// until kProposalTimeoutMs. So a change reaches the cluster in two gossip
+// hops plus two status reads, and a node never flips between the
+// deployments of different peers.
+
+struct Deployment {
+    uint32_t version = 0;     // 0: none
+    uint32_t origin = 0;
+    String taskId;
+    String paramsJson;
+    uint32_t startAt = 0;     // consensus epoch second; 0: staged, not started
+
+    bool sameAs(const Deployment& other) const { return version == other.version && origin == other.origin; }
+    bool sameTask(const Deployment& other) const { return taskId == other.taskId && paramsJson == other.paramsJson; }
+};
+
+// A coordinated peer of our cluster and the deployment it publishes.
+struct ClusterMember {
+    uint32_t ip = 0;          // HostIndex::key
+    Deployment deployment;
+};
+
+struct CoordinatorStats {
+    uint32_t applied = 0;     // deployments applied
+    uint32_t deploys = 0;     // of those, ones that (re)created the plugin
+    uint32_t starts = 0;
+    uint32_t proposals = 0;
+    uint32_t superseded = 0;  // proposals re-proposed after losing a race
+    uint32_t expired = 0;     // proposals dropped after kProposalTimeoutMs
+};
+
+class ClusterCoordinator {
+public:
+    static constexpr uint32_t kStartLeadS = 2;           // start requests begin this far in the future
+    static constexpr uint32_t kProposalTimeoutMs = 15000;
+    static constexpr uint32_t kEvalIntervalMs = 50;      // leader and deployment checks; starts are checked every loop()
+
+    static ClusterCoordinator& instance();
+
+    void begin(const String& hostname);
+    void loop();
+
+    // Any task (web handlers). Proposes a deployment of taskId, or the start of
+    // the published one; returns its version, 0 if there is nothing to start.
+    uint32_t propose(const String& taskId, const String& paramsJson);
+    uint32_t requestStart(uint32_t& startAt);
+
+    // What this node publishes: its open proposal, else the applied deployment.
+    Deployment published();
+    Deployment applied();
+    bool isStarted();                  // the applied task has been started
+    bool isLeader();
+    uint32_t leader();                 // HostIndex::key, 0 before the first loop()
+    CoordinatorStats stats();
+    void populateStatus(JsonObject obj);
+    // Bumped whenever published() or populateStatus() would change
+    uint32_t version() const { return _version; }
+
+    // Lowest address first, in host byte order
+    static bool ipBefore(uint32_t a, uint32_t b);
+
+private:
+    ClusterCoordinator();
+
+    void apply(const Deployment& deployment);
+    void checkStart();
+
+    uint32_t _selfOrigin;
+    uint32_t _leader;
+    bool _isLeader;
+    unsigned long _lastEval;
+    std::vector<ClusterMember> _members;  // reused each loop
+    String _cluster;                      // cluster name, re-read when Config::version() moves
+    uint32_t _clusterConfigVersion;
+    bool _clusterKnown;
+
+    Deployment _applied;
+    Deployment _pending;
+    bool _havePending;
+    unsigned long _pendingAt;
+    bool _started;
+    uint32_t _newestSeen;                 // highest version this node has seen
+    CoordinatorStats _stats;
+    volatile uint32_t _version;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include "ClusterGossip.h"
+#include "Logger.h"
+
+namespace {
+
+size_t putString(uint8_t* out, size_t pos, size_t capacity, const String& text, size_t maxLength) {
+    size_t len = min((size_t)text.length(), maxLength);
+    if (pos + 1 + len > capacity) return 0;
+    out[pos++] = (uint8_t)len;
+    memcpy(out + pos, text.c_str(), len);
+    return pos + len;
+}
+
+size_t putU32(uint8_t* out, size_t pos, size_t capacity, uint32_t value) {
+    if (pos + 4 > capacity) return 0;
+    for (int i = 0; i < 4; ++i) out[pos + i] = (uint8_t)(value >> (8 * i));
+    return pos + 4;
+}
+
+bool getString(const uint8_t* data, size_t length, size_t& pos, char* out, size_t outSize) {
+    if (pos >= length) return false;
+    size_t len = data[pos++];
+    if (pos + len > length) return false;
+    size_t copy = min(len, outSize - 1);
+    memcpy(out, data + pos, copy);
+    out[copy] = '\0';
+    pos += len;
+    return true;
+}
+
+bool getU32(const uint8_t* data, size_t length, size_t& pos, uint32_t& value) {
+    if (pos + 4 > length) return false;
+    value = (uint32_t)data[pos] | ((uint32_t)data[pos + 1] << 8) | ((uint32_t)data[pos + 2] << 16) |
+            ((uint32_t)data[pos + 3] << 24);
+    pos += 4;
+    return true;
+}
+
+} // namespace
+
+ClusterGossip& ClusterGossip::instance() {
+    static ClusterGossip _instance;
+    return _instance;
+}
+
+ClusterGossip::ClusterGossip()
+    : _listening(false), _hostHash(0), _fullIntervalMs(kFullIntervalMs), _haveLocal(false), _version(0), _dirty(0),
+      _changedAt(0), _lastFull(0), _queueHead(0), _queueCount(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+uint32_t ClusterGossip::hash(const char* text) {
+    uint32_t h = 2166136261u;
+    for (const char* c = text; *c; ++c) {
+        h ^= (uint8_t)*c;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+bool ClusterGossip::begin(const String& hostname) {
+    if (_listening) return true;
+    _hostHash = hash(hostname.c_str());
+    // Spread the beacons of nodes that booted together over one second
+    _fullIntervalMs = kFullIntervalMs - (_hostHash % 1000);
+
+    if (!_udp.listenMulticast(group(), kPort)) {
+        Logger::instance().error("Gossip", "Multicast listen on %s:%u failed", group().toString().c_str(), kPort);
+        return false;
+    }
+    _udp.onPacket([this](AsyncUDPPacket& packet) { handlePacket(packet); });
+    _listening = true;
+    Logger::instance().info("Gossip", "Cluster gossip on %s:%u (beacon every %lu ms)", group().toString().c_str(), kPort,
+                            (unsigned long)_fullIntervalMs);
+    return true;
+}
+
+void ClusterGossip::setLocalState(const GossipState& state) {
+    uint8_t changed = 0;
+    if (!_haveLocal) {
+        changed = GOSSIP_ALL;
+    } else {
+        if (state.cluster != _local.cluster) changed |= GOSSIP_CLUSTER;
+        if (state.status != _local.status) changed |= GOSSIP_STATUS;
+        if (state.task != _local.task) changed |= GOSSIP_TASK;
+        if (state.desiredVersion != _local.desiredVersion || state.desiredOrigin != _local.desiredOrigin) {
+            changed |= GOSSIP_DESIRED;
+        }
+        if (state.startAt != _local.startAt) changed |= GOSSIP_START;
+    }
+    _local = state;
+    _haveLocal = true;
+    if (changed != 0) {
+        if (_dirty == 0) _changedAt = millis();
+        _dirty |= changed;
+    }
+}
+
+void ClusterGossip::loop() {
+    if (!_listening || !_haveLocal) return;
+
+    unsigned long now = millis();
+    if (_lastFull == 0 || now - _lastFull >= _fullIntervalMs) {
+        // A full beacon carries every pending change too
+        if (_dirty != 0) _version++;
+        _dirty = 0;
+        send(true, GOSSIP_ALL);
+        _lastFull = now;
+    } else if (_dirty != 0 && now - _changedAt >= kDeltaHoldMs) {
+        _version++;
+        send(false, _dirty | GOSSIP_UPTIME);
+        _dirty = 0;
+    }
+}
+
+void ClusterGossip::send(bool full, uint8_t fields) {
+    uint8_t datagram[kMaxDatagram];
+    size_t len = encode(datagram, sizeof(datagram), _hostHash, _version, full, fields, _local);
+    if (len == 0) return;
+    _udp.writeTo(datagram, len, group(), kPort);
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    if (full) _stats.sentFull++;
+    else _stats.sentDelta++;
+    _stats.sentBytes += len;
+    xSemaphoreGive(_mutex);
+}
+
+size_t ClusterGossip::encode(uint8_t* out, size_t capacity, uint32_t hostHash, uint16_t version, bool full, uint8_t fields,
+                             const GossipState& state) {
+    if (capacity < 11) return 0;
+    out[0] = 'A';
+    out[1] = 'G';
+    out[2] = kWireVersion;
+    out[3] = full ? 0x01 : 0x00;
+    putU32(out, 4, capacity, hostHash);
+    out[8] = (uint8_t)version;
+    out[9] = (uint8_t)(version >> 8);
+    out[10] = fields & GOSSIP_ALL;
+
+    size_t pos = 11;
+    if (fields & GOSSIP_CLUSTER) pos = putString(out, pos, capacity, state.cluster, sizeof(GossipRecord::cluster) - 1);
+    if (pos && (fields & GOSSIP_STATUS)) pos = putString(out, pos, capacity, state.status, sizeof(GossipRecord::status) - 1);
+    if (pos && (fields & GOSSIP_TASK)) pos = putString(out, pos, capacity, state.task, sizeof(GossipRecord::task) - 1);
+    if (pos && (fields & GOSSIP_DESIRED)) pos = putU32(out, pos, capacity, state.desiredVersion);
+    if (pos && (fields & GOSSIP_DESIRED)) pos = putU32(out, pos, capacity, state.desiredOrigin);
+    if (pos && (fields & GOSSIP_START)) pos = putU32(out, pos, capacity, state.startAt);
+    if (pos && (fields & GOSSIP_UPTIME)) pos = putU32(out, pos, capacity, state.uptimeS);
+    return pos;
+}
+
+bool ClusterGossip::decode(const uint8_t* data, size_t length, GossipRecord& out) {
+    if (length < 11 || data[0] != 'A' || data[1] != 'G' || data[2] != kWireVersion) return false;
+    out.full = (data[3] & 0x01) != 0;
+    size_t pos = 4;
+    getU32(data, length, pos, out.hostHash);
+    out.version = (uint16_t)(data[8] | (data[9] << 8));
+    out.fields = data[10] & GOSSIP_ALL;
+    out.cluster[0] = out.status[0] = out.task[0] = '\0';
+
+    pos = 11;
+    if ((out.fields & GOSSIP_CLUSTER) && !getString(data, length, pos, out.cluster, sizeof(out.cluster))) return false;
+    if ((out.fields & GOSSIP_STATUS) && !getString(data, length, pos, out.status, sizeof(out.status))) return false;
+    if ((out.fields & GOSSIP_TASK) && !getString(data, length, pos, out.task, sizeof(out.task))) return false;
+    if ((out.fields & GOSSIP_DESIRED) &&
+        (!getU32(data, length, pos, out.desiredVersion) || !getU32(data, length, pos, out.desiredOrigin))) {
+        return false;
+    }
+    if ((out.fields & GOSSIP_START) && !getU32(data, length, pos, out.startAt)) return false;
+    if ((out.fields & GOSSIP_UPTIME) && !getU32(data, length, pos, out.uptimeS)) return false;
+    return true;
+}
+
+void ClusterGossip::handlePacket(AsyncUDPPacket& packet) {
+    GossipRecord record;
+    bool valid = decode(packet.data(), packet.length(), record);
+    if (valid && record.hostHash == _hostHash) return;  // our own beacon, looped back
+    record.ip = packet.remoteIP();
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    if (!valid || _queueCount >= kQueueDepth) {
+        _stats.dropped++;
+    } else {
+        _queue[(_queueHead + _queueCount) % kQueueDepth] = record;
+        _queueCount++;
+        _stats.received++;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+bool ClusterGossip::poll(GossipRecord& out) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+    bool any = _queueCount > 0;
+    if (any) {
+        out = _queue[_queueHead];
+        _queueHead = (uint8_t)((_queueHead + 1) % kQueueDepth);
+        _queueCount--;
+    }
+    xSemaphoreGive(_mutex);
+    return any;
+}
+
+GossipStats ClusterGossip::stats() {
+    GossipStats stats;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return stats;
+    stats = _stats;
+    xSemaphoreGive(_mutex);
+    return stats;
+}
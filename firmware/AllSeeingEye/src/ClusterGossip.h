@@ -0,0 +1,128 @@
+#ifndef CLUSTER_GOSSIP_H
+#define CLUSTER_GOSSIP_H
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include <WiFi.h>
+
+// UDP multicast heartbeat carrying each node's cluster state.
+//
+// Every node sends its own record to kGroup:kPort: a full beacon every
+// ~10 s, and a delta with only the changed fields (plus uptime) within
+// kDeltaHoldMs of a change. Each delta bumps the sender's state version.
+// A receiver that sees a version gap (a lost delta) missed a change, and
+// PeerManager then re-reads that peer's /api/status once. Datagrams are
+// parsed on the async_udp task into fixed-size records and handed to the
+// loop with poll(), like PeerProbeEngine results.
+//
+// Wire format, little-endian, one datagram per record (at most 158 bytes):
+//   'A' 'G' | u8 wire version | u8 flags (bit 0: full beacon)
+//   u32 FNV-1a of the sender's hostname | u16 state version | u8 field mask
+//   then the fields in mask bit order:
+//     cluster, status, task: u8 length + bytes (truncated to the record size)
+//     deployment: u32 version (0 = none) + u32 origin | start at: u32 epoch s (0 = staged)
+//     uptime: u32 s
+// Wire version 2 (versioned deployments, ClusterCoordinator.h) replaced the
+// task hash and start flag of version 1; version 1 datagrams are dropped, and
+// such peers are read over HTTP as if they did not gossip.
+
+enum GossipField : uint8_t {
+    GOSSIP_CLUSTER = 0x01,
+    GOSSIP_STATUS = 0x02,
+    GOSSIP_TASK = 0x04,
+    GOSSIP_DESIRED = 0x08,
+    GOSSIP_START = 0x10,
+    GOSSIP_UPTIME = 0x20,
+    GOSSIP_ALL = 0x3F
+};
+
+struct GossipState {
+    String cluster;
+    String status;
+    String task;
+    uint32_t desiredVersion = 0;
+    uint32_t desiredOrigin = 0;
+    uint32_t startAt = 0;
+    uint32_t uptimeS = 0;
+};
+
+struct GossipRecord {
+    IPAddress ip;
+    uint32_t hostHash = 0;
+    uint16_t version = 0;
+    bool full = false;
+    uint8_t fields = 0;   // fields present in the datagram
+    char cluster[32];
+    char status[48];
+    char task[48];
+    uint32_t desiredVersion = 0;
+    uint32_t desiredOrigin = 0;
+    uint32_t startAt = 0;
+    uint32_t uptimeS = 0;
+};
+
+struct GossipStats {
+    uint32_t sentFull = 0;
+    uint32_t sentDelta = 0;
+    uint32_t sentBytes = 0;
+    uint32_t received = 0;
+    uint32_t dropped = 0;   // malformed, or the queue was full
+};
+
+class ClusterGossip {
+public:
+    static constexpr uint16_t kPort = 5454;
+    static constexpr uint32_t kFullIntervalMs = 10000;
+    static constexpr uint32_t kDeltaHoldMs = 100;   // coalesces bursts of changes
+    static constexpr uint32_t kStaleMs = 35000;     // three missed beacons
+    static constexpr uint8_t kQueueDepth = 16;
+    static constexpr size_t kMaxDatagram = 160;
+    static constexpr uint8_t kWireVersion = 2;
+
+    static ClusterGossip& instance();
+    static IPAddress group() { return IPAddress(239, 255, 65, 69); }
+
+    bool begin(const String& hostname);
+
+    // Loop side: the node's current state; changed fields go out as a delta.
+    void setLocalState(const GossipState& state);
+    void loop();
+
+    // Loop side: next record heard from another node, oldest first.
+    bool poll(GossipRecord& out);
+
+    bool active() const { return _listening; }
+    uint32_t hostHash() const { return _hostHash; }
+    GossipStats stats();
+
+    static uint32_t hash(const char* text);
+    static size_t encode(uint8_t* out, size_t capacity, uint32_t hostHash, uint16_t version, bool full, uint8_t fields,
+                         const GossipState& state);
+    static bool decode(const uint8_t* data, size_t length, GossipRecord& out);
+
+private:
+    ClusterGossip();
+
+    void send(bool full, uint8_t fields);
+    void handlePacket(AsyncUDPPacket& packet);
+
+    AsyncUDP _udp;
+    bool _listening;
+    uint32_t _hostHash;
+    uint32_t _fullIntervalMs;
+    GossipState _local;
+    bool _haveLocal;
+    uint16_t _version;
+    uint8_t _dirty;
+    unsigned long _changedAt;
+    unsigned long _lastFull;
+
+    GossipRecord _queue[kQueueDepth];
+    uint8_t _queueHead;
+    uint8_t _queueCount;
+    GossipStats _stats;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
@@ -31,6 +31,7 @@ String Config::getWifiPass() {
 void Config::setWifi(String ssid, String pass) {
     _prefs.putString("ssid", ssid);
     _prefs.putString("pass", pass);
+    _version++;
 }
 
 String Config::getHostname() {
@@ -54,6 +55,7 @@ String Config::getHostname() {
 
 void Config::setHostname(String hostname) {
     _prefs.putString("hostname", hostname);
+    _version++;
 }
 
 String Config::getTimezone() {
@@ -62,6 +64,7 @@ String Config::getTimezone() {
 
 void Config::setTimezone(String timezone) {
     _prefs.putString("timezone", timezone);
+    _version++;
 }
 
 // Generic wrappers
@@ -71,6 +74,7 @@ String Config::getString(const char* key, String defaultValue) {
 
 void Config::setString(const char* key, String value) {
     _prefs.putString(key, value);
+    _version++;
 }
 
 int Config::getInt(const char* key, int defaultValue) {
@@ -79,6 +83,7 @@ int Config::getInt(const char* key, int defaultValue) {
 
 void Config::setInt(const char* key, int value) {
     _prefs.putInt(key, value);
+    _version++;
 }
 
 // Serialization
@@ -34,9 +34,13 @@ public:
     String getAllAsJson(); 
     bool updateFromJson(String jsonBody);
 
+    // Bumped by every setter, so readers can cache values instead of re-reading NVS
+    uint32_t version() const { return _version; }
+
 private:
     Config();
     Preferences _prefs;
+    volatile uint32_t _version = 0;
 };
 
 #endif
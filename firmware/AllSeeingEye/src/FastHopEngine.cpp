@@ -0,0 +1,285 @@
+#include "FastHopEngine.h"
+#include "Logger.h"
+#include <RadioLib.h>
+
+// CC1101 SPI header bits / register addresses come from RadioLib's CC1101.h.
+// Status registers (0x30-0x3D) must be read with the burst bit set.
+
+namespace {
+// RSSI status register: signed, 0.5 dB per LSB.
+float rssiDbm(float raw) {
+    return (raw / 2.0f) - RADIOLIB_CC1101_DEFAULT_RSSI_OFFSET;
+}
+}
+
+FastHopEngine::FastHopEngine()
+    : _spi(nullptr), _csPin(0), _spiSettings(kSpiClockHz, MSBFIRST, SPI_MODE0), _begun(false), _prepared(false),
+      _binCount(0), _startMhz(0.0f), _stepMhz(0.0f), _rxBwKhz(0.0f), _settleUs(0), _sampleUs(0), _calibratedAtMs(0),
+      _calibrationMs(0), _tableBwBits(0), _detailBwBits(0), _detailRxBwKhz(0.0f), _detailSettleUs(0),
+      _detailCalibrations(0), _savedMcsm0(0), _savedMdmcfg4(0) {}
+
+bool FastHopEngine::begin(SPIClass* spi, uint8_t csPin) {
+    if (!spi) return false;
+    if (_begun) return true;
+    _spi = spi;
+    _csPin = csPin;
+    _savedMcsm0 = readReg(RADIOLIB_CC1101_REG_MCSM0);
+    _savedMdmcfg4 = readReg(RADIOLIB_CC1101_REG_MDMCFG4);
+    _begun = true;
+    _prepared = false;
+    return true;
+}
+
+void FastHopEngine::end() {
+    if (!_begun) return;
+    strobe(RADIOLIB_CC1101_CMD_IDLE);
+    // Hand the radio back to RadioLib the way we found it (autocal on IDLE->RX).
+    writeReg(RADIOLIB_CC1101_REG_MCSM0, _savedMcsm0);
+    writeReg(RADIOLIB_CC1101_REG_MDMCFG4, _savedMdmcfg4);
+    _begun = false;
+    _prepared = false;
+}
+
+bool FastHopEngine::prepare(float startMhz, float stopMhz, float stepMhz, float bandwidthKhz) {
+    _prepared = false;
+    if (!_begun || stepMhz <= 0.0f || stopMhz < startMhz) return false;
+
+    uint32_t bins = (uint32_t)((stopMhz - startMhz) / stepMhz + 0.001f) + 1;
+    if (bins > kMaxBins) {
+        // Widen the step rather than drop the top of the range: the table still spans start..stop
+        float widened = (stopMhz - startMhz) / (float)(kMaxBins - 1);
+        Logger::instance().warn("FastHop", "%lu bins requested, step widened from %.4f to %.4f MHz for %u bins",
+                                (unsigned long)bins, stepMhz, widened, kMaxBins);
+        stepMhz = widened;
+        bins = kMaxBins;
+    }
+    _binCount = (uint16_t)bins;
+    _startMhz = startMhz;
+    _stepMhz = stepMhz;
+
+    _rxBwKhz = selectRxBandwidth(bandwidthKhz, _tableBwBits);
+    _settleUs = kPllSettleUs + kRssiSettleBaseUs + (uint32_t)(kRssiSettleKhzUs / _rxBwKhz);
+    _sampleUs = (uint32_t)(kRssiSampleKhzUs / _rxBwKhz);
+
+    strobe(RADIOLIB_CC1101_CMD_IDLE);
+    setFilter(_tableBwBits);
+    uint8_t mcsm0 = readReg(RADIOLIB_CC1101_REG_MCSM0);
+    writeReg(RADIOLIB_CC1101_REG_MCSM0, (uint8_t)((mcsm0 & ~0x30) | RADIOLIB_CC1101_FS_AUTOCAL_NEVER));
+
+    uint32_t startedMs = millis();
+    for (uint16_t i = 0; i < _binCount; ++i) {
+        frequencyWord(binFrequencyMhz(i), _bins[i].freq);
+        if (!calibrateBin(_bins[i])) {
+            Logger::instance().error("FastHop", "Calibration timeout at %.3f MHz", binFrequencyMhz(i));
+            return false;
+        }
+    }
+    _calibratedAtMs = millis();
+    _calibrationMs = _calibratedAtMs - startedMs;
+    _prepared = true;
+
+    Logger::instance().info("FastHop", "Calibrated %u bins in %lu ms | RX BW %.1f kHz | settle %lu us",
+                            _binCount, (unsigned long)_calibrationMs, _rxBwKhz, (unsigned long)_settleUs);
+    return true;
+}
+
+bool FastHopEngine::needsRecalibration(uint32_t nowMs) const {
+    return !_prepared || (nowMs - _calibratedAtMs) >= kRecalIntervalMs;
+}
+
+float FastHopEngine::measure(uint16_t bin) {
+    return hop(_bins[bin], _settleUs);
+}
+
+void FastHopEngine::measureSamples(uint16_t bin, uint8_t samples, RssiStats& out) {
+    if (samples == 0) samples = 1;
+    if (samples > kMaxSamples) samples = kMaxSamples;
+    tune(_bins[bin], _settleUs);
+
+    int32_t sum = 0;
+    int32_t sumSq = 0;
+    int8_t peak = -128;
+    for (uint8_t i = 0; i < samples; ++i) {
+        if (i > 0) delayMicroseconds(_sampleUs);
+        int8_t raw = readRssiRaw();
+        sum += raw;
+        sumSq += (int32_t)raw * raw;
+        if (raw > peak) peak = raw;
+    }
+    // Population variance in raw units (0.25 dB^2 per LSB^2).
+    int32_t spread = samples * sumSq - sum * sum;
+    out.meanDbm = rssiDbm((float)sum / samples);
+    out.maxDbm = rssiDbm(peak);
+    out.varianceDb2 = (float)spread / ((float)samples * samples * 4.0f);
+}
+
+void FastHopEngine::beginDetail(float bandwidthKhz) {
+    _detailRxBwKhz = selectRxBandwidth(bandwidthKhz, _detailBwBits);
+    _detailSettleUs = settleUsFor(bandwidthKhz);
+    _detailCalibrations = 0;
+    strobe(RADIOLIB_CC1101_CMD_IDLE);
+    setFilter(_detailBwBits);
+}
+
+float FastHopEngine::measureAt(float mhz) {
+    if (_binCount == 0) return rssiDbm(-128); // weakest reading
+    Bin b;
+    frequencyWord(mhz, b.freq);
+
+    float pos = (_stepMhz > 0.0f) ? (mhz - _startMhz) / _stepMhz : 0.0f;
+    if (pos < 0.0f) pos = 0.0f;
+    uint16_t lo = (uint16_t)pos;
+    if (lo + 1 >= _binCount) {
+        memcpy(b.fscal, _bins[_binCount - 1].fscal, 3);
+    } else {
+        const Bin& a = _bins[lo];
+        const Bin& c = _bins[lo + 1];
+        if (a.fscal[0] == c.fscal[0] && a.fscal[1] == c.fscal[1]) {
+            float frac = pos - (float)lo;
+            int f1a = a.fscal[2] & 0x3F;
+            int f1c = c.fscal[2] & 0x3F;
+            b.fscal[0] = a.fscal[0];
+            b.fscal[1] = a.fscal[1];
+            b.fscal[2] = (uint8_t)((a.fscal[2] & 0xC0) | (lroundf(f1a + (f1c - f1a) * frac) & 0x3F));
+        } else if (calibrateBin(b)) {
+            // VCO/charge-pump selection changes between the neighbours.
+            _detailCalibrations++;
+        } else {
+            memcpy(b.fscal, (pos - lo < 0.5f ? a : c).fscal, 3);
+        }
+    }
+    return hop(b, _detailSettleUs);
+}
+
+void FastHopEngine::endDetail() {
+    strobe(RADIOLIB_CC1101_CMD_IDLE);
+    setFilter(_tableBwBits);
+}
+
+uint32_t FastHopEngine::settleUsFor(float bandwidthKhz) const {
+    uint8_t bits = 0;
+    return kPllSettleUs + kRssiSettleBaseUs + (uint32_t)(kRssiSettleKhzUs / selectRxBandwidth(bandwidthKhz, bits));
+}
+
+void FastHopEngine::setFilter(uint8_t bwBits) {
+    uint8_t mdmcfg4 = readReg(RADIOLIB_CC1101_REG_MDMCFG4);
+    writeReg(RADIOLIB_CC1101_REG_MDMCFG4, (uint8_t)((mdmcfg4 & 0x0F) | bwBits));
+}
+
+float FastHopEngine::hop(const Bin& b, uint32_t settleUs) {
+    tune(b, settleUs);
+    return rssiDbm(readRssiRaw());
+}
+
+void FastHopEngine::tune(const Bin& b, uint32_t settleUs) {
+    // A command strobe may be followed by another access in the same CSn frame.
+    digitalWrite(_csPin, LOW);
+    _spi->beginTransaction(_spiSettings);
+    _spi->transfer(RADIOLIB_CC1101_CMD_IDLE);
+    _spi->transfer(RADIOLIB_CC1101_REG_FREQ2 | RADIOLIB_CC1101_CMD_WRITE | RADIOLIB_CC1101_CMD_BURST);
+    _spi->transfer(b.freq[0]);
+    _spi->transfer(b.freq[1]);
+    _spi->transfer(b.freq[2]);
+    _spi->endTransaction();
+    digitalWrite(_csPin, HIGH);
+
+    writeBurst(RADIOLIB_CC1101_REG_FSCAL3, b.fscal, 3);
+    strobe(RADIOLIB_CC1101_CMD_RX);
+
+    delayMicroseconds(settleUs);
+}
+
+int8_t FastHopEngine::readRssiRaw() {
+    return (int8_t)readReg(RADIOLIB_CC1101_REG_RSSI);
+}
+
+void FastHopEngine::idle() {
+    if (_begun) strobe(RADIOLIB_CC1101_CMD_IDLE);
+}
+
+void FastHopEngine::frequencyWord(float mhz, uint8_t out[3]) {
+    uint32_t frf = (uint32_t)((double)mhz * 65536.0 / (double)RADIOLIB_CC1101_CRYSTAL_FREQ + 0.5);
+    out[0] = (uint8_t)((frf >> 16) & 0xFF);
+    out[1] = (uint8_t)((frf >> 8) & 0xFF);
+    out[2] = (uint8_t)(frf & 0xFF);
+}
+
+float FastHopEngine::selectRxBandwidth(float bandwidthKhz, uint8_t& mdmcfg4Bits) const {
+    // BW_channel = f_xosc / (8 * (4 + CHANBW_M) * 2^CHANBW_E); pick the closest setting.
+    float best = 0.0f;
+    float bestErr = 1e9f;
+    for (uint8_t e = 0; e < 4; ++e) {
+        for (uint8_t m = 0; m < 4; ++m) {
+            float khz = (RADIOLIB_CC1101_CRYSTAL_FREQ * 1000.0f) / (8.0f * (4 + m) * (float)(1 << e));
+            float err = fabsf(khz - bandwidthKhz);
+            if (err < bestErr) {
+                bestErr = err;
+                best = khz;
+                mdmcfg4Bits = (uint8_t)((e << 6) | (m << 4));
+            }
+        }
+    }
+    return best;
+}
+
+bool FastHopEngine::calibrateBin(Bin& bin) {
+    strobe(RADIOLIB_CC1101_CMD_IDLE);
+    writeBurst(RADIOLIB_CC1101_REG_FREQ2, bin.freq, 3);
+    strobe(RADIOLIB_CC1101_CMD_CAL);
+
+    uint32_t waited = 0;
+    while (readReg(RADIOLIB_CC1101_REG_MARCSTATE) != RADIOLIB_CC1101_MARC_STATE_IDLE) {
+        if (waited >= kCalTimeoutUs) return false;
+        delayMicroseconds(50);
+        waited += 50;
+    }
+    readBurst(RADIOLIB_CC1101_REG_FSCAL3, bin.fscal, 3);
+    return true;
+}
+
+void FastHopEngine::strobe(uint8_t cmd) {
+    digitalWrite(_csPin, LOW);
+    _spi->beginTransaction(_spiSettings);
+    _spi->transfer(cmd);
+    _spi->endTransaction();
+    digitalWrite(_csPin, HIGH);
+}
+
+uint8_t FastHopEngine::readReg(uint8_t reg) {
+    uint8_t header = reg | RADIOLIB_CC1101_CMD_READ;
+    if (reg >= RADIOLIB_CC1101_REG_PARTNUM) header |= RADIOLIB_CC1101_CMD_BURST;
+    digitalWrite(_csPin, LOW);
+    _spi->beginTransaction(_spiSettings);
+    _spi->transfer(header);
+    uint8_t value = _spi->transfer(0x00);
+    _spi->endTransaction();
+    digitalWrite(_csPin, HIGH);
+    return value;
+}
+
+void FastHopEngine::writeReg(uint8_t reg, uint8_t value) {
+    digitalWrite(_csPin, LOW);
+    _spi->beginTransaction(_spiSettings);
+    _spi->transfer(reg | RADIOLIB_CC1101_CMD_WRITE);
+    _spi->transfer(value);
+    _spi->endTransaction();
+    digitalWrite(_csPin, HIGH);
+}
+
+void FastHopEngine::writeBurst(uint8_t reg, const uint8_t* data, uint8_t len) {
+    digitalWrite(_csPin, LOW);
+    _spi->beginTransaction(_spiSettings);
+    _spi->transfer(reg | RADIOLIB_CC1101_CMD_WRITE | RADIOLIB_CC1101_CMD_BURST);
+    for (uint8_t i = 0; i < len; ++i) _spi->transfer(data[i]);
+    _spi->endTransaction();
+    digitalWrite(_csPin, HIGH);
+}
+
+void FastHopEngine::readBurst(uint8_t reg, uint8_t* data, uint8_t len) {
+    digitalWrite(_csPin, LOW);
+    _spi->beginTransaction(_spiSettings);
+    _spi->transfer(reg | RADIOLIB_CC1101_CMD_READ | RADIOLIB_CC1101_CMD_BURST);
+    for (uint8_t i = 0; i < len; ++i) data[i] = _spi->transfer(0x00);
+    _spi->endTransaction();
+    digitalWrite(_csPin, HIGH);
+}
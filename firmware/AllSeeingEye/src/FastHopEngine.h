@@ -0,0 +1,134 @@
+#ifndef FASTHOPENGINE_H
+#define FASTHOPENGINE_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// Register-level CC1101 sweep engine (RX only).
+//
+// RadioLib's setFrequency() strobes IDLE, rewrites FREQ2/1/0 with a
+// read-modify-verify cycle each, re-applies the PA table and leaves the
+// synthesiser to recalibrate on the next RX entry. For a sweep that is ~25
+// SPI bytes plus a ~800 us calibration per bin.
+//
+// This engine instead precomputes the FREQ word for every bin, calibrates
+// each bin once with SCAL and caches FSCAL3/2/1 (TI DN508 "fast frequency
+// hopping"), then hops with:
+//   [SIDLE, FREQ2..0 burst] [FSCAL3..1 burst] [SRX]  -> 10 SPI bytes
+// waits for PLL settle plus the RSSI response time of the selected channel
+// filter, and reads the RSSI status register directly.
+//
+// Detail hops (adaptive sweeps) tune to arbitrary frequencies inside the
+// calibrated range without a table entry: FSCAL1 is interpolated between the
+// two neighbouring bins when they share FSCAL3/FSCAL2 (same VCO/charge pump
+// selection), otherwise that one frequency is calibrated with SCAL.
+//
+// Multi-sample bins stay in RX after the first read and take further reads
+// one RSSI averaging window apart (~1/RX BW, busy-wait, no RTOS delay). The
+// RSSI register only holds a new, independent estimate after each window, so
+// reading faster would return the same value again. The CC1101 has no GDO
+// output that signals a fresh RSSI estimate, so the pacing is by time.
+//
+// Autocalibration is disabled while prepared and restored by end().
+class FastHopEngine {
+public:
+    static constexpr uint16_t kMaxBins = 255;
+    static constexpr uint32_t kSpiClockHz = 5000000;
+    static constexpr uint32_t kPllSettleUs = 90;          // IDLE->RX with cached FSCAL (datasheet ~88 us)
+    static constexpr uint32_t kRssiSettleBaseUs = 32;
+    static constexpr uint32_t kRssiSettleKhzUs = 20000;   // filter response scales with 1/RX BW
+    static constexpr uint32_t kRssiSampleKhzUs = 20000;   // one fresh RSSI estimate per averaging window
+    static constexpr uint8_t kMaxSamples = 32;
+    static constexpr uint32_t kCalTimeoutUs = 2000;
+    static constexpr uint32_t kRecalIntervalMs = 10UL * 60UL * 1000UL; // temperature drift
+
+    struct RssiStats {
+        float meanDbm;
+        float maxDbm;
+        float varianceDb2;
+    };
+
+    FastHopEngine();
+
+    bool begin(SPIClass* spi, uint8_t csPin);
+    void end();
+
+    // Builds the bin table and calibrates every bin. Call from the radio-owning core.
+    // A range that needs more than kMaxBins bins at stepMhz is covered in
+    // kMaxBins bins with a wider step: read it back from stepMhz().
+    bool prepare(float startMhz, float stopMhz, float stepMhz, float bandwidthKhz);
+    bool isPrepared() const { return _prepared; }
+    bool needsRecalibration(uint32_t nowMs) const;
+    void invalidate() { _prepared = false; }
+
+    // Tunes to bin and returns RSSI (dBm) once it is valid for that bin.
+    float measure(uint16_t bin);
+    // Tunes to bin and takes samples (1..kMaxSamples) paced RSSI reads.
+    void measureSamples(uint16_t bin, uint8_t samples, RssiStats& out);
+    // Parks the radio in IDLE between sweeps.
+    void idle();
+
+    // Detail pass: switch the channel filter, hop to any frequency in the table
+    // range, then switch back to the table filter.
+    void beginDetail(float bandwidthKhz);
+    float measureAt(float mhz);
+    void endDetail();
+    float detailRxBandwidthKhz() const { return _detailRxBwKhz; }
+    uint32_t detailSettleUs() const { return _detailSettleUs; }
+    uint32_t detailCalibrations() const { return _detailCalibrations; }
+
+    uint16_t binCount() const { return _binCount; }
+    float binFrequencyMhz(uint16_t bin) const { return _startMhz + _stepMhz * bin; }
+    float stepMhz() const { return _stepMhz; }
+    float rxBandwidthKhz() const { return _rxBwKhz; }
+    uint32_t settleUs() const { return _settleUs; }
+    uint32_t settleUsFor(float bandwidthKhz) const;
+    uint32_t sampleIntervalUs() const { return _sampleUs; }
+    uint32_t calibrationMs() const { return _calibrationMs; }
+
+private:
+    struct Bin {
+        uint8_t freq[3];  // FREQ2, FREQ1, FREQ0
+        uint8_t fscal[3]; // FSCAL3, FSCAL2, FSCAL1
+    };
+
+    SPIClass* _spi;
+    uint8_t _csPin;
+    SPISettings _spiSettings;
+    bool _begun;
+    bool _prepared;
+
+    Bin _bins[kMaxBins];
+    uint16_t _binCount;
+    float _startMhz;
+    float _stepMhz;
+    float _rxBwKhz;
+    uint32_t _settleUs;
+    uint32_t _sampleUs;
+    uint32_t _calibratedAtMs;
+    uint32_t _calibrationMs;
+    uint8_t _tableBwBits;
+    uint8_t _detailBwBits;
+    float _detailRxBwKhz;
+    uint32_t _detailSettleUs;
+    uint32_t _detailCalibrations;
+
+    uint8_t _savedMcsm0;
+    uint8_t _savedMdmcfg4;
+
+    static void frequencyWord(float mhz, uint8_t out[3]);
+    float selectRxBandwidth(float bandwidthKhz, uint8_t& mdmcfg4Bits) const;
+    bool calibrateBin(Bin& bin);
+    float hop(const Bin& bin, uint32_t settleUs);
+    void tune(const Bin& bin, uint32_t settleUs);
+    int8_t readRssiRaw();
+    void setFilter(uint8_t bwBits);
+
+    void strobe(uint8_t cmd);
+    uint8_t readReg(uint8_t reg);
+    void writeReg(uint8_t reg, uint8_t value);
+    void writeBurst(uint8_t reg, const uint8_t* data, uint8_t len);
+    void readBurst(uint8_t reg, uint8_t* data, uint8_t len);
+};
+
+#endif
@@ -28,6 +28,7 @@ void GeolocationService::loop() {
 void GeolocationService::setState(GeolocationState state) {
     if (_state != state) {
         _state = state;
+        _version++;
         Logger::instance().info("Geolocation", "State -> %s", stateToString(state));
     }
 }
@@ -35,16 +36,19 @@ void GeolocationService::setState(GeolocationState state) {
 void GeolocationService::setFixType(GeolocationFixType fixType) {
     _fixType = fixType;
     _lastUpdatedMs = millis();
+    _version++;
 }
 
 void GeolocationService::setConfidence(float confidence) {
     _confidence = confidence;
     _lastUpdatedMs = millis();
+    _version++;
 }
 
 void GeolocationService::setMotion(const GeolocationMotion& motion) {
     _motion = motion;
     _lastUpdatedMs = millis();
+    _version++;
 }
 
 void GeolocationService::setAbsolutePosition(const GeolocationPosition& position) {
@@ -53,6 +57,7 @@ void GeolocationService::setAbsolutePosition(const GeolocationPosition& position
     _relative.valid = false;
     _fixType = GEO_FIX_ABSOLUTE;
     _lastUpdatedMs = millis();
+    _version++;
 }
 
 void GeolocationService::setRelativePosition(const GeolocationRelative& relative) {
@@ -61,6 +66,7 @@ void GeolocationService::setRelativePosition(const GeolocationRelative& relative
     _position.valid = false;
     _fixType = GEO_FIX_RELATIVE;
     _lastUpdatedMs = millis();
+    _version++;
 }
 
 void GeolocationService::addSourceSummary(const GeolocationSourceSummary& summary) {
@@ -74,10 +80,12 @@ void GeolocationService::addSourceSummary(const GeolocationSourceSummary& summar
         _sources[kMaxSources - 1] = summary;
     }
     _lastUpdatedMs = millis();
+    _version++;
 }
 
 void GeolocationService::clearSources() {
     _sourceCount = 0;
+    _version++;
 }
 
 void GeolocationService::populateStatus(JsonObject& geoObj) {
@@ -130,6 +138,7 @@ void GeolocationService::updateStaleness() {
     uint32_t age = millis() - _lastUpdatedMs;
     if (age > kStaleThresholdMs && _state != GEO_STATE_STALE) {
         _state = GEO_STATE_STALE;
+        _version++;
         Logger::instance().warn("Geolocation", "State -> stale (age %lu ms)", age);
     }
 }
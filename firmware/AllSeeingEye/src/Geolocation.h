@@ -66,6 +66,7 @@ public:
     void clearSources();
 
     void populateStatus(JsonObject& geoObj);
+    uint32_t version() const { return _version; } // Bumped when populateStatus() would change
 
 private:
     GeolocationService() = default;
@@ -81,6 +82,7 @@ private:
     GeolocationRelative _relative;
     float _confidence = 0.0f;
     uint32_t _lastUpdatedMs = 0;
+    volatile uint32_t _version = 0;
 
     static const uint8_t kMaxSources = 8;
     GeolocationSourceSummary _sources[kMaxSources];
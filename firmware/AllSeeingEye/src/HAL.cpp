@@ -89,6 +89,14 @@ CC1101* HAL::getRadio() {
     return _radio;
 }
 
+SPIClass* HAL::getRadioSPI() {
+    return _radioSPI;
+}
+
+uint8_t HAL::getRadioCsPin() {
+    return R_CS;
+}
+
 bool HAL::checkRadio() {
     // Return the cached POST result
     return _hasRadio; 
@@ -29,6 +29,8 @@ public:
     
     // Radio Access
     CC1101* getRadio();
+    SPIClass* getRadioSPI();   // Register-level access (FastHopEngine)
+    uint8_t getRadioCsPin();
 
     // CC1101 Safety Limits (Datasheet)
     static constexpr float kCc1101Band1MinMhz = 300.0f;
@@ -0,0 +1,188 @@
+#include "HostTable.h"
+
+uint32_t HostIndex::key(const String& ip) {
+    return key(ip.c_str());
+}
+
+uint32_t HostIndex::key(const char* ip) {
+    if (ip == nullptr) return 0;
+    uint32_t out = 0;
+    for (int octet = 0; octet < 4; ++octet) {
+        if (*ip < '0' || *ip > '9') return 0;
+        uint32_t value = 0;
+        int digits = 0;
+        while (*ip >= '0' && *ip <= '9') {
+            value = value * 10 + (uint32_t)(*ip++ - '0');
+            if (++digits > 3 || value > 255) return 0;
+        }
+        out |= value << (8 * octet);
+        if (octet < 3 && *ip++ != '.') return 0;
+    }
+    return *ip == '\0' ? out : 0;
+}
+
+size_t HostIndex::home(uint32_t ip) const {
+    // Fibonacci hashing: addresses of one subnet differ in the high (last octet) bits
+    return (size_t)((ip * 2654435769u) >> (32 - _bits));
+}
+
+bool HostIndex::insert(uint32_t ip, uint16_t value) {
+    if (ip == 0) return false;
+    if (_slots.empty() || (_count + 1) * 2 > _slots.size()) grow();
+
+    size_t mask = _slots.size() - 1;
+    size_t i = home(ip);
+    while (_slots[i].ip != 0) {
+        if (_slots[i].ip == ip) {
+            _slots[i].value = value;
+            return true;
+        }
+        i = (i + 1) & mask;
+    }
+    _slots[i].ip = ip;
+    _slots[i].value = value;
+    _count++;
+    return true;
+}
+
+uint16_t HostIndex::find(uint32_t ip) const {
+    if (ip == 0 || _count == 0) return kNone;
+    size_t mask = _slots.size() - 1;
+    for (size_t i = home(ip); _slots[i].ip != 0; i = (i + 1) & mask) {
+        if (_slots[i].ip == ip) return _slots[i].value;
+    }
+    return kNone;
+}
+
+bool HostIndex::erase(uint32_t ip) {
+    if (ip == 0 || _count == 0) return false;
+    size_t mask = _slots.size() - 1;
+    size_t i = home(ip);
+    while (_slots[i].ip != ip) {
+        if (_slots[i].ip == 0) return false;
+        i = (i + 1) & mask;
+    }
+
+    // Pull later entries of the probe run back into the hole unless that
+    // would move one in front of its home slot
+    for (size_t j = (i + 1) & mask; _slots[j].ip != 0; j = (j + 1) & mask) {
+        size_t k = home(_slots[j].ip);
+        bool movable = (i <= j) ? (k <= i || k > j) : (k <= i && k > j);
+        if (movable) {
+            _slots[i] = _slots[j];
+            i = j;
+        }
+    }
+    _slots[i].ip = 0;
+    _count--;
+    return true;
+}
+
+void HostIndex::clear() {
+    _slots.clear();
+    _bits = 0;
+    _count = 0;
+}
+
+void HostIndex::grow() {
+    std::vector<Slot> old;
+    old.swap(_slots);
+    _bits = _bits < 4 ? 4 : _bits + 1;
+    _slots.assign((size_t)1 << _bits, Slot{0, 0});
+    _count = 0;
+    for (const auto& slot : old) {
+        if (slot.ip != 0) insert(slot.ip, slot.value);
+    }
+}
+
+IgnoreList::IgnoreList() : _free(HostIndex::kNone), _cursor(0), _cursorAt(0), _tickMs(1000), _timeoutMs(0) {
+    for (auto& slot : _wheel) slot = HostIndex::kNone;
+}
+
+void IgnoreList::setTimeout(uint32_t timeoutMs, unsigned long now) {
+    _timeoutMs = timeoutMs;
+    _cursor = 0;
+    _cursorAt = now;
+    if (timeoutMs == 0) {
+        _index.clear();
+        _entries.clear();
+        _free = HostIndex::kNone;
+        for (auto& slot : _wheel) slot = HostIndex::kNone;
+        return;
+    }
+    // One revolution spans the whole period, so an entry is carried round at most once
+    _tickMs = max((uint32_t)1000, timeoutMs / (kWheelSlots - 1) + 1);
+    rebuild();
+}
+
+void IgnoreList::add(uint32_t ip, unsigned long now) {
+    if (_timeoutMs == 0 || ip == 0) return;
+
+    uint16_t e = _index.find(ip);
+    if (e != HostIndex::kNone) {
+        // Its slot now comes due early; expire() carries it on to the new deadline
+        _entries[e].ignoredAt = now;
+        return;
+    }
+
+    if (_free != HostIndex::kNone) {
+        e = _free;
+        _free = _entries[e].next;
+    } else {
+        if (_entries.size() >= HostIndex::kNone) return;
+        e = (uint16_t)_entries.size();
+        _entries.push_back(Entry());
+    }
+    _entries[e].ip = ip;
+    _entries[e].ignoredAt = now;
+    _index.insert(ip, e);
+    schedule(e);
+}
+
+bool IgnoreList::contains(uint32_t ip, unsigned long now) const {
+    uint16_t e = _index.find(ip);
+    return e != HostIndex::kNone && now - _entries[e].ignoredAt < _timeoutMs;
+}
+
+void IgnoreList::expire(unsigned long now) {
+    if (_timeoutMs == 0) return;
+
+    while (now - _cursorAt >= _tickMs) {
+        uint16_t e = _wheel[_cursor];
+        _wheel[_cursor] = HostIndex::kNone;
+        _cursor = (uint8_t)((_cursor + 1) % kWheelSlots);
+        _cursorAt += _tickMs;
+
+        while (e != HostIndex::kNone) {
+            uint16_t next = _entries[e].next;
+            if (now - _entries[e].ignoredAt >= _timeoutMs) {
+                _index.erase(_entries[e].ip);
+                _entries[e].ip = 0;
+                _entries[e].next = _free;
+                _free = e;
+            } else {
+                schedule(e);
+            }
+            e = next;
+        }
+    }
+}
+
+void IgnoreList::schedule(uint16_t e) {
+    // Slot n from the cursor holds the tick window [_cursorAt + n * tick, + tick)
+    unsigned long due = _entries[e].ignoredAt + _timeoutMs;
+    long ahead = (long)(due - _cursorAt);
+    uint32_t ticks = ahead <= 0 ? 0 : (uint32_t)ahead / _tickMs;
+    if (ticks > kWheelSlots - 1) ticks = kWheelSlots - 1;
+
+    uint8_t slot = (uint8_t)((_cursor + ticks) % kWheelSlots);
+    _entries[e].next = _wheel[slot];
+    _wheel[slot] = e;
+}
+
+void IgnoreList::rebuild() {
+    for (auto& slot : _wheel) slot = HostIndex::kNone;
+    for (uint16_t e = 0; e < _entries.size(); ++e) {
+        if (_entries[e].ip != 0) schedule(e);
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef HOST_TABLE_H
+#define HOST_TABLE_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <vector>
+
+// IPv4-keyed lookup tables for PeerManager. Addresses are keyed by the
+// IPAddress uint32 value; 0 (0.0.0.0) is never a host and marks an empty slot.
+
+// Open-addressing hash map from an address to a small value (an index).
+// Linear probing with backward-shift deletion, so there are no tombstones and
+// lookups stay short after erases. The slot array doubles at 1/2 load.
+class HostIndex {
+public:
+    static constexpr uint16_t kNone = 0xFFFF;
+
+    static uint32_t key(const IPAddress& ip) { return (uint32_t)ip; }
+    static uint32_t key(const String& ip);   // 0 if ip is not a dotted quad
+    static uint32_t key(const char* ip);
+
+    // Inserts or replaces; false for key 0.
+    bool insert(uint32_t ip, uint16_t value);
+    uint16_t find(uint32_t ip) const;
+    bool contains(uint32_t ip) const { return find(ip) != kNone; }
+    bool erase(uint32_t ip);
+    void clear();
+    size_t size() const { return _count; }
+
+private:
+    struct Slot {
+        uint32_t ip;
+        uint16_t value;
+    };
+
+    size_t home(uint32_t ip) const;
+    void grow();
+
+    std::vector<Slot> _slots;   // power-of-two size, empty until the first insert
+    uint8_t _bits = 0;
+    size_t _count = 0;
+};
+
+// Hosts that failed peer verification, each ignored for a fixed time.
+// Membership is a HostIndex lookup. Expiry runs on a hashed timing wheel:
+// each entry sits in the slot of the tick it expires in (or the farthest
+// slot, and is carried round again), so expire() only visits the slots
+// that came due instead of the whole list.
+class IgnoreList {
+public:
+    static constexpr uint8_t kWheelSlots = 64;
+
+    IgnoreList();
+
+    // Ignore period; re-times existing entries from when they were ignored.
+    // 0 turns ignoring off and drops every entry.
+    void setTimeout(uint32_t timeoutMs, unsigned long now);
+    uint32_t timeout() const { return _timeoutMs; }
+
+    void add(uint32_t ip, unsigned long now);
+    bool contains(uint32_t ip, unsigned long now) const;
+    void expire(unsigned long now);
+    size_t size() const { return _index.size(); }
+
+private:
+    struct Entry {
+        uint32_t ip;
+        unsigned long ignoredAt;
+        uint16_t next;   // next entry in the same wheel slot, or free list
+    };
+
+    void schedule(uint16_t e);
+    void rebuild();
+
+    HostIndex _index;             // ip -> entry
+    std::vector<Entry> _entries;
+    uint16_t _free;
+    uint16_t _wheel[kWheelSlots];
+    uint8_t _cursor;              // slot of the tick starting at _cursorAt
+    unsigned long _cursorAt;
+    uint32_t _tickMs;
+    uint32_t _timeoutMs;
+};
+
+#endif
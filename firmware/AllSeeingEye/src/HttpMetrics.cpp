@@ -0,0 +1,178 @@
+#include "HttpMetrics.h"
+
+const uint32_t HttpMetrics::kBucketUs[HttpMetrics::kBuckets] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000
+};
+
+namespace {
+// The bucket bounds in seconds, as the le labels print them
+const char* const kBucketLe[HttpMetrics::kBuckets] = {
+    "0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.05", "0.1", "0.25", "0.5", "1"
+};
+
+void writeFamily(String& out, const char* name, const char* type, const char* help) {
+    out.concat("# HELP ");
+    out.concat(name);
+    out.concat(' ');
+    out.concat(help);
+    out.concat("\n# TYPE ");
+    out.concat(name);
+    out.concat(' ');
+    out.concat(type);
+    out.concat('\n');
+}
+}
+
+HttpMetrics& HttpMetrics::instance() {
+    static HttpMetrics _instance;
+    return _instance;
+}
+
+HttpMetrics::HttpMetrics() : _routeCount(0), _current(kNoRoute), _currentStartUs(0), _deferred(false) {
+    for (auto& r : _routes) {
+        r.path[0] = '\0';
+        r.method[0] = '\0';
+        for (auto& b : r.buckets) b.store(0, std::memory_order_relaxed);
+        r.sumUs.store(0, std::memory_order_relaxed);
+        r.bytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint8_t HttpMetrics::addRoute(const char* path, const char* method) {
+    if (_routeCount >= kMaxRoutes) return kNoRoute;
+    Route& r = _routes[_routeCount];
+    strncpy(r.path, path, sizeof(r.path) - 1);
+    r.path[sizeof(r.path) - 1] = '\0';
+    strncpy(r.method, method, sizeof(r.method) - 1);
+    r.method[sizeof(r.method) - 1] = '\0';
+    return _routeCount++;
+}
+
+HttpMetrics::Scope::Scope(uint8_t route) : _route(route) {
+    HttpMetrics& m = HttpMetrics::instance();
+    _outer = m._current;
+    _outerStartUs = m._currentStartUs;
+    _outerDeferred = m._deferred;
+    _startUs = micros();
+    m._current = route;
+    m._currentStartUs = _startUs;
+    m._deferred = false;
+}
+
+HttpMetrics::Scope::~Scope() {
+    HttpMetrics& m = HttpMetrics::instance();
+    if (!m._deferred) m.record(_route, micros() - _startUs);
+    m._current = _outer;
+    m._currentStartUs = _outerStartUs;
+    m._deferred = _outerDeferred;
+}
+
+void HttpMetrics::Deferred::finish() {
+    if (!_pending) return;
+    _pending = false;
+    HttpMetrics::instance().record(_route, micros() - _startUs);
+}
+
+std::shared_ptr<HttpMetrics::Deferred> HttpMetrics::defer() {
+    _deferred = true;
+    return std::make_shared<Deferred>(_current, _currentStartUs);
+}
+
+void HttpMetrics::record(uint8_t route, uint32_t handlerUs) {
+    if (route >= _routeCount) return;
+    Route& r = _routes[route];
+    uint8_t b = 0;
+    while (b < kBuckets && handlerUs > kBucketUs[b]) b++;
+    r.buckets[b].fetch_add(1, std::memory_order_relaxed);
+    r.sumUs.fetch_add(handlerUs, std::memory_order_relaxed);
+}
+
+void HttpMetrics::addBytes(uint8_t route, size_t bytes) {
+    if (route >= _routeCount) return;
+    _routes[route].bytes.fetch_add((uint32_t)bytes, std::memory_order_relaxed);
+}
+
+uint32_t HttpMetrics::requests(uint8_t route) const {
+    if (route >= _routeCount) return 0;
+    uint32_t total = 0;
+    for (const auto& b : _routes[route].buckets) total += b.load(std::memory_order_relaxed);
+    return total;
+}
+
+uint32_t HttpMetrics::bytes(uint8_t route) const {
+    return route < _routeCount ? _routes[route].bytes.load(std::memory_order_relaxed) : 0;
+}
+
+uint32_t HttpMetrics::bucket(uint8_t route, uint8_t index) const {
+    if (route >= _routeCount || index > kBuckets) return 0;
+    return _routes[route].buckets[index].load(std::memory_order_relaxed);
+}
+
+void HttpMetrics::writeHistogram(const Route& r, String& out) const {
+    char line[160];
+    // Cumulative, and +Inf is _count: read once each so the two agree
+    uint32_t cumulative = 0;
+    for (uint8_t b = 0; b <= kBuckets; ++b) {
+        cumulative += r.buckets[b].load(std::memory_order_relaxed);
+        snprintf(line, sizeof(line), "ase_http_handler_seconds_bucket{path=\"%s\",method=\"%s\",le=\"%s\"} %lu\n",
+                 r.path, r.method, b < kBuckets ? kBucketLe[b] : "+Inf", (unsigned long)cumulative);
+        out.concat(line);
+    }
+    uint32_t sumUs = r.sumUs.load(std::memory_order_relaxed);
+    snprintf(line, sizeof(line), "ase_http_handler_seconds_sum{path=\"%s\",method=\"%s\"} %lu.%06lu\n",
+             r.path, r.method, (unsigned long)(sumUs / 1000000), (unsigned long)(sumUs % 1000000));
+    out.concat(line);
+    snprintf(line, sizeof(line), "ase_http_handler_seconds_count{path=\"%s\",method=\"%s\"} %lu\n",
+             r.path, r.method, (unsigned long)cumulative);
+    out.concat(line);
+}
+
+bool HttpMetrics::writeFragment(uint32_t index, String& out) const {
+    // Each family's samples must be contiguous: all routes of one, then the next
+    if (index < _routeCount) {
+        if (index == 0) {
+            writeFamily(out, "ase_http_handler_seconds", "histogram",
+                        "Time in the request handler, per route, until the last byte of a chunked response; "
+                        "_count is the request count.");
+        }
+        writeHistogram(_routes[index], out);
+        return true;
+    }
+    index -= _routeCount;
+    if (index < _routeCount) {
+        if (index == 0) {
+            writeFamily(out, "ase_http_response_bytes_total", "counter", "Response body bytes sent, per route.");
+        }
+        const Route& r = _routes[index];
+        char line[128];
+        snprintf(line, sizeof(line), "ase_http_response_bytes_total{path=\"%s\",method=\"%s\"} %lu\n",
+                 r.path, r.method, (unsigned long)r.bytes.load(std::memory_order_relaxed));
+        out.concat(line);
+        return true;
+    }
+    index -= _routeCount;
+    if (index == 0) {
+        writeMetric(out, "ase_heap_free_bytes", "gauge", "Free internal heap.", (uint32_t)ESP.getFreeHeap());
+        writeMetric(out, "ase_heap_min_free_bytes", "gauge", "Lowest free internal heap since boot.",
+                    (uint32_t)ESP.getMinFreeHeap());
+        writeMetric(out, "ase_heap_max_alloc_bytes", "gauge", "Largest allocatable heap block.",
+                    (uint32_t)ESP.getMaxAllocHeap());
+        writeMetric(out, "ase_uptime_seconds", "gauge", "Time since boot.", (uint32_t)(millis() / 1000));
+        return true;
+    }
+    return false;
+}
+
+void HttpMetrics::writeMetric(String& out, const char* name, const char* type, const char* help, uint32_t value) {
+    writeFamily(out, name, type, help);
+    char line[96];
+    snprintf(line, sizeof(line), "%s %lu\n", name, (unsigned long)value);
+    out.concat(line);
+}
+
+void HttpMetrics::writeMetric(String& out, const char* name, const char* type, const char* help, float value) {
+    writeFamily(out, name, type, help);
+    char line[96];
+    snprintf(line, sizeof(line), "%s %.4f\n", name, value);
+    out.concat(line);
+}
@@ -0,0 +1,106 @@
+#ifndef HTTP_METRICS_H
+#define HTTP_METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <memory>
+
+// Per-route request metrics, served as Prometheus text at /api/metrics.
+//
+// Every route WebServerManager::setupRoutes registers gets a slot: a
+// histogram of handler time over fixed 1-2.5-5 buckets from 100 us to 1 s
+// (its _count is the request count) and the response body bytes sent.
+// Recording is a bucket scan and three relaxed atomic adds: no lock, no
+// allocation. A scrape reads the counters while they move, so a route's
+// sum and bytes can be a request ahead of or behind its count.
+//
+// Handler time runs until the handler returns, or for a chunked response
+// (JsonStream.h), whose body is produced afterwards from the TCP task, until
+// its last byte is sent: the handler hands its timing over with defer().
+
+class HttpMetrics {
+public:
+    static constexpr uint8_t kMaxRoutes = 48;
+    static constexpr uint8_t kNoRoute = 0xFF;
+    static constexpr uint8_t kBuckets = 13;   // finite upper bounds; +Inf follows
+    static const uint32_t kBucketUs[kBuckets];
+
+    static HttpMetrics& instance();
+
+    // Setup, before the server starts. kNoRoute once every slot is taken.
+    uint8_t addRoute(const char* path, const char* method);
+    uint8_t routeCount() const { return _routeCount; }
+
+    // Times a handler and counts its request. The route stays current()
+    // while the handler runs, so a response it sends is counted against it.
+    class Scope {
+    public:
+        explicit Scope(uint8_t route);
+        ~Scope();
+    private:
+        uint8_t _route;
+        uint8_t _outer;
+        uint32_t _outerStartUs;
+        bool _outerDeferred;
+        uint32_t _startUs;
+    };
+
+    // The running handler's request, timed from the handler's start until
+    // finish(); a response torn down before its end is recorded then.
+    class Deferred {
+    public:
+        Deferred(uint8_t route, uint32_t startUs) : _route(route), _startUs(startUs), _pending(true) {}
+        ~Deferred() { finish(); }
+        Deferred(const Deferred&) = delete;
+        Deferred& operator=(const Deferred&) = delete;
+        uint8_t route() const { return _route; }
+        void finish();   // records once; later calls do nothing
+    private:
+        uint8_t _route;
+        uint32_t _startUs;
+        bool _pending;
+    };
+
+    // Takes the running handler's request off its Scope: it is recorded by
+    // the returned Deferred instead
+    std::shared_ptr<Deferred> defer();
+
+    void record(uint8_t route, uint32_t handlerUs);
+    void addBytes(uint8_t route, size_t bytes);
+    // Against the handler running now; handlers all run on the async TCP task
+    void addBytes(size_t bytes) { addBytes(_current, bytes); }
+    uint8_t current() const { return _current; }
+
+    // Per-route totals, as a scrape reads them
+    uint32_t requests(uint8_t route) const;
+    uint32_t bytes(uint8_t route) const;
+    uint32_t bucket(uint8_t route, uint8_t index) const;   // not cumulative; kBuckets is +Inf
+
+    // The exposition one piece at a time: the handler-time histogram of each
+    // route, the bytes of each route, then heap and uptime. False past the end.
+    bool writeFragment(uint32_t index, String& out) const;
+    uint32_t fragmentCount() const { return 2u * _routeCount + 1; }
+    static void writeMetric(String& out, const char* name, const char* type, const char* help, uint32_t value);
+    static void writeMetric(String& out, const char* name, const char* type, const char* help, float value);
+
+private:
+    HttpMetrics();
+
+    struct Route {
+        char path[40];
+        char method[8];
+        std::atomic<uint32_t> buckets[kBuckets + 1];
+        std::atomic<uint32_t> sumUs;   // wraps after ~71 min of handler time: a counter reset to Prometheus
+        std::atomic<uint32_t> bytes;
+    };
+
+    void writeHistogram(const Route& r, String& out) const;
+
+    Route _routes[kMaxRoutes];
+    uint8_t _routeCount;
+    uint8_t _current;
+    uint32_t _currentStartUs;
+    bool _deferred;
+};
+
+#endif
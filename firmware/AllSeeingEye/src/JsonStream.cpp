@@ -0,0 +1,106 @@
+#include "JsonStream.h"
+
+namespace {
+// Updated when a stream is destroyed: streams are served from the one async TCP task
+JsonStreamStats gStats;
+}
+
+JsonStream::JsonStream()
+    : _pos(0), _lead(0), _index(0), _ended(false), _bytes(0), _heapAtStart(ESP.getFreeHeap()), _heapLow(_heapAtStart) {}
+
+std::shared_ptr<JsonStream> JsonStream::fragments(FragmentFn next) {
+    std::shared_ptr<JsonStream> stream(new JsonStream());
+    stream->_fragments = next;
+    return stream;
+}
+
+std::shared_ptr<JsonStream> JsonStream::array(ItemFn next) {
+    std::shared_ptr<JsonStream> stream(new JsonStream());
+    stream->_items = next;
+    return stream;
+}
+
+JsonStream::~JsonStream() {
+    gStats.responses++;
+    gStats.bytes += _bytes;
+    if (_bytes > gStats.maxBytes) gStats.maxBytes = _bytes;
+    if (_fragment.length() > gStats.maxFragment) gStats.maxFragment = _fragment.length();
+    uint32_t drop = _heapAtStart > _heapLow ? _heapAtStart - _heapLow : 0;
+    if (drop > gStats.maxHeapDrop) gStats.maxHeapDrop = drop;
+}
+
+uint8_t JsonStream::advance() {
+    if (_fragment.length() > gStats.maxFragment) gStats.maxFragment = _fragment.length();
+    _fragment = "";
+    _pos = 0;
+    _lead = 0;
+    if (_ended) return FRAGMENT_END;
+
+    if (_items) {
+        JsonDocument doc;
+        if (_items(_index, doc)) {
+            serializeJson(doc, _fragment);
+            _lead = _index == 0 ? '[' : ',';
+        } else {
+            _fragment = _index == 0 ? "[]" : "]";
+            _ended = true;
+        }
+        _index++;
+        return FRAGMENT_READY;
+    }
+
+    uint8_t result = _fragments(_index, _fragment);
+    if (result == FRAGMENT_READY) _index++;
+    else if (result == FRAGMENT_END) _ended = true;
+    return result;
+}
+
+size_t JsonStream::read(uint8_t* out, size_t maxLen) {
+    size_t n = 0;
+    while (n < maxLen) {
+        if (_lead) {
+            out[n++] = (uint8_t)_lead;
+            _lead = 0;
+            continue;
+        }
+        if (_pos < _fragment.length()) {
+            size_t chunk = min(maxLen - n, (size_t)(_fragment.length() - _pos));
+            memcpy(out + n, _fragment.c_str() + _pos, chunk);
+            n += chunk;
+            _pos += chunk;
+            continue;
+        }
+        uint8_t result = advance();
+        if (result == FRAGMENT_WAIT) {
+            if (n == 0) return kWait;
+            break;
+        }
+        if (result == FRAGMENT_END && _fragment.length() == 0) break;
+    }
+    uint32_t heap = ESP.getFreeHeap();
+    if (heap < _heapLow) _heapLow = heap;
+    _bytes += n;
+    return n;
+}
+
+void JsonStream::appendMembers(String& out, JsonDocument& doc, bool& first) {
+    String text;
+    serializeJson(doc, text);
+    // "{}" has no members
+    if (text.length() <= 2) return;
+    if (!first) out.concat(',');
+    out.concat(text.c_str() + 1, text.length() - 2);
+    first = false;
+}
+
+JsonStreamStats JsonStream::stats() {
+    return gStats;
+}
+
+void JsonStream::populateStats(JsonObject obj) {
+    obj["responses"] = gStats.responses;
+    obj["bytes"] = gStats.bytes;
+    obj["max_bytes"] = gStats.maxBytes;
+    obj["max_fragment"] = gStats.maxFragment;
+    obj["max_heap_drop"] = gStats.maxHeapDrop;
+}
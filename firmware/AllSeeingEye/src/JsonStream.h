@@ -0,0 +1,74 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <functional>
+#include <memory>
+
+// Chunked JSON responses.
+//
+// A handler that serialized a whole JsonDocument into a String held the
+// document and the text at once, both as large as the response. A
+// JsonStream instead produces the response one fragment at a time, from the
+// chunked response callback, and asks for the next fragment only once the
+// previous one has been copied into the TCP send buffer. Only one fragment
+// (a log line, a task, a peer's report, a status section) is in memory, so
+// a request's peak heap is set by the largest fragment, not by the response.
+//
+// The data behind a response can change between chunks; every fragment is
+// consistent in itself, and each source keeps the response valid JSON.
+
+struct JsonStreamStats {
+    uint32_t responses = 0;
+    uint32_t bytes = 0;
+    uint32_t maxBytes = 0;       // largest response
+    uint32_t maxFragment = 0;    // largest fragment held
+    uint32_t maxHeapDrop = 0;    // free heap at the start minus its low point while streaming
+};
+
+class JsonStream {
+public:
+    enum Fragment : uint8_t {
+        FRAGMENT_READY,   // out holds the next fragment (it may be empty)
+        FRAGMENT_END,     // the response is complete
+        FRAGMENT_WAIT     // not ready yet: ask again on the next chunk
+    };
+    // Fills out (cleared) with fragment index
+    typedef std::function<uint8_t(uint32_t index, String& out)> FragmentFn;
+    // Fills doc with element index of an array; false past the last one
+    typedef std::function<bool(uint32_t index, JsonDocument& doc)> ItemFn;
+
+    // read() result for FRAGMENT_WAIT before any byte of a chunk (RESPONSE_TRY_AGAIN)
+    static constexpr size_t kWait = (size_t)-1;
+
+    static std::shared_ptr<JsonStream> fragments(FragmentFn next);
+    static std::shared_ptr<JsonStream> array(ItemFn next);
+    ~JsonStream();
+
+    // For beginChunkedResponse: up to maxLen bytes, 0 once the response is complete
+    size_t read(uint8_t* out, size_t maxLen);
+
+    // Appends doc's members without the braces ("a":1,"b":2), after a comma unless first
+    static void appendMembers(String& out, JsonDocument& doc, bool& first);
+
+    static JsonStreamStats stats();
+    static void populateStats(JsonObject obj);
+
+private:
+    JsonStream();
+    uint8_t advance();
+
+    FragmentFn _fragments;
+    ItemFn _items;
+    String _fragment;
+    size_t _pos;
+    char _lead;          // written before _fragment: '[' or ',' between array elements
+    uint32_t _index;
+    bool _ended;
+    uint32_t _bytes;
+    uint32_t _heapAtStart;
+    uint32_t _heapLow;
+};
+
+#endif
@@ -6,11 +6,17 @@
 #include "Logger.h"
 #include "HAL.h"
 #include "PeerManager.h"
+#include "ReportAggregator.h"
+#include "ClusterGossip.h"
+#include "ClockSync.h"
+#include "ClusterCoordinator.h"
 #include <ESPmDNS.h>
 #include "RingBuffer.h"
+#include "WaterfallStore.h"
 #include "PluginManager.h"
 #include "Scheduler.h"
 #include <time.h>
+#include <sys/time.h>
 #include <esp_sntp.h>
 #include "Geolocation.h"
 #include "BleRangingManager.h"
@@ -50,7 +56,9 @@ Kernel& Kernel::instance() {
     return _instance;
 }
 
-Kernel::Kernel() {}
+Kernel::Kernel() {
+    _peerStatusMutex = xSemaphoreCreateMutex();
+}
 
 void Kernel::setup() {
     // 1. Initialize HAL (LEDs, hardware)
@@ -79,6 +87,9 @@ void Kernel::setup() {
     // Allocate 4MB for high-speed logging/data
     RingBuffer::instance().begin(4 * 1024 * 1024);
 
+    // 5.5 Spectrum history (PSRAM): 2048 sweeps x 255 bins, ~5.7 h at one sweep per 10 s
+    WaterfallStore::instance().begin(2048);
+
     // 6. Network & WiFi
     setupWiFi();
     setupOTA();
@@ -91,6 +102,10 @@ void Kernel::setup() {
 
     // 7.5 Peer Manager
     PeerManager::instance().begin();
+    ReportAggregator::instance().begin();
+    ClusterGossip::instance().begin(Config::instance().getHostname());
+    ClockSync::instance().begin();
+    ClusterCoordinator::instance().begin(Config::instance().getHostname());
     
     // 8. Task Scheduler
     Scheduler::instance().begin();
@@ -137,36 +152,33 @@ void Kernel::loop() {
     // Core 0 Maintenance Loop
     ArduinoOTA.handle();
     PeerManager::instance().loop(); // Handle Discovery
+    ReportAggregator::instance().loop(); // Cluster report fan-out
+    ClusterCoordinator::instance().loop(); // Leader election, versioned deployments, synchronized start
+
+    // Cluster gossip: publish our state (changes go out as deltas) and send due beacons
+    static unsigned long lastGossipState = 0;
+    if (millis() - lastGossipState > 250) {
+        lastGossipState = millis();
+        bool configChanged = readConfig();
+        GossipState state;
+        state.cluster = _cluster;
+        state.status = getStatusMessage();
+        state.task = PluginManager::instance().getActiveTaskName();
+        Deployment deployment = ClusterCoordinator::instance().published();
+        state.desiredVersion = deployment.version;
+        state.desiredOrigin = deployment.origin;
+        state.startAt = deployment.startAt;
+        state.uptimeS = millis() / 1000;
+        refreshPeerStatus(state, deployment, configChanged);
+        ClusterGossip::instance().setLocalState(state);
+    }
+    ClusterGossip::instance().loop();
+    ClockSync::instance().loop();   // Peer clock offsets and the consensus clock
     Scheduler::instance().loop();   // Handle Tasks
     GeolocationService::instance().loop();
+    WebServerManager::instance().loop(); // /api/live push
     // BleRangingManager::instance().loop(); // Moved to Plugin
 
-    // Cluster Alignment: follow desired task if peers indicate one
-    String clusterName = Config::instance().getString("cluster", "Default");
-    String desiredTaskId;
-    String desiredParamsJson;
-    bool startRequested = false;
-    unsigned long sourceProbeTime = 0;
-    if (PeerManager::instance().getClusterDesiredTask(clusterName, desiredTaskId, desiredParamsJson, startRequested, sourceProbeTime)) {
-        if (desiredTaskId.length() > 0 && (desiredTaskId != _desiredTaskId || desiredParamsJson != _desiredTaskParamsJson)) {
-            _desiredTaskId = desiredTaskId;
-            _desiredTaskParamsJson = desiredParamsJson;
-            _startRequested = false;
-
-            JsonDocument paramsDoc;
-            if (_desiredTaskParamsJson.length() > 0) {
-                deserializeJson(paramsDoc, _desiredTaskParamsJson);
-            }
-            JsonObject params = paramsDoc.as<JsonObject>();
-            PluginManager::instance().deployTask(_desiredTaskId, params);
-        }
-
-        if (startRequested && !_startRequested) {
-            _startRequested = true;
-            PluginManager::instance().startStagedTask();
-        }
-    }
-
     // WiFi handling, OTA, etc implicitly handled by events
     // We can add watchdog or status logging here
     static unsigned long lastLog = 0;
@@ -178,31 +190,97 @@ void Kernel::loop() {
     }
 }
 
-void Kernel::setDesiredTask(const String& taskId, const String& paramsJson) {
-    _desiredTaskId = taskId;
-    _desiredTaskParamsJson = paramsJson;
-}
-
-void Kernel::clearDesiredTask() {
-    _desiredTaskId = "";
-    _desiredTaskParamsJson = "";
-    _startRequested = false;
+bool Kernel::readConfig() {
+    uint32_t version = Config::instance().version();
+    if (_configRead && version == _configVersion) return false;
+    _hostname = Config::instance().getHostname();
+    _description = Config::instance().getString("description", "");
+    _cluster = Config::instance().getString("cluster", "Default");
+    _configVersion = version;
+    _configRead = true;
+    return true;
 }
 
-String Kernel::getDesiredTaskId() {
-    return _desiredTaskId;
+void Kernel::refreshPeerStatus(const GossipState& state, const Deployment& deployment, bool configChanged) {
+    // Hostname, description and cluster only change with the config; the rest is compared
+    const GossipState& built = _peerStatusState;
+    if (_peerStatusBuilt && !configChanged && state.status == built.status && state.task == built.task &&
+        state.desiredVersion == built.desiredVersion && state.desiredOrigin == built.desiredOrigin &&
+        state.startAt == built.startAt) {
+        return;
+    }
+    _peerStatusState = state;
+    _peerStatusBuilt = true;
+
+    JsonDocument doc;
+    doc["hostname"] = _hostname;
+    doc["description"] = _description;
+    doc["clusterName"] = state.cluster;
+    doc["status"] = state.status;
+    doc["task"] = state.task;
+    if (deployment.taskId.length() > 0) {
+        JsonObject desired = doc.createNestedObject("desired_task");
+        desired["id"] = deployment.taskId;
+        if (deployment.paramsJson.length() > 0) {
+            JsonDocument paramsDoc;
+            DeserializationError err = deserializeJson(paramsDoc, deployment.paramsJson);
+            if (!err) {
+                desired["params"] = paramsDoc.as<JsonObject>();
+            }
+        }
+    }
+    doc["desired_version"] = state.desiredVersion;
+    doc["desired_origin"] = state.desiredOrigin;
+    doc["start_at"] = state.startAt;
+    doc["start_requested"] = state.startAt != 0;
+    doc["version"] = ++_peerStatusVersion;
+
+    String body;
+    serializeJson(doc, body);
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)ClusterGossip::hash(body.c_str()));
+
+    if (xSemaphoreTake(_peerStatusMutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        _peerStatusBuilt = false; // try again next time
+        return;
+    }
+    _peerStatus = body;
+    _peerStatusEtag = etag;
+    xSemaphoreGive(_peerStatusMutex);
 }
 
-String Kernel::getDesiredTaskParamsJson() {
-    return _desiredTaskParamsJson;
+bool Kernel::getPeerStatus(String& body, String& etag) {
+    if (xSemaphoreTake(_peerStatusMutex, pdMS_TO_TICKS(100)) != pdTRUE) return false;
+    body = _peerStatus;
+    etag = _peerStatusEtag;
+    xSemaphoreGive(_peerStatusMutex);
+    return body.length() > 0;
 }
 
-void Kernel::setStartRequested(bool requested) {
-    _startRequested = requested;
+String Kernel::getPeerStatusEtag() {
+    String etag;
+    if (xSemaphoreTake(_peerStatusMutex, pdMS_TO_TICKS(100)) != pdTRUE) return etag;
+    etag = _peerStatusEtag;
+    xSemaphoreGive(_peerStatusMutex);
+    return etag;
 }
 
-bool Kernel::isStartRequested() {
-    return _startRequested;
+String Kernel::getStatusMessage() {
+    if (!HAL::instance().hasRadio()) {
+        return "Radio Problem: Failed To POST";
+    }
+    if (ClusterCoordinator::instance().applied().taskId.length() > 0 && !ClusterCoordinator::instance().isStarted()) {
+        return "Ready";
+    }
+    String pName = PluginManager::instance().getActivePluginName();
+    if (pName == "SystemIdle") {
+        return "Ready";
+    } else if (pName == "RadioTest") {
+        return "Working: Hardware Verification";
+    } else if (PluginManager::instance().isTaskRunning()) {
+        return "Working: " + pName;
+    }
+    return "Ready";
 }
 
 void Kernel::setupLittleFS() {
@@ -365,6 +443,12 @@ time_t Kernel::getEpochTime() {
     return time(nullptr);
 }
 
+uint64_t Kernel::getEpochTimeUs() {
+    struct timeval tv;
+    if (gettimeofday(&tv, nullptr) != 0 || tv.tv_sec <= 0) return 0;
+    return (uint64_t)tv.tv_sec * 1000000ULL + (uint64_t)tv.tv_usec;
+}
+
 String Kernel::getTimezone() {
     return Config::instance().getTimezone();
 }
@@ -9,6 +9,9 @@
 #include <WiFi.h>
 #include <ArduinoJson.h>
 #include <time.h>
+#include "ClusterGossip.h"
+
+struct Deployment;
 
 class Kernel {
 public:
@@ -22,23 +25,39 @@ public:
     bool isHardwareHealthy() { return _hardwareHealthy; }
     bool isTimeSynced();
     time_t getEpochTime();
+    uint64_t getEpochTimeUs();  // synchronized UTC in microseconds (0 before the first sync read)
     String getTimezone();
     void applyTimezone(const String& timezone);
 
-    // Cluster Task Coordination
-    void setDesiredTask(const String& taskId, const String& paramsJson);
-    void clearDesiredTask();
-    String getDesiredTaskId();
-    String getDesiredTaskParamsJson();
-    void setStartRequested(bool requested);
-    bool isStartRequested();
+    // Node status line of /api/status and the cluster gossip
+    String getStatusMessage();
+
+    // /api/status/peer: the fields peers read (identity, status, deployment) plus a
+    // state version. loop() rebuilds it only when one of them changes; the ETag is
+    // a hash of the document, so it also holds across reboots.
+    bool getPeerStatus(String& body, String& etag);
+    String getPeerStatusEtag();
 
 private:
     Kernel();
     bool _hardwareHealthy = true;
-    String _desiredTaskId;
-    String _desiredTaskParamsJson;
-    bool _startRequested = false;
+
+    // Config values loop() publishes every 250 ms; NVS reads, so only re-read
+    // when Config::version() moves. True when they were.
+    String _hostname;
+    String _description;
+    String _cluster;
+    uint32_t _configVersion = 0;
+    bool _configRead = false;
+    bool readConfig();
+
+    String _peerStatus;
+    String _peerStatusEtag;
+    GossipState _peerStatusState; // the state the document was built from
+    bool _peerStatusBuilt = false;
+    uint32_t _peerStatusVersion = 0;
+    SemaphoreHandle_t _peerStatusMutex;
+    void refreshPeerStatus(const GossipState& state, const Deployment& deployment, bool configChanged);
     
     void setupLittleFS();
     void setupWiFi();
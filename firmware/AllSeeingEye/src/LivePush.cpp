@@ -0,0 +1,226 @@
+#include "LivePush.h"
+#include "Logger.h"
+
+LivePush::LivePush()
+    : _status(nullptr), _transport(nullptr), _frames(nullptr), _clientCount(0), _lastTick(0), _lastSweepPoll(0),
+      _frameLen(0), _sweepGen(0), _sweepSeq(0), _sweepEpoch(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void LivePush::begin(StatusBuilder* status, PushTransport* transport, FrameSource frames) {
+    _status = status;
+    _transport = transport;
+    _frames = frames;
+}
+
+LivePush::Client* LivePush::find(uint32_t id) {
+    for (auto& c : _clients) {
+        if (c.id == id) return &c;
+    }
+    return nullptr;
+}
+
+bool LivePush::addClient(uint32_t id, uint8_t topics) {
+    if (id == 0) return false;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return false;
+    Client* c = find(id);
+    if (!c) c = find(0);
+    if (c && c->id == 0) {
+        *c = Client();
+        c->id = id;
+        c->topics = topics;
+        // The last screenful of log lines first
+        uint32_t seq = Logger::instance().sequence();
+        c->logSeq = seq > kMaxLogLines ? seq - kMaxLogLines : 0;
+        _clientCount++;
+    }
+    xSemaphoreGive(_mutex);
+    return c != nullptr;
+}
+
+void LivePush::removeClient(uint32_t id) {
+    if (id == 0) return;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Client* c = find(id);
+    if (c) {
+        accumulate(_closed, c->stats);
+        *c = Client();
+        _clientCount--;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void LivePush::setTopics(uint32_t id, uint8_t topics) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Client* c = find(id);
+    if (c) {
+        // A topic turned on starts over: the full status, the current sweep
+        if ((topics & PUSH_STATUS) && !(c->topics & PUSH_STATUS)) c->statusGen = 0;
+        if ((topics & PUSH_SWEEPS) && !(c->topics & PUSH_SWEEPS)) c->sweepGen = 0;
+        c->topics = topics;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+uint8_t LivePush::parseTopics(const char* text) {
+    if (!text) return 0;
+    uint8_t topics = 0;
+    if (strstr(text, "status")) topics |= PUSH_STATUS;
+    if (strstr(text, "logs")) topics |= PUSH_LOGS;
+    if (strstr(text, "sweeps")) topics |= PUSH_SWEEPS;
+    return topics;
+}
+
+void LivePush::pollSweep() {
+    if (!_frames) return;
+    size_t len = _frames(_frame, sizeof(_frame));
+    if (len < kSpectrumFrameHeaderBytes) {
+        _frameLen = 0;
+        return;
+    }
+    uint16_t seq = (uint16_t)(_frame[14] | (_frame[15] << 8));
+    uint32_t epoch = (uint32_t)_frame[16] | ((uint32_t)_frame[17] << 8) | ((uint32_t)_frame[18] << 16) |
+                     ((uint32_t)_frame[19] << 24);
+    _frameLen = len;
+    if (_sweepGen != 0 && seq == _sweepSeq && epoch == _sweepEpoch) return;
+    _sweepSeq = seq;
+    _sweepEpoch = epoch;
+    _sweepGen++;
+}
+
+void LivePush::count(Client& c, size_t bytes) {
+    c.stats.messages++;
+    c.stats.bytes += bytes;
+}
+
+bool LivePush::sendStatus(Client& c, unsigned long now) {
+    if (!_status) return false;
+    bool full = c.statusGen == 0;
+    bool keepalive = now - c.statusAt >= kStatusKeepaliveMs;
+    uint32_t since = c.statusGen;
+    _message = full ? "{\"type\":\"status\",\"full\":true,\"data\":" : "{\"type\":\"status\",\"full\":false,\"data\":";
+    if (!_status->buildChanges(since, _message, keepalive)) return false;
+    _message.concat('}');
+    if (!_transport->sendText(c.id, _message.c_str(), _message.length())) return false;
+    c.statusGen = since;
+    c.statusAt = now;
+    c.stats.statusSent++;
+    count(c, _message.length());
+    return true;
+}
+
+bool LivePush::sendLogs(Client& c) {
+    uint32_t seq = c.logSeq;
+    JsonDocument doc;
+    doc["type"] = "logs";
+    JsonArray lines = doc["lines"].to<JsonArray>();
+    uint32_t missed = Logger::instance().populateLogsSince(seq, lines, kMaxLogLines);
+    if (lines.size() == 0 && missed == 0) {
+        c.logSeq = seq;
+        return false;
+    }
+    doc["seq"] = seq;
+    doc["missed"] = missed;
+    serializeJson(doc, _message);
+    if (!_transport->sendText(c.id, _message.c_str(), _message.length())) return false;
+    c.logSeq = seq;
+    c.stats.logLines += lines.size();
+    c.stats.logsMissed += missed;
+    count(c, _message.length());
+    return true;
+}
+
+bool LivePush::sendSweep(Client& c) {
+    if (_frameLen == 0) return false;
+    if (!_transport->sendBinary(c.id, _frame, _frameLen)) return false;
+    if (c.sweepGen != 0 && _sweepGen - c.sweepGen > 1) c.stats.sweepsDropped += _sweepGen - c.sweepGen - 1;
+    c.sweepGen = _sweepGen;
+    c.stats.sweepsSent++;
+    count(c, _frameLen);
+    return true;
+}
+
+void LivePush::loop() {
+    if (!_transport) return;
+    unsigned long now = millis();
+    if (_lastTick != 0 && now - _lastTick < kTickMs) return;
+    _lastTick = now;
+    if (_clientCount == 0) return;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+
+    bool wantSweeps = false;
+    for (const auto& c : _clients) {
+        if (c.id != 0 && (c.topics & PUSH_SWEEPS)) wantSweeps = true;
+    }
+    if (wantSweeps && now - _lastSweepPoll >= kSweepPollMs) {
+        _lastSweepPoll = now;
+        pollSweep();
+    }
+
+    uint32_t logSeq = Logger::instance().sequence();
+    for (auto& c : _clients) {
+        if (c.id == 0) continue;
+        size_t pending = _transport->pending(c.id);
+        if (pending >= kMaxPending) {
+            c.stats.busy++;
+            continue;
+        }
+        size_t room = kMaxPending - pending;
+
+        // Sweeps first, they go stale soonest; status deltas and log lines catch up later
+        if (room > 0 && (c.topics & PUSH_SWEEPS) && c.sweepGen != _sweepGen && sendSweep(c)) room--;
+        if (room > 0 && (c.topics & PUSH_STATUS) && (c.statusGen == 0 || now - c.statusAt >= kStatusMinIntervalMs) &&
+            sendStatus(c, now)) {
+            room--;
+        }
+        if (room > 0 && (c.topics & PUSH_LOGS) && c.logSeq != logSeq && sendLogs(c)) room--;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void LivePush::accumulate(PushClientStats& into, const PushClientStats& s) {
+    into.messages += s.messages;
+    into.bytes += s.bytes;
+    into.statusSent += s.statusSent;
+    into.logLines += s.logLines;
+    into.logsMissed += s.logsMissed;
+    into.sweepsSent += s.sweepsSent;
+    into.sweepsDropped += s.sweepsDropped;
+    into.busy += s.busy;
+}
+
+PushClientStats LivePush::sum() const {
+    PushClientStats sum = _closed;
+    for (const auto& c : _clients) {
+        if (c.id != 0) accumulate(sum, c.stats);
+    }
+    return sum;
+}
+
+PushClientStats LivePush::totals() {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return PushClientStats();
+    PushClientStats total = sum();
+    xSemaphoreGive(_mutex);
+    return total;
+}
+
+bool LivePush::clientStats(uint32_t id, PushClientStats& out) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return false;
+    Client* c = find(id);
+    if (c) out = c->stats;
+    xSemaphoreGive(_mutex);
+    return c != nullptr;
+}
+
+void LivePush::populateStats(JsonObject obj) {
+    // No mutex: loop() holds it while it waits for the StatusBuilder this runs under
+    PushClientStats total = sum();
+    obj["clients"] = _clientCount;
+    obj["messages"] = total.messages;
+    obj["bytes"] = total.bytes;
+    obj["sweeps_sent"] = total.sweepsSent;
+    obj["sweeps_dropped"] = total.sweepsDropped;
+    obj["log_lines"] = total.logLines;
+    obj["logs_missed"] = total.logsMissed;
+    obj["busy"] = total.busy;
+}
@@ -0,0 +1,132 @@
+#ifndef LIVE_PUSH_H
+#define LIVE_PUSH_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "SpectrumFrame.h"
+#include "StatusBuilder.h"
+
+// Push channel behind the /api/live WebSocket.
+//
+// Each client subscribes to topics and is sent, from Kernel::loop:
+//   status  {"type":"status","full":true|false,"data":{...}}: the status
+//           sections that changed since its last status message (all of
+//           them first), at most every kStatusMinIntervalMs; uptime and heap
+//           only ride along, or go out alone every kStatusKeepaliveMs.
+//           Members replace the client's copy, so a section should write
+//           the same keys every time.
+//   logs    {"type":"logs","seq":N,"missed":M,"lines":[...]}: new log lines
+//           (the last 50 first); seq is the number of the last line.
+//   sweeps  the binary sweep frame (SpectrumFrame.h, int8 bins) of every
+//           completed sweep.
+// Nothing is queued here. Every client has a cursor per topic, and a client
+// with kMaxPending messages still in its socket queue is skipped. So a slow
+// client gets one status delta covering everything it missed, the log lines
+// it missed (up to what the log buffer still holds, the rest counted in
+// "missed"), and only the newest sweep, the ones in between counted as
+// dropped. A stalled client costs kMaxPending messages at most.
+//
+// The transport is an interface, so the host build can run this against
+// simulated clients (firmware/host/bench/PushBenchmark.cpp).
+
+enum PushTopic : uint8_t {
+    PUSH_STATUS = 0x01,
+    PUSH_LOGS = 0x02,
+    PUSH_SWEEPS = 0x04,
+    PUSH_ALL = 0x07
+};
+
+class PushTransport {
+public:
+    virtual ~PushTransport() {}
+    // Messages queued for the client and not yet written to its socket
+    virtual size_t pending(uint32_t client) = 0;
+    virtual bool sendText(uint32_t client, const char* data, size_t len) = 0;
+    virtual bool sendBinary(uint32_t client, const uint8_t* data, size_t len) = 0;
+};
+
+struct PushClientStats {
+    uint32_t messages = 0;
+    uint32_t bytes = 0;
+    uint32_t statusSent = 0;
+    uint32_t logLines = 0;
+    uint32_t logsMissed = 0;     // lines that left the log buffer before the client read them
+    uint32_t sweepsSent = 0;
+    uint32_t sweepsDropped = 0;  // superseded by a newer sweep while the client was busy
+    uint32_t busy = 0;           // ticks skipped at kMaxPending
+};
+
+class LivePush {
+public:
+    static constexpr uint8_t kMaxClients = 8;
+    static constexpr size_t kMaxPending = 3;
+    static constexpr uint32_t kTickMs = 50;
+    static constexpr uint32_t kSweepPollMs = 100;
+    static constexpr uint32_t kStatusMinIntervalMs = 250;
+    static constexpr uint32_t kStatusKeepaliveMs = 5000;
+    static constexpr size_t kMaxLogLines = 50;   // per message
+
+    // Fills out with the latest sweep frame; 0 if there is none
+    typedef size_t (*FrameSource)(uint8_t* out, size_t capacity);
+
+    LivePush();
+
+    void begin(StatusBuilder* status, PushTransport* transport, FrameSource frames);
+
+    // Any task (socket events). False when every slot is taken.
+    bool addClient(uint32_t id, uint8_t topics = PUSH_ALL);
+    void removeClient(uint32_t id);
+    void setTopics(uint32_t id, uint8_t topics);
+    // "status,logs,sweeps" or {"subscribe":["status","logs"]}; 0 if nothing matched
+    static uint8_t parseTopics(const char* text);
+
+    // Kernel::loop
+    void loop();
+
+    uint8_t clientCount() const { return _clientCount; }
+    // Per-client counters, summed over all clients that ever connected
+    PushClientStats totals();
+    bool clientStats(uint32_t id, PushClientStats& out);
+    // For a status section writer: reads the counters without the mutex
+    void populateStats(JsonObject obj);
+
+private:
+    struct Client {
+        uint32_t id = 0;           // 0: free slot
+        uint8_t topics = 0;
+        uint32_t statusGen = 0;    // StatusBuilder generation sent; 0: send everything
+        unsigned long statusAt = 0;
+        uint32_t logSeq = 0;       // last log line sent
+        uint32_t sweepGen = 0;     // _sweepGen sent; 0: none yet
+        PushClientStats stats;
+    };
+
+    Client* find(uint32_t id);
+    void pollSweep();
+    bool sendStatus(Client& c, unsigned long now);
+    bool sendLogs(Client& c);
+    bool sendSweep(Client& c);
+    void count(Client& c, size_t bytes);
+    PushClientStats sum() const;
+    static void accumulate(PushClientStats& into, const PushClientStats& s);
+
+    StatusBuilder* _status;
+    PushTransport* _transport;
+    FrameSource _frames;
+    Client _clients[kMaxClients];
+    uint8_t _clientCount;
+    unsigned long _lastTick;
+    unsigned long _lastSweepPoll;
+
+    uint8_t _frame[kSpectrumFrameMaxBytes];
+    size_t _frameLen;
+    uint32_t _sweepGen;            // bumped per completed sweep
+    uint16_t _sweepSeq;
+    uint32_t _sweepEpoch;
+
+    String _message;               // reused per message
+    PushClientStats _closed;       // counters of clients that left
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
@@ -80,6 +80,7 @@ void Logger::addLog(String level, const char* tag, const char* message) {
         if (_headLogs.size() < _maxHeadLogs) {
             _headLogs.push_back(logEntry);
         }
+        _sequence++;
 
         xSemaphoreGive(_mutex);
     }
@@ -116,3 +117,51 @@ void Logger::populateLogs(JsonArray& arr) {
         xSemaphoreGive(_mutex);
     }
 }
+
+uint32_t Logger::populateLogsSince(uint32_t& seq, JsonArray& arr, size_t max) {
+    uint32_t missed = 0;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        // _logs.back() is line _sequence; newer than that is a cursor from before a reboot
+        uint32_t behind = _sequence - seq;
+        if ((int32_t)behind < 0) seq = _sequence;
+        else if (behind > _logs.size()) {
+            missed = behind - (uint32_t)_logs.size();
+            seq += missed;
+        }
+        auto it = _logs.end();
+        std::advance(it, -(long)(_sequence - seq));
+        for (size_t n = 0; it != _logs.end() && n < max; ++it, ++n) {
+            arr.add(*it);
+            seq++;
+        }
+        xSemaphoreGive(_mutex);
+    }
+    return missed;
+}
+
+bool Logger::copyLogAfter(uint32_t& seq, uint32_t end, String& out) {
+    bool found = false;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        uint32_t oldest = _sequence - (uint32_t)_logs.size();
+        if ((int32_t)(seq - oldest) < 0) seq = oldest;
+        if ((int32_t)(end - seq) > 0 && (int32_t)(_sequence - seq) > 0) {
+            out = _logs[_logs.size() - (_sequence - seq)];
+            seq++;
+            found = true;
+        }
+        xSemaphoreGive(_mutex);
+    }
+    return found;
+}
+
+bool Logger::copyHeadLog(size_t index, String& out) {
+    bool found = false;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        if (index < _headLogs.size()) {
+            out = _headLogs[index];
+            found = true;
+        }
+        xSemaphoreGive(_mutex);
+    }
+    return found;
+}
@@ -17,6 +17,14 @@ public:
     std::deque<String> getLogs();
     std::deque<String> getHeadLogs();
     void populateLogs(JsonArray& arr); // Helper for /api/status aggregation
+    uint32_t sequence() const { return _sequence; } // Bumped by every buffered line
+    // Up to max lines after line number seq (sequence() numbering), oldest first; seq advances
+    // past them. Returns how many lines after seq had already left the buffer.
+    uint32_t populateLogsSince(uint32_t& seq, JsonArray& arr, size_t max);
+    // One line at a time, for streamed responses: the line after seq (or the oldest one still
+    // buffered), with seq advanced to it; false once seq reached end.
+    bool copyLogAfter(uint32_t& seq, uint32_t end, String& out);
+    bool copyHeadLog(size_t index, String& out);
 
 private:
     Logger();
@@ -29,6 +37,7 @@ private:
     const size_t _maxHeadLogs = 50; // Keep the first 50 logs forever
     const size_t _maxMemoryUsage = 20 * 1024; // Limit by RAM (20KB)
     size_t _currentMemoryUsage = 0;
+    volatile uint32_t _sequence = 0;
 
     SemaphoreHandle_t _mutex;
 };
@@ -1,6 +1,7 @@
 #include "PeerManager.h"
 #include "Logger.h"
 #include "Config.h"
+#include "ClockSync.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
@@ -14,20 +15,44 @@ PeerManager::PeerManager() {}
 
 void PeerManager::begin() {
     Logger::instance().info("Peers", "Peer Discovery Started (mDNS)");
+    _prober.begin();
+    applyConfig();
     // MDNS.begin is handled in Kernel, so we just assume it's ready or will be.
 }
 
+void PeerManager::reloadConfig() {
+    _configChanged = true;
+}
+
+void PeerManager::applyConfig() {
+    // Cached: subnet sweeps ask isIgnored() for every address
+    int hours = constrain(Config::instance().getInt("peer_ignore_hours", 12), 0, 1000); // millis() wraps at ~1193 h
+    _ignored.setTimeout((uint32_t)hours * 3600000UL, millis());
+}
+
 void PeerManager::loop() {
-    // 1. Process Verification Queue (High Priority)
-    if (!_verificationQueue.empty()) {
+    // 0. Apply finished probes. Probes run on the async_tcp task, so nothing here waits on the network.
+    handleProbeResults();
+    handleGossip();
+    if (_configChanged) {
+        _configChanged = false;
+        applyConfig();
+    }
+    _ignored.expire(millis());
+
+    // 1. Process Verification Queue (High Priority), as many as there are free probe slots.
+    // Once we have peers, one slot stays free for their re-reads so a long queue of strangers cannot delay them.
+    uint8_t reserved = _peers.empty() ? 0 : 1;
+    while (!_verificationQueue.empty() && _prober.freeSlots() > reserved) {
         processVerificationQueue();
-    } 
-    // 2. Run Subnet Scan (Lower Priority, only if no peers found yet)
-    else if (_peers.empty() && _subnetScanActive) {
+    }
+
+    // 2. Subnet sweep while we have no peers. A started sweep runs to the end so it finds every node, not just the first.
+    if (_subnetScanActive && (_peers.empty() || _scanner.active())) {
         runSubnetScanStep();
     }
     
-    // 3. Maintenance (Probe known peers for status updates)
+    // 3. Maintenance (Probe known peers for status updates; peers that gossip are only probed when a beacon asks for it)
     if (millis() - _lastProbeCheck > 2000) { // Check one peer every 2 seconds
         _lastProbeCheck = millis();
         maintainPeers();
@@ -44,23 +69,26 @@ void PeerManager::maintainPeers() {
     if (_peers.empty()) return;
 
     // Find the peer that needs probing the most
-    // Criteria: "Unknown" status OR oldest lastProbe
+    // Criteria: "Unknown" status (never tried) OR oldest probe attempt, so a peer
+    // whose probes fail does not take every slot from the others
     int targetIdx = -1;
     unsigned long oldestTime = millis();
     
     for (int i = 0; i < _peers.size(); i++) {
         if (!_peers[i].online) continue; // Don't spam offline peers? Or maybe do to see if they are back?
         // Let's stick to online ones for status updates first.
+        if (_prober.isProbing(_peers[i].ip)) continue; // Previous probe still within its deadline
+        if (gossipFresh(_peers[i]) && !_peers[i].needsProbe) continue; // State arrives by multicast
         
-        // Priority: Status is Unknown
-        if (_peers[i].status == "Unknown") {
+        // Priority: Status is Unknown, or gossip asked for a re-read
+        if (_peers[i].needsProbe || (_peers[i].status == "Unknown" && _peers[i].lastProbeAttempt == 0)) {
             targetIdx = i;
             break; // Found high priority
         }
         
-        // Otherwise: Oldest probe
-        if (_peers[i].lastProbe < oldestTime) {
-            oldestTime = _peers[i].lastProbe;
+        // Otherwise: Oldest probe attempt
+        if (_peers[i].lastProbeAttempt < oldestTime) {
+            oldestTime = _peers[i].lastProbeAttempt;
             targetIdx = i;
         }
     }
@@ -71,18 +99,17 @@ void PeerManager::maintainPeers() {
         // Debounce: If probing happened very recently, skip?
         // But we enter here every 2s. If we have 10 peers, update rate is 20s. That's fine.
         Logger::instance().info("Peers", "Probing %s for status...", _peers[targetIdx].ip.c_str());
-        probePeer(_peers[targetIdx].ip);
+        if (probePeer(_peers[targetIdx].ip)) _peers[targetIdx].lastProbeAttempt = millis();
     }
 }
 
 void PeerManager::trackIncomingRequest(String ip) {
-    if (isPeered(ip) || isIgnored(ip)) return;
+    uint32_t key = HostIndex::key(ip);
+    if (key == 0 || isPeered(key) || isIgnored(key)) return;
     
-    // Add to queue for verification
-    // Check if already in queue to avoid duplicates
-    for(const auto& qIp : _verificationQueue) {
-        if(qIp == ip) return;
-    }
+    // Add to queue for verification, once
+    if (_queued.contains(key)) return;
+    _queued.insert(key, 0);
     _verificationQueue.push_back(ip);
 }
 
@@ -91,168 +118,250 @@ void PeerManager::processVerificationQueue() {
 
     String targetIp = _verificationQueue.front();
     _verificationQueue.pop_front();
+    _queued.erase(HostIndex::key(targetIp));
 
     Logger::instance().info("Peers", "Verifying potential peer: %s", targetIp.c_str());
-    if (probePeer(targetIp)) {
-        // Peer added inside probePeer if successful
-        Logger::instance().info("Peers", "Verified! Added %s", targetIp.c_str());
-    } else {
-        // Add to ignore list
-        IgnoredHost ign;
-        ign.ip = targetIp;
-        ign.ignoredAt = millis();
-        _ignored.push_back(ign);
-        Logger::instance().info("Peers", "Not a peer. Ignoring %s", targetIp.c_str());
-    }
+    // Verdict (add or ignore) is applied in handleProbeResults()
+    probePeer(targetIp, PROBE_VERIFY);
 }
 
 void PeerManager::runSubnetScanStep() {
-    if (!WiFi.isConnected()) return;
+    if (!_scanner.active()) {
+        if (!_peers.empty() || !WiFi.isConnected()) return;
+        // Still isolated after a full sweep: try again once a minute
+        if (_scanner.stats().sweeps > 0 && millis() - _lastSweepStart < 60000) return;
+        _lastSweepStart = millis();
+        if (!_scanner.begin(WiFi.localIP(), WiFi.subnetMask(), WiFi.gatewayIP())) return;
+    }
 
-    // Get Local Subnet
-    IPAddress local = WiFi.localIP();
-    IPAddress mask = WiFi.subnetMask();
-    
-    // Simple logic for /24 standard networks
-    // Construct target IP
-    IPAddress target = local;
-    target[3] = _currentSubnetIndex;
-
-    // Skip self and gateway (usually .1)
-    if (target != local && target != WiFi.gatewayIP()) {
-        String targetStr = target.toString();
-        
-        // Skip if ignored
-        if (!isIgnored(targetStr)) {
-            // Logger::instance().info("Peers", "Scanning Subnet: %s", targetStr.c_str()); // Verbose
-            if (probePeer(targetStr)) {
-                Logger::instance().info("Peers", "Subnet Scan found peer! %s", targetStr.c_str());
-                // We found one! Current requirement says "until it finds one". 
-                // Implicitly, if we find one, the _peers list is not empty, so the loop condition `_peers.empty()` stops this scan.
-            } else {
-                 // Add to ignore list to prevent re-scanning in this session if we loop or restart scan
-                 // For now, let's not fill the ignore list with the whole subnet, just iterate.
+    // Known peers and hosts that already failed verification are not connected to again
+    _scanner.loop([this](uint32_t ip) {
+        uint32_t key = HostIndex::key(SubnetScanner::fromHostOrder(ip));
+        return isPeered(key) || isIgnored(key);
+    });
+
+    // Only hosts that accepted on port 80 get the /api/status probe.
+    // Hosts left in the scanner queue wait for a free probe slot.
+    uint8_t reserved = _peers.empty() ? 0 : 1;
+    uint32_t open;
+    while (_prober.freeSlots() > reserved && _scanner.takeOpenHost(open)) {
+        IPAddress target = SubnetScanner::fromHostOrder(open);
+        if (isPeered(HostIndex::key(target))) continue;
+        String targetIp = target.toString();
+        if (_prober.isProbing(targetIp)) continue;
+        probePeer(targetIp, PROBE_SUBNET);
+    }
+}
+
+bool PeerManager::probePeer(String ip, uint8_t kind) {
+    Peer* peer = kind == PROBE_MAINTAIN ? findPeer(ip) : nullptr;
+    if (!peer || peer->legacyStatus) return _prober.start(ip, "/api/status", kind);
+    return _prober.start(ip, kPeerStatusPath, kind, PeerProbeEngine::kDefaultTimeoutMs,
+                         peer->statusEtag.length() > 0 ? peer->statusEtag.c_str() : nullptr);
+}
+
+void PeerManager::handleProbeResults() {
+    static const char* const outcomeNames[] = {"ok", "http error", "refused", "timeout", "too large", "not modified"};
+
+    PeerProbeResult result;
+    while (_prober.poll(result)) {
+        String ip = result.ip;
+        bool peerPath = strcmp(result.path, kPeerStatusPath) == 0;
+        bool valid = result.outcome == PROBE_OK && applyStatus(ip, result.body, result.bodyLength);
+
+        Peer* peer = findPeer(ip);
+        _version++;
+        if (peer && peerPath) {
+            if (valid) {
+                peer->statusEtag = result.etag;
+            } else if (result.outcome == PROBE_NOT_MODIFIED) {
+                // Unchanged since the last read: nothing to parse
+                peer->needsProbe = false;
+                peer->online = true;
+                peer->lastSeen = millis();
+                peer->lastProbe = millis();
+                valid = true;
+            } else if (result.outcome == PROBE_HTTP_ERROR && result.httpCode == 404) {
+                Logger::instance().info("Peers", "%s has no %s, reading /api/status instead", ip.c_str(), kPeerStatusPath);
+                peer->legacyStatus = true;
+                peer->statusEtag = "";
+                peer->needsProbe = true;
+                continue; // it answered; not a failed probe
             }
         }
-    }
+        if (peer) {
+            if (valid) peer->probe.record(result.latencyUs);
+            else peer->probe.failed++;
+        }
 
-    _currentSubnetIndex++;
-    if (_currentSubnetIndex > 254) {
-        _currentSubnetIndex = 1; // Restart or stop? 
-        // "until it finds one". If we scanned whole subnet and found none, maybe pause or restart?
-        // Let's pause for a while to save bandwidth. But the loop handles 30s intervals for mDNS.
-        // Let's loop but slower? Or just let it loop.
-        // For compliance with "seek ... until it finds one", we loop.
+        switch (result.kind) {
+            case PROBE_VERIFY:
+            case PROBE_SUBNET:
+                if (valid) {
+                    Logger::instance().info("Peers", result.kind == PROBE_SUBNET ? "Subnet Scan found peer! %s" : "Verified! Added %s", ip.c_str());
+                } else {
+                    _ignored.add(HostIndex::key(ip), millis());
+                    Logger::instance().info("Peers", "Not a peer. Ignoring %s", ip.c_str());
+                }
+                break;
+            default:
+                if (!valid) {
+                    Logger::instance().warn("Peers", "Probe of %s failed (%s, %lu ms)", ip.c_str(),
+                                            outcomeNames[result.outcome < 6 ? result.outcome : 3],
+                                            (unsigned long)(result.latencyUs / 1000));
+                }
+                break;
+        }
     }
 }
 
-bool PeerManager::probePeer(String ip) {
-    HTTPClient http;
-    // Short timeout to not block too long
-    http.setTimeout(2000); 
-    
-    String url = "http://" + ip + "/api/status";
-    http.begin(url);
-    
-    int httpCode = http.GET();
-    if (httpCode == 200) {
-        String payload = http.getString();
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, payload);
-        
-        if (!error && doc.containsKey("hostname")) {
-             // Valid Peer!
-             String pHostname = doc["hostname"].as<String>();
-             String pCluster = doc["clusterName"] | "Default"; 
-             String pStatus = doc["status"] | "Unknown";
-             String pTask = doc["task"] | "Unknown Task";
-             String pDesiredTaskId = "";
-             String pDesiredTaskParams = "";
-             bool pStartRequested = doc["start_requested"] | false;
-             String pDesc = doc["description"] | "";
-
-             if (doc.containsKey("desired_task")) {
-                 JsonObject desired = doc["desired_task"].as<JsonObject>();
-                 pDesiredTaskId = desired["id"] | "";
-                 if (desired.containsKey("params")) {
-                     String paramsJson;
-                     serializeJson(desired["params"], paramsJson);
-                     pDesiredTaskParams = paramsJson;
-                 }
-             }
+void PeerManager::handleGossip() {
+    GossipRecord r;
+    while (ClusterGossip::instance().poll(r)) {
+        Peer* peer = findPeer(HostIndex::key(r.ip));
+        if (!peer) {
+            // Beacon from a node we do not know yet: verify it over HTTP like any caller
+            trackIncomingRequest(r.ip.toString());
+            continue;
+        }
 
-             // Check if exists
-             bool found = false;
-             for(auto& peer : _peers) {
-                 if(peer.ip == ip) {
-                     peer.hostname = pHostname;
-                     peer.description = pDesc;
-                     peer.cluster = pCluster;
-                     peer.status = pStatus;
-                     peer.task = pTask;
-                     peer.desiredTaskId = pDesiredTaskId;
-                     peer.desiredTaskParamsJson = pDesiredTaskParams;
-                     peer.startRequested = pStartRequested;
-                     peer.online = true;
-                     peer.lastSeen = millis();
-                     peer.lastProbe = millis();
-                     found = true;
-                     break;
-                 }
-             }
+        if (peer->gossipHash != 0 && peer->gossipHash != r.hostHash) {
+            peer->needsProbe = true; // another node took this address
+        } else if (peer->lastGossip > 0 && !r.full && (uint16_t)(r.version - peer->gossipVersion) != 1) {
+            peer->needsProbe = true; // lost a delta; full beacons carry everything
+        }
 
-             if(!found) {
-                 Peer p;
-                 p.hostname = pHostname;
-                 p.description = pDesc;
-                 p.ip = ip;
-                 p.cluster = pCluster;
-                 p.status = pStatus;
-                 p.task = pTask;
-                 p.desiredTaskId = pDesiredTaskId;
-                 p.desiredTaskParamsJson = pDesiredTaskParams;
-                 p.startRequested = pStartRequested;
-                 p.online = true;
-                 p.lastSeen = millis();
-                 p.lastProbe = millis();
-                 _peers.push_back(p);
-             }
-             
-             http.end();
-             return true;
+        if (r.fields & GOSSIP_CLUSTER) peer->cluster = r.cluster;
+        if (r.fields & GOSSIP_STATUS) peer->status = r.status;
+        if (r.fields & GOSSIP_TASK) peer->task = r.task;
+        bool desiredChanged = (r.fields & GOSSIP_DESIRED) &&
+                              (r.desiredVersion != peer->desiredVersion || r.desiredOrigin != peer->desiredOrigin);
+        if (desiredChanged) {
+            // Task id and params only come with /api/status; the start time waits for them too
+            peer->needsProbe = true;
+        } else if ((r.fields & GOSSIP_START) && r.startAt != peer->startAt) {
+            peer->startAt = r.startAt;
+            peer->startRequested = r.startAt != 0;
+            peer->lastProbe = millis();
+        }
+
+        peer->gossipHash = r.hostHash;
+        peer->gossipVersion = r.version;
+        peer->lastGossip = millis();
+        peer->lastSeen = millis();
+        peer->online = true;
+        _version++;
+
+        if (peer->needsProbe && !_prober.isProbing(peer->ip) && probePeer(peer->ip)) {
+            peer->lastProbeAttempt = millis();
         }
     }
-    
-    http.end();
-    return false;
 }
 
-bool PeerManager::isPeered(String ip) {
-    for (const auto& p : _peers) {
-        if (p.ip == ip) return true;
-    }
-    return false;
+bool PeerManager::gossipFresh(const Peer& peer) const {
+    return peer.lastGossip > 0 && millis() - peer.lastGossip < ClusterGossip::kStaleMs;
 }
 
-bool PeerManager::isIgnored(String ip) {
-    long timeout = Config::instance().getInt("peer_ignore_hours", 12) * 3600 * 1000;
+bool PeerManager::applyStatus(const String& ip, const char* body, size_t length) {
+    if (body == nullptr || length == 0) return false;
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, body, length);
     
-    for (auto it = _ignored.begin(); it != _ignored.end(); ) {
-        if (it->ip == ip) {
-            if (millis() - it->ignoredAt < timeout) {
-                return true;
-            } else {
-                // Expired
-                it = _ignored.erase(it);
-                return false;
-            }
-        } else {
-            ++it;
-        }
+    if (!error && doc.containsKey("hostname")) {
+         // Valid Peer!
+         String pHostname = doc["hostname"].as<String>();
+         String pCluster = doc["clusterName"] | "Default"; 
+         String pStatus = doc["status"] | "Unknown";
+         String pTask = doc["task"] | "Unknown Task";
+         String pDesiredTaskId = "";
+         String pDesiredTaskParams = "";
+         bool pStartRequested = doc["start_requested"] | false;
+         uint32_t pDesiredVersion = doc["desired_version"] | 0;
+         uint32_t pDesiredOrigin = doc["desired_origin"] | 0;
+         uint32_t pStartAt = doc["start_at"] | 0;
+         bool pCoordinated = doc.containsKey("desired_origin"); // older firmware hashes the task into desired_version
+         String pDesc = doc["description"] | "";
+
+         if (doc.containsKey("desired_task")) {
+             JsonObject desired = doc["desired_task"].as<JsonObject>();
+             pDesiredTaskId = desired["id"] | "";
+             if (desired.containsKey("params")) {
+                 String paramsJson;
+                 serializeJson(desired["params"], paramsJson);
+                 pDesiredTaskParams = paramsJson;
+             }
+         }
+
+         // Check if exists
+         Peer* peer = findPeer(ip);
+         if (peer) {
+             peer->hostname = pHostname;
+             peer->description = pDesc;
+             peer->cluster = pCluster;
+             peer->status = pStatus;
+             peer->task = pTask;
+             peer->desiredTaskId = pDesiredTaskId;
+             peer->desiredTaskParamsJson = pDesiredTaskParams;
+             peer->desiredVersion = pDesiredVersion;
+             peer->desiredOrigin = pDesiredOrigin;
+             peer->startAt = pStartAt;
+             peer->coordinated = pCoordinated;
+             peer->needsProbe = false;
+             peer->startRequested = pStartRequested;
+             peer->online = true;
+             peer->lastSeen = millis();
+             peer->lastProbe = millis();
+         } else {
+             Peer p;
+             p.hostname = pHostname;
+             p.description = pDesc;
+             p.ip = ip;
+             p.cluster = pCluster;
+             p.status = pStatus;
+             p.task = pTask;
+             p.desiredTaskId = pDesiredTaskId;
+             p.desiredTaskParamsJson = pDesiredTaskParams;
+             p.desiredVersion = pDesiredVersion;
+             p.desiredOrigin = pDesiredOrigin;
+             p.startAt = pStartAt;
+             p.coordinated = pCoordinated;
+             p.startRequested = pStartRequested;
+             p.online = true;
+             p.lastSeen = millis();
+             p.lastProbe = millis();
+             addPeer(p);
+         }
+         
+         return true;
     }
     return false;
 }
 
+Peer* PeerManager::findPeer(const String& ip) {
+    return findPeer(HostIndex::key(ip));
+}
+
+Peer* PeerManager::findPeer(uint32_t ip) {
+    uint16_t idx = _peerIndex.find(ip);
+    return idx == HostIndex::kNone ? nullptr : &_peers[idx];
+}
+
+void PeerManager::addPeer(const Peer& peer) {
+    _peers.push_back(peer);
+    _peerIndex.insert(HostIndex::key(peer.ip), (uint16_t)(_peers.size() - 1));
+    _version++;
+}
+
+bool PeerManager::isPeered(uint32_t ip) const {
+    return _peerIndex.contains(ip);
+}
+
+bool PeerManager::isIgnored(uint32_t ip) const {
+    // Expired entries are dropped by _ignored.expire() from loop()
+    return _ignored.contains(ip, millis());
+}
+
 bool PeerManager::pingHost(String ip) {
     // Utility for the new API
     // Using HTTP check as "Ping" for now since raw ICMP might fail on permissions
@@ -286,15 +395,14 @@ void PeerManager::discover() {
 
         // Check if we already know this peer
         bool known = false;
-        for (auto &p : _peers) {
-            if (p.ip == ip) {
-                p.hostname = hostname;
-                p.cluster = peerCluster; // Update cluster
-                p.lastSeen = millis();
-                p.online = true;
-                known = true;
-                break;
-            }
+        Peer* p = findPeer(HostIndex::key(MDNS.address(i)));
+        if (p) {
+            p->hostname = hostname;
+            p->cluster = peerCluster; // Update cluster
+            p->lastSeen = millis();
+            p->online = true;
+            known = true;
+            _version++;
         }
 
         // Add new peer
@@ -307,7 +415,7 @@ void PeerManager::discover() {
             p.status = "Unknown";
             p.online = true;
             p.lastSeen = millis();
-            _peers.push_back(p);
+            addPeer(p);
         }
     }
 }
@@ -326,6 +434,14 @@ void PeerManager::getPeersSnapshot(std::vector<Peer>& out) {
     out = _peers;
 }
 
+void PeerManager::getOnlinePeerAddresses(std::vector<uint32_t>& out) {
+    out.clear();
+    unsigned long now = millis();
+    for (const auto& p : _peers) {
+        if (now - p.lastSeen < 120000) out.push_back(HostIndex::key(p.ip));
+    }
+}
+
 void PeerManager::populatePeers(JsonArray& arr) {
     for (const auto &p : _peers) {
         JsonObject obj = arr.add<JsonObject>();
@@ -346,8 +462,34 @@ void PeerManager::populatePeers(JsonArray& arr) {
                 }
             }
         }
+        obj["desired_version"] = p.desiredVersion;
         obj["start_requested"] = p.startRequested;
+        if (p.startAt != 0) obj["start_at"] = p.startAt;
         obj["lastProbe"] = p.lastProbe;
+        if (p.lastGossip > 0) obj["gossip_age_ms"] = millis() - p.lastGossip;
+
+        // Probe latency over the last successful probes
+        JsonObject probe = obj.createNestedObject("probe");
+        probe["p50_ms"] = p.probe.percentileUs(50) / 1000.0f;
+        probe["p90_ms"] = p.probe.percentileUs(90) / 1000.0f;
+        probe["max_ms"] = p.probe.percentileUs(100) / 1000.0f;
+        probe["samples"] = p.probe.count;
+        probe["ok"] = p.probe.succeeded;
+        probe["failed"] = p.probe.failed;
+
+        // Clock offset from the UDP exchange (ClockSync.h)
+        ClockEstimate clock;
+        if (ClockSync::instance().estimate(HostIndex::key(p.ip), clock)) {
+            JsonObject clockObj = obj.createNestedObject("clock");
+            clockObj["offset_us"] = (long long)clock.offsetUs;
+            clockObj["jitter_us"] = clock.jitterUs;
+            clockObj["rtt_us"] = clock.rttUs;
+            clockObj["drift_ppm"] = clock.driftPpm;
+            clockObj["samples"] = clock.samples;
+            clockObj["rejected"] = clock.rejected;
+            clockObj["synced"] = clock.synced;
+            clockObj["age_ms"] = clock.ageMs;
+        }
         
         // Mark as offline if not seen in 2 minutes (scans happen every 30s)
         bool isOnline = (millis() - p.lastSeen < 120000);
@@ -362,31 +504,22 @@ void PeerManager::populatePeers(JsonArray& arr) {
     }
 }
 
-bool PeerManager::getClusterDesiredTask(const String& clusterName, String& taskId, String& paramsJson, bool& startRequested, unsigned long& sourceProbeTime) {
-    String selectedTaskId = "";
-    String selectedParams = "";
-    bool selectedStart = false;
-    unsigned long newestProbe = 0;
-
+void PeerManager::getClusterMembers(const String& clusterName, std::vector<ClusterMember>& out) {
+    out.clear();
     for (const auto& p : _peers) {
-        if (!p.online) continue;
+        if (!p.online || !p.coordinated) continue;
         if (p.cluster != clusterName) continue;
-        if (p.desiredTaskId.length() == 0) continue;
-        if (p.lastProbe > newestProbe) {
-            newestProbe = p.lastProbe;
-            selectedTaskId = p.desiredTaskId;
-            selectedParams = p.desiredTaskParamsJson;
-            selectedStart = p.startRequested;
-        }
+        // A gossiping peer unheard for three beacons is gone; waiting out the two-minute online window would stall a new leader
+        if (p.lastGossip > 0 && millis() - p.lastSeen > ClusterGossip::kStaleMs) continue;
+        ClusterMember m;
+        m.ip = HostIndex::key(p.ip);
+        m.deployment.version = p.desiredVersion;
+        m.deployment.origin = p.desiredOrigin;
+        m.deployment.taskId = p.desiredTaskId;
+        m.deployment.paramsJson = p.desiredTaskParamsJson;
+        m.deployment.startAt = p.startAt;
+        out.push_back(m);
     }
-
-    if (selectedTaskId.length() == 0) return false;
-
-    taskId = selectedTaskId;
-    paramsJson = selectedParams;
-    startRequested = selectedStart;
-    sourceProbeTime = newestProbe;
-    return true;
 }
 
 void PeerManager::getClusterAlignment(const String& clusterName, const String& desiredTaskId, int& totalOnline, int& alignedOnline) {
@@ -403,6 +536,7 @@ void PeerManager::getClusterAlignment(const String& clusterName, const String& d
 }
 
 void PeerManager::updateBleStats(const std::vector<std::pair<String, int>>& foundPeers) {
+    _version++;
     for (auto &p : _peers) {
         int rssi = -99;
         // Check if this peer was found
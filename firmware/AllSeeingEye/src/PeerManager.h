@@ -8,6 +8,11 @@
 #include <utility> // for std::pair
 #include <ArduinoJson.h>
 #include <deque>
+#include "PeerProbe.h"
+#include "SubnetScanner.h"
+#include "ClusterGossip.h"
+#include "HostTable.h"
+#include "ClusterCoordinator.h"
 
 struct Peer {
     String hostname;
@@ -18,35 +23,55 @@ struct Peer {
     String task; // New field
     String desiredTaskId;
     String desiredTaskParamsJson;
+    uint32_t desiredVersion = 0; // deployment version ("desired_version" of /api/status, gossiped)
+    uint32_t desiredOrigin = 0;  // "desired_origin": who requested that deployment
+    uint32_t startAt = 0;        // "start_at": consensus epoch second it starts at, 0 if staged
     bool startRequested = false;
+    bool coordinated = false;    // publishes versioned deployments (ClusterCoordinator.h)
     bool online;
     unsigned long lastSeen;
     unsigned long lastProbe; // timestamp of last successful /api/status check
+    unsigned long lastProbeAttempt = 0; // when the last maintenance probe was started
     
     // BLE Ranging Data
     std::vector<int> bleRssiHistory; // Last 5 RSSI values (-99 if missing)
     float bleDistance = -1.0f;       // Distance estimate (-1 if unknown)
-};
 
-struct IgnoredHost {
-    String ip;
-    unsigned long ignoredAt;
+    // Status probe latency (successful probes) and failure count
+    PeerProbeStats probe;
+    // Refreshes read /api/status/peer conditionally on this ETag; peers without it get /api/status
+    String statusEtag;
+    bool legacyStatus = false;
+
+    // Cluster gossip (ClusterGossip.h). While beacons arrive the peer is not polled over HTTP.
+    uint32_t gossipHash = 0;
+    uint16_t gossipVersion = 0;
+    unsigned long lastGossip = 0;   // 0: never heard
+    bool needsProbe = false;        // gossip showed a change only /api/status has (desired params, lost delta)
 };
 
 class PeerManager {
 public:
+    static constexpr const char* kPeerStatusPath = "/api/status/peer";
+
     static PeerManager& instance();
 
     void begin();
     void loop();
+    void reloadConfig(); // re-reads peer_ignore_hours on the next loop()
     
     // Returns the list of discovered peers as a JSON Array
     String getPeersAsJson();
     void populatePeers(JsonArray& arr); // Helper for /api/status aggregation
+    // Bumped when a peer is added or its state is refreshed (probe, gossip, mDNS, BLE). Ages
+    // and clock estimates in populatePeers() also move with time alone.
+    uint32_t version() const { return _version; }
     void getPeersSnapshot(std::vector<Peer>& out);
+    // Addresses (HostIndex::key) of the peers seen in the last two minutes; out is reused
+    void getOnlinePeerAddresses(std::vector<uint32_t>& out);
 
-    // Cluster Alignment
-    bool getClusterDesiredTask(const String& clusterName, String& taskId, String& paramsJson, bool& startRequested, unsigned long& sourceProbeTime);
+    // Cluster Alignment: online coordinated peers of clusterName and the deployments they publish; out is reused
+    void getClusterMembers(const String& clusterName, std::vector<ClusterMember>& out);
     void getClusterAlignment(const String& clusterName, const String& desiredTaskId, int& totalOnline, int& alignedOnline);
     
     // Called when an unknown host requests data
@@ -55,8 +80,12 @@ public:
     // Manual Tool
     bool pingHost(String ip);
     
-    // Updates status for a specific peer
-    bool probePeer(String ip);
+    // Starts an async status probe of ip; the result is applied from loop(). Known peers
+    // are refreshed from /api/status/peer (304 while unchanged), others read /api/status.
+    // False if every probe slot is busy or ip is already being probed.
+    bool probePeer(String ip, uint8_t kind = PROBE_MAINTAIN);
+    const PeerProbeEngine& probeEngine() const { return _prober; }
+    const SubnetScanStats& subnetScanStats() const { return _scanner.stats(); }
 
     // Update BLE statistics for all peers based on scan results
     // Input: List of {hostname, rssi} found in the scan
@@ -65,24 +94,39 @@ public:
 private:
     PeerManager();
     
+    // Peers are only ever appended, so _peerIndex maps an address to its position
     std::vector<Peer> _peers;
-    std::vector<IgnoredHost> _ignored;
+    HostIndex _peerIndex;
+    IgnoreList _ignored;
     std::deque<String> _verificationQueue;
+    HostIndex _queued; // addresses in _verificationQueue
+    PeerProbeEngine _prober;
     
     unsigned long _lastScan = 0;
+    volatile bool _configChanged = false;
+    volatile uint32_t _version = 0;
     
     // Subnet Scanner State
     bool _subnetScanActive = true; 
-    int _currentSubnetIndex = 1;
+    SubnetScanner _scanner;
+    unsigned long _lastSweepStart = 0;
     unsigned long _lastProbeCheck = 0; // For background polling
 
+    void applyConfig();
     void discover();
     void processVerificationQueue();
     void runSubnetScanStep();
     void maintainPeers(); // New periodic maintenance
+    void handleProbeResults();
+    void handleGossip();
+    bool gossipFresh(const Peer& peer) const;
+    bool applyStatus(const String& ip, const char* body, size_t length);
+    Peer* findPeer(const String& ip);
+    Peer* findPeer(uint32_t ip);
+    void addPeer(const Peer& peer);
     
-    bool isPeered(String ip);
-    bool isIgnored(String ip);
+    bool isPeered(uint32_t ip) const;
+    bool isIgnored(uint32_t ip) const;
     // bool verifyPeer(String ip); // Replaced by probePeer
 };
 
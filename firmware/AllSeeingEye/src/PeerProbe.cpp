@@ -0,0 +1,361 @@
+#include "PeerProbe.h"
+#include "Logger.h"
+#include <algorithm>
+
+uint32_t PeerProbeStats::percentileUs(uint8_t pct) const {
+    if (count == 0) return 0;
+    uint32_t sorted[kWindow];
+    memcpy(sorted, latencyUs, sizeof(uint32_t) * count);
+    std::sort(sorted, sorted + count);
+    uint32_t rank = ((uint32_t)pct * count + 99) / 100;
+    if (rank == 0) rank = 1;
+    return sorted[rank - 1];
+}
+
+PeerProbeEngine::PeerProbeEngine()
+    : _slotCount(0), _slotBytes(0), _generation(0), _handedOut(-1), _started(0), _timedOut(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+bool PeerProbeEngine::begin() {
+    if (_slotCount > 0) return true;
+
+    size_t slotBytes = kResponseBytes;
+    uint8_t slotCount = kMaxInFlight;
+    char* pool = (char*) heap_caps_malloc((slotBytes + 1) * slotCount, MALLOC_CAP_SPIRAM);
+    if (pool == nullptr) {
+        Logger::instance().error("Peers", "PSRAM Allocation FAILED! Falling back to Heap (small)...");
+        slotBytes = 8 * 1024;
+        slotCount = 2;
+        pool = (char*) malloc((slotBytes + 1) * slotCount);
+        if (pool == nullptr) {
+            Logger::instance().error("Peers", "CRITICAL: RAM Allocation FAILED");
+            return false;
+        }
+    }
+
+    for (uint8_t i = 0; i < slotCount; ++i) {
+        _slots[i].buffer = pool + (slotBytes + 1) * i;
+    }
+    _slotBytes = slotBytes;
+    _slotCount = slotCount;
+    Logger::instance().info("Peers", "Probe engine ready. %u slots x %u bytes", _slotCount, (unsigned)_slotBytes);
+    return true;
+}
+
+bool PeerProbeEngine::start(const String& ip, const char* path, uint8_t kind, uint32_t timeoutMs,
+                            const char* ifNoneMatch) {
+    IPAddress addr;
+    if (_slotCount == 0 || !addr.fromString(ip)) return false;
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+    int8_t free = -1;
+    for (uint8_t i = 0; i < _slotCount; ++i) {
+        const Slot& s = _slots[i];
+        bool active = s.state == SLOT_CONNECTING || s.state == SLOT_WAITING;
+        if (active && strcmp(ip.c_str(), s.ip) == 0) {
+            xSemaphoreGive(_mutex);
+            return false;
+        }
+        if (s.state == SLOT_FREE && free < 0) free = (int8_t)i;
+    }
+    if (free < 0) {
+        xSemaphoreGive(_mutex);
+        return false;
+    }
+
+    Slot& slot = _slots[free];
+    slot.generation = ++_generation;
+    slot.state = SLOT_CONNECTING;
+    slot.kind = kind;
+    slot.outcome = PROBE_TIMEOUT;
+    slot.error = 0;
+    strlcpy(slot.ip, ip.c_str(), sizeof(slot.ip));
+    strlcpy(slot.path, path, sizeof(slot.path));
+    strlcpy(slot.ifNoneMatch, ifNoneMatch ? ifNoneMatch : "", sizeof(slot.ifNoneMatch));
+    slot.etag[0] = '\0';
+    slot.startUs = micros();
+    slot.deadlineMs = millis() + timeoutMs;
+    slot.latencyUs = 0;
+    slot.length = 0;
+    slot.headerBytes = 0;
+    slot.httpCode = 0;
+    slot.contentLength = -1;
+    slot.chunked = false;
+    slot.chunksDone = false;
+    slot.bodyEnd = 0;
+    slot.chunkLeft = 0;
+    uint8_t index = (uint8_t)free;
+    uint32_t generation = slot.generation;
+    uint32_t deadlineMs = slot.deadlineMs;
+    _started++;
+    xSemaphoreGive(_mutex);
+
+    AsyncClient* client = new AsyncClient();
+    client->onConnect([this, index, generation](void*, AsyncClient* c) {
+        handleConnect(index, generation, c);
+    });
+    client->onData([this, index, generation](void*, AsyncClient* c, void* data, size_t len) {
+        handleData(index, generation, c, (const char*)data, len);
+    });
+    client->onError([this, index, generation](void*, AsyncClient*, int8_t error) {
+        handleError(index, generation, error);
+    });
+    client->onDisconnect([this, index, generation](void*, AsyncClient* c) {
+        handleDisconnect(index, generation, c);
+    });
+    // The client enforces its own deadline on the async_tcp task; see PeerProbe.h.
+    client->onPoll([deadlineMs](void*, AsyncClient* c) {
+        if ((int32_t)(millis() - deadlineMs) >= 0) c->close(true);
+    });
+
+    if (!client->connect(addr, kHttpPort)) {
+        delete client;
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+            Slot* s = ownedSlot(index, generation);
+            if (s) finish(*s, PROBE_REFUSED);
+            xSemaphoreGive(_mutex);
+        }
+    }
+    return true;
+}
+
+PeerProbeEngine::Slot* PeerProbeEngine::ownedSlot(uint8_t index, uint32_t generation) {
+    Slot& s = _slots[index];
+    if (s.generation != generation) return nullptr;
+    if (s.state != SLOT_CONNECTING && s.state != SLOT_WAITING) return nullptr;
+    return &s;
+}
+
+void PeerProbeEngine::finish(Slot& slot, uint8_t outcome) {
+    slot.outcome = outcome;
+    slot.latencyUs = micros() - slot.startUs;
+    slot.state = SLOT_DONE;
+    if (outcome == PROBE_TIMEOUT) _timedOut++;
+}
+
+void PeerProbeEngine::handleConnect(uint8_t index, uint32_t generation, AsyncClient* client) {
+    char request[160];
+    int len = 0;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Slot* slot = ownedSlot(index, generation);
+    if (slot) {
+        slot->state = SLOT_WAITING;
+        if (slot->ifNoneMatch[0] != '\0') {
+            len = snprintf(request, sizeof(request),
+                           "GET %s HTTP/1.1\r\nHost: %s\r\nIf-None-Match: %s\r\nConnection: close\r\n\r\n",
+                           slot->path, slot->ip, slot->ifNoneMatch);
+        } else {
+            len = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n",
+                           slot->path, slot->ip);
+        }
+    }
+    xSemaphoreGive(_mutex);
+    if (len > 0) client->write(request, (size_t)len);
+}
+
+void PeerProbeEngine::parseHeader(Slot& slot) {
+    slot.buffer[slot.length] = '\0';
+    char* end = strstr(slot.buffer, "\r\n\r\n");
+    if (!end) return;
+    slot.headerBytes = (size_t)(end - slot.buffer) + 4;
+
+    int code = 0;
+    if (sscanf(slot.buffer, "HTTP/%*d.%*d %d", &code) == 1) slot.httpCode = code;
+
+    // Header names are case-insensitive; scan line starts only.
+    for (char* line = strstr(slot.buffer, "\r\n"); line && line < end; line = strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, "Content-Length:", 15) == 0) {
+            slot.contentLength = atol(line + 2 + 15);
+        } else if (strncasecmp(line + 2, "ETag:", 5) == 0) {
+            const char* value = line + 2 + 5;
+            while (*value == ' ') value++;
+            size_t n = strcspn(value, "\r");
+            if (n >= sizeof(slot.etag)) n = 0;  // longer than any tag we send back
+            memcpy(slot.etag, value, n);
+            slot.etag[n] = '\0';
+        } else if (strncasecmp(line + 2, "Transfer-Encoding:", 18) == 0) {
+            const char* value = line + 2 + 18;
+            while (*value == ' ') value++;
+            slot.chunked = strncasecmp(value, "chunked", 7) == 0;
+        }
+    }
+    if (slot.httpCode == 304 || slot.httpCode == 204) {
+        slot.contentLength = 0;  // never has a body
+        slot.chunked = false;
+    }
+    if (slot.chunked) {
+        slot.contentLength = -1;  // chunked wins over a Content-Length (RFC 9112 6.3)
+        slot.bodyEnd = slot.headerBytes;
+    }
+}
+
+// Moves the data of every complete chunk down to bodyEnd and keeps the
+// bytes not yet parsed (a partial size line or chunk) right after it.
+// Decoded data never overtakes the raw bytes, so this works in place.
+bool PeerProbeEngine::decodeChunks(Slot& slot) {
+    size_t in = slot.bodyEnd;
+    size_t out = slot.bodyEnd;
+    while (!slot.chunksDone && in < slot.length) {
+        if (slot.chunkLeft > 0) {
+            size_t n = std::min(slot.chunkLeft, slot.length - in);
+            memmove(slot.buffer + out, slot.buffer + in, n);
+            in += n;
+            out += n;
+            slot.chunkLeft -= n;
+            continue;
+        }
+        // A size line, or the CRLF that closes the previous chunk's data
+        const char* nl = (const char*)memchr(slot.buffer + in, '\n', slot.length - in);
+        if (!nl) break;
+        const char* line = slot.buffer + in;
+        size_t lineBytes = (size_t)(nl - line) + 1;
+        if (lineBytes > 2 || (lineBytes == 2 && line[0] != '\r')) {
+            char* end = nullptr;
+            unsigned long size = strtoul(line, &end, 16);
+            if (end == line) return false;
+            if (size == 0) slot.chunksDone = true;  // trailers, if any, are not read
+            slot.chunkLeft = size;
+        }
+        in += lineBytes;
+    }
+    memmove(slot.buffer + out, slot.buffer + in, slot.length - in);
+    slot.length = out + (slot.length - in);
+    slot.bodyEnd = out;
+    return true;
+}
+
+uint8_t PeerProbeEngine::outcomeFor(int httpCode) {
+    if (httpCode == 200) return PROBE_OK;
+    if (httpCode == 304) return PROBE_NOT_MODIFIED;
+    return PROBE_HTTP_ERROR;
+}
+
+bool PeerProbeEngine::bodyComplete(const Slot& slot) const {
+    if (slot.chunked) return slot.chunksDone;
+    return slot.headerBytes > 0 && slot.contentLength >= 0 &&
+           slot.length - slot.headerBytes >= (size_t)slot.contentLength;
+}
+
+void PeerProbeEngine::handleData(uint8_t index, uint32_t generation, AsyncClient* client, const char* data, size_t len) {
+    bool closeNow = false;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Slot* slot = ownedSlot(index, generation);
+    if (slot) {
+        if (slot->length + len > _slotBytes) {
+            finish(*slot, PROBE_TOO_LARGE);
+            closeNow = true;
+        } else {
+            memcpy(slot->buffer + slot->length, data, len);
+            slot->length += len;
+            if (slot->headerBytes == 0) parseHeader(*slot);
+            if (slot->chunked && !decodeChunks(*slot)) {
+                finish(*slot, PROBE_HTTP_ERROR);  // not a chunk size line
+                closeNow = true;
+            } else if (bodyComplete(*slot)) {
+                finish(*slot, outcomeFor(slot->httpCode));
+                closeNow = true;
+            }
+        }
+    }
+    xSemaphoreGive(_mutex);
+    // Outside the lock: close() runs onDisconnect synchronously.
+    if (closeNow) client->close(true);
+}
+
+void PeerProbeEngine::handleError(uint8_t index, uint32_t generation, int8_t error) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Slot* slot = ownedSlot(index, generation);
+    if (slot) slot->error = error;
+    xSemaphoreGive(_mutex);
+}
+
+void PeerProbeEngine::handleDisconnect(uint8_t index, uint32_t generation, AsyncClient* client) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        Slot* slot = ownedSlot(index, generation);
+        if (slot) {
+            if (slot->chunked) {
+                finish(*slot, PROBE_HTTP_ERROR);  // closed before the last chunk
+            } else if (slot->headerBytes > 0 && slot->contentLength < 0) {
+                // No Content-Length: the body ends when the peer closes.
+                finish(*slot, outcomeFor(slot->httpCode));
+            } else if (slot->headerBytes > 0) {
+                finish(*slot, PROBE_HTTP_ERROR);  // closed before Content-Length bytes arrived
+            } else if (slot->state == SLOT_CONNECTING && slot->error != 0) {
+                finish(*slot, PROBE_REFUSED);
+            } else {
+                finish(*slot, PROBE_TIMEOUT);     // closed at the deadline or without a reply
+            }
+        }
+        xSemaphoreGive(_mutex);
+    }
+    delete client;
+}
+
+bool PeerProbeEngine::poll(PeerProbeResult& out) {
+    if (_slotCount == 0) return false;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+
+    if (_handedOut >= 0) {
+        _slots[_handedOut].state = SLOT_FREE;
+        _handedOut = -1;
+    }
+
+    uint32_t now = millis();
+    int8_t ready = -1;
+    for (uint8_t i = 0; i < _slotCount; ++i) {
+        Slot& s = _slots[i];
+        if ((s.state == SLOT_CONNECTING || s.state == SLOT_WAITING) && (int32_t)(now - s.deadlineMs) >= 0) {
+            // Orphan the client; it closes itself on its next onPoll.
+            finish(s, PROBE_TIMEOUT);
+            s.generation = ++_generation;
+        }
+        if (s.state == SLOT_DONE && ready < 0) ready = (int8_t)i;
+    }
+
+    if (ready < 0) {
+        xSemaphoreGive(_mutex);
+        return false;
+    }
+
+    Slot& s = _slots[ready];
+    s.state = SLOT_HANDED_OUT;
+    _handedOut = ready;
+    out.ip = s.ip;
+    out.kind = s.kind;
+    out.outcome = s.outcome;
+    out.httpCode = s.httpCode;
+    out.path = s.path;
+    out.etag = s.etag;
+    out.latencyUs = s.latencyUs;
+    out.body = s.headerBytes > 0 ? s.buffer + s.headerBytes : nullptr;
+    size_t bodyEnd = s.chunked ? s.bodyEnd : s.length;
+    out.bodyLength = s.headerBytes > 0 ? bodyEnd - s.headerBytes : 0;
+    if (out.body) s.buffer[bodyEnd] = '\0';
+    xSemaphoreGive(_mutex);
+    return true;
+}
+
+bool PeerProbeEngine::isProbing(const String& ip) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return true;
+    bool probing = false;
+    for (uint8_t i = 0; i < _slotCount; ++i) {
+        const Slot& s = _slots[i];
+        if ((s.state == SLOT_CONNECTING || s.state == SLOT_WAITING) && strcmp(ip.c_str(), s.ip) == 0) {
+            probing = true;
+            break;
+        }
+    }
+    xSemaphoreGive(_mutex);
+    return probing;
+}
+
+uint8_t PeerProbeEngine::freeSlots() {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return 0;
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < _slotCount; ++i) {
+        if (_slots[i].state == SLOT_FREE) count++;
+    }
+    xSemaphoreGive(_mutex);
+    return count;
+}
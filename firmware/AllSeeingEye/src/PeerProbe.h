@@ -0,0 +1,150 @@
+#ifndef PEER_PROBE_H
+#define PEER_PROBE_H
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+
+// Non-blocking HTTP GET probes for PeerManager.
+//
+// Up to kMaxInFlight probes run at once on AsyncTCP, each with its own
+// deadline. Callbacks run on the async_tcp task and only fill the probe's
+// slot (fixed receive buffer in PSRAM, guarded by _mutex). Kernel::loop
+// collects finished probes with poll() and applies them, so _peers is only
+// touched from the loop and a dead peer costs the loop nothing.
+//
+// A chunked response (the node's /api/status and /api/report stream their
+// bodies, JsonStream.h) is decoded in place as it arrives, so the slot
+// buffer bounds the body, not the body plus its chunk framing.
+//
+// Clients are only closed and deleted on the async_tcp task: onPoll (every
+// ~500 ms) closes a client past its deadline and onDisconnect deletes it.
+// poll() gives up on a late probe at its deadline by bumping the slot
+// generation, so stale callbacks no longer match the reused slot.
+
+enum PeerProbeKind : uint8_t {
+    PROBE_MAINTAIN = 0, // status refresh of a known peer
+    PROBE_VERIFY = 1,   // host that called us, not yet a peer
+    PROBE_SUBNET = 2,   // subnet scan candidate
+    PROBE_REPORT = 3    // /api/report?local=1 for the cluster report
+};
+
+enum PeerProbeOutcome : uint8_t {
+    PROBE_OK = 0,         // HTTP 200 with a complete body
+    PROBE_HTTP_ERROR = 1, // answered with another status, or a truncated body
+    PROBE_REFUSED = 2,    // connect refused or reset
+    PROBE_TIMEOUT = 3,    // no complete answer before the deadline
+    PROBE_TOO_LARGE = 4,  // response larger than the slot buffer
+    PROBE_NOT_MODIFIED = 5 // HTTP 304: the If-None-Match ETag still holds, no body
+};
+
+struct PeerProbeResult {
+    const char* ip = "";
+    uint8_t kind = PROBE_MAINTAIN;
+    uint8_t outcome = PROBE_TIMEOUT;
+    int httpCode = 0;
+    const char* path = "";
+    const char* etag = "";        // ETag response header, "" if none
+    uint32_t latencyUs = 0;       // start() to the last byte (or the deadline)
+    const char* body = nullptr;   // valid until the next poll()
+    size_t bodyLength = 0;
+};
+
+// Rolling latency window of one peer's successful probes.
+struct PeerProbeStats {
+    static constexpr uint8_t kWindow = 32;
+
+    uint32_t latencyUs[kWindow];
+    uint8_t count = 0;
+    uint8_t head = 0;
+    uint32_t succeeded = 0;
+    uint32_t failed = 0;
+
+    void record(uint32_t us) {
+        latencyUs[head] = us;
+        head = (uint8_t)((head + 1) % kWindow);
+        if (count < kWindow) count++;
+        succeeded++;
+    }
+
+    // Nearest-rank percentile over the window, 0 if empty.
+    uint32_t percentileUs(uint8_t pct) const;
+};
+
+class PeerProbeEngine {
+public:
+    static constexpr uint8_t kMaxInFlight = 8;
+    static constexpr uint32_t kDefaultTimeoutMs = 2000;
+    static constexpr size_t kResponseBytes = 16 * 1024;
+    static constexpr uint16_t kHttpPort = 80;
+
+    PeerProbeEngine();
+
+    // Allocate the slot buffers (PSRAM, falls back to fewer, smaller heap slots).
+    bool begin();
+
+    // Start GET path on ip, conditional on ifNoneMatch if given.
+    // False if no slot is free or ip is already being probed.
+    bool start(const String& ip, const char* path, uint8_t kind, uint32_t timeoutMs = kDefaultTimeoutMs,
+               const char* ifNoneMatch = nullptr);
+
+    // Loop side: expires late probes and hands out one finished probe per call.
+    bool poll(PeerProbeResult& out);
+
+    bool isProbing(const String& ip);
+    uint8_t freeSlots();
+    uint8_t capacity() const { return _slotCount; }
+
+    uint32_t started() const { return _started; }
+    uint32_t timedOut() const { return _timedOut; }
+
+private:
+    enum SlotState : uint8_t { SLOT_FREE, SLOT_CONNECTING, SLOT_WAITING, SLOT_DONE, SLOT_HANDED_OUT };
+
+    struct Slot {
+        uint32_t generation = 0;
+        uint8_t state = SLOT_FREE;
+        uint8_t kind = PROBE_MAINTAIN;
+        uint8_t outcome = PROBE_TIMEOUT;
+        int8_t error = 0;
+        char ip[16];
+        char path[48];
+        char ifNoneMatch[20];
+        char etag[20];
+        uint32_t startUs = 0;
+        uint32_t deadlineMs = 0;
+        uint32_t latencyUs = 0;
+        char* buffer = nullptr;   // _slotBytes + 1 (NUL)
+        size_t length = 0;
+        size_t headerBytes = 0;   // 0 until the blank line was seen
+        int httpCode = 0;
+        int32_t contentLength = -1;
+        bool chunked = false;     // Transfer-Encoding: chunked, decoded as it arrives
+        bool chunksDone = false;  // the zero-size last chunk was read
+        size_t bodyEnd = 0;       // chunked: end of the decoded body; unparsed bytes follow
+        size_t chunkLeft = 0;     // chunked: data bytes of the current chunk still to come
+    };
+
+    Slot* ownedSlot(uint8_t index, uint32_t generation);
+    void parseHeader(Slot& slot);
+    bool decodeChunks(Slot& slot);
+    bool bodyComplete(const Slot& slot) const;
+    static uint8_t outcomeFor(int httpCode);
+    void finish(Slot& slot, uint8_t outcome);
+
+    void handleConnect(uint8_t index, uint32_t generation, AsyncClient* client);
+    void handleData(uint8_t index, uint32_t generation, AsyncClient* client, const char* data, size_t len);
+    void handleError(uint8_t index, uint32_t generation, int8_t error);
+    void handleDisconnect(uint8_t index, uint32_t generation, AsyncClient* client);
+
+    Slot _slots[kMaxInFlight];
+    uint8_t _slotCount;
+    size_t _slotBytes;
+    uint32_t _generation;
+    int8_t _handedOut;
+    uint32_t _started;
+    uint32_t _timedOut;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
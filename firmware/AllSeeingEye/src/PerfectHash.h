@@ -0,0 +1,90 @@
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include <Arduino.h>
+
+// Compile-time perfect hash over a constexpr table keyed by a string member.
+//
+// The seed is searched at compile time so that every key of the table lands
+// in its own slot of a power-of-two slot array. A lookup is then one hash of
+// the key, one slot, one length check and one compare: no chain of compares
+// to walk, and a new table entry needs nothing else. Slots hold the entry
+// index, kEmptySlot where no key landed.
+//
+// The hash reads the length and three bytes of the key, not all of it: the
+// compare that follows checks every byte anyway, and hashing the whole id
+// cost as much as the prefix chain it replaced.
+
+constexpr uint8_t kEmptySlot = 0xFF;
+
+constexpr size_t keyLength(const char* key) {
+    return __builtin_strlen(key);
+}
+
+// FNV-1a over the length, first, middle and last byte, seeded, then folded:
+// the multiply only carries upwards, so without the fold the slot bits would
+// see only the seed's low bits
+constexpr uint32_t keyHash(const char* key, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    h = (h ^ (uint8_t)len) * 16777619u;
+    if (len > 0) {
+        h = (h ^ (uint8_t)key[0]) * 16777619u;
+        h = (h ^ (uint8_t)key[len / 2]) * 16777619u;
+        h = (h ^ (uint8_t)key[len - 1]) * 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+constexpr bool keyEquals(const char* a, const char* b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+template <size_t Slots>
+struct KeySlots {
+    uint32_t seed = 0;     // 0: no seed found within the search
+    uint8_t index[Slots] = {};
+    uint8_t length[Slots] = {};  // key length of the entry in each slot
+};
+
+template <size_t Slots, typename T, size_t N>
+constexpr KeySlots<Slots> buildKeySlots(const T (&table)[N], const char* T::*key) {
+    static_assert((Slots & (Slots - 1)) == 0, "Slots must be a power of two");
+    static_assert(N < Slots && N < kEmptySlot, "too many keys for the slots");
+    KeySlots<Slots> slots;
+    for (uint32_t seed = 1; seed < 4096; ++seed) {
+        for (size_t s = 0; s < Slots; ++s) slots.index[s] = kEmptySlot;
+        bool perfect = true;
+        for (size_t i = 0; i < N && perfect; ++i) {
+            size_t len = keyLength(table[i].*key);
+            uint32_t s = keyHash(table[i].*key, len, seed) & (Slots - 1);
+            if (slots.index[s] != kEmptySlot || len > 0xFF) {
+                perfect = false;
+            } else {
+                slots.index[s] = (uint8_t)i;
+                slots.length[s] = (uint8_t)len;
+            }
+        }
+        if (perfect) {
+            slots.seed = seed;
+            return slots;
+        }
+    }
+    return slots;
+}
+
+// Index of the entry whose key is key; kEmptySlot if there is none
+template <size_t Slots, typename T, size_t N>
+inline uint8_t findKey(const KeySlots<Slots>& slots, const T (&table)[N], const char* T::*member,
+                       const char* key) {
+    size_t len = strlen(key);
+    uint32_t s = keyHash(key, len, slots.seed) & (Slots - 1);
+    uint8_t i = slots.index[s];
+    if (i == kEmptySlot || slots.length[s] != len) return kEmptySlot;
+    return memcmp(table[i].*member, key, len) == 0 ? i : kEmptySlot;
+}
+
+#endif
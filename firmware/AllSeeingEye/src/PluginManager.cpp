@@ -11,6 +11,8 @@
 #include "HAL.h"
 #include "MeshtasticPlugin.h"
 #include "TaskTypes.h"
+#include "PerfectHash.h"
+#include "TaskCatalogJson.h"
 
 PluginManager& PluginManager::instance() {
     static PluginManager _instance;
@@ -44,167 +46,283 @@ void PluginManager::loadPlugin(ASEPlugin* newPlugin, bool startRunning) {
 
 // -------------------------------------------------------------------------
 // Task Registry
-// Define all available tasks here. 
-// This mimics a database of capabilities.
+// Define all available tasks here: one kTasks entry per task, one kPlugins
+// entry per plugin. Both tables are constexpr and live in flash; routing
+// goes through a perfect hash built from them at compile time
+// (PerfectHash.h). /api/task serves TaskCatalogJson.h, which catalog_bench
+// regenerates from kTasks (see firmware/README.md).
 // -------------------------------------------------------------------------
-std::vector<TaskDefinition> PluginManager::getTaskCatalog() {
-    std::vector<TaskDefinition> catalog;
+namespace {
 
+template <typename P>
+ASEPlugin* makePlugin() {
+    return new P();
+}
+
+constexpr PluginDefinition kPlugins[] = {
+    {"SystemIdle", makePlugin<SystemIdlePlugin>},
+    {"Idle", makePlugin<SystemIdlePlugin>},
+    {"RadioTest", makePlugin<RadioTestPlugin>},
+    {"BleRanging", makePlugin<BleRangingPlugin>},
+    {"Geolocation", makePlugin<GeolocationPlugin>},
+    {"RfDiag", makePlugin<RfDiagPlugin>},
+    {"Spectrum", makePlugin<SpectrumPlugin>},
+    {"Meshtastic", makePlugin<MeshtasticPlugin>},
+};
+
+constexpr uint8_t plugin(const char* name) {
+    for (size_t i = 0; i < sizeof(kPlugins) / sizeof(kPlugins[0]); ++i) {
+        if (keyEquals(kPlugins[i].name, name)) return (uint8_t)i;
+    }
+    return kEmptySlot;
+}
+
+template <size_t N>
+constexpr uint8_t count(const TaskInputDefinition* const (&)[N]) {
+    return (uint8_t)N;
+}
+
+constexpr TaskInputDefinition numberInput(const char* name, const char* label, bool required, float defaultNumber,
+                                          float step, float min) {
+    TaskInputDefinition d;
+    d.name = name;
+    d.label = label;
+    d.type = "number";
+    d.required = required;
+    d.defaultType = INPUT_VALUE_NUMBER;
+    d.defaultNumber = defaultNumber;
+    d.hasStep = true;
+    d.step = step;
+    d.hasMin = true;
+    d.min = min;
+    return d;
+}
+
+constexpr TaskInputDefinition withMax(TaskInputDefinition d, float max) {
+    d.hasMax = true;
+    d.max = max;
+    return d;
+}
+
+// Spectrum Analysis inputs
+constexpr TaskInputDefinition kSpectrumStart = withMax(numberInput("start", "Start Frequency (MHz)", true,
+    HAL::kCc1101DefaultStartMhz, 0.1f, HAL::kCc1101Band1MinMhz), HAL::kCc1101Band3MaxMhz);
+constexpr TaskInputDefinition kSpectrumStop = withMax(numberInput("stop", "Stop Frequency (MHz)", true,
+    HAL::kCc1101DefaultStopMhz, 0.1f, HAL::kCc1101Band1MinMhz), HAL::kCc1101Band3MaxMhz);
+constexpr TaskInputDefinition kSpectrumBandwidth = withMax(numberInput("bandwidth", "Channel Bandwidth (kHz)", true,
+    HAL::kCc1101DefaultBandwidthKhz, 1.0f, HAL::kCc1101MinBandwidthKhz), HAL::kCc1101MaxBandwidthKhz);
+constexpr TaskInputDefinition kSpectrumPower = withMax(numberInput("power", "Broadcast Power (dBm)", true,
+    HAL::kCc1101DefaultPowerDbm, 1.0f, HAL::kCc1101MinPowerDbm), HAL::kCc1101MaxPowerDbm);
+constexpr TaskInputDefinition kSpectrumSamples = withMax(numberInput("samples", "RSSI Samples per Bin", false,
+    1.0f, 1.0f, 1.0f), FastHopEngine::kMaxSamples);
+constexpr TaskInputDefinition kSpectrumDuration = numberInput("duration", "Hold Window (s, 0 = until restarted)", false,
+    60.0f, 10.0f, 0.0f);
+constexpr TaskInputDefinition kSpectrumThreshold = withMax(numberInput("threshold_db",
+    "Detail Threshold (dB over noise floor)", false, 10.0f, 1.0f, 1.0f), 60.0f);
+constexpr TaskInputDefinition kSpectrumDetect = withMax(numberInput("detect_db",
+    "Detection Threshold (dB over CFAR reference)", false, SpectrumDetector::kDefaultThresholdCdb / 100.0f, 1.0f, 1.0f),
+    60.0f);
+
+constexpr const TaskInputDefinition* kScanInputs[] = {
+    &kSpectrumStart, &kSpectrumStop, &kSpectrumBandwidth, &kSpectrumPower, &kSpectrumSamples
+};
+constexpr const TaskInputDefinition* kPeakInputs[] = {
+    &kSpectrumStart, &kSpectrumStop, &kSpectrumBandwidth, &kSpectrumPower, &kSpectrumDuration, &kSpectrumSamples
+};
+constexpr const TaskInputDefinition* kDetectInputs[] = {
+    &kSpectrumStart, &kSpectrumStop, &kSpectrumBandwidth, &kSpectrumPower, &kSpectrumDetect, &kSpectrumSamples
+};
+constexpr const TaskInputDefinition* kAdaptiveInputs[] = {
+    &kSpectrumStart, &kSpectrumStop, &kSpectrumBandwidth, &kSpectrumPower, &kSpectrumThreshold, &kSpectrumSamples
+};
+
+constexpr TaskDefinition kTasks[] = {
     // 1. BLE Ranging
-    catalog.push_back({
-        "ble-ranging/peer", 
-        "BLE Peer Ranging", 
-        "BLE Ranging", 
-        "Active scan + RSSI history logging for specific targets.",
-        "/api/task/ble-ranging/peer"
-    });
-    catalog.push_back({
-        "ble-ranging/survey", 
-        "BLE Device Survey", 
-        "BLE Ranging", 
-        "Lists all nearby BLE MACs and payloads.",
-        "/api/task/ble-ranging/survey"
-    });
+    {"ble-ranging/peer", "BLE Peer Ranging", "BLE Ranging",
+     "Active scan + RSSI history logging for specific targets.",
+     "/api/task/ble-ranging/peer", plugin("BleRanging"), nullptr, 0},
+    {"ble-ranging/survey", "BLE Device Survey", "BLE Ranging",
+     "Lists all nearby BLE MACs and payloads.",
+     "/api/task/ble-ranging/survey", plugin("BleRanging"), nullptr, 0},
 
     // 2. Geolocation (Placeholder)
-    catalog.push_back({
-        "geolocation/fix",
-        "Geolocation Fix",
-        "Geolocation",
-        "Aggregates GPS + WiFi anchors to determine location.",
-        "/api/task/geolocation/fix"
-    });
+    {"geolocation/fix", "Geolocation Fix", "Geolocation",
+     "Aggregates GPS + WiFi anchors to determine location.",
+     "/api/task/geolocation/fix", plugin("Geolocation"), nullptr, 0},
 
     // 3. System
-    catalog.push_back({
-        "system/idle",
-        "System Idle",
-        "System",
-        "Low power background monitoring.",
-        "/api/task/system/idle"
-    });
+    {"system/idle", "System Idle", "System",
+     "Low power background monitoring.",
+     "/api/task/system/idle", plugin("SystemIdle"), nullptr, 0},
 
     // 4. RF Diagnostics
-    catalog.push_back({
-        "rf-diag/noise",
-        "Noise Floor Check",
-        "RF Diagnostics",
-        "Measures RSSI without sync word/packet logic.",
-        "/api/task/rf-diag/noise"
-    });
+    {"rf-diag/noise", "Noise Floor Check", "RF Diagnostics",
+     "Measures RSSI without sync word/packet logic.",
+     "/api/task/rf-diag/noise", plugin("RfDiag"), nullptr, 0},
 
     // 5. Spectrum Analysis
-    TaskInputDefinition spectrumStart;
-    spectrumStart.name = "start";
-    spectrumStart.label = "Start Frequency (MHz)";
-    spectrumStart.type = "number";
-    spectrumStart.required = true;
-    spectrumStart.defaultType = INPUT_VALUE_NUMBER;
-    spectrumStart.defaultNumber = HAL::kCc1101DefaultStartMhz;
-    spectrumStart.hasStep = true;
-    spectrumStart.step = 0.1f;
-    spectrumStart.hasMin = true;
-    spectrumStart.min = HAL::kCc1101Band1MinMhz;
-    spectrumStart.hasMax = true;
-    spectrumStart.max = HAL::kCc1101Band3MaxMhz;
-
-    TaskInputDefinition spectrumStop;
-    spectrumStop.name = "stop";
-    spectrumStop.label = "Stop Frequency (MHz)";
-    spectrumStop.type = "number";
-    spectrumStop.required = true;
-    spectrumStop.defaultType = INPUT_VALUE_NUMBER;
-    spectrumStop.defaultNumber = HAL::kCc1101DefaultStopMhz;
-    spectrumStop.hasStep = true;
-    spectrumStop.step = 0.1f;
-    spectrumStop.hasMin = true;
-    spectrumStop.min = HAL::kCc1101Band1MinMhz;
-    spectrumStop.hasMax = true;
-    spectrumStop.max = HAL::kCc1101Band3MaxMhz;
-
-    TaskInputDefinition spectrumBandwidth;
-    spectrumBandwidth.name = "bandwidth";
-    spectrumBandwidth.label = "Channel Bandwidth (kHz)";
-    spectrumBandwidth.type = "number";
-    spectrumBandwidth.required = true;
-    spectrumBandwidth.defaultType = INPUT_VALUE_NUMBER;
-    spectrumBandwidth.defaultNumber = HAL::kCc1101DefaultBandwidthKhz;
-    spectrumBandwidth.hasStep = true;
-    spectrumBandwidth.step = 1.0f;
-    spectrumBandwidth.hasMin = true;
-    spectrumBandwidth.min = HAL::kCc1101MinBandwidthKhz;
-    spectrumBandwidth.hasMax = true;
-    spectrumBandwidth.max = HAL::kCc1101MaxBandwidthKhz;
-
-    TaskInputDefinition spectrumPower;
-    spectrumPower.name = "power";
-    spectrumPower.label = "Broadcast Power (dBm)";
-    spectrumPower.type = "number";
-    spectrumPower.required = true;
-    spectrumPower.defaultType = INPUT_VALUE_NUMBER;
-    spectrumPower.defaultNumber = HAL::kCc1101DefaultPowerDbm;
-    spectrumPower.hasStep = true;
-    spectrumPower.step = 1.0f;
-    spectrumPower.hasMin = true;
-    spectrumPower.min = HAL::kCc1101MinPowerDbm;
-    spectrumPower.hasMax = true;
-    spectrumPower.max = HAL::kCc1101MaxPowerDbm;
-
-     catalog.push_back({
-         "spectrum/scan",
-         "Band Scan",
-         "Spectrum Analyzer",
-         "Standard sweep, returns power levels.",
-         "/api/task/spectrum/scan",
-         { spectrumStart, spectrumStop, spectrumBandwidth, spectrumPower }
-     });
+    {"spectrum/scan", "Band Scan", "Spectrum Analyzer",
+     "Standard sweep, returns power levels.",
+     "/api/task/spectrum/scan", plugin("Spectrum"), kScanInputs, count(kScanInputs)},
+    {"spectrum/peak", "Peak Hold Sweep", "Spectrum Analyzer",
+     "Synchronized sweeps keeping the max per bin over the hold window; min/average/occupancy ride along.",
+     "/api/task/spectrum/peak", plugin("Spectrum"), kPeakInputs, count(kPeakInputs)},
+    {"spectrum/detect", "Emission Detector", "Spectrum Analyzer",
+     "Synchronized sweeps reduced on the node to signal events (center, width, peak); no raw spectra in the report.",
+     "/api/task/spectrum/detect", plugin("Spectrum"), kDetectInputs, count(kDetectInputs)},
+    {"spectrum/adaptive", "Adaptive Band Scan", "Spectrum Analyzer",
+     "Coarse pass at the widest filter, then re-sweeps only bins above the noise floor at the requested bandwidth.",
+     "/api/task/spectrum/adaptive", plugin("Spectrum"), kAdaptiveInputs, count(kAdaptiveInputs)},
 
     // 6. Meshtastic
-    catalog.push_back({
-        "meshtastic/monitor",
-        "Traffic Monitor",
-        "Meshtastic",
-        "Logs all seen packets with RSSI/SNR metrics.",
-        "/api/task/meshtastic/monitor"
-    });
-    catalog.push_back({
-        "meshtastic/trace",
-        "Network Traceroute",
-        "Meshtastic",
-        "Performs an active traceroute to map the hop path.",
-        "/api/task/meshtastic/trace"
-    });
-
-    return catalog;
+    {"meshtastic/monitor", "Traffic Monitor", "Meshtastic",
+     "Logs all seen packets with RSSI/SNR metrics.",
+     "/api/task/meshtastic/monitor", plugin("Meshtastic"), nullptr, 0},
+    {"meshtastic/trace", "Network Traceroute", "Meshtastic",
+     "Performs an active traceroute to map the hop path.",
+     "/api/task/meshtastic/trace", plugin("Meshtastic"), nullptr, 0},
+};
+
+constexpr bool pluginsResolve() {
+    for (const auto& t : kTasks) {
+        if (t.plugin == kEmptySlot) return false;
+    }
+    return true;
+}
+static_assert(pluginsResolve(), "a task in kTasks names a plugin that is not in kPlugins");
+
+constexpr KeySlots<32> kTaskSlots = buildKeySlots<32>(kTasks, &TaskDefinition::id);
+static_assert(kTaskSlots.seed != 0, "no perfect hash for the task ids: double the slots, or make the ids differ in "
+                                     "length or first, middle or last character");
+constexpr KeySlots<16> kPluginSlots = buildKeySlots<16>(kPlugins, &PluginDefinition::name);
+static_assert(kPluginSlots.seed != 0, "no perfect hash for the plugin names: double the slots, or make the names "
+                                       "differ in length or first, middle or last character");
+
+// FNV-1a over everything populateTask() writes: TaskCatalogJson.h records
+// the key of the table it was serialized from
+constexpr uint32_t mixText(uint32_t h, const char* text) {
+    while (*text) h = (h ^ (uint8_t)*text++) * 16777619u;
+    return (h ^ 0xFFu) * 16777619u;
 }
 
-bool PluginManager::startTask(String taskId, JsonObject params) {
-    Logger::instance().info("PluginMgr", "Requesting Task: %s", taskId.c_str());
-    
-    String pluginName = "";
-    
-    // Router Logic
-    if (taskId.startsWith("ble-ranging")) {
-        pluginName = "BleRanging";
-    } else if (taskId.startsWith("system/idle")) {
-        pluginName = "SystemIdle";
-    } else if (taskId.startsWith("geolocation")) {
-        pluginName = "Geolocation";
-    } else if (taskId.startsWith("rf-diag")) {
-        pluginName = "RfDiag";
-    } else if (taskId.startsWith("spectrum")) {
-        pluginName = "Spectrum";
-    } else if (taskId.startsWith("meshtastic")) {
-        pluginName = "Meshtastic";
+constexpr uint32_t mixValue(uint32_t h, int32_t value) {
+    for (int i = 0; i < 4; ++i) h = (h ^ (uint8_t)(value >> (8 * i))) * 16777619u;
+    return h;
+}
+
+// To a thousandth: the catalog serializes floats, not their bits
+constexpr uint32_t mixNumber(uint32_t h, float value) {
+    return mixValue(h, (int32_t)(value * 1000.0f));
+}
+
+constexpr uint32_t tableKey() {
+    uint32_t h = 2166136261u;
+    for (const auto& t : kTasks) {
+        h = mixText(mixText(mixText(mixText(mixText(h, t.id), t.name), t.description), t.pluginName), t.endpoint);
+        h = mixValue(h, t.inputCount);
+        for (uint8_t i = 0; i < t.inputCount; ++i) {
+            const TaskInputDefinition& in = *t.inputs[i];
+            h = mixText(mixText(mixText(h, in.name), in.label), in.type);
+            h = mixValue(mixValue(h, in.required), in.defaultType);
+            if (in.defaultType == INPUT_VALUE_NUMBER) h = mixNumber(h, in.defaultNumber);
+            else if (in.defaultType == INPUT_VALUE_BOOL) h = mixValue(h, in.defaultBool);
+            else if (in.defaultType == INPUT_VALUE_TEXT) h = mixText(h, in.defaultText);
+            h = mixValue(h, in.hasStep);
+            if (in.hasStep) h = mixNumber(h, in.step);
+            h = mixValue(h, in.hasMin);
+            if (in.hasMin) h = mixNumber(h, in.min);
+            h = mixValue(h, in.hasMax);
+            if (in.hasMax) h = mixNumber(h, in.max);
+            h = mixValue(h, in.optionCount);
+            for (uint8_t o = 0; o < in.optionCount; ++o) h = mixText(mixText(h, in.options[o].label), in.options[o].value);
+        }
     }
-    
-    if (pluginName == "") {
+    return h;
+}
+
+constexpr uint32_t kTableKey = tableKey();
+// The host build is what regenerates the header, so it must build with a
+// stale one; catalog_bench fails on it there instead
+#ifndef ASE_HOST_BUILD
+static_assert(kTableKey == task_catalog_key, "TaskCatalogJson.h is stale: regenerate it with catalog_bench --write "
+                                             "(firmware/README.md)");
+#endif
+
+} // namespace
+
+size_t PluginManager::taskCount() {
+    return sizeof(kTasks) / sizeof(kTasks[0]);
+}
+
+const TaskDefinition& PluginManager::task(size_t index) {
+    return kTasks[index];
+}
+
+uint32_t PluginManager::catalogKey() {
+    return kTableKey;
+}
+
+const TaskDefinition* PluginManager::findTask(const char* taskId) {
+    uint8_t i = findKey(kTaskSlots, kTasks, &TaskDefinition::id, taskId);
+    return i != kEmptySlot ? &kTasks[i] : nullptr;
+}
+
+void PluginManager::populateTask(const TaskDefinition& t, JsonObject obj) {
+    obj["id"] = t.id;
+    obj["name"] = t.name;
+    obj["description"] = t.description;
+    obj["plugin"] = t.pluginName;
+    obj["link"] = t.endpoint;
+    if (t.inputCount > 0) {
+        JsonArray inputs = obj.createNestedArray("inputs");
+        for (uint8_t i = 0; i < t.inputCount; ++i) {
+            const TaskInputDefinition& input = *t.inputs[i];
+            JsonObject inputObj = inputs.add<JsonObject>();
+            inputObj["name"] = input.name;
+            inputObj["label"] = input.label;
+            inputObj["type"] = input.type;
+            if (input.required) {
+                inputObj["required"] = true;
+            }
+            if (input.defaultType == INPUT_VALUE_NUMBER) {
+                inputObj["default"] = input.defaultNumber;
+            } else if (input.defaultType == INPUT_VALUE_BOOL) {
+                inputObj["default"] = input.defaultBool;
+            } else if (input.defaultType == INPUT_VALUE_TEXT) {
+                inputObj["default"] = input.defaultText;
+            }
+            if (input.hasStep) {
+                inputObj["step"] = input.step;
+            }
+            if (input.hasMin) {
+                inputObj["min"] = input.min;
+            }
+            if (input.hasMax) {
+                inputObj["max"] = input.max;
+            }
+            if (input.optionCount > 0) {
+                JsonArray options = inputObj.createNestedArray("options");
+                for (uint8_t o = 0; o < input.optionCount; ++o) {
+                    JsonObject optObj = options.add<JsonObject>();
+                    optObj["label"] = input.options[o].label;
+                    optObj["value"] = input.options[o].value;
+                }
+            }
+        }
+    }
+}
+
+bool PluginManager::startTask(const String& taskId, JsonObject params) {
+    Logger::instance().info("PluginMgr", "Requesting Task: %s", taskId.c_str());
+
+    const TaskDefinition* t = findTask(taskId.c_str());
+    if (!t) {
         Logger::instance().error("PluginMgr", "No plugin mapping for task: %s", taskId.c_str());
         return false;
     }
 
     // Create the new plugin
-    ASEPlugin* plugin = createPlugin(pluginName);
+    ASEPlugin* plugin = kPlugins[t->plugin].create();
     if (!plugin) return false;
 
     // Configure it BEFORE loading it (while it's just a pointer on Core 0 stack)
@@ -216,30 +334,16 @@ bool PluginManager::startTask(String taskId, JsonObject params) {
     return true;
 }
 
-bool PluginManager::deployTask(String taskId, JsonObject params) {
+bool PluginManager::deployTask(const String& taskId, JsonObject params) {
     Logger::instance().info("PluginMgr", "Deploying Task: %s", taskId.c_str());
-    String pluginName = "";
-
-    if (taskId.startsWith("ble-ranging")) {
-        pluginName = "BleRanging";
-    } else if (taskId.startsWith("system/idle")) {
-        pluginName = "SystemIdle";
-    } else if (taskId.startsWith("geolocation")) {
-        pluginName = "Geolocation";
-    } else if (taskId.startsWith("rf-diag")) {
-        pluginName = "RfDiag";
-    } else if (taskId.startsWith("spectrum")) {
-        pluginName = "Spectrum";
-    } else if (taskId.startsWith("meshtastic")) {
-        pluginName = "Meshtastic";
-    }
+    const TaskDefinition* t = findTask(taskId.c_str());
 
-    if (pluginName == "") {
+    if (!t) {
         Logger::instance().error("PluginMgr", "No plugin mapping for task: %s", taskId.c_str());
         return false;
     }
 
-    ASEPlugin* plugin = createPlugin(pluginName);
+    ASEPlugin* plugin = kPlugins[t->plugin].create();
     if (!plugin) return false;
 
     plugin->configure(taskId, params);
@@ -253,21 +357,10 @@ bool PluginManager::startStagedTask() {
     return true;
 }
 
-ASEPlugin* PluginManager::createPlugin(String name) {
-    if (name == "SystemIdle" || name == "Idle") {
-        return new SystemIdlePlugin();
-    }
-    if (name == "RadioTest") {
-        return new RadioTestPlugin();
-    }
-    if (name == "BleRanging") {
-        return new BleRangingPlugin();
-    }
-    if (name == "Geolocation") return new GeolocationPlugin();
-    if (name == "RfDiag") return new RfDiagPlugin();
-    if (name == "Spectrum") return new SpectrumPlugin();
-    if (name == "Meshtastic") return new MeshtasticPlugin();
-    
+ASEPlugin* PluginManager::createPlugin(const String& name) {
+    uint8_t i = findKey(kPluginSlots, kPlugins, &PluginDefinition::name, name.c_str());
+    if (i != kEmptySlot) return kPlugins[i].create();
+
     Logger::instance().error("PluginMgr", "Unknown plugin request: %s. Defaulting to Idle.", name.c_str());
     return new SystemIdlePlugin();
 }
@@ -3,7 +3,6 @@
 
 #include "ASEPlugin.h"
 #include "TaskTypes.h"
-#include <vector>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
@@ -11,10 +10,14 @@ class PluginManager {
 public:
     static PluginManager& instance();
 
-    // Registry
-    std::vector<TaskDefinition> getTaskCatalog(); 
-    bool startTask(String taskId, JsonObject params); // Returns true if task started
-    bool deployTask(String taskId, JsonObject params); // Stage task without running
+    // Registry: constexpr tables in flash (PluginManager.cpp)
+    static size_t taskCount();
+    static const TaskDefinition& task(size_t index);
+    static const TaskDefinition* findTask(const char* taskId); // nullptr if no task has the id
+    static void populateTask(const TaskDefinition& task, JsonObject obj); // One /api/task entry
+    static uint32_t catalogKey(); // Fingerprint of the task table, as TaskCatalogJson.h records it
+    bool startTask(const String& taskId, JsonObject params); // Returns true if task started
+    bool deployTask(const String& taskId, JsonObject params); // Stage task without running
     bool startStagedTask();
 
     // Use to switch plugins from Core 0
@@ -22,7 +25,7 @@ public:
     void loadPlugin(ASEPlugin* newPlugin, bool startRunning);
     
     // Factory Method
-    ASEPlugin* createPlugin(String name);
+    ASEPlugin* createPlugin(const String& name);
 
     // The main loop for Core 1
     void runLoop();
@@ -0,0 +1,251 @@
+#include "ReportAggregator.h"
+#include "PeerManager.h"
+#include "Logger.h"
+#include "JsonStream.h"
+
+ReportAggregator& ReportAggregator::instance() {
+    static ReportAggregator _instance;
+    return _instance;
+}
+
+ReportAggregator::ReportAggregator()
+    : _round(0), _requestedRound(0), _finishedRound(0), _roundActive(false), _roundStartedAt(0), _roundFinishedAt(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void ReportAggregator::begin() {
+    _prober.begin();
+}
+
+void ReportAggregator::loop() {
+    PeerProbeResult result;
+    while (_prober.poll(result)) {
+        applyResult(result);
+    }
+
+    if (!_roundActive) {
+        uint32_t requested = 0;
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+        if (_requestedRound > _round) requested = _requestedRound;
+        xSemaphoreGive(_mutex);
+        if (requested == 0) return;
+        startRound(requested);
+    }
+
+    // Fan out to every peer not asked yet; each probe gets what is left of the round deadline
+    unsigned long elapsed = millis() - _roundStartedAt;
+    bool expired = elapsed >= kRoundDeadlineMs;
+    bool done = true;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+    for (auto& peer : _roundPeers) {
+        if (peer.state == PEER_PENDING && !expired && _prober.freeSlots() > 0 &&
+            _prober.start(peer.ip, "/api/report?local=1", PROBE_REPORT, kRoundDeadlineMs - elapsed)) {
+            peer.state = PEER_STARTED;
+        }
+        if (peer.state == PEER_PENDING || peer.state == PEER_STARTED) done = false;
+    }
+    xSemaphoreGive(_mutex);
+
+    if (done || expired) finishRound();
+}
+
+uint32_t ReportAggregator::requestRound() {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return _finishedRound;
+    uint32_t round;
+    if (_roundActive) {
+        round = _round;
+    } else if (_round > 0 && _finishedRound == _round && millis() - _roundFinishedAt < kReuseMs) {
+        round = _round;
+    } else {
+        if (_requestedRound <= _round) _requestedRound = _round + 1;
+        round = _requestedRound;
+    }
+    xSemaphoreGive(_mutex);
+    return round;
+}
+
+bool ReportAggregator::roundReady(uint32_t round, unsigned long requestedAtMs) {
+    if (millis() - requestedAtMs > kRoundDeadlineMs + 2000) return true;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+    bool ready = _finishedRound >= round;
+    xSemaphoreGive(_mutex);
+    return ready;
+}
+
+void ReportAggregator::startRound(uint32_t round) {
+    std::vector<Peer> peers;
+    PeerManager::instance().getPeersSnapshot(peers);
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    _round = round;
+    _roundActive = true;
+    _roundStartedAt = millis();
+    _roundPeers.clear();
+    for (const auto& p : peers) {
+        if (!p.online || p.ip.length() == 0) continue;
+        RoundPeer peer;
+        peer.ip = p.ip;
+        peer.hostname = p.hostname;
+        _roundPeers.push_back(peer);
+    }
+
+    // Forget reports of peers that have been gone for a while
+    for (auto it = _cache.begin(); it != _cache.end(); ) {
+        if (millis() - it->fetchedAt > kCacheMaxAgeMs) it = _cache.erase(it);
+        else ++it;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void ReportAggregator::applyResult(const PeerProbeResult& result) {
+    String ip = result.ip;
+    String nodesJson;
+    bool valid = false;
+    if (result.outcome == PROBE_OK && result.body != nullptr) {
+        JsonDocument doc;
+        DeserializationError err = deserializeJson(doc, result.body, result.bodyLength);
+        if (!err && !doc["nodes"].isNull()) {
+            serializeJson(doc["nodes"], nodesJson);
+            valid = true;
+        }
+    }
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    CachedReport* cached = findCached(ip);
+    if (valid) {
+        if (!cached) {
+            _cache.push_back(CachedReport());
+            cached = &_cache.back();
+            cached->ip = ip;
+        }
+        cached->nodesJson = std::make_shared<const String>(nodesJson);
+        cached->fetchedAt = millis();
+        cached->round = _round;
+        cached->latencyUs = result.latencyUs;
+        cached->failures = 0;
+    } else if (cached) {
+        cached->failures++;
+    }
+    for (auto& peer : _roundPeers) {
+        if (peer.ip == ip && peer.state == PEER_STARTED) {
+            peer.state = valid ? PEER_ANSWERED : PEER_FAILED;
+        }
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void ReportAggregator::finishRound() {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    _roundActive = false;
+    _finishedRound = _round;
+    _roundFinishedAt = millis();
+
+    // Shares the cached report strings; a response holding it keeps them alive
+    std::shared_ptr<ReportRound> finished = std::make_shared<ReportRound>();
+    finished->peers.reserve(_roundPeers.size());
+    ReportRoundStats& stats = finished->stats;
+    stats.round = _round;
+    stats.peers = (uint16_t)_roundPeers.size();
+    stats.elapsedMs = _roundFinishedAt - _roundStartedAt;
+    for (const auto& peer : _roundPeers) {
+        ReportRound::Peer served;
+        served.ip = peer.ip;
+        served.hostname = peer.hostname;
+        served.answered = peer.state == PEER_ANSWERED;
+        CachedReport* cached = findCached(peer.ip);
+        if (cached) {
+            served.fetchedAt = cached->fetchedAt;
+            served.nodes = cached->nodesJson;
+        }
+        if (served.answered) stats.fresh++;
+        else if (cached) stats.stale++;
+        else stats.missing++;
+        finished->peers.push_back(served);
+    }
+    _last = stats;
+    _finished = finished;
+    xSemaphoreGive(_mutex);
+
+    if (stats.stale > 0 || stats.missing > 0) {
+        static unsigned long lastWarn = 0;
+        if (millis() - lastWarn > 30000) {
+            lastWarn = millis();
+            Logger::instance().warn("Report", "Report round %lu: %u/%u peers in %lu ms, %u stale, %u missing",
+                                    (unsigned long)stats.round, stats.fresh, stats.peers,
+                                    (unsigned long)stats.elapsedMs, stats.stale, stats.missing);
+        }
+    }
+}
+
+ReportAggregator::CachedReport* ReportAggregator::findCached(const String& ip) {
+    for (auto& c : _cache) {
+        if (c.ip == ip) return &c;
+    }
+    return nullptr;
+}
+
+void ReportAggregator::writePeerNodes(const ReportRound::Peer& peer, JsonObject nodes, const String& selfName,
+                                      unsigned long now) {
+    JsonDocument peerDoc;
+    if (!peer.nodes || deserializeJson(peerDoc, *peer.nodes)) {
+        JsonObject node = nodes.createNestedObject(peer.hostname.length() > 0 ? peer.hostname : peer.ip);
+        node["ip"] = peer.ip;
+        node["missing"] = true;
+        return;
+    }
+    for (JsonPair kv : peerDoc.as<JsonObject>()) {
+        if (selfName == kv.key().c_str()) continue;
+        nodes[kv.key().c_str()] = kv.value();
+        JsonObject node = nodes[kv.key().c_str()];
+        node["age_ms"] = now - peer.fetchedAt;
+        if (!peer.answered) node["stale"] = true;
+    }
+}
+
+void ReportAggregator::populateNodes(JsonObject nodes, const String& selfName) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    std::shared_ptr<const ReportRound> round = _finished;
+    xSemaphoreGive(_mutex);
+    if (!round) return;
+    unsigned long now = millis();
+    for (const auto& peer : round->peers) writePeerNodes(peer, nodes, selfName, now);
+}
+
+bool ReportAggregator::pinRound(ReportCursor& cursor) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(20)) != pdTRUE) return false;
+    cursor.round = _finished;
+    xSemaphoreGive(_mutex);
+    return true;
+}
+
+uint8_t ReportAggregator::streamNodes(uint32_t index, ReportCursor& cursor, const String& selfName, String& out) {
+    if (!cursor.round && !pinRound(cursor)) return JsonStream::FRAGMENT_WAIT;
+    if (!cursor.round) return JsonStream::FRAGMENT_END;
+    if (index >= cursor.round->peers.size()) return JsonStream::FRAGMENT_END;
+    JsonDocument doc;
+    writePeerNodes(cursor.round->peers[index], doc.to<JsonObject>(), selfName, millis());
+    JsonStream::appendMembers(out, doc, cursor.first);
+    return JsonStream::FRAGMENT_READY;
+}
+
+void ReportAggregator::populateGather(JsonObject gather) {
+    populateGather(gather, lastRound());
+}
+
+void ReportAggregator::populateGather(JsonObject gather, const ReportRoundStats& stats) {
+    gather["round"] = stats.round;
+    gather["deadline_ms"] = kRoundDeadlineMs;
+    gather["elapsed_ms"] = stats.elapsedMs;
+    gather["peers"] = stats.peers;
+    gather["fresh"] = stats.fresh;
+    gather["stale"] = stats.stale;
+    gather["missing"] = stats.missing;
+}
+
+ReportRoundStats ReportAggregator::lastRound() {
+    ReportRoundStats stats;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return stats;
+    stats = _last;
+    xSemaphoreGive(_mutex);
+    return stats;
+}
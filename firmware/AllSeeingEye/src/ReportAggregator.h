@@ -0,0 +1,137 @@
+#ifndef REPORT_AGGREGATOR_H
+#define REPORT_AGGREGATOR_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <memory>
+#include <vector>
+#include "PeerProbe.h"
+
+// Scatter-gather for the cluster /api/report.
+//
+// A report request asks for a round: Kernel::loop fans GET
+// /api/report?local=1 out to every online peer at once (up to the probe
+// engine's slots, the rest as slots free up), all under one round deadline.
+// The round ends when every peer answered or failed, or at the deadline.
+// The web handler never waits on the network. Its response callback returns
+// RESPONSE_TRY_AGAIN until roundReady(), then serves populateNodes().
+//
+// The last good report of every peer is cached with its fetch time. A peer
+// that misses the round is served from the cache and marked stale. A peer
+// with no cached report is marked missing. Requests that arrive while a
+// round runs join it; a round that ended less than kReuseMs ago is reused.
+//
+// A finished round is kept as a ReportRound: its peers with the cached
+// report each had when the round ended. A streamed response pins it in its
+// ReportCursor, so a round finishing while the response is sent changes
+// nothing in it.
+
+struct ReportRoundStats {
+    uint32_t round = 0;
+    uint16_t peers = 0;
+    uint16_t fresh = 0;     // answered in this round
+    uint16_t stale = 0;     // served from an older report
+    uint16_t missing = 0;   // no report at all
+    uint32_t elapsedMs = 0; // round start to end
+};
+
+// One finished round as responses serve it. Never modified once published.
+struct ReportRound {
+    struct Peer {
+        String ip;
+        String hostname;
+        bool answered = false;                 // fresh; otherwise served as stale
+        unsigned long fetchedAt = 0;
+        std::shared_ptr<const String> nodes;   // "nodes" object of its last report, null: missing
+    };
+    std::vector<Peer> peers;
+    ReportRoundStats stats;
+};
+
+// A streamed /api/report's place in its round (streamNodes)
+struct ReportCursor {
+    std::shared_ptr<const ReportRound> round;   // pinned as the response starts
+    bool first = true;                         // no member written to "nodes" yet
+};
+
+class ReportAggregator {
+public:
+    static constexpr uint32_t kRoundDeadlineMs = 1500;
+    static constexpr uint32_t kReuseMs = 500;
+    static constexpr uint32_t kCacheMaxAgeMs = 10UL * 60UL * 1000UL;
+
+    static ReportAggregator& instance();
+
+    void begin();
+
+    // Loop side (Kernel::loop): starts requested rounds, applies finished
+    // probes and ends the round.
+    void loop();
+
+    // Any task: join the running round or request a new one. Returns its id.
+    uint32_t requestRound();
+
+    // Any task: true once the round has ended, or when requestedAtMs is so old
+    // that the loop side must be stuck (the response then serves the cache).
+    bool roundReady(uint32_t round, unsigned long requestedAtMs);
+
+    // Any task: one object per peer node of the last round, keyed by node
+    // name, with age_ms and stale/missing markers. Skips selfName.
+    void populateNodes(JsonObject nodes, const String& selfName);
+    // Any task, for a streamed response: pins the last finished round in
+    // cursor. False if the lock is busy; try again.
+    bool pinRound(ReportCursor& cursor);
+    // populateNodes() one peer at a time from the pinned round (pinned here if
+    // it is not yet), the index-th peer's members appended to out.
+    // FRAGMENT_END past its last peer. Returns a JsonStream::Fragment.
+    uint8_t streamNodes(uint32_t index, ReportCursor& cursor, const String& selfName, String& out);
+    void populateGather(JsonObject gather);
+    static void populateGather(JsonObject gather, const ReportRoundStats& stats);
+
+    ReportRoundStats lastRound();
+    const PeerProbeEngine& probeEngine() const { return _prober; }
+
+private:
+    ReportAggregator();
+
+    enum PeerState : uint8_t { PEER_PENDING, PEER_STARTED, PEER_ANSWERED, PEER_FAILED };
+
+    struct RoundPeer {
+        String ip;
+        String hostname;
+        uint8_t state = PEER_PENDING;
+    };
+
+    struct CachedReport {
+        String ip;
+        std::shared_ptr<const String> nodesJson;   // "nodes" object of the peer's local report
+        unsigned long fetchedAt = 0;
+        uint32_t round = 0;         // round it was fetched in
+        uint32_t latencyUs = 0;
+        uint32_t failures = 0;      // rounds missed since the last good report
+    };
+
+    void startRound(uint32_t round);
+    void applyResult(const PeerProbeResult& result);
+    void finishRound();
+    CachedReport* findCached(const String& ip);
+    static void writePeerNodes(const ReportRound::Peer& peer, JsonObject nodes, const String& selfName,
+                               unsigned long now);
+
+    PeerProbeEngine _prober;
+
+    uint32_t _round;            // running or last started round
+    uint32_t _requestedRound;
+    uint32_t _finishedRound;
+    bool _roundActive;
+    unsigned long _roundStartedAt;
+    unsigned long _roundFinishedAt;
+    std::vector<RoundPeer> _roundPeers;
+    std::shared_ptr<const ReportRound> _finished;  // what responses are built from; null before the first
+    std::vector<CachedReport> _cache;
+    ReportRoundStats _last;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
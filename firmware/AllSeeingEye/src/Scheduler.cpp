@@ -30,6 +30,7 @@ void Scheduler::loop() {
     if (_isIdle && !_queue.empty()) {
         RadioTask next = _queue.front();
         _queue.pop_front();
+        _version++;
         switchToTask(next);
     }
 }
@@ -40,6 +41,7 @@ void Scheduler::enqueue(RadioTask task) {
     
     Logger::instance().info("Scheduler", "Enqueued Task: %s (%s)", task.taskName.c_str(), task.pluginName.c_str());
     _queue.push_back(task);
+    _version++;
 }
 
 void Scheduler::preempt(RadioTask task) {
@@ -50,6 +52,7 @@ void Scheduler::preempt(RadioTask task) {
     
     Logger::instance().warn("Scheduler", "Preempting with Task: %s", task.taskName.c_str());
     _queue.push_front(task);
+    _version++;
     
     // Force switch immediately?
     // If we just push front and invalid current, next loop picks it up.
@@ -63,6 +66,7 @@ void Scheduler::switchToTask(RadioTask t) {
     _current.startTime = millis();
     _current.isRunning = true;
     _isIdle = (t.type == TASK_BACKGROUND); // Technically Idle is a task too
+    _version++;
 
     Logger::instance().info("Scheduler", "Switching to Task: %s", t.taskName.c_str());
 
@@ -21,6 +21,8 @@ public:
     // Get current status for API
     RadioTask getCurrentTask();
     std::deque<RadioTask> getQueue(); // Copy for API
+    size_t queueDepth() const { return _queue.size(); }
+    uint32_t version() const { return _version; } // Bumped when the current task or the queue changes
 
 private:
     Scheduler();
@@ -29,6 +31,7 @@ private:
     RadioTask _current;
     
     bool _isIdle = true;
+    volatile uint32_t _version = 0;
     
     void switchToTask(RadioTask t);
     void startIdle();
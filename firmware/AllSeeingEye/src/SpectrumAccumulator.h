@@ -0,0 +1,98 @@
+#ifndef SPECTRUMACCUMULATOR_H
+#define SPECTRUMACCUMULATOR_H
+
+#include <Arduino.h>
+#include "SweepSnapshot.h"
+
+// Per-bin running statistics over successive sweeps, updated in place on the
+// plugin task (Core 1) and exported into the SweepSnapshot accumulator channels.
+//
+// Everything is integer: max/min hold in centi-dB (int16), the exponential
+// average in centi-dB Q8 (int32, weight 1/2^averageShift) and occupancy as a
+// count of sweeps at or above the threshold. Each update is one pass of
+// branch-free loops over contiguous arrays. The occupancy window halves
+// itself at 65535 sweeps, so old sweeps fade out instead of overflowing.
+
+class SpectrumAccumulator {
+public:
+    static constexpr uint8_t kDefaultAverageShift = 3;       // alpha = 1/8
+    static constexpr int16_t kDefaultOccupancyCdb = -9000;   // -90 dBm
+    static constexpr uint8_t kMaxAverageShift = 8;
+
+    void configure(int16_t occupancyCdb, uint8_t averageShift) {
+        _occupancyCdb = occupancyCdb;
+        _averageShift = averageShift > kMaxAverageShift ? kMaxAverageShift : averageShift;
+    }
+
+    void reset() {
+        _binCount = 0;
+        _sweeps = 0;
+    }
+
+    void update(const int16_t* live, uint16_t binCount) {
+        if (binCount > kSweepMaxBins) binCount = kSweepMaxBins;
+        if (binCount != _binCount || _sweeps == 0) {
+            start(live, binCount);
+            return;
+        }
+
+        if (_sweeps == 0xFFFF) {
+            for (uint16_t i = 0; i < binCount; ++i) _occupied[i] >>= 1;
+            _sweeps >>= 1;
+        }
+
+        const int16_t threshold = _occupancyCdb;
+        const uint8_t shift = _averageShift;
+        for (uint16_t i = 0; i < binCount; ++i) {
+            int16_t x = live[i];
+            _max[i] = x > _max[i] ? x : _max[i];
+            _min[i] = x < _min[i] ? x : _min[i];
+            _averageQ8[i] += (((int32_t)x << 8) - _averageQ8[i]) >> shift;
+            _occupied[i] += (uint16_t)(x >= threshold);
+        }
+        _sweeps++;
+    }
+
+    // Writes the accumulator channels of a snapshot slot (the live channel is left alone).
+    void exportTo(SweepSlot& slot) const {
+        uint16_t n = _binCount < slot.binCount ? _binCount : slot.binCount;
+        memcpy(slot.cdb[SWEEP_CHANNEL_MAX_HOLD], _max, sizeof(int16_t) * n);
+        memcpy(slot.cdb[SWEEP_CHANNEL_MIN_HOLD], _min, sizeof(int16_t) * n);
+        int16_t* average = slot.cdb[SWEEP_CHANNEL_AVERAGE];
+        int16_t* occupancy = slot.cdb[SWEEP_CHANNEL_OCCUPANCY];
+        uint32_t sweeps = _sweeps ? _sweeps : 1;
+        for (uint16_t i = 0; i < n; ++i) {
+            average[i] = (int16_t)((_averageQ8[i] + 128) >> 8);
+            occupancy[i] = (int16_t)(((uint32_t)_occupied[i] * 10000 + sweeps / 2) / sweeps);
+        }
+        slot.accumulated = _sweeps;
+    }
+
+    uint16_t sweeps() const { return _sweeps; }
+    int16_t occupancyCdb() const { return _occupancyCdb; }
+    uint8_t averageShift() const { return _averageShift; }
+
+private:
+    void start(const int16_t* live, uint16_t binCount) {
+        _binCount = binCount;
+        for (uint16_t i = 0; i < binCount; ++i) {
+            int16_t x = live[i];
+            _max[i] = x;
+            _min[i] = x;
+            _averageQ8[i] = (int32_t)x << 8;
+            _occupied[i] = (uint16_t)(x >= _occupancyCdb);
+        }
+        _sweeps = 1;
+    }
+
+    int16_t _max[kSweepMaxBins];
+    int16_t _min[kSweepMaxBins];
+    int32_t _averageQ8[kSweepMaxBins];
+    uint16_t _occupied[kSweepMaxBins];
+    uint16_t _binCount = 0;
+    uint16_t _sweeps = 0;
+    int16_t _occupancyCdb = kDefaultOccupancyCdb;
+    uint8_t _averageShift = kDefaultAverageShift;
+};
+
+#endif
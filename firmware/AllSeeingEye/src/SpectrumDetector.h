@@ -0,0 +1,221 @@
+#ifndef SPECTRUMDETECTOR_H
+#define SPECTRUMDETECTOR_H
+
+#include <Arduino.h>
+#include "SweepSnapshot.h"
+
+// Emission detector run on the plugin task (Core 1) after every sweep.
+//
+// Each bin keeps a rolling noise floor (centi-dB, Q4). It falls quickly
+// towards quieter readings and rises slowly, and only while the bin is not
+// flagged, so an emitter does not raise its own floor. The detection
+// reference for bin i is a cell-averaging CFAR over the floors of
+// trainBins bins on each side, skipping guardBins next to i. A bin is
+// flagged when it exceeds that reference by thresholdCdb. Using the
+// neighbours' floors keeps a long-lived carrier detectable, while wideband
+// noise raises the reference for every bin it covers.
+//
+// Contiguous flagged bins become one SpectrumEvent: centre (excess-weighted
+// centroid), width, peak and the reference at the peak. That is a few dozen
+// bytes instead of a full sweep. Events go into a SpectrumEventLog ring that
+// web handlers read with a short mutex hold.
+
+struct SpectrumEvent {
+    uint32_t seq = 0;           // event number since the task started
+    uint32_t sweepSeq = 0;
+    uint32_t epoch = 0;         // UTC slot of the sweep
+    uint32_t peakUs = 0;        // peak bin read time, us after the slot boundary
+    float centerMhz = 0.0f;
+    float widthKhz = 0.0f;
+    int16_t peakCdb = 0;
+    int16_t referenceCdb = 0;   // CFAR reference at the peak bin
+    uint16_t firstBin = 0;
+    uint16_t binCount = 0;
+};
+
+class SpectrumDetector {
+public:
+    static constexpr int16_t kDefaultThresholdCdb = 800;   // 8 dB over the reference
+    static constexpr uint8_t kDefaultGuardBins = 2;
+    static constexpr uint8_t kDefaultTrainBins = 8;
+    static constexpr uint8_t kMaxEventsPerSweep = 32;
+    static constexpr uint8_t kFallShift = 2;   // floor follows quieter readings at 1/4 per sweep
+    static constexpr uint8_t kRiseShift = 5;   // and louder unflagged ones at 1/32
+
+    void configure(int16_t thresholdCdb, uint8_t guardBins, uint8_t trainBins, uint8_t minBins) {
+        _thresholdCdb = thresholdCdb;
+        _guardBins = guardBins;
+        _trainBins = trainBins > 0 ? trainBins : 1;
+        _minBins = minBins > 0 ? minBins : 1;
+    }
+
+    void reset() {
+        _binCount = 0;
+        _sweeps = 0;
+    }
+
+    // Flags bins of one sweep and writes up to maxEvents events (seq left 0).
+    // binUs[i] is the read time of bin i after the sweep start.
+    uint8_t detect(const SweepHeader& sweep, const int16_t* live, const uint32_t* binUs,
+                   SpectrumEvent* events, uint8_t maxEvents) {
+        uint16_t n = sweep.binCount > kSweepMaxBins ? kSweepMaxBins : sweep.binCount;
+        if (n != _binCount || _sweeps == 0) {
+            // First sweep of a geometry only seeds the floor.
+            _binCount = n;
+            for (uint16_t i = 0; i < n; ++i) _floorQ4[i] = (int32_t)live[i] << 4;
+            _sweeps = 1;
+            _flaggedBins = 0;
+            return 0;
+        }
+
+        // Prefix sums of the floor for O(1) training windows.
+        _prefix[0] = 0;
+        for (uint16_t i = 0; i < n; ++i) _prefix[i + 1] = _prefix[i] + (_floorQ4[i] >> 4);
+
+        _flaggedBins = 0;
+        for (uint16_t i = 0; i < n; ++i) {
+            int32_t sum = 0;
+            int32_t cells = 0;
+            int32_t lo = (int32_t)i - _guardBins - _trainBins;
+            int32_t hi = (int32_t)i - _guardBins;             // exclusive
+            if (lo < 0) lo = 0;
+            if (hi > lo) {
+                sum += _prefix[hi] - _prefix[lo];
+                cells += hi - lo;
+            }
+            lo = (int32_t)i + _guardBins + 1;
+            hi = (int32_t)i + _guardBins + 1 + _trainBins;
+            if (hi > n) hi = n;
+            if (hi > lo) {
+                sum += _prefix[hi] - _prefix[lo];
+                cells += hi - lo;
+            }
+            int32_t reference = cells > 0 ? sum / cells : (_floorQ4[i] >> 4);
+            _reference[i] = (int16_t)reference;
+            _flagged[i] = live[i] > reference + _thresholdCdb;
+            _flaggedBins += _flagged[i];
+        }
+
+        uint8_t count = 0;
+        for (uint16_t i = 0; i < n && count < maxEvents; ++i) {
+            if (!_flagged[i]) continue;
+            uint16_t end = i;
+            uint16_t peakBin = i;
+            int64_t weightSum = 0;
+            int64_t weightedBin = 0;
+            while (end < n && _flagged[end]) {
+                if (live[end] > live[peakBin]) peakBin = end;
+                int32_t excess = live[end] - _reference[end];
+                weightSum += excess;
+                weightedBin += (int64_t)excess * end;
+                end++;
+            }
+            if (end - i >= _minBins) {
+                SpectrumEvent& e = events[count++];
+                float centroid = weightSum > 0 ? (float)weightedBin / (float)weightSum : (i + end - 1) / 2.0f;
+                e.seq = 0;
+                e.sweepSeq = sweep.seq;
+                e.epoch = sweep.epoch;
+                e.peakUs = (uint32_t)(sweep.startOffsetUs + (int32_t)(binUs ? binUs[peakBin] : 0));
+                e.centerMhz = sweep.startMhz + sweep.stepMhz * centroid;
+                e.widthKhz = sweep.stepMhz * 1000.0f * (end - i);
+                e.peakCdb = live[peakBin];
+                e.referenceCdb = _reference[peakBin];
+                e.firstBin = i;
+                e.binCount = (uint16_t)(end - i);
+            }
+            i = end;
+        }
+
+        for (uint16_t i = 0; i < n; ++i) {
+            int32_t x = (int32_t)live[i] << 4;
+            int32_t& f = _floorQ4[i];
+            if (x < f) {
+                f += (x - f) >> kFallShift;
+            } else if (!_flagged[i]) {
+                f += (x - f) >> kRiseShift;
+            }
+        }
+        if (_sweeps < 0xFFFF) _sweeps++;
+        return count;
+    }
+
+    int16_t floorCdb(uint16_t bin) const { return bin < _binCount ? (int16_t)(_floorQ4[bin] >> 4) : 0; }
+    uint16_t binCount() const { return _binCount; }
+    uint16_t flaggedBins() const { return _flaggedBins; }
+    uint16_t sweeps() const { return _sweeps; }
+    int16_t thresholdCdb() const { return _thresholdCdb; }
+    uint8_t guardBins() const { return _guardBins; }
+    uint8_t trainBins() const { return _trainBins; }
+    uint8_t minBins() const { return _minBins; }
+
+private:
+    int32_t _floorQ4[kSweepMaxBins];
+    int32_t _prefix[kSweepMaxBins + 1];
+    int16_t _reference[kSweepMaxBins];
+    bool _flagged[kSweepMaxBins];
+    uint16_t _binCount = 0;
+    uint16_t _sweeps = 0;
+    uint16_t _flaggedBins = 0;
+    int16_t _thresholdCdb = kDefaultThresholdCdb;
+    uint8_t _guardBins = kDefaultGuardBins;
+    uint8_t _trainBins = kDefaultTrainBins;
+    uint8_t _minBins = 1;
+};
+
+// Ring of recent events: single writer (plugin task), readers on the web task.
+class SpectrumEventLog {
+public:
+    static constexpr uint16_t kCapacity = 128;
+
+    SpectrumEventLog() { _mutex = xSemaphoreCreateMutex(); }
+
+    // Assigns sequence numbers and stores the events. Drops them (counted) if a reader holds the lock.
+    void append(SpectrumEvent* events, uint8_t count) {
+        if (count == 0) return;
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) {
+            _dropped += count;
+            _nextSeq += count;
+            return;
+        }
+        for (uint8_t i = 0; i < count; ++i) {
+            events[i].seq = ++_nextSeq;
+            _events[_head] = events[i];
+            _head = (uint16_t)((_head + 1) % kCapacity);
+            if (_count < kCapacity) _count++;
+        }
+        xSemaphoreGive(_mutex);
+    }
+
+    // Copies events with seq > sinceSeq, oldest first, up to maxCount. Returns the number copied.
+    uint16_t copySince(uint32_t sinceSeq, SpectrumEvent* out, uint16_t maxCount) {
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return 0;
+        uint16_t copied = 0;
+        for (uint16_t k = 0; k < _count && copied < maxCount; ++k) {
+            const SpectrumEvent& e = _events[(_head + kCapacity - _count + k) % kCapacity];
+            if (e.seq > sinceSeq) out[copied++] = e;
+        }
+        xSemaphoreGive(_mutex);
+        return copied;
+    }
+
+    void clear() {
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+        _head = 0;
+        _count = 0;
+        xSemaphoreGive(_mutex);
+    }
+
+    uint32_t lastSeq() const { return _nextSeq; }
+    uint32_t dropped() const { return _dropped; }
+
+private:
+    SpectrumEvent _events[kCapacity];
+    uint16_t _head = 0;
+    uint16_t _count = 0;
+    uint32_t _nextSeq = 0;
+    uint32_t _dropped = 0;
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef SPECTRUMFRAME_H
+#define SPECTRUMFRAME_H
+
+#include <Arduino.h>
+#include "SweepSnapshot.h"
+
+// Compact binary sweep frame served by GET /api/spectrum/frame.
+//
+// All fields little-endian, 36-byte header followed by bin_count bins:
+//   0  char[4] magic      "ASEF"
+//   4  u8      version    kSpectrumFrameVersion
+//   5  u8      bin_format SPECTRUM_BINS_INT8 (dBm, 1 dB) | SPECTRUM_BINS_INT16 (0.01 dB)
+//   6  u16     bin_count
+//   8  u8[6]   node_id    WiFi STA MAC
+//   14 u16     sweep_seq  wraps at 65536
+//   16 u32     epoch      UTC seconds of the sweep slot
+//   20 u32     start_khz  centre of bin 0
+//   24 u32     step_hz    bin spacing; wider than the requested step when the
+//                         range needs more than FastHopEngine::kMaxBins bins
+//   28 u8      channel    SweepChannel: live, max/min hold, average, occupancy,
+//                         sample max, sample variance
+//   29 u8      flags      SPECTRUM_FRAME_TIMES: bin times follow the bins
+//   30 u16     accumulated  sweeps folded into the hold/average/occupancy channels
+//   32 i32     start_offset_us  measured sweep start minus the slot boundary
+//   36 bins    int8 or int16 per bin (dBm; occupancy in percent, variance in dB^2)
+//   .. times   with SPECTRUM_FRAME_TIMES: bin_count x u32, RSSI read time of
+//              each bin in us after the sweep start
+//
+// Version 1 frames had no channel/accumulated fields (28-byte header, live
+// only); version 2 had no timing (32-byte header, byte 29 reserved).
+// Encoded without ArduinoJson; a 53-bin int8 sweep is 89 bytes versus
+// ~1.9 KB for the same bins as /api/report JSON points.
+
+enum SpectrumBinFormat : uint8_t {
+    SPECTRUM_BINS_INT8 = 1,
+    SPECTRUM_BINS_INT16 = 2
+};
+
+enum SpectrumFrameFlags : uint8_t {
+    SPECTRUM_FRAME_TIMES = 0x01
+};
+
+static constexpr uint8_t kSpectrumFrameVersion = 3;
+static constexpr size_t kSpectrumFrameHeaderBytes = 36;
+static constexpr uint16_t kSpectrumFrameMaxBins = kSweepMaxBins;
+static constexpr size_t kSpectrumFrameMaxBytes = kSpectrumFrameHeaderBytes + (2 + 4) * kSpectrumFrameMaxBins;
+
+struct SpectrumFrameInfo {
+    uint8_t nodeId[6];
+    uint16_t sweepSeq;
+    uint32_t epoch;
+    uint32_t startKhz;
+    uint32_t stepHz;
+    uint8_t channel;
+    uint16_t accumulated;
+    int32_t startOffsetUs;
+};
+
+inline size_t spectrumFrameSize(uint16_t binCount, uint8_t binFormat, bool withTimes = false) {
+    return kSpectrumFrameHeaderBytes + (size_t)binCount * ((binFormat == SPECTRUM_BINS_INT16 ? 2 : 1) + (withTimes ? 4 : 0));
+}
+
+inline uint8_t* spectrumFramePut16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+inline uint8_t* spectrumFramePut32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+// Writes a complete frame from centi-unit bins, with per-bin times when binUs is
+// given. Returns bytes written, or 0 if capacity is too small.
+inline size_t spectrumFrameEncode(uint8_t* out, size_t capacity, const SpectrumFrameInfo& info,
+                                  const int16_t* cdb, uint16_t binCount, uint8_t binFormat,
+                                  const uint32_t* binUs = nullptr) {
+    if (binFormat != SPECTRUM_BINS_INT16) binFormat = SPECTRUM_BINS_INT8;
+    size_t total = spectrumFrameSize(binCount, binFormat, binUs != nullptr);
+    if (!out || capacity < total) return 0;
+
+    uint8_t* p = out;
+    *p++ = 'A';
+    *p++ = 'S';
+    *p++ = 'E';
+    *p++ = 'F';
+    *p++ = kSpectrumFrameVersion;
+    *p++ = binFormat;
+    p = spectrumFramePut16(p, binCount);
+    memcpy(p, info.nodeId, 6);
+    p += 6;
+    p = spectrumFramePut16(p, info.sweepSeq);
+    p = spectrumFramePut32(p, info.epoch);
+    p = spectrumFramePut32(p, info.startKhz);
+    p = spectrumFramePut32(p, info.stepHz);
+    *p++ = info.channel;
+    *p++ = binUs ? SPECTRUM_FRAME_TIMES : 0;
+    p = spectrumFramePut16(p, info.accumulated);
+    p = spectrumFramePut32(p, (uint32_t)info.startOffsetUs);
+
+    if (binFormat == SPECTRUM_BINS_INT16) {
+        for (uint16_t i = 0; i < binCount; ++i) p = spectrumFramePut16(p, (uint16_t)cdb[i]);
+    } else {
+        for (uint16_t i = 0; i < binCount; ++i) *p++ = (uint8_t)sweepCdbToInt8(cdb[i]);
+    }
+    if (binUs) {
+        for (uint16_t i = 0; i < binCount; ++i) p = spectrumFramePut32(p, binUs[i]);
+    }
+    return total;
+}
+
+#endif
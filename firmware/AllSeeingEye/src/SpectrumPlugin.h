@@ -2,16 +2,32 @@
 #define SPECTRUMPLUGIN_H
 
 #include "ASEPlugin.h"
+#include "FastHopEngine.h"
 #include "HAL.h"
 #include "Kernel.h"
 #include "Logger.h"
+#include "SpectrumAccumulator.h"
+#include "SpectrumDetector.h"
+#include "SpectrumFrame.h"
+#include "SweepSnapshot.h"
+#include "SweepTrigger.h"
+#include "WaterfallStore.h"
+#include <esp_mac.h>
+#include <algorithm>
+
+static_assert(FastHopEngine::kMaxBins <= kSweepMaxBins, "sweep snapshot must hold every hop bin");
 
 class SpectrumPlugin : public ASEPlugin {
 public:
+    static constexpr uint32_t kSweepPeriodSec = 10;
+
     void setup() override {
         Logger::instance().info("Spectrum", "Setup: Sweeping...");
         _lastLoopMs = 0;
         _iterations = 0;
+        if (!_trigger.begin()) {
+            Logger::instance().error("Spectrum", "Sweep trigger timer unavailable");
+        }
         resetSweepState();
     }
     
@@ -27,40 +43,71 @@ public:
             return;
         }
 
-        time_t epoch = Kernel::instance().getEpochTime();
-        if (epoch <= 0) {
+        if (!_engine.begin(HAL::instance().getRadioSPI(), HAL::instance().getRadioCsPin())) {
             vTaskDelay(pdMS_TO_TICKS(200));
             return;
         }
+        // Calibrate between slots so it never delays a triggered sweep.
+        if (_engine.needsRecalibration(millis()) && !recalibrate()) return;
 
-        if ((epoch % 10) != 0 || _lastSweepEpoch == static_cast<uint32_t>(epoch)) {
-            vTaskDelay(pdMS_TO_TICKS(50));
-            return;
-        }
-
-        _lastSweepEpoch = static_cast<uint32_t>(epoch);
-        Logger::instance().info("Spectrum", "Synchronized sweep at UTC %lu", _lastSweepEpoch);
+        SweepTriggerSlot slot;
+        if (!_trigger.wait(kSweepPeriodSec, _lastSweepEpoch, slot)) return;
+        _lastSweepEpoch = slot.epoch;
 
-        for (float freq = _startMhz; freq <= _stopMhz; freq += _stepMhz) {
-            int state = radio->setFrequency(freq);
-            if (state != RADIOLIB_ERR_NONE) {
-                if (millis() - _lastErrorLogMs > 5000) {
-                    Logger::instance().error("Spectrum", "Set Freq Failed: %d", state);
-                    _lastErrorLogMs = millis();
-                }
-                break;
-            }
+        // Fill the back buffer in place; readers keep seeing the previous sweep.
+        SweepSlot& sweep = _snapshot.beginWrite();
+        sweep.seq = _iterations + 1;
+        sweep.epoch = _lastSweepEpoch;
+        sweep.startOffsetUs = slot.startOffsetUs;
+        sweep.startMhz = _engine.binFrequencyMhz(0);
+        sweep.stepMhz = _engine.stepMhz();
+        sweep.binCount = _engine.binCount();
+        int16_t* live = sweep.cdb[SWEEP_CHANNEL_LIVE];
+        int16_t* peak = sweep.cdb[SWEEP_CHANNEL_SAMPLE_MAX];
+        int16_t* variance = sweep.cdb[SWEEP_CHANNEL_SAMPLE_VARIANCE];
+        FastHopEngine::RssiStats stats;
+        unsigned long sweepStartUs = micros();
+        _sweepStartUs = sweepStartUs;
+        for (uint16_t bin = 0; bin < sweep.binCount; ++bin) {
+            _engine.measureSamples(bin, _samplesPerBin, stats);
+            sweep.binUs[bin] = micros() - sweepStartUs;
+            live[bin] = sweepFloatToCdb(stats.meanDbm);
+            peak[bin] = sweepFloatToCdb(stats.maxDbm);
+            variance[bin] = sweepFloatToCdb(stats.varianceDb2);
+        }
+        _engine.idle();
+        sweep.durationUs = micros() - sweepStartUs;
+        sweep.detail.seq = sweep.seq;
+        sweep.detail.segmentCount = 0;
+        sweep.detail.binCount = 0;
+        if (_adaptive) {
+            runDetailPass(sweep);
+            sweep.durationUs += sweep.detail.durationUs;
+        }
 
-            float rssi = radio->getRSSI();
-            storePoint(freq, rssi);
-            vTaskDelay(pdMS_TO_TICKS(5));
+        if (_holdSeconds > 0 && _accumulator.sweeps() > 0 && _lastSweepEpoch - _holdStartEpoch >= _holdSeconds) {
+            _accumulator.reset();
         }
+        if (_accumulator.sweeps() == 0) _holdStartEpoch = _lastSweepEpoch;
+        _accumulator.update(live, sweep.binCount);
+        _accumulator.exportTo(sweep);
+        _lastEventCount = _detector.detect(sweep, live, sweep.binUs, _sweepEvents, SpectrumDetector::kMaxEventsPerSweep);
+        _events.append(_sweepEvents, _lastEventCount);
+        _snapshot.publish();
+        WaterfallStore::instance().append(sweep.epoch, sweep.startMhz, sweep.stepMhz, live, sweep.binCount);
+        Logger::instance().info("Spectrum", "Synchronized sweep at UTC %lu (start %+ld us, %lu us)",
+                                (unsigned long)sweep.epoch, (long)sweep.startOffsetUs, (unsigned long)sweep.durationUs);
 
         _currentFreqMhz = _startMhz;
         _iterations++;
+
+        // Recalibrate now if it would fall due before the next slot.
+        if (_engine.needsRecalibration(millis() + kSweepPeriodSec * 1000UL)) recalibrate();
     }
     
     void teardown() override {
+        _engine.end();
+        _trigger.end();
         Logger::instance().info("Spectrum", "Teardown");
     }
 
@@ -79,6 +126,31 @@ public:
         if (params.containsKey("power")) {
             _powerDbm = params["power"].as<float>();
         }
+        _samplesPerBin = params.containsKey("samples") ? params["samples"].as<uint8_t>() : 1;
+        if (_samplesPerBin < 1) _samplesPerBin = 1;
+        if (_samplesPerBin > FastHopEngine::kMaxSamples) _samplesPerBin = FastHopEngine::kMaxSamples;
+        _adaptive = taskId.startsWith("spectrum/adaptive") ||
+                    (params.containsKey("adaptive") && params["adaptive"].as<bool>());
+        if (params.containsKey("coarse_bandwidth")) {
+            _coarseBandwidthKHz = params["coarse_bandwidth"].as<float>();
+        }
+        if (params.containsKey("threshold_db")) {
+            _thresholdCdb = sweepFloatToCdb(params["threshold_db"].as<float>());
+        }
+        _primaryChannel = taskId.startsWith("spectrum/peak") ? SWEEP_CHANNEL_MAX_HOLD : SWEEP_CHANNEL_LIVE;
+        _detectTask = taskId.startsWith("spectrum/detect");
+        float detectDb = params.containsKey("detect_db") ? params["detect_db"].as<float>()
+                                                         : SpectrumDetector::kDefaultThresholdCdb / 100.0f;
+        _detector.configure(sweepFloatToCdb(detectDb),
+                            params.containsKey("guard_bins") ? params["guard_bins"].as<uint8_t>() : SpectrumDetector::kDefaultGuardBins,
+                            params.containsKey("train_bins") ? params["train_bins"].as<uint8_t>() : SpectrumDetector::kDefaultTrainBins,
+                            params.containsKey("min_bins") ? params["min_bins"].as<uint8_t>() : 1);
+        _holdSeconds = params.containsKey("duration") ? params["duration"].as<uint32_t>() : 0;
+        float occupancyDbm = params.containsKey("occupancy_dbm") ? params["occupancy_dbm"].as<float>()
+                                                                 : SpectrumAccumulator::kDefaultOccupancyCdb / 100.0f;
+        uint8_t averageShift = params.containsKey("average_shift") ? params["average_shift"].as<uint8_t>()
+                                                                   : SpectrumAccumulator::kDefaultAverageShift;
+        _accumulator.configure(sweepFloatToCdb(occupancyDbm), averageShift);
 
         if (!HAL::instance().isCc1101FrequencyRangeAllowed(_startMhz, _stopMhz)) {
             Logger::instance().warn("Spectrum", "Invalid freq range %.2f-%.2f MHz. Using defaults.", _startMhz, _stopMhz);
@@ -99,8 +171,35 @@ public:
         if (_bandwidthKHz > 0.0f) {
             _stepMhz = _bandwidthKHz / 1000.0f;
         }
+        uint32_t bins = (uint32_t)((_stopMhz - _startMhz) / _stepMhz + 0.001f) + 1;
+        if (!_adaptive && bins > FastHopEngine::kMaxBins) {
+            // The hop table holds kMaxBins bins: cover the whole range with a wider step
+            float widened = (_stopMhz - _startMhz) / (float)(FastHopEngine::kMaxBins - 1);
+            Logger::instance().warn("Spectrum", "%.2f-%.2f MHz needs more than %u bins at %.3f MHz: step %.3f MHz",
+                                    _startMhz, _stopMhz, FastHopEngine::kMaxBins, _stepMhz, widened);
+            _stepMhz = widened;
+        }
+        _tableStepMhz = _stepMhz;
+        _tableBandwidthKHz = _bandwidthKHz;
+        if (_adaptive) {
+            // Coarse pass: widest filter, and never more bins than the hop table holds.
+            if (!HAL::instance().isCc1101BandwidthAllowed(_coarseBandwidthKHz) || _coarseBandwidthKHz < _bandwidthKHz) {
+                _coarseBandwidthKHz = HAL::kCc1101MaxBandwidthKhz;
+            }
+            _tableBandwidthKHz = _coarseBandwidthKHz;
+            _tableStepMhz = std::max(_coarseBandwidthKHz / 1000.0f,
+                                     (_stopMhz - _startMhz) / (float)(FastHopEngine::kMaxBins - 1));
+            Logger::instance().info("Spectrum", "Adaptive: coarse %.3f MHz @ %.0f kHz, detail %.3f MHz, +%.1f dB over floor",
+                                    _tableStepMhz, _tableBandwidthKHz, _stepMhz, _thresholdCdb / 100.0f);
+        }
         Logger::instance().info("Spectrum", "Sweep %.2f-%.2f MHz", _startMhz, _stopMhz);
-        Logger::instance().info("Spectrum", "Bandwidth %.2f kHz | Power %.1f dBm", _bandwidthKHz, _powerDbm);
+        Logger::instance().info("Spectrum", "Bandwidth %.2f kHz | Power %.1f dBm | %u samples/bin",
+                                _bandwidthKHz, _powerDbm, _samplesPerBin);
+        Logger::instance().info("Spectrum", "Channel %s | Hold %lu s | Occupancy >= %.1f dBm",
+                                sweepChannelName(_primaryChannel), (unsigned long)_holdSeconds, occupancyDbm);
+        Logger::instance().info("Spectrum", "Detect +%.1f dB over CFAR (guard %u, train %u, min %u bins)%s",
+                                _detector.thresholdCdb() / 100.0f, _detector.guardBins(), _detector.trainBins(),
+                                _detector.minBins(), _detectTask ? " | events only" : "");
         resetSweepState();
     }
 
@@ -111,23 +210,157 @@ public:
         report["bandwidth_khz"] = _bandwidthKHz;
         report["power_dbm"] = _powerDbm;
         report["step_mhz"] = _stepMhz;
-        report["points_count"] = _pointCount;
-        report["points_max"] = kMaxPoints;
+        SweepData sweep;
+        if (!_snapshot.read(sweep, _primaryChannel)) {
+            sweep.seq = 0;
+            sweep.epoch = 0;
+            sweep.durationUs = 0;
+            sweep.binCount = 0;
+            sweep.accumulated = 0;
+        }
+        report["points_count"] = sweep.binCount;
+        report["points_max"] = kSweepMaxBins;
+        report["sweep_seq"] = sweep.seq;
+        report["sweep_epoch"] = sweep.epoch;
+        report["sweep_start_offset_us"] = sweep.startOffsetUs;
+        report["channel"] = sweepChannelName(_primaryChannel);
+        SweepTimes times;
+        bool haveTimes = _snapshot.readTimes(times) && times.seq == sweep.seq && times.binCount == sweep.binCount;
+        // spectrum/detect ships events instead of spectra.
+        uint16_t pointCount = _detectTask ? 0 : sweep.binCount;
         JsonArray points = report.createNestedArray("points");
-        for (uint16_t i = 0; i < _pointCount; ++i) {
-            uint16_t idx = (_pointIndex + kMaxPoints - _pointCount + i) % kMaxPoints;
+        for (uint16_t i = 0; i < pointCount; ++i) {
             JsonObject point = points.add<JsonObject>();
-            point["freq_mhz"] = _freqMhz[idx];
-            point["rssi_dbm"] = _rssiDbm[idx];
+            point["freq_mhz"] = sweep.binFrequencyMhz(i);
+            point["rssi_dbm"] = sweep.value(i);
+            if (haveTimes) point["t_us"] = times.binUs[i];
+        }
+        SweepHeader primary = sweep;
+        report["accumulated_sweeps"] = primary.accumulated;
+        report["hold_seconds"] = _holdSeconds;
+        report["occupancy_threshold_dbm"] = _accumulator.occupancyCdb() / 100.0f;
+        report["average_alpha"] = 1.0f / (float)(1u << _accumulator.averageShift());
+        JsonObject channels = report.createNestedObject("channels");
+        // Sample max/variance carry nothing beyond the live sweep with one sample per bin.
+        uint8_t channelEnd = _samplesPerBin > 1 ? kSweepChannels : (uint8_t)SWEEP_CHANNEL_SAMPLE_MAX;
+        for (uint8_t channel = SWEEP_CHANNEL_MAX_HOLD; channel < channelEnd && pointCount > 0; ++channel) {
+            // Every channel must come from the same sweep as points.
+            if (!_snapshot.read(sweep, channel) || sweep.seq != primary.seq) break;
+            JsonArray values = channels.createNestedArray(sweepChannelName(channel));
+            for (uint16_t i = 0; i < sweep.binCount; ++i) {
+                values.add(sweep.value(i));
+            }
         }
         report["iterations"] = _iterations;
         report["last_loop_ms"] = _lastLoopMs;
+        SweepDetail detail;
+        if (!_snapshot.readDetail(detail) || detail.seq != primary.seq) {
+            detail.binCount = 0;
+            detail.segmentCount = 0;
+        }
+        uint32_t hops = (uint32_t)primary.binCount + detail.binCount;
+        report["bins_per_sec"] = primary.durationUs > 0 ? (float)hops * 1000000.0f / (float)primary.durationUs : 0.0f;
+        report["sweep_duration_us"] = primary.durationUs;
+        report["rx_bandwidth_khz"] = _engine.rxBandwidthKhz();
+        report["hop_settle_us"] = _engine.settleUs();
+        report["samples_per_bin"] = _samplesPerBin;
+        report["sample_interval_us"] = _engine.sampleIntervalUs();
+        JsonObject trigger = report.createNestedObject("trigger");
+        trigger["period_s"] = kSweepPeriodSec;
+        trigger["fired"] = _trigger.fired();
+        trigger["late"] = _trigger.late();
+        trigger["missed"] = _trigger.missed();
+        if (_adaptive) {
+            JsonObject adaptive = report.createNestedObject("adaptive");
+            adaptive["coarse_step_mhz"] = _tableStepMhz;
+            adaptive["coarse_rx_bandwidth_khz"] = _engine.rxBandwidthKhz();
+            adaptive["detail_step_mhz"] = detail.stepMhz;
+            adaptive["detail_rx_bandwidth_khz"] = detail.rxBandwidthKhz;
+            adaptive["noise_floor_dbm"] = detail.noiseFloorCdb / 100.0f;
+            adaptive["threshold_dbm"] = detail.thresholdCdb / 100.0f;
+            adaptive["flagged_bins"] = detail.flaggedBins;
+            adaptive["dropped_bins"] = detail.droppedBins;
+            adaptive["detail_bins"] = detail.binCount;
+            adaptive["detail_calibrations"] = detail.calibrations;
+            adaptive["coarse_us"] = primary.durationUs - detail.durationUs;
+            adaptive["detail_us"] = detail.durationUs;
+            adaptive["full_detail_sweep_us"] = detail.fullSweepEstimateUs;
+            adaptive["time_saved_pct"] = detail.fullSweepEstimateUs > primary.durationUs
+                ? 100.0f * (1.0f - (float)primary.durationUs / (float)detail.fullSweepEstimateUs) : 0.0f;
+            JsonArray segments = adaptive.createNestedArray("segments");
+            for (uint8_t i = 0; i < detail.segmentCount; ++i) {
+                const SweepSegment& seg = detail.segments[i];
+                JsonObject segment = segments.add<JsonObject>();
+                segment["start_mhz"] = seg.startMhz;
+                segment["step_mhz"] = detail.stepMhz;
+                segment["first_t_us"] = seg.firstUs;
+                segment["last_t_us"] = seg.lastUs;
+                JsonArray rssi = segment.createNestedArray("rssi_dbm");
+                for (uint16_t b = 0; b < seg.count && seg.offset + b < detail.binCount; ++b) {
+                    rssi.add(detail.cdb[seg.offset + b] / 100.0f);
+                }
+            }
+        }
+        JsonObject detection = report.createNestedObject("detection");
+        detection["threshold_db"] = _detector.thresholdCdb() / 100.0f;
+        detection["guard_bins"] = _detector.guardBins();
+        detection["train_bins"] = _detector.trainBins();
+        detection["min_bins"] = _detector.minBins();
+        detection["flagged_bins"] = _detector.flaggedBins();
+        detection["last_event_seq"] = _events.lastSeq();
+        detection["dropped_events"] = _events.dropped();
+        // Events of the reported sweep.
+        JsonArray sweepEvents = detection.createNestedArray("events");
+        SpectrumEvent recent[SpectrumDetector::kMaxEventsPerSweep];
+        uint32_t since = _events.lastSeq() > SpectrumDetector::kMaxEventsPerSweep
+            ? _events.lastSeq() - SpectrumDetector::kMaxEventsPerSweep : 0;
+        uint16_t recentCount = _events.copySince(since, recent, SpectrumDetector::kMaxEventsPerSweep);
+        for (uint16_t i = 0; i < recentCount; ++i) {
+            if (recent[i].sweepSeq == primary.seq) writeEvent(sweepEvents.add<JsonObject>(), recent[i]);
+        }
+        WaterfallInfo history = WaterfallStore::instance().info();
+        JsonObject waterfall = report.createNestedObject("waterfall");
+        waterfall["rows"] = history.rows;
+        waterfall["capacity"] = history.capacity;
+        waterfall["oldest_epoch"] = history.oldestEpoch;
+        waterfall["newest_epoch"] = history.newestEpoch;
         return true;
     }
 
-private:
-    static constexpr uint16_t kMaxPoints = 255;
+    bool getSpectrumEvents(JsonObject out, uint32_t sinceSeq) override {
+        SpectrumEvent events[SpectrumDetector::kMaxEventsPerSweep];
+        uint16_t count = _events.copySince(sinceSeq, events, SpectrumDetector::kMaxEventsPerSweep);
+        out["last_seq"] = count > 0 ? events[count - 1].seq : _events.lastSeq();
+        out["dropped"] = _events.dropped();
+        out["more"] = count > 0 && events[count - 1].seq < _events.lastSeq();
+        JsonArray list = out.createNestedArray("events");
+        for (uint16_t i = 0; i < count; ++i) writeEvent(list.add<JsonObject>(), events[i]);
+        return true;
+    }
+
+    size_t getSpectrumFrame(uint8_t* out, size_t capacity, uint8_t binFormat, int channel, bool withTimes) override {
+        SweepData sweep;
+        uint8_t selected = (channel < 0 || channel >= kSweepChannels) ? _primaryChannel : (uint8_t)channel;
+        if (!_snapshot.read(sweep, selected) || sweep.binCount == 0) return 0;
+        SweepTimes times;
+        if (withTimes && (!_snapshot.readTimes(times) || times.seq != sweep.seq || times.binCount != sweep.binCount)) {
+            return 0;
+        }
 
+        SpectrumFrameInfo info;
+        esp_read_mac(info.nodeId, ESP_MAC_WIFI_STA);
+        info.sweepSeq = static_cast<uint16_t>(sweep.seq);
+        info.epoch = sweep.epoch;
+        info.startKhz = static_cast<uint32_t>(lroundf(sweep.startMhz * 1000.0f));
+        info.stepHz = static_cast<uint32_t>(lroundf(sweep.stepMhz * 1000000.0f));
+        info.channel = sweep.channel;
+        info.accumulated = static_cast<uint16_t>(sweep.accumulated);
+        info.startOffsetUs = sweep.startOffsetUs;
+        return spectrumFrameEncode(out, capacity, info, sweep.cdb, sweep.binCount, binFormat,
+                                   withTimes ? times.binUs : nullptr);
+    }
+
+private:
     String _taskName = "Spectrum Analysis";
     float _startMhz = 0.0f;
     float _stopMhz = 0.0f;
@@ -139,26 +372,156 @@ private:
     unsigned long _lastErrorLogMs = 0;
     unsigned long _lastLoopMs = 0;
     unsigned long _iterations = 0;
-    uint16_t _pointCount = 0;
-    uint16_t _pointIndex = 0;
-    float _freqMhz[kMaxPoints] = {0};
-    float _rssiDbm[kMaxPoints] = {0};
+    uint8_t _primaryChannel = SWEEP_CHANNEL_LIVE;
+    uint8_t _samplesPerBin = 1;
+    bool _detectTask = false;
+    uint8_t _lastEventCount = 0;
+    bool _adaptive = false;
+    float _coarseBandwidthKHz = HAL::kCc1101MaxBandwidthKhz;
+    float _tableStepMhz = 0.5f;         // hop table grid (coarse grid when adaptive)
+    float _tableBandwidthKHz = 500.0f;
+    int16_t _thresholdCdb = 1000;       // detail threshold above the noise floor
+    int32_t _noiseFloorCdb = 0;
+    bool _noiseFloorValid = false;
+    int16_t _scratch[kSweepMaxBins];
+    uint8_t _order[kSweepMaxBins];
+    bool _selected[kSweepMaxBins];
+    uint32_t _holdSeconds = 0;     // accumulators restart after this many seconds (0 = never)
+    uint32_t _holdStartEpoch = 0;
+    unsigned long _sweepStartUs = 0;
+    FastHopEngine _engine;
+    SweepTrigger _trigger;
+    SpectrumAccumulator _accumulator;
+    SpectrumDetector _detector;
+    SpectrumEventLog _events;
+    SpectrumEvent _sweepEvents[SpectrumDetector::kMaxEventsPerSweep];
+    SweepSnapshot _snapshot;
+
+    static void writeEvent(JsonObject out, const SpectrumEvent& e) {
+        out["seq"] = e.seq;
+        out["sweep_seq"] = e.sweepSeq;
+        out["epoch"] = e.epoch;
+        out["t_us"] = e.peakUs;
+        out["center_mhz"] = e.centerMhz;
+        out["width_khz"] = e.widthKhz;
+        out["peak_dbm"] = e.peakCdb / 100.0f;
+        out["snr_db"] = (e.peakCdb - e.referenceCdb) / 100.0f;
+        out["bins"] = e.binCount;
+    }
+
+    bool recalibrate() {
+        if (_engine.prepare(_startMhz, _stopMhz, _tableStepMhz, _tableBandwidthKHz)) return true;
+        if (millis() - _lastErrorLogMs > 5000) {
+            Logger::instance().error("Spectrum", "Hop table calibration failed");
+            _lastErrorLogMs = millis();
+        }
+        return false;
+    }
+
+    // Adaptive mode: re-sweep the coarse bins that stand out above the tracked
+    // noise floor at the requested (detail) resolution, strongest first, within
+    // kSweepMaxDetailBins. Detail bins sit on the grid a full fine sweep would use.
+    void runDetailPass(SweepSlot& sweep) {
+        SweepDetail& d = sweep.detail;
+        const int16_t* live = sweep.cdb[SWEEP_CHANNEL_LIVE];
+        const uint16_t n = sweep.binCount;
+        d.stepMhz = _stepMhz;
+        d.durationUs = 0;
+        d.flaggedBins = 0;
+        d.droppedBins = 0;
+        d.calibrations = 0;
+        if (n == 0 || _stepMhz <= 0.0f) return;
+
+        // Noise floor: lower quartile of the coarse pass, smoothed across sweeps.
+        memcpy(_scratch, live, sizeof(int16_t) * n);
+        std::nth_element(_scratch, _scratch + n / 4, _scratch + n);
+        int32_t quartile = _scratch[n / 4];
+        _noiseFloorCdb = _noiseFloorValid ? _noiseFloorCdb + (quartile - _noiseFloorCdb) / 4 : quartile;
+        _noiseFloorValid = true;
+        int32_t threshold = _noiseFloorCdb + _thresholdCdb;
+        d.noiseFloorCdb = (int16_t)_noiseFloorCdb;
+        d.thresholdCdb = (int16_t)std::min<int32_t>(threshold, 32767);
+
+        uint16_t flagged = 0;
+        for (uint16_t i = 0; i < n; ++i) {
+            _selected[i] = false;
+            if (live[i] > threshold) _order[flagged++] = (uint8_t)i;
+        }
+        std::sort(_order, _order + flagged, [live](uint8_t a, uint8_t b) { return live[a] > live[b]; });
+
+        const float coarseStep = sweep.stepMhz;
+        const uint16_t perCoarse = (uint16_t)std::max(1L, lroundf(coarseStep / _stepMhz));
+        uint16_t budget = kSweepMaxDetailBins;
+        for (uint16_t k = 0; k < flagged; ++k) {
+            if (budget < perCoarse) {
+                d.droppedBins++;
+                continue;
+            }
+            _selected[_order[k]] = true;
+            budget = (uint16_t)(budget - perCoarse);
+        }
+        d.flaggedBins = flagged;
+
+        uint32_t fullBins = (uint32_t)((_stopMhz - _startMhz) / _stepMhz + 0.001f) + 1;
+        uint32_t coarseUs = sweep.durationUs;
+        if (flagged == 0 || flagged == d.droppedBins) {
+            // Nothing to refine; estimate a detail hop from the coarse one.
+            uint32_t perHop = coarseUs / n - _engine.settleUs() + _engine.settleUsFor(_bandwidthKHz);
+            d.fullSweepEstimateUs = (uint32_t)std::min<uint64_t>((uint64_t)fullBins * perHop, 0xFFFFFFFFULL);
+            d.rxBandwidthKhz = 0.0f;
+            return;
+        }
+
+        _engine.beginDetail(_bandwidthKHz);
+        d.rxBandwidthKhz = _engine.detailRxBandwidthKhz();
+        unsigned long detailStartUs = micros();
+        for (uint16_t i = 0; i < n; ++i) {
+            if (!_selected[i] || (i > 0 && _selected[i - 1])) continue;
+            uint16_t end = i;
+            while (end < n && _selected[end]) end++;
+            if (d.segmentCount >= kSweepMaxDetailSegments) {
+                d.droppedBins = (uint16_t)(d.droppedBins + (end - i));
+                continue;
+            }
+
+            // Fine-grid indices covering coarse bins [i, end).
+            float lo = std::max(_startMhz, sweep.binFrequencyMhz(i) - coarseStep / 2.0f);
+            float hi = std::min(_stopMhz, sweep.binFrequencyMhz(end - 1) + coarseStep / 2.0f);
+            uint32_t first = (uint32_t)ceilf((lo - _startMhz) / _stepMhz - 0.001f);
+            uint32_t last = (uint32_t)floorf((hi - _startMhz) / _stepMhz + 0.001f);
+            if (last < first) continue;
+            uint32_t count = std::min<uint32_t>(last - first + 1, (uint32_t)(kSweepMaxDetailBins - d.binCount));
+            if (count == 0) break;
+
+            SweepSegment& seg = d.segments[d.segmentCount++];
+            seg.startMhz = _startMhz + _stepMhz * first;
+            seg.offset = d.binCount;
+            seg.count = (uint16_t)count;
+            for (uint32_t k = 0; k < count; ++k) {
+                d.cdb[d.binCount++] = sweepFloatToCdb(_engine.measureAt(seg.startMhz + _stepMhz * k));
+                seg.lastUs = micros() - _sweepStartUs;
+                if (k == 0) seg.firstUs = seg.lastUs;
+            }
+        }
+        _engine.endDetail();
+        d.durationUs = micros() - detailStartUs;
+        d.calibrations = (uint16_t)_engine.detailCalibrations();
+
+        uint32_t perHop = d.binCount > 0 ? d.durationUs / d.binCount : 0;
+        d.fullSweepEstimateUs = (uint32_t)std::min<uint64_t>((uint64_t)fullBins * perHop, 0xFFFFFFFFULL);
+    }
 
     void resetSweepState() {
-        _pointCount = 0;
-        _pointIndex = 0;
         _currentFreqMhz = _startMhz;
         _lastErrorLogMs = 0;
         _iterations = 0;
-    }
-
-    void storePoint(float freqMhz, float rssiDbm) {
-        _freqMhz[_pointIndex] = freqMhz;
-        _rssiDbm[_pointIndex] = rssiDbm;
-        _pointIndex = (_pointIndex + 1) % kMaxPoints;
-        if (_pointCount < kMaxPoints) {
-            _pointCount++;
-        }
+        _snapshot.clear();
+        _accumulator.reset();
+        _detector.reset();
+        _events.clear();
+        _lastEventCount = 0;
+        _noiseFloorValid = false;
+        _engine.invalidate();
     }
 };
 
@@ -0,0 +1,177 @@
+#include "StatusBuilder.h"
+#include "JsonStream.h"
+#include <utility>
+
+StatusBuilder::StatusBuilder() {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void StatusBuilder::addSection(const char* name, VersionFn version, uint32_t maxAgeMs, WriteFn write, bool push) {
+    Section s;
+    s.name = name;
+    s.version = version;
+    s.maxAgeMs = maxAgeMs;
+    s.write = write;
+    s.push = push;
+    s.fragment = std::make_shared<String>();
+    _sections.push_back(s);
+}
+
+void StatusBuilder::regenerate(Section& section, uint32_t version, unsigned long now) {
+    JsonDocument doc;
+    section.write(doc.to<JsonObject>());
+    serializeJson(doc, _scratch);
+    // A rebuild for age alone often writes the same bytes: only real changes are pushed
+    if (!section.valid || _scratch != *section.fragment) {
+        // A streamed response still reading the old text keeps it
+        if (section.fragment.use_count() > 1) section.fragment = std::make_shared<String>();
+        std::swap(*section.fragment, _scratch);
+        section.changedAt = ++_generation;
+    }
+    // The version is read before writing: a change made meanwhile is picked up next build
+    section.builtVersion = version;
+    section.builtAt = now;
+    section.valid = true;
+    section.rebuilds++;
+}
+
+void StatusBuilder::refresh(unsigned long now) {
+    for (auto& s : _sections) {
+        uint32_t version = s.version ? s.version() : 0;
+        bool stale = !s.valid || version != s.builtVersion ||
+                     (s.maxAgeMs != kNoMaxAge && now - s.builtAt >= s.maxAgeMs);
+        if (stale) {
+            regenerate(s, version, now);
+            _stats.sectionsBuilt++;
+        } else {
+            _stats.sectionsReused++;
+        }
+    }
+}
+
+void StatusBuilder::appendFragment(String& out, const Section& section, bool& first) {
+    // "{}" is a section with nothing to say
+    unsigned int len = section.fragment->length();
+    if (len <= 2) return;
+    if (!first) out.concat(',');
+    out.concat(section.fragment->c_str() + 1, len - 2);
+    first = false;
+}
+
+bool StatusBuilder::build(String& out) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return false;
+    uint32_t startUs = micros();
+    refresh(millis());
+
+    out = "";
+    out.reserve(_stats.lastBytes + 64);
+    out.concat('{');
+    bool first = true;
+    for (const auto& s : _sections) appendFragment(out, s, first);
+    out.concat('}');
+
+    uint32_t elapsed = micros() - startUs;
+    _stats.builds++;
+    _stats.lastUs = elapsed;
+    if (elapsed > _stats.maxUs) _stats.maxUs = elapsed;
+    _stats.totalUs += elapsed;
+    _stats.lastBytes = out.length();
+    xSemaphoreGive(_mutex);
+    return true;
+}
+
+uint8_t StatusBuilder::streamFragment(StatusStream& stream, String& out) {
+    if (stream.closed) return JsonStream::FRAGMENT_END;
+    // Busy (LivePush, another request): the chunk is asked for again
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(20)) != pdTRUE) return JsonStream::FRAGMENT_WAIT;
+
+    if (!stream.opened) {
+        uint32_t startUs = micros();
+        refresh(millis());
+        uint32_t elapsed = micros() - startUs;
+        _stats.builds++;
+        _stats.lastUs = elapsed;
+        if (elapsed > _stats.maxUs) _stats.maxUs = elapsed;
+        _stats.totalUs += elapsed;
+        stream.opened = true;
+        out.concat('{');
+    } else {
+        // Next section with members, pinned until it has been copied out
+        while (!stream.fragment && stream.section < _sections.size()) {
+            const Section& s = _sections[stream.section];
+            if (s.fragment->length() > 2) {
+                stream.fragment = s.fragment;
+                stream.offset = 1;
+                if (!stream.first) out.concat(',');
+                stream.first = false;
+            } else {
+                stream.section++;
+            }
+        }
+        if (stream.fragment) {
+            size_t end = stream.fragment->length() - 1;
+            size_t piece = min(kStreamPieceBytes, end - stream.offset);
+            out.concat(stream.fragment->c_str() + stream.offset, piece);
+            stream.offset += piece;
+            if (stream.offset == end) {
+                stream.fragment.reset();
+                stream.section++;
+            }
+        } else {
+            out.concat('}');
+            stream.closed = true;
+            _stats.lastBytes = stream.bytes + 1;
+        }
+    }
+    stream.bytes += out.length();
+    xSemaphoreGive(_mutex);
+    return JsonStream::FRAGMENT_READY;
+}
+
+bool StatusBuilder::buildChanges(uint32_t& since, String& out, bool force) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return false;
+    refresh(millis());
+
+    bool changed = force || since == 0;
+    for (const auto& s : _sections) {
+        if (s.push && s.maxAgeMs != 0 && s.changedAt > since) changed = true;
+    }
+    if (changed) {
+        out.concat('{');
+        bool first = true;
+        for (const auto& s : _sections) {
+            if (s.push && (since == 0 || s.changedAt > since)) appendFragment(out, s, first);
+        }
+        out.concat('}');
+        since = _generation;
+    }
+    xSemaphoreGive(_mutex);
+    return changed;
+}
+
+StatusBuildStats StatusBuilder::stats() {
+    StatusBuildStats copy;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        copy = _stats;
+        xSemaphoreGive(_mutex);
+    }
+    return copy;
+}
+
+void StatusBuilder::cacheCounts(uint32_t& built, uint32_t& reused) const {
+    built = _stats.sectionsBuilt;
+    reused = _stats.sectionsReused;
+}
+
+void StatusBuilder::populateStats(JsonObject obj) {
+    // Called from a section writer during build(), with the mutex already held
+    obj["builds"] = _stats.builds;
+    obj["last_us"] = _stats.lastUs;
+    obj["avg_us"] = _stats.builds > 0 ? (uint32_t)(_stats.totalUs / _stats.builds) : 0;
+    obj["max_us"] = _stats.maxUs;
+    obj["bytes"] = _stats.lastBytes;
+    obj["rebuilt"] = _stats.sectionsBuilt;
+    obj["reused"] = _stats.sectionsReused;
+    JsonObject sections = obj["sections"].to<JsonObject>();
+    for (const auto& s : _sections) sections[s.name] = s.rebuilds;
+}
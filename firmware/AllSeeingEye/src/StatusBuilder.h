@@ -0,0 +1,110 @@
+#ifndef STATUS_BUILDER_H
+#define STATUS_BUILDER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <memory>
+#include <vector>
+
+// Incremental /api/status.
+//
+// The status document is a list of sections. Each keeps its members
+// serialized as a fragment ("key":value,...) and is regenerated only when
+// its version function returns a new value or the fragment is older than
+// the section's maxAgeMs; every other build copies the fragment. So NVS,
+// the peer table and the log ring are read when they change, not on every
+// poll. A maxAgeMs of 0 rebuilds a section on every build (uptime, heap);
+// kNoMaxAge rebuilds it only on a version change. The version function may
+// be null for a section that only ages.
+//
+// Each fragment also records the generation at which its content last
+// changed, so buildChanges() can hand a push client (LivePush.h) only the
+// sections that changed since its previous message.
+//
+// A streamed response (JsonStream.h) copies the fragments out in pieces of
+// at most kStreamPieceBytes. It pins the fragment it is in: a section
+// regenerated meanwhile gets a new String, and the pinned one is freed when
+// the response has moved on.
+//
+// Version functions are called on the web task while the builder's mutex
+// is held: they read a counter and must not block.
+
+struct StatusBuildStats {
+    uint32_t builds = 0;
+    uint32_t sectionsBuilt = 0;    // fragments regenerated
+    uint32_t sectionsReused = 0;   // fragments copied as they were
+    uint32_t lastUs = 0;           // build time of the last request
+    uint32_t maxUs = 0;
+    uint64_t totalUs = 0;
+    uint32_t lastBytes = 0;
+};
+
+// Where a streamed /api/status response is; one per response
+struct StatusStream {
+    size_t section = 0;
+    size_t offset = 0;
+    std::shared_ptr<String> fragment;   // pinned while it is copied out
+    bool opened = false;
+    bool closed = false;
+    bool first = true;
+    uint32_t bytes = 0;
+};
+
+class StatusBuilder {
+public:
+    typedef uint32_t (*VersionFn)();
+    typedef void (*WriteFn)(JsonObject obj);
+
+    static constexpr uint32_t kNoMaxAge = 0xFFFFFFFF;
+    static constexpr size_t kStreamPieceBytes = 1024;
+
+    StatusBuilder();
+
+    // Sections are emitted in the order they are added; add them all before the first build or stream.
+    // push: whether buildChanges() includes the section.
+    void addSection(const char* name, VersionFn version, uint32_t maxAgeMs, WriteFn write, bool push = true);
+
+    // Assembles the whole document into out, regenerating stale fragments first. /api/status
+    // streams it instead (streamFragment); the host benches build it whole to compare.
+    bool build(String& out);
+    // The document's next piece for a streamed response: the first regenerates stale
+    // fragments. Returns a JsonStream::Fragment.
+    uint8_t streamFragment(StatusStream& stream, String& out);
+    // Appends an object of the push sections whose content changed after generation since
+    // (all of them for 0) and advances since. Sections rebuilt on every build only ride
+    // along: without force, false (nothing appended) unless another section changed.
+    bool buildChanges(uint32_t& since, String& out, bool force);
+
+    StatusBuildStats stats();
+    // For a section writer: runs while a build holds the mutex, so it reads the stats without the mutex
+    void populateStats(JsonObject obj);
+    // For /api/metrics: two 32-bit reads, without the mutex
+    void cacheCounts(uint32_t& built, uint32_t& reused) const;
+
+private:
+    struct Section {
+        const char* name;
+        VersionFn version;
+        uint32_t maxAgeMs;
+        WriteFn write;
+        bool push;
+        std::shared_ptr<String> fragment;   // "{...}": the braces are skipped when assembling
+        uint32_t builtVersion = 0;
+        unsigned long builtAt = 0;
+        uint32_t changedAt = 0;    // generation of the last content change
+        bool valid = false;
+        uint32_t rebuilds = 0;
+    };
+
+    void refresh(unsigned long now);
+    void regenerate(Section& section, uint32_t version, unsigned long now);
+    static void appendFragment(String& out, const Section& section, bool& first);
+
+    std::vector<Section> _sections;
+    String _scratch;
+    uint32_t _generation = 0;
+    StatusBuildStats _stats;
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
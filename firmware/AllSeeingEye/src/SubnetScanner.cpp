@@ -0,0 +1,185 @@
+#include "SubnetScanner.h"
+#include "Logger.h"
+
+SubnetScanner::SubnetScanner()
+    : _generation(0), _next(0), _self(0), _gateway(0), _active(false), _openHead(0), _openCount(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+bool SubnetScanner::begin(IPAddress local, IPAddress mask, IPAddress gateway) {
+    uint32_t self = toHostOrder(local);
+    uint32_t m = toHostOrder(mask);
+    if (self == 0 || m == 0) return false;
+
+    uint32_t network = self & m;
+    uint32_t broadcast = network | ~m;
+    uint16_t prefix = (uint16_t)__builtin_popcount(m);
+    uint32_t first = network;
+    uint32_t last = broadcast;
+    if (prefix < 31) {
+        // Skip the network and broadcast addresses (RFC 3021 /31 links have neither).
+        first = network + 1;
+        last = broadcast - 1;
+    }
+    if (last - first + 1 > kMaxScanHosts) {
+        uint32_t block = self & ~(kMaxScanHosts - 1);
+        if (block > first) first = block;
+        if (block + kMaxScanHosts - 1 < last) last = block + kMaxScanHosts - 1;
+    }
+
+    uint32_t sweeps = _stats.sweeps;
+    uint32_t lastSweepMs = _stats.lastSweepMs;
+    _stats = SubnetScanStats();
+    _stats.sweeps = sweeps;
+    _stats.lastSweepMs = lastSweepMs;
+    _stats.firstHost = first;
+    _stats.lastHost = last;
+    _stats.prefixBits = prefix;
+    _stats.hosts = last - first + 1;
+    _stats.startedMs = millis();
+    _self = self;
+    _gateway = toHostOrder(gateway);
+    _next = first;
+    _active = true;
+
+    Logger::instance().info("Peers", "Subnet sweep /%u: %lu hosts (%s - %s), %u connects at a time",
+                            prefix, (unsigned long)_stats.hosts, fromHostOrder(first).toString().c_str(),
+                            fromHostOrder(last).toString().c_str(), kMaxConnects);
+    return true;
+}
+
+void SubnetScanner::loop(const std::function<bool(uint32_t)>& skip) {
+    if (!_active) return;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
+
+    uint8_t busy = 0;
+    for (uint8_t i = 0; i < kMaxConnects; ++i) {
+        Slot& s = _slots[i];
+        if (s.state == SLOT_DONE) {
+            _stats.scanned++;
+            if (s.outcome == OUTCOME_OPEN) {
+                _stats.open++;
+                if (_openCount < kOpenQueue) {
+                    _open[(_openHead + _openCount) % kOpenQueue] = s.ip;
+                    _openCount++;
+                }
+            } else if (s.outcome == OUTCOME_REFUSED) {
+                _stats.refused++;
+            } else {
+                _stats.silent++;
+            }
+            s.state = SLOT_FREE;
+        } else if (s.state == SLOT_CONNECTING) {
+            busy++;
+        }
+    }
+    xSemaphoreGive(_mutex);
+
+    // Bound the skip() checks per call so one loop pass stays short.
+    uint16_t budget = 64;
+    for (uint8_t i = 0; i < kMaxConnects && _next <= _stats.lastHost && budget > 0; ++i) {
+        if (_slots[i].state != SLOT_FREE) continue;
+        while (_next <= _stats.lastHost && budget > 0) {
+            uint32_t ip = _next++;
+            budget--;
+            if (ip == _self || ip == _gateway || skip(ip)) {
+                _stats.skipped++;
+                continue;
+            }
+            startConnect(i, ip);
+            busy++;
+            break;
+        }
+    }
+
+    if (_next > _stats.lastHost && busy == 0) {
+        _active = false;
+        _stats.sweeps++;
+        _stats.lastSweepMs = millis() - _stats.startedMs;
+        Logger::instance().info("Peers", "Subnet sweep done in %lu ms: %lu open, %lu refused, %lu silent, %lu skipped",
+                                (unsigned long)_stats.lastSweepMs, (unsigned long)_stats.open,
+                                (unsigned long)_stats.refused, (unsigned long)_stats.silent,
+                                (unsigned long)_stats.skipped);
+    }
+}
+
+bool SubnetScanner::startConnect(uint8_t index, uint32_t ip) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+    Slot& slot = _slots[index];
+    slot.generation = ++_generation;
+    slot.ip = ip;
+    slot.state = SLOT_CONNECTING;
+    slot.outcome = OUTCOME_SILENT;
+    slot.error = 0;
+    uint32_t generation = slot.generation;
+    xSemaphoreGive(_mutex);
+
+    uint32_t deadlineMs = millis() + kConnectTimeoutMs;
+    AsyncClient* client = new AsyncClient();
+    client->onConnect([this, index, generation](void*, AsyncClient* c) {
+        handleConnect(index, generation, c);
+    });
+    client->onError([this, index, generation](void*, AsyncClient*, int8_t error) {
+        handleError(index, generation, error);
+    });
+    client->onDisconnect([this, index, generation](void*, AsyncClient* c) {
+        handleDisconnect(index, generation, c);
+    });
+    client->onPoll([deadlineMs](void*, AsyncClient* c) {
+        if ((int32_t)(millis() - deadlineMs) >= 0) c->close(true);
+    });
+
+    if (!client->connect(fromHostOrder(ip), 80)) {
+        delete client;
+        if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+            if (slot.generation == generation) slot.state = SLOT_DONE;
+            xSemaphoreGive(_mutex);
+        }
+        return false;
+    }
+    return true;
+}
+
+void SubnetScanner::handleConnect(uint8_t index, uint32_t generation, AsyncClient* client) {
+    bool open = false;
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Slot& slot = _slots[index];
+    if (slot.generation == generation && slot.state == SLOT_CONNECTING) {
+        slot.outcome = OUTCOME_OPEN;
+        open = true;
+    }
+    xSemaphoreGive(_mutex);
+    // Outside the lock: close() runs onDisconnect synchronously.
+    if (open) client->close(true);
+}
+
+void SubnetScanner::handleError(uint8_t index, uint32_t generation, int8_t error) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    Slot& slot = _slots[index];
+    if (slot.generation == generation) slot.error = error;
+    xSemaphoreGive(_mutex);
+}
+
+void SubnetScanner::handleDisconnect(uint8_t index, uint32_t generation, AsyncClient* client) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        Slot& slot = _slots[index];
+        if (slot.generation == generation && slot.state == SLOT_CONNECTING) {
+            if (slot.outcome != OUTCOME_OPEN) slot.outcome = slot.error != 0 ? OUTCOME_REFUSED : OUTCOME_SILENT;
+            slot.state = SLOT_DONE;
+        }
+        xSemaphoreGive(_mutex);
+    }
+    delete client;
+}
+
+bool SubnetScanner::takeOpenHost(uint32_t& ip) {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) return false;
+    bool any = _openCount > 0;
+    if (any) {
+        ip = _open[_openHead];
+        _openHead = (uint8_t)((_openHead + 1) % kOpenQueue);
+        _openCount--;
+    }
+    xSemaphoreGive(_mutex);
+    return any;
+}
@@ -0,0 +1,102 @@
+#ifndef SUBNET_SCANNER_H
+#define SUBNET_SCANNER_H
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <WiFi.h>
+#include <functional>
+
+// Parallel TCP connect sweep of the local subnet, used by PeerManager while
+// the node has no peers.
+//
+// Up to kMaxConnects non-blocking connects to port 80 run at once. A host
+// that accepts is closed straight away and reported as open. Only open
+// hosts get the HTTP /api/status probe. Refused connects (RST) finish in
+// one round trip. Absent hosts (no ARP reply) are given up at the connect
+// deadline. The address range comes from WiFi.subnetMask(). Masks wider
+// than kMaxScanHosts addresses are cut to the aligned block around our own
+// address.
+//
+// Same threading rules as PeerProbeEngine: callbacks run on the async_tcp
+// task and only touch their slot under _mutex. Clients close themselves
+// (onPoll past the deadline) and are deleted in onDisconnect. A slot stays
+// busy until its client is gone, so at most kMaxConnects sockets (lwIP
+// PCBs) are used.
+
+struct SubnetScanStats {
+    uint32_t firstHost = 0;    // host byte order
+    uint32_t lastHost = 0;
+    uint16_t prefixBits = 0;
+    uint32_t hosts = 0;        // addresses in the sweep
+    uint32_t scanned = 0;      // connects finished
+    uint32_t skipped = 0;      // self, gateway, known or ignored
+    uint32_t open = 0;
+    uint32_t refused = 0;
+    uint32_t silent = 0;
+    uint32_t sweeps = 0;       // completed sweeps
+    uint32_t startedMs = 0;
+    uint32_t lastSweepMs = 0;  // duration of the last completed sweep
+};
+
+class SubnetScanner {
+public:
+    static constexpr uint8_t kMaxConnects = 8;
+    static constexpr uint32_t kConnectTimeoutMs = 500;
+    static constexpr uint32_t kMaxScanHosts = 1024;
+    static constexpr uint8_t kOpenQueue = 32;
+
+    SubnetScanner();
+
+    // Start a sweep of the subnet of local/mask. False if there is nothing to scan.
+    bool begin(IPAddress local, IPAddress mask, IPAddress gateway);
+
+    // Loop side: collect finished connects and start new ones.
+    // skip(ip) is asked once per address (ip in host byte order).
+    void loop(const std::function<bool(uint32_t)>& skip);
+
+    // Hosts that accepted on port 80 (host byte order), oldest first.
+    bool takeOpenHost(uint32_t& ip);
+
+    bool active() const { return _active; }
+    const SubnetScanStats& stats() const { return _stats; }
+
+    static uint32_t toHostOrder(IPAddress ip) {
+        return ((uint32_t)ip[0] << 24) | ((uint32_t)ip[1] << 16) | ((uint32_t)ip[2] << 8) | ip[3];
+    }
+    static IPAddress fromHostOrder(uint32_t ip) {
+        return IPAddress((uint8_t)(ip >> 24), (uint8_t)(ip >> 16), (uint8_t)(ip >> 8), (uint8_t)ip);
+    }
+
+private:
+    enum SlotState : uint8_t { SLOT_FREE, SLOT_CONNECTING, SLOT_DONE };
+    enum SlotOutcome : uint8_t { OUTCOME_SILENT, OUTCOME_OPEN, OUTCOME_REFUSED };
+
+    struct Slot {
+        uint32_t generation = 0;
+        uint32_t ip = 0;
+        uint8_t state = SLOT_FREE;
+        uint8_t outcome = OUTCOME_SILENT;
+        int8_t error = 0;
+    };
+
+    bool startConnect(uint8_t index, uint32_t ip);
+    void handleConnect(uint8_t index, uint32_t generation, AsyncClient* client);
+    void handleError(uint8_t index, uint32_t generation, int8_t error);
+    void handleDisconnect(uint8_t index, uint32_t generation, AsyncClient* client);
+
+    Slot _slots[kMaxConnects];
+    uint32_t _generation;
+    uint32_t _next;        // next address to try, host byte order
+    uint32_t _self;
+    uint32_t _gateway;
+    bool _active;
+    SubnetScanStats _stats;
+
+    uint32_t _open[kOpenQueue];
+    uint8_t _openHead;
+    uint8_t _openCount;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef SWEEPSNAPSHOT_H
+#define SWEEPSNAPSHOT_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Completed-sweep hand-off from the plugin task (Core 1) to web handlers (Core 0).
+//
+// Two slots, each guarded by a sequence counter (seqlock). The writer fills
+// the slot that is not published, bumping its counter to odd while writing
+// and back to even when done, then flips the published index. Readers copy
+// the published slot and retry if its counter moved or was odd. The writer
+// never waits for a reader; a reader only retries if two sweeps complete
+// while it is copying (sweeps are 10 s apart).
+//
+// A slot carries the live sweep plus the accumulator channels computed from
+// it (see SpectrumAccumulator.h) and the per-bin spread of multi-sample bins,
+// all as int16 in 0.01 units (centi-dB, 0.01 % for occupancy, 0.01 dB^2 for
+// variance). Readers copy one channel at a time. With several samples per
+// bin the live channel is their mean.
+//
+// Adaptive sweeps also publish a detail pass: fine-resolution segments
+// re-swept inside the coarse grid, copied out separately with readDetail().
+//
+// Timing: startOffsetUs is when the sweep actually started relative to its
+// UTC slot boundary, and each bin carries the time of its RSSI read in us
+// after that start (readTimes()). A bin's absolute time is
+// epoch * 1e6 + startOffsetUs + binUs[bin].
+
+static constexpr uint16_t kSweepMaxBins = 255;
+static constexpr uint16_t kSweepMaxDetailBins = 256;
+static constexpr uint8_t kSweepMaxDetailSegments = 16;
+
+enum SweepChannel : uint8_t {
+    SWEEP_CHANNEL_LIVE = 0,
+    SWEEP_CHANNEL_MAX_HOLD = 1,
+    SWEEP_CHANNEL_MIN_HOLD = 2,
+    SWEEP_CHANNEL_AVERAGE = 3,
+    SWEEP_CHANNEL_OCCUPANCY = 4,
+    SWEEP_CHANNEL_SAMPLE_MAX = 5,      // strongest of the samples within each bin
+    SWEEP_CHANNEL_SAMPLE_VARIANCE = 6  // variance of the samples within each bin
+};
+
+static constexpr uint8_t kSweepChannels = 7;
+
+inline const char* sweepChannelName(uint8_t channel) {
+    switch (channel) {
+        case SWEEP_CHANNEL_MAX_HOLD: return "max_hold";
+        case SWEEP_CHANNEL_MIN_HOLD: return "min_hold";
+        case SWEEP_CHANNEL_AVERAGE: return "average";
+        case SWEEP_CHANNEL_OCCUPANCY: return "occupancy_pct";
+        case SWEEP_CHANNEL_SAMPLE_MAX: return "sample_max";
+        case SWEEP_CHANNEL_SAMPLE_VARIANCE: return "sample_variance_db2";
+        default: return "live";
+    }
+}
+
+inline int16_t sweepFloatToCdb(float v) {
+    long c = lroundf(v * 100.0f);
+    if (c < -32768) c = -32768;
+    if (c > 32767) c = 32767;
+    return (int16_t)c;
+}
+
+// Round to whole units, half away from zero (matches lroundf on the float value).
+inline int8_t sweepCdbToInt8(int16_t cdb) {
+    int32_t d = cdb >= 0 ? (cdb + 50) / 100 : -((-(int32_t)cdb + 50) / 100);
+    if (d < -128) d = -128;
+    if (d > 127) d = 127;
+    return (int8_t)d;
+}
+
+struct SweepHeader {
+    uint32_t seq = 0;        // sweep number since the task started
+    uint32_t epoch = 0;      // UTC slot the sweep was aligned to
+    int32_t startOffsetUs = 0; // measured sweep start minus the slot boundary
+    uint32_t durationUs = 0;
+    float startMhz = 0.0f;
+    float stepMhz = 0.0f;
+    uint16_t binCount = 0;
+    uint32_t accumulated = 0; // sweeps folded into the accumulator channels
+
+    float binFrequencyMhz(uint16_t bin) const { return startMhz + stepMhz * bin; }
+};
+
+// One channel of a published sweep, as copied out by a reader.
+struct SweepData : SweepHeader {
+    uint8_t channel = SWEEP_CHANNEL_LIVE;
+    int16_t cdb[kSweepMaxBins];
+
+    float value(uint16_t bin) const { return cdb[bin] / 100.0f; }
+};
+
+struct SweepSegment {
+    float startMhz;
+    uint16_t offset;  // first bin in SweepDetail::cdb
+    uint16_t count;
+    uint32_t firstUs; // RSSI read of the first and last bin, us after the sweep start
+    uint32_t lastUs;
+};
+
+// Per-bin read times of the live sweep, us after the sweep start.
+struct SweepTimes {
+    uint32_t seq = 0;
+    uint16_t binCount = 0;
+    uint32_t binUs[kSweepMaxBins];
+};
+
+// Fine-resolution detail pass of an adaptive sweep (empty for plain sweeps).
+struct SweepDetail {
+    uint32_t seq = 0;               // sweep it belongs to
+    float stepMhz = 0.0f;
+    float rxBandwidthKhz = 0.0f;
+    uint32_t durationUs = 0;        // detail pass only
+    uint32_t fullSweepEstimateUs = 0; // same range at detail resolution, every bin
+    int16_t noiseFloorCdb = 0;
+    int16_t thresholdCdb = 0;
+    uint16_t flaggedBins = 0;       // coarse bins above threshold
+    uint16_t droppedBins = 0;       // flagged coarse bins left out by the detail budget
+    uint16_t calibrations = 0;      // detail hops that needed SCAL
+    uint8_t segmentCount = 0;
+    uint16_t binCount = 0;
+    SweepSegment segments[kSweepMaxDetailSegments];
+    int16_t cdb[kSweepMaxDetailBins];
+};
+
+// Writer-side slot: every channel of one sweep.
+struct SweepSlot : SweepHeader {
+    int16_t cdb[kSweepChannels][kSweepMaxBins];
+    uint32_t binUs[kSweepMaxBins];
+    SweepDetail detail;
+};
+
+class SweepSnapshot {
+public:
+    static constexpr uint8_t kNone = 0xFF;
+    static constexpr uint8_t kReadAttempts = 4;
+
+    SweepSnapshot() {
+        _slotSeq[0].store(0, std::memory_order_relaxed);
+        _slotSeq[1].store(0, std::memory_order_relaxed);
+        _published.store(kNone, std::memory_order_relaxed);
+    }
+
+    // Writer side (single writer). Returns the back slot and marks it busy.
+    SweepSlot& beginWrite() {
+        uint8_t published = _published.load(std::memory_order_relaxed);
+        _writeSlot = (published == kNone) ? 0 : (uint8_t)(published ^ 1);
+        _slotSeq[_writeSlot].fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return _slots[_writeSlot];
+    }
+
+    void publish() {
+        _slotSeq[_writeSlot].fetch_add(1, std::memory_order_release);
+        _published.store(_writeSlot, std::memory_order_release);
+    }
+
+    void clear() { _published.store(kNone, std::memory_order_release); }
+
+    bool hasData() const { return _published.load(std::memory_order_acquire) != kNone; }
+
+    // Reader side (any core). Copies one channel of the latest whole sweep into out.
+    bool read(SweepData& out, uint8_t channel = SWEEP_CHANNEL_LIVE) const {
+        if (channel >= kSweepChannels) channel = SWEEP_CHANNEL_LIVE;
+        return readWith([&](const SweepSlot& src) {
+            static_cast<SweepHeader&>(out) = src;
+            out.channel = channel;
+            if (out.binCount > kSweepMaxBins) out.binCount = kSweepMaxBins;
+            memcpy(out.cdb, src.cdb[channel], sizeof(int16_t) * out.binCount);
+        });
+    }
+
+    // Copies the detail pass of the latest sweep (binCount 0 for plain sweeps).
+    bool readDetail(SweepDetail& out) const {
+        return readWith([&](const SweepSlot& src) {
+            out = src.detail;
+            if (out.segmentCount > kSweepMaxDetailSegments) out.segmentCount = kSweepMaxDetailSegments;
+            if (out.binCount > kSweepMaxDetailBins) out.binCount = kSweepMaxDetailBins;
+        });
+    }
+
+    // Copies the per-bin read times of the latest sweep.
+    bool readTimes(SweepTimes& out) const {
+        return readWith([&](const SweepSlot& src) {
+            out.seq = src.seq;
+            out.binCount = src.binCount > kSweepMaxBins ? kSweepMaxBins : src.binCount;
+            memcpy(out.binUs, src.binUs, sizeof(uint32_t) * out.binCount);
+        });
+    }
+
+    uint32_t readRetries() const { return _readRetries.load(std::memory_order_relaxed); }
+
+private:
+    template <typename Copy>
+    bool readWith(Copy copy) const {
+        for (uint8_t attempt = 0; attempt < kReadAttempts; ++attempt) {
+            uint8_t slot = _published.load(std::memory_order_acquire);
+            if (slot == kNone) return false;
+
+            uint32_t before = _slotSeq[slot].load(std::memory_order_acquire);
+            if (before & 1) continue;
+
+            copy(_slots[slot]);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_slotSeq[slot].load(std::memory_order_relaxed) == before) return true;
+            _readRetries.fetch_add(1, std::memory_order_relaxed);
+        }
+        return false;
+    }
+
+    SweepSlot _slots[2];
+    std::atomic<uint32_t> _slotSeq[2];
+    std::atomic<uint8_t> _published;
+    mutable std::atomic<uint32_t> _readRetries{0};
+    uint8_t _writeSlot = 0;
+};
+
+#endif
@@ -0,0 +1,85 @@
+#include "SweepTrigger.h"
+#include "ClockSync.h"
+#include "Logger.h"
+
+bool SweepTrigger::begin() {
+    if (_timer) return true;
+    _wake = xSemaphoreCreateBinary();
+    if (!_wake) return false;
+
+    esp_timer_create_args_t args = {};
+    args.callback = &SweepTrigger::onTimer;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "sweep_trigger";
+    if (esp_timer_create(&args, &_timer) != ESP_OK) {
+        Logger::instance().error("Trigger", "esp_timer_create failed");
+        vSemaphoreDelete(_wake);
+        _wake = nullptr;
+        _timer = nullptr;
+        return false;
+    }
+    _fired = 0;
+    _late = 0;
+    _missed = 0;
+    return true;
+}
+
+void SweepTrigger::end() {
+    if (_timer) {
+        esp_timer_stop(_timer);
+        esp_timer_delete(_timer);
+        _timer = nullptr;
+    }
+    if (_wake) {
+        vSemaphoreDelete(_wake);
+        _wake = nullptr;
+    }
+}
+
+void SweepTrigger::onTimer(void* arg) {
+    SweepTrigger* self = static_cast<SweepTrigger*>(arg);
+    xSemaphoreGive(self->_wake);
+}
+
+bool SweepTrigger::wait(uint32_t periodSec, uint32_t lastEpoch, SweepTriggerSlot& slot) {
+    uint64_t nowUs = ClockSync::instance().consensusTimeUs();
+    if (nowUs == 0 || periodSec == 0 || !_timer) {
+        vTaskDelay(pdMS_TO_TICKS(kIdleSleepMs));
+        return false;
+    }
+
+    const uint64_t periodUs = (uint64_t)periodSec * 1000000ULL;
+    uint64_t slotUs = nowUs - nowUs % periodUs;
+    if ((uint32_t)(slotUs / 1000000ULL) != lastEpoch && nowUs - slotUs < kLateLimitUs) {
+        slot.epoch = (uint32_t)(slotUs / 1000000ULL);
+        slot.startOffsetUs = (int32_t)(nowUs - slotUs);
+        _late++;
+        return true;
+    }
+
+    slotUs += periodUs;
+    uint64_t waitUs = slotUs - nowUs;
+    if (waitUs > kArmWindowUs) {
+        uint32_t sleepMs = (uint32_t)((waitUs - kArmWindowUs) / 1000ULL) + 1;
+        vTaskDelay(pdMS_TO_TICKS(sleepMs < kIdleSleepMs ? sleepMs : kIdleSleepMs));
+        return false;
+    }
+
+    xSemaphoreTake(_wake, 0);  // drop a give left over from a stopped timer
+    if (esp_timer_start_once(_timer, waitUs) != ESP_OK) {
+        _missed++;
+        vTaskDelay(pdMS_TO_TICKS(10));
+        return false;
+    }
+    if (xSemaphoreTake(_wake, pdMS_TO_TICKS(waitUs / 1000ULL + 50)) != pdTRUE) {
+        esp_timer_stop(_timer);
+        _missed++;
+        return false;
+    }
+
+    slot.epoch = (uint32_t)(slotUs / 1000000ULL);
+    slot.startOffsetUs = (int32_t)((int64_t)ClockSync::instance().consensusTimeUs() - (int64_t)slotUs);
+    _fired++;
+    return true;
+}
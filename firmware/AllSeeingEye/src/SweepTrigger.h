@@ -0,0 +1,54 @@
+#ifndef SWEEPTRIGGER_H
+#define SWEEPTRIGGER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Cluster sweep trigger aligned to the cluster-consensus clock.
+//
+// Slots start every periodSec seconds of consensus time (ClockSync.h, UTC
+// when any node has SNTP; epoch % periodSec == 0), so all nodes sweep
+// together even while their SNTP fixes drift apart. Far from a slot the caller just sleeps. Within
+// kArmWindowUs of the boundary, a one-shot esp_timer is armed for the
+// remaining microseconds and the task blocks on a binary semaphore that the
+// timer callback gives. The task wakes within tens of microseconds of the
+// boundary instead of somewhere in a 50 ms poll. The residual offset is
+// measured against the clock and returned with the slot, so every sweep
+// record says exactly when it started.
+
+struct SweepTriggerSlot {
+    uint32_t epoch = 0;         // UTC second of the slot boundary
+    int32_t startOffsetUs = 0;  // measured wake time minus the boundary
+};
+
+class SweepTrigger {
+public:
+    static constexpr uint32_t kArmWindowUs = 250000;
+    static constexpr uint32_t kIdleSleepMs = 200;
+    // A boundary that passed this recently without a sweep (first start,
+    // recalibration) is still taken, late, rather than skipped.
+    static constexpr uint32_t kLateLimitUs = 1000000;
+
+    bool begin();
+    void end();
+
+    // Returns true at a slot boundary not yet swept (slot.epoch != lastEpoch)
+    // with the slot filled in. Returns false after sleeping while the next
+    // boundary is still far off or the clock is unset.
+    bool wait(uint32_t periodSec, uint32_t lastEpoch, SweepTriggerSlot& slot);
+
+    uint32_t fired() const { return _fired; }
+    uint32_t late() const { return _late; }
+    uint32_t missed() const { return _missed; }
+
+private:
+    static void onTimer(void* arg);
+
+    esp_timer_handle_t _timer = nullptr;
+    SemaphoreHandle_t _wake = nullptr;
+    uint32_t _fired = 0;
+    uint32_t _late = 0;
+    uint32_t _missed = 0;
+};
+
+#endif
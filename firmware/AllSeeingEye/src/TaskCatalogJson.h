@@ -0,0 +1,25 @@
+#ifndef TASK_CATALOG_JSON_H
+#define TASK_CATALOG_JSON_H
+
+#include <Arduino.h>
+
+// /api/task, serialized from kTasks in PluginManager.cpp by
+// catalog_bench --write from your host build directory. Do not edit.
+// The key of the table it was serialized from: PluginManager.cpp does not
+// build for the board against a stale header.
+const uint32_t task_catalog_key = 0xd2835631;
+const uint32_t task_catalog_json_len = 4906;
+const char task_catalog_json[] PROGMEM =
+"[{\"id\":\"ble-ranging/peer\",\"name\":\"BLE Peer Ranging\",\"description\":\"Active scan + RSSI history logging for specific targets.\",\"plugin\":\"BLE Ranging\",\"link\":\"/api/task/ble-ranging/peer\"}"
+",{\"id\":\"ble-ranging/survey\",\"name\":\"BLE Device Survey\",\"description\":\"Lists all nearby BLE MACs and payloads.\",\"plugin\":\"BLE Ranging\",\"link\":\"/api/task/ble-ranging/survey\"}"
+",{\"id\":\"geolocation/fix\",\"name\":\"Geolocation Fix\",\"description\":\"Aggregates GPS + WiFi anchors to determine location.\",\"plugin\":\"Geolocation\",\"link\":\"/api/task/geolocation/fix\"}"
+",{\"id\":\"system/idle\",\"name\":\"System Idle\",\"description\":\"Low power background monitoring.\",\"plugin\":\"System\",\"link\":\"/api/task/system/idle\"}"
+",{\"id\":\"rf-diag/noise\",\"name\":\"Noise Floor Check\",\"description\":\"Measures RSSI without sync word/packet logic.\",\"plugin\":\"RF Diagnostics\",\"link\":\"/api/task/rf-diag/noise\"}"
+",{\"id\":\"spectrum/scan\",\"name\":\"Band Scan\",\"description\":\"Standard sweep, returns power levels.\",\"plugin\":\"Spectrum Analyzer\",\"link\":\"/api/task/spectrum/scan\",\"inputs\":[{\"name\":\"start\",\"label\":\"Start Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":905,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"stop\",\"label\":\"Stop Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":928,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"bandwidth\",\"label\":\"Channel Bandwidth (kHz)\",\"type\":\"number\",\"required\":true,\"default\":500,\"step\":1,\"min\":58,\"max\":812},{\"name\":\"power\",\"label\":\"Broadcast Power (dBm)\",\"type\":\"number\",\"required\":true,\"default\":-1,\"step\":1,\"min\":-30,\"max\":10},{\"name\":\"samples\",\"label\":\"RSSI Samples per Bin\",\"type\":\"number\",\"default\":1,\"step\":1,\"min\":1,\"max\":32}]}"
+",{\"id\":\"spectrum/peak\",\"name\":\"Peak Hold Sweep\",\"description\":\"Synchronized sweeps keeping the max per bin over the hold window; min/average/occupancy ride along.\",\"plugin\":\"Spectrum Analyzer\",\"link\":\"/api/task/spectrum/peak\",\"inputs\":[{\"name\":\"start\",\"label\":\"Start Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":905,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"stop\",\"label\":\"Stop Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":928,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"bandwidth\",\"label\":\"Channel Bandwidth (kHz)\",\"type\":\"number\",\"required\":true,\"default\":500,\"step\":1,\"min\":58,\"max\":812},{\"name\":\"power\",\"label\":\"Broadcast Power (dBm)\",\"type\":\"number\",\"required\":true,\"default\":-1,\"step\":1,\"min\":-30,\"max\":10},{\"name\":\"duration\",\"label\":\"Hold Window (s, 0 = until restarted)\",\"type\":\"number\",\"default\":60,\"step\":10,\"min\":0},{\"name\":\"samples\",\"label\":\"RSSI Samples per Bin\",\"type\":\"number\",\"default\":1,\"step\":1,\"min\":1,\"max\":32}]}"
+",{\"id\":\"spectrum/detect\",\"name\":\"Emission Detector\",\"description\":\"Synchronized sweeps reduced on the node to signal events (center, width, peak); no raw spectra in the report.\",\"plugin\":\"Spectrum Analyzer\",\"link\":\"/api/task/spectrum/detect\",\"inputs\":[{\"name\":\"start\",\"label\":\"Start Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":905,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"stop\",\"label\":\"Stop Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":928,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"bandwidth\",\"label\":\"Channel Bandwidth (kHz)\",\"type\":\"number\",\"required\":true,\"default\":500,\"step\":1,\"min\":58,\"max\":812},{\"name\":\"power\",\"label\":\"Broadcast Power (dBm)\",\"type\":\"number\",\"required\":true,\"default\":-1,\"step\":1,\"min\":-30,\"max\":10},{\"name\":\"detect_db\",\"label\":\"Detection Threshold (dB over CFAR reference)\",\"type\":\"number\",\"default\":8,\"step\":1,\"min\":1,\"max\":60},{\"name\":\"samples\",\"label\":\"RSSI Samples per Bin\",\"type\":\"number\",\"default\":1,\"step\":1,\"min\":1,\"max\":32}]}"
+",{\"id\":\"spectrum/adaptive\",\"name\":\"Adaptive Band Scan\",\"description\":\"Coarse pass at the widest filter, then re-sweeps only bins above the noise floor at the requested bandwidth.\",\"plugin\":\"Spectrum Analyzer\",\"link\":\"/api/task/spectrum/adaptive\",\"inputs\":[{\"name\":\"start\",\"label\":\"Start Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":905,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"stop\",\"label\":\"Stop Frequency (MHz)\",\"type\":\"number\",\"required\":true,\"default\":928,\"step\":0.1,\"min\":300,\"max\":928},{\"name\":\"bandwidth\",\"label\":\"Channel Bandwidth (kHz)\",\"type\":\"number\",\"required\":true,\"default\":500,\"step\":1,\"min\":58,\"max\":812},{\"name\":\"power\",\"label\":\"Broadcast Power (dBm)\",\"type\":\"number\",\"required\":true,\"default\":-1,\"step\":1,\"min\":-30,\"max\":10},{\"name\":\"threshold_db\",\"label\":\"Detail Threshold (dB over noise floor)\",\"type\":\"number\",\"default\":10,\"step\":1,\"min\":1,\"max\":60},{\"name\":\"samples\",\"label\":\"RSSI Samples per Bin\",\"type\":\"number\",\"default\":1,\"step\":1,\"min\":1,\"max\":32}]}"
+",{\"id\":\"meshtastic/monitor\",\"name\":\"Traffic Monitor\",\"description\":\"Logs all seen packets with RSSI/SNR metrics.\",\"plugin\":\"Meshtastic\",\"link\":\"/api/task/meshtastic/monitor\"}"
+",{\"id\":\"meshtastic/trace\",\"name\":\"Network Traceroute\",\"description\":\"Performs an active traceroute to map the hop path.\",\"plugin\":\"Meshtastic\",\"link\":\"/api/task/meshtastic/trace\"}]";
+
+#endif
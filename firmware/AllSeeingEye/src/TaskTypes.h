@@ -2,7 +2,6 @@
 #define TASKTYPES_H
 
 #include <Arduino.h>
-#include <vector>
 
 enum TaskInputValueType {
     INPUT_VALUE_NONE,
@@ -11,21 +10,23 @@ enum TaskInputValueType {
     INPUT_VALUE_TEXT
 };
 
+// The catalog is a constexpr table (PluginManager.cpp): these live in flash.
+
 struct TaskInputOption {
-    String label;
-    String value;
+    const char* label;
+    const char* value;
 };
 
 struct TaskInputDefinition {
-    String name;
-    String label;
-    String type; // number, select, boolean, text
+    const char* name = "";
+    const char* label = "";
+    const char* type = ""; // number, select, boolean, text
     bool required = false;
 
     TaskInputValueType defaultType = INPUT_VALUE_NONE;
     float defaultNumber = 0.0f;
     bool defaultBool = false;
-    String defaultText = "";
+    const char* defaultText = "";
 
     bool hasStep = false;
     float step = 0.0f;
@@ -34,7 +35,8 @@ struct TaskInputDefinition {
     bool hasMax = false;
     float max = 0.0f;
 
-    std::vector<TaskInputOption> options;
+    const TaskInputOption* options = nullptr;
+    uint8_t optionCount = 0;
 };
 
 enum TaskType {
@@ -44,13 +46,22 @@ enum TaskType {
     TASK_BACKGROUND   // Idle/Scanning
 };
 
+class ASEPlugin;
+
+struct PluginDefinition {
+    const char* name;              // e.g., "BleRanging"; what RadioTask::pluginName names
+    ASEPlugin* (*create)();
+};
+
 struct TaskDefinition {
-    String id;             // e.g., "ble-ranging/survey"
-    String name;           // e.g., "Device Survey"
-    String pluginName;     // e.g., "BleRanging"
-    String description;    // e.g., "Lists all nearby BLE MACs and payloads."
-    String endpoint;       // e.g., "/api/task/ble-ranging/survey"
-    std::vector<TaskInputDefinition> inputs;
+    const char* id;             // e.g., "ble-ranging/survey"
+    const char* name;           // e.g., "Device Survey"
+    const char* pluginName;     // e.g., "BLE Ranging": the group shown in the catalog
+    const char* description;    // e.g., "Lists all nearby BLE MACs and payloads."
+    const char* endpoint;       // e.g., "/api/task/ble-ranging/survey"
+    uint8_t plugin;             // index of the plugin that runs it
+    const TaskInputDefinition* const* inputs;
+    uint8_t inputCount;
 };
 
 struct RadioTask {
@@ -0,0 +1,264 @@
+#include "WaterfallStore.h"
+#include "Logger.h"
+#include "SpectrumFrame.h"
+#include <esp_mac.h>
+
+WaterfallStore& WaterfallStore::instance() {
+    static WaterfallStore _instance;
+    return _instance;
+}
+
+WaterfallStore::WaterfallStore()
+    : _rows(nullptr), _epochs(nullptr), _capacity(0), _head(0), _count(0),
+      _binCount(0), _startMhz(0.0f), _stepMhz(0.0f), _droppedRows(0) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+bool WaterfallStore::begin(uint16_t rowCapacity) {
+    if (_rows != nullptr) {
+        Logger::instance().warn("Waterfall", "Already initialized");
+        return true;
+    }
+    if (rowCapacity == 0) return false;
+
+    size_t rowBytes = (size_t)rowCapacity * kWaterfallRowBins;
+    _rows = (int8_t*) heap_caps_malloc(rowBytes, MALLOC_CAP_SPIRAM);
+    _epochs = (uint32_t*) heap_caps_malloc((size_t)rowCapacity * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+
+    if (_rows == nullptr || _epochs == nullptr) {
+        Logger::instance().error("Waterfall", "PSRAM Allocation FAILED! Falling back to Heap (small)...");
+        if (_rows) heap_caps_free(_rows);
+        if (_epochs) heap_caps_free(_epochs);
+        // 64 rows is ~10 minutes of 10 s sweeps
+        rowCapacity = 64;
+        _rows = (int8_t*) malloc((size_t)rowCapacity * kWaterfallRowBins);
+        _epochs = (uint32_t*) malloc((size_t)rowCapacity * sizeof(uint32_t));
+        if (_rows == nullptr || _epochs == nullptr) {
+            free(_rows);
+            free(_epochs);
+            _rows = nullptr;
+            _epochs = nullptr;
+            Logger::instance().error("Waterfall", "CRITICAL: RAM Allocation FAILED");
+            return false;
+        }
+    }
+
+    _capacity = rowCapacity;
+    _head = 0;
+    _count = 0;
+    _binCount = 0;
+
+    Logger::instance().info("Waterfall", "Initialized. %u rows x %u bins", _capacity, kWaterfallRowBins);
+    return true;
+}
+
+bool WaterfallStore::append(uint32_t epoch, float startMhz, float stepMhz, const int16_t* rssiCdb, uint16_t binCount) {
+    if (!_rows || !rssiCdb || binCount == 0) return false;
+    if (binCount > kWaterfallRowBins) binCount = kWaterfallRowBins;
+
+    // Keep the sweep loop from stalling behind a large query.
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(5)) != pdTRUE) {
+        _droppedRows++;
+        return false;
+    }
+
+    bool geometryChanged = binCount != _binCount || fabsf(startMhz - _startMhz) > 0.0005f ||
+                           fabsf(stepMhz - _stepMhz) > 0.0005f;
+    // Rows must stay in epoch order for lowerBound(); a clock step backwards starts over.
+    if (geometryChanged || (_count > 0 && epoch <= _epochs[rowIndex(_count - 1)])) {
+        _head = 0;
+        _count = 0;
+        _binCount = binCount;
+        _startMhz = startMhz;
+        _stepMhz = stepMhz;
+    }
+
+    int8_t* row = _rows + (size_t)_head * kWaterfallRowBins;
+    for (uint16_t i = 0; i < binCount; ++i) {
+        row[i] = sweepCdbToInt8(rssiCdb[i]);
+    }
+    _epochs[_head] = epoch;
+    _head = (uint16_t)((_head + 1) % _capacity);
+    if (_count < _capacity) _count++;
+
+    xSemaphoreGive(_mutex);
+    return true;
+}
+
+uint16_t WaterfallStore::rowIndex(uint16_t logical) const {
+    // logical 0 is the oldest row
+    return (uint16_t)(((uint32_t)_head + _capacity - _count + logical) % _capacity);
+}
+
+uint16_t WaterfallStore::lowerBound(uint32_t epoch) const {
+    uint16_t lo = 0;
+    uint16_t hi = _count;
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2);
+        if (_epochs[rowIndex(mid)] < epoch) {
+            lo = (uint16_t)(mid + 1);
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void WaterfallStore::rangeLocked(const WaterfallQuery& query, uint16_t& first, uint16_t& count) const {
+    first = 0;
+    count = 0;
+    if (_count == 0 || query.toEpoch < query.fromEpoch) return;
+    first = lowerBound(query.fromEpoch);
+    uint16_t end = (query.toEpoch == 0xFFFFFFFF) ? _count : lowerBound(query.toEpoch + 1);
+    count = end > first ? (uint16_t)(end - first) : 0;
+}
+
+size_t WaterfallStore::encodedSize(uint16_t rows, uint16_t cols) {
+    return kWaterfallHeaderBytes + (size_t)rows * (4 + cols);
+}
+
+size_t WaterfallStore::plan(WaterfallQuery& query) {
+    if (!_rows) return 0;
+    if (query.mode != WATERFALL_MEAN) query.mode = WATERFALL_MAX;
+    if (query.timeDecimation == 0) query.timeDecimation = 1;
+    if (query.freqDecimation == 0) query.freqDecimation = 1;
+    if (query.maxBytes == 0 || query.maxBytes > kWaterfallMaxResponseBytes) query.maxBytes = kWaterfallMaxResponseBytes;
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return 0;
+    uint16_t first, count;
+    rangeLocked(query, first, count);
+    uint16_t bins = _binCount;
+    xSemaphoreGive(_mutex);
+    if (count == 0 || bins == 0) return 0;
+
+    if (query.freqDecimation > bins) query.freqDecimation = bins;
+    uint16_t cols = (uint16_t)((bins + query.freqDecimation - 1) / query.freqDecimation);
+    // At least one row must fit; widen columns until it does.
+    while (encodedSize(1, cols) > query.maxBytes && query.freqDecimation < bins) {
+        query.freqDecimation++;
+        cols = (uint16_t)((bins + query.freqDecimation - 1) / query.freqDecimation);
+    }
+    if (encodedSize(1, cols) > query.maxBytes) return 0;
+
+    size_t maxRows = (query.maxBytes - kWaterfallHeaderBytes) / (4 + cols);
+    uint16_t neededDecimation = (uint16_t)((count + maxRows - 1) / maxRows);
+    if (query.timeDecimation < neededDecimation) query.timeDecimation = neededDecimation;
+    if (query.timeDecimation > count) query.timeDecimation = count;
+    uint16_t rows = (uint16_t)((count + query.timeDecimation - 1) / query.timeDecimation);
+    return encodedSize(rows, cols);
+}
+
+size_t WaterfallStore::encode(const WaterfallQuery& query, uint8_t* out, size_t capacity) {
+    if (!_rows || !out || capacity < kWaterfallHeaderBytes) return 0;
+    uint16_t tdec = query.timeDecimation ? query.timeDecimation : 1;
+    uint16_t fdec = query.freqDecimation ? query.freqDecimation : 1;
+    uint8_t mode = query.mode == WATERFALL_MEAN ? WATERFALL_MEAN : WATERFALL_MAX;
+
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return 0;
+    uint16_t first, count;
+    rangeLocked(query, first, count);
+    uint16_t bins = _binCount;
+    if (count == 0 || bins == 0) {
+        xSemaphoreGive(_mutex);
+        return 0;
+    }
+    if (fdec > bins) fdec = bins;
+    uint16_t cols = (uint16_t)((bins + fdec - 1) / fdec);
+    size_t rowBytes = 4 + cols;
+    uint16_t rows = (uint16_t)((count + tdec - 1) / tdec);
+    size_t fit = (capacity - kWaterfallHeaderBytes) / rowBytes;
+    if (fit == 0) {
+        xSemaphoreGive(_mutex);
+        return 0;
+    }
+    if (rows > fit) {
+        // A sweep landed since plan(); keep the newest rows.
+        uint32_t skip = (uint32_t)(rows - fit) * tdec;
+        first = (uint16_t)(first + skip);
+        count = (uint16_t)(count - skip);
+        rows = (uint16_t)fit;
+    }
+
+    uint8_t* p = out;
+    *p++ = 'A';
+    *p++ = 'S';
+    *p++ = 'E';
+    *p++ = 'W';
+    *p++ = kWaterfallVersion;
+    *p++ = mode;
+    p = spectrumFramePut16(p, rows);
+    p = spectrumFramePut16(p, cols);
+    esp_read_mac(p, ESP_MAC_WIFI_STA);
+    p += 6;
+    uint8_t* lastEpochField = p + 4;
+    p = spectrumFramePut32(p, _epochs[rowIndex(first)]);
+    p = spectrumFramePut32(p, 0);
+    p = spectrumFramePut32(p, (uint32_t)lroundf(_startMhz * 1000.0f));
+    p = spectrumFramePut32(p, (uint32_t)lroundf(_stepMhz * 1000000.0f) * fdec);
+    p = spectrumFramePut16(p, tdec);
+    p = spectrumFramePut16(p, fdec);
+
+    int32_t acc[kWaterfallRowBins];
+    uint16_t cellCount[kWaterfallRowBins];
+    uint32_t lastEpoch = 0;
+    for (uint16_t r = 0; r < rows; ++r) {
+        uint16_t rowStart = (uint16_t)(first + (uint32_t)r * tdec);
+        uint16_t rowEnd = (uint16_t)min<uint32_t>((uint32_t)rowStart + tdec, (uint32_t)first + count);
+        for (uint16_t c = 0; c < cols; ++c) {
+            acc[c] = (mode == WATERFALL_MAX) ? -128 : 0;
+            cellCount[c] = 0;
+        }
+        for (uint16_t logical = rowStart; logical < rowEnd; ++logical) {
+            const int8_t* src = _rows + (size_t)rowIndex(logical) * kWaterfallRowBins;
+            for (uint16_t b = 0; b < bins; ++b) {
+                uint16_t c = b / fdec;
+                if (mode == WATERFALL_MAX) {
+                    if (src[b] > acc[c]) acc[c] = src[b];
+                } else {
+                    acc[c] += src[b];
+                    cellCount[c]++;
+                }
+            }
+        }
+
+        p = spectrumFramePut32(p, _epochs[rowIndex(rowStart)]);
+        lastEpoch = _epochs[rowIndex((uint16_t)(rowEnd - 1))];
+        for (uint16_t c = 0; c < cols; ++c) {
+            int32_t v = acc[c];
+            if (mode == WATERFALL_MEAN && cellCount[c] > 0) {
+                // Round half away from zero
+                v = (v >= 0) ? (v + cellCount[c] / 2) / cellCount[c] : -((-v + cellCount[c] / 2) / cellCount[c]);
+            }
+            *p++ = (uint8_t)(int8_t)v;
+        }
+    }
+    xSemaphoreGive(_mutex);
+
+    spectrumFramePut32(lastEpochField, lastEpoch);
+    return (size_t)(p - out);
+}
+
+WaterfallInfo WaterfallStore::info() {
+    WaterfallInfo result;
+    result.capacity = _capacity;
+    if (!_rows || xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return result;
+    result.rows = _count;
+    result.binCount = _binCount;
+    result.startMhz = _startMhz;
+    result.stepMhz = _stepMhz;
+    result.droppedRows = _droppedRows;
+    if (_count > 0) {
+        result.oldestEpoch = _epochs[rowIndex(0)];
+        result.newestEpoch = _epochs[rowIndex((uint16_t)(_count - 1))];
+    }
+    xSemaphoreGive(_mutex);
+    return result;
+}
+
+void WaterfallStore::clear() {
+    if (xSemaphoreTake(_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return;
+    _head = 0;
+    _count = 0;
+    _binCount = 0;
+    xSemaphoreGive(_mutex);
+}
@@ -0,0 +1,103 @@
+#ifndef WATERFALLSTORE_H
+#define WATERFALLSTORE_H
+
+#include <Arduino.h>
+#include "SweepSnapshot.h"
+
+// Sweep history ("waterfall") kept in PSRAM.
+//
+// Each completed sweep is stored as one fixed-width row of int8 dBm bins,
+// tagged with the UTC epoch of its sweep slot. Rows form a ring: when full,
+// the oldest row is overwritten. Changing the sweep geometry (start, step or
+// bin count) starts a new history. Queries select rows by epoch range and
+// decimate server side, taking the max or mean of time x frequency cells.
+//
+// GET /api/spectrum/waterfall returns the query result as a binary block,
+// all fields little-endian, 36-byte header followed by rows:
+//   0  char[4] magic      "ASEW"
+//   4  u8      version    kWaterfallVersion
+//   5  u8      mode       WATERFALL_MAX | WATERFALL_MEAN
+//   6  u16     row_count
+//   8  u16     col_count  bins per row after frequency decimation
+//   10 u8[6]   node_id    WiFi STA MAC
+//   16 u32     first_epoch
+//   20 u32     last_epoch
+//   24 u32     start_khz  centre of bin 0
+//   28 u32     step_hz    column spacing (sweep step x freq_decimation)
+//   32 u16     time_decimation  stored rows folded into each output row
+//   34 u16     freq_decimation  sweep bins folded into each output column
+//   36 rows    row_count x (u32 epoch + col_count x int8 dBm)
+
+enum WaterfallMode : uint8_t {
+    WATERFALL_MAX = 1,
+    WATERFALL_MEAN = 2
+};
+
+static constexpr uint8_t kWaterfallVersion = 1;
+static constexpr size_t kWaterfallHeaderBytes = 36;
+static constexpr uint16_t kWaterfallRowBins = kSweepMaxBins;
+static constexpr size_t kWaterfallMaxResponseBytes = 32 * 1024;
+
+struct WaterfallQuery {
+    uint32_t fromEpoch = 0;
+    uint32_t toEpoch = 0xFFFFFFFF;
+    uint16_t timeDecimation = 1;
+    uint16_t freqDecimation = 1;
+    uint8_t mode = WATERFALL_MAX;
+    size_t maxBytes = kWaterfallMaxResponseBytes;
+};
+
+struct WaterfallInfo {
+    uint16_t rows = 0;
+    uint16_t capacity = 0;
+    uint16_t binCount = 0;
+    uint32_t oldestEpoch = 0;
+    uint32_t newestEpoch = 0;
+    float startMhz = 0.0f;
+    float stepMhz = 0.0f;
+    uint32_t droppedRows = 0;
+};
+
+class WaterfallStore {
+public:
+    static WaterfallStore& instance();
+
+    // Allocate rowCapacity rows in PSRAM (falls back to a small heap buffer).
+    bool begin(uint16_t rowCapacity = 2048);
+
+    // Writer side: append one sweep (centi-dBm bins). Starts a new history if the geometry changed.
+    // Waits at most a few ms for a reader; the row is dropped (and counted) otherwise.
+    bool append(uint32_t epoch, float startMhz, float stepMhz, const int16_t* rssiCdb, uint16_t binCount);
+
+    // Clamp decimation so the result fits in query.maxBytes. Returns the encoded size
+    // (0 if nothing matches); query is updated in place with the effective values.
+    size_t plan(WaterfallQuery& query);
+
+    // Encode a planned query into out. Returns bytes written, 0 if nothing matched.
+    size_t encode(const WaterfallQuery& query, uint8_t* out, size_t capacity);
+
+    WaterfallInfo info();
+    void clear();
+
+private:
+    WaterfallStore();
+
+    uint16_t lowerBound(uint32_t epoch) const;  // first logical row with epoch >= epoch
+    uint16_t rowIndex(uint16_t logical) const;
+    void rangeLocked(const WaterfallQuery& query, uint16_t& first, uint16_t& count) const;
+    static size_t encodedSize(uint16_t rows, uint16_t cols);
+
+    int8_t* _rows;        // _capacity x kWaterfallRowBins
+    uint32_t* _epochs;
+    uint16_t _capacity;
+    uint16_t _head;       // next row to write
+    uint16_t _count;
+    uint16_t _binCount;
+    float _startMhz;
+    float _stepMhz;
+    uint32_t _droppedRows;
+
+    SemaphoreHandle_t _mutex;
+};
+
+#endif
@@ -0,0 +1,247 @@
+#include "WebDocuments.h"
+#include "BuildVersion.h"
+#include "BleRangingManager.h"
+#include "ClockSync.h"
+#include "ClusterCoordinator.h"
+#include "Config.h"
+#include "Geolocation.h"
+#include "HAL.h"
+#include "JsonStream.h"
+#include "Kernel.h"
+#include "LivePush.h"
+#include "Logger.h"
+#include "PeerManager.h"
+#include "PluginManager.h"
+#include "ReportAggregator.h"
+#include "RingBuffer.h"
+#include "Scheduler.h"
+
+namespace {
+// What the status_build and live sections report on (addStatusSections)
+StatusBuilder* gStatus = nullptr;
+LivePush* gPush = nullptr;
+}
+
+const StatusSection kStatusSections[] = {
+
+    {"system", nullptr, 0, [](JsonObject doc) {
+        doc["uptime"] = millis();
+        doc["heap_free"] = ESP.getFreeHeap();
+        doc["heap_size"] = ESP.getHeapSize();
+        doc["psram_free"] = ESP.getFreePsram();
+        doc["psram_size"] = ESP.getPsramSize();
+        doc["flash_size"] = ESP.getFlashChipSize();
+    }, true},
+
+    // NVS is only read again after a Config setter ran
+    {"identity", []() { return Config::instance().version(); }, StatusBuilder::kNoMaxAge, [](JsonObject doc) {
+        doc["hostname"] = Config::instance().getHostname();
+        doc["description"] = Config::instance().getString("description", "");
+        doc["build_id"] = BUILD_ID;
+        doc["timezone"] = Kernel::instance().getTimezone();
+        doc["clusterName"] = Config::instance().getString("cluster", "Default");
+    }, true},
+
+    {"time", nullptr, 0, [](JsonObject doc) {
+        doc["time"] = (long long)Kernel::instance().getEpochTime();
+        doc["ntp_sync"] = Kernel::instance().isTimeSynced();
+    }, true},
+
+    {"clock_sync", nullptr, 1000, [](JsonObject doc) {
+        ClockSync::instance().populateStatus(doc.createNestedObject("clock_sync"));
+    }, true},
+
+    {"geolocation", []() { return GeolocationService::instance().version(); }, StatusBuilder::kNoMaxAge, [](JsonObject doc) {
+        JsonObject geo = doc.createNestedObject("geolocation");
+        GeolocationService::instance().populateStatus(geo);
+    }, true},
+
+    {"ble_ranging", []() { return BleRangingManager::instance().version(); }, StatusBuilder::kNoMaxAge, [](JsonObject doc) {
+        JsonObject bleRanging = doc.createNestedObject("ble_ranging");
+        BleRangingManager::instance().populateStatus(bleRanging);
+    }, true},
+
+    {"radio", nullptr, 0, [](JsonObject doc) {
+        doc["rb_capacity"] = RingBuffer::instance().capacity();
+        doc["rb_usage"] = RingBuffer::instance().available();
+        doc["plugin"] = PluginManager::instance().getActivePluginName();
+    }, true},
+
+    // Desired Task Coordination: the params are only parsed again for a new deployment
+    {"desired_task", []() { return ClusterCoordinator::instance().version(); }, StatusBuilder::kNoMaxAge, [](JsonObject doc) {
+        Deployment deployment = ClusterCoordinator::instance().published();
+        if (deployment.taskId.length() > 0) {
+            JsonObject desired = doc.createNestedObject("desired_task");
+            desired["id"] = deployment.taskId;
+            if (deployment.paramsJson.length() > 0) {
+                JsonDocument paramsDoc;
+                DeserializationError err = deserializeJson(paramsDoc, deployment.paramsJson);
+                if (!err) {
+                    desired["params"] = paramsDoc.as<JsonObject>();
+                }
+            }
+        }
+        doc["desired_version"] = deployment.version;
+        doc["desired_origin"] = deployment.origin;
+        doc["start_at"] = deployment.startAt;
+        doc["start_requested"] = deployment.startAt != 0;
+        ClusterCoordinator::instance().populateStatus(doc.createNestedObject("cluster"));
+    }, true},
+
+    {"state", nullptr, 0, [](JsonObject doc) {
+        // Hardware Status
+        JsonObject hw = doc.createNestedObject("hardware");
+        hw["cc1101"] = HAL::instance().hasRadio();
+        hw["gps"] = HAL::instance().hasGPS();
+        hw["meshtastic"] = HAL::instance().hasMeshtastic();
+
+        // LED Status
+        JsonObject led = doc.createNestedObject("led");
+        led["power"] = HAL::instance().getLedPower();
+        JsonObject color = led.createNestedObject("color");
+        uint32_t c = HAL::instance().getLedColor();
+        color["r"] = (c >> 16) & 0xFF;
+        color["g"] = (c >> 8) & 0xFF;
+        color["b"] = c & 0xFF;
+
+        doc["status"] = Kernel::instance().getStatusMessage();
+        doc["task"] = PluginManager::instance().getActiveTaskName();
+    }, true},
+
+    // Queue Status: "elapsed" moves on its own, so it is at most a second old
+    {"queue", []() { return Scheduler::instance().version(); }, 1000, [](JsonObject doc) {
+        RadioTask current = Scheduler::instance().getCurrentTask();
+        JsonObject queueObj = doc.createNestedObject("queue");
+        JsonObject qCurr = queueObj.createNestedObject("current");
+        qCurr["id"] = current.id;
+        qCurr["plugin"] = current.pluginName;
+        qCurr["task"] = current.taskName;
+        qCurr["elapsed"] = millis() - current.startTime;
+        qCurr["duration"] = current.durationMs;
+        queueObj["depth"] = Scheduler::instance().queueDepth();
+    }, true},
+
+    // Aggregated Data
+    {"peers", []() { return PeerManager::instance().version(); }, 2000, [](JsonObject doc) {
+        JsonArray peers = doc.createNestedArray("peers");
+        PeerManager::instance().populatePeers(peers);
+    }, true},
+
+    // Push clients get new lines on the logs topic instead (push = false)
+    {"logs", []() { return Logger::instance().sequence(); }, StatusBuilder::kNoMaxAge, [](JsonObject doc) {
+        JsonArray logs = doc.createNestedArray("logs");
+        Logger::instance().populateLogs(logs);
+    }, false},
+
+    // Build time and reuse counts up to the previous request
+    {"status_build", nullptr, 0, [](JsonObject doc) {
+        gStatus->populateStats(doc.createNestedObject("status_build"));
+    }, false},
+
+    {"live", nullptr, 1000, [](JsonObject doc) {
+        gPush->populateStats(doc.createNestedObject("live"));
+    }, false},
+
+    // Chunked responses: sizes, the largest fragment held and the heap they took
+    {"streams", nullptr, 1000, [](JsonObject doc) {
+        JsonStream::populateStats(doc.createNestedObject("streams"));
+    }, false}
+};
+const size_t kStatusSectionCount = sizeof(kStatusSections) / sizeof(kStatusSections[0]);
+
+void addStatusSections(StatusBuilder& status, LivePush& push) {
+    gStatus = &status;
+    gPush = &push;
+    for (const StatusSection& s : kStatusSections) status.addSection(s.name, s.version, s.maxAgeMs, s.write, s.push);
+}
+
+void buildLocalReport(JsonDocument& doc) {
+    static unsigned long lastReportLog = 0;
+    const unsigned long now = millis();
+    const bool logNow = (now - lastReportLog) > 5000;
+
+    JsonObject task = doc.createNestedObject("task");
+    Deployment deployment = ClusterCoordinator::instance().applied();
+    if (deployment.taskId.length() > 0) {
+        task["id"] = deployment.taskId;
+        if (deployment.paramsJson.length() > 0) {
+            JsonDocument paramsDoc;
+            DeserializationError err = deserializeJson(paramsDoc, deployment.paramsJson);
+            if (!err) {
+                task["params"] = paramsDoc.as<JsonObject>();
+            }
+        }
+    }
+
+    JsonObject nodes = doc.createNestedObject("nodes");
+
+    // Self report
+    String selfName = Config::instance().getHostname();
+    JsonObject selfObj = nodes.createNestedObject(selfName);
+    selfObj["task"] = PluginManager::instance().getActiveTaskName();
+    ASEPlugin* active = PluginManager::instance().getActivePlugin();
+    if (active) {
+        JsonObject reportObj = selfObj.createNestedObject("report");
+        if (!active->getJsonData(reportObj)) {
+            selfObj.remove("report");
+            if (logNow) {
+                Logger::instance().warn("Report", "No report data from plugin: %s", active->getName().c_str());
+            }
+        } else {
+            if (logNow) {
+                Logger::instance().info("Report", "Report data collected from plugin: %s", active->getName().c_str());
+            }
+        }
+    } else {
+        if (logNow) {
+            Logger::instance().warn("Report", "No active plugin for report");
+        }
+    }
+    if (logNow) {
+        lastReportLog = now;
+    }
+}
+
+std::shared_ptr<JsonStream> streamLocalReport() {
+    return JsonStream::fragments([](uint32_t index, String& out) -> uint8_t {
+        if (index > 0) return JsonStream::FRAGMENT_END;
+        JsonDocument doc;
+        buildLocalReport(doc);
+        serializeJson(doc, out);
+        return JsonStream::FRAGMENT_READY;
+    });
+}
+
+std::shared_ptr<JsonStream> streamClusterReport(uint32_t round, unsigned long requestedAt, const String& selfName) {
+    ReportCursor cursor;
+    bool closed = false;
+    return JsonStream::fragments(
+        [round, requestedAt, selfName, cursor, closed](uint32_t index, String& out) mutable -> uint8_t {
+            if (index == 0) {
+                if (!ReportAggregator::instance().roundReady(round, requestedAt)) return JsonStream::FRAGMENT_WAIT;
+                if (!ReportAggregator::instance().pinRound(cursor)) return JsonStream::FRAGMENT_WAIT;
+                // {"task":{...},"nodes":{"self":{...}} without the closing braces
+                JsonDocument doc;
+                buildLocalReport(doc);
+                String local;
+                serializeJson(doc, local);
+                out.concat(local.c_str(), local.length() - 2);
+                cursor.first = false;
+                return JsonStream::FRAGMENT_READY;
+            }
+            if (closed) return JsonStream::FRAGMENT_END;
+            uint8_t result = ReportAggregator::instance().streamNodes(index - 1, cursor, selfName, out);
+            if (result != JsonStream::FRAGMENT_END) return result;
+            // The stats of the round the nodes came from, not of one finished since
+            JsonDocument gather;
+            if (cursor.round) ReportAggregator::populateGather(gather.to<JsonObject>(), cursor.round->stats);
+            else ReportAggregator::instance().populateGather(gather.to<JsonObject>());
+            String text;
+            serializeJson(gather, text);
+            out.concat("},\"gather\":");
+            out.concat(text);
+            out.concat('}');
+            closed = true;
+            return JsonStream::FRAGMENT_READY;
+        });
+}
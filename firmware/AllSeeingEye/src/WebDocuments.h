@@ -0,0 +1,50 @@
+#ifndef WEB_DOCUMENTS_H
+#define WEB_DOCUMENTS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <memory>
+#include "StatusBuilder.h"
+
+class JsonStream;
+class LivePush;
+
+// The JSON documents WebServer.cpp serves that need no web server: the
+// /api/status sections and the /api/report bodies. They live apart from
+// the routes so the host build compiles them, and status_bench and
+// stream_bench run the code that ships.
+
+// One /api/status section (StatusBuilder::addSection)
+struct StatusSection {
+    const char* name;
+    StatusBuilder::VersionFn version;
+    uint32_t maxAgeMs;
+    StatusBuilder::WriteFn write;
+    bool push;
+};
+
+// The sections in document order. A key sits in the section whose version
+// covers it (clusterName in identity, with the other config keys), so the
+// order is not the single-document builder's. maxAgeMs bounds how stale
+// time-derived values (ages, elapsed times, clock estimates) in a versioned
+// section can get.
+extern const StatusSection kStatusSections[];
+extern const size_t kStatusSectionCount;
+
+// Adds every section to status. The status_build and live sections report
+// on status and push, so only one builder can be set up at a time.
+void addStatusSections(StatusBuilder& status, LivePush& push);
+
+// Task and this node's plugin report: all of /api/report?local=1, and the
+// base the cluster report adds peer nodes to.
+void buildLocalReport(JsonDocument& doc);
+
+// /api/report?local=1 in one fragment: the document is freed before its text is sent
+std::shared_ptr<JsonStream> streamLocalReport();
+
+// /api/report: waits for round (ReportAggregator::requestRound) to be ready,
+// then this node's report, one peer's nodes per fragment from the round it
+// pinned, and that round's gather stats.
+std::shared_ptr<JsonStream> streamClusterReport(uint32_t round, unsigned long requestedAt, const String& selfName);
+
+#endif
@@ -1,6 +1,7 @@
 #include "WebServer.h"
 #include <LittleFS.h>
 #include "WebStatic.h" // Include generated HTML header
+#include "TaskCatalogJson.h" // Generated /api/task body
 #include "BuildVersion.h" // Include generated Build ID
 #include "Kernel.h" // For status access
 #include "HAL.h" // Add HAL for Hardware Status
@@ -14,47 +15,199 @@
 #include "Scheduler.h" // Add scheduler
 #include "Geolocation.h"
 #include "BleRangingManager.h"
-#include <HTTPClient.h>
+#include "SpectrumFrame.h"
+#include "WaterfallStore.h"
+#include "ReportAggregator.h"
+#include "ClockSync.h"
+#include "ClusterCoordinator.h"
+#include "JsonStream.h"
+#include "HttpMetrics.h"
+#include "WebDocuments.h"
+#include <memory>
+
+namespace {
+
+const char* methodName(WebRequestMethodComposite method) {
+    switch (method) {
+        case HTTP_GET: return "GET";
+        case HTTP_POST: return "POST";
+        default: return "ANY";
+    }
+}
+
+// Counts and times a route's handler in /api/metrics (HttpMetrics.h)
+template <typename Handler>
+auto metered(const char* path, WebRequestMethodComposite method, Handler handler) {
+    uint8_t route = HttpMetrics::instance().addRoute(path, methodName(method));
+    if (route == HttpMetrics::kNoRoute) {
+        Logger::instance().warn("Web", "No metrics slot for %s", path);
+    }
+    return [route, handler](AsyncWebServerRequest *request, auto&... args) {
+        HttpMetrics::Scope scope(route);
+        handler(request, args...);
+    };
+}
+
+void on(AsyncWebServer& server, const char* path, WebRequestMethodComposite method, ArRequestHandlerFunction handler) {
+    server.on(path, method, metered(path, method, handler));
+}
+
+// A whole body, counted against the running route
+void sendBody(AsyncWebServerRequest *request, int code, const char* type, const String& body) {
+    HttpMetrics::instance().addBytes(body.length());
+    request->send(code, type, body);
+}
+
+// Serves a JsonStream (JsonStream.h) as a chunked response
+void sendStream(AsyncWebServerRequest *request, std::shared_ptr<JsonStream> stream,
+                const char* type = "application/json") {
+    // The body is produced after the handler returned: its bytes and the
+    // time until its last one go to the route here
+    std::shared_ptr<HttpMetrics::Deferred> timing = HttpMetrics::instance().defer();
+    AsyncWebServerResponse *response = request->beginChunkedResponse(type,
+        [stream, timing](uint8_t *out, size_t maxLen, size_t index) -> size_t {
+            size_t n = stream->read(out, maxLen);
+            if (n == JsonStream::kWait) return RESPONSE_TRY_AGAIN;
+            HttpMetrics::instance().addBytes(timing->route(), n);
+            if (n == 0) timing->finish();
+            return n;
+        });
+    request->send(response);
+}
+
+} // namespace
 
 WebServerManager& WebServerManager::instance() {
     static WebServerManager _instance;
     return _instance;
 }
 
-WebServerManager::WebServerManager() : _server(80) {}
+WebServerManager::WebServerManager() : _server(80), _ws("/api/live"), _transport(_ws) {}
 
 void WebServerManager::begin() {
     DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
     
+    addStatusSections(_status, _push);
+    setupLive();
     setupRoutes();
     _server.begin();
     Serial.println("[Web] Async Server Started on Port 80");
 }
 
+void WebServerManager::loop() {
+    _push.loop();
+    // Frees the slots of clients that went away without a close frame
+    static unsigned long lastCleanup = 0;
+    if (millis() - lastCleanup > 1000) {
+        lastCleanup = millis();
+        _ws.cleanupClients(LivePush::kMaxClients);
+    }
+}
+
+size_t WebServerManager::SocketTransport::pending(uint32_t client) {
+    AsyncWebSocketClient* c = _ws.client(client);
+    if (!c || c->status() != WS_CONNECTED) return LivePush::kMaxPending;
+    return c->queueLen();
+}
+
+bool WebServerManager::SocketTransport::sendText(uint32_t client, const char* data, size_t len) {
+    AsyncWebSocketClient* c = _ws.client(client);
+    if (!c || c->status() != WS_CONNECTED) return false;
+    c->text(data, len);
+    return true;
+}
+
+bool WebServerManager::SocketTransport::sendBinary(uint32_t client, const uint8_t* data, size_t len) {
+    AsyncWebSocketClient* c = _ws.client(client);
+    if (!c || c->status() != WS_CONNECTED) return false;
+    c->binary((uint8_t*)data, len);
+    return true;
+}
+
+// WebSocket /api/live (LivePush.h). Clients get every topic until they send
+// a subscription, e.g. {"subscribe":["status","logs"]}.
+void WebServerManager::setupLive() {
+    _push.begin(&_status, &_transport, [](uint8_t* out, size_t capacity) -> size_t {
+        ASEPlugin* active = PluginManager::instance().getActivePlugin();
+        return active ? active->getSpectrumFrame(out, capacity, SPECTRUM_BINS_INT8) : 0;
+    });
+
+    _ws.onEvent([this](AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                       uint8_t* data, size_t len) {
+        if (type == WS_EVT_CONNECT) {
+            if (!_push.addClient(client->id())) {
+                Logger::instance().warn("Live", "Client %u refused, %u connected", client->id(), _push.clientCount());
+                client->close();
+                return;
+            }
+            Logger::instance().info("Live", "Client %u connected from %s", client->id(),
+                                    client->remoteIP().toString().c_str());
+        } else if (type == WS_EVT_DISCONNECT) {
+            _push.removeClient(client->id());
+        } else if (type == WS_EVT_DATA) {
+            AwsFrameInfo* info = (AwsFrameInfo*)arg;
+            // Subscriptions are short: a single text frame
+            if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT || len > 128) return;
+            char text[129];
+            memcpy(text, data, len);
+            text[len] = '\0';
+            uint8_t topics = LivePush::parseTopics(text);
+            if (topics != 0) _push.setTopics(client->id(), topics);
+        }
+    });
+    _server.addHandler(&_ws);
+}
+
 void WebServerManager::setupRoutes() {
     // --------------------------------------------------
     // 1. Specific API Endpoints (Register First)
     // --------------------------------------------------
 
+    // API: Peer Status (what peers probe; registered before /api/status, which would match it too)
+    on(_server, PeerManager::kPeerStatusPath, HTTP_GET, [](AsyncWebServerRequest *request){
+        // Unchanged since the caller's copy: 304 without a body
+        String etag = Kernel::instance().getPeerStatusEtag();
+        if (etag.length() > 0 && request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+            AsyncWebServerResponse *response = request->beginResponse(304);
+            response->addHeader("ETag", etag);
+            request->send(response);
+            return;
+        }
+
+        String body;
+        if (!Kernel::instance().getPeerStatus(body, etag)) {
+            sendBody(request, 503, "application/json", "{\"status\":\"error\", \"message\":\"Starting\"}");
+            return;
+        }
+        HttpMetrics::instance().addBytes(body.length());
+        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", body);
+        response->addHeader("ETag", etag);
+        request->send(response);
+    });
+
     // API: Status
-    _server.on("/api/status", HTTP_GET, [this](AsyncWebServerRequest *request){
+    on(_server, "/api/status", HTTP_GET, [this](AsyncWebServerRequest *request){
         static unsigned long lastStatusLog = 0;
         if (millis() - lastStatusLog > 10000) {
             Logger::instance().info("API", "GET /api/status");
             lastStatusLog = millis();
         }
-        request->send(200, "application/json", this->getCachedStatus());
+        // Straight from the section fragments, a piece per fragment
+        std::shared_ptr<StatusStream> cursor = std::make_shared<StatusStream>();
+        sendStream(request, JsonStream::fragments([this, cursor](uint32_t, String& out) -> uint8_t {
+            return this->_status.streamFragment(*cursor, out);
+        }));
     });
 
     // API: Configuration (GET)
-    _server.on("/api/config", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/config", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api/config");
         String response = Config::instance().getAllAsJson();
-        request->send(200, "application/json", response);
+        sendBody(request, 200, "application/json", response);
     });
 
     // API: Configuration (POST)
-    AsyncCallbackJsonWebHandler *handler = new AsyncCallbackJsonWebHandler("/api/config", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    AsyncCallbackJsonWebHandler *handler = new AsyncCallbackJsonWebHandler("/api/config", metered("/api/config", HTTP_POST, [](AsyncWebServerRequest *request, JsonVariant &json) {
         Logger::instance().info("API", "POST /api/config");
         String jsonStr;
         serializeJson(json, jsonStr);
@@ -67,58 +220,55 @@ void WebServerManager::setupRoutes() {
                 Kernel::instance().applyTimezone(timezone);
                 Logger::instance().info("Kernel", "Timezone updated: %s", timezone.c_str());
             }
-            request->send(200, "application/json", "{\"status\":\"success\", \"message\":\"Config Updated. Reboot to apply network changes.\"}");
+            if (obj.containsKey("peer_ignore_hours")) {
+                PeerManager::instance().reloadConfig();
+            }
+            sendBody(request, 200, "application/json", "{\"status\":\"success\", \"message\":\"Config Updated. Reboot to apply network changes.\"}");
             // Optional: Config::instance().save(); // Preferences are auto-saved in close/put
         } else {
             Logger::instance().error("Config", "JSON parsing failed");
-            request->send(400, "application/json", "{\"status\":\"error\", \"message\":\"Invalid JSON\"}");
+            sendBody(request, 400, "application/json", "{\"status\":\"error\", \"message\":\"Invalid JSON\"}");
         }
-    });
+    }));
     _server.addHandler(handler);
 
     // API: File System Index
-    _server.on("/api/fs", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/fs", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api/fs");
-        JsonDocument doc;
-        JsonArray files = doc.to<JsonArray>();
-
-        File root = LittleFS.open("/");
-        File file = root.openNextFile();
-        while(file){
-            JsonObject f = files.add<JsonObject>();
-            f["name"] = String(file.name());
-            f["size"] = file.size();
-            file = root.openNextFile();
-        }
-        
-        String response;
-        serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        // The directory stays open while the listing streams, one entry per element
+        std::shared_ptr<File> root = std::make_shared<File>(LittleFS.open("/"));
+        sendStream(request, JsonStream::array([root](uint32_t, JsonDocument& doc) {
+            File file = root->openNextFile();
+            if (!file) return false;
+            doc["name"] = String(file.name());
+            doc["size"] = file.size();
+            return true;
+        }));
     });
 
     // API: Peers (Discovery)
-    _server.on("/api/peers", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/peers", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api/peers");
         // Passive Discovery: Check who is calling us
         PeerManager::instance().trackIncomingRequest(request->client()->remoteIP().toString());
         
         String response = PeerManager::instance().getPeersAsJson();
-        request->send(200, "application/json", response);
+        sendBody(request, 200, "application/json", response);
     });
 
     // API: BLE Ranging (Latest Scan)
-    _server.on("/api/ranging/ble", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/ranging/ble", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api/ranging/ble");
         JsonDocument doc;
         JsonObject ble = doc.to<JsonObject>();
         BleRangingManager::instance().populateStatus(ble);
         String response;
         serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        sendBody(request, 200, "application/json", response);
     });
 
     // API: Utils - Ping
-    _server.on("/api/ping", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/ping", HTTP_GET, [](AsyncWebServerRequest *request){
         if (request->hasParam("target")) {
             String target = request->getParam("target")->value();
             Logger::instance().info("API", "GET /api/ping target=%s", target.c_str());
@@ -130,55 +280,46 @@ void WebServerManager::setupRoutes() {
             
             String res;
             serializeJson(doc, res);
-            request->send(200, "application/json", res);
+            sendBody(request, 200, "application/json", res);
         } else {
             Logger::instance().warn("API", "GET /api/ping missing target");
-            request->send(400, "application/json", "{\"error\":\"Missing 'target' parameter\"}");
+            sendBody(request, 400, "application/json", "{\"error\":\"Missing 'target' parameter\"}");
         }
     });
 
     // API: System Head Logs (Startup Logs)
     // NOTE: Must be registered BEFORE /api/logs to avoid routing shadow
-    _server.on("/api/logs/head", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/logs/head", HTTP_GET, [](AsyncWebServerRequest *request){
         static unsigned long lastHeadLogsLog = 0;
         if (millis() - lastHeadLogsLog > 5000) {
             Logger::instance().info("API", "GET /api/logs/head");
             lastHeadLogsLog = millis();
         }
-        JsonDocument doc;
-        JsonArray logs = doc.to<JsonArray>();
-        
-        std::deque<String> logBuffer = Logger::instance().getHeadLogs();
-        
-        for(const auto& line : logBuffer) {
-            logs.add(line);
-        }
-        
-        String response;
-        serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        sendStream(request, JsonStream::array([](uint32_t index, JsonDocument& doc) {
+            String line;
+            if (!Logger::instance().copyHeadLog(index, line)) return false;
+            doc.set(line);
+            return true;
+        }));
     });
 
     // API: System Logs
-    _server.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/logs", HTTP_GET, [](AsyncWebServerRequest *request){
         static unsigned long lastLogsLog = 0;
         if (millis() - lastLogsLog > 5000) {
             Logger::instance().info("API", "GET /api/logs");
             lastLogsLog = millis();
         }
-        JsonDocument doc;
-        JsonArray logs = doc.to<JsonArray>();
-        
-        std::deque<String> logBuffer = Logger::instance().getLogs();
-        
-        // Return logs in insertion order
-        for(const auto& line : logBuffer) {
-            logs.add(line);
-        }
-        
-        String response;
-        serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        // Return logs in insertion order, up to the last line at the request; a line that
+        // rotates out of the buffer before its chunk is sent is skipped
+        uint32_t seq = 0;
+        uint32_t end = Logger::instance().sequence();
+        sendStream(request, JsonStream::array([seq, end](uint32_t, JsonDocument& doc) mutable {
+            String line;
+            if (!Logger::instance().copyLogAfter(seq, end, line)) return false;
+            doc.set(line);
+            return true;
+        }));
     });
 
     // --------------------------------------------------
@@ -186,61 +327,12 @@ void WebServerManager::setupRoutes() {
     // --------------------------------------------------
 
     // GET /api/task - Discovery
-    _server.on("/api/task", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/task", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api/task");
-        JsonDocument doc;
-        JsonArray arr = doc.to<JsonArray>();
-        
-        std::vector<TaskDefinition> tasks = PluginManager::instance().getTaskCatalog();
-        
-        for(const auto& t : tasks) {
-            JsonObject obj = arr.add<JsonObject>();
-            obj["id"] = t.id;
-            obj["name"] = t.name;
-            obj["description"] = t.description;
-            obj["plugin"] = t.pluginName;
-            obj["link"] = t.endpoint;
-            if (!t.inputs.empty()) {
-                JsonArray inputs = obj.createNestedArray("inputs");
-                for (const auto& input : t.inputs) {
-                    JsonObject inputObj = inputs.add<JsonObject>();
-                    inputObj["name"] = input.name;
-                    inputObj["label"] = input.label;
-                    inputObj["type"] = input.type;
-                    if (input.required) {
-                        inputObj["required"] = true;
-                    }
-                    if (input.defaultType == INPUT_VALUE_NUMBER) {
-                        inputObj["default"] = input.defaultNumber;
-                    } else if (input.defaultType == INPUT_VALUE_BOOL) {
-                        inputObj["default"] = input.defaultBool;
-                    } else if (input.defaultType == INPUT_VALUE_TEXT) {
-                        inputObj["default"] = input.defaultText;
-                    }
-                    if (input.hasStep) {
-                        inputObj["step"] = input.step;
-                    }
-                    if (input.hasMin) {
-                        inputObj["min"] = input.min;
-                    }
-                    if (input.hasMax) {
-                        inputObj["max"] = input.max;
-                    }
-                    if (!input.options.empty()) {
-                        JsonArray options = inputObj.createNestedArray("options");
-                        for (const auto& opt : input.options) {
-                            JsonObject optObj = options.add<JsonObject>();
-                            optObj["label"] = opt.label;
-                            optObj["value"] = opt.value;
-                        }
-                    }
-                }
-            }
-        }
-
-        String response;
-        serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        // Serialized at build time, sent straight from flash
+        HttpMetrics::instance().addBytes(task_catalog_json_len);
+        request->send(request->beginResponse_P(200, "application/json", (const uint8_t*)task_catalog_json,
+                                               task_catalog_json_len));
     });
 
     // POST /api/task/{taskId} - Execution
@@ -253,22 +345,22 @@ void WebServerManager::setupRoutes() {
     // Pros: Explicit.
     
     // Better: One Handler for /api/task/* to give instructions
-    _server.on("/api/task", HTTP_POST, [](AsyncWebServerRequest *request){
-         request->send(400, "application/json", "{\"error\":\"Use specific task endpoints e.g. /api/task/ble-ranging/survey\"}");
+    on(_server, "/api/task", HTTP_POST, [](AsyncWebServerRequest *request){
+         sendBody(request, 400, "application/json", "{\"error\":\"Use specific task endpoints e.g. /api/task/ble-ranging/survey\"}");
     });
     
     // Loop to register handlers for catalog items
-    std::vector<TaskDefinition> tasks = PluginManager::instance().getTaskCatalog();
-    for(const auto& t : tasks) {
-         AsyncCallbackJsonWebHandler *h = new AsyncCallbackJsonWebHandler(t.endpoint.c_str(), [t](AsyncWebServerRequest *request, JsonVariant &json) {
-            Logger::instance().info("API", "Starting Task: %s", t.id.c_str());
+    for (size_t i = 0; i < PluginManager::taskCount(); ++i) {
+         const TaskDefinition* t = &PluginManager::task(i);
+         AsyncCallbackJsonWebHandler *h = new AsyncCallbackJsonWebHandler(t->endpoint, metered(t->endpoint, HTTP_POST, [t](AsyncWebServerRequest *request, JsonVariant &json) {
+            Logger::instance().info("API", "Starting Task: %s", t->id);
             JsonObject params = json.as<JsonObject>();
-            if (PluginManager::instance().startTask(t.id, params)) {
-                 request->send(200, "application/json", "{\"status\":\"started\", \"taskId\":\"" + t.id + "\"}");
+            if (PluginManager::instance().startTask(t->id, params)) {
+                 sendBody(request, 200, "application/json", String("{\"status\":\"started\", \"taskId\":\"") + t->id + "\"}");
             } else {
-                 request->send(500, "application/json", "{\"error\":\"Failed to start task\"}");
+                 sendBody(request, 500, "application/json", "{\"error\":\"Failed to start task\"}");
             }
-        });
+        }));
         _server.addHandler(h);
     }
 
@@ -276,7 +368,7 @@ void WebServerManager::setupRoutes() {
     // API: Cluster Deploy / Start
     // --------------------------------------------------
 
-    AsyncCallbackJsonWebHandler *deployHandler = new AsyncCallbackJsonWebHandler("/api/cluster/deploy", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    AsyncCallbackJsonWebHandler *deployHandler = new AsyncCallbackJsonWebHandler("/api/cluster/deploy", metered("/api/cluster/deploy", HTTP_POST, [](AsyncWebServerRequest *request, JsonVariant &json) {
         Logger::instance().info("API", "POST /api/cluster/deploy");
         JsonObject obj = json.as<JsonObject>();
         String taskId = obj["task"] | obj["id"] | "";
@@ -287,118 +379,182 @@ void WebServerManager::setupRoutes() {
         }
 
         if (taskId.length() == 0) {
-            request->send(400, "application/json", "{\"error\":\"Missing task id\"}");
+            sendBody(request, 400, "application/json", "{\"error\":\"Missing task id\"}");
+            return;
+        }
+
+        if (!PluginManager::findTask(taskId.c_str())) {
+            sendBody(request, 400, "application/json", "{\"error\":\"Unknown task id\"}");
             return;
         }
 
         String paramsJson;
         serializeJson(paramsDoc, paramsJson);
 
-        Kernel::instance().setDesiredTask(taskId, paramsJson);
-        Kernel::instance().setStartRequested(false);
-
-        JsonObject params = paramsDoc.as<JsonObject>();
-        if (!PluginManager::instance().deployTask(taskId, params)) {
-            request->send(500, "application/json", "{\"error\":\"Failed to deploy task\"}");
+        // Applied by the cluster leader, then by every node (ClusterCoordinator.h)
+        uint32_t version = ClusterCoordinator::instance().propose(taskId, paramsJson);
+        if (version == 0) {
+            sendBody(request, 503, "application/json", "{\"error\":\"Coordinator busy\"}");
             return;
         }
 
-        request->send(200, "application/json", "{\"status\":\"deploying\", \"taskId\":\"" + taskId + "\"}");
-    });
+        JsonDocument doc;
+        doc["status"] = "deploying";
+        doc["taskId"] = taskId;
+        doc["version"] = version;
+        uint32_t leader = ClusterCoordinator::instance().leader();
+        doc["leader"] = leader != 0 ? IPAddress(leader).toString() : String("");
+        String response;
+        serializeJson(doc, response);
+        sendBody(request, 200, "application/json", response);
+    }));
     _server.addHandler(deployHandler);
 
-    _server.on("/api/cluster/start", HTTP_POST, [](AsyncWebServerRequest *request) {
+    on(_server, "/api/cluster/start", HTTP_POST, [](AsyncWebServerRequest *request) {
         Logger::instance().info("API", "POST /api/cluster/start");
-        if (Kernel::instance().getDesiredTaskId().length() == 0) {
-            request->send(400, "application/json", "{\"error\":\"No desired task staged\"}");
+        uint32_t startAt = 0;
+        uint32_t version = ClusterCoordinator::instance().requestStart(startAt);
+        if (version == 0) {
+            sendBody(request, 400, "application/json", "{\"error\":\"No desired task staged\"}");
             return;
         }
-        Kernel::instance().setStartRequested(true);
-        PluginManager::instance().startStagedTask();
-        request->send(200, "application/json", "{\"status\":\"started\"}");
+        // Every node starts at the same consensus second (ClockSync.h)
+        JsonDocument doc;
+        doc["status"] = "starting";
+        doc["start_at"] = startAt;
+        doc["version"] = version;
+        String response;
+        serializeJson(doc, response);
+        sendBody(request, 200, "application/json", response);
     });
 
-    _server.on("/api/report", HTTP_GET, [](AsyncWebServerRequest *request) {
+    on(_server, "/api/report", HTTP_GET, [](AsyncWebServerRequest *request) {
         Logger::instance().info("API", "GET /api/report");
         bool localOnly = request->hasParam("local") && request->getParam("local")->value() == "1";
-        static unsigned long lastReportLog = 0;
-        const unsigned long now = millis();
-        const bool logNow = (now - lastReportLog) > 5000;
-
-        JsonDocument doc;
-        JsonObject task = doc.createNestedObject("task");
-        String desiredTaskId = Kernel::instance().getDesiredTaskId();
-        String desiredParamsJson = Kernel::instance().getDesiredTaskParamsJson();
-        if (desiredTaskId.length() > 0) {
-            task["id"] = desiredTaskId;
-            if (desiredParamsJson.length() > 0) {
-                JsonDocument paramsDoc;
-                DeserializationError err = deserializeJson(paramsDoc, desiredParamsJson);
-                if (!err) {
-                    task["params"] = paramsDoc.as<JsonObject>();
-                }
-            }
+        if (localOnly) {
+            sendStream(request, streamLocalReport());
+            return;
         }
 
-        JsonObject nodes = doc.createNestedObject("nodes");
-
-        // Self report
+        // Peers are gathered on Kernel::loop (ReportAggregator). The response
+        // starts once that round ends or hits its deadline; until then the
+        // callback asks the TCP task to come back later. Then this node's
+        // report, one peer's nodes per fragment, and the gather stats.
+        uint32_t round = ReportAggregator::instance().requestRound();
+        unsigned long requestedAt = millis();
         String selfName = Config::instance().getHostname();
-        JsonObject selfObj = nodes.createNestedObject(selfName);
-        selfObj["task"] = PluginManager::instance().getActiveTaskName();
-        ASEPlugin* active = PluginManager::instance().getActivePlugin();
-        if (active) {
-            JsonObject reportObj = selfObj.createNestedObject("report");
-            if (!active->getJsonData(reportObj)) {
-                selfObj.remove("report");
-                if (logNow) {
-                    Logger::instance().warn("Report", "No report data from plugin: %s", active->getName().c_str());
-                }
-            } else {
-                if (logNow) {
-                    Logger::instance().info("Report", "Report data collected from plugin: %s", active->getName().c_str());
-                }
+        sendStream(request, streamClusterReport(round, requestedAt, selfName));
+    });
+
+    // API: Binary spectrum frame of the last completed sweep (see SpectrumFrame.h)
+    // GET /api/spectrum/frame?bins=int8|int16&channel=live|max_hold|min_hold|average|occupancy_pct|sample_max|sample_variance_db2&times=1
+    on(_server, "/api/spectrum/frame", HTTP_GET, [](AsyncWebServerRequest *request) {
+        uint8_t binFormat = SPECTRUM_BINS_INT8;
+        if (request->hasParam("bins") && request->getParam("bins")->value() == "int16") {
+            binFormat = SPECTRUM_BINS_INT16;
+        }
+        int channel = -1;
+        if (request->hasParam("channel")) {
+            String name = request->getParam("channel")->value();
+            for (uint8_t c = 0; c < kSweepChannels; ++c) {
+                if (name == sweepChannelName(c)) channel = c;
             }
-        } else {
-            if (logNow) {
-                Logger::instance().warn("Report", "No active plugin for report");
+            if (channel < 0) {
+                sendBody(request, 400, "application/json", "{\"error\":\"Unknown channel\"}");
+                return;
             }
         }
-        if (logNow) {
-            lastReportLog = now;
+        bool withTimes = request->hasParam("times") && request->getParam("times")->value() == "1";
+
+        ASEPlugin* active = PluginManager::instance().getActivePlugin();
+        if (!active) {
+            sendBody(request, 404, "application/json", "{\"error\":\"No active plugin\"}");
+            return;
+        }
+
+        uint8_t frame[kSpectrumFrameMaxBytes];
+        size_t len = active->getSpectrumFrame(frame, sizeof(frame), binFormat, channel, withTimes);
+        if (len == 0) {
+            request->send(204);
+            return;
         }
 
-        if (!localOnly) {
-            std::vector<Peer> peers;
-            PeerManager::instance().getPeersSnapshot(peers);
-            for (const auto& p : peers) {
-                if (!p.online || p.ip.length() == 0) continue;
-
-                HTTPClient http;
-                http.setTimeout(1500);
-                String url = "http://" + p.ip + "/api/report?local=1";
-                http.begin(url);
-                int code = http.GET();
-                if (code == 200) {
-                    String payload = http.getString();
-                    JsonDocument peerDoc;
-                    DeserializationError err = deserializeJson(peerDoc, payload);
-                    if (!err) {
-                        JsonObject peerNodes = peerDoc["nodes"];
-                        if (!peerNodes.isNull()) {
-                            for (JsonPair kv : peerNodes) {
-                                nodes[kv.key().c_str()] = kv.value();
-                            }
-                        }
-                    }
-                }
-                http.end();
-            }
+        AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+        response->write(frame, len);
+        HttpMetrics::instance().addBytes(len);
+        request->send(response);
+    });
+
+    // API: Detected emissions from the active spectrum task (see SpectrumDetector.h)
+    // GET /api/spectrum/events?since=<seq>
+    on(_server, "/api/spectrum/events", HTTP_GET, [](AsyncWebServerRequest *request) {
+        ASEPlugin* active = PluginManager::instance().getActivePlugin();
+        if (!active) {
+            sendBody(request, 404, "application/json", "{\"error\":\"No active plugin\"}");
+            return;
         }
+        uint32_t since = request->hasParam("since") ? (uint32_t)request->getParam("since")->value().toInt() : 0;
 
+        JsonDocument doc;
+        JsonObject root = doc.to<JsonObject>();
+        if (!active->getSpectrumEvents(root, since)) {
+            request->send(204);
+            return;
+        }
         String response;
         serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        sendBody(request, 200, "application/json", response);
+    });
+
+    // API: Sweep history from the PSRAM waterfall (see WaterfallStore.h)
+    // GET /api/spectrum/waterfall?from=&to=|last=600&tdec=1&fdec=1&mode=max|mean&max_bytes=
+    on(_server, "/api/spectrum/waterfall", HTTP_GET, [](AsyncWebServerRequest *request) {
+        WaterfallInfo history = WaterfallStore::instance().info();
+        if (history.rows == 0) {
+            request->send(204);
+            return;
+        }
+
+        WaterfallQuery query;
+        if (request->hasParam("from") || request->hasParam("to")) {
+            if (request->hasParam("from")) query.fromEpoch = (uint32_t)request->getParam("from")->value().toInt();
+            if (request->hasParam("to")) query.toEpoch = (uint32_t)request->getParam("to")->value().toInt();
+        } else {
+            uint32_t lastSec = request->hasParam("last") ? (uint32_t)request->getParam("last")->value().toInt() : 600;
+            query.fromEpoch = history.newestEpoch > lastSec ? history.newestEpoch - lastSec : 0;
+        }
+        if (request->hasParam("tdec")) query.timeDecimation = (uint16_t)request->getParam("tdec")->value().toInt();
+        if (request->hasParam("fdec")) query.freqDecimation = (uint16_t)request->getParam("fdec")->value().toInt();
+        if (request->hasParam("mode") && request->getParam("mode")->value() == "mean") query.mode = WATERFALL_MEAN;
+        if (request->hasParam("max_bytes")) query.maxBytes = (size_t)request->getParam("max_bytes")->value().toInt();
+
+        size_t planned = WaterfallStore::instance().plan(query);
+        if (planned == 0) {
+            request->send(204);
+            return;
+        }
+
+        // Encoded once into PSRAM, then streamed out by the TCP task as it drains.
+        std::shared_ptr<uint8_t> buffer((uint8_t*)heap_caps_malloc(planned, MALLOC_CAP_SPIRAM), heap_caps_free);
+        if (!buffer) buffer.reset((uint8_t*)malloc(planned), free);
+        if (!buffer) {
+            sendBody(request, 503, "application/json", "{\"error\":\"Out of memory\"}");
+            return;
+        }
+        size_t len = WaterfallStore::instance().encode(query, buffer.get(), planned);
+        if (len == 0) {
+            request->send(204);
+            return;
+        }
+
+        AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", len,
+            [buffer, len](uint8_t *out, size_t maxLen, size_t index) -> size_t {
+                size_t chunk = min(maxLen, len - index);
+                memcpy(out, buffer.get() + index, chunk);
+                return chunk;
+            });
+        HttpMetrics::instance().addBytes(len);
+        request->send(response);
     });
 
     // --------------------------------------------------
@@ -406,7 +562,7 @@ void WebServerManager::setupRoutes() {
     // --------------------------------------------------
     
     // GET /api/led?r=255&g=0&b=0
-    _server.on("/api/led", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/led", HTTP_GET, [](AsyncWebServerRequest *request){
         if(request->hasParam("r") && request->hasParam("g") && request->hasParam("b")) {
             int r = request->getParam("r")->value().toInt();
             int g = request->getParam("g")->value().toInt();
@@ -428,27 +584,27 @@ void WebServerManager::setupRoutes() {
         
         String res;
         serializeJson(doc, res);
-        request->send(200, "application/json", res);
+        sendBody(request, 200, "application/json", res);
     });
 
     // POST /api/led/on
-    _server.on("/api/led/on", HTTP_POST, [](AsyncWebServerRequest *request){
+    on(_server, "/api/led/on", HTTP_POST, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "POST /api/led/on");
         HAL::instance().setLedPower(true);
-        request->send(200, "application/json", "{\"status\":\"success\", \"power\":true}");
+        sendBody(request, 200, "application/json", "{\"status\":\"success\", \"power\":true}");
     });
 
     // POST /api/led/off
-    _server.on("/api/led/off", HTTP_POST, [](AsyncWebServerRequest *request){
+    on(_server, "/api/led/off", HTTP_POST, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "POST /api/led/off");
         HAL::instance().setLedPower(false);
-        request->send(200, "application/json", "{\"status\":\"success\", \"power\":false}");
+        sendBody(request, 200, "application/json", "{\"status\":\"success\", \"power\":false}");
     });
 
     // --------------------------------------------------
     // API: Queue (Task Scheduler)
     // --------------------------------------------------
-    _server.on("/api/queue", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api/queue", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api/queue");
         JsonDocument doc;
         
@@ -474,13 +630,34 @@ void WebServerManager::setupRoutes() {
 
         String response;
         serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        sendBody(request, 200, "application/json", response);
+    });
+
+    // --------------------------------------------------
+    // API: Metrics (Prometheus text format, see HttpMetrics.h)
+    // --------------------------------------------------
+    on(_server, "/api/metrics", HTTP_GET, [this](AsyncWebServerRequest *request){
+        // Per route, then heap and the status cache; one family piece per fragment
+        sendStream(request, JsonStream::fragments([this](uint32_t index, String& out) -> uint8_t {
+            if (HttpMetrics::instance().writeFragment(index, out)) return JsonStream::FRAGMENT_READY;
+            if (index > HttpMetrics::instance().fragmentCount()) return JsonStream::FRAGMENT_END;
+            uint32_t built = 0, reused = 0;
+            this->_status.cacheCounts(built, reused);
+            HttpMetrics::writeMetric(out, "ase_status_sections_built_total", "counter",
+                                     "/api/status sections regenerated.", built);
+            HttpMetrics::writeMetric(out, "ase_status_sections_reused_total", "counter",
+                                     "/api/status sections served from their cached fragment.", reused);
+            HttpMetrics::writeMetric(out, "ase_status_cache_hit_ratio", "gauge",
+                                     "Share of /api/status sections served from cache since boot.",
+                                     built + reused > 0 ? (float)reused / (float)(built + reused) : 0.0f);
+            return JsonStream::FRAGMENT_READY;
+        }), "text/plain; version=0.0.4; charset=utf-8");
     });
 
     // --------------------------------------------------
     // 2. Generic API Endpoint (Discovery)
     // --------------------------------------------------
-    _server.on("/api", HTTP_GET, [](AsyncWebServerRequest *request){
+    on(_server, "/api", HTTP_GET, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "GET /api");
         JsonDocument doc;
         JsonArray routes = doc.to<JsonArray>();
@@ -495,6 +672,16 @@ void WebServerManager::setupRoutes() {
         r2["method"] = "GET";
         r2["desc"] = "System health stats (RAM, Uptime)";
 
+        JsonObject rLive = routes.add<JsonObject>();
+        rLive["path"] = "/api/live";
+        rLive["method"] = "WS";
+        rLive["desc"] = "Push channel: status deltas, log lines, binary sweep frames (send {\"subscribe\":[\"status\",\"logs\",\"sweeps\"]})";
+
+        JsonObject r2p = routes.add<JsonObject>();
+        r2p["path"] = PeerManager::kPeerStatusPath;
+        r2p["method"] = "GET";
+        r2p["desc"] = "Minimal status for peer probes (ETag, If-None-Match -> 304)";
+
         JsonObject r3 = routes.add<JsonObject>();
         r3["path"] = "/api/config";
         r3["method"] = "GET/POST";
@@ -525,6 +712,21 @@ void WebServerManager::setupRoutes() {
         rBle["method"] = "GET";
         rBle["desc"] = "Get latest BLE ranging scan results";
 
+        JsonObject rFrame = routes.add<JsonObject>();
+        rFrame["path"] = "/api/spectrum/frame";
+        rFrame["method"] = "GET";
+        rFrame["desc"] = "Last sweep as a binary frame (?bins=int8|int16&channel=live|max_hold|min_hold|average|occupancy_pct|sample_max|sample_variance_db2&times=1)";
+
+        JsonObject rEvents = routes.add<JsonObject>();
+        rEvents["path"] = "/api/spectrum/events";
+        rEvents["method"] = "GET";
+        rEvents["desc"] = "Detected emissions after an event sequence number (?since=)";
+
+        JsonObject rWaterfall = routes.add<JsonObject>();
+        rWaterfall["path"] = "/api/spectrum/waterfall";
+        rWaterfall["method"] = "GET";
+        rWaterfall["desc"] = "Sweep history, decimated (?from=&to=|last=&tdec=&fdec=&mode=max|mean)";
+
         JsonObject rLed = routes.add<JsonObject>();
         rLed["path"] = "/api/led";
         rLed["method"] = "GET";
@@ -540,6 +742,11 @@ void WebServerManager::setupRoutes() {
         r7["method"] = "GET";
         r7["desc"] = "Inspect task scheduler state";
 
+        JsonObject rMetrics = routes.add<JsonObject>();
+        rMetrics["path"] = "/api/metrics";
+        rMetrics["method"] = "GET";
+        rMetrics["desc"] = "Per-route request counts, bytes and handler-time histograms, heap low-water (Prometheus text)";
+
         JsonObject r8 = routes.add<JsonObject>();
         r8["path"] = "/api/reboot";
         r8["method"] = "POST";
@@ -547,7 +754,7 @@ void WebServerManager::setupRoutes() {
 
         String response;
         serializeJson(doc, response);
-        request->send(200, "application/json", response);
+        sendBody(request, 200, "application/json", response);
     });
 
     // --------------------------------------------------
@@ -558,19 +765,20 @@ void WebServerManager::setupRoutes() {
     auto rootHandler = [](AsyncWebServerRequest *request){
         AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", index_html_gz, index_html_gz_len);
         response->addHeader("Content-Encoding", "gzip");
+        HttpMetrics::instance().addBytes(index_html_gz_len);
         request->send(response);
     };
     
-    _server.on("/", HTTP_GET, rootHandler);
-    _server.on("/index.html", HTTP_GET, rootHandler);
+    on(_server, "/", HTTP_GET, rootHandler);
+    on(_server, "/index.html", HTTP_GET, rootHandler);
 
     // Fallback: Serve other static files from LittleFS (if we add images later)
     _server.serveStatic("/assets", LittleFS, "/assets");
 
     // API: Reboot
-    _server.on("/api/reboot", HTTP_POST, [](AsyncWebServerRequest *request){
+    on(_server, "/api/reboot", HTTP_POST, [](AsyncWebServerRequest *request){
         Logger::instance().info("API", "POST /api/reboot");
-        request->send(200, "application/json", "{\"status\":\"success\", \"message\":\"Rebooting...\"}");
+        sendBody(request, 200, "application/json", "{\"status\":\"success\", \"message\":\"Rebooting...\"}");
         // Delay slightly to let the response flush
         // We can't delay in async handler easily, but ESP.restart() is abrupt.
         // A timer or loop check in main might be better, but often this works enough to close socket.
@@ -587,120 +795,3 @@ void WebServerManager::setupRoutes() {
         }, "reboot", 2048, NULL, 5, NULL);
     });
 }
-
-String WebServerManager::getCachedStatus() {
-    // Check Validity (Time based + existence)
-    if (millis() - _lastCacheTime < _cacheDuration && _cachedStatus.length() > 0) {
-        return _cachedStatus;
-    }
-
-    // Dynamic Allocation
-    JsonDocument doc; 
-    
-    doc["uptime"] = millis();
-    doc["heap_free"] = ESP.getFreeHeap();
-    doc["heap_size"] = ESP.getHeapSize();
-    doc["psram_free"] = ESP.getFreePsram();
-    doc["psram_size"] = ESP.getPsramSize();
-    doc["flash_size"] = ESP.getFlashChipSize();
-
-    doc["hostname"] = Config::instance().getHostname();
-    doc["description"] = Config::instance().getString("description", "");
-    doc["build_id"] = BUILD_ID;
-    doc["timezone"] = Kernel::instance().getTimezone();
-    doc["time"] = (long long)Kernel::instance().getEpochTime();
-    doc["ntp_sync"] = Kernel::instance().isTimeSynced();
-
-    JsonObject geo = doc.createNestedObject("geolocation");
-    GeolocationService::instance().populateStatus(geo);
-
-    JsonObject bleRanging = doc.createNestedObject("ble_ranging");
-    BleRangingManager::instance().populateStatus(bleRanging);
-    
-    doc["rb_capacity"] = RingBuffer::instance().capacity();
-    doc["rb_usage"] = RingBuffer::instance().available();
-
-    doc["plugin"] = PluginManager::instance().getActivePluginName();
-
-    // Desired Task Coordination
-    String desiredTaskId = Kernel::instance().getDesiredTaskId();
-    String desiredParamsJson = Kernel::instance().getDesiredTaskParamsJson();
-    if (desiredTaskId.length() > 0) {
-        JsonObject desired = doc.createNestedObject("desired_task");
-        desired["id"] = desiredTaskId;
-        if (desiredParamsJson.length() > 0) {
-            JsonDocument paramsDoc;
-            DeserializationError err = deserializeJson(paramsDoc, desiredParamsJson);
-            if (!err) {
-                desired["params"] = paramsDoc.as<JsonObject>();
-            }
-        }
-    }
-    doc["start_requested"] = Kernel::instance().isStartRequested();
-
-    // Hardware Status
-    JsonObject hw = doc.createNestedObject("hardware");
-    hw["cc1101"] = HAL::instance().hasRadio();
-    hw["gps"] = HAL::instance().hasGPS();
-    hw["meshtastic"] = HAL::instance().hasMeshtastic();
-
-    // LED Status
-    JsonObject led = doc.createNestedObject("led");
-    led["power"] = HAL::instance().getLedPower();
-    JsonObject color = led.createNestedObject("color");
-    uint32_t c = HAL::instance().getLedColor();
-    color["r"] = (c >> 16) & 0xFF;
-    color["g"] = (c >> 8) & 0xFF;
-    color["b"] = c & 0xFF;
-
-    // Calculate System Status
-    String statusMsg = "Ready";
-    if (!HAL::instance().hasRadio()) {
-        statusMsg = "Radio Problem: Failed To POST";
-    } else {
-        if (desiredTaskId.length() > 0 && !Kernel::instance().isStartRequested()) {
-            statusMsg = "Ready";
-        } else {
-            String pName = PluginManager::instance().getActivePluginName();
-            if (pName == "SystemIdle") {
-                statusMsg = "Ready";
-            } else if (pName == "RadioTest") {
-                statusMsg = "Working: Hardware Verification";
-            } else if (PluginManager::instance().isTaskRunning()) {
-                statusMsg = "Working: " + pName;
-            } else {
-                statusMsg = "Ready";
-            }
-        }
-    }
-    doc["status"] = statusMsg;
-    doc["task"] = PluginManager::instance().getActiveTaskName();
-    doc["clusterName"] = Config::instance().getString("cluster", "Default");
-
-    // Queue Status
-    RadioTask current = Scheduler::instance().getCurrentTask();
-    JsonObject queueObj = doc.createNestedObject("queue");
-    JsonObject qCurr = queueObj.createNestedObject("current");
-    qCurr["id"] = current.id;
-    qCurr["plugin"] = current.pluginName;
-    qCurr["task"] = current.taskName;
-    qCurr["elapsed"] = millis() - current.startTime;
-    qCurr["duration"] = current.durationMs;
-    queueObj["depth"] = Scheduler::instance().getQueue().size();
-
-    // Aggregated Data
-    JsonArray peers = doc.createNestedArray("peers");
-    PeerManager::instance().populatePeers(peers);
-
-    JsonArray logs = doc.createNestedArray("logs");
-    Logger::instance().populateLogs(logs);
-
-    String response;
-    serializeJson(doc, response);
-    
-    // Update Cache
-    _cachedStatus = response;
-    _lastCacheTime = millis();
-    
-    return response;
-}
@@ -4,23 +4,39 @@
 #include <Arduino.h>
 #include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
+#include "StatusBuilder.h"
+#include "LivePush.h"
 
 class WebServerManager {
 public:
     static WebServerManager& instance();
     void begin();
+    // Kernel::loop: pushes to /api/live clients
+    void loop();
     
 private:
     WebServerManager();
     AsyncWebServer _server;
+    AsyncWebSocket _ws;
     
     void setupRoutes();
     
-    // Cache System
-    String _cachedStatus;
-    unsigned long _lastCacheTime = 0;
-    const unsigned long _cacheDuration = 500; // Cache for 500ms
-    String getCachedStatus();
+    // /api/status, assembled from per-section fragments (WebDocuments.h)
+    StatusBuilder _status;
+
+    // /api/live: status deltas, log lines and sweep frames pushed over _ws
+    class SocketTransport : public PushTransport {
+    public:
+        explicit SocketTransport(AsyncWebSocket& ws) : _ws(ws) {}
+        size_t pending(uint32_t client) override;
+        bool sendText(uint32_t client, const char* data, size_t len) override;
+        bool sendBinary(uint32_t client, const uint8_t* data, size_t len) override;
+    private:
+        AsyncWebSocket& _ws;
+    };
+    SocketTransport _transport;
+    LivePush _push;
+    void setupLive();
 };
 
 #endif
@@ -3,984 +3,1013 @@
 
 #include <Arduino.h>
 
-const uint32_t index_html_gz_len = 15602;
+const uint32_t index_html_gz_len = 16078;
 const uint8_t index_html_gz[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0xB3, 0xF0, 0x6A, 0x69, 0x02, 0xFF, 0xED, 0x7D, 0xED, 0x72, 0xE3, 0x46, 
-0x92, 0xE0, 0xFF, 0x8D, 0xD8, 0x77, 0x28, 0xD3, 0x1E, 0x13, 0x6C, 0x93, 0x14, 0xA5, 0x6E, 0xF5, 
-0xB6, 0xC9, 0x96, 0xBC, 0xB2, 0xA4, 0xB6, 0x75, 0xD3, 0x2D, 0xE9, 0x5A, 0xEA, 0xF1, 0x4E, 0x78, 
-0x1D, 0xDB, 0x20, 0x59, 0xA4, 0xE0, 0x06, 0x01, 0x1A, 0x00, 0x25, 0xD1, 0xBD, 0xFC, 0x71, 0x4F, 
-0x30, 0x71, 0x7F, 0x2F, 0x36, 0xE2, 0xE2, 0xFE, 0xDD, 0x23, 0xEC, 0xF3, 0xCC, 0x0B, 0xEC, 0x3D, 
-0xC2, 0x65, 0x66, 0x15, 0x80, 0x02, 0x50, 0x55, 0x00, 0xD5, 0x1A, 0xCF, 0x4E, 0xC4, 0xB6, 0x6C, 
-0x89, 0x04, 0xAA, 0xB2, 0xAA, 0xB2, 0xB2, 0xB2, 0xF2, 0xAB, 0xB2, 0x5E, 0x7E, 0x76, 0x72, 0x71, 
-0x7C, 0xFD, 0xC7, 0xCB, 0x53, 0x76, 0x93, 0x2C, 0xFC, 0xC3, 0xBF, 0xFF, 0xBB, 0x97, 0xF8, 0x97, 
-0xF9, 0x6E, 0x30, 0x3F, 0x68, 0xF1, 0xA0, 0x45, 0x4F, 0xB8, 0x3B, 0x85, 0xBF, 0x0C, 0xFE, 0xBD, 
-0x5C, 0xF0, 0xC4, 0x65, 0x93, 0x1B, 0x37, 0x8A, 0x79, 0x72, 0xD0, 0x7A, 0x77, 0xFD, 0xAA, 0xF7, 
-0xA2, 0x55, 0x78, 0x17, 0xB8, 0x0B, 0x7E, 0xD0, 0xBA, 0xF5, 0xF8, 0xDD, 0x32, 0x8C, 0x92, 0x16, 
-0x9B, 0x84, 0x41, 0xC2, 0x03, 0x28, 0x7B, 0xE7, 0x4D, 0x93, 0x9B, 0x83, 0x29, 0xBF, 0xF5, 0x26, 
-0xBC, 0x47, 0x5F, 0xBA, 0xCC, 0x0B, 0xBC, 0xC4, 0x73, 0xFD, 0x5E, 0x3C, 0x71, 0x7D, 0x7E, 0xB0, 
-0xDB, 0x1F, 0x64, 0xB0, 0x12, 0x2F, 0xF1, 0xF9, 0x21, 0xFB, 0xF3, 0xBF, 0xFD, 0xDF, 0xFF, 0xF7, 
-0xBF, 0xFF, 0xE7, 0xFF, 0x80, 0x3F, 0xEC, 0xC8, 0xF7, 0x7B, 0x57, 0x9C, 0x7B, 0xC1, 0x9C, 0x9D, 
-0xAE, 0xF9, 0xCB, 0x1D, 0x51, 0x42, 0x16, 0x8F, 0x93, 0x75, 0xF6, 0x05, 0xFF, 0x0D, 0xA3, 0x30, 
-0x4C, 0xD8, 0xC7, 0xFC, 0x01, 0xFE, 0xEB, 0xF5, 0xC6, 0xF3, 0xDE, 0x24, 0xF4, 0xC3, 0x68, 0xC8, 
-0x3E, 0xDF, 0xDD, 0xC3, 0x9F, 0x51, 0xB9, 0xC4, 0xC4, 0x8D, 0xA6, 0x79, 0x19, 0x8E, 0x3F, 0x95, 
-0x32, 0x09, 0xBF, 0x4F, 0xB2, 0x32, 0x7C, 0x80, 0x3F, 0x95, 0x32, 0xEE, 0x64, 0x02, 0xA3, 0xCE, 
-0x4A, 0x8D, 0xC7, 0x2F, 0x9E, 0xCF, 0x26, 0x95, 0x52, 0x53, 0x40, 0x33, 0x8F, 0xB2, 0x52, 0x93, 
-0xD9, 0xF3, 0xE7, 0xFF, 0xF0, 0x75, 0xA5, 0x54, 0xBC, 0x02, 0x60, 0x71, 0x9C, 0x15, 0x1B, 0x3C, 
-0x9D, 0xBA, 0x93, 0xE7, 0x95, 0x62, 0xE3, 0x30, 0x9A, 0x2A, 0xC0, 0x9E, 0x3E, 0x7D, 0xAA, 0x14, 
-0xD9, 0xE4, 0x1F, 0x9F, 0xB0, 0x8F, 0x6C, 0x1C, 0xDE, 0xF7, 0x62, 0xEF, 0x57, 0x40, 0xE6, 0x90, 
-0xC9, 0x7A, 0xF0, 0x68, 0xA4, 0x16, 0x1B, 0x87, 0xD3, 0x75, 0x19, 0x83, 0x63, 0x77, 0xF2, 0x61, 
-0x1E, 0x85, 0xAB, 0x20, 0xC3, 0xD1, 0xAD, 0x1B, 0x39, 0x39, 0x5E, 0x3B, 0xA5, 0x4E, 0x15, 0x0A, 
-0xE5, 0x68, 0x2B, 0x17, 0x9B, 0x01, 0x8D, 0xF4, 0x66, 0xEE, 0xC2, 0xF3, 0xD7, 0x43, 0xD6, 0xBE, 
-0xE2, 0xF3, 0x90, 0xB3, 0x77, 0x67, 0xED, 0x2E, 0xBB, 0x76, 0x6F, 0xC2, 0x85, 0xDB, 0x65, 0xDF, 
-0xF1, 0x80, 0xDF, 0xC2, 0xDF, 0x3F, 0xF0, 0x08, 0x50, 0x06, 0x1F, 0x62, 0x37, 0x88, 0x7B, 0x31, 
-0x8F, 0xBC, 0x59, 0x09, 0xD4, 0xC2, 0x8D, 0xE6, 0x5E, 0x30, 0x64, 0xE5, 0x19, 0x99, 0x7A, 0xF1, 
-0xD2, 0x77, 0x01, 0xFC, 0x3C, 0xF2, 0xA6, 0xA5, 0x77, 0xF8, 0x08, 0x7A, 0xB7, 0x80, 0x02, 0x09, 
-0xEF, 0x45, 0xE1, 0x5D, 0x3C, 0x64, 0xEE, 0x2A, 0x09, 0xD9, 0xEE, 0x2C, 0x12, 0x1F, 0xF0, 0xD7, 
-0x88, 0xED, 0x3C, 0x61, 0xDF, 0xC3, 0x52, 0xE0, 0x51, 0x97, 0xBD, 0x71, 0xBD, 0xA0, 0xCB, 0x8E, 
-0xA1, 0xDF, 0x51, 0xE8, 0xC7, 0x5D, 0xF6, 0x0A, 0xC8, 0x8D, 0x47, 0xEC, 0xC9, 0x4E, 0x11, 0xF2, 
-0x0D, 0xF7, 0xE6, 0x37, 0xC9, 0x90, 0xED, 0x0E, 0x06, 0xB7, 0x37, 0xA5, 0x56, 0xC3, 0x5B, 0x1E, 
-0xCD, 0xFC, 0xF0, 0x6E, 0xC8, 0x6E, 0xBC, 0xE9, 0x94, 0x07, 0xFA, 0xC9, 0xBA, 0xA1, 0x06, 0x9B, 
-0xCE, 0xC3, 0xD2, 0x0D, 0xB8, 0xAF, 0xC7, 0xF1, 0xD2, 0x9D, 0x4E, 0x69, 0xBA, 0x07, 0x6C, 0x6F, 
-0xB0, 0xBC, 0x1F, 0xE9, 0x3B, 0xBA, 0x5F, 0x7D, 0x95, 0x61, 0x6E, 0xE6, 0xF3, 0xF2, 0xBB, 0x9F, 
-0x57, 0x71, 0xE2, 0xCD, 0xD6, 0x3D, 0xB9, 0xC8, 0x87, 0x2C, 0x5E, 0xBA, 0xB0, 0xBA, 0xC7, 0x3C, 
-0xB9, 0xE3, 0x85, 0x11, 0xE1, 0x3F, 0xD7, 0xF7, 0xE6, 0x41, 0xCF, 0x03, 0x44, 0x03, 0x7E, 0x71, 
-0x75, 0xF0, 0xA8, 0x54, 0x22, 0xA3, 0xC4, 0x24, 0x09, 0x17, 0x80, 0xB5, 0xE5, 0x3D, 0x8B, 0x43, 
-0xDF, 0x9B, 0xA6, 0x54, 0xA6, 0x10, 0x78, 0xC7, 0x80, 0xAE, 0x5D, 0x20, 0xEE, 0x9C, 0x06, 0x04, 
-0x65, 0x01, 0xA1, 0x73, 0x80, 0xD6, 0xDF, 0x8D, 0xF8, 0x62, 0x54, 0x1A, 0x8F, 0xB6, 0x57, 0x6C, 
-0xEE, 0x2E, 0x71, 0xD2, 0x00, 0x17, 0x02, 0xC2, 0x5D, 0x86, 0x1E, 0x80, 0xE9, 0xF3, 0x04, 0x0A, 
-0xF5, 0x70, 0xA8, 0x84, 0xD0, 0xDD, 0x65, 0x71, 0xE1, 0xF4, 0xE3, 0xC4, 0x4D, 0x56, 0x71, 0x6F, 
-0xEC, 0x4E, 0xE7, 0xDC, 0x3C, 0x73, 0x95, 0x25, 0x5A, 0x98, 0xA5, 0x3D, 0x18, 0xFB, 0x8B, 0xCA, 
-0x5C, 0x48, 0x0C, 0x44, 0xEE, 0xD4, 0x5B, 0x41, 0x77, 0x9F, 0x55, 0x0A, 0x28, 0xE3, 0x1D, 0xF4, 
-0xFF, 0x01, 0xC7, 0xAB, 0x5D, 0x90, 0x9F, 0xBB, 0xAE, 0x5B, 0x7A, 0x43, 0xAB, 0x33, 0x89, 0x60, 
-0x5D, 0xCD, 0xC2, 0x08, 0x90, 0xBF, 0x5A, 0x2E, 0x79, 0x34, 0x71, 0x63, 0xAE, 0x47, 0x74, 0x61, 
-0x90, 0x7D, 0x77, 0x92, 0x78, 0xB7, 0x30, 0x56, 0x66, 0xE0, 0x0A, 0x85, 0x61, 0x8B, 0x97, 0x05, 
-0xA6, 0xD6, 0x29, 0xE1, 0x79, 0x1C, 0xFA, 0xD3, 0x22, 0x4E, 0x69, 0x9A, 0x16, 0xC8, 0x52, 0xB5, 
-0x68, 0xCD, 0x26, 0xD5, 0x0B, 0x7C, 0x2F, 0x00, 0x0A, 0xF4, 0xC3, 0xC9, 0x07, 0x13, 0x6E, 0x9F, 
-0x35, 0xC1, 0xED, 0xD7, 0x5F, 0x7F, 0xBD, 0x35, 0x76, 0x9B, 0xE0, 0xB0, 0x42, 0x04, 0x7B, 0x7B, 
-0x7B, 0x86, 0x49, 0x7A, 0xF1, 0xE2, 0x85, 0xB6, 0x8F, 0xEA, 0xCA, 0xD0, 0xD0, 0x90, 0x20, 0xFF, 
-0x6C, 0x15, 0x15, 0x47, 0x6A, 0xC1, 0x69, 0x3F, 0x02, 0x5E, 0xB3, 0xC6, 0xCD, 0x41, 0xED, 0xDE, 
-0x60, 0xB6, 0x37, 0xDB, 0x73, 0x47, 0xAC, 0xB4, 0xF9, 0xB0, 0xD2, 0x6E, 0x93, 0x3E, 0x56, 0xE0, 
-0xE7, 0x9F, 0x16, 0xC0, 0x2D, 0x8D, 0x33, 0xD6, 0x90, 0x21, 0xA7, 0xBC, 0x98, 0xD8, 0xF0, 0xB1, 
-0xE0, 0x37, 0xB0, 0x21, 0x78, 0xBF, 0x56, 0x98, 0xAE, 0x85, 0xB1, 0x12, 0x19, 0x84, 0x31, 0x08, 
-0x1D, 0x21, 0xF0, 0x87, 0x88, 0x03, 0x7C, 0xA0, 0xDB, 0x22, 0x7A, 0xF2, 0x2F, 0xD0, 0xD0, 0x6B, 
-0x77, 0x1D, 0xAE, 0x12, 0x76, 0xB5, 0x8E, 0xA1, 0x3B, 0x85, 0x96, 0x3E, 0xF7, 0xE9, 0x55, 0x0F, 
-0xFB, 0xFA, 0xF0, 0xB1, 0x01, 0xFA, 0x56, 0x8B, 0x40, 0x0C, 0x8F, 0x46, 0xF6, 0x26, 0x1C, 0x7B, 
-0x3E, 0x67, 0x27, 0x7C, 0xE6, 0xAE, 0xFC, 0x64, 0xDB, 0xB1, 0x29, 0xFB, 0xCD, 0xEF, 0x4C, 0xA3, 
-0xEA, 0xCB, 0x8E, 0x43, 0xD3, 0xE5, 0x7E, 0xA7, 0xD0, 0x7B, 0x6B, 0xB1, 0x01, 0x9A, 0x76, 0x82, 
-0x20, 0x0C, 0xB8, 0xD8, 0x0E, 0xA9, 0x13, 0x6C, 0xBC, 0x66, 0x53, 0xD9, 0xE1, 0x30, 0x60, 0x0B, 
-0x31, 0x04, 0xE7, 0xC6, 0x0D, 0xA6, 0x3E, 0x9F, 0xE2, 0xDB, 0xC4, 0x1D, 0xC7, 0x9D, 0xCA, 0x60, 
-0x90, 0x01, 0xF7, 0xA6, 0x5E, 0xC4, 0x27, 0x62, 0x3E, 0x04, 0x32, 0x6C, 0x6B, 0x65, 0xF7, 0x19, 
-0xFE, 0x18, 0xC8, 0x39, 0x1F, 0x57, 0xCE, 0x8F, 0x4A, 0xCC, 0xBE, 0x88, 0x08, 0x28, 0xD9, 0xAB, 
-0xDB, 0x5F, 0xB1, 0x51, 0x17, 0x7F, 0x4C, 0xCC, 0x04, 0x77, 0x09, 0xB6, 0xBB, 0x6F, 0xE7, 0x15, 
-0x5F, 0x3F, 0x9C, 0x57, 0xD4, 0x31, 0x03, 0xCD, 0x6E, 0xA9, 0xE1, 0x09, 0x55, 0xEE, 0x6A, 0xDB, 
-0xE4, 0xEB, 0xF6, 0xF5, 0x06, 0x5B, 0xF9, 0x02, 0x38, 0x50, 0x4A, 0x8D, 0xCF, 0xF6, 0xCA, 0x2C, 
-0xA8, 0xB0, 0xC6, 0x4E, 0x78, 0xFC, 0x21, 0x09, 0x97, 0xEC, 0x02, 0xA8, 0x0F, 0x16, 0x07, 0x8F, 
-0x0B, 0x84, 0xF2, 0x8F, 0x0B, 0x3E, 0xF5, 0x5C, 0xE6, 0x20, 0x40, 0xD2, 0x1A, 0x88, 0xBA, 0x01, 
-0xE9, 0x9D, 0xF2, 0xA4, 0xD9, 0x56, 0xA4, 0x7D, 0xE5, 0xA5, 0xFF, 0x13, 0x4D, 0xBF, 0xE6, 0xB3, 
-0x84, 0x39, 0xA7, 0xC1, 0x6D, 0x07, 0x04, 0x3C, 0x1A, 0x1A, 0x73, 0xAE, 0x43, 0x90, 0xF2, 0xE0, 
-0xFB, 0x5B, 0x1C, 0x10, 0x73, 0x7E, 0x08, 0xA3, 0x0F, 0x55, 0x72, 0xDE, 0x14, 0xBF, 0xF6, 0xC5, 
-0x3A, 0xE8, 0x21, 0xED, 0xAB, 0x94, 0x88, 0x8B, 0x87, 0x7D, 0xE6, 0x2D, 0x50, 0x3D, 0x72, 0x83, 
-0x64, 0x54, 0xA9, 0x67, 0x5E, 0x9F, 0xEA, 0x36, 0x25, 0x17, 0x7A, 0x43, 0x11, 0x49, 0x3B, 0xCF, 
-0x85, 0x5E, 0xC0, 0xC8, 0x5F, 0x85, 0xD1, 0x84, 0xB3, 0xF8, 0x26, 0xBC, 0x83, 0x09, 0xF6, 0xE5, 
-0x72, 0x8C, 0x71, 0x49, 0x4F, 0xE5, 0x14, 0xD5, 0x0D, 0x39, 0xEF, 0xFA, 0xD0, 0x77, 0x63, 0xF8, 
-0x70, 0xE3, 0xF9, 0x53, 0x52, 0x37, 0xD4, 0x4E, 0x0B, 0xF6, 0xB1, 0x31, 0x50, 0xC4, 0xE7, 0x7E, 
-0x38, 0x17, 0x82, 0x6C, 0x79, 0xF8, 0xD8, 0x67, 0x18, 0xB2, 0x6D, 0x25, 0x8E, 0xB6, 0x62, 0x68, 
-0x45, 0xBD, 0x03, 0x36, 0x15, 0x40, 0xA5, 0x1B, 0x83, 0xDE, 0xB1, 0x08, 0x83, 0x90, 0x48, 0xDE, 
-0xB6, 0xA8, 0x5F, 0xEC, 0x9B, 0xE5, 0xAB, 0xC9, 0x64, 0x62, 0xE3, 0x63, 0x40, 0xC0, 0x26, 0x26, 
-0x06, 0x83, 0x07, 0xA2, 0x8B, 0xD6, 0x99, 0x1C, 0x9B, 0x2D, 0x70, 0x94, 0xF6, 0x2C, 0x8B, 0x1E, 
-0xE5, 0x88, 0x14, 0x19, 0xD9, 0x7B, 0x5C, 0x79, 0x82, 0xD5, 0xDC, 0x45, 0x28, 0xD3, 0xE2, 0xEF, 
-0x11, 0xBB, 0x03, 0x20, 0xBD, 0x31, 0x6C, 0xF7, 0x1F, 0x80, 0x19, 0xE0, 0x9F, 0x1E, 0xCC, 0xB7, 
-0x61, 0xEF, 0xCE, 0xF7, 0xA4, 0x6B, 0x24, 0x64, 0x95, 0x02, 0x8A, 0x14, 0xDE, 0x5C, 0x6B, 0xA8, 
-0xE7, 0xAE, 0x9F, 0xAE, 0x08, 0xF4, 0xA1, 0x53, 0xBD, 0x71, 0x12, 0x6C, 0x4B, 0x43, 0x7B, 0x15, 
-0x1A, 0x9A, 0xAC, 0xA2, 0x18, 0xE7, 0x74, 0x19, 0x7A, 0x46, 0x95, 0x45, 0xD2, 0xB4, 0x79, 0x98, 
-0xC4, 0xE8, 0x97, 0x6E, 0x04, 0x53, 0xFB, 0x50, 0xFE, 0xBE, 0x97, 0x21, 0xC1, 0x0C, 0xEC, 0x31, 
-0x36, 0x1D, 0x0D, 0x12, 0xB3, 0xFD, 0xB4, 0x61, 0x07, 0xF5, 0xE6, 0x0E, 0xAB, 0x2D, 0xA4, 0x28, 
-0x12, 0x0F, 0xF0, 0x47, 0xDF, 0xA7, 0x02, 0x65, 0x9E, 0x9D, 0x5F, 0x9F, 0xBE, 0x3D, 0x3F, 0x7A, 
-0xCD, 0xAE, 0x8F, 0xBE, 0xBD, 0x62, 0xCE, 0x59, 0x10, 0xC3, 0xFE, 0x01, 0xD2, 0x21, 0x31, 0xAE, 
-0x22, 0x87, 0xEE, 0xC7, 0xAB, 0xF1, 0x6F, 0x49, 0xA9, 0x66, 0xFB, 0x4B, 0xDA, 0x93, 0xE6, 0xE4, 
-0xA9, 0x76, 0x43, 0x47, 0x68, 0x66, 0x1A, 0x4C, 0x71, 0xFE, 0xFC, 0xF9, 0x73, 0x13, 0xC9, 0xBF, 
-0xD8, 0x92, 0xE2, 0x8B, 0x3C, 0xF0, 0x13, 0x94, 0xA0, 0xED, 0xC8, 0xDB, 0x80, 0xC0, 0xE1, 0x0D, 
-0xF2, 0xF8, 0x5C, 0xF3, 0x24, 0xCD, 0xB6, 0xAA, 0x60, 0x99, 0xAA, 0x1B, 0x28, 0xBB, 0xA0, 0xC6, 
-0xAA, 0xA6, 0xBC, 0x4E, 0xD3, 0x41, 0x34, 0xA8, 0x5A, 0xE8, 0xE3, 0x3E, 0xFE, 0xD4, 0x51, 0x7C, 
-0xD6, 0x73, 0x29, 0x97, 0x19, 0x49, 0x59, 0x43, 0x09, 0x8D, 0x84, 0xED, 0x9C, 0x0F, 0xEE, 0x6F, 
-0xBD, 0x97, 0x56, 0x28, 0x77, 0x63, 0xEE, 0x78, 0x43, 0x01, 0x1D, 0xB4, 0x87, 0xDE, 0xC4, 0x8B, 
-0x26, 0x7E, 0x65, 0x82, 0x52, 0x49, 0xF0, 0x99, 0xD1, 0x92, 0xA5, 0x79, 0x55, 0xD2, 0xF0, 0xF7, 
-0x0B, 0x3A, 0x92, 0xDE, 0xAC, 0x56, 0xDA, 0xA9, 0x0D, 0x3A, 0xF8, 0xFE, 0xFE, 0xFE, 0x96, 0x9B, 
-0xC6, 0x7D, 0x2F, 0xBE, 0x71, 0xA7, 0xA8, 0xC7, 0x0D, 0xD0, 0x20, 0x07, 0xA0, 0xA2, 0xF9, 0xD8, 
-0x75, 0x06, 0x5D, 0xFA, 0xE9, 0xEF, 0x97, 0x89, 0x85, 0xD6, 0x84, 0x54, 0x5B, 0x51, 0x36, 0x1B, 
-0xF4, 0x9F, 0xC6, 0x8C, 0x9B, 0x19, 0x77, 0x8E, 0xB9, 0x6C, 0x81, 0x28, 0x4B, 0x92, 0xCC, 0xED, 
-0xCE, 0x6E, 0x7F, 0xAF, 0x63, 0xDE, 0xF4, 0x2F, 0x79, 0x14, 0x7B, 0x31, 0x51, 0x19, 0x2A, 0xD9, 
-0x97, 0x24, 0x90, 0x15, 0x14, 0xE0, 0x5B, 0xEF, 0x57, 0xBD, 0x9C, 0x96, 0x4D, 0x01, 0x59, 0x13, 
-0x59, 0x63, 0x39, 0xA8, 0x56, 0x3B, 0x57, 0x26, 0x11, 0xA4, 0xD1, 0x07, 0xC9, 0x05, 0x4A, 0xFF, 
-0xE3, 0x25, 0xAC, 0x85, 0x68, 0xB5, 0xE8, 0x4D, 0xDC, 0xE0, 0xD6, 0x45, 0x19, 0x3D, 0xD7, 0x2F, 
-0x7E, 0x37, 0x2A, 0xEA, 0xD2, 0x39, 0x9D, 0x0A, 0xCB, 0x92, 0x0A, 0xF2, 0xF3, 0x00, 0xD4, 0x22, 
-0xD0, 0x08, 0x1E, 0x0A, 0xA7, 0x80, 0xF6, 0x73, 0x01, 0x8B, 0xBD, 0x71, 0x8B, 0xD2, 0x76, 0xD6, 
-0xC8, 0xC2, 0x5D, 0xD2, 0x2A, 0x72, 0xBD, 0xA0, 0xAA, 0xB7, 0xA6, 0x6D, 0xED, 0x69, 0xEC, 0xB8, 
-0x45, 0xC4, 0xBB, 0xF8, 0xF3, 0x38, 0x52, 0x57, 0xA3, 0x69, 0xB3, 0x5B, 0xBB, 0x0B, 0x28, 0x48, 
-0xAD, 0xEA, 0xC5, 0xED, 0x7B, 0x22, 0x9F, 0x9A, 0x07, 0x6F, 0xDB, 0xC8, 0x1B, 0x71, 0xBF, 0xDC, 
-0xEA, 0xBB, 0x95, 0xB9, 0xCE, 0xA6, 0x80, 0xD4, 0x1A, 0x6C, 0x6B, 0x2D, 0x7A, 0xFA, 0x8D, 0x40, 
-0x62, 0xA3, 0x87, 0xDD, 0x5A, 0x56, 0xD9, 0xA8, 0x61, 0xB8, 0x62, 0x84, 0xFB, 0x25, 0x7B, 0x75, 
-0xFE, 0xC9, 0x77, 0xC7, 0xB8, 0x9A, 0x35, 0x76, 0xCE, 0x82, 0x98, 0x6A, 0xD9, 0xE2, 0x55, 0xB8, 
-0x5E, 0xB0, 0x5C, 0x25, 0x5D, 0x16, 0x73, 0x1F, 0xBA, 0x61, 0xB7, 0xB0, 0xEC, 0xEE, 0xD6, 0xA3, 
-0xE5, 0xD9, 0xB3, 0x67, 0x7A, 0xE1, 0xE6, 0xEE, 0xC6, 0x4B, 0xB8, 0x69, 0x4E, 0x9E, 0xA3, 0x75, 
-0xA6, 0x76, 0x5E, 0x9E, 0x6E, 0x65, 0xBE, 0x51, 0x9D, 0x64, 0x2B, 0x58, 0x2B, 0x20, 0xC5, 0x59, 
-0x98, 0x9C, 0x4E, 0x12, 0x60, 0xDA, 0x81, 0x8C, 0x7D, 0x17, 0x59, 0x42, 0x9D, 0xE5, 0x86, 0xD9, 
-0xB7, 0x1A, 0xD6, 0x58, 0x38, 0x54, 0x45, 0x40, 0xB6, 0xFB, 0x7C, 0x7B, 0x24, 0x35, 0x15, 0xF5, 
-0x6C, 0x22, 0x63, 0x05, 0x99, 0xD9, 0x86, 0x15, 0xA2, 0x83, 0x25, 0x59, 0xD3, 0x04, 0x94, 0x18, 
-0xE5, 0x4C, 0xB8, 0xDB, 0x6C, 0x34, 0x45, 0x6E, 0x59, 0xE3, 0x88, 0x61, 0x0D, 0xE8, 0xDC, 0x60, 
-0x45, 0xC2, 0xB7, 0xE8, 0xF7, 0x55, 0x79, 0xFA, 0x37, 0x72, 0x93, 0x95, 0x5D, 0x30, 0x54, 0x30, 
-0xB7, 0x15, 0xA4, 0x66, 0xA1, 0x7D, 0x9D, 0x4F, 0xAA, 0x77, 0xEB, 0xFA, 0x8A, 0xA4, 0x4C, 0x4B, 
-0x59, 0xD6, 0xF3, 0xF9, 0x2C, 0xB1, 0x71, 0x06, 0x60, 0xCB, 0xD7, 0x11, 0xE7, 0x20, 0x0A, 0xF0, 
-0xBB, 0x22, 0x5F, 0x4E, 0xE0, 0x71, 0x2F, 0x08, 0xA7, 0x3C, 0xEF, 0x84, 0x00, 0x26, 0xDC, 0x67, 
-0x05, 0x87, 0xD6, 0xA0, 0xD8, 0xA7, 0x89, 0x0F, 0x78, 0x41, 0x02, 0x23, 0x5F, 0xBD, 0x8E, 0xD2, 
-0x0B, 0x72, 0x78, 0xD9, 0x63, 0x54, 0x32, 0x8F, 0xEC, 0x2B, 0xCD, 0x89, 0x2E, 0x88, 0x1E, 0xC8, 
-0x62, 0x28, 0x30, 0x88, 0x07, 0x6A, 0x17, 0x64, 0x38, 0x82, 0xEC, 0x7F, 0x41, 0x87, 0x28, 0xB1, 
-0x54, 0xC5, 0x25, 0xA8, 0x32, 0x97, 0x91, 0x56, 0x47, 0x2C, 0xF7, 0x6D, 0x4F, 0x31, 0xDD, 0xA4, 
-0xCB, 0x69, 0x50, 0x36, 0xE6, 0x94, 0x6D, 0x39, 0x86, 0x7E, 0x66, 0xEB, 0x43, 0xA7, 0x40, 0x54, 
-0xB9, 0x41, 0x51, 0xA2, 0x56, 0xC7, 0xDB, 0xE7, 0x53, 0x0F, 0xE8, 0x67, 0x42, 0xFC, 0x2B, 0x5F, 
-0x6C, 0x1A, 0x18, 0xEA, 0xBC, 0x2A, 0x5E, 0xD1, 0xCC, 0xAF, 0x5A, 0xD9, 0x20, 0xEC, 0x5D, 0xD7, 
-0x37, 0xBC, 0x5B, 0xAC, 0x06, 0xEA, 0x9F, 0xBB, 0xE0, 0x3D, 0xDA, 0x44, 0xCA, 0x83, 0xC5, 0x1D, 
-0xB2, 0xC8, 0xFD, 0x4D, 0x52, 0x79, 0x91, 0xFE, 0x88, 0x44, 0x84, 0x70, 0xB6, 0xBB, 0x97, 0xD2, 
-0x42, 0x91, 0xC8, 0xDD, 0xF8, 0x03, 0x3B, 0x76, 0x13, 0xD7, 0x0F, 0xE7, 0x25, 0x3A, 0x87, 0x37, 
-0x20, 0xE1, 0xD1, 0x1B, 0x55, 0x06, 0x49, 0x65, 0x2E, 0x21, 0xDE, 0x29, 0x4A, 0x92, 0x70, 0x56, 
-0xA5, 0xED, 0x57, 0x49, 0x8F, 0x00, 0x6A, 0x4C, 0x00, 0x25, 0x09, 0x51, 0xAF, 0xF7, 0x0C, 0x2C, 
-0xBA, 0x8B, 0x29, 0x70, 0xC5, 0x62, 0x9B, 0x6C, 0xE2, 0x56, 0x24, 0x66, 0x4F, 0xCC, 0x69, 0xC8, 
-0x90, 0x12, 0x6C, 0x26, 0x34, 0x9D, 0xFE, 0x68, 0x75, 0x4B, 0xD6, 0xEB, 0x4C, 0x55, 0x0D, 0x68, 
-0x2F, 0xDE, 0xD2, 0xFA, 0x25, 0x97, 0x9B, 0x60, 0x4F, 0x4F, 0xB7, 0xB0, 0x37, 0xA4, 0x53, 0x55, 
-0xB3, 0xF4, 0x24, 0x7E, 0x67, 0xB3, 0xD9, 0xC8, 0xD4, 0x96, 0x56, 0x18, 0xD0, 0x35, 0xD5, 0x17, 
-0x62, 0x13, 0x9F, 0x56, 0x5A, 0x73, 0xF1, 0xA7, 0xA6, 0x81, 0x32, 0xAB, 0x14, 0x5D, 0x93, 0x4B, 
-0x45, 0xDB, 0x1C, 0x50, 0x9D, 0x3B, 0xF6, 0xA9, 0x39, 0x65, 0xDF, 0x7D, 0x36, 0x4A, 0x67, 0xA3, 
-0xC7, 0x6F, 0xA1, 0xCB, 0xB1, 0xC6, 0x78, 0x9F, 0x13, 0x72, 0x1F, 0x57, 0xAC, 0x9E, 0x91, 0x97, 
-0xD5, 0x1E, 0x8B, 0x81, 0xC5, 0x00, 0x7B, 0xCA, 0xE3, 0x89, 0x2A, 0xE8, 0x4A, 0x40, 0x55, 0xD1, 
-0x42, 0xBB, 0xBF, 0x91, 0xBA, 0xF8, 0x4C, 0xB7, 0xE2, 0x5F, 0x81, 0xE4, 0xC2, 0xBE, 0x64, 0xA7, 
-0xF7, 0x7C, 0x52, 0x54, 0xB8, 0xA8, 0x69, 0x94, 0x6B, 0x0A, 0xAB, 0x3D, 0xE7, 0x27, 0x83, 0x9C, 
-0x99, 0x48, 0xDD, 0x6E, 0xE1, 0xDE, 0xA7, 0x2E, 0xAA, 0xE7, 0x03, 0x65, 0xEF, 0x19, 0x0E, 0xA4, 
-0xE7, 0x5A, 0x1D, 0x19, 0x41, 0x4E, 0xBD, 0x8F, 0x95, 0xFD, 0x62, 0x60, 0xB7, 0xF5, 0x13, 0x03, 
-0x2C, 0xDB, 0xFA, 0xAB, 0x2C, 0x86, 0xDA, 0xA0, 0x38, 0xB9, 0xA2, 0x50, 0xBF, 0xDB, 0x7F, 0x46, 
-0x98, 0x52, 0x02, 0x65, 0x9A, 0x4E, 0x08, 0x81, 0x94, 0x73, 0x51, 0x5C, 0x6F, 0xFB, 0x05, 0xE4, 
-0xD3, 0x16, 0xAA, 0x22, 0x9F, 0x78, 0x2F, 0xC5, 0x66, 0x64, 0x0A, 0x31, 0x92, 0x57, 0x05, 0x76, 
-0xAA, 0xD1, 0x68, 0x31, 0x52, 0x29, 0x9D, 0x6A, 0x2C, 0x65, 0xB2, 0xD0, 0x30, 0x1B, 0x9D, 0xF3, 
-0x46, 0xB1, 0x49, 0x8F, 0xAB, 0x81, 0x3D, 0x83, 0xFE, 0xBE, 0xB6, 0x51, 0xA9, 0xD8, 0x88, 0x2F, 
-0xA9, 0x7A, 0xC3, 0xCC, 0x8C, 0xBA, 0xA4, 0x21, 0x6A, 0x35, 0x71, 0x93, 0xC6, 0x53, 0xE4, 0x2A, 
-0x26, 0x7E, 0x27, 0x22, 0x9B, 0xF4, 0xCC, 0x4B, 0x90, 0xF0, 0x0D, 0x9F, 0x7C, 0xC8, 0xB0, 0xA5, 
-0x91, 0xD3, 0x44, 0x33, 0x9F, 0x4F, 0xA7, 0x53, 0x15, 0x51, 0x92, 0x8D, 0x9A, 0x94, 0xD0, 0xC4, 
-0xED, 0xA5, 0x0A, 0x90, 0x6E, 0xF4, 0xC5, 0xC1, 0x0B, 0x99, 0xB4, 0xDC, 0xE7, 0x12, 0xCE, 0x77, 
-0xAD, 0xCA, 0xB7, 0x8D, 0xB9, 0x91, 0x2D, 0xA9, 0xC0, 0x7A, 0x04, 0xE7, 0x29, 0x4A, 0x5D, 0xCF, 
-0x4C, 0xDB, 0x12, 0xD2, 0xA8, 0xA0, 0x31, 0x75, 0xA3, 0x91, 0xAC, 0xB0, 0xBC, 0xD9, 0x6C, 0xB4, 
-0x48, 0xA8, 0x28, 0x2E, 0xA4, 0xB7, 0x94, 0x6D, 0x7D, 0x14, 0x2F, 0x40, 0xC6, 0xBE, 0xA7, 0xDD, 
-0xBD, 0xDD, 0x17, 0xDD, 0xDD, 0xAF, 0x5F, 0x74, 0x07, 0xFD, 0xA7, 0x9D, 0x2A, 0x67, 0x42, 0x96, 
-0xB4, 0xC2, 0x7E, 0xB0, 0xAB, 0xA5, 0x17, 0x04, 0xA5, 0xF0, 0x42, 0xC1, 0x9F, 0x78, 0x5A, 0xA6, 
-0x87, 0x02, 0x3E, 0x2E, 0x73, 0x75, 0x9B, 0x4E, 0xC3, 0xD9, 0xF2, 0xC8, 0xA7, 0xCA, 0x2A, 0x8A, 
-0x25, 0x68, 0x03, 0xFD, 0x0A, 0x0B, 0x5E, 0x21, 0x3A, 0x30, 0xA3, 0xD4, 0x67, 0x25, 0x7E, 0xA4, 
-0x5A, 0xE6, 0x9E, 0xD9, 0x77, 0xBC, 0x5A, 0xBB, 0x2C, 0x73, 0x03, 0x6F, 0xE1, 0x8A, 0x49, 0xC0, 
-0x2E, 0xB2, 0xDD, 0x98, 0x98, 0x87, 0x1B, 0x31, 0x2F, 0x98, 0x61, 0xD8, 0x30, 0x57, 0xD8, 0x97, 
-0x08, 0xD2, 0xDC, 0x2B, 0x59, 0x1B, 0x95, 0x61, 0xFE, 0xE3, 0x07, 0xBE, 0x9E, 0x45, 0xB0, 0x3B, 
-0xC5, 0x02, 0xDA, 0x47, 0x36, 0xF8, 0x5D, 0xD1, 0x24, 0x1A, 0x85, 0x88, 0x3F, 0x67, 0x30, 0xE5, 
-0x73, 0x9C, 0x0A, 0x5A, 0xB8, 0xDA, 0x12, 0x4F, 0x9F, 0x67, 0x65, 0x2A, 0x13, 0xB6, 0x58, 0x02, 
-0xAD, 0x5C, 0xD1, 0x44, 0x14, 0x64, 0x47, 0x8E, 0x2F, 0xD2, 0x19, 0xB2, 0x06, 0x5E, 0x98, 0x0C, 
-0x37, 0xDA, 0x28, 0xC5, 0x8A, 0x5A, 0xA9, 0x8D, 0xC4, 0x28, 0xDA, 0x1F, 0x53, 0x76, 0x42, 0xBC, 
-0x45, 0x43, 0x2B, 0x7A, 0x22, 0x17, 0x03, 0x90, 0x12, 0xBB, 0xC2, 0x47, 0x9F, 0x2A, 0xDB, 0x48, 
-0xBE, 0x0F, 0xD1, 0x42, 0x57, 0xA4, 0x88, 0xBD, 0x2A, 0x6D, 0xBF, 0xE5, 0x18, 0x78, 0x50, 0x55, 
-0x27, 0x3F, 0x8F, 0xE8, 0x45, 0x0F, 0xE3, 0xC7, 0xCB, 0xA8, 0x2A, 0x6E, 0xBD, 0x7F, 0x3D, 0x4F, 
-0x3E, 0x89, 0x51, 0xC4, 0xB1, 0xA0, 0xF2, 0x32, 0xE2, 0xE4, 0x5A, 0x2F, 0x97, 0xA9, 0x78, 0xD8, 
-0xF1, 0x49, 0x15, 0xBB, 0x2F, 0x77, 0xD2, 0xC8, 0xF5, 0x97, 0x3B, 0x32, 0xCC, 0xFE, 0x25, 0x06, 
-0x5E, 0xA7, 0x71, 0xED, 0x42, 0x40, 0x50, 0x02, 0xDB, 0x5F, 0xDE, 0xEC, 0x1E, 0x16, 0x9B, 0x7A, 
-0x09, 0x3D, 0x09, 0x0E, 0x65, 0xA0, 0xFC, 0x7F, 0xFC, 0xFB, 0x9F, 0xE0, 0x13, 0x40, 0xC5, 0x67, 
-0xA5, 0x90, 0x79, 0xA6, 0xA9, 0xC7, 0xBC, 0xE9, 0x41, 0x0B, 0xA6, 0x35, 0x10, 0x04, 0xD7, 0x13, 
-0x51, 0x9D, 0x2D, 0x36, 0x01, 0xEC, 0xC5, 0x07, 0x2D, 0x35, 0xC8, 0xB3, 0x75, 0x78, 0x72, 0x76, 
-0x75, 0x7C, 0x71, 0x7E, 0x7E, 0x7A, 0x7C, 0x7D, 0x7A, 0x22, 0x9B, 0x30, 0x82, 0x94, 0xAA, 0x7D, 
-0x0A, 0x8F, 0x46, 0x79, 0xD0, 0xAA, 0x93, 0xD6, 0x0A, 0x92, 0x63, 0x00, 0xCB, 0xCE, 0xF5, 0x47, 
-0x9A, 0xDD, 0xAA, 0x75, 0x58, 0x8D, 0x6C, 0xC1, 0x23, 0x02, 0xC7, 0xAB, 0x08, 0xA5, 0x78, 0x76, 
-0x2C, 0x5A, 0x1F, 0x66, 0x61, 0x74, 0xF8, 0x12, 0x83, 0x76, 0x10, 0x13, 0x17, 0x40, 0xEC, 0x67, 
-0x53, 0x10, 0x89, 0xE0, 0x61, 0xA9, 0xFB, 0xE6, 0x31, 0x35, 0xEC, 0xBF, 0xAE, 0xAB, 0xF9, 0x7C, 
-0x94, 0x00, 0x4F, 0xBD, 0x5B, 0xC2, 0x15, 0xFA, 0x6A, 0xBC, 0x60, 0xEA, 0x81, 0x72, 0x19, 0x46, 
-0x19, 0xEA, 0x73, 0x0F, 0x4E, 0x8B, 0x91, 0x08, 0x77, 0xD0, 0x7A, 0x7D, 0x7A, 0x42, 0xDC, 0x05, 
-0x99, 0xE4, 0xB1, 0xEF, 0x4D, 0x3E, 0x30, 0xE0, 0x7A, 0x30, 0x79, 0x33, 0x6F, 0xBE, 0x8A, 0x60, 
-0x7E, 0x5E, 0xEE, 0x00, 0x48, 0x95, 0x56, 0x76, 0x32, 0x62, 0x11, 0xD4, 0x45, 0x94, 0x94, 0x1E, 
-0xD6, 0x00, 0x89, 0x56, 0x2D, 0xFB, 0x59, 0xAF, 0x97, 0x06, 0x7A, 0x9C, 0xBB, 0xB7, 0xDE, 0x9C, 
-0x98, 0xAF, 0x88, 0xF9, 0x70, 0x64, 0x98, 0x1F, 0x7C, 0x97, 0xB1, 0x5A, 0x1D, 0xD6, 0xEB, 0xA9, 
-0x95, 0x71, 0x28, 0xB2, 0xDF, 0x4A, 0x4C, 0x48, 0x79, 0x9A, 0x5E, 0x4A, 0x61, 0x01, 0x07, 0x0D, 
-0xC5, 0x50, 0xAE, 0xEF, 0xF1, 0xE0, 0x36, 0x1B, 0x72, 0xEA, 0x13, 0x17, 0xCE, 0xC1, 0x16, 0xB4, 
-0x37, 0xC1, 0x51, 0x02, 0x19, 0xDE, 0x79, 0xC9, 0xE4, 0x46, 0xF4, 0xEE, 0x38, 0xF4, 0x9D, 0x36, 
-0xD4, 0x6A, 0x77, 0x5A, 0x87, 0x72, 0x9E, 0x41, 0x7C, 0x7F, 0x1D, 0xCE, 0xE3, 0x97, 0x3B, 0x02, 
-0x7E, 0x83, 0x56, 0x27, 0x49, 0xE4, 0x97, 0x9B, 0xB5, 0xB5, 0x87, 0xE5, 0xB1, 0x41, 0x34, 0x0F, 
-0x6C, 0xD3, 0x0E, 0x7A, 0x6C, 0xB6, 0x69, 0x07, 0xCB, 0x63, 0x3B, 0x6F, 0x42, 0xD8, 0xE1, 0xC2, 
-0x48, 0xD3, 0x52, 0x3A, 0xC7, 0x25, 0xE4, 0x13, 0x1D, 0xE5, 0xE1, 0x6F, 0x15, 0xCC, 0xE3, 0xEC, 
-0x1E, 0x5F, 0xBC, 0x7E, 0xF7, 0xE6, 0x9C, 0xED, 0x0E, 0xD9, 0xE9, 0xF9, 0x1F, 0xCE, 0xDE, 0x5E, 
-0x9C, 0xBF, 0x39, 0x3D, 0xBF, 0x46, 0xDC, 0x5D, 0x7C, 0x77, 0x55, 0x9C, 0xCF, 0x02, 0x58, 0x8C, 
-0x92, 0x54, 0x67, 0x49, 0x09, 0x4F, 0x93, 0x13, 0xA5, 0x59, 0x8D, 0x2A, 0x45, 0xE4, 0x61, 0x96, 
-0xF9, 0x8C, 0x61, 0xAC, 0x1F, 0xF2, 0xF8, 0x32, 0xC9, 0x56, 0xA5, 0xCC, 0x6A, 0x7F, 0x24, 0x6B, 
-0x41, 0xC3, 0x63, 0xC6, 0x58, 0x4A, 0xBA, 0x90, 0x91, 0x4B, 0x64, 0x90, 0x64, 0x3D, 0x65, 0x07, 
-0x2C, 0x0B, 0x4B, 0x7B, 0xAA, 0x5C, 0x8C, 0xF6, 0xDE, 0xD6, 0xE1, 0xEB, 0xD0, 0xC5, 0x57, 0x29, 
-0x7F, 0x61, 0x6F, 0xDC, 0x24, 0xF2, 0xEE, 0xFB, 0xFD, 0xBE, 0x69, 0x18, 0xD5, 0xD9, 0x2A, 0x4E, 
-0x89, 0xEA, 0xED, 0xAB, 0xCC, 0x40, 0x61, 0xD4, 0x5A, 0xF7, 0x9F, 0x71, 0x84, 0xD2, 0x13, 0xA9, 
-0x56, 0x14, 0x8F, 0x90, 0x49, 0x88, 0x4F, 0x0D, 0x90, 0x93, 0x39, 0xF5, 0x60, 0x2D, 0x83, 0x1C, 
-0x22, 0xCC, 0x6C, 0x84, 0x5F, 0xDA, 0xE1, 0x23, 0x69, 0xF7, 0x2A, 0x8A, 0xF5, 0x45, 0x87, 0x11, 
-0xC9, 0x19, 0xB0, 0x6E, 0xC2, 0x25, 0x7C, 0x9D, 0xAF, 0xD9, 0x65, 0xC4, 0x6D, 0xD3, 0x6E, 0xC6, 
-0x97, 0x81, 0xA0, 0xD2, 0xAE, 0x2A, 0x52, 0x3C, 0xA9, 0xDA, 0xAD, 0x43, 0x19, 0xB2, 0x2D, 0x18, 
-0x83, 0xA1, 0x35, 0x05, 0x66, 0x1A, 0x1D, 0x64, 0x44, 0xA9, 0xB2, 0xBA, 0x71, 0x65, 0xA3, 0x15, 
-0x10, 0x26, 0x21, 0xE7, 0x22, 0x6A, 0x50, 0x4F, 0xBA, 0x2E, 0xAE, 0xA1, 0x00, 0x73, 0x5E, 0xC3, 
-0xE7, 0x8E, 0x81, 0x69, 0xD8, 0xC0, 0xE3, 0x10, 0x75, 0xE0, 0x5B, 0x87, 0x78, 0x0A, 0x89, 0x39, 
-0xDF, 0x86, 0x61, 0x62, 0x83, 0xFB, 0x80, 0xB5, 0x55, 0xB0, 0x6D, 0xEA, 0xC7, 0x97, 0x86, 0x9E, 
-0xA4, 0x4C, 0xBA, 0xB8, 0x00, 0x87, 0x03, 0x21, 0xC3, 0x0E, 0x77, 0x47, 0x6A, 0x08, 0xF0, 0xDE, 
-0xA0, 0x76, 0x41, 0xA6, 0xCD, 0xFB, 0x5E, 0x9C, 0x54, 0xA0, 0x2A, 0x44, 0x26, 0x85, 0x3C, 0xBD, 
-0x8C, 0x57, 0xA0, 0x43, 0x75, 0x7F, 0x26, 0x31, 0xCE, 0xD4, 0x7E, 0x03, 0xA6, 0xA0, 0x50, 0x73, 
-0x45, 0x63, 0x6C, 0x1D, 0xFE, 0xE0, 0xC2, 0x3A, 0x01, 0xBE, 0x00, 0x8A, 0x02, 0x68, 0x29, 0xB7, 
-0x9C, 0xC1, 0x40, 0x62, 0x0B, 0x5B, 0xB0, 0xCD, 0x4E, 0xCD, 0x12, 0xA8, 0xCE, 0x92, 0x96, 0x4C, 
-0xE4, 0x2C, 0xFD, 0x65, 0xA6, 0x47, 0x36, 0xF9, 0xB7, 0x35, 0x47, 0x29, 0xEF, 0x06, 0x89, 0x34, 
-0x4A, 0x56, 0xCB, 0xC7, 0x98, 0xA2, 0xFA, 0x69, 0x53, 0xF7, 0xDD, 0x3D, 0x10, 0xDA, 0x2E, 0xCE, 
-0xAF, 0xDF, 0x5E, 0xBC, 0xBE, 0x82, 0x4D, 0xF7, 0xE4, 0xF4, 0x0F, 0x67, 0xC7, 0xA7, 0x35, 0xDB, 
-0x6E, 0x41, 0x4C, 0xC9, 0xF7, 0xDD, 0xD6, 0x23, 0xF3, 0x32, 0x51, 0x1E, 0x24, 0x1B, 0x1B, 0x33, 
-0x2B, 0x4B, 0x2D, 0x32, 0x4A, 0x03, 0x04, 0x44, 0xA7, 0x4D, 0x95, 0x53, 0xF9, 0x88, 0xBD, 0x06, 
-0x12, 0xD9, 0x92, 0xDD, 0x61, 0x7B, 0xC2, 0x4F, 0xA4, 0x65, 0x78, 0xB6, 0xB6, 0x45, 0x35, 0x6C, 
-0xFC, 0x84, 0x3E, 0x61, 0xF8, 0x08, 0x08, 0xC4, 0x0D, 0xF8, 0xA2, 0xE6, 0x0D, 0x4E, 0x17, 0xEA, 
-0xA4, 0xC3, 0xA2, 0x23, 0xC8, 0xBE, 0x35, 0xE3, 0x86, 0x66, 0xC0, 0x5F, 0x2D, 0xB3, 0xAC, 0x5D, 
-0x73, 0x7A, 0xB7, 0x93, 0x22, 0x53, 0x6A, 0x5F, 0x37, 0x5C, 0x44, 0x46, 0x51, 0x87, 0x55, 0x97, 
-0x57, 0xBE, 0x82, 0x64, 0x73, 0x8F, 0xCF, 0xDF, 0x72, 0xEC, 0xCB, 0xA9, 0xBC, 0xE2, 0x09, 0xF2, 
-0xD5, 0xB8, 0xC9, 0x04, 0x18, 0xC8, 0x27, 0x65, 0x84, 0x26, 0x8C, 0x14, 0xE5, 0x8A, 0x72, 0x88, 
-0x51, 0x36, 0x63, 0xD2, 0xE6, 0x25, 0x9C, 0x1F, 0x8A, 0x49, 0x52, 0xF5, 0x1D, 0xD5, 0x62, 0xBD, 
-0xD8, 0x8C, 0xB0, 0x74, 0xDB, 0x2A, 0x51, 0x45, 0xB2, 0xD9, 0x1E, 0xBE, 0x8A, 0x3C, 0x1E, 0x4C, 
-0xFD, 0x35, 0xE8, 0x66, 0x0B, 0xFE, 0x72, 0x47, 0x3C, 0xAC, 0xA9, 0x29, 0x5C, 0xA7, 0xC9, 0x7A, 
-0x29, 0xD9, 0x65, 0x4B, 0xF0, 0x95, 0xD9, 0x9C, 0xEC, 0xF7, 0x2D, 0xB6, 0xF4, 0x81, 0x1D, 0xDF, 
-0x84, 0x3E, 0x0C, 0xEC, 0xA0, 0xC5, 0xFB, 0xF3, 0x3E, 0xFB, 0x3D, 0x2E, 0x2E, 0x50, 0xF4, 0xCE, 
-0xC3, 0x29, 0xB7, 0x8E, 0xC6, 0x32, 0xEF, 0x8F, 0x31, 0xDA, 0xEF, 0xC3, 0x38, 0x09, 0x1E, 0x63, 
-0xA0, 0x37, 0x12, 0x50, 0x69, 0xB0, 0x6E, 0xCC, 0x7B, 0xF7, 0xF0, 0xEF, 0xAF, 0x39, 0xC6, 0x54, 
-0x87, 0xF8, 0x0E, 0xEB, 0x7C, 0xF2, 0x40, 0xA5, 0x52, 0x54, 0x1A, 0xA7, 0x34, 0x7F, 0x7C, 0xCA, 
-0x30, 0x3F, 0x79, 0x9C, 0xD7, 0xDE, 0x82, 0xFF, 0x0A, 0xCB, 0xE6, 0x93, 0x87, 0x98, 0x48, 0x40, 
-0xA5, 0x31, 0x1E, 0x2D, 0x78, 0xE4, 0x4D, 0xDC, 0x9D, 0xD7, 0x61, 0xFC, 0x2F, 0x47, 0xC1, 0x9C, 
-0xFB, 0x3C, 0xFE, 0xA4, 0x69, 0x2D, 0xED, 0x4C, 0xAB, 0xE5, 0x14, 0x4F, 0x8B, 0x79, 0x53, 0x58, 
-0xE1, 0x5E, 0xB2, 0xD6, 0x29, 0x1C, 0xBB, 0x6A, 0x58, 0x01, 0x1A, 0x59, 0x5B, 0x87, 0xEF, 0x2E, 
-0x4F, 0x8E, 0xAE, 0x4F, 0xD9, 0xD9, 0x09, 0x68, 0xD8, 0x67, 0xD7, 0x7F, 0xAC, 0xD9, 0x0D, 0xF5, 
-0x42, 0xB9, 0x8E, 0x61, 0x2B, 0xAD, 0x3E, 0x2D, 0x84, 0xA2, 0x88, 0x3E, 0x28, 0x8C, 0x29, 0x8B, 
-0x44, 0xA9, 0xFA, 0x3F, 0xEA, 0x26, 0x0E, 0xB3, 0x69, 0x44, 0x61, 0x30, 0xCF, 0x48, 0xF4, 0x0A, 
-0xB8, 0x5C, 0xC2, 0xE7, 0xEB, 0x21, 0x5A, 0x2B, 0xE9, 0x0D, 0x3B, 0x0B, 0xA6, 0x7C, 0x09, 0x1C, 
-0x09, 0xB0, 0xF2, 0x72, 0x1C, 0xD5, 0x03, 0x5C, 0xA0, 0xCB, 0x5E, 0x0E, 0xA2, 0xA0, 0x52, 0x5F, 
-0xDF, 0x78, 0x31, 0xA3, 0x70, 0x14, 0xF8, 0x3B, 0x11, 0xF6, 0x3B, 0x60, 0x73, 0xE1, 0x92, 0x43, 
-0x9B, 0xB8, 0xDB, 0x78, 0x79, 0x4B, 0xFE, 0x1A, 0x76, 0x1C, 0x02, 0xF5, 0xC0, 0x09, 0x7E, 0x5C, 
-0x81, 0xEE, 0xE9, 0x90, 0xFD, 0x70, 0xF1, 0xF6, 0xF7, 0x57, 0x97, 0x47, 0x20, 0xC8, 0x7D, 0xC9, 
-0x4E, 0xFF, 0xE9, 0xF4, 0xF8, 0xDD, 0xF5, 0xD9, 0xC5, 0x79, 0x8D, 0x50, 0x57, 0xB0, 0x09, 0xD9, 
-0x85, 0x3A, 0xC3, 0x1E, 0x29, 0x3C, 0x0C, 0xBB, 0x43, 0x98, 0x05, 0x98, 0x8E, 0x9A, 0xCD, 0x91, 
-0x94, 0x7F, 0x0F, 0x0B, 0x66, 0x8D, 0x2A, 0xEE, 0x08, 0xAB, 0xFC, 0x51, 0x28, 0x8E, 0xC6, 0xFF, 
-0xD6, 0xE1, 0x9F, 0xFF, 0xD7, 0xFF, 0xB1, 0x22, 0xF8, 0xE6, 0xE9, 0xE1, 0x5B, 0x3A, 0x45, 0x8E, 
-0xAA, 0xD0, 0x59, 0x00, 0xE4, 0xB2, 0x22, 0xC3, 0x32, 0xE8, 0xE0, 0xF0, 0xCA, 0x50, 0x69, 0x59, 
-0x35, 0xAF, 0xA6, 0x8E, 0xC7, 0xDC, 0xA5, 0x9E, 0xEA, 0x28, 0x57, 0xC2, 0xDF, 0xEA, 0x32, 0x14, 
-0x7D, 0xD8, 0x2C, 0x0A, 0x17, 0x2C, 0xB9, 0x01, 0x8D, 0x0B, 0x84, 0xCE, 0x82, 0x39, 0x94, 0xB9, 
-0xC1, 0x94, 0xF9, 0xEE, 0x2A, 0x98, 0xDC, 0x00, 0xD5, 0x2C, 0xB7, 0x97, 0x44, 0x04, 0x96, 0x51, 
-0x6A, 0x97, 0x20, 0x85, 0x45, 0x94, 0xE2, 0x05, 0x1A, 0xA0, 0x1C, 0x9D, 0x46, 0x19, 0xB7, 0x48, 
-0xBD, 0x3C, 0x24, 0x3F, 0xD8, 0x65, 0x91, 0xB2, 0x56, 0xB5, 0x5F, 0x8D, 0x04, 0x28, 0x07, 0x02, 
-0xA4, 0xD0, 0xF5, 0x67, 0x77, 0x2D, 0x47, 0x77, 0x33, 0xD1, 0xCE, 0xB2, 0x9C, 0xF4, 0xE6, 0xEF, 
-0x54, 0x73, 0x2B, 0x45, 0x80, 0x2A, 0x81, 0xC0, 0x85, 0x55, 0x5E, 0x40, 0xA1, 0xD6, 0x1A, 0xAE, 
-0xE3, 0xC1, 0x92, 0xFE, 0xC8, 0x60, 0xEB, 0x06, 0x13, 0xEE, 0x2B, 0x8A, 0x40, 0xC4, 0x63, 0x9E, 
-0xA0, 0x49, 0x9F, 0x86, 0xE7, 0x74, 0x5A, 0xE6, 0x3E, 0xA6, 0xA8, 0x4C, 0xD3, 0x3E, 0x40, 0x77, 
-0x08, 0x5A, 0x1D, 0x57, 0xB6, 0x6E, 0x15, 0x2F, 0x71, 0xBC, 0xB9, 0x84, 0x5E, 0x8C, 0x13, 0xC1, 
-0x7E, 0x82, 0x00, 0xBA, 0xF0, 0x12, 0xEC, 0x68, 0xB2, 0x8A, 0x02, 0x36, 0x73, 0xFD, 0x98, 0xDB, 
-0x31, 0x8D, 0x44, 0x77, 0xB2, 0x06, 0x71, 0xC5, 0x9B, 0x08, 0x2A, 0x3B, 0x0B, 0x7E, 0x16, 0x21, 
-0x40, 0xDF, 0x73, 0xA0, 0x67, 0x2D, 0xCD, 0xC9, 0x8E, 0x62, 0xF3, 0x0F, 0xA5, 0x70, 0x60, 0x63, 
-0xB9, 0xA7, 0xF9, 0xED, 0x2A, 0x08, 0x90, 0xEB, 0x36, 0x20, 0xF0, 0x48, 0x14, 0xD5, 0xD3, 0x78, 
-0xD9, 0x91, 0xA9, 0xF3, 0x63, 0x9A, 0xDC, 0x98, 0xE9, 0x73, 0x35, 0xB0, 0xAE, 0x09, 0x9F, 0x92, 
-0xAE, 0xEC, 0xAA, 0x1F, 0xA4, 0xC8, 0xA1, 0xF6, 0x8A, 0xFB, 0x90, 0xD6, 0x3F, 0x5D, 0xF4, 0x68, 
-0xEE, 0x13, 0xD1, 0x9C, 0xF0, 0xA5, 0x1F, 0xAE, 0x11, 0x39, 0xA8, 0x1B, 0x02, 0x3F, 0xDB, 0xAB, 
-0xD3, 0xDD, 0x4A, 0xF9, 0x35, 0x32, 0xFE, 0x5B, 0x7E, 0x7E, 0x78, 0x74, 0x27, 0x0D, 0x48, 0x47, 
-0xE9, 0x1B, 0xEB, 0x10, 0x96, 0x04, 0xBD, 0xE8, 0xFA, 0x5F, 0xC5, 0x3D, 0x21, 0x2E, 0x15, 0x37, 
-0x59, 0x0C, 0xC3, 0x51, 0xBB, 0x4E, 0x4C, 0x13, 0xD9, 0xA4, 0xD8, 0xDA, 0x49, 0x87, 0x5B, 0xDA, 
-0xDB, 0x99, 0x52, 0x65, 0xEA, 0x6E, 0xC9, 0x9B, 0xA7, 0x2A, 0x8C, 0x85, 0x65, 0x47, 0xEE, 0xD4, 
-0xA2, 0x59, 0x6C, 0xC9, 0x79, 0x14, 0x5B, 0x9B, 0xAB, 0x41, 0x66, 0x3E, 0x5C, 0x14, 0x04, 0xA3, 
-0xE2, 0x7A, 0x97, 0x06, 0x27, 0xAD, 0x91, 0x69, 0x4F, 0x0D, 0x75, 0x42, 0x4D, 0x37, 0x0F, 0x77, 
-0xA2, 0xA0, 0x9A, 0xD6, 0xE1, 0x60, 0x30, 0xA4, 0xFF, 0x6C, 0x48, 0xAF, 0x27, 0x3F, 0x8B, 0xF6, 
-0x98, 0xE7, 0x2E, 0x10, 0x07, 0x73, 0x9A, 0xEA, 0xE7, 0xDB, 0x30, 0x76, 0x20, 0x7B, 0x62, 0xAB, 
-0x48, 0x9C, 0xC3, 0xD4, 0x01, 0x9C, 0x3B, 0x64, 0x7F, 0x21, 0x0B, 0x45, 0x6F, 0x21, 0x1C, 0x4B, 
-0xA5, 0x29, 0x24, 0x8F, 0x76, 0xEB, 0xB0, 0xD7, 0x93, 0xF5, 0x1A, 0xE9, 0x3E, 0x9F, 0xD0, 0xC7, 
-0x4B, 0x7F, 0x85, 0x93, 0xA1, 0xEB, 0xE5, 0x92, 0x5E, 0x3D, 0x42, 0x3F, 0x2D, 0xAE, 0x17, 0x9D, 
-0x01, 0x0A, 0xAD, 0x82, 0x84, 0xA2, 0x6C, 0x95, 0xE6, 0x81, 0x3D, 0xAA, 0xFD, 0x09, 0xCB, 0x49, 
-0xB9, 0x18, 0x31, 0xAD, 0x6C, 0x3C, 0x45, 0xFE, 0x57, 0x35, 0x40, 0x5E, 0x5D, 0x1F, 0xBD, 0xBD, 
-0x66, 0xD7, 0x47, 0x57, 0xBF, 0x6F, 0x68, 0x1C, 0xB3, 0x6D, 0x7F, 0x2E, 0x48, 0x04, 0x49, 0xA9, 
-0x03, 0x95, 0x48, 0xA6, 0x42, 0x8A, 0x1E, 0xC1, 0xE7, 0xD4, 0x84, 0x73, 0x59, 0xE8, 0x94, 0xEE, 
-0x15, 0x30, 0xA5, 0x6F, 0x2F, 0xEA, 0xFB, 0xDB, 0x68, 0x87, 0x79, 0x36, 0x64, 0x6F, 0x79, 0x0C, 
-0x8A, 0x68, 0xDC, 0x68, 0x5F, 0x11, 0x45, 0xB7, 0x93, 0x9D, 0x32, 0x10, 0x4A, 0xFC, 0x48, 0x91, 
-0x01, 0x11, 0xE7, 0x13, 0x6F, 0xE3, 0xAD, 0x3D, 0x76, 0x55, 0xCF, 0x7A, 0xC5, 0x0B, 0x8B, 0xC3, 
-0x2D, 0x9D, 0x99, 0xAC, 0xFA, 0xC8, 0x85, 0xB5, 0x4A, 0x1E, 0x9B, 0xAC, 0x38, 0x69, 0x15, 0xAF, 
-0x5D, 0xE9, 0x6C, 0xA2, 0xD6, 0x6D, 0xA7, 0x76, 0xEA, 0xE5, 0x8E, 0xF4, 0xE7, 0x67, 0xFE, 0x7D, 
-0x71, 0x44, 0x46, 0x2D, 0x4E, 0xAB, 0x4C, 0x09, 0xEC, 0xA0, 0x6D, 0xB8, 0x75, 0xF8, 0xF6, 0xE8, 
-0xCD, 0x50, 0x59, 0x82, 0xF4, 0x26, 0x72, 0x17, 0x85, 0x18, 0x10, 0x3C, 0x39, 0x52, 0x58, 0x77, 
-0x25, 0x09, 0xCE, 0x04, 0xFB, 0xDD, 0xE5, 0xF5, 0xD9, 0x9B, 0xD3, 0x0A, 0xF8, 0xD5, 0x12, 0x79, 
-0xF8, 0xA3, 0xB4, 0x70, 0xF9, 0xFA, 0xDD, 0x77, 0x67, 0xE7, 0x95, 0x16, 0x04, 0x1B, 0x79, 0x40, 
-0x0B, 0xE9, 0xAE, 0x42, 0x4E, 0x92, 0x96, 0xA9, 0x54, 0xD6, 0xCE, 0x2D, 0xCE, 0x38, 0x72, 0x08, 
-0x59, 0x2F, 0x0F, 0xFD, 0xDB, 0x6F, 0x1D, 0xDE, 0xEE, 0xF6, 0x07, 0x05, 0x00, 0x28, 0xA8, 0xC9, 
-0x59, 0x49, 0xF3, 0x56, 0x4E, 0x22, 0x6F, 0x99, 0x28, 0xF0, 0x77, 0x76, 0xD2, 0x28, 0x0C, 0x91, 
-0xC5, 0x80, 0x5D, 0x91, 0xC5, 0x9B, 0x47, 0xCA, 0xE1, 0x27, 0xD0, 0x69, 0x48, 0x58, 0x2B, 0x87, 
-0x0F, 0xC0, 0xD2, 0x45, 0xF3, 0x60, 0x25, 0x31, 0xCE, 0x34, 0x9C, 0xAC, 0x70, 0xFF, 0xEE, 0xFF, 
-0xB2, 0xE2, 0xD1, 0x5A, 0x28, 0x50, 0x61, 0x74, 0xE4, 0xFB, 0x4E, 0xBB, 0x90, 0xC2, 0x23, 0x4D, 
-0xF7, 0xD0, 0xEE, 0x60, 0xD0, 0xE8, 0xA9, 0x3B, 0xB9, 0x71, 0xC6, 0xEC, 0xE0, 0x90, 0x8D, 0xFB, 
-0x84, 0x46, 0xB4, 0xEB, 0xF7, 0x61, 0x33, 0x0D, 0x6F, 0xB9, 0xD3, 0x16, 0x16, 0xED, 0x76, 0xA7, 
-0x9A, 0xF1, 0x11, 0x94, 0x3E, 0x86, 0x7E, 0x83, 0x83, 0xBC, 0xDD, 0x39, 0x4F, 0x4E, 0x7D, 0x8E, 
-0x1F, 0xBF, 0x5D, 0x9F, 0x4D, 0x9D, 0x76, 0x1A, 0x1E, 0xD1, 0x66, 0x5F, 0xB1, 0xB4, 0xD3, 0x25, 
-0x38, 0xDE, 0xCC, 0x81, 0x12, 0x1D, 0x84, 0xA4, 0xB4, 0x0E, 0x92, 0x7C, 0xDE, 0x74, 0xA9, 0x46, 
-0xF3, 0x31, 0xE7, 0x4A, 0xB7, 0x32, 0xD2, 0x09, 0x8E, 0x74, 0xB2, 0xF5, 0x48, 0x31, 0x0C, 0xC2, 
-0x32, 0x52, 0x54, 0xF8, 0xED, 0xA3, 0x84, 0x37, 0x1D, 0x7C, 0xDD, 0x60, 0x94, 0xC5, 0x20, 0xBA, 
-0x9D, 0x34, 0x3B, 0x11, 0x4C, 0x7D, 0x3D, 0x95, 0x28, 0x2E, 0x93, 0x45, 0x38, 0xAD, 0xD2, 0x88, 
-0x1C, 0x8E, 0x30, 0x65, 0xD7, 0x8D, 0x48, 0x84, 0xC3, 0x94, 0xD3, 0x0B, 0x89, 0xBA, 0x3A, 0x84, 
-0x2B, 0xBE, 0x9C, 0x4F, 0xA1, 0xAD, 0x06, 0x2D, 0x48, 0xB9, 0x63, 0xDB, 0x79, 0x2D, 0xB5, 0x03, 
-0xD3, 0x82, 0x48, 0x62, 0x07, 0x07, 0x07, 0x2C, 0x75, 0x6E, 0xE9, 0x72, 0x31, 0x99, 0xB1, 0x54, 
-0x70, 0xAB, 0x41, 0x6F, 0x9A, 0x91, 0xB0, 0x1D, 0x66, 0xEE, 0x67, 0x6A, 0x0E, 0x70, 0xC3, 0x38, 
-0xE8, 0x9D, 0x0F, 0xEB, 0x7B, 0xEA, 0x59, 0x7B, 0xBC, 0xCE, 0x6F, 0x0B, 0x71, 0x63, 0xA6, 0xFD, 
-0xD7, 0xE1, 0x3C, 0x23, 0x7A, 0xE6, 0x60, 0xA0, 0xC5, 0x0E, 0x46, 0x45, 0x74, 0x8C, 0x0B, 0x00, 
-0x2A, 0xBC, 0x81, 0x39, 0xD5, 0x53, 0xFF, 0x36, 0xC4, 0x4F, 0xB1, 0x67, 0x23, 0x03, 0xB7, 0xD1, 
-0xE1, 0x32, 0x0D, 0x15, 0x29, 0x8C, 0x3B, 0x09, 0xE7, 0x73, 0x3F, 0xA7, 0x42, 0x74, 0x90, 0xE7, 
-0x04, 0xE7, 0xF9, 0xDB, 0xB7, 0x80, 0x3E, 0xF9, 0xA6, 0x2D, 0x88, 0xB2, 0xCD, 0xF8, 0x67, 0xB9, 
-0xBD, 0x6A, 0x88, 0xC8, 0x5F, 0x66, 0x5C, 0xD5, 0x20, 0x87, 0xAD, 0x47, 0x57, 0xE6, 0xB5, 0xCC, 
-0x29, 0x17, 0x62, 0x33, 0x0E, 0xA4, 0x81, 0x84, 0x83, 0x71, 0x42, 0x8E, 0x91, 0xD9, 0xFA, 0x3C, 
-0xA1, 0x4C, 0xBC, 0x58, 0x0A, 0xDD, 0xA0, 0x7C, 0x0A, 0x54, 0x22, 0x4C, 0x3A, 0x79, 0x21, 0x37, 
-0x5E, 0x07, 0x93, 0x9C, 0xEC, 0x4A, 0xA0, 0xCB, 0x24, 0x87, 0xDD, 0x29, 0x82, 0xEC, 0x30, 0x61, 
-0x2B, 0x1A, 0x21, 0x7D, 0x5F, 0x04, 0xFE, 0x5A, 0x80, 0x40, 0xA1, 0x9F, 0xDB, 0xA6, 0x8A, 0x92, 
-0x85, 0x55, 0xD7, 0xA2, 0xA0, 0x69, 0x90, 0xA6, 0xA1, 0xAB, 0x2E, 0x1A, 0x18, 0x04, 0x38, 0xA7, 
-0xBD, 0xE3, 0x2E, 0xBD, 0x1D, 0x0C, 0x7F, 0xD8, 0xD1, 0xD2, 0x41, 0x5E, 0x17, 0xCB, 0x64, 0x95, 
-0x01, 0x50, 0xFF, 0xE7, 0x38, 0x0C, 0x1C, 0x73, 0xF9, 0xFC, 0x9C, 0xD4, 0x81, 0x7D, 0x5E, 0xB3, 
-0x20, 0x12, 0x6D, 0xE3, 0x1A, 0xB6, 0x02, 0x08, 0xB9, 0x72, 0x67, 0x20, 0x13, 0xF9, 0xDC, 0x8D, 
-0x34, 0xEF, 0x41, 0x31, 0x04, 0x62, 0xC8, 0xDA, 0xEF, 0xCF, 0xBC, 0x28, 0x4E, 0x8E, 0x31, 0xF9, 
-0x5C, 0x27, 0xEF, 0x95, 0xE4, 0xFC, 0xF4, 0x58, 0x5F, 0x76, 0xA4, 0x53, 0x64, 0x70, 0xA2, 0x8E, 
-0xA2, 0xC8, 0x5D, 0xF7, 0xBD, 0x98, 0xFE, 0x3A, 0x88, 0x97, 0x0E, 0xFB, 0xF2, 0x4B, 0x11, 0x43, 
-0xE2, 0xF3, 0x60, 0x9E, 0xDC, 0xB0, 0x43, 0x36, 0xD0, 0xEF, 0x11, 0x44, 0x3F, 0x58, 0x30, 0xDD, 
-0x91, 0x7C, 0xDC, 0x91, 0x3E, 0x9A, 0xB5, 0x6B, 0x81, 0x4C, 0x54, 0x17, 0x14, 0x34, 0x4E, 0x22, 
-0x0E, 0xAA, 0x94, 0xC4, 0xA4, 0xD3, 0x86, 0xB7, 0x7A, 0x06, 0x9C, 0x1D, 0x2B, 0xB8, 0x15, 0x8B, 
-0x05, 0xA5, 0x0E, 0x80, 0xD3, 0xCE, 0xF2, 0xCA, 0xB5, 0x6B, 0x6A, 0xA1, 0x15, 0x49, 0xA6, 0x57, 
-0x85, 0x7A, 0xFE, 0xC8, 0xDA, 0x4F, 0x89, 0x42, 0x77, 0x89, 0x1E, 0x1A, 0x81, 0x58, 0x80, 0x61, 
-0xEC, 0xD8, 0x46, 0xF7, 0xC6, 0xB2, 0x45, 0x65, 0xC8, 0x58, 0xC4, 0xF3, 0x07, 0x22, 0x03, 0x6A, 
-0xF6, 0x49, 0x36, 0xA7, 0x81, 0x91, 0x7D, 0x0D, 0xD1, 0x21, 0x6C, 0x8C, 0xED, 0xDA, 0x4A, 0xA4, 
-0x0D, 0x63, 0x05, 0xB4, 0x72, 0xD5, 0x17, 0x97, 0xA6, 0x66, 0xAC, 0x80, 0x2A, 0xB8, 0xAD, 0x42, 
-0x11, 0xCF, 0xED, 0xF3, 0xB0, 0x10, 0x99, 0x04, 0xCB, 0x6D, 0x82, 0xDA, 0xFB, 0xB4, 0x6F, 0x82, 
-0xA1, 0xC7, 0x3E, 0x40, 0xD6, 0xE2, 0xB8, 0xFA, 0xA8, 0xC2, 0xCE, 0x40, 0xDD, 0x2C, 0x1F, 0x92, 
-0xD8, 0x60, 0xAC, 0x07, 0x50, 0x2C, 0xEF, 0x98, 0x18, 0x4C, 0x08, 0x83, 0xE6, 0x51, 0x14, 0x46, 
-0x4E, 0xEB, 0x15, 0xB0, 0x77, 0x00, 0x94, 0x84, 0x92, 0x6D, 0x61, 0x03, 0x34, 0x96, 0x56, 0x97, 
-0x71, 0x0B, 0xD3, 0xF8, 0x34, 0x66, 0x81, 0x12, 0xB4, 0x71, 0xDD, 0x4D, 0x4A, 0x58, 0x6E, 0x9D, 
-0x62, 0x57, 0xA1, 0x53, 0x22, 0x90, 0x85, 0x56, 0x65, 0xCB, 0x84, 0xDF, 0x12, 0x05, 0xB4, 0x34, 
-0x56, 0x92, 0xBA, 0xBA, 0x39, 0x39, 0xB4, 0x90, 0x1C, 0x5A, 0xF5, 0x33, 0x63, 0x91, 0x78, 0x28, 
-0x22, 0xE9, 0x0A, 0xE4, 0x32, 0x90, 0xE1, 0xEB, 0xE5, 0x7D, 0x2C, 0x0D, 0x85, 0x3F, 0x5D, 0xDE, 
-0x47, 0xA9, 0x1A, 0x85, 0xCE, 0x2A, 0xF6, 0xA1, 0x4F, 0xDF, 0x92, 0x5D, 0x28, 0xFE, 0xCD, 0x15, 
-0x01, 0x54, 0x7E, 0x52, 0xFA, 0x8F, 0xFF, 0x6A, 0x4A, 0x82, 0x2A, 0x4F, 0xA4, 0xA2, 0xAD, 0x96, 
-0x14, 0x1B, 0x22, 0xE4, 0xC7, 0xC1, 0x4F, 0x8F, 0x22, 0x6B, 0x03, 0x50, 0x84, 0xB9, 0xB5, 0xB4, 
-0x6D, 0x66, 0xC4, 0x4D, 0x07, 0xB0, 0xFB, 0xA8, 0x03, 0x10, 0x64, 0xF7, 0x08, 0xCA, 0x02, 0x99, 
-0x21, 0xF3, 0x27, 0x82, 0xF4, 0xCF, 0x2E, 0x81, 0xEC, 0xEF, 0xBC, 0x60, 0x1A, 0xDE, 0xF5, 0xFD, 
-0x70, 0x42, 0xAE, 0xC9, 0x7E, 0x1A, 0x30, 0x44, 0x93, 0xDA, 0xC2, 0xC7, 0x3E, 0x3E, 0x6A, 0xB1, 
-0x6F, 0x58, 0xCB, 0xF5, 0x01, 0x3D, 0x78, 0x98, 0x8A, 0xAF, 0x39, 0xD5, 0xF0, 0x5B, 0x6C, 0x68, 
-0x84, 0x30, 0x2A, 0xA9, 0x2B, 0x50, 0x3C, 0x0D, 0x6B, 0x8B, 0x01, 0x7B, 0xBC, 0x28, 0x5C, 0x2E, 
-0xD6, 0xF2, 0xDD, 0x01, 0x66, 0x94, 0x90, 0x20, 0x86, 0xAC, 0x25, 0x63, 0xEE, 0xFA, 0xFD, 0x3E, 
-0x70, 0x51, 0x0C, 0xDB, 0x42, 0x73, 0x11, 0x9D, 0x0C, 0x6C, 0xC1, 0x03, 0x6F, 0x39, 0x84, 0x61, 
-0x74, 0x59, 0x2C, 0x0F, 0x05, 0xB5, 0xDE, 0x05, 0x1F, 0x82, 0xF0, 0x2E, 0x80, 0x57, 0x93, 0xF4, 
-0x08, 0x54, 0x16, 0x04, 0xD4, 0x65, 0x69, 0x04, 0x0D, 0x3C, 0xD4, 0x45, 0xCD, 0x74, 0x41, 0xD2, 
-0xC4, 0x33, 0x96, 0x43, 0xDA, 0x0A, 0x00, 0x7A, 0x0C, 0x53, 0x3D, 0x13, 0xDF, 0xD8, 0x66, 0x54, 
-0xEC, 0xB0, 0x0C, 0xD5, 0xF8, 0x76, 0x05, 0xBB, 0xCE, 0x19, 0x6E, 0x1F, 0xC1, 0x0A, 0x53, 0xC8, 
-0x6A, 0x73, 0xC7, 0xC0, 0xF0, 0x4F, 0x4F, 0xA4, 0x1B, 0xDD, 0x28, 0x2E, 0x67, 0x8E, 0xFB, 0xD7, 
-0x7C, 0x5A, 0x95, 0x96, 0x01, 0xC6, 0x77, 0x79, 0xAB, 0xC2, 0x6E, 0x2D, 0x9C, 0xFF, 0x62, 0xEC, 
-0xCC, 0x81, 0xEF, 0xE8, 0x7C, 0x60, 0x4B, 0x78, 0xB8, 0x4C, 0x18, 0x05, 0x2D, 0x74, 0x74, 0x5A, 
-0x9E, 0x88, 0x30, 0x3A, 0x90, 0x05, 0x9D, 0xD6, 0x29, 0x19, 0x51, 0xDE, 0x7E, 0xF7, 0x2D, 0xBB, 
-0x75, 0xFD, 0x15, 0x88, 0xCB, 0x0E, 0xC5, 0xC2, 0xED, 0xED, 0xEF, 0x77, 0x07, 0xDD, 0xDD, 0xBD, 
-0x17, 0x9D, 0x7F, 0x0E, 0x44, 0x11, 0x4A, 0xCD, 0x87, 0xFB, 0x9B, 0xCC, 0x95, 0x80, 0xA3, 0xC2, 
-0x69, 0x69, 0xD1, 0x8B, 0x56, 0xD5, 0xB6, 0xC3, 0x9C, 0xCF, 0xA8, 0xB1, 0x4C, 0xB0, 0x2F, 0xF3, 
-0x90, 0x8C, 0x07, 0x27, 0x28, 0x67, 0x53, 0xD9, 0x7E, 0xBC, 0xF4, 0x3D, 0x90, 0x69, 0xBA, 0x40, 
-0xF8, 0x0B, 0x77, 0xE9, 0xC4, 0xC8, 0x99, 0x96, 0x78, 0xDD, 0xCE, 0x19, 0x88, 0x3A, 0x71, 0x3F, 
-0x89, 0xBC, 0x85, 0xD3, 0xE9, 0x68, 0x0C, 0x49, 0x04, 0x26, 0x95, 0x46, 0x3F, 0x03, 0xF2, 0x7D, 
-0xCA, 0xFE, 0xF5, 0x5F, 0x05, 0xF0, 0x7E, 0x1C, 0x2E, 0xB8, 0xE3, 0x81, 0x30, 0x78, 0xDE, 0xD1, 
-0x72, 0x28, 0xD7, 0xE7, 0x11, 0xA0, 0xE2, 0x2C, 0x00, 0x14, 0x78, 0x53, 0xB4, 0x97, 0x2F, 0xDC, 
-0xA4, 0xCF, 0xDE, 0x01, 0x3B, 0x88, 0xBA, 0xF3, 0xEE, 0xB8, 0xA5, 0x5B, 0xBF, 0xD9, 0xA0, 0x2C, 
-0xFB, 0x99, 0x6E, 0xBC, 0x3F, 0x12, 0xC8, 0x9F, 0x70, 0x0A, 0xB0, 0x73, 0xA3, 0x07, 0xE8, 0x36, 
-0x30, 0xDC, 0x08, 0x56, 0xE8, 0x00, 0x85, 0xF0, 0x79, 0xFA, 0x61, 0x8C, 0x1F, 0x8C, 0xB2, 0x80, 
-0x46, 0x05, 0xE2, 0xD3, 0x9D, 0x70, 0x36, 0x03, 0xDD, 0xF1, 0x23, 0x5B, 0xF0, 0xE4, 0x26, 0x9C, 
-0x0E, 0x59, 0xFB, 0xF2, 0xE2, 0xEA, 0xBA, 0xFD, 0x10, 0x41, 0x15, 0x28, 0xF4, 0x1D, 0xC5, 0x8A, 
-0xA1, 0x3D, 0x0E, 0x89, 0x13, 0xD5, 0x0A, 0xE6, 0xC4, 0x20, 0x14, 0x01, 0xC1, 0x02, 0x31, 0x40, 
-0x53, 0x9D, 0xFA, 0xAE, 0xBD, 0x4F, 0xBB, 0xF6, 0x4D, 0x74, 0xF0, 0xC5, 0xC7, 0x68, 0xF3, 0xE5, 
-0x1C, 0xFE, 0xCC, 0x37, 0x5F, 0x8E, 0xE1, 0xCF, 0x78, 0xF3, 0xDE, 0x24, 0xE6, 0xA2, 0x7C, 0x80, 
-0x91, 0x9B, 0xD7, 0x18, 0x6B, 0x70, 0x11, 0x6C, 0x85, 0x82, 0xA0, 0x39, 0x06, 0xAA, 0x8F, 0xA0, 
-0xE1, 0xB7, 0x7C, 0x06, 0xCA, 0xE1, 0x0D, 0xBB, 0x74, 0xE7, 0x1C, 0x97, 0x07, 0x25, 0x10, 0x17, 
-0x71, 0x73, 0xD5, 0xF2, 0x65, 0x76, 0x19, 0x71, 0x94, 0xC6, 0x2A, 0x4A, 0xA5, 0x5D, 0xF2, 0x94, 
-0xE4, 0x2A, 0xB9, 0x0A, 0xDA, 0x35, 0x99, 0x90, 0x3E, 0x81, 0xB3, 0xB1, 0xAF, 0xAA, 0xD2, 0xA6, 
-0x65, 0x6B, 0x78, 0x25, 0xF9, 0x4F, 0x6C, 0x64, 0x4C, 0x20, 0x5E, 0xFB, 0xB0, 0x2B, 0x89, 0xF8, 
-0x3F, 0xC7, 0x60, 0x3A, 0xA2, 0x8C, 0x18, 0x36, 0xC3, 0x91, 0x8C, 0xBA, 0x85, 0x55, 0x4D, 0x5C, 
-0x46, 0x6B, 0x4B, 0x46, 0xBE, 0x5F, 0x07, 0x24, 0xDD, 0x1B, 0xAC, 0x80, 0x88, 0xF9, 0xD7, 0x41, 
-0x92, 0x3B, 0x84, 0x15, 0x50, 0xF2, 0x6B, 0x1D, 0x94, 0x74, 0x4F, 0x31, 0x80, 0xA9, 0x70, 0xA9, 
-0xCF, 0x70, 0x00, 0x29, 0x43, 0x4C, 0x27, 0x32, 0x8D, 0xF7, 0xC5, 0x18, 0xC0, 0x88, 0xFF, 0xB2, 
-0xF2, 0x22, 0x3E, 0x6D, 0x75, 0x46, 0x8F, 0x6E, 0xF4, 0x10, 0x7B, 0x0C, 0x92, 0xBB, 0x41, 0x2F, 
-0x2B, 0xAC, 0x81, 0xAE, 0xBE, 0x90, 0x38, 0x79, 0x06, 0xBB, 0xED, 0x47, 0x3A, 0x68, 0x8E, 0x92, 
-0x64, 0xEF, 0x7A, 0xBD, 0xE4, 0x6D, 0xA8, 0x87, 0xB4, 0xE2, 0x09, 0xCA, 0xDE, 0x41, 0x63, 0x09, 
-0xAC, 0x23, 0x03, 0x14, 0x3C, 0xE4, 0x3D, 0x64, 0xFF, 0xED, 0xEA, 0xE2, 0x1C, 0x74, 0x85, 0x08, 
-0xB6, 0x78, 0x6F, 0xB6, 0x76, 0x2C, 0x46, 0x81, 0xC2, 0xDE, 0x8F, 0x5F, 0xBA, 0xE6, 0xB2, 0xB9, 
-0xFC, 0x80, 0x9F, 0x2C, 0x05, 0x33, 0x21, 0x81, 0x3E, 0x58, 0x0A, 0xE6, 0x92, 0x43, 0xF2, 0xAB, 
-0xBE, 0xD4, 0x46, 0xC3, 0xDB, 0x36, 0x66, 0xAD, 0xEF, 0xE7, 0x66, 0x76, 0x25, 0x20, 0x98, 0x9F, 
-0xE5, 0x4D, 0x43, 0x42, 0xCC, 0x96, 0xB9, 0x3F, 0xDA, 0x66, 0x36, 0x2F, 0x77, 0x32, 0xB9, 0x5E, 
-0x25, 0x4F, 0x9E, 0xF6, 0x81, 0x4B, 0x8D, 0xC3, 0x90, 0xBC, 0xC1, 0x0B, 0x77, 0xCD, 0xC6, 0x3C, 
-0x23, 0x34, 0xF2, 0x0E, 0x67, 0x14, 0x38, 0xB9, 0x41, 0x05, 0x0F, 0xD4, 0x42, 0x9B, 0x75, 0x65, 
-0xCB, 0x46, 0xAD, 0x2D, 0xEE, 0xA4, 0x01, 0xD2, 0xF5, 0x4D, 0x13, 0x29, 0x8B, 0x03, 0xE0, 0x80, 
-0x2D, 0x85, 0xF5, 0x6E, 0xBB, 0x57, 0xC9, 0xFE, 0x92, 0x36, 0x2C, 0x58, 0xE6, 0xCF, 0xFD, 0x05, 
-0xA0, 0x15, 0x18, 0x78, 0x03, 0xB6, 0xDF, 0x88, 0x37, 0x1F, 0x87, 0x8B, 0x05, 0x53, 0x1A, 0x68, 
-0xCC, 0x93, 0x25, 0x07, 0x13, 0xAE, 0x70, 0x0B, 0xF3, 0x29, 0x79, 0xC8, 0x0B, 0xFA, 0x80, 0x84, 
-0x91, 0xDC, 0x03, 0x00, 0xF1, 0x1A, 0xAB, 0xD3, 0x62, 0xBD, 0x07, 0xD9, 0x6A, 0x6F, 0xAA, 0x29, 
-0xED, 0x87, 0xF3, 0x6F, 0xC3, 0xFB, 0x26, 0xC6, 0x88, 0x42, 0xE5, 0xC2, 0x66, 0x92, 0x1E, 0xE7, 
-0x45, 0xE7, 0xFF, 0x77, 0x7E, 0x38, 0x76, 0xFD, 0xB8, 0xDC, 0x4C, 0x00, 0xFD, 0xA8, 0x1D, 0x5B, 
-0xF1, 0xCC, 0xAE, 0xA6, 0xB3, 0x08, 0x85, 0x46, 0x97, 0x81, 0xB3, 0x0D, 0x10, 0xE5, 0x75, 0x28, 
-0x88, 0xA7, 0x3A, 0xB0, 0xD9, 0x1F, 0x7F, 0xAA, 0xBE, 0x7B, 0xED, 0x05, 0x1F, 0xB2, 0x77, 0x85, 
-0x31, 0xBD, 0xE5, 0x18, 0x45, 0xC5, 0x44, 0x2B, 0x1A, 0x73, 0x43, 0x44, 0xEF, 0x35, 0xFB, 0xA2, 
-0xE8, 0x16, 0x85, 0x3D, 0xE5, 0xD3, 0x00, 0x42, 0x10, 0xC6, 0x6D, 0xE2, 0xC3, 0x91, 0xB6, 0xBC, 
-0x08, 0xFA, 0x2B, 0x57, 0xF8, 0x9E, 0x9E, 0x96, 0x6A, 0xE4, 0x63, 0x4F, 0x1B, 0xC9, 0x9F, 0x98, 
-0xDB, 0xC9, 0xCB, 0x64, 0x4D, 0x95, 0xAB, 0x55, 0x5A, 0x53, 0x68, 0x55, 0xCA, 0x2F, 0xA0, 0x89, 
-0x9E, 0x62, 0x42, 0xB4, 0xD7, 0x14, 0xEE, 0xC1, 0x23, 0xA7, 0x2D, 0xF0, 0x00, 0x7B, 0x8B, 0xF8, 
-0xD0, 0x29, 0xEA, 0x7F, 0x27, 0xDC, 0x07, 0x1E, 0x20, 0xAF, 0xBB, 0x94, 0x45, 0x50, 0x56, 0xE2, 
-0x41, 0x8C, 0xB1, 0xCA, 0xC2, 0x23, 0x8D, 0xDB, 0xDF, 0x14, 0x38, 0x41, 0x5E, 0x13, 0x3A, 0x83, 
-0xEC, 0x01, 0xDE, 0x39, 0xA2, 0x4E, 0x17, 0xD3, 0xB8, 0x14, 0x8D, 0x11, 0xD9, 0x4C, 0xC0, 0xA6, 
-0xE0, 0x2E, 0xF9, 0x51, 0x92, 0x44, 0x0E, 0x6D, 0xC5, 0x95, 0x29, 0x91, 0x9B, 0xEE, 0x15, 0xED, 
-0x37, 0xB2, 0x4C, 0x75, 0x01, 0x83, 0x48, 0x46, 0x07, 0x2C, 0x9C, 0x9D, 0x2F, 0x77, 0xE6, 0x5D, 
-0xD6, 0xFE, 0xD2, 0x5D, 0x2C, 0x47, 0x6D, 0x6B, 0xC1, 0x96, 0x28, 0xF8, 0xCB, 0x2A, 0x4C, 0x6A, 
-0x4A, 0xB6, 0x45, 0xC9, 0xCF, 0x9F, 0x7E, 0x5D, 0x53, 0xF0, 0xA5, 0x28, 0xE8, 0xD7, 0x01, 0x3C, 
-0x14, 0xE5, 0xE6, 0x58, 0xCE, 0xE4, 0xBD, 0x29, 0x61, 0xE8, 0xFB, 0x64, 0xE1, 0xFF, 0xD6, 0x18, 
-0x7A, 0xCC, 0xE1, 0x00, 0x39, 0x5D, 0x86, 0xBE, 0x8F, 0x5B, 0x99, 0xD8, 0x0C, 0xEC, 0x2E, 0xA8, 
-0x74, 0xC3, 0x28, 0x8F, 0xF5, 0x41, 0x12, 0x94, 0xD8, 0x8B, 0x2D, 0x3E, 0x23, 0xD8, 0xF8, 0x5C, 
-0xFD, 0xDE, 0x6E, 0xAA, 0x81, 0x34, 0x0E, 0x5C, 0x0B, 0x2A, 0x39, 0xDE, 0xB4, 0xCB, 0xE4, 0xC4, 
-0x98, 0x5D, 0x24, 0xA2, 0x16, 0xB7, 0x85, 0x5D, 0x78, 0x53, 0xD3, 0x16, 0x8A, 0x4A, 0x39, 0xF7, 
-0x3B, 0x50, 0xBD, 0x4F, 0xC1, 0xC2, 0xB2, 0x65, 0x9D, 0xE8, 0x4A, 0x78, 0x6F, 0xE4, 0x9E, 0x42, 
-0x2E, 0x79, 0xF4, 0x06, 0xA3, 0xBF, 0xD0, 0xAD, 0x00, 0x9B, 0x68, 0xB5, 0x08, 0xB2, 0xD9, 0xC8, 
-0x5D, 0xC8, 0xE6, 0xDE, 0xB8, 0xC9, 0x4D, 0x9F, 0xCE, 0xE9, 0x38, 0x88, 0x2F, 0xE0, 0x44, 0xEE, 
-0xF2, 0x5F, 0x60, 0x27, 0xE7, 0x3B, 0xBB, 0x83, 0xBD, 0x67, 0x1D, 0xD8, 0x2E, 0x5B, 0x1F, 0x5A, 
-0x7A, 0x71, 0x28, 0x2F, 0x4F, 0x5C, 0xC6, 0x8E, 0xA4, 0xE5, 0xA4, 0xD4, 0x9A, 0x53, 0xAA, 0xCF, 
-0x7A, 0xAC, 0xD8, 0x81, 0x0E, 0xDB, 0x61, 0xE5, 0x26, 0x9E, 0xA4, 0x3C, 0x47, 0xD7, 0x50, 0x3E, 
-0x28, 0x6C, 0x0C, 0x3A, 0xFE, 0x3B, 0xE6, 0xE0, 0x7E, 0x9F, 0x3E, 0x87, 0x27, 0x8C, 0x00, 0x1B, 
-0x8C, 0xDF, 0xD5, 0x87, 0x92, 0x1E, 0x60, 0x87, 0x97, 0x91, 0x68, 0xC8, 0x53, 0x05, 0x34, 0x5D, 
-0x27, 0x8A, 0xC5, 0x45, 0x64, 0x59, 0xBB, 0x5B, 0x41, 0xB1, 0x78, 0xB1, 0x83, 0x57, 0x87, 0x11, 
-0x7E, 0xE3, 0x56, 0x3D, 0x30, 0x11, 0x44, 0x06, 0xC0, 0x08, 0x82, 0xF8, 0x86, 0x36, 0x95, 0xD6, 
-0x39, 0x1E, 0x43, 0xEB, 0x34, 0xA5, 0x0D, 0x69, 0x16, 0x28, 0x98, 0x00, 0x4B, 0x16, 0xC9, 0xCA, 
-0x04, 0x4B, 0xE1, 0xB0, 0x93, 0x19, 0x06, 0x15, 0xCB, 0x24, 0x2B, 0x14, 0xD1, 0xF4, 0x22, 0xAB, 
-0xA3, 0x28, 0x0D, 0x69, 0x35, 0xF5, 0x11, 0x0E, 0xA5, 0x65, 0xAB, 0x9F, 0x4A, 0xDE, 0xA2, 0xAA, 
-0xFC, 0x86, 0xB5, 0x52, 0x3B, 0xA3, 0xAD, 0xB2, 0x54, 0x2E, 0xD2, 0xDA, 0xF2, 0x2B, 0xF9, 0x23, 
-0x11, 0x44, 0x6A, 0x96, 0x24, 0x39, 0xF6, 0x5B, 0x77, 0xF2, 0x81, 0x07, 0x53, 0xB4, 0xC9, 0xDD, 
-0xD2, 0x0D, 0x70, 0x4A, 0x69, 0x4B, 0x13, 0xA9, 0x5A, 0x92, 0xB6, 0x91, 0x7D, 0xC7, 0x06, 0x74, 
-0x26, 0x4E, 0x5B, 0x7F, 0x29, 0x40, 0x34, 0x05, 0x84, 0x9F, 0x95, 0x81, 0x92, 0xF3, 0xC5, 0x5A, 
-0x1B, 0xAF, 0x3B, 0xBB, 0x8C, 0xC2, 0x31, 0xF6, 0xE5, 0x04, 0xE6, 0xB6, 0x0F, 0xD5, 0xA4, 0x90, 
-0x8E, 0x56, 0x54, 0xDC, 0xDA, 0x5D, 0xFF, 0xCE, 0x5D, 0xC7, 0x4C, 0x4A, 0xEC, 0x5A, 0x52, 0xB9, 
-0x0C, 0x97, 0x2B, 0x5F, 0xD8, 0x90, 0x50, 0x53, 0x15, 0xC7, 0x40, 0x9C, 0x10, 0x63, 0x01, 0x80, 
-0x73, 0x05, 0xA0, 0x4A, 0xCC, 0x80, 0xE5, 0xC5, 0xC2, 0xCD, 0xE6, 0xDE, 0x86, 0xDE, 0x94, 0x32, 
-0x0E, 0xDF, 0x45, 0x22, 0xCE, 0x15, 0xDE, 0x44, 0x78, 0x76, 0x12, 0x3E, 0x77, 0x4C, 0xEC, 0xD6, 
-0x9D, 0x00, 0xAB, 0x54, 0x79, 0xA7, 0xB0, 0xA7, 0x4B, 0xF6, 0x69, 0xE6, 0xEB, 0x40, 0x37, 0xA7, 
-0x7E, 0x33, 0x13, 0x87, 0x11, 0x08, 0xD2, 0x6C, 0x3D, 0x90, 0xDC, 0xC4, 0x61, 0x76, 0x1A, 0x0A, 
-0xF2, 0xA8, 0x87, 0x95, 0x19, 0x39, 0x8C, 0xA0, 0x92, 0x5F, 0xEB, 0xA1, 0xE4, 0x46, 0x8E, 0x91, 
-0x3E, 0x3E, 0x40, 0x62, 0xE7, 0xCB, 0x2F, 0x05, 0x7A, 0xFB, 0x30, 0x2F, 0x68, 0x81, 0x55, 0x70, 
-0x22, 0x11, 0x28, 0x8C, 0x24, 0xD0, 0x9E, 0x6E, 0x8D, 0x1A, 0x80, 0x4B, 0xAC, 0x69, 0x81, 0xE7, 
-0xB8, 0x92, 0xC8, 0xAD, 0x36, 0x60, 0x61, 0x14, 0x08, 0x3D, 0x47, 0xA5, 0xB6, 0x81, 0x0C, 0x81, 
-0x39, 0xCE, 0xAB, 0x4D, 0xC8, 0x57, 0x86, 0x16, 0x08, 0xC3, 0x5A, 0xE0, 0x39, 0x5E, 0x69, 0x1A, 
-0xAA, 0x80, 0xD3, 0x02, 0x23, 0xEB, 0x46, 0x51, 0xC9, 0x5F, 0x07, 0x2C, 0xBB, 0x75, 0x71, 0xFE, 
-0xFA, 0xEC, 0xFC, 0xB4, 0x65, 0x8D, 0x56, 0x09, 0x6A, 0xA6, 0xBE, 0x02, 0xD7, 0x34, 0xFF, 0x02, 
-0x56, 0x47, 0xC2, 0xDC, 0xC2, 0x07, 0xA6, 0xE5, 0x02, 0x3D, 0x0C, 0x25, 0x7F, 0x7B, 0x71, 0x7C, 
-0x7A, 0x75, 0xC5, 0xFE, 0xFB, 0xBB, 0xD3, 0x77, 0xA7, 0xEC, 0xEA, 0xFA, 0xE8, 0xFA, 0xDD, 0x15, 
-0x73, 0xDE, 0x5C, 0x9C, 0x9F, 0x5D, 0x5F, 0xBC, 0xC5, 0xF4, 0x6B, 0x3D, 0x03, 0x25, 0x22, 0xFB, 
-0xFA, 0x65, 0xC5, 0x01, 0x8F, 0x80, 0xF2, 0xFC, 0x5B, 0x5F, 0xBA, 0x4E, 0x6A, 0x24, 0x86, 0x5F, 
-0x52, 0x0E, 0x58, 0xA8, 0x34, 0xAA, 0x33, 0x79, 0xCB, 0x7C, 0x65, 0x22, 0x9F, 0x23, 0x74, 0xE3, 
-0xD6, 0x8B, 0xBD, 0xB1, 0xCF, 0xF5, 0xD5, 0xB2, 0x79, 0x2B, 0x9E, 0x49, 0x81, 0x49, 0xFB, 0x25, 
-0x67, 0xBC, 0x98, 0xA1, 0xCF, 0x68, 0x08, 0x51, 0x20, 0x14, 0xCF, 0x8B, 0x10, 0x0C, 0x65, 0xA3, 
-0x16, 0x49, 0xA0, 0xAC, 0xB0, 0xEA, 0x86, 0x96, 0x9F, 0x8D, 0x23, 0x79, 0x06, 0x06, 0x27, 0x0F, 
-0xBE, 0x59, 0xA5, 0x53, 0xA8, 0x24, 0xC5, 0x22, 0x23, 0x75, 0x69, 0xCF, 0x6F, 0xB5, 0xAD, 0x82, 
-0x6B, 0x0A, 0x15, 0x67, 0xD6, 0x04, 0x56, 0x3D, 0x9B, 0xD7, 0xEE, 0xC8, 0x40, 0x04, 0x79, 0x86, 
-0x42, 0xAC, 0xBC, 0x40, 0xAC, 0x38, 0x8B, 0xB1, 0x31, 0xEB, 0x7F, 0x29, 0x7E, 0xE2, 0xBD, 0x3C, 
-0x1E, 0x38, 0x64, 0x5F, 0x7C, 0x4C, 0xF1, 0xBC, 0x61, 0x0E, 0x7E, 0x01, 0xFD, 0x76, 0x09, 0xFB, 
-0xD2, 0x66, 0x11, 0x77, 0xDE, 0x1B, 0x86, 0xB0, 0x69, 0x28, 0x00, 0x96, 0x56, 0x00, 0x65, 0x3D, 
-0x14, 0xF4, 0x6F, 0xA7, 0x7A, 0x1F, 0x43, 0xE8, 0xAC, 0xD4, 0x0D, 0x25, 0xEC, 0x2B, 0xBE, 0x90, 
-0x8A, 0xD1, 0x3A, 0x17, 0x69, 0x8B, 0xFD, 0x65, 0x78, 0x87, 0x19, 0x08, 0xE5, 0x5A, 0xC3, 0x27, 
-0x22, 0x36, 0xA4, 0x3E, 0xC2, 0xEB, 0x23, 0x8B, 0xBA, 0x0C, 0xD4, 0xBD, 0x31, 0xDB, 0xA4, 0xAB, 
-0x2E, 0xAB, 0x6E, 0x31, 0x3E, 0xD2, 0x20, 0xE4, 0xBC, 0xE6, 0x07, 0xFE, 0x8F, 0x65, 0x98, 0xCA, 
-0xFB, 0x68, 0x3E, 0x76, 0xD0, 0x71, 0xD4, 0x45, 0xB7, 0x51, 0x17, 0x9D, 0x46, 0xC6, 0x09, 0xA9, 
-0x40, 0x0B, 0xEF, 0xAF, 0x28, 0x53, 0x31, 0xC2, 0xC1, 0x5C, 0xC5, 0x2F, 0x44, 0xAA, 0xE2, 0xA6, 
-0xF0, 0xEC, 0x46, 0xC7, 0xFA, 0xBE, 0xB7, 0x31, 0x87, 0x73, 0xFB, 0x01, 0x9D, 0x15, 0x24, 0xFD, 
-0xB8, 0x64, 0x77, 0xF4, 0xDD, 0x77, 0x6F, 0x4F, 0xBF, 0x3B, 0xBA, 0x06, 0xEA, 0x3B, 0x39, 0xBA, 
-0x3E, 0xD2, 0xD3, 0x9E, 0x16, 0xCA, 0x6E, 0x9F, 0xB2, 0xCE, 0x31, 0x87, 0x42, 0x16, 0x4F, 0x2E, 
-0xDE, 0x48, 0x56, 0xD2, 0xB1, 0xD1, 0x2E, 0x56, 0x00, 0x22, 0x2A, 0x06, 0x1A, 0x66, 0xAF, 0x3A, 
-0x66, 0x72, 0xC2, 0x50, 0x18, 0x8C, 0x8A, 0x64, 0x31, 0xB4, 0xE6, 0xAF, 0x0D, 0xA5, 0x44, 0x80, 
-0xA4, 0xB0, 0x71, 0x16, 0xA2, 0x23, 0xE5, 0x23, 0x35, 0x34, 0xB2, 0x5A, 0x6A, 0x64, 0x6E, 0xFB, 
-0x88, 0x82, 0xCF, 0xEC, 0x8D, 0x67, 0xC3, 0xC8, 0xE2, 0x6D, 0x28, 0x9E, 0xCF, 0x1A, 0x04, 0xA9, 
-0x55, 0xF3, 0xB7, 0x0C, 0x82, 0x44, 0x2D, 0x7F, 0xFB, 0x20, 0x48, 0xAC, 0x55, 0x64, 0x7B, 0x0E, 
-0xA6, 0x23, 0x09, 0x67, 0x22, 0x0A, 0x91, 0xBC, 0x10, 0x64, 0x1F, 0x02, 0x1E, 0xFA, 0x0D, 0x3D, 
-0xAB, 0xF8, 0x71, 0x0C, 0x51, 0x78, 0x6A, 0x38, 0x28, 0x62, 0x58, 0x0D, 0xDC, 0xE3, 0xFE, 0x76, 
-0x51, 0x93, 0x2A, 0x1C, 0x10, 0x20, 0x43, 0xDF, 0xBF, 0x0E, 0x97, 0x18, 0xB0, 0xA9, 0x3E, 0xD2, 
-0x9A, 0x4D, 0x6D, 0x0B, 0x60, 0xAF, 0xCF, 0x2E, 0x79, 0x35, 0xA4, 0x4A, 0xA5, 0x54, 0x3A, 0xC8, 
-0x6B, 0x20, 0x55, 0x7A, 0x67, 0xA6, 0x55, 0x74, 0x52, 0x47, 0xDE, 0x7C, 0x8E, 0x67, 0x56, 0x22, 
-0xF7, 0xCE, 0x67, 0xAF, 0x84, 0x8F, 0xFC, 0x04, 0x6D, 0x46, 0xB0, 0x64, 0xBC, 0x49, 0xC7, 0xC4, 
-0x70, 0x9D, 0xCF, 0xBC, 0x98, 0xEA, 0xA0, 0x6A, 0x63, 0xA3, 0x1B, 0x71, 0x73, 0xF2, 0x04, 0x8B, 
-0x4A, 0x6B, 0xBC, 0xDA, 0xB5, 0x51, 0xC1, 0x79, 0x91, 0x45, 0x30, 0xDE, 0xB9, 0x51, 0xE0, 0xB4, 
-0x44, 0x9F, 0xAE, 0x3E, 0x78, 0x30, 0x2D, 0x53, 0x11, 0xB4, 0xA8, 0x63, 0x1E, 0x46, 0xFC, 0x65, 
-0x06, 0xF3, 0x00, 0xEF, 0x74, 0xB8, 0xE2, 0x00, 0x7D, 0xCA, 0x9C, 0x77, 0x67, 0x35, 0x43, 0x63, 
-0xCE, 0x67, 0xFA, 0xC3, 0x4A, 0x4E, 0xBB, 0x70, 0x09, 0x4E, 0xBB, 0x53, 0x3F, 0x70, 0xBB, 0xCB, 
-0x2A, 0xA2, 0x9E, 0xE1, 0x04, 0xA3, 0x6C, 0x5A, 0xC0, 0x8B, 0xB9, 0xA2, 0xDD, 0xDB, 0x63, 0x0B, 
-0x08, 0xC5, 0x86, 0x52, 0x6C, 0x08, 0xF7, 0xBC, 0x29, 0x12, 0xD4, 0xC2, 0xAA, 0x9B, 0x72, 0xF0, 
-0x66, 0xA1, 0xAA, 0x62, 0xA2, 0x85, 0x45, 0x94, 0xBD, 0xA2, 0x30, 0x55, 0xF2, 0x51, 0xD9, 0x3A, 
-0x26, 0xAD, 0x94, 0x50, 0xE7, 0xD3, 0x75, 0x85, 0x74, 0xC6, 0xB1, 0x88, 0x15, 0x9F, 0x58, 0xA0, 
-0x60, 0xA1, 0x6C, 0x5D, 0xBC, 0x7A, 0x45, 0x0A, 0xCD, 0xA8, 0xA6, 0x92, 0x39, 0x86, 0xB1, 0xD9, 
-0xFE, 0xB8, 0xD1, 0xBA, 0x3D, 0x40, 0xE2, 0x3E, 0xC3, 0x20, 0x28, 0xD0, 0xD0, 0x1C, 0xC5, 0xAA, 
-0xDC, 0x65, 0x7B, 0x83, 0xA2, 0x6D, 0xB0, 0xE8, 0xA3, 0x2C, 0x07, 0x5B, 0x10, 0xC6, 0x2F, 0x05, 
-0x07, 0x11, 0x3C, 0xA0, 0xE8, 0x89, 0xCA, 0x17, 0xB9, 0xE6, 0x7C, 0x45, 0xC9, 0x2D, 0x85, 0x83, 
-0x9B, 0x82, 0x5A, 0x4D, 0xD2, 0x1A, 0x3A, 0x55, 0x11, 0x38, 0xC1, 0x76, 0x3A, 0x6C, 0x29, 0x0D, 
-0xE4, 0x7E, 0x18, 0x2E, 0x9B, 0xD4, 0x93, 0x67, 0x34, 0x8A, 0xD5, 0xB4, 0xDE, 0xAE, 0xC2, 0x12, 
-0x12, 0xAB, 0xC7, 0x10, 0x5B, 0xDB, 0xE8, 0x38, 0x84, 0x9A, 0xCD, 0xB8, 0x81, 0x86, 0x88, 0xC7, 
-0x43, 0x79, 0x34, 0xE7, 0xD2, 0xA8, 0x14, 0x24, 0x21, 0xA1, 0x93, 0x72, 0x2E, 0x92, 0x5B, 0x79, 
-0x15, 0x78, 0x33, 0x0F, 0x46, 0x25, 0x3A, 0x5A, 0x51, 0x53, 0xA4, 0x0D, 0xC8, 0xF7, 0x33, 0x67, 
-0x60, 0xA6, 0x6C, 0x77, 0x59, 0xBF, 0x2F, 0xB9, 0xFB, 0x4F, 0xD6, 0xD0, 0x0B, 0x8C, 0xC5, 0xA3, 
-0x4B, 0x5A, 0xC6, 0xEB, 0x34, 0x13, 0xB2, 0x31, 0x08, 0x05, 0xA1, 0x1D, 0xB0, 0x8F, 0x9B, 0xCA, 
-0x1D, 0x77, 0xA2, 0x03, 0x99, 0x40, 0xB0, 0x34, 0x88, 0x03, 0xE8, 0x54, 0xA5, 0x34, 0xF0, 0x68, 
-0xAC, 0x4E, 0x2D, 0x8A, 0x81, 0xD6, 0x2A, 0x48, 0x51, 0x89, 0x68, 0x87, 0xAE, 0x31, 0x47, 0x7C, 
-0x36, 0x41, 0xD5, 0x70, 0x22, 0x22, 0x3C, 0x5B, 0x1D, 0xAA, 0x93, 0x5B, 0x23, 0x9B, 0xC8, 0x78, 
-0xB8, 0x1D, 0xA5, 0xA3, 0xFB, 0x71, 0xF2, 0x53, 0x66, 0x1A, 0xC1, 0x2F, 0x65, 0xFF, 0x6A, 0x29, 
-0xD4, 0x02, 0x8B, 0xF4, 0x97, 0xAB, 0x18, 0x46, 0x5C, 0x71, 0x88, 0x77, 0xEA, 0xB0, 0x4E, 0xC1, 
-0x96, 0xEC, 0xFB, 0xEB, 0x37, 0xAF, 0x8B, 0xAF, 0xE8, 0x74, 0x52, 0xB2, 0x40, 0x51, 0xA9, 0x62, 
-0xCF, 0x95, 0xDC, 0x2B, 0x8C, 0x80, 0xD4, 0x7F, 0xCF, 0xD7, 0x38, 0x1B, 0x17, 0x63, 0x4C, 0x2B, 
-0xD3, 0xFF, 0x00, 0xDF, 0x52, 0xEB, 0x4F, 0x0C, 0x8A, 0x22, 0x14, 0x71, 0xEC, 0x5D, 0x40, 0xFA, 
-0x72, 0xE4, 0xE4, 0x92, 0x48, 0x05, 0x32, 0x51, 0x0E, 0xB9, 0x63, 0xF6, 0x26, 0x4D, 0xC4, 0x92, 
-0x3F, 0x50, 0xB0, 0x80, 0xF5, 0x7F, 0x32, 0xDA, 0x66, 0xBC, 0xF8, 0xCD, 0xFA, 0x38, 0xB3, 0x1F, 
-0x3B, 0xA2, 0x35, 0x9C, 0xB0, 0xB2, 0xC9, 0xC9, 0x62, 0x6B, 0xA4, 0x30, 0x9D, 0x54, 0xB5, 0x50, 
-0x01, 0x7E, 0x93, 0xC6, 0xF2, 0x17, 0x2F, 0x92, 0xC1, 0x60, 0xDE, 0x96, 0xBC, 0x9C, 0xBE, 0x65, 
-0x04, 0x1B, 0xAF, 0x66, 0x33, 0xEF, 0xBE, 0x0A, 0x91, 0x39, 0x64, 0xDF, 0x17, 0x50, 0x9A, 0x91, 
-0x11, 0x4D, 0xD9, 0x57, 0xA0, 0x6A, 0x15, 0xB2, 0x88, 0x28, 0x77, 0x22, 0x96, 0xB2, 0x5F, 0x7C, 
-0xF1, 0x51, 0x19, 0xD3, 0xA6, 0x75, 0xF8, 0xC5, 0x47, 0xC2, 0xCB, 0xE6, 0x8B, 0x8F, 0xA2, 0x53, 
-0x1B, 0x91, 0x10, 0xE0, 0xBD, 0xD6, 0x58, 0x96, 0x36, 0x26, 0xA6, 0x82, 0x42, 0x4B, 0x97, 0x8D, 
-0xCE, 0x21, 0xC1, 0x38, 0x51, 0x76, 0x76, 0x96, 0x7D, 0x6F, 0x59, 0x9C, 0x02, 0x6F, 0xD9, 0x19, 
-0xD5, 0xD5, 0x06, 0x6E, 0x8A, 0x46, 0xF5, 0xF7, 0x37, 0x49, 0xB2, 0x1C, 0xEE, 0xEC, 0x7C, 0xF1, 
-0x11, 0xE0, 0x64, 0x9E, 0x0C, 0x0C, 0x4F, 0x45, 0x28, 0xFD, 0x24, 0x7C, 0x8D, 0x5A, 0xF4, 0xB1, 
-0x1B, 0x73, 0xA7, 0xB3, 0x11, 0xB1, 0xD5, 0xEF, 0x6B, 0x61, 0xBB, 0x3E, 0x20, 0x2A, 0x00, 0x1E, 
-0xFE, 0xBA, 0xDC, 0x08, 0x42, 0xDD, 0xBC, 0x1F, 0xB1, 0x87, 0xA4, 0xDB, 0x43, 0x2B, 0x7C, 0xC4, 
-0x67, 0x5C, 0x89, 0x09, 0x72, 0x16, 0x27, 0xE7, 0x57, 0x1D, 0xB2, 0xB4, 0xB3, 0xB3, 0xCB, 0xBA, 
-0x6E, 0xCD, 0xBC, 0xC0, 0xF5, 0x65, 0x97, 0xD4, 0xD1, 0x82, 0xC8, 0xAC, 0x7C, 0x43, 0x4B, 0x4C, 
-0xE6, 0x46, 0x41, 0x45, 0x82, 0x30, 0x35, 0x2C, 0x0E, 0x6A, 0x64, 0x12, 0x33, 0x8B, 0x72, 0xC9, 
-0x2A, 0x4E, 0xC9, 0x1C, 0xDA, 0x93, 0x5E, 0x1A, 0x68, 0x2D, 0xFB, 0xD2, 0xA7, 0x93, 0x45, 0xF1, 
-0x0F, 0x5E, 0x72, 0xE3, 0xB4, 0x28, 0x3D, 0x1B, 0xB4, 0x48, 0xC8, 0xD7, 0xBC, 0x97, 0xD7, 0x64, 
-0xB4, 0x3A, 0x1D, 0xEC, 0x55, 0x5B, 0xB7, 0x52, 0xDA, 0xD0, 0xCF, 0xE6, 0xC1, 0x51, 0x85, 0x3E, 
-0x69, 0x9B, 0x14, 0x22, 0x98, 0xDA, 0x5E, 0xE1, 0x94, 0x0D, 0x36, 0x67, 0x3D, 0x7F, 0x65, 0x9F, 
-0x50, 0x69, 0xE6, 0xC7, 0xF3, 0x30, 0x49, 0x44, 0xFB, 0x43, 0x63, 0xEF, 0x4E, 0x09, 0xD5, 0xA0, 
-0xE3, 0x9E, 0x88, 0x38, 0x4F, 0x25, 0x90, 0x60, 0x59, 0x75, 0xA9, 0x75, 0x1A, 0x81, 0xFA, 0x5E, 
-0x44, 0x7B, 0x16, 0x40, 0xA9, 0x4B, 0x23, 0xA7, 0x8E, 0x5A, 0x70, 0x58, 0xE5, 0x44, 0x9A, 0xF8, 
-0x70, 0x80, 0x6A, 0x8F, 0xEC, 0x13, 0xF5, 0x8D, 0xE4, 0x3E, 0x92, 0xD1, 0xA8, 0xF7, 0xB3, 0xED, 
-0xF6, 0xF7, 0x46, 0xC8, 0x64, 0xD2, 0x61, 0x4B, 0xF6, 0xA2, 0x16, 0x2F, 0x64, 0xFD, 0x57, 0x2F, 
-0x54, 0x93, 0x69, 0xDF, 0x44, 0x65, 0x1C, 0x68, 0xCA, 0x9B, 0x6A, 0xBA, 0x33, 0xCC, 0x30, 0x33, 
-0x7A, 0xE0, 0xDA, 0x3D, 0x3B, 0xA1, 0x6D, 0xCA, 0x0B, 0x7A, 0x14, 0x51, 0xC1, 0xF0, 0xAA, 0xD1, 
-0x5A, 0xF4, 0x81, 0x28, 0x42, 0x67, 0x18, 0x5A, 0xF8, 0xA9, 0x87, 0xEE, 0x6B, 0xC1, 0xEE, 0x70, 
-0x16, 0x56, 0xE9, 0x2C, 0xE4, 0x41, 0x1A, 0xFF, 0xDC, 0xA7, 0x28, 0x8D, 0x5E, 0xBB, 0x63, 0x5D, 
-0xA0, 0x32, 0x98, 0xE4, 0x7D, 0x7D, 0xEA, 0xA8, 0xEC, 0x0E, 0x5D, 0x91, 0xED, 0xF4, 0x8B, 0x8F, 
-0xA2, 0x47, 0x9B, 0xA6, 0x19, 0x85, 0x95, 0x2B, 0x56, 0xB3, 0x3D, 0xE3, 0x8B, 0x8F, 0xC4, 0xB9, 
-0x61, 0x49, 0xC9, 0xDC, 0xC5, 0xA5, 0xAC, 0x81, 0xB4, 0xAA, 0xDA, 0x9B, 0xDA, 0x2C, 0xAE, 0xD8, 
-0x0C, 0x6A, 0x8A, 0x3D, 0x97, 0x24, 0x60, 0x4C, 0x71, 0xC2, 0x03, 0xD9, 0x14, 0x3D, 0x47, 0xC6, 
-0x85, 0xCD, 0x29, 0xE1, 0x47, 0x19, 0x0B, 0xEC, 0x6C, 0xF2, 0x3D, 0x4C, 0xDC, 0xEE, 0x99, 0xDD, 
-0x29, 0x5B, 0xCC, 0x1B, 0xA5, 0xCB, 0x0B, 0x27, 0x13, 0xD5, 0x67, 0xD7, 0xDF, 0x50, 0x66, 0x2B, 
-0x56, 0x68, 0x48, 0xAE, 0xEA, 0xCE, 0x86, 0xFD, 0x6B, 0x7E, 0x23, 0x0E, 0x76, 0x10, 0xBA, 0x16, 
-0xDF, 0x8C, 0x43, 0x37, 0x9A, 0xD6, 0x66, 0x3B, 0x65, 0xA5, 0xE4, 0x32, 0x44, 0x03, 0xA4, 0x76, 
-0x53, 0xC2, 0xDA, 0xCA, 0x26, 0x9C, 0xA2, 0x95, 0x92, 0x51, 0xB5, 0x87, 0x6D, 0xCC, 0xB1, 0xD6, 
-0xDE, 0x68, 0xAE, 0x9E, 0x43, 0xFA, 0x57, 0x56, 0xE6, 0xA6, 0x36, 0xEF, 0x21, 0x75, 0xA5, 0x2E, 
-0x1F, 0xAF, 0x75, 0x01, 0x54, 0x06, 0x93, 0xDD, 0xB4, 0xDB, 0x2A, 0x4E, 0xA2, 0x30, 0x2C, 0xC8, 
-0x87, 0x34, 0x62, 0x41, 0x78, 0x0A, 0x6E, 0x05, 0x0D, 0xE2, 0x0C, 0x52, 0x21, 0x6F, 0x59, 0x7A, 
-0x9F, 0xAD, 0x90, 0x56, 0x56, 0x06, 0xF9, 0x4E, 0xA5, 0x54, 0x95, 0x3D, 0xA6, 0xC5, 0x53, 0x6E, 
-0x57, 0xA9, 0x52, 0x60, 0x83, 0x54, 0x5E, 0x92, 0xC0, 0x5B, 0xEA, 0xB6, 0xCC, 0x4F, 0xFD, 0xE7, 
-0x7F, 0xFB, 0xD3, 0x7F, 0xFC, 0xFB, 0x9F, 0x32, 0xAC, 0x36, 0xC1, 0x4A, 0x31, 0x53, 0x96, 0xFE, 
-0x3E, 0xE3, 0xD2, 0xA5, 0x04, 0x78, 0xAF, 0x13, 0xCE, 0xA4, 0x24, 0xB5, 0x86, 0xB3, 0x68, 0x6A, 
-0x6D, 0xDF, 0xDA, 0x18, 0x4A, 0x2E, 0xE2, 0x0C, 0x16, 0x10, 0x98, 0xBA, 0xB3, 0xA7, 0x1B, 0x20, 
-0x2C, 0xD7, 0x1F, 0x0B, 0x85, 0xF2, 0xCD, 0x15, 0x50, 0xD5, 0x3E, 0x92, 0x9A, 0x3E, 0x96, 0xBF, 
-0x98, 0xCD, 0xB0, 0x4C, 0x7B, 0xF3, 0x53, 0xB3, 0x1E, 0xAB, 0x6C, 0x1D, 0x17, 0xDE, 0xA0, 0xBF, 
-0xDB, 0x3A, 0x6C, 0x42, 0x8D, 0x85, 0xB1, 0xAA, 0x77, 0x30, 0x54, 0x32, 0x71, 0x22, 0x1A, 0xE5, 
-0xEA, 0x69, 0x39, 0x94, 0xF8, 0x57, 0x48, 0x92, 0x24, 0x34, 0x93, 0xCC, 0x56, 0x9F, 0x1A, 0xF4, 
-0x01, 0xD9, 0x7D, 0xDF, 0x6F, 0x3A, 0xFD, 0x9F, 0x81, 0xED, 0x38, 0xED, 0x76, 0xC7, 0x7E, 0x5A, 
-0x29, 0xCD, 0xBB, 0x20, 0x0E, 0xAF, 0xA0, 0xB6, 0x28, 0x62, 0xB2, 0x29, 0xDC, 0x62, 0x19, 0xD1, 
-0x15, 0xB8, 0x4C, 0xDC, 0xF2, 0x38, 0x43, 0x6E, 0x53, 0x56, 0x7C, 0xA5, 0x2B, 0x58, 0x9E, 0xCB, 
-0x26, 0xF3, 0x0D, 0x6A, 0x6B, 0x24, 0xEC, 0xA1, 0x00, 0x6E, 0x52, 0x91, 0x2A, 0x15, 0x44, 0xF1, 
-0x86, 0x11, 0xD3, 0xE5, 0x83, 0x74, 0xAA, 0xED, 0x93, 0x44, 0xE9, 0x4B, 0xAD, 0x95, 0xA2, 0x60, 
-0x6B, 0xD1, 0x1C, 0xFE, 0xCE, 0xF7, 0x46, 0xBC, 0x9D, 0x08, 0xA3, 0x64, 0xEF, 0xF0, 0x9E, 0x22, 
-0x47, 0x9F, 0x07, 0xC9, 0xD7, 0x07, 0x10, 0xA7, 0x5E, 0x82, 0xE9, 0x94, 0x2C, 0x16, 0xA5, 0x50, 
-0x5C, 0x01, 0xBB, 0x1F, 0xF3, 0xC4, 0xA9, 0x84, 0x2B, 0x74, 0x33, 0x45, 0xA3, 0x63, 0x82, 0x28, 
-0x22, 0xAA, 0x84, 0x6E, 0xE9, 0x9C, 0xF0, 0x39, 0x5E, 0x50, 0xBF, 0xDB, 0xA1, 0xC4, 0xBF, 0x22, 
-0x9E, 0x99, 0x0E, 0x08, 0x02, 0xBD, 0xF5, 0x0E, 0xF1, 0x74, 0xD4, 0xA2, 0xA4, 0x35, 0x67, 0xA8, 
-0xA9, 0xB5, 0x42, 0xA8, 0x1D, 0x5D, 0x2A, 0x3D, 0xD4, 0x2A, 0x40, 0x84, 0x09, 0xA1, 0xE3, 0x7F, 
-0x84, 0x0D, 0x77, 0x15, 0xE1, 0x35, 0x81, 0x9A, 0xE1, 0x81, 0x00, 0x3C, 0xE7, 0xC9, 0x50, 0x55, 
-0x0A, 0x36, 0x5A, 0x9B, 0x40, 0x65, 0xEC, 0xC2, 0x8C, 0x26, 0x07, 0xBC, 0xC7, 0x1C, 0x81, 0x01, 
-0x50, 0xC6, 0xC5, 0x44, 0x57, 0xCA, 0xD3, 0x52, 0x73, 0x7D, 0x3F, 0xBC, 0x8B, 0x19, 0x70, 0x0A, 
-0x3C, 0xA2, 0x05, 0x15, 0x73, 0x8B, 0x65, 0xCC, 0x64, 0x82, 0x46, 0xE8, 0xA6, 0x48, 0xD4, 0xA9, 
-0x3D, 0xA6, 0x08, 0xC8, 0xF4, 0x62, 0x32, 0x1A, 0x29, 0xA8, 0x43, 0x45, 0x52, 0x10, 0xA0, 0xB3, 
-0x34, 0x45, 0x6D, 0x92, 0xD5, 0x85, 0x34, 0x3D, 0xFD, 0x99, 0xC1, 0x1A, 0xF3, 0x75, 0x6E, 0x4D, 
-0x43, 0x9F, 0x06, 0x59, 0x04, 0x90, 0x16, 0x8F, 0x30, 0x05, 0xE2, 0x71, 0xF6, 0xD4, 0xB1, 0xDB, 
-0x6F, 0x3D, 0x94, 0xEF, 0x94, 0x70, 0x6A, 0x87, 0x3A, 0x9B, 0x03, 0xED, 0x53, 0x46, 0x45, 0xA7, 
-0x93, 0x5A, 0x34, 0xC9, 0x1B, 0x12, 0x33, 0x59, 0x7C, 0x9B, 0xD0, 0x01, 0x53, 0x00, 0x6D, 0x49, 
-0x3D, 0xA5, 0x70, 0x5A, 0x42, 0xF6, 0x7B, 0x3C, 0x7E, 0x17, 0x83, 0xFC, 0xE3, 0xFA, 0x43, 0xB5, 
-0x47, 0xE2, 0x91, 0xD9, 0xFD, 0x33, 0x41, 0xB7, 0x5F, 0x3A, 0x1E, 0x73, 0xC8, 0xAB, 0xD9, 0x0A, 
-0x8D, 0xE1, 0xB9, 0xE1, 0x87, 0x06, 0x9E, 0x6A, 0xB4, 0x24, 0x27, 0x3C, 0x35, 0xE2, 0x34, 0x38, 
-0xB7, 0x93, 0x8B, 0xC0, 0x59, 0xC5, 0x6C, 0x91, 0x45, 0x75, 0x76, 0x07, 0x49, 0xB5, 0xA4, 0x42, 
-0x2F, 0x71, 0xED, 0x46, 0x4B, 0x7B, 0x61, 0xED, 0x8A, 0x5B, 0x6A, 0x96, 0x5A, 0x54, 0x5E, 0x6B, 
-0xB5, 0x9D, 0x38, 0x9B, 0xB1, 0x3B, 0xCE, 0x6E, 0x5C, 0xE0, 0xFC, 0x6D, 0x0C, 0x55, 0x86, 0x35, 
-0x92, 0xA4, 0x19, 0xEB, 0xBB, 0xCC, 0x4B, 0xDA, 0xB0, 0xB0, 0xF2, 0x95, 0x88, 0x4F, 0xED, 0x20, 
-0x69, 0x29, 0xA4, 0xEC, 0xE4, 0xC6, 0x8D, 0x1D, 0xA5, 0x4B, 0x9D, 0x7A, 0x0F, 0x0B, 0xA2, 0x14, 
-0x25, 0x2A, 0x6A, 0xEF, 0x80, 0xED, 0x8D, 0x1A, 0xE8, 0xE1, 0x2A, 0xF3, 0x8A, 0x54, 0xAC, 0x44, 
-0xCB, 0xBA, 0x33, 0x4E, 0x1B, 0x8B, 0xAB, 0xA6, 0xB3, 0x85, 0xBB, 0x5D, 0xF8, 0x66, 0x98, 0xC5, 
-0x87, 0x84, 0x56, 0x17, 0xB4, 0x63, 0x2F, 0xE8, 0x48, 0xC6, 0x18, 0x4D, 0x8B, 0x24, 0xBE, 0x30, 
-0x10, 0x7E, 0x8E, 0x2F, 0xDE, 0x5E, 0x89, 0x7B, 0xBD, 0x61, 0x23, 0x76, 0xF0, 0x24, 0xAD, 0x3F, 
-0xC5, 0xE3, 0xB5, 0x8B, 0x3B, 0x37, 0xE2, 0x1D, 0x23, 0x3C, 0x9D, 0x73, 0x6F, 0x26, 0x72, 0x94, 
-0xCC, 0xC8, 0xE3, 0xA3, 0x60, 0x5E, 0x87, 0xC7, 0x4D, 0x2D, 0x2B, 0x16, 0x0B, 0xE1, 0x52, 0xF0, 
-0xC5, 0x3E, 0x30, 0x58, 0x27, 0xE5, 0x91, 0x76, 0x3B, 0xAA, 0x10, 0x2F, 0xE4, 0x16, 0xFD, 0x5D, 
-0xE4, 0x2E, 0x6F, 0x64, 0x82, 0x21, 0xDC, 0xAF, 0x9C, 0x74, 0xBE, 0xC4, 0x69, 0x74, 0xA7, 0x03, 
-0x2C, 0x89, 0x08, 0xBC, 0x72, 0xE4, 0xDB, 0xE6, 0x2B, 0x29, 0x1F, 0x18, 0xC0, 0xC8, 0x86, 0x57, 
-0x21, 0x2C, 0x0C, 0x76, 0x42, 0x39, 0xB9, 0x01, 0x09, 0xD4, 0xB0, 0xF0, 0x4D, 0x16, 0x83, 0x1B, 
-0x34, 0x6E, 0x0F, 0x4D, 0x8F, 0xB1, 0x9B, 0x71, 0x97, 0xF1, 0x7B, 0xB2, 0x57, 0x91, 0xB6, 0x17, 
-0xEB, 0x8E, 0xED, 0x53, 0x39, 0x0C, 0x7F, 0xFD, 0x91, 0x7D, 0xCC, 0x69, 0x4F, 0x9A, 0x39, 0xD3, 
-0xD4, 0x05, 0xFD, 0x7E, 0x7F, 0x43, 0xFE, 0x07, 0xF6, 0x53, 0x8D, 0x0D, 0x7C, 0xB7, 0x4F, 0x97, 
-0x25, 0xA6, 0x89, 0x00, 0xB2, 0x63, 0x4D, 0x18, 0x0F, 0xCB, 0x60, 0x33, 0x12, 0x77, 0xB0, 0x85, 
-0xE1, 0x87, 0xD5, 0x12, 0x76, 0x24, 0xCC, 0x12, 0x1F, 0xDD, 0x72, 0x96, 0xDE, 0x64, 0x18, 0x6B, 
-0x33, 0x02, 0xF0, 0x7B, 0x2F, 0x4E, 0x04, 0x1E, 0x53, 0x21, 0x27, 0x85, 0x4B, 0xFB, 0x5B, 0x80, 
-0x0C, 0xEB, 0xC7, 0xA0, 0x8F, 0xC7, 0x13, 0x82, 0x9F, 0x3A, 0xB5, 0x76, 0xFA, 0xBD, 0xBE, 0x34, 
-0xD5, 0x23, 0x34, 0xBA, 0xDB, 0x02, 0x8F, 0x8D, 0x55, 0x8E, 0x21, 0xA5, 0x2E, 0x98, 0xA0, 0xD8, 
-0x90, 0xD1, 0x8A, 0x4E, 0x5B, 0x58, 0x60, 0x8B, 0xE7, 0x14, 0xE5, 0x70, 0x79, 0x1C, 0x64, 0x83, 
-0x42, 0x8F, 0x93, 0x61, 0x77, 0x40, 0x77, 0x18, 0x08, 0x4B, 0x20, 0x23, 0xA5, 0xF8, 0x11, 0x39, 
-0x88, 0x28, 0xD6, 0x98, 0xDF, 0x99, 0xE0, 0xA3, 0xF5, 0x1B, 0xDB, 0xF8, 0x06, 0x7F, 0xF7, 0xEF, 
-0x41, 0x76, 0x77, 0x4A, 0x47, 0xB1, 0x76, 0xF6, 0xD0, 0x84, 0x22, 0x42, 0xF0, 0xA9, 0x01, 0xA7, 
-0xD3, 0x1B, 0xF4, 0xF7, 0x3B, 0x4F, 0xF6, 0x07, 0x66, 0x83, 0xFD, 0xBA, 0x00, 0x76, 0x5D, 0x04, 
-0x2B, 0x6C, 0x52, 0x5B, 0xC2, 0x35, 0xA5, 0x2C, 0x30, 0x31, 0x21, 0x6F, 0x3A, 0x84, 0xFF, 0x0D, 
-0xC7, 0x60, 0xEF, 0x87, 0xEC, 0xDE, 0xF0, 0x6A, 0x3D, 0x64, 0x6B, 0xC3, 0xAB, 0x5B, 0xA8, 0x96, 
-0x0F, 0xEA, 0x16, 0x91, 0x35, 0x30, 0x15, 0x5D, 0x17, 0x8A, 0xAE, 0x2D, 0x45, 0x51, 0x7B, 0x1E, 
-0xB2, 0xA0, 0xFE, 0xBC, 0x8A, 0x5E, 0x7E, 0x7C, 0x9A, 0xD2, 0x27, 0x2D, 0xDA, 0xAA, 0x0A, 0x63, 
-0x5F, 0xD3, 0x69, 0x78, 0x64, 0xCC, 0x85, 0xAA, 0x01, 0xAC, 0xC4, 0xAF, 0xC2, 0x91, 0x34, 0x9E, 
-0x9E, 0x2B, 0x2C, 0x80, 0xAC, 0x9C, 0xF5, 0x37, 0x85, 0x8D, 0xA1, 0xAC, 0x0B, 0x6C, 0x15, 0x23, 
-0xC5, 0x86, 0x78, 0x64, 0x22, 0x62, 0xE9, 0x45, 0xA2, 0xD6, 0xC6, 0x7E, 0x34, 0x3B, 0x96, 0x84, 
-0x6D, 0x89, 0x8C, 0x7D, 0x4D, 0x02, 0xA4, 0x33, 0x36, 0x90, 0x0A, 0x2F, 0x81, 0x45, 0x76, 0x41, 
-0xD4, 0x05, 0x69, 0x7C, 0x73, 0xDA, 0x90, 0x75, 0x4F, 0x4F, 0xFB, 0x5C, 0x96, 0x5D, 0xD2, 0xCA, 
-0xB9, 0xE4, 0x42, 0x70, 0xB7, 0xDA, 0x73, 0x9B, 0x9E, 0xB7, 0xCD, 0x5D, 0xDB, 0xAB, 0x80, 0x76, 
-0x88, 0x2B, 0x6F, 0x81, 0x67, 0x10, 0x3C, 0x14, 0xED, 0xAA, 0x49, 0x0B, 0x41, 0x7A, 0x49, 0x71, 
-0x22, 0x52, 0x8D, 0x68, 0x07, 0x88, 0x27, 0x9D, 0x79, 0x9C, 0x1C, 0x05, 0xDE, 0x82, 0x20, 0xBD, 
-0x8A, 0x00, 0xBF, 0x4E, 0xB5, 0x85, 0x6D, 0xD2, 0x8A, 0xE8, 0x38, 0x77, 0xF5, 0xE0, 0xE7, 0x9D, 
-0xEE, 0x68, 0xA9, 0x74, 0x08, 0x56, 0x8E, 0x7B, 0xDE, 0xE8, 0xE2, 0xA3, 0x44, 0x69, 0xF4, 0xDE, 
-0xEC, 0x0E, 0x06, 0xA4, 0x07, 0x78, 0x53, 0x0E, 0x72, 0xF8, 0x14, 0xF8, 0xA9, 0x5B, 0x93, 0x8A, 
-0x11, 0x0A, 0x0F, 0xFA, 0x69, 0x5E, 0x5E, 0x1A, 0x2B, 0x68, 0xA6, 0xB0, 0x5F, 0xDE, 0x7A, 0x86, 
-0x64, 0x34, 0x93, 0x7B, 0x4A, 0x42, 0x84, 0xA3, 0x80, 0x7D, 0x43, 0x9F, 0xCC, 0x01, 0x19, 0xA3, 
-0xEC, 0xBC, 0x28, 0x53, 0x69, 0xF3, 0xF2, 0x66, 0x1D, 0x7B, 0x93, 0x18, 0x96, 0x08, 0x5F, 0xEA, 
-0xB7, 0x99, 0x5A, 0x02, 0xA6, 0xD0, 0x88, 0xE5, 0xCA, 0xC7, 0x6C, 0xD6, 0xCC, 0x39, 0x0E, 0x57, 
-0x7E, 0xB8, 0x18, 0x77, 0x1A, 0xAC, 0x88, 0x30, 0xC1, 0x0C, 0xAC, 0x35, 0xAB, 0x82, 0x96, 0x04, 
-0x95, 0x6C, 0xA0, 0x6D, 0x4C, 0xE9, 0x60, 0x33, 0x6C, 0x2C, 0x3D, 0x51, 0xA5, 0x7F, 0x5F, 0xEB, 
-0x00, 0x99, 0xAE, 0xA9, 0xCA, 0x3A, 0xAB, 0xB2, 0xAE, 0xAF, 0x02, 0xD3, 0x79, 0x45, 0xE1, 0xEE, 
-0xF7, 0x4F, 0xA0, 0xC5, 0xAF, 0x00, 0xC6, 0x93, 0x69, 0xB3, 0x6A, 0xE9, 0x99, 0xBA, 0xF8, 0x17, 
-0xD0, 0x18, 0x05, 0x1C, 0xF2, 0xA7, 0xED, 0xD6, 0xD6, 0x9E, 0x91, 0x08, 0x76, 0x40, 0x3A, 0x26, 
-0x9E, 0xB4, 0xA3, 0xBA, 0xA3, 0x22, 0xF2, 0xE3, 0x24, 0xA2, 0x85, 0x65, 0x61, 0x1B, 0xB8, 0x91, 
-0x7C, 0x75, 0xC0, 0x1C, 0xE8, 0xB7, 0x00, 0x82, 0x87, 0xF4, 0x08, 0xF6, 0xC8, 0x5A, 0x6B, 0x2D, 
-0x6A, 0xAD, 0x1B, 0xD6, 0x32, 0xB1, 0x15, 0x2D, 0xF5, 0x48, 0xA2, 0x97, 0xC4, 0xCE, 0x9C, 0x3B, 
-0xEE, 0x7E, 0xD0, 0xD1, 0x4F, 0xDA, 0xF7, 0x09, 0xCE, 0x2F, 0xCC, 0x32, 0x76, 0x62, 0xD0, 0x1F, 
-0x0C, 0xF6, 0x47, 0xDA, 0xC2, 0xA2, 0xCB, 0x93, 0x35, 0x15, 0x5E, 0xAB, 0x85, 0xF5, 0xBD, 0xC8, 
-0x6E, 0xD5, 0x93, 0xDD, 0x10, 0x91, 0x2A, 0xB1, 0xB7, 0xF0, 0x7C, 0xD8, 0x3E, 0xB2, 0x70, 0x07, 
-0x6D, 0xE5, 0xEB, 0x8B, 0x93, 0x8B, 0x21, 0x7B, 0xE5, 0x05, 0x53, 0xC9, 0x81, 0xD1, 0xA6, 0xB2, 
-0x70, 0x63, 0xB2, 0xAD, 0xC8, 0xAA, 0xDF, 0xE8, 0x63, 0x7E, 0x81, 0xA5, 0x2D, 0x7D, 0xCE, 0x64, 
-0x3A, 0xF8, 0x21, 0x13, 0xB2, 0x9D, 0x07, 0xB3, 0x49, 0x49, 0x25, 0x64, 0xAF, 0xDC, 0x24, 0x89, 
-0xDC, 0x09, 0xE8, 0x91, 0x3E, 0xAE, 0x66, 0x5D, 0xBC, 0xEC, 0xCE, 0x93, 0xC7, 0x5F, 0x72, 0xE8, 
-0x77, 0x0D, 0xFA, 0xEA, 0x21, 0x3C, 0xF2, 0xE3, 0x8B, 0x85, 0xA2, 0x3E, 0x6E, 0xBA, 0x36, 0xE5, 
-0xAA, 0x14, 0xF3, 0xD7, 0x6C, 0x6D, 0xCA, 0x55, 0x29, 0x66, 0xD1, 0xA6, 0x75, 0xA6, 0xF4, 0x01, 
-0x0D, 0x89, 0xA9, 0xDE, 0xAD, 0x29, 0x4D, 0x04, 0x02, 0x6D, 0xD8, 0x4B, 0x6F, 0x1A, 0x66, 0x27, 
-0x79, 0xB2, 0xD3, 0x44, 0x80, 0x22, 0xD3, 0xC4, 0x91, 0x98, 0x4C, 0xE2, 0x97, 0x57, 0xCB, 0xA8, 
-0x7A, 0xE6, 0x2E, 0xDB, 0xDD, 0xEB, 0x12, 0xBF, 0xA2, 0x98, 0x83, 0x44, 0x47, 0xAA, 0x42, 0x48, 
-0xD1, 0x39, 0xB1, 0x31, 0xFE, 0x44, 0x6C, 0x60, 0x92, 0x20, 0xA0, 0x96, 0xE0, 0xE8, 0x24, 0x1F, 
-0xE0, 0xAC, 0xFA, 0x7D, 0x21, 0x44, 0x58, 0x0E, 0xBC, 0xD5, 0x42, 0x10, 0x42, 0x87, 0xE9, 0xAC, 
-0x13, 0xF9, 0xF1, 0xEB, 0xCE, 0x11, 0x11, 0x9D, 0x24, 0x44, 0x23, 0xB1, 0x91, 0x46, 0x14, 0xFA, 
-0x48, 0x88, 0x36, 0x62, 0x23, 0x6D, 0x98, 0x98, 0xAF, 0xCA, 0xBB, 0xAD, 0x3C, 0xB8, 0xC8, 0x7F, 
-0x89, 0x6B, 0x43, 0x83, 0x1F, 0x24, 0x43, 0xD9, 0x17, 0x07, 0x35, 0x69, 0x16, 0x45, 0x51, 0x37, 
-0x78, 0x80, 0xD1, 0x6F, 0x76, 0xCF, 0xB6, 0xE1, 0xCA, 0xB2, 0xD2, 0x9A, 0x6D, 0xC3, 0x94, 0x0D, 
-0x27, 0xA2, 0xE4, 0xB2, 0x99, 0x99, 0x70, 0x1D, 0xCB, 0x95, 0x32, 0x33, 0x61, 0x38, 0x41, 0x08, 
-0x3D, 0x0B, 0x84, 0x04, 0x21, 0xF4, 0x0C, 0x10, 0x36, 0x4D, 0x96, 0x0D, 0x46, 0x90, 0xCE, 0xE5, 
-0x35, 0x7A, 0x5F, 0xB2, 0x6F, 0xF1, 0xE8, 0x47, 0xFC, 0x40, 0x71, 0x85, 0xD8, 0xC4, 0x93, 0x03, 
-0xF4, 0x9F, 0xD1, 0xD4, 0xBD, 0x8A, 0x3C, 0x5A, 0x8A, 0x86, 0x3D, 0x44, 0x96, 0x6C, 0x78, 0x80, 
-0xE3, 0x8D, 0x7B, 0xCF, 0xE2, 0x25, 0x07, 0xC5, 0x66, 0xE2, 0xBB, 0x8B, 0xA5, 0x71, 0x29, 0x52, 
-0x11, 0x95, 0x1C, 0xB1, 0x57, 0x4F, 0x04, 0x07, 0xA3, 0x76, 0xF1, 0xF3, 0xDA, 0x90, 0xD7, 0x48, 
-0xD4, 0x3E, 0x04, 0x21, 0xD3, 0xB8, 0x94, 0x08, 0xD2, 0x01, 0x23, 0xB0, 0x3B, 0x54, 0xBE, 0xF3, 
-0x64, 0x77, 0x30, 0x32, 0x16, 0x5E, 0xCB, 0xC2, 0x6B, 0x6B, 0x61, 0x6D, 0xEC, 0x3A, 0x8A, 0x5B, 
-0x5F, 0x1D, 0x50, 0x8B, 0xDA, 0x7D, 0x78, 0x2D, 0xDF, 0xAE, 0x4D, 0x1B, 0xEF, 0x0F, 0x78, 0xC1, 
-0xE7, 0x18, 0xA6, 0x74, 0xA2, 0x3F, 0xD6, 0x8E, 0x0D, 0xBC, 0x04, 0xB9, 0x07, 0xC3, 0xEE, 0xF1, 
-0x33, 0xCA, 0x40, 0xA3, 0x6C, 0x1A, 0x51, 0x8B, 0xD7, 0x06, 0xDB, 0xCB, 0x9A, 0x87, 0x42, 0x46, 
-0xEE, 0xA9, 0xF5, 0xD3, 0x27, 0x4D, 0xA1, 0xAC, 0x95, 0xF6, 0xD7, 0x79, 0xFB, 0xEB, 0x26, 0x35, 
-0x0F, 0xA5, 0x00, 0xDE, 0x53, 0x01, 0x64, 0x8F, 0x6A, 0xE0, 0xE8, 0x17, 0xC3, 0x09, 0xE8, 0xCE, 
-0xD5, 0xCC, 0x34, 0xC9, 0x7D, 0x9F, 0xCC, 0xFA, 0x6F, 0x61, 0x0F, 0x70, 0x06, 0x5D, 0x06, 0xFF, 
-0xD1, 0x38, 0xBB, 0xB2, 0x35, 0x23, 0x28, 0x9D, 0x2E, 0x2F, 0x01, 0xE2, 0x9D, 0xAD, 0x1F, 0xF8, 
-0x15, 0x3A, 0x68, 0xE9, 0x90, 0xD5, 0xDE, 0xEE, 0xD7, 0xCF, 0x5F, 0x3D, 0x6D, 0x8F, 0xB4, 0x85, 
-0xD1, 0xE8, 0xFA, 0x83, 0xD4, 0xAA, 0x76, 0xF5, 0x45, 0xC6, 0x7C, 0xEE, 0x05, 0x97, 0x40, 0xF4, 
-0x15, 0xD3, 0x7F, 0xE3, 0x1D, 0xEF, 0x6F, 0x64, 0x2F, 0x93, 0x03, 0xC6, 0x88, 0xF1, 0xEB, 0xD0, 
-0x81, 0x8D, 0xAC, 0x8B, 0x5B, 0x94, 0x49, 0x0B, 0x57, 0x30, 0x08, 0xA5, 0x13, 0x2C, 0x9D, 0xE8, 
-0x4B, 0x6F, 0x6A, 0x22, 0x7F, 0x0B, 0x13, 0xE7, 0x98, 0xE7, 0x9C, 0xC6, 0xFD, 0x50, 0x0E, 0x5A, 
-0x37, 0x99, 0x4A, 0x21, 0x37, 0x9A, 0xE0, 0x32, 0xEC, 0x22, 0xE1, 0x77, 0xD9, 0x0B, 0x22, 0xCB, 
-0x3D, 0xD8, 0xA7, 0x88, 0xF3, 0x5D, 0x9E, 0x35, 0x3E, 0xD8, 0x2C, 0x82, 0x19, 0xC6, 0x6B, 0x99, 
-0xB7, 0x66, 0xA7, 0xEA, 0x12, 0xCE, 0xED, 0x28, 0x24, 0x98, 0x8A, 0x14, 0xB4, 0x9D, 0xB4, 0x1F, 
-0x33, 0xCF, 0xF7, 0x73, 0x3A, 0x1E, 0x3C, 0x9D, 0xBA, 0x93, 0xE7, 0x6D, 0xE2, 0xFF, 0xC7, 0x6B, 
-0x57, 0xC3, 0xFB, 0xC9, 0xAE, 0xA4, 0x80, 0x13, 0x61, 0x13, 0x06, 0x70, 0x22, 0xF2, 0x57, 0x80, 
-0xBB, 0x5C, 0x45, 0x4B, 0xDD, 0xF1, 0x65, 0x02, 0xA8, 0xAD, 0xFD, 0xEC, 0xD9, 0x33, 0x51, 0x15, 
-0x34, 0x8F, 0x75, 0x13, 0x74, 0x28, 0x50, 0x6C, 0xA8, 0x2F, 0x2F, 0x5E, 0xC3, 0x09, 0x49, 0xCD, 
-0xEA, 0xDD, 0xAB, 0x03, 0xEA, 0x18, 0x75, 0xB9, 0xD7, 0x18, 0xF8, 0x14, 0x5B, 0xFB, 0x9C, 0xF7, 
-0x68, 0x36, 0x9B, 0x59, 0x7A, 0x84, 0x41, 0x20, 0x58, 0x0C, 0xC3, 0x6C, 0x30, 0xAB, 0x45, 0x1C, 
-0xFA, 0x6E, 0xDC, 0x36, 0x5F, 0x39, 0x81, 0x2D, 0x93, 0x2E, 0x5F, 0xC9, 0x56, 0xF2, 0x8D, 0xEE, 
-0xA1, 0xB0, 0x8C, 0x8D, 0xAC, 0x5D, 0xA5, 0xA3, 0xE2, 0x04, 0xB8, 0x2B, 0xF6, 0x39, 0xD8, 0x73, 
-0xBB, 0x62, 0x4F, 0x63, 0x4F, 0x1B, 0x78, 0xDC, 0x1F, 0x62, 0xCC, 0xDA, 0x18, 0x8E, 0xAD, 0x5C, 
-0x91, 0x7D, 0x1D, 0xEA, 0xE4, 0x4F, 0x75, 0x76, 0xB7, 0xF2, 0xC1, 0x19, 0x99, 0x32, 0x8E, 0x8E, 
-0xE0, 0xA4, 0x3A, 0x47, 0x16, 0xEF, 0xF6, 0x07, 0x2F, 0xF6, 0x12, 0x45, 0xF7, 0xC8, 0xED, 0x5B, 
-0xD5, 0x2C, 0x65, 0x74, 0x7D, 0x60, 0xBB, 0x4B, 0xAE, 0xB8, 0x2A, 0x5F, 0x48, 0xBD, 0xBD, 0x93, 
-0xA4, 0x9C, 0x5A, 0x8E, 0x84, 0x35, 0x10, 0x8E, 0xA1, 0x51, 0x80, 0x47, 0xBB, 0x93, 0x3E, 0x0E, 
-0x64, 0x11, 0xAE, 0x62, 0xFE, 0x4F, 0x68, 0xF1, 0x85, 0x8D, 0x0C, 0xCB, 0xFE, 0x13, 0x88, 0xD9, 
-0x08, 0xB1, 0x8F, 0xF1, 0x4F, 0xE6, 0x2A, 0x7F, 0x54, 0xAA, 0xFC, 0x31, 0xAD, 0x92, 0x84, 0x4B, 
-0x1D, 0xEF, 0x3B, 0xBE, 0xE1, 0x30, 0xF2, 0x09, 0x9E, 0xD5, 0x21, 0x8B, 0xC9, 0x9D, 0x07, 0x04, 
-0x1F, 0x54, 0x79, 0xA1, 0x72, 0x5E, 0x21, 0x40, 0x15, 0x3E, 0xE5, 0x8D, 0x96, 0x93, 0x0A, 0xA4, 
-0xB7, 0xC8, 0x31, 0x98, 0xD4, 0x5B, 0x45, 0x6D, 0x91, 0x5D, 0x37, 0x69, 0xB5, 0xD0, 0xD7, 0xEF, 
-0xD1, 0x55, 0x4E, 0x77, 0xAF, 0xB3, 0xDD, 0x3D, 0x10, 0xF3, 0x81, 0x6D, 0x07, 0xE9, 0x03, 0x2F, 
-0x66, 0x2F, 0x4C, 0x87, 0x82, 0x55, 0xC5, 0x06, 0x04, 0x97, 0xDD, 0x67, 0xCF, 0x50, 0xF0, 0xB0, 
-0x26, 0x7B, 0xCA, 0x96, 0x8D, 0x55, 0xDD, 0x78, 0xFC, 0x88, 0xFC, 0x4F, 0x8B, 0xC6, 0xFF, 0x4B, 
-0x04, 0xCD, 0xEB, 0xDA, 0xA9, 0xE4, 0x69, 0x8F, 0xF8, 0x0C, 0x1D, 0xA7, 0x69, 0xC3, 0x86, 0x6A, 
-0xE3, 0x88, 0xBB, 0x1F, 0xB6, 0xBB, 0xB7, 0xA1, 0xB2, 0x7A, 0xDF, 0x20, 0x95, 0xC0, 0xEF, 0x5B, 
-0x4E, 0x24, 0x79, 0x4C, 0x91, 0xB0, 0xCD, 0xD6, 0x2B, 0x11, 0x18, 0xCA, 0x1F, 0x7F, 0x63, 0x6B, 
-0xD6, 0xBC, 0xF7, 0xD1, 0x61, 0x25, 0x0A, 0xA1, 0xAB, 0x7A, 0xAD, 0xFF, 0x53, 0x2C, 0x5A, 0xF3, 
-0xF2, 0x33, 0xE4, 0x03, 0x96, 0x83, 0xD1, 0x84, 0xD0, 0x3D, 0x9C, 0x88, 0x8A, 0x74, 0x21, 0x6F, 
-0x22, 0x21, 0xBA, 0x41, 0xC5, 0x83, 0x5A, 0xFC, 0x86, 0xB5, 0x65, 0x30, 0x35, 0x85, 0x72, 0x4F, 
-0xC5, 0x09, 0x36, 0x75, 0x6B, 0xAD, 0x52, 0x22, 0x86, 0x01, 0x1C, 0x61, 0x3E, 0x6B, 0x10, 0xDD, 
-0x82, 0x95, 0xEB, 0xB3, 0x0B, 0x80, 0x14, 0x79, 0x53, 0x5E, 0x8C, 0x00, 0x28, 0x45, 0x14, 0x92, 
-0x53, 0x58, 0x54, 0xB8, 0x9A, 0xB8, 0x81, 0x29, 0x07, 0xB6, 0xF0, 0x1D, 0xDB, 0x52, 0xB6, 0x42, 
-0x65, 0x79, 0xD3, 0xEE, 0x0C, 0x36, 0x55, 0x6B, 0xE6, 0xE9, 0x38, 0xA1, 0xE3, 0xEC, 0x75, 0xB0, 
-0xC2, 0x65, 0x3D, 0x28, 0x0C, 0xA9, 0xF2, 0x82, 0x55, 0xB8, 0x8A, 0x6B, 0x01, 0xE6, 0x45, 0xF1, 
-0xDE, 0x09, 0xDC, 0x66, 0xF8, 0xB4, 0xB2, 0x03, 0x19, 0x42, 0xD5, 0x50, 0x6C, 0xC4, 0xF3, 0x01, 
-0x37, 0xA1, 0x8F, 0x27, 0x9E, 0x91, 0x8E, 0x23, 0xF4, 0x1B, 0x21, 0x60, 0x3A, 0x7E, 0x62, 0xCC, 
-0x95, 0x4B, 0x42, 0x01, 0xA5, 0x73, 0x84, 0xA2, 0xFF, 0x1C, 0xD0, 0x57, 0x91, 0x35, 0x57, 0xA0, 
-0xF4, 0x2B, 0xD6, 0xC2, 0xA7, 0xE1, 0x32, 0x7D, 0x08, 0xA8, 0xA1, 0x67, 0xC7, 0x59, 0x77, 0xC5, 
-0x9B, 0xBC, 0xFB, 0x5A, 0x77, 0xFF, 0x13, 0x0D, 0x0B, 0xAE, 0xA6, 0x78, 0xA4, 0x5B, 0x37, 0x1E, 
-0x2B, 0x45, 0x76, 0x7D, 0x86, 0xEC, 0xED, 0x12, 0x64, 0x33, 0x91, 0x74, 0x06, 0x86, 0x9B, 0xD3, 
-0x23, 0x86, 0xF2, 0xB8, 0x20, 0x93, 0x51, 0x4A, 0x6E, 0xC2, 0x58, 0x97, 0x70, 0xD4, 0x55, 0x67, 
-0x7E, 0x03, 0xAB, 0x81, 0x3D, 0xD4, 0x08, 0xDC, 0x24, 0xE1, 0xB1, 0x90, 0xEC, 0x1E, 0x94, 0x86, 
-0xBE, 0xB2, 0xDC, 0xC2, 0xA5, 0x6D, 0xB5, 0x19, 0x63, 0x25, 0xFF, 0x66, 0xE7, 0x52, 0x49, 0xD3, 
-0xB4, 0xC5, 0x34, 0xA5, 0x88, 0xC7, 0xF5, 0x85, 0xAB, 0x63, 0x89, 0xE1, 0x61, 0x08, 0xA4, 0xD3, 
-0x7A, 0xD0, 0x75, 0x02, 0x08, 0xE3, 0x81, 0xF7, 0x08, 0x3C, 0x21, 0xCE, 0x7A, 0x7E, 0xFA, 0xC3, 
-0x50, 0x5E, 0xD3, 0x44, 0x03, 0xCA, 0x83, 0xAB, 0x0A, 0x24, 0x85, 0x3B, 0xE0, 0x9C, 0xB2, 0x43, 
-0x63, 0xD9, 0x63, 0x10, 0xD8, 0xFC, 0x70, 0xAE, 0xCB, 0xCB, 0x2C, 0x0E, 0xEE, 0x63, 0xA1, 0xFC, 
-0x86, 0x95, 0x62, 0x09, 0x9C, 0x5F, 0x8C, 0x00, 0x8D, 0xCE, 0x48, 0xCB, 0x32, 0x94, 0x20, 0xD2, 
-0xC4, 0x62, 0x50, 0x64, 0x50, 0x7A, 0x3F, 0xE5, 0x4B, 0x3F, 0x5C, 0xDB, 0xDA, 0x90, 0x25, 0xAC, 
-0xAD, 0x88, 0x7B, 0xB5, 0x31, 0x2B, 0x6D, 0xA1, 0x88, 0x91, 0xC4, 0xF1, 0xCE, 0x07, 0x65, 0xF0, 
-0xA6, 0x1D, 0xA5, 0xD1, 0x09, 0x7A, 0xCA, 0x21, 0x36, 0x11, 0x80, 0xF2, 0x1B, 0x23, 0xDB, 0x9A, 
-0x1B, 0x52, 0x3E, 0xCB, 0xDE, 0x1A, 0x02, 0x91, 0x1F, 0x21, 0x41, 0xAE, 0xFE, 0xAA, 0x2C, 0xF8, 
-0xA7, 0x9B, 0xF1, 0x06, 0x91, 0xB4, 0x9A, 0x05, 0xA5, 0x3F, 0x30, 0xD0, 0xD6, 0x9E, 0x8E, 0xC4, 
-0x51, 0x57, 0x5A, 0xB6, 0x45, 0x6E, 0xD8, 0x5A, 0x50, 0xCF, 0x88, 0xC8, 0xAB, 0xCD, 0xE4, 0xF1, 
-0x99, 0xC2, 0xA9, 0xBF, 0xF3, 0x90, 0xA8, 0x2E, 0x66, 0xEE, 0x2D, 0x2C, 0x26, 0xBC, 0x29, 0x47, 
-0x9C, 0xCC, 0x30, 0x1E, 0xDF, 0x34, 0x06, 0x85, 0x6B, 0x03, 0x50, 0xF5, 0xD7, 0x43, 0x66, 0x19, 
-0x09, 0x2E, 0x89, 0xA9, 0xE8, 0xD1, 0x26, 0xCF, 0x81, 0xC6, 0xDF, 0xAE, 0x45, 0x29, 0x5D, 0x6A, 
-0x02, 0xFD, 0x64, 0x65, 0xE6, 0x34, 0x91, 0x25, 0xF4, 0xD0, 0x86, 0x3A, 0xA9, 0x8B, 0x61, 0x49, 
-0x25, 0x17, 0x5D, 0xFB, 0x3B, 0x94, 0xE8, 0x5D, 0xDF, 0x88, 0x05, 0x9C, 0xAA, 0x42, 0xEF, 0x7E, 
-0x5C, 0xFE, 0xD4, 0x61, 0xE5, 0x27, 0xA6, 0xF0, 0x26, 0x41, 0xB1, 0xA5, 0xC2, 0x22, 0xAE, 0x08, 
-0x9F, 0x6A, 0x6D, 0x96, 0xFA, 0x78, 0x22, 0xC3, 0xF5, 0x9B, 0xB0, 0xBE, 0xE9, 0x64, 0x85, 0x48, 
-0xE8, 0xA2, 0x29, 0xA4, 0xA6, 0x15, 0x28, 0x74, 0x24, 0xCD, 0x2D, 0x90, 0x1F, 0xB3, 0x90, 0xC8, 
-0x3F, 0xB4, 0x25, 0xB5, 0xFA, 0x9E, 0xF6, 0x1D, 0x2B, 0x96, 0xC5, 0xD6, 0xF4, 0xD0, 0x04, 0x51, 
-0xA2, 0x76, 0x29, 0xD5, 0x93, 0xE8, 0x5A, 0x4D, 0x15, 0x29, 0x8E, 0xC7, 0xB1, 0xCC, 0xCD, 0xD2, 
-0x4E, 0x17, 0x03, 0xDB, 0xDD, 0x5F, 0xDE, 0x83, 0x9E, 0x0F, 0xBF, 0xD2, 0x0F, 0xE9, 0xDA, 0x60, 
-0xD2, 0x5C, 0x59, 0x3A, 0xFD, 0x25, 0x4F, 0xCD, 0xAA, 0x67, 0x07, 0x19, 0x1D, 0x1E, 0x64, 0xD8, 
-0xAF, 0x5E, 0x12, 0xB9, 0x41, 0x8C, 0xB7, 0x31, 0x0D, 0xD9, 0x0A, 0xF6, 0xB7, 0x68, 0x02, 0xFA, 
-0xF8, 0x08, 0x39, 0x2E, 0xA6, 0x08, 0x88, 0xF1, 0xAE, 0x79, 0x6C, 0x15, 0x1D, 0x98, 0x08, 0x45, 
-0x1C, 0xF4, 0xEC, 0x8D, 0xC3, 0x24, 0x09, 0xA1, 0x46, 0xE9, 0xC0, 0x27, 0xCB, 0x13, 0xAE, 0x41, 
-0x6F, 0x76, 0x39, 0xFE, 0x8C, 0xB2, 0xC8, 0xCF, 0x21, 0x2C, 0x6C, 0x6F, 0xF2, 0x61, 0x0D, 0x0D, 
-0xA3, 0x9C, 0x39, 0x18, 0x19, 0xE9, 0x54, 0x7F, 0xF1, 0xA4, 0x40, 0x8D, 0x11, 0xD9, 0xE6, 0x79, 
-0xC6, 0x45, 0x16, 0x37, 0xA3, 0x67, 0xFA, 0xF3, 0x53, 0xE3, 0xA5, 0xC8, 0x0C, 0xB7, 0xD1, 0x6F, 
-0x99, 0x45, 0x2C, 0xBB, 0x81, 0x3E, 0xCD, 0x22, 0x46, 0x1B, 0x0E, 0xDE, 0x77, 0x57, 0x53, 0x89, 
-0xE2, 0x75, 0xB3, 0xD2, 0x74, 0x0D, 0x3C, 0xF1, 0x04, 0xAD, 0xBD, 0xB2, 0x50, 0x51, 0x61, 0xBA, 
-0xEF, 0x8B, 0x67, 0x53, 0xF1, 0xD0, 0xA6, 0x3C, 0x8C, 0xD8, 0xC7, 0x2F, 0xE9, 0x89, 0xB9, 0x42, 
-0x29, 0x34, 0x90, 0x66, 0xA5, 0x14, 0x6B, 0x69, 0x5A, 0xF8, 0x7D, 0x4D, 0xFB, 0x61, 0x40, 0x66, 
-0x42, 0x34, 0xC5, 0x90, 0xC5, 0x21, 0xA6, 0x84, 0x54, 0x38, 0x51, 0x8E, 0x1C, 0x40, 0x67, 0xEB, 
-0x6B, 0x61, 0x01, 0xEE, 0x96, 0x09, 0xCE, 0x34, 0x96, 0xD8, 0xDA, 0x24, 0x4F, 0x75, 0xBB, 0x96, 
-0xDC, 0xA7, 0x26, 0xB3, 0xE7, 0xCF, 0xFF, 0xE1, 0x6B, 0x20, 0x7E, 0x75, 0x13, 0x6B, 0x1D, 0xE6, 
-0x37, 0x98, 0xA2, 0x7C, 0xC2, 0xA4, 0x4C, 0xA1, 0xDF, 0xBC, 0x36, 0x35, 0xB6, 0xDE, 0x5C, 0x9A, 
-0x2F, 0x22, 0x4F, 0x13, 0x11, 0x9A, 0x6F, 0x4C, 0xD0, 0x5D, 0xCD, 0xCE, 0x83, 0x6E, 0xAD, 0x04, 
-0xE7, 0x21, 0x49, 0xDD, 0x5A, 0x12, 0x90, 0xEE, 0xC2, 0x39, 0x62, 0xF6, 0xFA, 0x1D, 0xB5, 0x24, 
-0x4E, 0x0A, 0x20, 0x3A, 0xFB, 0xEA, 0xF7, 0xC0, 0x87, 0x28, 0x42, 0x89, 0x89, 0x54, 0x64, 0x15, 
-0xBF, 0xBA, 0x3E, 0x5F, 0x99, 0xB8, 0x10, 0x32, 0x5B, 0x1D, 0x0D, 0xEE, 0xF7, 0x14, 0xB8, 0xE1, 
-0xD3, 0xEA, 0x0D, 0x9F, 0xDA, 0x85, 0xAB, 0x95, 0xFC, 0xD4, 0xA5, 0xA5, 0xC3, 0x09, 0x51, 0x5E, 
-0xBE, 0x88, 0xF3, 0xAC, 0xBC, 0x79, 0xE3, 0x3A, 0x1C, 0x5C, 0xE1, 0x25, 0x66, 0xB0, 0x49, 0x1D, 
-0x87, 0x3E, 0x7B, 0xDA, 0xF0, 0xCA, 0x72, 0x4A, 0xBD, 0xEA, 0xE1, 0xF9, 0xAD, 0x4A, 0xE2, 0x55, 
-0x43, 0x8E, 0xCA, 0x87, 0x65, 0x71, 0x7D, 0x10, 0x30, 0xDC, 0x45, 0x74, 0x90, 0xE8, 0x60, 0x4D, 
-0x5B, 0x87, 0x02, 0x11, 0x23, 0x8E, 0x29, 0xC8, 0x8D, 0xE9, 0x86, 0x0A, 0xA9, 0x6B, 0xB0, 0x85, 
-0x9E, 0xD8, 0x07, 0x5A, 0x87, 0x95, 0x17, 0x74, 0x82, 0xBB, 0xCC, 0xBB, 0xB2, 0x84, 0x12, 0x6A, 
-0x49, 0x0B, 0xFB, 0xA2, 0xF2, 0x59, 0x96, 0x1B, 0xF3, 0x06, 0x43, 0x69, 0xA7, 0x89, 0x55, 0x61, 
-0xE6, 0x3C, 0xE1, 0xE5, 0xCD, 0xBF, 0xD6, 0x5D, 0xD9, 0xAD, 0x16, 0x4D, 0x69, 0x58, 0xDE, 0x1A, 
-0x69, 0xDC, 0x6D, 0xB4, 0xC9, 0x7C, 0x68, 0x38, 0xB8, 0xE5, 0x2E, 0x5B, 0x46, 0xA6, 0x9B, 0x57, 
-0x14, 0xBE, 0x2F, 0xB5, 0xAA, 0x48, 0x40, 0x80, 0xA7, 0xA6, 0xE9, 0x6A, 0x48, 0x51, 0x00, 0x64, 
-0x49, 0xF1, 0x55, 0xE2, 0x90, 0x9E, 0x1A, 0xC1, 0x23, 0x26, 0x44, 0x71, 0x4C, 0x62, 0x29, 0xD3, 
-0x57, 0x12, 0xE5, 0xB7, 0x11, 0x2B, 0xE2, 0x55, 0xB8, 0x14, 0x87, 0x63, 0x9A, 0x9C, 0x04, 0x14, 
-0x57, 0x58, 0x61, 0xF0, 0x5B, 0x76, 0x65, 0x65, 0x76, 0xAF, 0xD5, 0x37, 0xAC, 0x9D, 0x7E, 0x16, 
-0xE9, 0x25, 0x2C, 0xDB, 0x44, 0x3E, 0x6E, 0xD1, 0x9D, 0xC2, 0xC0, 0xC5, 0xA3, 0x16, 0x4B, 0xB3, 
-0x03, 0x28, 0x03, 0x6E, 0xB1, 0x2F, 0x3E, 0xAA, 0xBD, 0xD8, 0x58, 0xB7, 0xB3, 0xC2, 0xF8, 0xF2, 
-0x00, 0xCA, 0x65, 0xD2, 0xE0, 0x0C, 0xA2, 0x18, 0xF1, 0xAD, 0xEB, 0x2B, 0x29, 0x40, 0xA9, 0x26, 
-0xE2, 0x50, 0x84, 0xE9, 0x51, 0x0A, 0x50, 0x78, 0x26, 0x33, 0x97, 0x0F, 0xF1, 0xF3, 0xA8, 0x09, 
-0x54, 0x7F, 0xDC, 0x04, 0xAA, 0x98, 0xF0, 0x26, 0x50, 0x73, 0x6C, 0x8A, 0xB1, 0x8A, 0x1B, 0x4D, 
-0x10, 0x75, 0xF0, 0x81, 0x72, 0x45, 0x41, 0x8B, 0x40, 0x2C, 0xE2, 0xAD, 0x15, 0x65, 0x9B, 0x4E, 
-0xA3, 0x59, 0xDB, 0x11, 0x73, 0x74, 0x58, 0x93, 0x0C, 0x58, 0x47, 0x7F, 0xC1, 0x6A, 0x31, 0xA6, 
-0x94, 0xF2, 0xF5, 0xF9, 0x5F, 0x1F, 0x8F, 0xDE, 0x52, 0xC7, 0x85, 0x17, 0x48, 0x58, 0xB2, 0x5B, 
-0xF0, 0x80, 0xFC, 0x4A, 0x20, 0x16, 0x73, 0xD8, 0x6A, 0x01, 0x6A, 0xB6, 0x2C, 0xD2, 0x57, 0x68, 
-0xCD, 0xC0, 0x29, 0x79, 0x0F, 0x0F, 0x72, 0x6A, 0x84, 0x2F, 0x9B, 0xD6, 0xFB, 0xA6, 0xCD, 0xBA, 
-0xF7, 0xA5, 0x66, 0xDD, 0x7B, 0x63, 0xB3, 0xF2, 0x55, 0xDE, 0xAC, 0x7B, 0xAF, 0x34, 0xEB, 0xDE, 
-0x37, 0x6F, 0x36, 0x4E, 0xF8, 0xB2, 0xD8, 0x2E, 0x3E, 0x31, 0x35, 0x9C, 0xBD, 0xCB, 0x5A, 0xC6, 
-0x27, 0x79, 0xD3, 0xF8, 0x4D, 0xB6, 0x2D, 0x5E, 0xB8, 0xC1, 0xBA, 0xD5, 0xA0, 0x17, 0xD2, 0x35, 
-0xF1, 0x07, 0xB1, 0x92, 0x04, 0x2C, 0xF9, 0xCC, 0xD4, 0x15, 0xF5, 0x75, 0xDA, 0x9B, 0xE2, 0x9B, 
-0x3A, 0x04, 0xE4, 0x94, 0x2A, 0x58, 0xB7, 0xCA, 0x5E, 0xE8, 0x49, 0x0B, 0x6F, 0xCA, 0x80, 0x25, 
-0x22, 0xA8, 0xD1, 0xC0, 0x6B, 0x9A, 0xA7, 0xB9, 0xCA, 0x16, 0x5C, 0x3E, 0x5A, 0xE2, 0x55, 0xE9, 
-0x14, 0x6C, 0xE0, 0xB3, 0x24, 0x3E, 0xFA, 0x28, 0x08, 0x62, 0xD3, 0x98, 0x9B, 0x59, 0xD6, 0xD3, 
-0x38, 0x0C, 0x7D, 0xEE, 0x06, 0xBF, 0xF5, 0x82, 0x2A, 0x6E, 0x79, 0x52, 0xC2, 0xAE, 0x4D, 0xEB, 
-0xD3, 0xB2, 0x32, 0x9F, 0xCA, 0xB4, 0x89, 0x39, 0x22, 0x57, 0xCC, 0x38, 0xBC, 0x37, 0xEE, 0x08, 
-0x45, 0xDA, 0x80, 0x61, 0x48, 0xE7, 0x4D, 0x7B, 0xD8, 0x6E, 0x57, 0x70, 0xDC, 0x7C, 0x52, 0x8B, 
-0x19, 0x5C, 0x22, 0x91, 0x17, 0x4B, 0x28, 0x0B, 0x0D, 0x47, 0x51, 0xDD, 0xD4, 0xA9, 0x67, 0xDB, 
-0x6C, 0xED, 0x7A, 0x81, 0xA7, 0x44, 0x17, 0xBF, 0xE1, 0xCE, 0xFD, 0xD7, 0x5B, 0xD4, 0x8D, 0xD7, 
-0x34, 0x1A, 0x4F, 0x0C, 0xB4, 0x62, 0x5A, 0xA7, 0x0D, 0x57, 0x61, 0x9D, 0x10, 0x67, 0x9C, 0xAB, 
-0xEA, 0x81, 0x3C, 0xE3, 0xC4, 0x69, 0x17, 0x56, 0xAA, 0xAB, 0xEE, 0xA9, 0x06, 0x57, 0x4C, 0x4E, 
-0x24, 0x0D, 0x4A, 0x58, 0x6A, 0xE8, 0x81, 0xCA, 0xE8, 0x4D, 0xA4, 0xF1, 0x88, 0x16, 0x5F, 0xBE, 
-0xEC, 0xCE, 0x44, 0x54, 0xBB, 0x72, 0xA1, 0x45, 0x8F, 0x9D, 0x87, 0xC2, 0x75, 0xC6, 0x29, 0x51, 
-0x6B, 0x8A, 0x82, 0xBE, 0x7E, 0x14, 0xD6, 0xAB, 0xBD, 0xF3, 0x3E, 0x8F, 0x57, 0x49, 0x12, 0x66, 
-0xB6, 0x88, 0x49, 0xE2, 0xF6, 0xC4, 0x93, 0x16, 0x93, 0x76, 0x85, 0x83, 0x56, 0xBC, 0x1A, 0x2F, 
-0x3C, 0xA1, 0x13, 0x77, 0x5A, 0x87, 0xAF, 0x8F, 0xDE, 0x9D, 0x1F, 0x7F, 0xCF, 0xAE, 0x8F, 0xAE, 
-0x7E, 0xFF, 0x72, 0x47, 0x94, 0xAD, 0xB4, 0x6D, 0xD7, 0x01, 0xC5, 0xBA, 0xCA, 0x4D, 0xFF, 0x75, 
-0x99, 0x74, 0x2A, 0x3A, 0xA2, 0x0C, 0x0E, 0xA1, 0x6A, 0x22, 0x7E, 0xEE, 0x25, 0x13, 0x57, 0x85, 
-0xC5, 0x77, 0x5E, 0x32, 0xB9, 0x79, 0x13, 0x8E, 0x3D, 0x9F, 0x83, 0x2E, 0x28, 0x94, 0xA9, 0x06, 
-0x57, 0x0D, 0xE2, 0xC9, 0xF3, 0x04, 0x73, 0x29, 0xA2, 0x95, 0x4E, 0x73, 0x3D, 0xA6, 0xDD, 0xB7, 
-0x43, 0x43, 0xB6, 0x7A, 0x66, 0xB2, 0x48, 0x85, 0x82, 0x77, 0xA6, 0x23, 0x92, 0x82, 0x64, 0xA9, 
-0x9A, 0x4B, 0x6F, 0x35, 0xF5, 0x0B, 0x9E, 0x9B, 0x72, 0xF5, 0xE2, 0xCB, 0x91, 0x3E, 0x95, 0x30, 
-0x10, 0x19, 0x4D, 0x87, 0x3B, 0x9D, 0x73, 0x9B, 0xB6, 0x9E, 0x95, 0xEC, 0x8D, 0xB1, 0x68, 0x5B, 
-0xD7, 0x9B, 0x22, 0x34, 0x83, 0xB3, 0x4E, 0x2D, 0xA2, 0x31, 0x2A, 0x44, 0x98, 0xE0, 0xB2, 0xAD, 
-0x77, 0x18, 0x16, 0xAA, 0x16, 0x2D, 0xBF, 0xED, 0x23, 0x74, 0xC6, 0xA0, 0x17, 0xFE, 0x28, 0x2D, 
-0xD6, 0xB6, 0x2F, 0x80, 0x87, 0xE9, 0xDB, 0x7F, 0x65, 0x33, 0x80, 0xD1, 0x3C, 0x81, 0x1B, 0xF6, 
-0x96, 0xFD, 0xE2, 0x31, 0xF0, 0xCF, 0x78, 0xEB, 0x7E, 0xFD, 0xC5, 0x8C, 0x46, 0x98, 0xDE, 0x07, 
-0x00, 0x61, 0xE9, 0xD7, 0x94, 0x2D, 0xC4, 0xA1, 0x00, 0x23, 0x43, 0x5C, 0x26, 0x26, 0x91, 0xF2, 
-0x3D, 0xB7, 0x72, 0x43, 0x2F, 0xAD, 0x5C, 0x84, 0x43, 0x97, 0x19, 0x1D, 0x94, 0x56, 0xB2, 0xCD, 
-0xAB, 0xA9, 0xB2, 0xB5, 0xEA, 0xC9, 0x69, 0xE6, 0x7C, 0xA6, 0x2E, 0x7A, 0xC5, 0x48, 0xA7, 0x5B, 
-0x57, 0x48, 0x3E, 0xB5, 0xB6, 0xAF, 0x32, 0xDF, 0xD3, 0xAE, 0xD0, 0xA5, 0xBB, 0x26, 0x73, 0xE6, 
-0x01, 0xFB, 0x48, 0x96, 0x8D, 0x61, 0x81, 0xF7, 0x28, 0xB1, 0x13, 0x9B, 0x4A, 0xFA, 0x80, 0x4A, 
-0x64, 0xD6, 0x42, 0x33, 0x79, 0xD2, 0x9A, 0x90, 0xCF, 0x1C, 0xA7, 0xA8, 0x7F, 0xD9, 0x6C, 0x5F, 
-0x80, 0xFF, 0x91, 0xFB, 0xB4, 0x01, 0xA3, 0xFF, 0x8A, 0xCB, 0x8B, 0xBE, 0x3A, 0xA3, 0x46, 0xF0, 
-0xE5, 0xE5, 0x07, 0x25, 0xF0, 0xDA, 0x34, 0x53, 0x0E, 0x5E, 0xDD, 0x91, 0x89, 0xC5, 0xA9, 0xD0, 
-0x08, 0x72, 0xB1, 0xB5, 0x33, 0x79, 0x9C, 0x8F, 0x21, 0x7E, 0xBC, 0x08, 0x36, 0xD3, 0x5E, 0xCD, 
-0x40, 0xE1, 0x49, 0xCC, 0x5F, 0xC1, 0xCB, 0xC4, 0x31, 0x0D, 0x36, 0x03, 0x5F, 0x8F, 0xA7, 0x46, 
-0x39, 0x1D, 0xDE, 0x9D, 0xB1, 0x6B, 0x74, 0x16, 0x79, 0x16, 0x6B, 0xED, 0x5F, 0x8F, 0x4F, 0xFD, 
-0x76, 0xCC, 0xA5, 0xE1, 0x2D, 0x5B, 0x25, 0xE6, 0xDF, 0x3A, 0xA1, 0x8D, 0x12, 0xB9, 0x3F, 0xD9, 
-0xE1, 0x93, 0x30, 0x3D, 0xB3, 0xDB, 0xEF, 0xF7, 0x5B, 0x4D, 0xDB, 0x12, 0xBB, 0x2D, 0x6D, 0x71, 
-0xE9, 0x1D, 0x10, 0xE5, 0x76, 0x7E, 0x90, 0x7B, 0x0C, 0x46, 0x87, 0x51, 0xF2, 0x2F, 0x0D, 0xFC, 
-0xFF, 0xDA, 0x58, 0x4D, 0x23, 0x45, 0x5B, 0xBF, 0x88, 0x1F, 0x14, 0x61, 0x16, 0xCD, 0x68, 0xA3, 
-0xBA, 0x2D, 0x60, 0xA8, 0x66, 0xA7, 0x69, 0x5C, 0x9F, 0x3D, 0xDE, 0x43, 0x92, 0xC9, 0x8E, 0x98, 
-0xFB, 0xFF, 0xAC, 0xB1, 0x56, 0x92, 0xC9, 0x74, 0x1A, 0x46, 0x56, 0xD1, 0x66, 0x95, 0x66, 0x87, 
-0x4B, 0x6E, 0xA2, 0xF0, 0x8E, 0x52, 0x19, 0x9D, 0x8A, 0x7B, 0x5D, 0xC4, 0x5A, 0x91, 0xB9, 0xB4, 
-0xB4, 0xD9, 0xA9, 0x4B, 0xA2, 0xAB, 0xBA, 0xDF, 0x68, 0x4A, 0xE3, 0xA5, 0x1B, 0xF2, 0xDC, 0x7E, 
-0x46, 0x21, 0xCE, 0x83, 0x22, 0xB8, 0xA8, 0x83, 0x32, 0x76, 0xAB, 0xBF, 0xE0, 0x71, 0xEC, 0xCE, 
-0xB9, 0xE9, 0x9A, 0xDF, 0x1A, 0x41, 0x21, 0x8F, 0x4D, 0x29, 0xCA, 0xF1, 0xDB, 0x66, 0x55, 0xA9, 
-0x36, 0x25, 0x12, 0x99, 0x55, 0x86, 0xB1, 0xAD, 0x78, 0x94, 0x98, 0x02, 0x28, 0x8A, 0xAE, 0xAE, 
-0x24, 0x9C, 0xCF, 0x7D, 0x8E, 0x5E, 0xEE, 0x18, 0x23, 0x71, 0xA6, 0x40, 0xA1, 0xB2, 0x03, 0xB6, 
-0xEB, 0x27, 0x6C, 0xE1, 0x89, 0xFA, 0xE9, 0xD2, 0xC9, 0x3B, 0x9F, 0xA2, 0x9B, 0x54, 0xA2, 0xCE, 
-0xD4, 0x1B, 0x68, 0x64, 0xC2, 0x49, 0x53, 0xBE, 0xC9, 0xDA, 0x5C, 0x92, 0x0F, 0xB8, 0xDD, 0x5C, 
-0x31, 0x7C, 0x18, 0x6F, 0x38, 0x37, 0xD7, 0x51, 0x2F, 0x3F, 0xAE, 0xBB, 0x0F, 0xD9, 0x7A, 0xC6, 
-0x43, 0xA6, 0x60, 0x34, 0xDE, 0xBD, 0xC5, 0xBE, 0x61, 0xCA, 0x2D, 0x5D, 0x43, 0x73, 0xAC, 0x50, 
-0x76, 0xAB, 0x2F, 0x2A, 0xFC, 0xB4, 0x4A, 0xD3, 0xB3, 0x55, 0xF8, 0xE0, 0x5F, 0x68, 0x17, 0xFC, 
-0xA6, 0xFA, 0x0C, 0x3D, 0xD0, 0xC3, 0x6A, 0x78, 0x5F, 0x15, 0xB2, 0x38, 0x6A, 0x97, 0xA6, 0x8C, 
-0x14, 0x5B, 0xDD, 0xCC, 0xC3, 0x73, 0x1A, 0x22, 0xCB, 0x6A, 0x96, 0xC3, 0x98, 0x4E, 0x78, 0xA8, 
-0x79, 0x29, 0x14, 0xC4, 0xD8, 0x91, 0x9A, 0x84, 0x89, 0xEB, 0x5F, 0x08, 0x28, 0x07, 0x6A, 0x83, 
-0xA9, 0x7F, 0xEF, 0x2B, 0xB6, 0x2B, 0xF2, 0xF7, 0x04, 0x00, 0x73, 0xCA, 0xD1, 0x15, 0x3F, 0xD3, 
-0x03, 0xA4, 0x68, 0x4B, 0x24, 0x66, 0x3A, 0xD0, 0x3D, 0x30, 0x8E, 0x4D, 0xDE, 0xF5, 0x9B, 0xE2, 
-0x0C, 0x7A, 0xAB, 0xB2, 0xBA, 0x4E, 0x06, 0xE3, 0xAB, 0x03, 0x63, 0x22, 0x02, 0xB5, 0x9F, 0x75, 
-0x79, 0x67, 0xD5, 0x66, 0x97, 0xC5, 0xB9, 0x21, 0xB4, 0x95, 0x67, 0xE6, 0x41, 0x1D, 0xB2, 0x24, 
-0xC2, 0x54, 0xAF, 0x98, 0x90, 0xB1, 0x4E, 0xEF, 0xBF, 0xF8, 0x28, 0x61, 0x6E, 0x76, 0xBE, 0xF8, 
-0xA8, 0x4C, 0xC1, 0x46, 0x66, 0xFA, 0x93, 0x6F, 0x4D, 0x06, 0xB4, 0x4F, 0x10, 0x9E, 0xF2, 0x7E, 
-0xD4, 0x1C, 0x44, 0x7A, 0x2C, 0xC1, 0x69, 0x4B, 0x01, 0xAA, 0x91, 0x34, 0xF4, 0xFE, 0x48, 0xCE, 
-0x88, 0x11, 0x8F, 0x36, 0xC3, 0xB2, 0x51, 0x46, 0x4B, 0xD9, 0xBC, 0x90, 0xD1, 0xBA, 0x39, 0x31, 
-0x63, 0xB4, 0x88, 0xB2, 0x4E, 0xD0, 0x11, 0xAE, 0x7C, 0x45, 0x0F, 0xF8, 0x68, 0xCB, 0x2B, 0xEE, 
-0x32, 0x6C, 0x34, 0x03, 0x6F, 0xC3, 0xD4, 0xA7, 0x4A, 0xED, 0x69, 0xB6, 0x1F, 0xD9, 0x9D, 0x3E, 
-0xA3, 0xCB, 0x4D, 0x28, 0xC1, 0x31, 0x4A, 0x89, 0x7D, 0xDB, 0x9D, 0x1E, 0x9F, 0x20, 0x64, 0x66, 
-0x21, 0x13, 0x46, 0x0B, 0xF9, 0x16, 0x1B, 0x9D, 0xC5, 0xB2, 0xDC, 0x20, 0x6F, 0xEA, 0xA7, 0xE8, 
-0x22, 0xD9, 0xEE, 0xCD, 0x48, 0x03, 0x96, 0x02, 0x5D, 0xBF, 0xF5, 0x37, 0xB5, 0xBA, 0xB6, 0x51, 
-0x53, 0x1A, 0xAA, 0x2B, 0x19, 0x5A, 0x48, 0x9C, 0xDC, 0xEE, 0x5A, 0xD9, 0xC2, 0xD7, 0x2E, 0xDB, 
-0xDD, 0x2F, 0xDE, 0x8E, 0x67, 0x3F, 0xF6, 0x01, 0x34, 0x27, 0x29, 0x5A, 0x6F, 0x43, 0xFA, 0x24, 
-0x05, 0x85, 0xC0, 0xA3, 0x7E, 0x52, 0x52, 0x45, 0x1E, 0xA2, 0x01, 0x88, 0xB3, 0x2E, 0x36, 0x05, 
-0xE0, 0x71, 0x35, 0xB8, 0xC7, 0xE0, 0x15, 0x74, 0x2E, 0x43, 0x5C, 0x90, 0xA0, 0xA3, 0x70, 0xEA, 
-0x54, 0xE6, 0x1A, 0xA1, 0xC5, 0xEA, 0x6C, 0x35, 0xB2, 0x3A, 0xAB, 0x85, 0x91, 0x69, 0xA0, 0x3C, 
-0xFD, 0x96, 0x0C, 0xED, 0x26, 0xA5, 0x87, 0x7D, 0xBA, 0xD6, 0xB3, 0x69, 0x2E, 0xDB, 0xA7, 0x7D, 
-0xD1, 0x49, 0xF4, 0x0F, 0xF7, 0x16, 0x94, 0x4F, 0x88, 0xFC, 0x16, 0xE2, 0xBC, 0x68, 0xD3, 0xCA, 
-0x78, 0x32, 0x1A, 0x37, 0x9F, 0x41, 0xF8, 0x24, 0xC1, 0xFF, 0x56, 0xD8, 0x90, 0x8D, 0x54, 0x23, 
-0xBA, 0xD8, 0xC3, 0x62, 0xC6, 0x7E, 0xE2, 0xCB, 0x12, 0x35, 0x97, 0xD4, 0x7B, 0xEC, 0x59, 0x97, 
-0xA4, 0xF2, 0x2E, 0xDB, 0xD3, 0x26, 0x1C, 0xA9, 0xDF, 0x49, 0x1E, 0xAF, 0xBF, 0x88, 0x57, 0x2C, 
-0xD0, 0xD1, 0xF5, 0xBC, 0x55, 0x0A, 0xB2, 0x15, 0x00, 0xB5, 0x9B, 0x4E, 0x95, 0x9D, 0x96, 0x2F, 
-0x1B, 0xD5, 0x46, 0xDE, 0x96, 0x48, 0x9A, 0xF2, 0xFA, 0xEB, 0xF9, 0xA9, 0x91, 0xB2, 0x52, 0xE5, 
-0x08, 0xB7, 0xD0, 0xB7, 0x7F, 0xD3, 0x86, 0x9F, 0xD4, 0xE4, 0xDF, 0x8A, 0xE9, 0x44, 0xDA, 0x8E, 
-0x87, 0x67, 0xEC, 0x8A, 0x36, 0xFF, 0xAD, 0x8C, 0x42, 0x19, 0x4E, 0xAC, 0xA6, 0x21, 0x6C, 0xC5, 
-0xB6, 0x3D, 0x28, 0xE7, 0x85, 0xDF, 0x3E, 0xFE, 0xB6, 0x95, 0xC2, 0xB5, 0xED, 0x5D, 0x75, 0x3D, 
-0xAC, 0x33, 0xFB, 0xA8, 0xB7, 0x48, 0x4B, 0x36, 0x4C, 0xF7, 0x51, 0x48, 0x98, 0xD9, 0xF9, 0xC1, 
-0x06, 0x06, 0x22, 0xDD, 0xC6, 0x53, 0xD9, 0xF9, 0x4B, 0xA7, 0xF8, 0x4E, 0xDC, 0x84, 0xF7, 0x83, 
-0xF0, 0xCE, 0xD1, 0xC4, 0x3B, 0xAB, 0x67, 0x02, 0xCB, 0x2C, 0xBA, 0xF0, 0x6E, 0x54, 0x6D, 0xC3, 
-0x60, 0x6F, 0x31, 0xB2, 0xE6, 0x34, 0x2D, 0xDF, 0x6C, 0x96, 0xE6, 0x41, 0x9B, 0xF9, 0x21, 0x60, 
-0xD9, 0xC9, 0x3B, 0xC8, 0x7A, 0xC5, 0xDE, 0x77, 0xD8, 0x8E, 0x70, 0xAD, 0x9B, 0x6F, 0xEE, 0x2C, 
-0xC2, 0x22, 0xE8, 0x3B, 0xEC, 0xE9, 0x73, 0xA8, 0x03, 0x7A, 0xCE, 0x15, 0xD1, 0xB6, 0xD3, 0xE9, 
-0x2F, 0xDD, 0x29, 0x01, 0x75, 0xF6, 0xBA, 0xED, 0x41, 0xDB, 0x0C, 0x6E, 0x51, 0xEA, 0x1A, 0xC1, 
-0xFB, 0x9D, 0x80, 0x07, 0x70, 0x9F, 0x3F, 0x0C, 0x6A, 0x2C, 0xB2, 0x08, 0x12, 0xA8, 0x07, 0x82, 
-0x28, 0xDE, 0x6D, 0x6F, 0x16, 0x6B, 0x12, 0x9C, 0x94, 0xB6, 0x21, 0x8D, 0x1C, 0xF7, 0x3B, 0xE8, 
-0x28, 0x52, 0xAF, 0x8A, 0x06, 0x15, 0xFD, 0x66, 0x33, 0xFC, 0xE2, 0xE3, 0x02, 0x7F, 0xC5, 0x15, 
-0x7D, 0x12, 0xC5, 0xD2, 0x81, 0x45, 0x2C, 0x2D, 0x9C, 0x43, 0xAE, 0x23, 0xCC, 0x4F, 0xA0, 0xB7, 
-0xC7, 0x40, 0x82, 0x1E, 0x01, 0xAD, 0xC1, 0x60, 0x48, 0xFF, 0xB5, 0x6A, 0x6E, 0x44, 0xA0, 0x64, 
-0x1B, 0xEC, 0x5B, 0x8F, 0xD2, 0x64, 0x30, 0xE7, 0xF8, 0xEA, 0x92, 0x5D, 0xB9, 0x33, 0x20, 0xD1, 
-0x42, 0x36, 0x84, 0x0C, 0x21, 0x63, 0x28, 0x48, 0x55, 0xE2, 0x2A, 0x22, 0x72, 0xAC, 0x01, 0x00, 
-0x84, 0xE8, 0xE0, 0x6D, 0x01, 0x37, 0x6E, 0x00, 0x8C, 0x26, 0xB2, 0xE4, 0xAE, 0xB0, 0x8E, 0x5F, 
-0x7F, 0xD0, 0x46, 0x0E, 0xDA, 0xB0, 0xDF, 0x00, 0x2E, 0xF2, 0xF3, 0x3B, 0xB2, 0xFD, 0x91, 0xB1, 
-0x68, 0x29, 0xB3, 0x44, 0x96, 0x51, 0x82, 0xEC, 0x66, 0xA7, 0x41, 0xBC, 0x8A, 0x38, 0xEC, 0xE2, 
-0x31, 0xA6, 0x8A, 0x98, 0xAC, 0x78, 0x93, 0x0C, 0x16, 0xD5, 0xFB, 0xAA, 0x29, 0x76, 0x86, 0x5D, 
-0xBB, 0xE3, 0xD2, 0x31, 0xAF, 0x0C, 0x53, 0xED, 0x45, 0x38, 0xA6, 0x73, 0x1C, 0x3C, 0xB8, 0xC5, 
-0x3C, 0x27, 0xE2, 0xD0, 0x51, 0x39, 0xF0, 0x06, 0x5F, 0x56, 0x5D, 0xFE, 0x15, 0x18, 0x93, 0x24, 
-0xF2, 0xCD, 0x40, 0xE8, 0x6D, 0x03, 0x28, 0x14, 0xE5, 0x63, 0x84, 0x22, 0x62, 0x80, 0xF4, 0xE7, 
-0x46, 0x56, 0x63, 0x50, 0x6D, 0xCC, 0x43, 0x25, 0x05, 0x88, 0xCA, 0xC4, 0x1F, 0xE2, 0x52, 0x0B, 
-0xF2, 0x32, 0x23, 0xC0, 0x94, 0xF0, 0xEF, 0xC7, 0xB6, 0x9E, 0xA6, 0x80, 0xC4, 0xDD, 0x8F, 0x16, 
-0x48, 0xB2, 0x40, 0x0D, 0x28, 0x3C, 0x3C, 0x9D, 0xC0, 0xDE, 0x55, 0x02, 0xF4, 0x3A, 0x9C, 0xBF, 
-0x09, 0xA7, 0x1C, 0xFB, 0xE3, 0xF9, 0x4D, 0x60, 0xA0, 0x24, 0x63, 0x82, 0x41, 0xEF, 0xF4, 0x68, 
-0x3B, 0x12, 0x17, 0x51, 0x59, 0x07, 0x9B, 0x65, 0x0F, 0x69, 0x77, 0xCB, 0x29, 0x49, 0x6A, 0xD0, 
-0x94, 0xE6, 0x0A, 0x69, 0x77, 0x4B, 0xC9, 0x15, 0xEC, 0xF5, 0xC4, 0xAD, 0x27, 0x3D, 0x6F, 0x0A, 
-0xEB, 0xD1, 0x4B, 0xC8, 0xAC, 0x86, 0xB9, 0x53, 0xCE, 0xE4, 0x77, 0x73, 0x65, 0x90, 0x00, 0x7A, 
-0xC8, 0x54, 0x40, 0x48, 0x08, 0xA3, 0x36, 0xE5, 0xA1, 0x98, 0x79, 0x73, 0x58, 0x4B, 0xAF, 0x85, 
-0xDF, 0xA5, 0x32, 0xFC, 0x73, 0x7E, 0x37, 0x64, 0xAF, 0x51, 0x1E, 0x4E, 0x0F, 0x87, 0x03, 0x27, 
-0xF1, 0x82, 0xF2, 0xD5, 0xA5, 0x95, 0x63, 0xF3, 0xDA, 0xEC, 0x58, 0xD2, 0x28, 0x76, 0x8D, 0x77, 
-0x04, 0x9D, 0x70, 0x9F, 0xCF, 0xDD, 0x6A, 0x4C, 0x80, 0xB4, 0xA0, 0x8B, 0x6B, 0x84, 0x1E, 0x76, 
-0x39, 0x3D, 0xB2, 0x7E, 0x78, 0xAE, 0x3F, 0x41, 0x03, 0x2F, 0xD4, 0x63, 0x84, 0xBC, 0x63, 0xB1, 
-0x70, 0xA7, 0x4A, 0x1C, 0xC6, 0x3D, 0x9C, 0xFA, 0x94, 0x53, 0x48, 0x64, 0x6D, 0xEC, 0x4F, 0xFC, 
-0x30, 0xE6, 0x71, 0xE2, 0xB4, 0x7F, 0xD4, 0x5D, 0x5E, 0xF9, 0x93, 0x55, 0x03, 0x49, 0xE1, 0x59, 
-0x8D, 0x49, 0xBC, 0x8F, 0xF4, 0x70, 0x19, 0x85, 0x4B, 0x77, 0x9E, 0xA7, 0x5E, 0x33, 0x47, 0x03, 
-0x93, 0x60, 0x89, 0x70, 0x1D, 0x7B, 0x0C, 0x71, 0xDA, 0x38, 0xA5, 0xE3, 0x02, 0x49, 0xAA, 0x2F, 
-0x2E, 0xD3, 0xEC, 0x6E, 0x59, 0xCB, 0x5B, 0x6E, 0x5B, 0x03, 0x8F, 0x4B, 0x89, 0x5B, 0x33, 0xB7, 
-0xAD, 0x59, 0xBC, 0x73, 0xD3, 0x5C, 0xD9, 0x7E, 0xDD, 0x97, 0x45, 0x89, 0xDE, 0xD4, 0x38, 0x8C, 
-0x96, 0x3C, 0x68, 0x34, 0xFB, 0xF9, 0xFD, 0xB3, 0x76, 0x02, 0x90, 0x00, 0xBF, 0xFC, 0x52, 0x82, 
-0xCE, 0x46, 0x8A, 0x49, 0xC3, 0xAC, 0x54, 0x61, 0x48, 0x15, 0xA6, 0x01, 0xB3, 0x85, 0x6D, 0x70, 
-0xCB, 0xF3, 0xA3, 0x78, 0x25, 0xC0, 0x2A, 0x48, 0x65, 0x13, 0x85, 0x31, 0xAA, 0x42, 0x88, 0x2E, 
-0xBD, 0xD3, 0x99, 0x30, 0xBD, 0x13, 0x99, 0xA2, 0x54, 0xA3, 0xB9, 0xE0, 0xA9, 0xA8, 0x7B, 0x48, 
-0x82, 0x96, 0x14, 0xCA, 0x3C, 0xCC, 0x9B, 0x23, 0x6E, 0x57, 0xC2, 0x5B, 0x9F, 0x41, 0x86, 0x49, 
-0x2F, 0xC9, 0xD2, 0x9F, 0x5B, 0xC5, 0x7A, 0xA7, 0x36, 0x21, 0x46, 0xDE, 0x23, 0xAB, 0x49, 0xC7, 
-0x21, 0xAA, 0xD6, 0x04, 0xC2, 0x61, 0xD3, 0x47, 0x11, 0x77, 0xE5, 0x45, 0x49, 0x30, 0x01, 0x05, 
-0x07, 0xB9, 0xD3, 0xEE, 0x97, 0x2E, 0xEC, 0xD5, 0x66, 0xFE, 0x48, 0xA1, 0x34, 0x4A, 0xFC, 0x81, 
-0xFB, 0xD1, 0x6D, 0xE8, 0x4D, 0x61, 0x48, 0xAB, 0xB1, 0xCF, 0x7B, 0xD5, 0x3B, 0xA4, 0x31, 0x2D, 
-0xB0, 0x84, 0x58, 0xEE, 0x8E, 0x0C, 0x57, 0x33, 0x8E, 0x0A, 0x65, 0x04, 0xF7, 0x96, 0xD3, 0x55, 
-0x3F, 0x13, 0xA1, 0xEB, 0xEB, 0x86, 0x0D, 0xAF, 0xBF, 0x17, 0x67, 0x2C, 0xB3, 0x86, 0xB2, 0xA0, 
-0x66, 0x03, 0xA6, 0xE4, 0x11, 0x45, 0xE3, 0x41, 0x77, 0xD9, 0xB3, 0x32, 0x76, 0x94, 0xC3, 0x24, 
-0xAC, 0x4D, 0xB6, 0x53, 0x6D, 0x09, 0x71, 0xC2, 0xED, 0x40, 0xA5, 0x0D, 0x6D, 0xB9, 0xA5, 0x92, 
-0x03, 0xEB, 0x80, 0x19, 0xEE, 0xD6, 0x11, 0x45, 0x0B, 0xA7, 0xEA, 0x05, 0x43, 0x12, 0x61, 0xFC, 
-0xED, 0xBA, 0xE9, 0x51, 0x12, 0x61, 0xEA, 0x00, 0x87, 0xC1, 0x07, 0xBE, 0x9E, 0xE2, 0xCD, 0xEE, 
-0xB6, 0xBD, 0x07, 0xE5, 0x68, 0x4C, 0x57, 0x21, 0xC2, 0xFA, 0x4E, 0x49, 0xEE, 0x35, 0xF3, 0x05, 
-0x79, 0x50, 0x41, 0x86, 0x51, 0xA4, 0xF9, 0xDE, 0x98, 0xB5, 0xB4, 0xCE, 0x39, 0xA1, 0x8C, 0x52, 
-0xDC, 0x32, 0x79, 0x84, 0x17, 0x73, 0x92, 0xE5, 0x95, 0xC2, 0xCF, 0x42, 0xB4, 0x3D, 0xC0, 0xFC, 
-0x19, 0x00, 0xC7, 0x40, 0x3B, 0x98, 0x0F, 0x0F, 0xD1, 0xE6, 0xE0, 0x5A, 0x55, 0x66, 0xA7, 0x41, 
-0xAA, 0x61, 0xCD, 0xB8, 0xE9, 0xE2, 0x65, 0xF3, 0xC0, 0xAB, 0xE4, 0x27, 0xEE, 0xE9, 0xFA, 0xBE, 
-0x1A, 0x56, 0x6F, 0x68, 0x4F, 0xB7, 0xC9, 0xE2, 0xC0, 0xD3, 0x0B, 0x75, 0x49, 0x0A, 0x21, 0x51, 
-0xA1, 0xC4, 0x22, 0x47, 0xFA, 0xB9, 0x2D, 0x49, 0x15, 0xF5, 0x7B, 0x78, 0x29, 0xAD, 0x9E, 0x6E, 
-0x40, 0x95, 0x63, 0x27, 0x59, 0x29, 0x35, 0x89, 0x01, 0xF5, 0x40, 0xBF, 0x80, 0x66, 0xB0, 0xE8, 
-0x62, 0xA7, 0xB1, 0xAF, 0xA7, 0x3C, 0x8B, 0x01, 0xBF, 0xC3, 0x15, 0xD5, 0xD4, 0xE5, 0x83, 0x62, 
-0x5E, 0x14, 0xC6, 0x71, 0xEF, 0x22, 0xF2, 0x30, 0x95, 0xCA, 0x5B, 0x91, 0xA2, 0x16, 0xA9, 0x27, 
-0xB9, 0xE1, 0xF2, 0xD6, 0x28, 0xC3, 0x75, 0x94, 0x74, 0xD9, 0x0C, 0x1D, 0xF4, 0x88, 0xCB, 0x85, 
-0xC9, 0x73, 0xBA, 0x5A, 0xA2, 0x45, 0x56, 0xDC, 0xBA, 0x28, 0xED, 0x92, 0x78, 0x21, 0x10, 0x4A, 
-0xB0, 0xFD, 0xC9, 0x72, 0xB9, 0xF3, 0x03, 0x1F, 0x5F, 0xE1, 0xA5, 0x7A, 0x11, 0x7E, 0x63, 0xBE, 
-0xF7, 0x81, 0xFB, 0x6B, 0xA9, 0x68, 0xC6, 0xE2, 0x72, 0x4C, 0x91, 0xC3, 0x00, 0x9E, 0xE2, 0x55, 
-0x7C, 0xDE, 0xC2, 0x4B, 0xB8, 0x2E, 0xF2, 0x2C, 0x4D, 0x7B, 0x80, 0xAD, 0xBF, 0x8B, 0xFC, 0x42, 
-0xCA, 0xD0, 0xF4, 0x7E, 0x54, 0x21, 0x38, 0x6B, 0x73, 0x87, 0x36, 0xF7, 0x83, 0x65, 0x4D, 0x3C, 
-0x96, 0x8D, 0x96, 0xD5, 0x1B, 0x69, 0xD9, 0x96, 0x56, 0x5A, 0xE5, 0x98, 0xFB, 0x30, 0x25, 0x86, 
-0x2D, 0x52, 0xA1, 0x69, 0x17, 0xB9, 0xD9, 0x7F, 0x87, 0xA4, 0x07, 0x88, 0xFA, 0x59, 0x5C, 0x04, 
-0x29, 0xD4, 0x9C, 0x56, 0xE3, 0x2C, 0xDE, 0x6F, 0xF9, 0x0C, 0x20, 0xDF, 0x68, 0x2E, 0x35, 0x4C, 
-0x63, 0xEB, 0xE4, 0x9D, 0xB4, 0x84, 0x7E, 0x91, 0xEA, 0xBB, 0xCB, 0xF6, 0x07, 0x0D, 0xEE, 0xE8, 
-0x6B, 0x14, 0xE5, 0x97, 0x7B, 0x10, 0xE4, 0x3D, 0xDD, 0xE2, 0x96, 0x59, 0xA2, 0xE0, 0x92, 0x1B, 
-0x4C, 0xA4, 0x49, 0x74, 0xA4, 0x21, 0x43, 0x06, 0xA8, 0xC0, 0xA7, 0x50, 0x5E, 0xCC, 0x23, 0xEF, 
-0xEB, 0xD1, 0x24, 0x8C, 0x33, 0x1B, 0x8E, 0x4E, 0x56, 0x8B, 0xC5, 0x9A, 0xFD, 0xC1, 0xFB, 0x55, 
-0x23, 0x50, 0x61, 0x7A, 0xDF, 0x4B, 0x17, 0xB3, 0xF3, 0xE8, 0xB2, 0x64, 0x96, 0x53, 0x67, 0x47, 
-0xF3, 0xB1, 0xEB, 0x0C, 0xBA, 0xF4, 0xD3, 0xDF, 0xED, 0x94, 0x59, 0x50, 0x5A, 0x5E, 0xDE, 0x05, 
-0x30, 0xE8, 0x4E, 0x94, 0x2B, 0xCE, 0x40, 0x48, 0x53, 0xEF, 0x30, 0xB3, 0xB3, 0xBC, 0x89, 0x31, 
-0x77, 0xBA, 0xF6, 0xA2, 0x34, 0xDC, 0xE5, 0x6B, 0x2F, 0x48, 0xBB, 0xCB, 0x4B, 0xE9, 0xEE, 0x5C, 
-0xD3, 0x27, 0xAC, 0x9F, 0x47, 0xDE, 0xB4, 0xDA, 0xB5, 0xCA, 0x05, 0x05, 0x7B, 0x7B, 0x3A, 0x5C, 
-0xD8, 0xAE, 0x26, 0x98, 0x58, 0x53, 0xD9, 0xCF, 0x80, 0xE8, 0x31, 0xC4, 0xEB, 0xFE, 0x60, 0x30, 
-0x62, 0xF7, 0x2F, 0xEF, 0xE0, 0xD7, 0x57, 0x07, 0xFB, 0x74, 0x95, 0xC3, 0x24, 0xCF, 0xEF, 0x7F, 
-0xDF, 0xC5, 0x7B, 0x9F, 0x27, 0x79, 0x0A, 0xFF, 0xFB, 0xEE, 0x4D, 0xA7, 0x72, 0x9B, 0xC3, 0xC4, 
-0x96, 0x3F, 0x3D, 0x6D, 0xC8, 0xC3, 0x86, 0x3C, 0x6C, 0xC8, 0xFB, 0xEA, 0xC0, 0x70, 0xC3, 0x47, 
-0x2A, 0x3E, 0x7B, 0x31, 0x4F, 0x2D, 0xD4, 0xE9, 0xA5, 0x96, 0xEC, 0x09, 0x73, 0x6E, 0xE8, 0x66, 
-0x9A, 0x17, 0x5A, 0xF3, 0xB1, 0x4A, 0x18, 0x1E, 0x48, 0xE8, 0x98, 0xCB, 0x16, 0xE1, 0x50, 0x6E, 
-0x7E, 0xFA, 0x54, 0x73, 0xD1, 0xBD, 0x3E, 0xA5, 0xB9, 0x42, 0xBD, 0x06, 0x2F, 0x5B, 0x81, 0xBE, 
-0xCB, 0xDA, 0xC7, 0x59, 0x00, 0x2C, 0xF7, 0xDA, 0x1D, 0xE7, 0x0F, 0xF5, 0x36, 0x3C, 0x09, 0xFA, 
-0xE5, 0x8E, 0x60, 0x79, 0x87, 0x7F, 0xFF, 0x77, 0xFF, 0x1F, 0xBE, 0xBE, 0x69, 0x53, 0x85, 0x1C, 
-0x01, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x33, 0xC1, 0xD2, 0x6A, 0x02, 0xFF, 0xED, 0x7D, 0xED, 0x72, 0xDB, 0x48, 
+0x92, 0xE0, 0x7F, 0x3D, 0x45, 0x35, 0xBB, 0xA7, 0x09, 0xBA, 0x49, 0x8A, 0x92, 0x2D, 0xAF, 0x9B, 
+0xB2, 0xD4, 0xAB, 0x96, 0xE4, 0x6E, 0xDD, 0xD8, 0x96, 0xCF, 0x92, 0xA7, 0x77, 0xA2, 0xB7, 0x63, 
+0x0D, 0x92, 0x45, 0x0A, 0x6D, 0x10, 0x40, 0x03, 0xA0, 0x24, 0x8E, 0x87, 0x3F, 0xEE, 0x09, 0x36, 
+0xEE, 0xEF, 0xC5, 0x46, 0x5C, 0xDC, 0xBF, 0x7B, 0x84, 0x7D, 0x9E, 0x7D, 0x81, 0xBD, 0x47, 0xB8, 
+0xCC, 0xAC, 0x02, 0x50, 0x05, 0x54, 0x01, 0xA0, 0xEC, 0x99, 0xB9, 0x89, 0xB8, 0xF6, 0x8C, 0x2D, 
+0x01, 0x85, 0xAC, 0xAA, 0xAC, 0xAC, 0xFC, 0xAE, 0xAC, 0xE7, 0x5F, 0x9C, 0x5D, 0x9E, 0x5E, 0xFF, 
+0xF1, 0xCD, 0x39, 0xBB, 0x49, 0x97, 0xFE, 0xF1, 0xCE, 0x73, 0xFC, 0x87, 0xF9, 0x6E, 0xB0, 0x38, 
+0xEA, 0xF0, 0xA0, 0x83, 0x0F, 0xB8, 0x3B, 0x3B, 0xDE, 0x61, 0xF0, 0xDF, 0xF3, 0x25, 0x4F, 0x5D, 
+0x36, 0xBD, 0x71, 0xE3, 0x84, 0xA7, 0x47, 0x9D, 0x77, 0xD7, 0x2F, 0x06, 0xCF, 0x3A, 0xEA, 0xAB, 
+0xC0, 0x5D, 0xF2, 0xA3, 0xCE, 0xAD, 0xC7, 0xEF, 0xA2, 0x30, 0x4E, 0x3B, 0x6C, 0x1A, 0x06, 0x29, 
+0x0F, 0xA0, 0xE9, 0x9D, 0x37, 0x4B, 0x6F, 0x8E, 0x66, 0xFC, 0xD6, 0x9B, 0xF2, 0x01, 0xFD, 0xD2, 
+0x67, 0x5E, 0xE0, 0xA5, 0x9E, 0xEB, 0x0F, 0x92, 0xA9, 0xEB, 0xF3, 0xA3, 0xBD, 0xE1, 0x28, 0x03, 
+0x95, 0x7A, 0xA9, 0xCF, 0x8F, 0xD9, 0x7F, 0xFC, 0xDB, 0xFF, 0xFE, 0x3F, 0xFF, 0xF3, 0xBF, 0xFF, 
+0x37, 0xF8, 0x87, 0x9D, 0xF8, 0xFE, 0xE0, 0x8A, 0x73, 0x2F, 0x58, 0xB0, 0xF3, 0x35, 0x7F, 0xBE, 
+0x2B, 0x5A, 0x88, 0xD6, 0x49, 0xBA, 0xCE, 0x7E, 0xC6, 0xFF, 0xC6, 0x71, 0x18, 0xA6, 0xEC, 0x63, 
+0xFE, 0x3B, 0xFE, 0x37, 0x18, 0x4C, 0x16, 0x83, 0x69, 0xE8, 0x87, 0xF1, 0x98, 0x7D, 0xB9, 0xB7, 
+0x8F, 0x7F, 0x0E, 0x4B, 0x0D, 0xA6, 0x6E, 0x3C, 0x2B, 0x9A, 0x70, 0xFC, 0x53, 0x6E, 0x92, 0xF2, 
+0xFB, 0x34, 0x6F, 0xC2, 0x47, 0xF8, 0xA7, 0xDC, 0xC4, 0x9D, 0x4E, 0x61, 0xBA, 0x79, 0xA3, 0xC9, 
+0xE4, 0xD9, 0xD3, 0xF9, 0xB4, 0xDC, 0x68, 0x06, 0xB8, 0xE5, 0x71, 0xDE, 0x68, 0x3A, 0x7F, 0xFA, 
+0xF4, 0x1F, 0xBE, 0x2D, 0x37, 0x4A, 0x56, 0x00, 0x2A, 0x49, 0xF2, 0x56, 0xA3, 0xC7, 0x33, 0x77, 
+0xFA, 0xB4, 0xDC, 0x6A, 0x12, 0xC6, 0x33, 0x05, 0xD4, 0xE3, 0xC7, 0x8F, 0x8B, 0x16, 0x9B, 0xFC, 
+0xA7, 0x47, 0xEC, 0x23, 0x9B, 0x84, 0xF7, 0x83, 0xC4, 0xFB, 0x13, 0x60, 0x70, 0xCC, 0xE4, 0x57, 
+0xF0, 0xE8, 0x50, 0x69, 0x35, 0x09, 0x67, 0xEB, 0x12, 0xDE, 0x26, 0xEE, 0xF4, 0xC3, 0x22, 0x0E, 
+0x57, 0x41, 0x8E, 0x9A, 0x5B, 0x37, 0x76, 0x0A, 0x6C, 0xF6, 0xF4, 0xF1, 0x68, 0x6D, 0x0A, 0x6C, 
+0x95, 0x5A, 0xCD, 0x81, 0x26, 0x06, 0x73, 0x77, 0xE9, 0xF9, 0xEB, 0x31, 0xEB, 0x5E, 0xF1, 0x45, 
+0xC8, 0xD9, 0xBB, 0x8B, 0x6E, 0x9F, 0x5D, 0xBB, 0x37, 0xE1, 0xD2, 0xED, 0xB3, 0x1F, 0x78, 0xC0, 
+0x6F, 0xE1, 0xDF, 0x3F, 0xF0, 0x18, 0x50, 0x05, 0x3F, 0x24, 0x6E, 0x90, 0x0C, 0x12, 0x1E, 0x7B, 
+0x73, 0x1D, 0xD2, 0xD2, 0x8D, 0x17, 0x5E, 0x30, 0x66, 0xA5, 0x65, 0x98, 0x79, 0x49, 0xE4, 0xBB, 
+0x00, 0x7C, 0x11, 0x7B, 0x33, 0xFD, 0x15, 0x3E, 0x81, 0x91, 0x2D, 0xE1, 0x7D, 0xCA, 0x07, 0x71, 
+0x78, 0x97, 0x8C, 0x99, 0xBB, 0x4A, 0x43, 0xB6, 0x37, 0x8F, 0xC5, 0x0F, 0xF8, 0xD7, 0x21, 0xDB, 
+0x7D, 0xC4, 0x7E, 0x04, 0xAA, 0xE7, 0x71, 0x9F, 0xBD, 0x72, 0xBD, 0xA0, 0xCF, 0x4E, 0x61, 0xD0, 
+0x71, 0xE8, 0x27, 0x7D, 0xF6, 0x02, 0xC8, 0x8B, 0xC7, 0xEC, 0xD1, 0xAE, 0x06, 0xF8, 0x86, 0x7B, 
+0x8B, 0x9B, 0x74, 0xCC, 0xF6, 0x46, 0xA3, 0xDB, 0x1B, 0xBD, 0xCF, 0xF0, 0x96, 0xC7, 0x73, 0x3F, 
+0xBC, 0x1B, 0xB3, 0x1B, 0x6F, 0x36, 0xE3, 0x81, 0x69, 0x85, 0x6E, 0xA8, 0xB3, 0x96, 0xD8, 0x8F, 
+0xDC, 0x80, 0xFB, 0x46, 0xD4, 0x46, 0xEE, 0x6C, 0x46, 0x2B, 0x3C, 0x62, 0xFB, 0xA3, 0xE8, 0xFE, 
+0xD0, 0x38, 0xC4, 0x83, 0xCA, 0x9B, 0x1C, 0x61, 0x73, 0x9F, 0x97, 0x5E, 0xFD, 0xBA, 0x4A, 0x52, 
+0x6F, 0xBE, 0x1E, 0xC8, 0x8D, 0x3C, 0x66, 0x49, 0xE4, 0xC2, 0x0E, 0x9E, 0xF0, 0xF4, 0x8E, 0xAB, 
+0x53, 0xC1, 0xFF, 0x5C, 0xDF, 0x5B, 0x04, 0x03, 0x0F, 0xD0, 0x0B, 0x58, 0xC5, 0x7D, 0xC0, 0x63, 
+0xBD, 0x41, 0x4E, 0x77, 0x69, 0x1A, 0x2E, 0x01, 0x57, 0xD1, 0x3D, 0x4B, 0x42, 0xDF, 0x9B, 0x65, 
+0x54, 0xA5, 0x10, 0x73, 0xCF, 0x88, 0xA5, 0x3D, 0x20, 0xE4, 0x62, 0xD1, 0x05, 0x25, 0x01, 0x51, 
+0x73, 0x80, 0x35, 0xDC, 0x8B, 0xF9, 0xF2, 0xB0, 0x34, 0x15, 0xE3, 0x90, 0xD8, 0xC2, 0x8D, 0x70, 
+0xA1, 0x00, 0x0B, 0x02, 0xC2, 0x5D, 0x8E, 0x18, 0x80, 0xE9, 0xF3, 0x14, 0x1A, 0x0D, 0x70, 0x9A, 
+0x84, 0xC9, 0xBD, 0x48, 0xDB, 0x24, 0xC3, 0x24, 0x75, 0xD3, 0x55, 0x32, 0x98, 0xB8, 0xB3, 0x05, 
+0xB7, 0xAE, 0x57, 0x79, 0x2B, 0x6A, 0x6B, 0xB3, 0x0F, 0xD3, 0x7E, 0x56, 0x5E, 0x02, 0x39, 0xF7, 
+0xD8, 0x9D, 0x79, 0x2B, 0x18, 0xEA, 0x93, 0xF2, 0x7B, 0x65, 0xAA, 0xA3, 0xE1, 0x3F, 0xE0, 0x54, 
+0x4D, 0x3B, 0xEF, 0x4B, 0xD7, 0x75, 0xF5, 0x17, 0xB4, 0x0B, 0xD3, 0x18, 0x36, 0xD0, 0x3C, 0x8C, 
+0x01, 0xE7, 0xAB, 0x28, 0xE2, 0xF1, 0xD4, 0x4D, 0xB8, 0x09, 0xBF, 0xDA, 0xE4, 0x86, 0xEE, 0x34, 
+0xF5, 0x6E, 0x61, 0x8E, 0xCC, 0xB2, 0xF5, 0xB5, 0xF9, 0x8A, 0x97, 0x1A, 0xD3, 0xEA, 0x95, 0xD0, 
+0x3B, 0x09, 0xFD, 0x99, 0x86, 0x4A, 0x5A, 0x9C, 0x25, 0xF2, 0x4B, 0x13, 0x36, 0xF3, 0x95, 0xF4, 
+0x02, 0xDF, 0x0B, 0x80, 0xE4, 0xFC, 0x70, 0xFA, 0xC1, 0x82, 0xD2, 0x27, 0x2D, 0x50, 0xFA, 0xED, 
+0xB7, 0xDF, 0x6E, 0x89, 0xD4, 0x16, 0xB8, 0xAB, 0x2C, 0xFB, 0xFE, 0xFE, 0xBE, 0x79, 0x65, 0x9E, 
+0x3D, 0x7B, 0x66, 0x1A, 0x9E, 0xBA, 0x0B, 0xAA, 0x34, 0x23, 0x68, 0x3D, 0xDF, 0x30, 0xDA, 0x14, 
+0xED, 0x88, 0x1C, 0xC6, 0xC0, 0x4D, 0xD6, 0xC8, 0xF3, 0xD5, 0x91, 0x8D, 0xE6, 0xFB, 0xF3, 0x7D, 
+0xF7, 0x90, 0x95, 0x04, 0x0A, 0x2B, 0x89, 0x90, 0xEC, 0x71, 0x01, 0x7E, 0xA7, 0x18, 0x8D, 0x17, 
+0xD8, 0x16, 0xA9, 0x1D, 0xAB, 0xCD, 0xB8, 0x2C, 0x31, 0xD8, 0x53, 0xC1, 0x52, 0x80, 0xCF, 0x7B, 
+0x7F, 0x2A, 0xB3, 0x53, 0x3B, 0xCF, 0xA4, 0x75, 0x0F, 0x13, 0xD0, 0x1C, 0x42, 0x60, 0x02, 0x31, 
+0x07, 0xE8, 0x40, 0xA5, 0x2A, 0x5A, 0xF2, 0x1F, 0xA1, 0x8F, 0x97, 0xEE, 0x3A, 0x5C, 0xA5, 0xEC, 
+0x6A, 0x9D, 0xC0, 0x48, 0xD4, 0x4E, 0xBE, 0xF4, 0xE9, 0xCD, 0x00, 0x47, 0xF9, 0xD0, 0x39, 0x01, 
+0xCA, 0x56, 0xCB, 0x40, 0x4C, 0x8B, 0x66, 0xF4, 0x2A, 0x9C, 0x78, 0x3E, 0x67, 0x67, 0x7C, 0xEE, 
+0xAE, 0xFC, 0x74, 0xBB, 0x39, 0x29, 0x02, 0xE4, 0x77, 0xC6, 0xD9, 0x0C, 0xE5, 0x88, 0xA1, 0xD7, 
+0xD2, 0x80, 0x33, 0xC0, 0x83, 0xB5, 0x10, 0x66, 0x16, 0xE6, 0x1E, 0x84, 0x01, 0x17, 0x92, 0x8D, 
+0xBA, 0x67, 0x93, 0x35, 0x9B, 0xC9, 0x91, 0x86, 0x01, 0x5B, 0x8A, 0xB1, 0x3B, 0x37, 0x6E, 0x30, 
+0xF3, 0xF9, 0x0C, 0xDF, 0xA6, 0xEE, 0x24, 0xE9, 0x95, 0x67, 0x81, 0x7C, 0x75, 0x30, 0xF3, 0x62, 
+0x3E, 0x15, 0x2B, 0x20, 0x90, 0x50, 0xB3, 0x23, 0xF6, 0x9E, 0xE0, 0x1F, 0x23, 0xDD, 0x16, 0x33, 
+0x2A, 0x98, 0x4D, 0x89, 0x81, 0xAB, 0x08, 0x80, 0x76, 0x83, 0x06, 0x41, 0x89, 0xFD, 0xB9, 0xF8, 
+0xC7, 0xC2, 0x28, 0x90, 0xEB, 0xB3, 0xBD, 0x83, 0x5A, 0x46, 0xF0, 0xED, 0x43, 0x19, 0x41, 0xC3, 
+0x56, 0x37, 0xC8, 0xBD, 0xEA, 0x8E, 0xAF, 0x72, 0xCC, 0x1A, 0x49, 0xDD, 0x24, 0x9D, 0x9B, 0x25, 
+0xF2, 0x12, 0xB8, 0x4B, 0x46, 0x79, 0x4F, 0xF6, 0x75, 0xF6, 0xA2, 0xEE, 0xA3, 0x33, 0x9E, 0x7C, 
+0x48, 0xC3, 0x88, 0x5D, 0x02, 0xA9, 0xC1, 0x1E, 0xE0, 0x89, 0x4A, 0x16, 0xFF, 0xB8, 0xE4, 0x33, 
+0xCF, 0x65, 0x0E, 0x02, 0x23, 0xD5, 0x9E, 0xA8, 0x18, 0x30, 0xDD, 0x2B, 0xAD, 0x53, 0xCD, 0xA6, 
+0xAB, 0xDF, 0x5D, 0xD9, 0xFF, 0x89, 0x7C, 0x5F, 0xF2, 0x79, 0xCA, 0x9C, 0xF3, 0xE0, 0xB6, 0x07, 
+0x6A, 0x19, 0xCD, 0x89, 0x39, 0xD7, 0x21, 0xE8, 0x66, 0xF0, 0xFB, 0x5B, 0x9C, 0x0A, 0x73, 0x7E, 
+0x0A, 0xE3, 0x0F, 0x15, 0xCA, 0xDD, 0x68, 0xBF, 0x0D, 0x05, 0xC1, 0x0F, 0x90, 0xC8, 0x55, 0xB2, 
+0xC3, 0x5D, 0xC2, 0xBE, 0xF0, 0x96, 0x68, 0xBF, 0xB8, 0x41, 0x7A, 0x58, 0xFE, 0xCC, 0xBA, 0x0B, 
+0x55, 0x91, 0x23, 0xB7, 0x72, 0x3B, 0xFD, 0xC6, 0xB8, 0xB6, 0xDA, 0x10, 0x60, 0xD2, 0x2F, 0xC2, 
+0x78, 0xCA, 0x59, 0x72, 0x13, 0xDE, 0xC1, 0xA2, 0xFA, 0x72, 0xD7, 0x25, 0xB8, 0x71, 0x67, 0x72, 
+0x69, 0xEA, 0x67, 0x5B, 0x0C, 0x7B, 0xEC, 0xBB, 0x09, 0xFC, 0x70, 0xE3, 0xF9, 0x33, 0x32, 0x0B, 
+0xD4, 0x11, 0x0B, 0x16, 0xB1, 0x31, 0x11, 0xC1, 0x97, 0x7E, 0xB8, 0x10, 0x9A, 0x67, 0x69, 0xDE, 
+0x38, 0x5A, 0x98, 0x6B, 0xCD, 0x86, 0x3B, 0xDC, 0x82, 0x5B, 0xE9, 0xC6, 0x01, 0x88, 0x08, 0x40, 
+0xA0, 0x9B, 0x80, 0x71, 0xB0, 0x0C, 0x83, 0x90, 0xA8, 0xBB, 0x66, 0xE7, 0x3E, 0x3B, 0xB0, 0x2A, 
+0x46, 0xD3, 0xE9, 0xB4, 0x86, 0x47, 0x01, 0xB5, 0x9A, 0x19, 0x14, 0xCC, 0x19, 0x28, 0x2C, 0x5E, 
+0xE7, 0x7A, 0x67, 0xBE, 0x89, 0x51, 0x43, 0xAB, 0xD9, 0xD8, 0xA8, 0x07, 0x64, 0x58, 0xC8, 0xDF, 
+0xE3, 0x06, 0x13, 0xCC, 0xE4, 0x2E, 0x46, 0x1D, 0x14, 0xFF, 0x3E, 0x64, 0x77, 0x00, 0x64, 0x30, 
+0x01, 0x99, 0xFD, 0x01, 0x76, 0x3C, 0xFE, 0x33, 0x80, 0x15, 0x36, 0x0A, 0xE0, 0x42, 0xC4, 0x5C, 
+0x23, 0xD5, 0x2A, 0x2B, 0xAE, 0x53, 0x73, 0x5B, 0xE5, 0xBE, 0x91, 0x6F, 0x7E, 0xAA, 0xC2, 0x3E, 
+0x84, 0xF1, 0x0C, 0x26, 0x69, 0xB0, 0x1D, 0xC9, 0xEC, 0x97, 0x49, 0x66, 0xBA, 0x8A, 0x13, 0x5C, 
+0xC5, 0x28, 0xF4, 0x6C, 0x46, 0x85, 0xA4, 0x5D, 0xEB, 0xF4, 0x88, 0x7B, 0x47, 0x6E, 0x0C, 0xAB, 
+0xF9, 0x30, 0xA6, 0xBD, 0x9F, 0xCF, 0xDD, 0x0A, 0xEA, 0xD3, 0xA5, 0x48, 0x15, 0x73, 0xB9, 0x60, 
+0x6C, 0x37, 0x36, 0xA3, 0xC7, 0xA1, 0xCE, 0x1B, 0xA1, 0x2B, 0xAF, 0x23, 0xFC, 0x63, 0x1A, 0x8E, 
+0x4A, 0x82, 0x17, 0xAF, 0xAF, 0xCF, 0xDF, 0xBE, 0x3E, 0x79, 0xC9, 0xAE, 0x4F, 0xBE, 0xBF, 0x62, 
+0xCE, 0x45, 0x90, 0x80, 0x40, 0x00, 0x6D, 0x8E, 0x38, 0x92, 0xC6, 0x75, 0x87, 0xC9, 0x6A, 0xF2, 
+0x57, 0x23, 0x49, 0x9B, 0xF3, 0x23, 0x1B, 0x44, 0x5B, 0x3A, 0x54, 0x47, 0x60, 0xA0, 0x29, 0x2B, 
+0xB5, 0x65, 0x58, 0x7E, 0xFA, 0xF4, 0xA9, 0x85, 0xB0, 0x9F, 0x6D, 0x45, 0xD7, 0x3A, 0x67, 0x7B, 
+0xB0, 0x71, 0xB2, 0x15, 0x15, 0x9B, 0xB1, 0x36, 0xBE, 0x41, 0x9E, 0x5D, 0x18, 0x82, 0x64, 0x65, 
+0x56, 0xCD, 0x1E, 0xCB, 0xD7, 0x66, 0x0A, 0xD6, 0x6C, 0x4A, 0xD5, 0x6B, 0xD6, 0x6B, 0x39, 0xFE, 
+0xE6, 0x2F, 0xB5, 0xF1, 0x1D, 0xE0, 0x9F, 0x5A, 0xCA, 0xCE, 0xC7, 0x2C, 0x95, 0x29, 0x1B, 0xCD, 
+0x56, 0x57, 0xBE, 0x8D, 0x4A, 0x5C, 0x70, 0xB7, 0x83, 0x2D, 0x05, 0x62, 0x99, 0x46, 0x37, 0xD6, 
+0x11, 0xB7, 0x52, 0xA2, 0x41, 0xB7, 0x1F, 0x4C, 0xBD, 0x78, 0xEA, 0x97, 0x57, 0x24, 0xD3, 0xDC, 
+0x9E, 0xD8, 0xFC, 0x46, 0xD5, 0x37, 0x25, 0x0B, 0xFB, 0x40, 0xB5, 0x5C, 0xCC, 0x0E, 0x2C, 0x5D, 
+0xD2, 0x5A, 0xCC, 0xE0, 0x83, 0x83, 0x83, 0xAD, 0xF8, 0xFF, 0xFD, 0x20, 0xB9, 0x71, 0x67, 0x68, 
+0x58, 0x8D, 0xD0, 0xF1, 0x05, 0x80, 0xE2, 0xC5, 0xC4, 0x75, 0x46, 0x7D, 0xFA, 0x33, 0x3C, 0x28, 
+0x11, 0x06, 0x51, 0xBE, 0xB4, 0x1F, 0x51, 0x97, 0x1A, 0x0D, 0x1F, 0x27, 0x8C, 0xDB, 0xF8, 0x70, 
+0x81, 0xAF, 0x7C, 0x1B, 0x28, 0xBB, 0x8E, 0x5C, 0xD7, 0xCE, 0xDE, 0x70, 0xBF, 0x67, 0x13, 0xD8, 
+0x6F, 0x78, 0x9C, 0x78, 0x09, 0x11, 0x14, 0xDA, 0xB9, 0x6F, 0x48, 0x83, 0x52, 0x0D, 0xD1, 0x5B, 
+0xEF, 0x4F, 0x46, 0xBD, 0x2A, 0x47, 0x3B, 0xF9, 0xEB, 0x58, 0x4B, 0xE5, 0xA5, 0xC9, 0x3C, 0x56, 
+0x96, 0x0D, 0x94, 0xC6, 0x07, 0x88, 0xF4, 0x62, 0xE0, 0x49, 0x04, 0x04, 0x1F, 0xAF, 0x96, 0x83, 
+0xA9, 0x1B, 0xDC, 0xBA, 0xA8, 0x44, 0x17, 0xCA, 0xFF, 0xEF, 0x0E, 0x75, 0x83, 0xB6, 0xA0, 0x48, 
+0xE1, 0xC6, 0x51, 0x00, 0x7E, 0x19, 0x80, 0xB5, 0x02, 0xFA, 0xFA, 0x03, 0xC1, 0xA8, 0xB8, 0x7E, 
+0x2D, 0x20, 0xB1, 0x57, 0xAE, 0xA6, 0x0E, 0xE7, 0x3D, 0x2C, 0xDD, 0x88, 0xF6, 0x8A, 0xEB, 0x05, 
+0x15, 0x1B, 0x32, 0xEB, 0x67, 0xBF, 0xEA, 0x1E, 0xD5, 0xB1, 0xED, 0xE2, 0x9F, 0xCF, 0xA1, 0x26, 
+0xB5, 0x59, 0xAA, 0x3A, 0xDF, 0xB1, 0x3A, 0xF3, 0xCC, 0x3D, 0xAD, 0x49, 0xDF, 0xA9, 0x7C, 0x68, 
+0x9D, 0x73, 0x8D, 0x1C, 0x6E, 0xC3, 0xD3, 0x0A, 0x3F, 0xEA, 0x16, 0xFE, 0xB0, 0x1A, 0xCB, 0xA0, 
+0xC9, 0x07, 0xDA, 0xE4, 0x31, 0x33, 0x31, 0x75, 0x89, 0x83, 0x01, 0x0E, 0x28, 0xAA, 0x72, 0x46, 
+0xCB, 0x34, 0xC5, 0xD4, 0x0E, 0x74, 0xD7, 0x6F, 0xFE, 0x83, 0xEF, 0x4E, 0x70, 0xB7, 0x1A, 0xDC, 
+0x87, 0x9A, 0x36, 0x59, 0x23, 0xA2, 0x15, 0xA8, 0x5E, 0x10, 0xAD, 0xD2, 0x3E, 0x4B, 0xB8, 0x0F, 
+0x63, 0xA8, 0xF5, 0x6B, 0xEC, 0xED, 0x35, 0xA2, 0xE3, 0xC9, 0x93, 0x27, 0x46, 0xA5, 0xE4, 0xEE, 
+0xC6, 0x4B, 0xB9, 0x65, 0x1D, 0x9E, 0xA2, 0x47, 0xA4, 0x69, 0x2D, 0x1E, 0x6F, 0xE1, 0x31, 0x51, 
+0x22, 0x4A, 0x2B, 0xD8, 0x10, 0xA0, 0x74, 0xD9, 0x99, 0x97, 0x49, 0x8A, 0x33, 0xD3, 0x0C, 0x26, 
+0xBE, 0x8B, 0xFB, 0xBD, 0xC1, 0x57, 0xC2, 0x6A, 0xC5, 0x06, 0x6B, 0xA9, 0xC9, 0xA9, 0x0A, 0x1B, 
+0xDB, 0x7B, 0xBA, 0x2D, 0x6A, 0x5A, 0x6A, 0x66, 0x35, 0xFA, 0x5D, 0x19, 0x83, 0xB9, 0xE4, 0x09, 
+0x31, 0x2A, 0x91, 0xAE, 0x09, 0xE7, 0x1A, 0xF3, 0x9B, 0x8B, 0xA0, 0x54, 0x0D, 0xF9, 0x50, 0xB8, 
+0xD2, 0x36, 0x51, 0xA0, 0x74, 0x43, 0xC0, 0x48, 0xA7, 0x6F, 0xBB, 0x6D, 0x5D, 0xD1, 0x78, 0xFF, 
+0x1A, 0xF1, 0xA4, 0x52, 0xD4, 0x82, 0x9A, 0x15, 0x56, 0x7A, 0xE6, 0x81, 0x39, 0x30, 0x44, 0x6F, 
+0x06, 0xB7, 0xAE, 0xAF, 0x28, 0xB3, 0xB4, 0x55, 0xE5, 0x67, 0x3E, 0x9F, 0xA7, 0xF6, 0x7D, 0x0F, 
+0x7C, 0xF6, 0x3A, 0xE6, 0x1C, 0xE4, 0x38, 0xBF, 0xD3, 0x18, 0x6D, 0x0A, 0x4F, 0x07, 0x41, 0x38, 
+0xE3, 0xC5, 0x00, 0x04, 0x24, 0x11, 0x64, 0xD2, 0x22, 0x3F, 0x23, 0x6D, 0x3C, 0x53, 0x1F, 0xF0, 
+0x81, 0xC4, 0x44, 0x31, 0x6B, 0x13, 0x45, 0x6B, 0x8A, 0x72, 0x39, 0xBE, 0x52, 0xF2, 0x49, 0x1C, 
+0x28, 0xBD, 0x89, 0x11, 0x88, 0x01, 0xC8, 0x66, 0x28, 0xF0, 0xC5, 0x03, 0x65, 0x04, 0x32, 0x24, 
+0x2F, 0x47, 0xAF, 0x69, 0xF8, 0x25, 0x5E, 0xA9, 0x84, 0xCD, 0x54, 0xE6, 0x71, 0x68, 0xB4, 0xD9, 
+0xCA, 0x43, 0xDB, 0x57, 0xDC, 0x25, 0xD9, 0xCE, 0x19, 0x95, 0x1D, 0x28, 0x65, 0xFF, 0x89, 0x79, 
+0x98, 0xF9, 0x6E, 0x30, 0x69, 0xF8, 0xD5, 0x4D, 0xAF, 0x2A, 0xBF, 0xEA, 0x64, 0x87, 0x7C, 0xE6, 
+0x01, 0xD9, 0x4C, 0x89, 0x41, 0x15, 0x1B, 0xCB, 0x00, 0x41, 0x5D, 0x52, 0x25, 0x6C, 0x98, 0x07, 
+0x1E, 0x2B, 0x8C, 0xBF, 0x76, 0xDC, 0xE6, 0x7E, 0xF7, 0xB4, 0xAF, 0xC0, 0x2A, 0x73, 0x97, 0x7C, 
+0x40, 0xB2, 0xA1, 0x3C, 0x51, 0x14, 0x79, 0x3A, 0x5F, 0xB7, 0xE9, 0xD0, 0x3A, 0xE1, 0x11, 0x71, 
+0x08, 0xD5, 0x6A, 0x6F, 0x5F, 0x52, 0x81, 0x46, 0xDA, 0x6E, 0xF2, 0x81, 0x9D, 0xBA, 0xA9, 0xEB, 
+0x87, 0x0B, 0x9D, 0xBA, 0xE1, 0x05, 0x28, 0x67, 0xF4, 0x42, 0x55, 0x25, 0x32, 0x95, 0x49, 0x68, 
+0x66, 0x8A, 0x15, 0x23, 0x22, 0x3C, 0x59, 0xE7, 0x15, 0x8A, 0x23, 0x78, 0x55, 0x63, 0xBC, 0xA4, 
+0xDA, 0x19, 0x6D, 0x93, 0x91, 0xDD, 0xC2, 0xB0, 0x64, 0x6D, 0xD8, 0xFD, 0x7F, 0x2D, 0xC2, 0x6F, 
+0xC4, 0xC9, 0x89, 0x0B, 0x8D, 0x19, 0xAE, 0x7E, 0x8D, 0xC3, 0xCA, 0x60, 0xD7, 0xD5, 0x05, 0xEF, 
+0x1A, 0xAD, 0x9A, 0xAA, 0x91, 0xB2, 0x9F, 0x6C, 0xE5, 0x6D, 0x92, 0x3B, 0x4B, 0xF0, 0xA1, 0xC7, 
+0xAD, 0xCD, 0xFE, 0x6C, 0x71, 0x1A, 0x36, 0x99, 0xC4, 0xEA, 0x7C, 0x3E, 0x3F, 0xB4, 0xF5, 0x64, 
+0x14, 0xED, 0x86, 0x9E, 0x86, 0x42, 0xF5, 0xE1, 0xB3, 0x4A, 0x67, 0x2E, 0xFE, 0x69, 0x80, 0x5F, 
+0xE6, 0x88, 0x62, 0x64, 0x72, 0x5F, 0x98, 0x7A, 0x03, 0x32, 0x73, 0x27, 0x3E, 0xF5, 0xA6, 0x48, 
+0xD3, 0x27, 0x87, 0xD9, 0x32, 0x0C, 0xF8, 0x2D, 0x0C, 0x38, 0xA9, 0xFA, 0xC2, 0x0B, 0xBA, 0x1D, 
+0xE2, 0xE6, 0x34, 0x73, 0xEB, 0xB2, 0x7D, 0x52, 0xE3, 0xE6, 0x30, 0x83, 0x9E, 0xF1, 0x64, 0xAA, 
+0xAA, 0xA9, 0x12, 0x4E, 0x55, 0x59, 0x30, 0xCA, 0x2F, 0x32, 0xE9, 0x9E, 0x54, 0xF7, 0xF6, 0x0B, 
+0x50, 0x44, 0xD8, 0xD7, 0xEC, 0xFC, 0x9E, 0x4F, 0x35, 0xC3, 0x88, 0xFA, 0x45, 0x2D, 0x45, 0xDB, 
+0xD7, 0x05, 0xDB, 0x18, 0x15, 0x3C, 0x43, 0x1A, 0x60, 0x4B, 0xF7, 0x3E, 0x8B, 0xF1, 0x3C, 0x1D, 
+0x29, 0xC2, 0x65, 0x3C, 0x92, 0x81, 0x5D, 0x65, 0x56, 0x04, 0x38, 0x0B, 0xD8, 0x55, 0x04, 0xC2, 
+0xA8, 0xDE, 0x81, 0x4E, 0x6C, 0xAE, 0xEC, 0x40, 0xAF, 0xF0, 0x12, 0xEA, 0x82, 0x92, 0xC1, 0x74, 
+0x7D, 0x7C, 0x6F, 0xF8, 0x84, 0x90, 0xA4, 0x24, 0x8B, 0xB4, 0x5C, 0x0A, 0x82, 0x28, 0x57, 0x41, 
+0xDF, 0x62, 0x07, 0x1A, 0xDA, 0x49, 0x42, 0xAA, 0x68, 0x27, 0xFE, 0x4A, 0x99, 0x0A, 0xB9, 0xC9, 
+0x8A, 0x64, 0x55, 0x06, 0x9D, 0x19, 0x22, 0x46, 0x74, 0x94, 0x1B, 0x67, 0x96, 0x46, 0x99, 0x1C, 
+0x0C, 0xAC, 0xC5, 0x14, 0x09, 0x51, 0x3C, 0xBF, 0x93, 0x6A, 0x66, 0xCB, 0x68, 0x78, 0x60, 0xEA, 
+0x53, 0x1A, 0x24, 0xE2, 0x97, 0xCC, 0x2C, 0x61, 0x56, 0x76, 0x5C, 0x32, 0xE8, 0x8C, 0xC6, 0xB2, 
+0xCD, 0x54, 0xD1, 0xF9, 0x88, 0x85, 0xBB, 0x89, 0xBC, 0x1E, 0x13, 0xAF, 0x12, 0x84, 0x7B, 0xC3, 
+0xA7, 0x1F, 0x72, 0x44, 0x19, 0xB4, 0x2F, 0xD1, 0xC7, 0x97, 0xB3, 0xD9, 0x4C, 0xC5, 0x91, 0x64, 
+0x99, 0x66, 0x9B, 0x31, 0x75, 0x07, 0x99, 0xE9, 0x62, 0x98, 0xB7, 0x3E, 0x6D, 0xA1, 0x62, 0x96, 
+0x87, 0x5B, 0xC2, 0xF5, 0x5E, 0x9D, 0x8D, 0x5C, 0xC7, 0xC8, 0xC8, 0xB9, 0xA3, 0x31, 0x1A, 0xC1, 
+0x67, 0x74, 0x4D, 0xEA, 0x89, 0x45, 0xF4, 0x20, 0x5D, 0x0A, 0xC2, 0x52, 0xC5, 0x89, 0x64, 0x7B, 
+0x25, 0x91, 0xB2, 0x31, 0xCD, 0xBF, 0x62, 0x78, 0x90, 0xDD, 0x51, 0xF6, 0xB8, 0x51, 0x50, 0x9D, 
+0x5C, 0x6E, 0x8F, 0xFB, 0xFB, 0x7B, 0xCF, 0xFA, 0x7B, 0xDF, 0x3E, 0xEB, 0x8F, 0x86, 0x8F, 0x7B, 
+0x65, 0x2E, 0x84, 0xEC, 0x67, 0x85, 0x63, 0x60, 0x57, 0x91, 0x17, 0x04, 0x7A, 0x12, 0x9D, 0xE0, 
+0x45, 0x3C, 0x6B, 0x32, 0x40, 0x4D, 0x1D, 0x37, 0xB5, 0x2A, 0x83, 0xB3, 0x04, 0xAE, 0x22, 0xEF, 
+0xA7, 0xBC, 0x6B, 0x12, 0x09, 0xD8, 0x4C, 0xB0, 0xC2, 0x93, 0xA6, 0xE5, 0xC1, 0xE5, 0xA4, 0xF9, 
+0xA4, 0xC4, 0x7A, 0x54, 0x27, 0xD9, 0x93, 0x7A, 0xA1, 0xD6, 0xE4, 0x13, 0x65, 0x6E, 0xE0, 0x2D, 
+0x5D, 0x81, 0x7C, 0x1C, 0x20, 0xDB, 0x4B, 0x88, 0x51, 0xB8, 0x31, 0x58, 0xFF, 0x73, 0xCC, 0x82, 
+0xE5, 0x0A, 0xA7, 0x12, 0x69, 0x88, 0xFB, 0xBA, 0xD3, 0xAF, 0x98, 0xE2, 0x3F, 0x7E, 0xE0, 0xEB, 
+0x79, 0x0C, 0x02, 0x28, 0x11, 0xB0, 0x3E, 0xB2, 0xD1, 0xEF, 0x74, 0x9F, 0x64, 0x1C, 0x22, 0xEA, 
+0x9C, 0xD1, 0x8C, 0x2F, 0x70, 0x09, 0x68, 0x9B, 0x1A, 0x5B, 0x3C, 0x7E, 0x9A, 0xB7, 0x29, 0x2D, 
+0xD4, 0x32, 0x02, 0xFA, 0xB8, 0xA2, 0x15, 0x50, 0x35, 0x41, 0x8E, 0xCF, 0xB3, 0x95, 0xA9, 0xCB, 
+0x4B, 0xB0, 0xB9, 0x55, 0x8C, 0xE9, 0x78, 0x15, 0x93, 0xD0, 0x94, 0xA8, 0xA0, 0xBB, 0x01, 0x33, 
+0xBE, 0x41, 0x4C, 0xC4, 0x40, 0x21, 0x26, 0xAA, 0x16, 0x83, 0x97, 0x7A, 0xB7, 0xC2, 0x2C, 0x1F, 
+0x2B, 0x82, 0xA2, 0x10, 0x34, 0xB4, 0xAB, 0x15, 0x05, 0x61, 0xBF, 0x4C, 0xCC, 0x6F, 0x39, 0x86, 
+0xE7, 0x2B, 0xB6, 0xE0, 0x97, 0x31, 0x3D, 0x1F, 0x60, 0x0A, 0x74, 0x09, 0x47, 0xBA, 0x58, 0xFD, 
+0xDB, 0x44, 0xBD, 0x49, 0x31, 0x22, 0xB6, 0x04, 0x9F, 0x46, 0x31, 0xA7, 0x40, 0x74, 0xA9, 0x49, 
+0x25, 0x1C, 0x8D, 0x4F, 0xCA, 0x28, 0x7D, 0xBE, 0x2B, 0xD3, 0xAE, 0x9F, 0xEF, 0x8A, 0xF4, 0xF0, 
+0xE7, 0x98, 0x3E, 0x2C, 0x33, 0xB2, 0x85, 0xCC, 0x2F, 0x52, 0xB2, 0x9F, 0xDF, 0xEC, 0x1D, 0x6B, 
+0x7D, 0x3C, 0x87, 0x11, 0x04, 0xC7, 0x32, 0xBF, 0xFB, 0x3F, 0xFF, 0xFD, 0x5F, 0xE1, 0x27, 0x00, 
+0x88, 0xCF, 0x4A, 0x99, 0xDE, 0xAC, 0xFA, 0x19, 0xF3, 0x66, 0x47, 0x1D, 0x58, 0xC5, 0x40, 0x10, 
+0xD7, 0x40, 0xE4, 0x2C, 0x76, 0xD8, 0x14, 0x30, 0x96, 0x1C, 0x75, 0xD4, 0x14, 0xC6, 0xCE, 0xF1, 
+0xD9, 0xC5, 0xD5, 0xE9, 0xE5, 0xEB, 0xD7, 0xE7, 0xA7, 0xD7, 0xE7, 0x67, 0xB2, 0x07, 0x1B, 0x44, 
+0x69, 0x89, 0x67, 0xE0, 0x68, 0x7A, 0x47, 0x9D, 0x26, 0xC5, 0x4B, 0xD3, 0x01, 0x03, 0xD8, 0x5D, 
+0xAE, 0x7F, 0x68, 0x90, 0x42, 0x9D, 0xE3, 0x4A, 0xBA, 0x07, 0xA6, 0xB5, 0x9F, 0xAE, 0x62, 0xD4, 
+0xC4, 0xD9, 0xA9, 0xE8, 0x7C, 0x9C, 0xA7, 0x8E, 0xE1, 0x4B, 0x4C, 0x62, 0x41, 0x34, 0x5C, 0x02, 
+0x5D, 0x5F, 0xCC, 0x40, 0xC3, 0x81, 0x87, 0xFA, 0xE0, 0xAD, 0x13, 0x6A, 0x39, 0x78, 0xD3, 0x38, 
+0x8B, 0xA5, 0xD0, 0xE1, 0xCE, 0xBC, 0x5B, 0xC2, 0x13, 0xC6, 0x43, 0xBC, 0x60, 0xE6, 0x81, 0x41, 
+0x18, 0xC6, 0x39, 0xD6, 0x8B, 0x28, 0x49, 0x87, 0x91, 0x3A, 0x76, 0xD4, 0x79, 0x79, 0x7E, 0x46, 
+0x2C, 0x04, 0xB9, 0xE0, 0xA9, 0xEF, 0x4D, 0x3F, 0x30, 0x60, 0x6B, 0xB0, 0x6E, 0x73, 0x6F, 0xB1, 
+0x8A, 0x61, 0x69, 0x9E, 0xEF, 0x02, 0x48, 0x85, 0x46, 0x76, 0x33, 0x22, 0x11, 0x14, 0x85, 0xF4, 
+0x23, 0x0F, 0x16, 0x80, 0x5E, 0xAA, 0xB4, 0xFB, 0x62, 0x30, 0xC8, 0xB2, 0x20, 0x5E, 0xBB, 0xB7, 
+0xDE, 0x82, 0x18, 0xAB, 0x48, 0x88, 0x70, 0x64, 0x66, 0x1B, 0xFC, 0x2E, 0x13, 0x96, 0x7A, 0x6C, 
+0x30, 0x50, 0xBE, 0xC5, 0x49, 0xC8, 0x11, 0x2B, 0x09, 0x13, 0xA5, 0xC5, 0x79, 0x2E, 0x65, 0x3F, 
+0xCE, 0x16, 0x5A, 0xA1, 0x5E, 0x3E, 0xE0, 0xC1, 0x6D, 0x3E, 0xD7, 0x2C, 0x96, 0x2C, 0xA2, 0x6D, 
+0x1D, 0xE8, 0x6D, 0x8A, 0xD3, 0x03, 0xD2, 0xBB, 0xF3, 0xD2, 0xE9, 0x8D, 0x18, 0xDB, 0x69, 0xE8, 
+0x3B, 0x5D, 0xF8, 0xAA, 0xDB, 0xEB, 0x1C, 0xCB, 0xD5, 0x05, 0x05, 0xFC, 0x65, 0xB8, 0x48, 0x9E, 
+0xEF, 0x0A, 0xF8, 0xCD, 0x9D, 0x4E, 0xD3, 0xD8, 0x2F, 0xF7, 0x5A, 0xD7, 0x1D, 0xB6, 0xC7, 0xFE, 
+0xD0, 0x92, 0xDF, 0xA2, 0x1B, 0x0C, 0x8D, 0x6C, 0xD3, 0x0D, 0xB6, 0xC7, 0x6E, 0x5E, 0x85, 0x20, 
+0xB9, 0xC2, 0xB8, 0xDA, 0x91, 0x5C, 0xD9, 0x9D, 0x2A, 0xED, 0x14, 0xE9, 0x5F, 0x65, 0x9C, 0xE3, 
+0xAA, 0x9E, 0x5E, 0xBE, 0x7C, 0xF7, 0xEA, 0x35, 0xDB, 0x1B, 0xB3, 0xF3, 0xD7, 0x7F, 0xB8, 0x78, 
+0x7B, 0xF9, 0xFA, 0xD5, 0xF9, 0xEB, 0x6B, 0xC4, 0xDA, 0xE5, 0x0F, 0x57, 0xDA, 0x3A, 0x6A, 0x40, 
+0x31, 0x2B, 0x50, 0x5D, 0x1E, 0x25, 0x41, 0x4B, 0xAE, 0x50, 0x75, 0xEF, 0xA9, 0x84, 0x50, 0x64, 
+0x15, 0x16, 0x2B, 0x85, 0x69, 0x6E, 0xC8, 0xC1, 0x4B, 0x34, 0x5A, 0x51, 0x15, 0xAB, 0x83, 0x91, 
+0x5C, 0x04, 0x3D, 0x82, 0x39, 0x0F, 0x29, 0x59, 0x31, 0x36, 0x86, 0x90, 0x03, 0x92, 0x9F, 0x29, 
+0x72, 0xAD, 0xAC, 0xF8, 0xEC, 0xAB, 0x9A, 0x2D, 0xBA, 0x5F, 0x3B, 0xC7, 0x2F, 0x43, 0x17, 0x5F, 
+0x65, 0xAC, 0x84, 0xBD, 0x72, 0xD3, 0xD8, 0xBB, 0x1F, 0x0E, 0x87, 0x96, 0x39, 0x94, 0x17, 0x49, 
+0x5F, 0x0A, 0x35, 0x92, 0x56, 0xC6, 0xBC, 0x36, 0x61, 0x63, 0x68, 0xCD, 0x36, 0x39, 0x19, 0xE1, 
+0x53, 0xBF, 0x13, 0x8F, 0x90, 0x1B, 0x88, 0x9F, 0x9A, 0xD1, 0x92, 0x87, 0xCC, 0x60, 0xE7, 0x82, 
+0x5A, 0x21, 0xFC, 0x5F, 0x84, 0x58, 0x92, 0xD9, 0xB1, 0xF4, 0x49, 0xE9, 0x5A, 0xB9, 0x1E, 0x9F, 
+0x21, 0xBD, 0x01, 0xF6, 0x49, 0x18, 0xC1, 0xAF, 0x8B, 0x35, 0x7B, 0x13, 0xF3, 0x9A, 0xD5, 0xB6, 
+0x61, 0xCA, 0x42, 0x44, 0xD9, 0x38, 0x15, 0x1D, 0x9C, 0x2C, 0xE3, 0xCE, 0xB1, 0xCC, 0x42, 0x16, 
+0x4C, 0xC0, 0xDC, 0x95, 0x02, 0x32, 0xCB, 0x9D, 0xB1, 0x21, 0x53, 0xD9, 0xC9, 0xB8, 0x8B, 0xD1, 
+0x39, 0x07, 0xD8, 0x2F, 0x18, 0x86, 0x9A, 0xF6, 0x92, 0x6D, 0x84, 0x6B, 0x68, 0xC0, 0x9C, 0x97, 
+0xF0, 0x73, 0xCF, 0xCC, 0x1F, 0xEA, 0xA0, 0xE3, 0xFC, 0x4C, 0xD0, 0x3B, 0xC7, 0x78, 0x54, 0x86, 
+0x39, 0xDF, 0x87, 0x61, 0x5A, 0x03, 0x76, 0xEB, 0xBD, 0xA4, 0xB9, 0x1B, 0xCD, 0x73, 0xCB, 0x52, 
+0x35, 0x32, 0x56, 0xAC, 0x6F, 0xB8, 0xF1, 0x48, 0x68, 0xA2, 0xE3, 0xBD, 0x43, 0x35, 0xD1, 0x75, 
+0x7F, 0xD4, 0xB4, 0x01, 0xB3, 0xDE, 0x7D, 0x2F, 0x49, 0x2B, 0x40, 0x15, 0xD2, 0x92, 0x1A, 0x9B, 
+0x59, 0x61, 0xD3, 0xA8, 0x4F, 0x15, 0xBE, 0xA4, 0x95, 0x59, 0xBA, 0x6F, 0xC1, 0x03, 0x14, 0x12, 
+0xAE, 0xD8, 0x79, 0x9D, 0xE3, 0x9F, 0x5C, 0xD8, 0x1C, 0xC0, 0x06, 0x40, 0xD1, 0x07, 0x1B, 0xE3, 
+0x96, 0x33, 0x98, 0x47, 0x62, 0xE7, 0x02, 0x35, 0x0B, 0x53, 0x4B, 0xF6, 0xD5, 0xF5, 0x31, 0x52, 
+0x87, 0x5C, 0x9F, 0xBF, 0xC8, 0xC2, 0xC8, 0x1E, 0xFF, 0xAE, 0x56, 0x27, 0x63, 0xD2, 0xA0, 0x64, 
+0xC6, 0xE9, 0x2A, 0xFA, 0xE4, 0xC5, 0x69, 0x5A, 0x2F, 0x55, 0xAC, 0xEE, 0x83, 0x1A, 0x76, 0xF9, 
+0xFA, 0xFA, 0xED, 0xE5, 0xCB, 0x2B, 0x90, 0xA9, 0x67, 0xE7, 0x7F, 0xB8, 0x38, 0x3D, 0xAF, 0x97, 
+0xAA, 0x9A, 0xFE, 0x51, 0x88, 0xD5, 0xCE, 0x67, 0xE5, 0x5B, 0xA2, 0x39, 0x28, 0x2C, 0x75, 0x8C, 
+0xAB, 0xAC, 0x8D, 0xC8, 0x74, 0x07, 0x50, 0xFA, 0x9C, 0x2E, 0x7D, 0x9C, 0xA9, 0x3D, 0xEC, 0x25, 
+0x50, 0xC6, 0x76, 0xAC, 0x0D, 0xBB, 0x13, 0x51, 0x1A, 0x23, 0x73, 0xAB, 0xEB, 0x5A, 0x7C, 0x86, 
+0x7D, 0x9F, 0xD1, 0x4F, 0x98, 0x86, 0x01, 0xEA, 0x6D, 0x23, 0x0F, 0xDC, 0x31, 0xCA, 0x5C, 0x34, 
+0x25, 0xC7, 0x7A, 0x18, 0xA6, 0x56, 0xF4, 0xA2, 0xC8, 0xB2, 0xA0, 0xAE, 0x91, 0x2F, 0x36, 0x6D, 
+0x32, 0x73, 0xCC, 0x47, 0xD1, 0x12, 0x8D, 0xAF, 0xDB, 0xED, 0x1A, 0xAB, 0x12, 0xC3, 0xAA, 0xFB, 
+0xA9, 0xD8, 0x32, 0xB2, 0xB7, 0xCF, 0xCB, 0xCA, 0x0A, 0xB4, 0xCB, 0x05, 0xBC, 0xE2, 0x29, 0xB2, 
+0xCF, 0xA4, 0x05, 0xE6, 0x2D, 0x34, 0x93, 0xB1, 0x3C, 0x0B, 0x2E, 0x74, 0xA5, 0xA1, 0x9C, 0x9F, 
+0x93, 0xAF, 0x94, 0xF4, 0x4A, 0x89, 0x18, 0x84, 0xE2, 0x2C, 0x54, 0xC3, 0x37, 0x4D, 0xE8, 0xD6, 
+0x7B, 0x11, 0x8E, 0xE7, 0x9A, 0x6F, 0xE8, 0x3B, 0xF2, 0xA3, 0x1E, 0xBF, 0x88, 0x3D, 0x1E, 0xCC, 
+0xFC, 0x35, 0x18, 0x58, 0x4B, 0xFE, 0x7C, 0x57, 0x3C, 0xAC, 0xFF, 0x50, 0x84, 0x2A, 0xD3, 0x75, 
+0x24, 0xD9, 0x62, 0x47, 0x70, 0x91, 0xF9, 0x82, 0x7C, 0xE9, 0x1D, 0x16, 0xF9, 0xC0, 0x75, 0x6F, 
+0x42, 0x1F, 0x66, 0x75, 0xD4, 0xE1, 0xC3, 0xC5, 0x90, 0xFD, 0x1E, 0x77, 0x13, 0x18, 0x6B, 0xAF, 
+0xC3, 0x19, 0xAF, 0x9B, 0x8A, 0x7D, 0xB5, 0x3F, 0xC3, 0x4C, 0x7F, 0x0C, 0x93, 0x34, 0xF8, 0x0C, 
+0x93, 0xBC, 0x91, 0x70, 0x4A, 0x13, 0x75, 0x13, 0x3E, 0xB8, 0x87, 0xFF, 0xFE, 0x66, 0xF3, 0xCB, 
+0xAC, 0x81, 0x1F, 0xF0, 0x93, 0x4F, 0x9D, 0xA4, 0x34, 0x6E, 0x4A, 0x73, 0x94, 0x2E, 0x8B, 0x87, 
+0x4F, 0xF1, 0x53, 0xE7, 0x78, 0xED, 0x2D, 0xF9, 0x9F, 0x60, 0xA3, 0x7C, 0xEA, 0xF4, 0x52, 0x09, 
+0xA7, 0x34, 0xBF, 0x93, 0x25, 0x8F, 0xBD, 0xA9, 0xBB, 0xFB, 0x32, 0x4C, 0xFE, 0xE5, 0x24, 0x58, 
+0x70, 0x9F, 0x27, 0x9F, 0xB0, 0x9C, 0x25, 0xE1, 0xB3, 0x8A, 0x66, 0x78, 0xD6, 0xC9, 0x9B, 0xC1, 
+0x86, 0xF6, 0xD2, 0xB5, 0xC9, 0x78, 0xD8, 0x53, 0x03, 0xF7, 0xE8, 0xFD, 0xEC, 0x1C, 0xBF, 0x7B, 
+0x73, 0x76, 0x72, 0x7D, 0xCE, 0x2E, 0xCE, 0xC0, 0x3E, 0xBE, 0xB8, 0xFE, 0x63, 0xBD, 0xBC, 0x33, 
+0x2A, 0xD9, 0x26, 0xBE, 0xAC, 0xF4, 0xF9, 0x58, 0xCB, 0xF2, 0x10, 0x23, 0x50, 0xB8, 0x50, 0x9E, 
+0xE4, 0x51, 0x0D, 0x43, 0x34, 0x2C, 0x19, 0x56, 0x6B, 0x88, 0xC3, 0x60, 0x91, 0x13, 0xE6, 0x15, 
+0x70, 0xB4, 0x94, 0x2F, 0xD6, 0x63, 0x74, 0x28, 0xD2, 0x1B, 0x76, 0x11, 0xCC, 0x78, 0x04, 0xFC, 
+0x07, 0x50, 0xF2, 0x7C, 0x12, 0x37, 0xC2, 0x5B, 0x62, 0x78, 0x5C, 0x4E, 0x41, 0xB3, 0x88, 0xAF, 
+0x6F, 0xBC, 0x84, 0x51, 0xAA, 0x07, 0xFC, 0x3B, 0x15, 0x9E, 0x36, 0xE0, 0x69, 0x61, 0xC4, 0xA1, 
+0x4B, 0x14, 0x29, 0x5E, 0xD1, 0x91, 0xBF, 0x06, 0xB1, 0x42, 0xA0, 0x1E, 0xB4, 0xB4, 0x9F, 0x4F, 
+0x4B, 0x7B, 0x3C, 0x66, 0x3F, 0x5D, 0xBE, 0xFD, 0xFD, 0xD5, 0x9B, 0x13, 0xD0, 0xCE, 0xBE, 0x66, 
+0xE7, 0xFF, 0x74, 0x7E, 0xFA, 0xEE, 0xFA, 0xE2, 0xF2, 0x75, 0xBD, 0xA6, 0xA6, 0xB9, 0x70, 0x6A, 
+0x35, 0x35, 0xB3, 0x0C, 0x14, 0xAE, 0xFE, 0xBD, 0x31, 0xE0, 0x1E, 0x16, 0xA1, 0x5E, 0xF8, 0x91, 
+0xD9, 0xEE, 0x61, 0xBB, 0xBC, 0x47, 0x25, 0x2E, 0x50, 0xA7, 0x58, 0x68, 0xAD, 0xD1, 0x11, 0xDF, 
+0x39, 0xFE, 0x8F, 0xFF, 0xF1, 0xBF, 0xEA, 0xD0, 0x7A, 0xF3, 0xF8, 0xF8, 0x2D, 0x9D, 0x65, 0x46, 
+0x73, 0xE6, 0x22, 0x00, 0x0A, 0x59, 0x91, 0xD3, 0x17, 0xEC, 0x67, 0x78, 0x65, 0xFE, 0x26, 0xAA, 
+0x7A, 0x3F, 0xB3, 0x60, 0x5F, 0x11, 0xBC, 0xCE, 0x4C, 0x8D, 0x2B, 0x11, 0xDF, 0x74, 0x19, 0x6A, 
+0x34, 0x6C, 0x1E, 0x87, 0x4B, 0x96, 0xDE, 0x80, 0xD1, 0x04, 0x5A, 0xA4, 0xE6, 0xAE, 0x64, 0x6E, 
+0x30, 0x63, 0xBE, 0xBB, 0x0A, 0xA6, 0x37, 0x40, 0x28, 0xD1, 0x96, 0x2A, 0x86, 0x40, 0x2F, 0x2A, 
+0xE0, 0x12, 0x9E, 0xF0, 0x59, 0x52, 0x54, 0xBE, 0x19, 0xD7, 0x18, 0xB3, 0xC9, 0x19, 0x43, 0x16, 
+0x68, 0x21, 0xCD, 0xA0, 0x56, 0xC9, 0x28, 0x1B, 0x46, 0x07, 0xD5, 0x78, 0x7B, 0x39, 0xDC, 0x9E, 
+0x01, 0x37, 0x1F, 0x2E, 0xAD, 0x39, 0x5B, 0x9A, 0x6B, 0x6B, 0xF6, 0xCD, 0x63, 0xF6, 0x4B, 0x67, 
+0xB6, 0x57, 0x29, 0x67, 0x52, 0xC9, 0x94, 0xD5, 0xB6, 0xB4, 0x86, 0x3F, 0x93, 0x9B, 0xDA, 0xC4, 
+0x6B, 0x25, 0xD9, 0x91, 0x47, 0xD5, 0x0D, 0xA6, 0xDC, 0x57, 0x74, 0xFA, 0x98, 0x27, 0x3C, 0x45, 
+0x47, 0x3B, 0x4D, 0xCE, 0xE9, 0x75, 0xEC, 0x43, 0xCC, 0x10, 0x99, 0xD5, 0x1A, 0x80, 0xD1, 0x10, 
+0xB4, 0x06, 0xEE, 0x5B, 0x27, 0x10, 0x9E, 0xE3, 0x64, 0x0B, 0x7D, 0x5B, 0x4F, 0xC4, 0xC0, 0x51, 
+0x82, 0x52, 0xB9, 0xF4, 0x52, 0x1C, 0x66, 0xBA, 0x8A, 0x03, 0x36, 0x77, 0xFD, 0x84, 0xD7, 0x62, 
+0x19, 0xA9, 0xED, 0x6C, 0x0D, 0x9A, 0x88, 0x37, 0x15, 0xE4, 0x75, 0x11, 0xFC, 0x2A, 0x92, 0x6B, 
+0x7E, 0xE4, 0x40, 0xC5, 0x26, 0x62, 0x93, 0xA3, 0xC4, 0xCE, 0x1F, 0x44, 0xD6, 0xC0, 0xB1, 0x8A, 
+0xC0, 0xEE, 0xDB, 0x55, 0x10, 0x20, 0x6B, 0x6D, 0xA6, 0xEA, 0x58, 0xB4, 0x34, 0x13, 0x76, 0x39, 
+0x80, 0x68, 0x8A, 0x1F, 0xDA, 0xC2, 0x87, 0xD9, 0x73, 0x35, 0x3B, 0xAD, 0x05, 0x57, 0x92, 0x91, 
+0xE3, 0x4A, 0x5C, 0x42, 0xE7, 0x47, 0xFB, 0xBA, 0xA4, 0x31, 0x86, 0x83, 0xF5, 0x50, 0xE2, 0x01, 
+0x91, 0xCA, 0x19, 0x8F, 0xFC, 0x70, 0x8D, 0x98, 0x41, 0xFB, 0x0E, 0xB8, 0xD7, 0x7E, 0x83, 0x01, 
+0x56, 0x2A, 0xE9, 0x90, 0xB3, 0xDA, 0xF2, 0xF3, 0xE3, 0x93, 0x3B, 0xE9, 0xF1, 0x39, 0xC9, 0xDE, 
+0xD4, 0x4D, 0x20, 0x22, 0xE0, 0x7A, 0x94, 0x7D, 0x95, 0x0C, 0x84, 0x22, 0xA4, 0x0B, 0x51, 0x4C, 
+0x70, 0x51, 0x07, 0x4E, 0x1C, 0x12, 0x79, 0xA2, 0x90, 0xDC, 0x64, 0x88, 0x45, 0xB5, 0xDD, 0xCC, 
+0xE8, 0x5B, 0x1A, 0x6C, 0x29, 0xAA, 0xA6, 0x1A, 0x7D, 0xDA, 0x4E, 0xA3, 0x50, 0xA6, 0xEE, 0xC5, 
+0x8A, 0x38, 0x8F, 0x93, 0xBA, 0xDE, 0xEA, 0x11, 0x59, 0xCC, 0x15, 0xF5, 0xBB, 0x58, 0xDF, 0xE0, 
+0xD2, 0x45, 0x64, 0x74, 0x0B, 0xED, 0xAB, 0x09, 0x44, 0x68, 0xAB, 0x16, 0x49, 0x44, 0x94, 0xAF, 
+0xD2, 0x39, 0x1E, 0x8D, 0xC6, 0xF4, 0xBF, 0x1A, 0x84, 0xEF, 0xB4, 0xD4, 0x77, 0x4D, 0x36, 0x60, 
+0x71, 0x9C, 0x5E, 0x9C, 0x49, 0x69, 0x69, 0x5E, 0x6F, 0xC3, 0xC4, 0x81, 0xDA, 0x89, 0x87, 0x22, 
+0x51, 0x8E, 0xB3, 0x08, 0x6C, 0x11, 0x13, 0xFD, 0x8D, 0xDC, 0x0B, 0x83, 0xA5, 0x08, 0xF4, 0x94, 
+0x56, 0x8F, 0x42, 0xC9, 0x9D, 0xE3, 0xC1, 0x40, 0x7E, 0xD7, 0xC6, 0x90, 0xF9, 0x84, 0x21, 0xBE, 
+0xF1, 0x57, 0xB8, 0x10, 0xA6, 0x41, 0x46, 0xF4, 0xEA, 0xD3, 0x87, 0x69, 0x0D, 0x89, 0x98, 0xBC, 
+0x46, 0xE8, 0xC1, 0x23, 0xF4, 0xE4, 0x5B, 0xB3, 0x48, 0x9B, 0x51, 0x9D, 0x46, 0xD8, 0x4E, 0x2A, 
+0xBB, 0x88, 0x65, 0x45, 0xC4, 0xE8, 0x1C, 0xAF, 0xEA, 0x2C, 0xBC, 0xBA, 0x3E, 0x79, 0x7B, 0xCD, 
+0xAE, 0x4F, 0xAE, 0x7E, 0xDF, 0xCE, 0xA1, 0x55, 0x27, 0xE7, 0x5C, 0x10, 0xFC, 0x69, 0xA9, 0xFF, 
+0x4A, 0x92, 0x90, 0x56, 0x09, 0x46, 0xB0, 0x36, 0xB5, 0x54, 0x59, 0x9E, 0x94, 0x64, 0x7A, 0x05, 
+0x8C, 0xE8, 0xFB, 0xCB, 0xC6, 0xE1, 0xB6, 0x10, 0x27, 0x4F, 0xC6, 0xEC, 0x2D, 0x4F, 0xC0, 0xA0, 
+0x4C, 0xDA, 0x08, 0x11, 0xD1, 0x72, 0x2B, 0xED, 0x28, 0x87, 0xA0, 0x64, 0x6A, 0xE8, 0x1C, 0x87, 
+0x38, 0x9D, 0x78, 0x9B, 0x6C, 0x17, 0x40, 0xAB, 0xC4, 0xB4, 0x4B, 0x81, 0x50, 0x9C, 0x66, 0xE9, 
+0x40, 0x60, 0x25, 0x3E, 0x2D, 0x1C, 0x4C, 0xF2, 0x4C, 0x60, 0x39, 0x4C, 0xAA, 0x44, 0xD0, 0x4A, 
+0xC7, 0xEF, 0x4C, 0x21, 0x34, 0x65, 0x38, 0xCF, 0x77, 0x45, 0x18, 0x5D, 0xC6, 0xD4, 0xC5, 0x79, 
+0x11, 0xA5, 0x25, 0x6D, 0x27, 0x25, 0x85, 0x82, 0x84, 0x6C, 0xE7, 0xF8, 0xED, 0xC9, 0xAB, 0xB1, 
+0xB2, 0xD7, 0xE8, 0x4D, 0xEC, 0x2E, 0xB5, 0x6C, 0x0B, 0x3C, 0x4F, 0xA1, 0x6D, 0x30, 0x5D, 0x2D, 
+0xB3, 0x81, 0x7E, 0xF7, 0xE6, 0xFA, 0xE2, 0xD5, 0x79, 0x05, 0xFA, 0x2A, 0x42, 0x3E, 0xFD, 0x39, 
+0x3A, 0x78, 0xF3, 0xF2, 0xDD, 0x0F, 0x17, 0xAF, 0x2B, 0x1D, 0x08, 0x6E, 0xB1, 0x7D, 0x07, 0x99, 
+0xDC, 0xA0, 0xB8, 0x45, 0xC7, 0xD2, 0x28, 0xEF, 0xE5, 0x16, 0x57, 0x19, 0x39, 0x81, 0xFC, 0xAC, 
+0x48, 0xA0, 0x3B, 0xE8, 0x1C, 0xDF, 0xEE, 0x0D, 0x47, 0xEA, 0xF7, 0xA8, 0x7D, 0x89, 0xF5, 0x90, 
+0x15, 0x0D, 0xA7, 0xB1, 0x17, 0xA5, 0x05, 0xEC, 0xDD, 0xDD, 0x2C, 0xE3, 0x41, 0x9C, 0xB2, 0x67, 
+0x57, 0xE4, 0x8A, 0xE6, 0x71, 0x71, 0xFE, 0x07, 0x2C, 0x13, 0x52, 0xC0, 0xCA, 0xD1, 0x7A, 0xD8, 
+0x9E, 0xE8, 0xC4, 0x2B, 0x57, 0x62, 0x99, 0x85, 0xD3, 0x15, 0x0A, 0xE6, 0xE1, 0x6F, 0x2B, 0x1E, 
+0xAF, 0x85, 0x15, 0x14, 0xC6, 0x27, 0xBE, 0xEF, 0x74, 0xB5, 0x52, 0x12, 0x59, 0x19, 0x82, 0x6E, 
+0x0F, 0xB3, 0x2D, 0xCF, 0xDD, 0xE9, 0x8D, 0x33, 0x61, 0x47, 0xC7, 0x6C, 0x32, 0x24, 0xF4, 0xA1, 
+0xB7, 0x7D, 0x08, 0x72, 0x32, 0xBC, 0xE5, 0x4E, 0x57, 0x38, 0x9B, 0xBB, 0xBD, 0x4A, 0x51, 0x40, 
+0xB0, 0xDB, 0x18, 0x3A, 0xF3, 0x8F, 0x8A, 0x6E, 0x17, 0x3C, 0x3D, 0xF7, 0x39, 0xFE, 0xF8, 0xFD, 
+0xFA, 0x62, 0xE6, 0x74, 0xB3, 0x5C, 0x84, 0x2E, 0xFB, 0x86, 0x65, 0x43, 0xD6, 0xC1, 0x78, 0x73, 
+0x07, 0x1A, 0xF4, 0x10, 0x90, 0xD2, 0x37, 0xE8, 0xE4, 0x45, 0xC7, 0xFA, 0x07, 0xAD, 0xE7, 0x5B, 
+0xD8, 0xCB, 0xCA, 0x2C, 0xA7, 0x38, 0xCB, 0xE9, 0xB6, 0xB3, 0xC4, 0xA4, 0x83, 0x9A, 0x59, 0xA2, 
+0xA9, 0x5E, 0x3B, 0x43, 0x78, 0xD1, 0xC3, 0xB7, 0xCD, 0x33, 0x54, 0x93, 0xD1, 0x76, 0xB3, 0x32, 
+0x38, 0xB0, 0xE0, 0x8D, 0xA4, 0xA1, 0xC4, 0x2F, 0x96, 0xE1, 0xAC, 0x42, 0x18, 0x72, 0x22, 0xC2, 
+0xC5, 0xDC, 0x34, 0x17, 0x91, 0x70, 0x52, 0xAA, 0x64, 0x23, 0x3E, 0x35, 0x21, 0x5A, 0x09, 0xAB, 
+0x7C, 0x02, 0x3D, 0xB5, 0xE8, 0x40, 0x6A, 0x12, 0x5B, 0x2E, 0xA7, 0xDE, 0x0B, 0xAC, 0x06, 0xE2, 
+0x87, 0x1D, 0x1D, 0x1D, 0xB1, 0x2C, 0xC6, 0x64, 0xA8, 0xF8, 0x63, 0x47, 0x90, 0x16, 0xDC, 0x82, 
+0xA1, 0xB4, 0x22, 0xDA, 0x7A, 0x90, 0x45, 0xC4, 0xA7, 0x35, 0xBC, 0x0D, 0xE3, 0x60, 0x33, 0x3E, 
+0x68, 0xE0, 0x59, 0x74, 0xEB, 0xB3, 0x8D, 0x7C, 0x4B, 0x80, 0x1B, 0x0B, 0xB1, 0xBF, 0x0C, 0x17, 
+0x39, 0x95, 0x33, 0x07, 0x53, 0x1A, 0x76, 0x31, 0x01, 0xA1, 0x67, 0xA3, 0x78, 0x68, 0xFF, 0x0A, 
+0x56, 0xD2, 0x48, 0xEE, 0xDB, 0x50, 0x3B, 0x65, 0x73, 0x1D, 0xEE, 0xB4, 0xC6, 0x61, 0x96, 0x91, 
+0xA1, 0x4D, 0x38, 0x0D, 0x17, 0x0B, 0xBF, 0xA0, 0x3B, 0x0C, 0x49, 0x17, 0x44, 0xE6, 0xF9, 0x5B, 
+0x77, 0x80, 0x41, 0xF0, 0xB6, 0x1D, 0x88, 0xB6, 0x6D, 0xB8, 0x64, 0xB9, 0xB7, 0x6A, 0x2A, 0xC6, 
+0x5F, 0x64, 0x52, 0xD5, 0x8C, 0x82, 0x6D, 0xA7, 0x56, 0x62, 0xA8, 0xCC, 0x29, 0x37, 0x61, 0x73, 
+0x0E, 0x24, 0x81, 0xF4, 0x82, 0x69, 0x38, 0x8E, 0x99, 0xA3, 0xFA, 0x3C, 0xA5, 0x8A, 0xAC, 0xD8, 
+0x04, 0xE3, 0x8F, 0x7C, 0x06, 0xB4, 0x21, 0x9C, 0x2F, 0x79, 0x1B, 0x37, 0x59, 0x07, 0xD3, 0x82, 
+0xD4, 0x4A, 0x60, 0x4B, 0x64, 0x86, 0x23, 0xD1, 0x01, 0xF6, 0x98, 0xF0, 0xE9, 0x1C, 0x22, 0x45, 
+0x5F, 0x06, 0xFE, 0x5A, 0x40, 0x40, 0x8D, 0x9D, 0xDB, 0x17, 0x88, 0x2A, 0x51, 0x55, 0xB6, 0x9D, 
+0x20, 0x62, 0xD0, 0x85, 0x61, 0x94, 0x2E, 0xBA, 0x03, 0x04, 0x2C, 0xA7, 0xBB, 0xEB, 0x46, 0xDE, 
+0x2E, 0xE6, 0x18, 0xEC, 0x9A, 0x96, 0xBE, 0xF8, 0x14, 0x9B, 0xE4, 0xDF, 0x02, 0x9C, 0xE1, 0xAF, 
+0x49, 0x18, 0x38, 0xD6, 0xE6, 0xC5, 0x59, 0xA1, 0xA3, 0xFA, 0xB5, 0xCC, 0xD3, 0x34, 0x4C, 0x5D, 
+0x57, 0xB9, 0x07, 0x60, 0xE2, 0xCA, 0x9D, 0x83, 0x92, 0xE3, 0x73, 0x37, 0xAE, 0xBE, 0x06, 0x4B, 
+0x0E, 0x56, 0x3F, 0xEF, 0x7C, 0x38, 0xF7, 0xE2, 0x24, 0x3D, 0xC5, 0x3A, 0x66, 0xBD, 0x62, 0x48, 
+0x92, 0xB1, 0xD3, 0x63, 0x73, 0xDB, 0xC3, 0xAA, 0xF9, 0x81, 0xCB, 0x73, 0x12, 0xC7, 0xEE, 0x7A, 
+0xE8, 0x25, 0xF4, 0xAF, 0x83, 0x18, 0xE9, 0xB1, 0xAF, 0xBF, 0x16, 0x19, 0x1A, 0x3E, 0x0F, 0x16, 
+0xE9, 0x0D, 0x3B, 0x66, 0x23, 0xA3, 0x08, 0x20, 0x92, 0xC1, 0x76, 0x99, 0xB4, 0xF1, 0x51, 0xDA, 
+0x7C, 0xB4, 0x9A, 0xC2, 0x02, 0x8B, 0xA8, 0xEB, 0x2B, 0xF8, 0x9B, 0xC6, 0x1C, 0xCC, 0x1F, 0x89, 
+0x42, 0xA7, 0x0B, 0x6F, 0x8D, 0x1C, 0x36, 0xCF, 0xB7, 0xBF, 0x15, 0x1B, 0x03, 0xF5, 0x08, 0x00, 
+0xD3, 0xCD, 0x2B, 0x95, 0x75, 0xEB, 0x3F, 0x42, 0x4F, 0x8F, 0x2C, 0xBC, 0x09, 0x9F, 0xF9, 0x87, 
+0x75, 0x83, 0x94, 0xB8, 0x73, 0x23, 0x0C, 0x92, 0x08, 0x8C, 0x02, 0x08, 0xDB, 0xA8, 0x36, 0x86, 
+0x17, 0x76, 0xE9, 0x93, 0xA3, 0x61, 0x99, 0x2C, 0x1E, 0x86, 0x06, 0xF8, 0x70, 0x48, 0xCA, 0x35, 
+0xCD, 0x89, 0xBC, 0x5F, 0x88, 0x08, 0xE1, 0xFE, 0xEB, 0x36, 0x7D, 0x43, 0x66, 0x2B, 0xB6, 0x47, 
+0x27, 0x54, 0x63, 0x6B, 0xE9, 0xFB, 0xC5, 0xF6, 0x68, 0x2A, 0xD7, 0xB4, 0xD7, 0xF1, 0xDB, 0x7D, 
+0x1D, 0x6A, 0xB9, 0x3E, 0xB0, 0xB9, 0xA6, 0x68, 0x64, 0xCF, 0x86, 0x16, 0x10, 0x66, 0xAC, 0x03, 
+0x60, 0x13, 0x72, 0x2B, 0x4F, 0x2A, 0x3C, 0x0B, 0xEC, 0xC3, 0xD2, 0xC9, 0x81, 0x0D, 0x26, 0x52, 
+0x00, 0x89, 0xF2, 0x9E, 0x85, 0x91, 0x84, 0x30, 0x5D, 0x1E, 0xC7, 0x61, 0xEC, 0x74, 0x5E, 0x00, 
+0xEF, 0x06, 0x30, 0x69, 0x28, 0x79, 0x13, 0x82, 0xA7, 0x69, 0x74, 0xFA, 0x8C, 0xDB, 0xB9, 0xC3, 
+0x27, 0x71, 0x05, 0x54, 0x82, 0x6D, 0x9B, 0x6C, 0x5A, 0xC2, 0x6E, 0xE7, 0x1C, 0xC7, 0x09, 0x23, 
+0x12, 0x19, 0x22, 0xB4, 0x05, 0x3B, 0x16, 0xBC, 0x96, 0x96, 0xBD, 0x63, 0xF0, 0x61, 0x34, 0x7C, 
+0x5A, 0xD0, 0x40, 0x07, 0x69, 0xA0, 0xD3, 0xB4, 0x20, 0x36, 0xF5, 0x85, 0x12, 0x7C, 0xAE, 0x40, 
+0xBF, 0x02, 0x15, 0xBC, 0x51, 0x5B, 0xC7, 0xC6, 0xD0, 0xF6, 0x93, 0xB5, 0x75, 0xD4, 0x8A, 0x51, 
+0x71, 0xAC, 0xA0, 0x1C, 0x06, 0xF4, 0x3D, 0x39, 0x6B, 0x92, 0xBF, 0xB2, 0x16, 0x8F, 0x56, 0x4B, 
+0x46, 0xEC, 0xC9, 0xDF, 0x46, 0xC1, 0x57, 0xB5, 0x83, 0x4C, 0x37, 0x35, 0x91, 0x5E, 0x4B, 0x5C, 
+0xFC, 0x3C, 0xFA, 0xE5, 0x73, 0xA8, 0xCA, 0x00, 0x13, 0x41, 0x6E, 0xAB, 0x2C, 0x5B, 0x39, 0x6D, 
+0xDB, 0xD1, 0xEF, 0x7D, 0xCE, 0xD1, 0x0B, 0x5A, 0xFB, 0x44, 0x45, 0x9F, 0x1C, 0x82, 0x3B, 0x3A, 
+0xA9, 0x5F, 0xBC, 0x01, 0x32, 0xBF, 0xF3, 0x82, 0x59, 0x78, 0x37, 0xF4, 0xC3, 0x29, 0x05, 0x02, 
+0x87, 0x59, 0xF6, 0x0D, 0x2D, 0x65, 0x07, 0x1F, 0xFB, 0xF8, 0xA8, 0xC3, 0xBE, 0x63, 0x1D, 0xD7, 
+0x07, 0xBC, 0xE0, 0x71, 0x22, 0xBE, 0xE6, 0xF4, 0x85, 0xDF, 0x61, 0x63, 0x2B, 0x84, 0x43, 0xDD, 
+0xD0, 0x80, 0xD6, 0x59, 0x66, 0x58, 0x02, 0x68, 0xE3, 0x9A, 0x86, 0xB8, 0x5C, 0xCB, 0x57, 0x47, 
+0x58, 0x0B, 0x41, 0x02, 0x18, 0xB3, 0x8E, 0xCC, 0x58, 0x1B, 0x0E, 0x87, 0xC0, 0x27, 0x31, 0xFB, 
+0x09, 0x9D, 0x39, 0x74, 0x0C, 0xAE, 0x03, 0x0F, 0xBC, 0x68, 0x0C, 0x93, 0xE8, 0xB3, 0x44, 0x1E, 
+0x8D, 0xE9, 0xBC, 0x0B, 0x3E, 0x04, 0xE1, 0x5D, 0x00, 0xAF, 0xA6, 0xD9, 0x29, 0xA0, 0x3C, 0xA7, 
+0xA6, 0xCF, 0xB2, 0xA4, 0x14, 0x78, 0x68, 0x4A, 0x44, 0xE9, 0x83, 0xC2, 0x88, 0x47, 0x09, 0xC7, 
+0xC4, 0xEA, 0x01, 0x7A, 0x02, 0x4B, 0x3C, 0x17, 0xBF, 0xB1, 0xCD, 0xA1, 0x36, 0x5E, 0x99, 0x02, 
+0xF1, 0xFD, 0x0A, 0x44, 0xCA, 0x05, 0x4A, 0x87, 0x60, 0x85, 0x75, 0x46, 0x0D, 0x75, 0x4E, 0x60, 
+0xEA, 0xE7, 0x67, 0x32, 0x58, 0x6D, 0x53, 0x78, 0xF3, 0xD0, 0xF8, 0x4B, 0x3E, 0xAB, 0xE8, 0xBB, 
+0x00, 0xE1, 0x87, 0xA2, 0x47, 0xE1, 0x36, 0x16, 0xD1, 0x75, 0x31, 0x6D, 0xE6, 0xC0, 0xEF, 0xE8, 
+0xF7, 0x67, 0x11, 0x3C, 0x8C, 0x52, 0x46, 0x39, 0x01, 0x3D, 0x83, 0x69, 0x26, 0xD2, 0x75, 0x8E, 
+0x64, 0x3B, 0xA7, 0x73, 0x4E, 0x8E, 0x8E, 0xB7, 0x3F, 0x7C, 0xCF, 0x6E, 0x5D, 0x7F, 0x05, 0x2A, 
+0xAF, 0x43, 0xC9, 0x64, 0xFB, 0x07, 0x07, 0xFD, 0x51, 0x7F, 0x6F, 0xFF, 0x59, 0xEF, 0x9F, 0x03, 
+0xD1, 0x84, 0x6A, 0xBF, 0xA1, 0xEC, 0x92, 0x07, 0xFE, 0x71, 0x4A, 0xB8, 0x20, 0x1D, 0x7A, 0xD1, 
+0xA9, 0xF8, 0x5E, 0x98, 0xF3, 0x05, 0xF5, 0x95, 0x2B, 0xE6, 0x3B, 0x66, 0x43, 0x31, 0x45, 0x4D, 
+0x99, 0x5A, 0x0E, 0x93, 0xC8, 0xF7, 0x40, 0x47, 0xE9, 0x03, 0xA1, 0x2F, 0xDD, 0xC8, 0x49, 0x90, 
+0x05, 0x45, 0x78, 0x35, 0xCA, 0x05, 0xA8, 0x2E, 0xC9, 0x30, 0x8D, 0xBD, 0xA5, 0xD3, 0xEB, 0x55, 
+0xBD, 0x3C, 0x04, 0x25, 0x53, 0x2A, 0xBF, 0x00, 0x92, 0x7D, 0xCC, 0xFE, 0xFC, 0x67, 0x01, 0x7B, 
+0x98, 0x84, 0x4B, 0xEE, 0x78, 0xA0, 0xD6, 0xBD, 0xEE, 0x99, 0x78, 0x91, 0xEB, 0xF3, 0x18, 0xB0, 
+0x70, 0x11, 0xC0, 0xEC, 0xBD, 0x19, 0x7A, 0xAB, 0x97, 0x6E, 0x3A, 0x64, 0xEF, 0x60, 0xEB, 0xC7, 
+0xFD, 0x45, 0x7F, 0xD2, 0x31, 0x6C, 0xD6, 0x6C, 0x3E, 0x76, 0x51, 0x65, 0x98, 0xE9, 0xCF, 0x04, 
+0xEE, 0x17, 0xC4, 0x3C, 0x8E, 0xEB, 0x70, 0x5B, 0x9B, 0x04, 0xA6, 0x19, 0xC3, 0x6E, 0x1C, 0xA1, 
+0x0E, 0xBD, 0xC8, 0x7E, 0x98, 0xE0, 0x0F, 0x36, 0xE9, 0x6E, 0xB0, 0x5C, 0xF8, 0x6C, 0x37, 0x9C, 
+0xCF, 0xC1, 0xD0, 0xFB, 0xC8, 0x96, 0x3C, 0xBD, 0x09, 0x67, 0x63, 0xD6, 0x7D, 0x73, 0x79, 0x75, 
+0xDD, 0xDD, 0x5E, 0xD9, 0x04, 0x8A, 0x7C, 0x47, 0xB9, 0x56, 0xE8, 0x24, 0x43, 0x62, 0x44, 0x83, 
+0x80, 0x39, 0x09, 0x68, 0x38, 0x40, 0xA0, 0xB0, 0xFC, 0xD0, 0x51, 0xAF, 0x71, 0x5C, 0xEF, 0xB3, 
+0x71, 0x7D, 0x17, 0x1F, 0x7D, 0xF5, 0x31, 0xDE, 0x7C, 0xBD, 0x80, 0x7F, 0x16, 0x9B, 0xAF, 0x27, 
+0xF0, 0xCF, 0x64, 0xF3, 0xDE, 0xA2, 0xA9, 0xA2, 0xD0, 0xC7, 0x4C, 0xC7, 0x6B, 0x8C, 0xE1, 0x5F, 
+0x06, 0xDB, 0xCC, 0x3E, 0x68, 0x3D, 0xF9, 0x1D, 0x43, 0xAF, 0x6F, 0xF9, 0x1C, 0xAC, 0xB9, 0x1B, 
+0xF6, 0xC6, 0x5D, 0x70, 0xDC, 0x0A, 0x54, 0x3E, 0x5A, 0xA4, 0x9C, 0x55, 0x9A, 0x97, 0x39, 0x62, 
+0xCC, 0x51, 0xAF, 0x2A, 0x1B, 0x81, 0xB5, 0xEA, 0xA3, 0x24, 0x4E, 0xC9, 0x3B, 0xD0, 0xCB, 0xC8, 
+0x84, 0x0A, 0x09, 0xCC, 0x8B, 0x7D, 0x53, 0x51, 0x19, 0x6D, 0x6C, 0xFF, 0x85, 0x64, 0x31, 0x89, 
+0x8D, 0xF5, 0x80, 0x6A, 0xEC, 0x83, 0xB0, 0x11, 0x29, 0x73, 0x8E, 0xD9, 0xA5, 0x43, 0x15, 0x1C, 
+0xEA, 0x1C, 0x3A, 0x32, 0x33, 0x15, 0xF6, 0x2E, 0x31, 0x12, 0x93, 0x37, 0x17, 0x79, 0x7A, 0x13, 
+0x8C, 0x8C, 0xEF, 0xD7, 0xC1, 0x21, 0xBE, 0xDE, 0x04, 0x48, 0x32, 0xFF, 0x3A, 0x38, 0xE9, 0x9F, 
+0x9A, 0x80, 0x64, 0xD2, 0xC2, 0x0C, 0xA5, 0xCC, 0x87, 0xBE, 0xC0, 0xC1, 0x67, 0xFC, 0x2E, 0x5B, 
+0xBD, 0x2C, 0x23, 0x16, 0x93, 0xE6, 0x62, 0xFE, 0xDB, 0xCA, 0x8B, 0xF9, 0xAC, 0xD3, 0x3B, 0xFC, 
+0xBC, 0x3E, 0x09, 0x21, 0x3C, 0x90, 0xB6, 0xCD, 0x86, 0x94, 0x46, 0xEF, 0x7D, 0x63, 0x1B, 0x71, 
+0xDA, 0x0A, 0x04, 0xE8, 0x47, 0x3A, 0x30, 0x8D, 0xEA, 0xE0, 0xE0, 0x7A, 0x1D, 0xF1, 0x2E, 0x7C, 
+0x86, 0x04, 0xE2, 0x09, 0x3A, 0xDE, 0x45, 0x57, 0x06, 0x6C, 0x19, 0x33, 0x10, 0x3C, 0xB3, 0x3C, 
+0x66, 0xFF, 0xE5, 0xEA, 0xF2, 0x35, 0x28, 0xF9, 0x31, 0x08, 0x6D, 0x6F, 0xBE, 0x76, 0xEC, 0x86, 
+0xBB, 0x26, 0xCC, 0xF1, 0x97, 0xBE, 0xB5, 0x69, 0xA1, 0x0F, 0xE0, 0x4F, 0xF6, 0x76, 0xB9, 0xCC, 
+0xA7, 0x1F, 0xEC, 0xED, 0x0A, 0x3D, 0x20, 0xFD, 0xD3, 0x8E, 0xD9, 0xFC, 0xDE, 0x69, 0x63, 0x91, 
+0x8B, 0x75, 0xF9, 0xB5, 0x95, 0xB7, 0x07, 0x48, 0xE4, 0x57, 0x79, 0x25, 0x8C, 0x50, 0x92, 0x65, 
+0x8D, 0x8A, 0xAE, 0x95, 0x85, 0x4B, 0xE9, 0x24, 0xB7, 0xA6, 0xE4, 0xB8, 0xB3, 0x21, 0x30, 0xA2, 
+0x49, 0x18, 0x52, 0x7C, 0x75, 0xE9, 0xAE, 0xD9, 0x84, 0xE7, 0x94, 0x45, 0xF1, 0xD6, 0x9C, 0xE4, 
+0xA6, 0x37, 0x68, 0x8F, 0x81, 0x11, 0x57, 0xE3, 0xF9, 0xD8, 0xB2, 0xCF, 0xDA, 0x0E, 0x77, 0xB3, 
+0xD4, 0xE1, 0xC6, 0x9E, 0x89, 0x78, 0xC5, 0x69, 0x66, 0xC0, 0x94, 0xC2, 0x5B, 0xB7, 0x93, 0x42, 
+0x72, 0xB0, 0x64, 0xB7, 0x0A, 0xA6, 0xF8, 0xEB, 0x70, 0x09, 0x18, 0x05, 0xFE, 0xDC, 0xC8, 0xD3, 
+0xDB, 0xB0, 0xDE, 0xD3, 0x70, 0xB9, 0x64, 0x0A, 0xF4, 0x56, 0x2C, 0x57, 0x32, 0x29, 0x11, 0x59, 
+0xAE, 0x61, 0x30, 0xA5, 0x80, 0xB3, 0xAA, 0xC6, 0x4B, 0x10, 0xE9, 0x3D, 0x7C, 0x2F, 0xDE, 0xE2, 
+0xD7, 0xB4, 0x2D, 0xEF, 0x41, 0x43, 0xDA, 0x9F, 0x55, 0x1B, 0x83, 0xB5, 0xFE, 0x7D, 0x78, 0xDF, 
+0xC6, 0x57, 0xA0, 0x7E, 0xAB, 0xCA, 0x89, 0xEC, 0x8C, 0x2A, 0x46, 0xD1, 0x7F, 0xF0, 0xC3, 0x89, 
+0xEB, 0x27, 0xA5, 0x3E, 0x02, 0x18, 0x43, 0xE3, 0xB4, 0xF4, 0x93, 0xA8, 0xD5, 0x81, 0x22, 0x10, 
+0x9A, 0x58, 0x0E, 0xAD, 0x66, 0x6E, 0xA8, 0x67, 0x43, 0x3B, 0x3C, 0xD3, 0x80, 0x9D, 0xFE, 0xFC, 
+0x4B, 0xE5, 0xD5, 0x4B, 0x2F, 0xF8, 0x90, 0xBD, 0xDA, 0xD1, 0x64, 0x35, 0x66, 0x1D, 0x31, 0xD1, 
+0x43, 0xD5, 0x1D, 0x10, 0xD3, 0xEB, 0xAA, 0xB0, 0x13, 0x03, 0xA2, 0x34, 0xA1, 0x02, 0xF7, 0xA0, 
+0xCB, 0x60, 0x5A, 0x23, 0x3E, 0x3C, 0x34, 0x35, 0x17, 0xA9, 0x71, 0xE5, 0xF6, 0x3F, 0xD2, 0x53, 
+0xFD, 0x83, 0x62, 0xCE, 0x59, 0x17, 0xC5, 0x13, 0x6B, 0x2F, 0x45, 0x93, 0xBC, 0xA3, 0xF2, 0x57, 
+0xE5, 0xBE, 0x0A, 0xC2, 0x94, 0x7A, 0x08, 0xD8, 0x8B, 0xE7, 0x58, 0x88, 0xEB, 0x25, 0xA5, 0x4A, 
+0xF0, 0xD8, 0xE9, 0x0A, 0x0C, 0x80, 0xCC, 0x10, 0x3F, 0xF4, 0x34, 0x53, 0xED, 0x8C, 0xFB, 0xB0, 
+0xCF, 0xE5, 0x85, 0x82, 0xB2, 0x05, 0x6A, 0x3C, 0x3C, 0x48, 0x30, 0x7B, 0x57, 0x84, 0x78, 0x51, 
+0xA4, 0xCD, 0x60, 0xB7, 0xE7, 0x1F, 0xC2, 0x40, 0x90, 0x03, 0xC0, 0x2B, 0x47, 0x7C, 0xD2, 0xC7, 
+0xFA, 0x22, 0xAA, 0xA7, 0x20, 0xC7, 0x3F, 0x30, 0x7B, 0x37, 0xE2, 0x27, 0x69, 0x1A, 0x3B, 0x24, 
+0x59, 0xCB, 0x0B, 0x21, 0x85, 0xE8, 0x15, 0x49, 0x11, 0xD9, 0xA4, 0xB2, 0x4B, 0x41, 0xA9, 0xA2, 
+0xA3, 0x05, 0xCE, 0xEE, 0xD7, 0xBB, 0x8B, 0x3E, 0xEB, 0x7E, 0xED, 0x2E, 0xA3, 0xC3, 0x6E, 0x5D, 
+0xBB, 0x8E, 0x68, 0xF7, 0xDB, 0x2A, 0x4C, 0xEB, 0x1B, 0x76, 0x45, 0xC3, 0x2F, 0x1F, 0x7F, 0x5B, 
+0xDF, 0xEE, 0xB9, 0x68, 0xE7, 0x37, 0x80, 0x3B, 0x16, 0xCD, 0x16, 0xD8, 0xCC, 0x18, 0x22, 0x29, 
+0x21, 0xE6, 0xC7, 0x74, 0xE9, 0xFF, 0x55, 0x11, 0xF3, 0xB9, 0xE6, 0x21, 0xDD, 0x0C, 0x68, 0x89, 
+0x47, 0xAB, 0xE4, 0x06, 0x04, 0x04, 0x55, 0x3C, 0x12, 0x1A, 0x38, 0x9E, 0x9F, 0xA5, 0xA8, 0x03, 
+0x25, 0x85, 0x27, 0xE1, 0xF4, 0x03, 0x27, 0x22, 0x0A, 0x23, 0x1E, 0xF4, 0x59, 0x14, 0xFA, 0xE8, 
+0x1E, 0x0D, 0xE1, 0x5D, 0x7C, 0xE7, 0x25, 0xBC, 0x36, 0x34, 0x94, 0xC9, 0x8E, 0x12, 0x76, 0x1E, 
+0xA2, 0x3C, 0x09, 0x89, 0x6C, 0x8F, 0xE6, 0x80, 0xFC, 0x73, 0x5B, 0xC9, 0xF7, 0x18, 0xCF, 0x3E, 
+0xC4, 0x72, 0x64, 0xF8, 0x95, 0x51, 0x07, 0x60, 0xF4, 0x6A, 0x48, 0xEE, 0x6B, 0xB0, 0xE1, 0xF4, 
+0x38, 0x49, 0xFE, 0xAA, 0xD7, 0x93, 0xE0, 0x28, 0xFE, 0x95, 0x3F, 0xEE, 0x93, 0x27, 0xA2, 0xF7, 
+0x00, 0x1F, 0xF4, 0x9D, 0x1B, 0x07, 0x4E, 0x47, 0x0C, 0x8E, 0xBD, 0x20, 0xFF, 0x33, 0x09, 0x36, 
+0x8B, 0xEF, 0xB9, 0x98, 0x3E, 0xA2, 0xA7, 0x3E, 0x94, 0x5B, 0x2A, 0x1D, 0x63, 0x0B, 0x30, 0xE0, 
+0xD4, 0xB1, 0x45, 0xAF, 0x26, 0x94, 0x83, 0xEF, 0x87, 0x94, 0x38, 0x7C, 0x0D, 0xD2, 0x00, 0x7D, 
+0xC3, 0x97, 0x2F, 0x5E, 0xBC, 0xBC, 0x78, 0x7D, 0xDE, 0x39, 0xAC, 0xFF, 0xC6, 0xEE, 0xA8, 0x34, 
+0x7F, 0xD8, 0xCE, 0xB7, 0x8C, 0xA1, 0x71, 0x74, 0x07, 0x25, 0xCC, 0xA1, 0x48, 0xDA, 0xD9, 0xE5, 
+0x2B, 0xA9, 0x10, 0xF5, 0xB0, 0xC2, 0x38, 0x6D, 0x0A, 0xA2, 0xE5, 0x49, 0x78, 0xDF, 0x67, 0xA0, 
+0x09, 0x89, 0x28, 0x03, 0x9D, 0x6E, 0xF8, 0xC0, 0x79, 0x24, 0x0E, 0x3F, 0xB8, 0x80, 0xC5, 0xFD, 
+0xD1, 0xC8, 0x24, 0x84, 0xF2, 0x15, 0xA6, 0x5E, 0xFA, 0x19, 0x4C, 0x53, 0xBC, 0xD3, 0xF2, 0xAA, 
+0x88, 0xE4, 0x09, 0x0D, 0x40, 0x0B, 0xE3, 0xC9, 0x47, 0x6A, 0x0C, 0xAF, 0xDA, 0xAA, 0xCE, 0x93, 
+0x41, 0xC3, 0xCA, 0x9D, 0xC2, 0x14, 0x5B, 0x3A, 0xB6, 0x6E, 0x30, 0xEE, 0x6F, 0x1F, 0x79, 0xE2, 
+0x7E, 0xFB, 0xB8, 0x1B, 0xB4, 0xD5, 0x03, 0x16, 0x0E, 0x1E, 0x3B, 0x0B, 0xE7, 0x22, 0xE6, 0x45, 
+0x0A, 0x35, 0x71, 0x45, 0xD0, 0xA7, 0xBF, 0xA3, 0x67, 0x15, 0x53, 0xC4, 0x1C, 0xF8, 0x91, 0x28, 
+0x51, 0x23, 0x44, 0xDC, 0x2F, 0xA3, 0xA5, 0x57, 0x29, 0xFC, 0x84, 0xB7, 0xBB, 0xC9, 0x4F, 0xE9, 
+0xF6, 0x27, 0x52, 0x52, 0x8A, 0xD8, 0x26, 0xAC, 0xF8, 0x83, 0x16, 0x40, 0xBE, 0x07, 0xCB, 0x08, 
+0xF8, 0xE1, 0x75, 0x18, 0x61, 0x58, 0x51, 0x7D, 0x54, 0x15, 0xF5, 0x36, 0xC2, 0x52, 0x39, 0x91, 
+0xD1, 0xA8, 0x47, 0x79, 0x2D, 0xB6, 0x99, 0xE3, 0xCD, 0xFA, 0x4C, 0xCA, 0x9B, 0xD6, 0x2B, 0x5C, 
+0xE2, 0x04, 0xDE, 0xCC, 0xC2, 0xEF, 0x00, 0x99, 0xB8, 0x76, 0xEA, 0xB6, 0x36, 0x58, 0xD3, 0x9B, 
+0x86, 0x90, 0x36, 0xEA, 0x74, 0x27, 0xAF, 0x30, 0xDD, 0x13, 0x43, 0x92, 0xA0, 0xE1, 0xEB, 0x58, 
+0x03, 0x49, 0x12, 0xBB, 0x4B, 0x09, 0xFE, 0x95, 0x9B, 0xDE, 0x0C, 0xE9, 0x6C, 0x9D, 0x60, 0x9D, 
+0x60, 0xDC, 0x46, 0xFF, 0x02, 0xF6, 0x05, 0xDF, 0xDD, 0x1B, 0xED, 0x3F, 0xE9, 0x81, 0x26, 0xDF, 
+0xF9, 0xD0, 0xA9, 0xF8, 0x11, 0x8B, 0xA6, 0xA4, 0x10, 0x59, 0xB1, 0x10, 0x4D, 0x4B, 0x7D, 0x38, 
+0xA5, 0x4F, 0xD9, 0x80, 0xE9, 0xDD, 0xF6, 0xD8, 0x2E, 0x2B, 0x43, 0x7F, 0x24, 0x75, 0xA3, 0x8A, 
+0x14, 0xC9, 0x67, 0x81, 0xFD, 0xC0, 0x48, 0x7F, 0xC7, 0x1C, 0xB4, 0x3D, 0xB2, 0xE7, 0xF0, 0x84, 
+0x11, 0xCC, 0x4E, 0x79, 0xE3, 0x6A, 0xBF, 0xCA, 0xB5, 0x05, 0x33, 0x43, 0xE6, 0x98, 0xA2, 0xA6, 
+0x27, 0x40, 0x94, 0x3A, 0xD5, 0x5B, 0x8A, 0x7C, 0xD1, 0x6E, 0xBF, 0x82, 0x43, 0xF1, 0x62, 0x17, 
+0x6F, 0xA2, 0x23, 0x04, 0x26, 0x9D, 0x5A, 0x38, 0x22, 0x2D, 0x14, 0xE0, 0xD0, 0xC7, 0xE2, 0x37, 
+0x74, 0xCB, 0x76, 0x5E, 0xE3, 0x91, 0xD0, 0x5E, 0xF3, 0x62, 0x4B, 0xF7, 0xA2, 0x16, 0x34, 0xD0, 
+0x23, 0x18, 0xDA, 0xB2, 0x49, 0x13, 0xB4, 0x97, 0x87, 0x11, 0x94, 0x28, 0x06, 0xD3, 0x9A, 0x94, 
+0x4A, 0x3B, 0x66, 0xCD, 0x15, 0x67, 0x44, 0xF6, 0x85, 0xFA, 0x08, 0x87, 0xDE, 0xB1, 0x7C, 0x9A, 
+0xD9, 0xF4, 0xE2, 0x2B, 0xF9, 0x1B, 0x7E, 0x90, 0xC5, 0x22, 0x2C, 0xDF, 0x49, 0x67, 0x45, 0xF6, 
+0xA1, 0xFC, 0x95, 0x58, 0x21, 0x7E, 0x9D, 0x45, 0x2D, 0xC8, 0x3E, 0xFE, 0xDE, 0x05, 0x6D, 0x09, 
+0xC4, 0x4A, 0x14, 0x87, 0xB7, 0x74, 0x61, 0xA0, 0xD2, 0xDA, 0x0C, 0x3D, 0x73, 0x71, 0x64, 0xE0, 
+0xF3, 0xDF, 0x11, 0xB6, 0x29, 0xF8, 0x61, 0x19, 0x25, 0xA5, 0x6F, 0x67, 0x30, 0xF0, 0x67, 0x65, 
+0x66, 0x14, 0x7D, 0xB5, 0x7D, 0x88, 0x82, 0xEF, 0x4D, 0x1C, 0x4E, 0x70, 0x04, 0x67, 0xB0, 0x70, 
+0x43, 0xF8, 0x42, 0x5A, 0xFB, 0x18, 0x55, 0x41, 0xCD, 0xCF, 0xF5, 0xEF, 0xDC, 0x75, 0xC2, 0x84, 
+0xE9, 0x5F, 0xA6, 0x80, 0x37, 0x61, 0xB4, 0xF2, 0x85, 0x8B, 0x19, 0xDD, 0x5B, 0xE2, 0x00, 0x96, 
+0x13, 0x62, 0x72, 0x0F, 0xB0, 0x95, 0x20, 0x04, 0x35, 0x0E, 0x58, 0x51, 0x22, 0x42, 0xEA, 0xEE, 
+0x6D, 0xE8, 0x09, 0x65, 0xF3, 0x2E, 0x16, 0xA9, 0xE7, 0xF0, 0x26, 0xC6, 0x83, 0xC9, 0xF0, 0xB3, 
+0x29, 0x12, 0x02, 0xFA, 0xC1, 0xB9, 0xC6, 0xCE, 0x84, 0xC2, 0x20, 0x39, 0xDA, 0xA1, 0xC5, 0x07, 
+0x7A, 0xEE, 0xB7, 0xF3, 0x82, 0xDA, 0xFC, 0x9F, 0xCD, 0xDF, 0x17, 0x1E, 0x50, 0xAB, 0xEF, 0x93, 
+0xC7, 0xCD, 0x60, 0x72, 0xFF, 0xA7, 0xD9, 0xF3, 0xD9, 0x0C, 0xA0, 0xF0, 0x7D, 0x56, 0x43, 0x3B, 
+0x12, 0x13, 0xA0, 0xBE, 0x12, 0x16, 0x87, 0x80, 0x79, 0x8C, 0xBB, 0x28, 0xF3, 0x97, 0xC8, 0x12, 
+0x6E, 0x53, 0xE8, 0xCA, 0xB4, 0xCD, 0xAA, 0x70, 0x25, 0x86, 0x8C, 0x70, 0x0B, 0xBC, 0x48, 0x44, 
+0x56, 0x61, 0x9B, 0x77, 0x38, 0x02, 0x2E, 0xD0, 0x66, 0x84, 0x9D, 0x23, 0xAB, 0xC0, 0x6F, 0x15, 
+0xBA, 0x7C, 0x55, 0x05, 0x4E, 0xD8, 0x34, 0xC2, 0x2D, 0x70, 0x48, 0x28, 0xAF, 0xC2, 0xCC, 0x1A, 
+0x1C, 0x5A, 0x98, 0x77, 0x55, 0xB9, 0xEE, 0x83, 0x4A, 0xFC, 0x9A, 0x34, 0x62, 0x4B, 0xC6, 0x74, 
+0x10, 0x34, 0xAC, 0x6D, 0x93, 0xBE, 0x4E, 0xF8, 0x22, 0x30, 0x3D, 0x09, 0xAE, 0x7D, 0x20, 0xBB, 
+0xBC, 0x85, 0x07, 0x78, 0x40, 0xE3, 0xED, 0xE5, 0xE9, 0xF9, 0xD5, 0x15, 0xFB, 0xAF, 0xEF, 0xCE, 
+0xDF, 0x9D, 0xB3, 0xAB, 0xEB, 0x93, 0xEB, 0x77, 0x57, 0xCC, 0x79, 0x75, 0xF9, 0xFA, 0xE2, 0xFA, 
+0xF2, 0x2D, 0x16, 0x14, 0x1C, 0xEC, 0x18, 0x2D, 0xA4, 0xDF, 0x56, 0x1C, 0x90, 0x05, 0x78, 0x2D, 
+0x7E, 0x1B, 0xCA, 0x08, 0xA8, 0x5D, 0x36, 0xFF, 0x96, 0x71, 0x2A, 0xAD, 0xFD, 0xE1, 0x8E, 0x3D, 
+0x7E, 0x25, 0xCB, 0xEE, 0x89, 0xCA, 0xA3, 0xD0, 0xF9, 0xAD, 0x97, 0x78, 0x13, 0xBF, 0x1A, 0xD0, 
+0xC9, 0xD7, 0x44, 0x3F, 0xC5, 0x05, 0x0B, 0xF2, 0x5B, 0xC1, 0x16, 0xB1, 0xAE, 0xA4, 0x49, 0xB8, 
+0x29, 0x1F, 0xEB, 0xA7, 0xAB, 0xE8, 0x73, 0x45, 0x3A, 0x8A, 0x9A, 0x66, 0x36, 0x30, 0xC6, 0x3C, 
+0xBF, 0x62, 0x2A, 0xC5, 0xB9, 0x51, 0xD2, 0x14, 0x60, 0x32, 0xF2, 0x54, 0xA8, 0x4D, 0x9D, 0x83, 
+0xF6, 0x52, 0xD7, 0xB0, 0x92, 0x8B, 0xF1, 0x6C, 0x63, 0xD7, 0xA6, 0xE9, 0x65, 0x00, 0x71, 0xD5, 
+0x6C, 0x10, 0xD5, 0xE3, 0xAA, 0xDD, 0x9E, 0xCC, 0x06, 0x92, 0x27, 0x8D, 0xC4, 0xD6, 0x09, 0xC4, 
+0x96, 0xB1, 0x98, 0x89, 0x59, 0x27, 0x25, 0x63, 0xE0, 0xBD, 0x3C, 0x2B, 0x3B, 0x66, 0x5F, 0x7D, 
+0xCC, 0x50, 0xBA, 0x61, 0x0E, 0xFE, 0xC2, 0x7D, 0x37, 0x02, 0x31, 0xB1, 0x59, 0x26, 0xBD, 0xF7, 
+0xCD, 0x69, 0x46, 0x75, 0x34, 0x4C, 0x45, 0x38, 0x05, 0x05, 0x5B, 0xE9, 0xD6, 0xC7, 0x6C, 0x54, 
+0x1B, 0x7D, 0xC2, 0xCB, 0xFA, 0xED, 0xA9, 0xD5, 0x03, 0xED, 0xD6, 0x7A, 0x10, 0xF8, 0x6C, 0x18, 
+0x85, 0x77, 0x58, 0x08, 0x53, 0xEE, 0x11, 0x7C, 0x22, 0x72, 0xAF, 0x6A, 0x53, 0x04, 0x3F, 0xB2, 
+0xB8, 0xCF, 0x16, 0x7D, 0x36, 0x61, 0x9B, 0x6C, 0xB7, 0xE4, 0x5F, 0x9A, 0x69, 0x8E, 0x46, 0x2D, 
+0x57, 0xAA, 0xA8, 0x5B, 0x71, 0x2A, 0x93, 0xBF, 0xDE, 0xC7, 0x8B, 0x89, 0x83, 0xE1, 0xDB, 0x3E, 
+0x06, 0x6F, 0xFB, 0x18, 0xBA, 0x35, 0xE1, 0xB9, 0x02, 0x28, 0xBC, 0xBF, 0xA2, 0xAA, 0xD7, 0x08, 
+0x02, 0xEB, 0x5E, 0x3F, 0x13, 0x65, 0xAF, 0x5B, 0x80, 0xAA, 0x0D, 0x0A, 0xD4, 0x0F, 0xB6, 0x8B, 
+0x25, 0xC0, 0xBB, 0xDB, 0x8D, 0x4E, 0x10, 0xE4, 0xA7, 0x51, 0xCE, 0xC9, 0x0F, 0x3F, 0xBC, 0x3D, 
+0xFF, 0xE1, 0xE4, 0x1A, 0x08, 0xE8, 0xEC, 0xE4, 0xFA, 0x84, 0xC8, 0xA7, 0xA2, 0xF0, 0xF0, 0x72, 
+0xEE, 0x56, 0xBE, 0xD8, 0x74, 0x6A, 0xD7, 0xE2, 0x2F, 0xA2, 0x77, 0xC6, 0xF4, 0x06, 0x8C, 0x94, 
+0xC7, 0xDE, 0x62, 0x81, 0x67, 0x59, 0x62, 0xF7, 0xCE, 0x67, 0x2F, 0x44, 0x98, 0xFE, 0x0C, 0x5D, 
+0x5A, 0x2F, 0xC3, 0x85, 0x37, 0xED, 0x99, 0xA2, 0x54, 0x5F, 0x78, 0x09, 0x35, 0x47, 0xCD, 0xC9, 
+0x82, 0x64, 0x71, 0x87, 0xEF, 0x14, 0x5B, 0xC9, 0xB8, 0x81, 0x3A, 0x96, 0x43, 0xCD, 0x27, 0x55, 
+0xF2, 0x41, 0x89, 0x91, 0x5C, 0x7D, 0xF0, 0xC0, 0xDE, 0x9E, 0x09, 0xF7, 0x93, 0x21, 0xDC, 0xBE, 
+0xD9, 0x31, 0x47, 0xE0, 0xD1, 0xB0, 0x05, 0xF5, 0x11, 0x40, 0xCE, 0x98, 0xF3, 0xEE, 0xC2, 0x3E, 
+0x0B, 0xE6, 0x7C, 0x61, 0x3E, 0xA5, 0xE4, 0x74, 0xB5, 0xFB, 0x60, 0xBA, 0xBD, 0xDA, 0x39, 0x5A, 
+0xDD, 0x4E, 0xC2, 0xC6, 0xC6, 0x25, 0x43, 0xC1, 0xA8, 0xCD, 0xDE, 0xEC, 0x71, 0xAA, 0xF3, 0xD2, 
+0xD9, 0x52, 0x46, 0x11, 0x7C, 0x36, 0x69, 0x11, 0xFB, 0xAF, 0xF1, 0xD7, 0x6D, 0x1E, 0x98, 0x41, 
+0x89, 0xF5, 0x2B, 0xC9, 0x5B, 0xCB, 0x9C, 0xDC, 0x4F, 0xDB, 0x1B, 0x67, 0xA9, 0x45, 0x33, 0xEE, 
+0x83, 0x78, 0x63, 0x60, 0x2F, 0x2C, 0x40, 0xD3, 0xF6, 0x02, 0xD0, 0xB5, 0xB1, 0x81, 0x70, 0x2E, 
+0xF4, 0x59, 0x00, 0x52, 0xD3, 0xCF, 0xDD, 0x64, 0xC2, 0x87, 0xC2, 0x67, 0x5A, 0x94, 0x86, 0x9A, 
+0x0B, 0x67, 0xAF, 0x4C, 0x92, 0xAA, 0xBE, 0xCE, 0x2C, 0xA8, 0x8F, 0x8A, 0x1B, 0x40, 0xCD, 0x8D, 
+0x42, 0x95, 0x05, 0xC7, 0x59, 0xF1, 0xF8, 0x22, 0x84, 0xBB, 0xE4, 0xB0, 0x85, 0x17, 0xF8, 0x2E, 
+0xA1, 0xC0, 0xC9, 0x1D, 0xFB, 0x89, 0x4F, 0xC4, 0x70, 0x9C, 0xF7, 0x77, 0xC9, 0x78, 0x77, 0xF7, 
+0xAB, 0x8F, 0x5A, 0xDE, 0xDA, 0x26, 0x47, 0xC2, 0xFB, 0x6D, 0x1C, 0xAD, 0x4A, 0xF0, 0x43, 0x19, 
+0x6F, 0x9F, 0x1D, 0x8C, 0xCC, 0x66, 0x7E, 0x63, 0x16, 0xD1, 0x5D, 0x32, 0x0C, 0x03, 0x74, 0x8D, 
+0xA3, 0x7F, 0xC6, 0xE2, 0x96, 0xD1, 0x50, 0x5B, 0x46, 0x43, 0x41, 0xA5, 0xE4, 0x62, 0xFC, 0xF9, 
+0x97, 0xCC, 0x7B, 0x8C, 0x8B, 0x8E, 0x9E, 0x49, 0x91, 0xB4, 0x23, 0x03, 0xA6, 0x6C, 0x12, 0x53, 
+0xA5, 0xB6, 0xDC, 0x65, 0x79, 0x30, 0x12, 0x8B, 0x6A, 0x40, 0xE4, 0x30, 0x01, 0xB0, 0x4E, 0x39, 
+0xCE, 0xCF, 0x92, 0xD5, 0x04, 0x95, 0xFB, 0x09, 0x1F, 0xB3, 0x9F, 0x65, 0xE1, 0x70, 0xCC, 0x10, 
+0xA3, 0x14, 0xE7, 0x5F, 0xD8, 0xA6, 0x9C, 0xBA, 0x55, 0xF2, 0xF8, 0xD0, 0x7C, 0xB3, 0xC1, 0xC0, 
+0x94, 0xF9, 0xAD, 0x65, 0xD2, 0xA4, 0x73, 0x0B, 0xCF, 0x1F, 0xBF, 0x1D, 0x92, 0x7B, 0xFE, 0x0B, 
+0xCD, 0xFB, 0x67, 0xC2, 0x6D, 0x9E, 0x65, 0x98, 0x2C, 0xAA, 0x2F, 0xE4, 0x8D, 0xE4, 0x94, 0x3A, 
+0x4F, 0xB3, 0xA2, 0xB4, 0x33, 0x47, 0x42, 0x2F, 0xB3, 0xB3, 0xEC, 0xA4, 0xC9, 0xC6, 0x38, 0x32, 
+0xCA, 0x5A, 0x87, 0xD1, 0x65, 0x1E, 0x49, 0xA1, 0x62, 0x5B, 0xF6, 0x7C, 0xF6, 0xC1, 0x1C, 0x76, 
+0x45, 0xCF, 0xBE, 0x13, 0xD4, 0xFF, 0x2E, 0x27, 0x58, 0x81, 0x64, 0x08, 0x0A, 0xB9, 0xB7, 0x08, 
+0x1C, 0x75, 0x2B, 0x22, 0x20, 0x4B, 0xD8, 0xA1, 0x12, 0x9E, 0x28, 0xBE, 0xB3, 0x67, 0x7E, 0x55, 
+0x67, 0x83, 0x2B, 0x69, 0x9D, 0x8B, 0x42, 0x6A, 0xF8, 0x95, 0x60, 0x08, 0xA0, 0xD3, 0x22, 0xDD, 
+0xD1, 0x61, 0x9F, 0xE6, 0x90, 0xBC, 0x81, 0x20, 0xA6, 0x7E, 0x98, 0xF0, 0xB6, 0x3B, 0x40, 0x67, 
+0x2E, 0x0F, 0xD8, 0x99, 0x1B, 0x53, 0x08, 0x15, 0xBE, 0xBF, 0xC0, 0x1C, 0x48, 0xB0, 0xDE, 0x1C, 
+0xD3, 0x30, 0x48, 0xD6, 0x14, 0xE3, 0xE8, 0x95, 0xB2, 0x1B, 0x0A, 0x88, 0x7D, 0x74, 0x0A, 0xAB, 
+0x5D, 0x5A, 0x1A, 0x6A, 0xFC, 0x4E, 0x0F, 0x6B, 0x8B, 0xC8, 0xCD, 0x1B, 0xA1, 0x0D, 0x08, 0xA1, 
+0xAE, 0x31, 0xD3, 0x42, 0x72, 0x57, 0x8F, 0x58, 0xE9, 0xE1, 0x71, 0xF4, 0x48, 0xCF, 0x80, 0xBB, 
+0x93, 0xAA, 0x89, 0x89, 0x1C, 0x08, 0x99, 0x00, 0xC3, 0x1C, 0x31, 0x16, 0x27, 0xCE, 0x00, 0x84, 
+0x51, 0x8B, 0xCF, 0xE4, 0x21, 0x2D, 0xED, 0x2B, 0x9B, 0x57, 0x3A, 0x97, 0x98, 0x42, 0x58, 0x9A, 
+0x33, 0xF0, 0x5B, 0x1D, 0x89, 0x52, 0x8B, 0x83, 0xB7, 0x31, 0x46, 0x5F, 0xA1, 0x08, 0x93, 0xAE, 
+0x27, 0x14, 0x63, 0x24, 0x5C, 0x71, 0x28, 0x94, 0xC4, 0xB2, 0x0A, 0xBC, 0xB9, 0x07, 0x13, 0x12, 
+0xA3, 0x2C, 0x1B, 0x4D, 0xD2, 0x67, 0xE4, 0xFB, 0x79, 0x2A, 0x42, 0x6E, 0xC4, 0xF7, 0xD9, 0x70, 
+0x28, 0xF5, 0xB3, 0x5F, 0x6A, 0xF2, 0xBA, 0x30, 0x87, 0x97, 0xEE, 0x2A, 0x9A, 0xAC, 0xB3, 0xA2, 
+0xE2, 0x76, 0xFF, 0x8E, 0x89, 0x01, 0x64, 0x9D, 0xE7, 0xE1, 0x98, 0xC8, 0xBC, 0x23, 0x30, 0x95, 
+0x83, 0x2E, 0x4E, 0x40, 0x4F, 0x74, 0xE6, 0x62, 0x0C, 0xCA, 0x6E, 0xC2, 0x3C, 0x8B, 0x19, 0x1D, 
+0xCD, 0x66, 0xDF, 0x46, 0x4E, 0xDB, 0x53, 0xDC, 0xC6, 0x53, 0x91, 0x0D, 0xDE, 0xE9, 0xD1, 0x27, 
+0x85, 0x73, 0xB2, 0xF9, 0x20, 0x1A, 0x6A, 0x94, 0xD9, 0xBC, 0x7E, 0x9E, 0xFE, 0x92, 0x3B, 0x59, 
+0xF0, 0x97, 0x52, 0x52, 0x47, 0x29, 0x8D, 0x0B, 0x5B, 0x0C, 0x51, 0x33, 0x71, 0xA2, 0x86, 0x78, 
+0xCC, 0x4E, 0xE5, 0x10, 0x86, 0xE7, 0xCF, 0xD8, 0x8F, 0xD7, 0xAF, 0x5E, 0x56, 0xB4, 0x85, 0x9B, 
+0x74, 0x89, 0x16, 0x58, 0xD9, 0x9B, 0x2B, 0x43, 0x22, 0x61, 0x0C, 0x54, 0xFD, 0x7B, 0xBE, 0xC6, 
+0x15, 0x90, 0xAC, 0xF6, 0x03, 0xFC, 0x96, 0x79, 0x90, 0x12, 0x30, 0x58, 0xA1, 0x89, 0x53, 0xD7, 
+0x3D, 0x52, 0x93, 0x23, 0x97, 0x93, 0x9C, 0xB9, 0x20, 0xA8, 0x0A, 0xB8, 0x76, 0xDB, 0x70, 0x2A, 
+0xB6, 0xF5, 0x91, 0x32, 0x7B, 0xFC, 0xFC, 0x17, 0x5B, 0x60, 0xDA, 0x4B, 0x5E, 0xAD, 0x4F, 0x73, 
+0x17, 0xB2, 0x23, 0xFA, 0xC2, 0x45, 0x2A, 0xBB, 0xAC, 0xAC, 0xA1, 0x6D, 0x91, 0xF4, 0x97, 0x99, 
+0x46, 0x2A, 0xBC, 0xEF, 0xB2, 0x23, 0x3D, 0xFA, 0x3D, 0x4A, 0x98, 0xEB, 0xDF, 0xF9, 0x72, 0x32, 
+0x79, 0xF6, 0x74, 0x3E, 0xED, 0xD8, 0xA0, 0x26, 0xAB, 0xF9, 0xDC, 0xBB, 0xAF, 0x02, 0x64, 0x0E, 
+0x39, 0xF3, 0x05, 0x90, 0x36, 0x84, 0x43, 0x2B, 0xF5, 0x0D, 0x58, 0x87, 0x5A, 0x85, 0x1F, 0xE5, 
+0x8A, 0xCF, 0x52, 0x6D, 0x9A, 0xAF, 0x3E, 0x2A, 0x13, 0xDA, 0x74, 0x8E, 0xBF, 0xFA, 0x48, 0x38, 
+0xD9, 0x7C, 0xF5, 0x51, 0x0C, 0x69, 0x23, 0x0A, 0x78, 0xBC, 0x37, 0x1C, 0x59, 0xCC, 0xBA, 0x12, 
+0x6B, 0x40, 0xF9, 0xE7, 0x51, 0x9B, 0x53, 0x87, 0x30, 0x45, 0x92, 0x4E, 0xD1, 0xD0, 0x8B, 0x74, 
+0xDC, 0x7B, 0x51, 0xEF, 0xB0, 0xE1, 0x63, 0x60, 0x96, 0xE8, 0x59, 0x7F, 0x7F, 0x93, 0xA6, 0x11, 
+0xE9, 0xA1, 0x00, 0x26, 0x8F, 0x5A, 0x60, 0x0A, 0x3B, 0x02, 0x19, 0xA6, 0xE1, 0x4B, 0xB4, 0xF2, 
+0x4F, 0x5D, 0xD0, 0x48, 0x7A, 0x1B, 0x71, 0xE6, 0xE2, 0x7D, 0x13, 0x68, 0xD7, 0x07, 0x1C, 0x05, 
+0xC0, 0xA1, 0x5F, 0x96, 0xFB, 0x40, 0xA0, 0x9B, 0xF7, 0x87, 0x6C, 0xFB, 0xE2, 0x96, 0x68, 0xA1, 
+0xC6, 0x7C, 0xCE, 0x95, 0x0C, 0x43, 0x67, 0x79, 0xF6, 0xFA, 0xAA, 0x27, 0x72, 0x3C, 0x2E, 0xDE, 
+0x34, 0x8C, 0x69, 0xEE, 0x05, 0xAE, 0x2F, 0xC7, 0xA3, 0xCE, 0x14, 0xAC, 0x5A, 0xE5, 0x37, 0x54, 
+0xE5, 0xF2, 0xC0, 0x09, 0x46, 0x72, 0x09, 0x4B, 0x63, 0x7D, 0x46, 0x87, 0x3B, 0x0D, 0x7D, 0x09, 
+0xBD, 0x2B, 0xA3, 0x6C, 0xE8, 0x4D, 0x5A, 0x33, 0xD0, 0x57, 0xFE, 0xCB, 0x90, 0x8E, 0x12, 0x26, 
+0x3F, 0x79, 0xE9, 0x8D, 0xD3, 0xA1, 0xBA, 0x88, 0xD0, 0x1F, 0xA1, 0xDD, 0xF0, 0x5E, 0xDE, 0x1E, 
+0xD3, 0xE9, 0xF5, 0x70, 0x4C, 0x5D, 0xD3, 0xE6, 0xE8, 0xC2, 0x28, 0x5B, 0xE7, 0x59, 0x6A, 0x43, 
+0x32, 0xF6, 0x28, 0xD2, 0x33, 0xD4, 0xEE, 0xB4, 0xE3, 0x75, 0xD8, 0x5B, 0xDD, 0x69, 0xCB, 0xDA, 
+0xA5, 0x94, 0x61, 0x00, 0x3C, 0x0D, 0x97, 0xC6, 0x24, 0x01, 0xDA, 0x44, 0x76, 0x0C, 0x68, 0x76, 
+0xE7, 0xFC, 0x4C, 0xA4, 0x86, 0x2B, 0x89, 0x4B, 0x51, 0x35, 0x72, 0xD6, 0x6B, 0x03, 0xE9, 0x47, 
+0x91, 0x20, 0xAE, 0x41, 0x52, 0xF7, 0x43, 0x41, 0x16, 0x4D, 0xD0, 0xF0, 0x8B, 0x33, 0xE9, 0x52, 
+0xC4, 0xD9, 0xA9, 0xE3, 0xA9, 0x5D, 0xA2, 0xEF, 0x24, 0xB3, 0x91, 0x7C, 0x45, 0xBD, 0x7F, 0x70, 
+0x6F, 0xB8, 0x7F, 0x88, 0x3C, 0x25, 0x9B, 0xB3, 0xE4, 0x26, 0x6A, 0x73, 0xED, 0x82, 0x0C, 0xF5, 
+0xCA, 0x40, 0x59, 0x6F, 0x51, 0x7C, 0x8C, 0xD3, 0xCC, 0x58, 0x51, 0xFD, 0x68, 0xC6, 0x39, 0x5A, 
+0x0E, 0x1F, 0xB4, 0x5D, 0x2F, 0xCE, 0x48, 0x18, 0x79, 0xC1, 0x40, 0xA4, 0xAA, 0xE0, 0x55, 0xB9, 
+0x4D, 0x98, 0x03, 0x15, 0x83, 0x4E, 0x33, 0x75, 0xF0, 0xA7, 0x01, 0x46, 0x9E, 0x05, 0x73, 0x43, 
+0xFC, 0xAF, 0x32, 0xFC, 0x17, 0x19, 0x61, 0xFF, 0x3C, 0xA4, 0x94, 0xB0, 0x41, 0xB7, 0x57, 0xB3, 
+0x27, 0x65, 0xD2, 0xDA, 0xFB, 0xC6, 0xF2, 0x6D, 0xF9, 0xCD, 0xCF, 0xA2, 0x8C, 0xF0, 0x57, 0x1F, 
+0xC5, 0x70, 0x36, 0x2D, 0x6B, 0x73, 0x2B, 0xB7, 0x03, 0xE7, 0xA2, 0xE1, 0xAB, 0x8F, 0xC4, 0xA3, 
+0x61, 0x13, 0xC9, 0x22, 0xE0, 0xA5, 0x2A, 0x9D, 0xB4, 0x8F, 0xBA, 0x9B, 0xA6, 0xDA, 0xC8, 0xD8, 
+0x0B, 0x1A, 0x57, 0x03, 0x97, 0x94, 0x59, 0xAC, 0x40, 0xC4, 0x03, 0xD9, 0x13, 0x3D, 0x47, 0x36, 
+0x85, 0xBD, 0x29, 0x99, 0x8D, 0x39, 0xC3, 0xEB, 0x6D, 0x0A, 0x49, 0x25, 0x6E, 0xA9, 0xCD, 0x2F, 
+0x43, 0xD6, 0x6B, 0xB7, 0x99, 0x0A, 0x32, 0xCA, 0x9B, 0x1D, 0xF2, 0x8B, 0xA0, 0xA8, 0xB8, 0x1C, 
+0xD3, 0x3A, 0x92, 0x1B, 0xB9, 0xB7, 0x61, 0x7F, 0x2E, 0xEE, 0x86, 0x22, 0xD7, 0xC1, 0xCC, 0x4D, 
+0x6E, 0x26, 0xA1, 0x1B, 0xCF, 0x9A, 0x0A, 0x09, 0xB3, 0x52, 0xE1, 0x27, 0x5A, 0x7D, 0xF2, 0x92, 
+0x51, 0x15, 0xE8, 0x8A, 0xA4, 0xCD, 0x90, 0x4A, 0xF5, 0xE0, 0xBA, 0xE3, 0x2E, 0xD6, 0x37, 0xEC, 
+0x6E, 0x0C, 0x77, 0x2B, 0x22, 0xD5, 0x2B, 0xDB, 0x71, 0xD3, 0x54, 0x66, 0x94, 0x46, 0xD2, 0x50, 
+0xE1, 0xBA, 0x8E, 0xEC, 0x2B, 0x33, 0xC9, 0xEF, 0x87, 0xEE, 0xE8, 0x0B, 0x28, 0x9C, 0x80, 0xF2, 
+0x21, 0x4D, 0x57, 0x90, 0x9C, 0x82, 0x57, 0x41, 0x7D, 0xB8, 0x7A, 0xD4, 0xC8, 0x8B, 0x4A, 0xEF, 
+0xF3, 0x8D, 0xD1, 0xC9, 0xDB, 0x20, 0xA7, 0xA9, 0xB4, 0xAA, 0xB2, 0xC3, 0xAC, 0x79, 0xC6, 0xDE, 
+0x2A, 0x9F, 0x68, 0x7C, 0x8F, 0xDA, 0xCB, 0xE5, 0x7F, 0x4B, 0xC3, 0x96, 0x65, 0xDE, 0xFF, 0xE3, 
+0xDF, 0xFE, 0xF5, 0x3F, 0xFF, 0xFD, 0x5F, 0x33, 0x94, 0xB6, 0xC0, 0x89, 0x5E, 0xAB, 0xCE, 0x7C, 
+0x05, 0x77, 0xE9, 0x02, 0x0F, 0xBC, 0xDA, 0x0C, 0x17, 0x51, 0x12, 0x59, 0xBB, 0x05, 0xB4, 0x75, 
+0x76, 0x50, 0xDB, 0x17, 0x6A, 0x27, 0xE2, 0x00, 0x26, 0x90, 0x96, 0x2A, 0xC2, 0x33, 0x51, 0x07, 
+0xDB, 0xF4, 0x67, 0xAD, 0x51, 0x21, 0x46, 0x01, 0x4F, 0xDD, 0x13, 0x19, 0x98, 0xC4, 0xF6, 0x97, 
+0xF3, 0x39, 0xB6, 0xE9, 0x6E, 0x7E, 0x69, 0x35, 0x60, 0x95, 0x8B, 0xE3, 0x86, 0x1B, 0x0D, 0xF7, 
+0x3A, 0xC7, 0x2D, 0xE8, 0x50, 0x9B, 0xA9, 0x7A, 0x5B, 0x49, 0xA5, 0xE2, 0x2D, 0xE2, 0x50, 0xEE, 
+0x9A, 0x8E, 0x43, 0xC5, 0xB4, 0x85, 0xA6, 0x48, 0xFA, 0x30, 0x69, 0x65, 0x8D, 0x15, 0x78, 0xB7, 
+0xAE, 0x98, 0xFD, 0x7E, 0xD3, 0x1B, 0xFE, 0x0A, 0xAC, 0xC6, 0xE9, 0x76, 0x6B, 0xF3, 0xFC, 0xB2, 
+0xA2, 0x29, 0xE2, 0x30, 0x1B, 0x5A, 0x7D, 0xE2, 0x04, 0x07, 0xA5, 0x56, 0x44, 0x31, 0xDD, 0xE1, 
+0xCC, 0xC4, 0xE5, 0xA5, 0x73, 0xE4, 0x2F, 0x25, 0xDB, 0x55, 0x86, 0x8C, 0x65, 0xA9, 0x05, 0x4A, 
+0xF4, 0x42, 0xD3, 0x8B, 0x74, 0x39, 0xD4, 0xAC, 0x2D, 0x36, 0x4F, 0xA5, 0xBD, 0x68, 0xDD, 0xE2, 
+0x8C, 0x45, 0xF9, 0xF0, 0xAC, 0x1A, 0x87, 0x20, 0x05, 0xF9, 0x8D, 0xC9, 0xB9, 0xA0, 0x39, 0x47, 
+0xAA, 0xB5, 0x1C, 0x0A, 0x01, 0x88, 0xD7, 0x74, 0x09, 0x5F, 0x31, 0xFC, 0xE4, 0x18, 0x03, 0xED, 
+0xBE, 0xE9, 0xDC, 0x81, 0x44, 0xE5, 0xC9, 0x6C, 0x46, 0x6E, 0x06, 0x3D, 0x8B, 0x5F, 0xC0, 0x1D, 
+0x26, 0x3C, 0x75, 0x2A, 0x19, 0x0B, 0xFD, 0xDC, 0x6E, 0xE8, 0x99, 0xC1, 0x89, 0x34, 0x28, 0x61, 
+0x20, 0x3A, 0x67, 0x7C, 0x01, 0x72, 0x92, 0xED, 0xF5, 0x28, 0xD1, 0x54, 0x9C, 0x80, 0xA0, 0xD3, 
+0xC0, 0x40, 0x5C, 0x83, 0x63, 0x3C, 0x1C, 0xB9, 0x2C, 0xA5, 0x14, 0x66, 0x18, 0x69, 0xF2, 0x1D, 
+0xA8, 0x83, 0x8C, 0x94, 0xD1, 0x99, 0x6C, 0x19, 0xC2, 0x80, 0xB0, 0xCE, 0x3F, 0x82, 0x40, 0x5D, 
+0xC5, 0x78, 0x07, 0xA6, 0x61, 0x66, 0xA0, 0xD2, 0x2E, 0x78, 0x3A, 0x56, 0x75, 0xFC, 0x8D, 0xC1, 
+0x9A, 0x2F, 0xCF, 0x5A, 0x78, 0xBA, 0xE4, 0x54, 0xF7, 0x99, 0x23, 0xE6, 0x0E, 0xA6, 0xB4, 0x58, 
+0xDA, 0x9D, 0xCA, 0x89, 0x50, 0x4A, 0x27, 0xF2, 0xC3, 0xBB, 0x84, 0x01, 0x37, 0xC0, 0xD3, 0x99, 
+0xF0, 0x5D, 0x91, 0xEC, 0x90, 0x30, 0x59, 0x01, 0x15, 0x86, 0x28, 0x6A, 0xE0, 0x9A, 0xCE, 0x23, 
+0x03, 0x12, 0xBD, 0x84, 0xFC, 0x3B, 0x0A, 0xCE, 0xD0, 0x18, 0x14, 0x04, 0xE7, 0x44, 0x35, 0x2E, 
+0xE9, 0x2F, 0xC8, 0x5C, 0xB3, 0x3A, 0x9F, 0xED, 0xD1, 0xA4, 0xC2, 0xE5, 0x85, 0xF9, 0x9D, 0x64, 
+0xCC, 0x23, 0xE9, 0x9D, 0x60, 0x8D, 0xD1, 0xD3, 0xFC, 0xA9, 0x53, 0x9B, 0xA5, 0xED, 0xA1, 0xCA, 
+0xA6, 0x38, 0x3A, 0x85, 0x9F, 0xB2, 0x80, 0x39, 0xA4, 0x8A, 0xA5, 0x4E, 0x2F, 0x73, 0x41, 0x22, 
+0xCA, 0xF6, 0x13, 0x26, 0x9B, 0xB7, 0xAF, 0xB5, 0x6B, 0x4B, 0xA5, 0x2F, 0xD9, 0x97, 0x14, 0x42, 
+0x21, 0x2C, 0xBF, 0xC7, 0x03, 0xB7, 0xE8, 0xAA, 0x76, 0xFD, 0xB1, 0x3A, 0x1E, 0xF1, 0xC8, 0x78, 
+0xA6, 0x4E, 0x38, 0x80, 0xB8, 0x1B, 0x67, 0x93, 0x31, 0x66, 0x96, 0x5A, 0x87, 0x28, 0x92, 0xA5, 
+0x93, 0x61, 0xF8, 0xA1, 0xD7, 0x68, 0xBE, 0x63, 0x62, 0x6E, 0xCA, 0x33, 0xBF, 0x4B, 0x73, 0x8A, 
+0x7F, 0xA1, 0xD0, 0xE6, 0xDF, 0xE5, 0x5B, 0x2A, 0x6E, 0x70, 0x18, 0xE4, 0xD1, 0x36, 0x30, 0x67, 
+0x23, 0xDC, 0xA7, 0x71, 0x54, 0xDB, 0xD6, 0xB8, 0xBF, 0x22, 0xC3, 0xC6, 0x8A, 0x4B, 0x3B, 0xAB, 
+0x69, 0x04, 0x17, 0x73, 0x76, 0xC7, 0xD9, 0x8D, 0x0B, 0x4C, 0xBD, 0x8B, 0x49, 0xC0, 0xB0, 0x27, 
+0xD2, 0xEC, 0x6E, 0x87, 0x3E, 0xF3, 0xD2, 0x2E, 0x6C, 0xA4, 0x62, 0xE3, 0xE1, 0xD3, 0x5A, 0x88, 
+0x44, 0xFB, 0x19, 0xE3, 0xB8, 0x71, 0x13, 0x47, 0x19, 0x4F, 0xAF, 0xD7, 0x80, 0x10, 0x42, 0x26, 
+0x2A, 0x48, 0xD4, 0xDB, 0x11, 0xDB, 0x3F, 0x6C, 0x36, 0xA1, 0x55, 0x26, 0x15, 0xAB, 0x08, 0x89, 
+0xA3, 0x86, 0x83, 0x8E, 0x1B, 0xEB, 0xDB, 0x4D, 0xFB, 0x98, 0xAA, 0x08, 0x05, 0x31, 0x7B, 0x20, 
+0x57, 0x46, 0xF2, 0xD9, 0x92, 0x0E, 0x6B, 0x4D, 0xD0, 0xFF, 0x47, 0xAA, 0x08, 0x1E, 0x10, 0x38, 
+0xBD, 0x7C, 0x7B, 0x25, 0x6E, 0x9D, 0x07, 0xD9, 0xEA, 0xE0, 0x39, 0x79, 0x7F, 0x86, 0x71, 0xB8, 
+0xE5, 0x9D, 0x1B, 0xF3, 0x9E, 0x0D, 0x9C, 0x29, 0x80, 0x3E, 0x17, 0xD5, 0x84, 0xE6, 0x74, 0x84, 
+0x43, 0xC1, 0xB8, 0x01, 0x81, 0x9B, 0x7A, 0x66, 0x2B, 0xC8, 0xFE, 0x8D, 0xE0, 0x7D, 0x43, 0xE0, 
+0xA1, 0x4E, 0xC6, 0x07, 0xEB, 0xBC, 0x9C, 0x42, 0x55, 0x90, 0x42, 0xF7, 0x87, 0xD8, 0x8D, 0x6E, 
+0x64, 0xCD, 0x2F, 0x94, 0x44, 0x4E, 0xB6, 0x46, 0xA2, 0xAA, 0x84, 0xD3, 0x03, 0xC6, 0x43, 0xF4, 
+0x5C, 0xCE, 0x35, 0xAB, 0x09, 0x57, 0xE8, 0x41, 0x6A, 0xCC, 0xA5, 0x78, 0x11, 0xC2, 0x1E, 0x60, 
+0x67, 0x54, 0xC6, 0x1E, 0xA6, 0x4E, 0x9D, 0x8A, 0x04, 0x00, 0x2D, 0x1B, 0xA7, 0x1A, 0x79, 0x30, 
+0x8C, 0x15, 0x07, 0x98, 0xF4, 0x19, 0xBF, 0x27, 0xAF, 0x12, 0x59, 0x69, 0x89, 0xA1, 0xEC, 0x06, 
+0x35, 0xC3, 0x4C, 0xD5, 0x9F, 0xD9, 0xC7, 0x82, 0xD0, 0xA4, 0x0F, 0x32, 0xAB, 0x3A, 0x32, 0x1C, 
+0x0E, 0x37, 0x14, 0x05, 0x60, 0xBF, 0xD4, 0x3A, 0xA5, 0xF7, 0x86, 0x74, 0x01, 0x68, 0x56, 0xC6, 
+0x23, 0x3F, 0xD8, 0x88, 0xE9, 0xAB, 0x0C, 0xA4, 0x8C, 0xB8, 0x65, 0x30, 0x0C, 0x3F, 0xAC, 0x22, 
+0x10, 0x35, 0x78, 0x97, 0x42, 0x8C, 0x91, 0x79, 0x79, 0x41, 0x67, 0x62, 0xCA, 0x62, 0xE5, 0xF7, 
+0x5E, 0x92, 0x0A, 0xF4, 0x65, 0xEA, 0x4A, 0x06, 0x96, 0xE4, 0x56, 0x80, 0x3C, 0xE9, 0xE7, 0x60, 
+0x88, 0xF9, 0xFD, 0xC1, 0x2F, 0xBD, 0x06, 0xAF, 0xF9, 0xFE, 0x50, 0x3A, 0xCE, 0x11, 0x16, 0x5D, 
+0xF5, 0x82, 0x07, 0x46, 0xCB, 0x87, 0x11, 0xB3, 0x10, 0x48, 0xA0, 0xF7, 0x62, 0x73, 0x6B, 0x93, 
+0x68, 0x0A, 0x2C, 0xC9, 0x99, 0x45, 0x33, 0xDC, 0x08, 0x47, 0xF9, 0x7C, 0x30, 0xD8, 0x63, 0xE6, 
+0xFB, 0x18, 0x85, 0x02, 0xB5, 0x07, 0xB4, 0x9D, 0x0C, 0x31, 0xA2, 0x24, 0x18, 0xE5, 0x04, 0xF3, 
+0x3B, 0x0B, 0x74, 0x74, 0x47, 0x63, 0x0F, 0xDF, 0xE1, 0xDF, 0xC3, 0x7B, 0xD0, 0xB8, 0x9D, 0xD2, 
+0x59, 0xCC, 0xDD, 0x7D, 0x74, 0x75, 0x88, 0xAC, 0x77, 0x82, 0xEF, 0xF4, 0x06, 0xA3, 0xE1, 0x41, 
+0xEF, 0xD1, 0xC1, 0xC8, 0xEA, 0x3F, 0x5F, 0x6B, 0x50, 0xD7, 0x3A, 0x54, 0xE1, 0x36, 0xDA, 0x0E, 
+0xAC, 0x25, 0x4D, 0xC0, 0x16, 0x3D, 0x9E, 0x8D, 0xE1, 0xFF, 0xE6, 0x43, 0xEE, 0xF7, 0x63, 0x76, 
+0x6F, 0x7E, 0xB3, 0x1E, 0xB3, 0xB5, 0xF9, 0xCD, 0x2D, 0x7C, 0x54, 0x4C, 0xE7, 0x16, 0xB1, 0x34, 
+0xB2, 0xB4, 0x5C, 0x6B, 0x2D, 0xD7, 0xF6, 0x96, 0x68, 0xE5, 0x8E, 0x59, 0xB5, 0x48, 0xC7, 0xA6, 
+0x59, 0x03, 0x7C, 0x9C, 0x51, 0x23, 0x6D, 0xCE, 0x9D, 0x6A, 0xB2, 0x61, 0xCD, 0xD6, 0xCD, 0x12, 
+0x23, 0x13, 0x2E, 0x8C, 0x03, 0x60, 0x17, 0x7E, 0x05, 0x8A, 0xA4, 0xE7, 0xEC, 0x08, 0xB1, 0x06, 
+0xB0, 0x9C, 0xF9, 0x61, 0x49, 0x38, 0x43, 0x45, 0x15, 0x38, 0x26, 0xE6, 0x99, 0x8D, 0xF1, 0x78, 
+0x42, 0xCC, 0xB2, 0x5B, 0x70, 0xEB, 0x7A, 0xFA, 0xD9, 0x1A, 0xD3, 0x11, 0x4E, 0x1F, 0x72, 0xC0, 
+0x35, 0xA4, 0x35, 0xAB, 0x9B, 0x31, 0xD7, 0x41, 0x02, 0xBB, 0x0A, 0x82, 0x28, 0x0B, 0xB2, 0xEC, 
+0xE4, 0xAC, 0x9B, 0x3A, 0xF1, 0x9C, 0x8D, 0xB7, 0xAC, 0x82, 0x64, 0xDF, 0x16, 0x0A, 0x08, 0x81, 
+0xDD, 0x42, 0x82, 0xB6, 0x39, 0x45, 0x5F, 0x44, 0x8D, 0x57, 0x01, 0xF1, 0xFD, 0x2B, 0x6F, 0x89, 
+0xA7, 0x01, 0x3C, 0x54, 0xCC, 0x2A, 0x01, 0x78, 0x50, 0x40, 0x32, 0x54, 0x88, 0x03, 0x58, 0xA6, 
+0x89, 0x61, 0xCD, 0x02, 0x9E, 0xA4, 0x27, 0x81, 0xB7, 0x24, 0x38, 0x2F, 0x62, 0x40, 0xAA, 0x53, 
+0x85, 0xDF, 0x3A, 0x5B, 0xC7, 0xC0, 0x8F, 0xAB, 0xC7, 0xBA, 0xEF, 0x0C, 0xC7, 0xC6, 0x65, 0xF0, 
+0xAD, 0x72, 0x98, 0xFB, 0xC6, 0x70, 0x64, 0x5C, 0x34, 0xC6, 0x98, 0xC9, 0xDE, 0x68, 0x44, 0x7A, 
+0xBB, 0x37, 0xE3, 0xA0, 0x39, 0xCF, 0x80, 0x51, 0xBA, 0xB5, 0xD5, 0x4D, 0xA1, 0xE9, 0x68, 0x98, 
+0xD5, 0xB2, 0xA6, 0x39, 0x82, 0xED, 0x08, 0xD2, 0xEF, 0xD6, 0x33, 0xD7, 0x86, 0x9A, 0xDE, 0x53, 
+0x2D, 0x30, 0x9C, 0x00, 0x88, 0x02, 0x63, 0x76, 0x39, 0x32, 0x3C, 0x39, 0x6E, 0x6A, 0x52, 0xC9, 
+0x60, 0xBC, 0x59, 0x27, 0xDE, 0x34, 0x81, 0x9D, 0xC0, 0xA3, 0x9D, 0x87, 0x50, 0x2A, 0xE5, 0x18, 
+0x44, 0x2B, 0x1F, 0x8B, 0xBD, 0x33, 0xE7, 0x34, 0x5C, 0xF9, 0xE1, 0x72, 0xD2, 0x6B, 0x26, 0x7C, 
+0x3A, 0x35, 0xDC, 0x40, 0xFC, 0x44, 0xF9, 0xD4, 0xB0, 0xD9, 0x30, 0x98, 0x51, 0x85, 0x02, 0x10, 
+0x14, 0x03, 0xF1, 0xC5, 0xF0, 0xBE, 0x29, 0xE4, 0x30, 0x5B, 0xD3, 0x17, 0xEB, 0xFC, 0x8B, 0x75, 
+0xE3, 0x17, 0xB0, 0x82, 0x57, 0x94, 0xB0, 0x7E, 0xFF, 0x08, 0xFA, 0xFB, 0x06, 0x40, 0x3C, 0x9A, 
+0xB5, 0xFA, 0x2A, 0x3B, 0x7E, 0x96, 0xFC, 0x06, 0x36, 0x9D, 0x00, 0x43, 0x91, 0xAB, 0xBD, 0xA6, 
+0x8F, 0xE7, 0xA4, 0x41, 0x1D, 0x91, 0x11, 0x88, 0x67, 0xD2, 0xE8, 0xD3, 0x43, 0x1D, 0xEB, 0x49, 
+0x1A, 0xD3, 0x16, 0xB2, 0x33, 0x06, 0x14, 0x0D, 0xDF, 0x1C, 0x31, 0x07, 0x06, 0x2D, 0x60, 0xE0, 
+0x69, 0x36, 0x02, 0x7D, 0x58, 0xF7, 0xD1, 0x5A, 0x7C, 0xB4, 0x6E, 0xF7, 0x91, 0x99, 0x6F, 0x98, 
+0x08, 0x46, 0x52, 0xB8, 0xA4, 0x6C, 0xE6, 0xDC, 0x71, 0xF7, 0x83, 0x81, 0x64, 0xB2, 0x51, 0x4F, 
+0x71, 0x51, 0x61, 0x69, 0xB1, 0xFF, 0xD1, 0x70, 0x34, 0x3A, 0x38, 0xDC, 0xB1, 0x0E, 0x76, 0xBA, 
+0xA6, 0xB6, 0x6B, 0xA5, 0xAD, 0x71, 0x04, 0xF9, 0xB5, 0x90, 0x72, 0x08, 0x22, 0xD3, 0x23, 0xF1, 
+0x96, 0x9E, 0x0F, 0x22, 0x21, 0xCF, 0x1D, 0x30, 0x26, 0xE8, 0x5E, 0x9E, 0x5D, 0x8E, 0xD9, 0x0B, 
+0x2F, 0x98, 0x49, 0xCE, 0x8A, 0x3E, 0x8E, 0xA5, 0x9B, 0x90, 0xAF, 0x43, 0x7E, 0xF9, 0x9D, 0x31, 
+0xEB, 0x1F, 0x38, 0x56, 0xE4, 0x73, 0x26, 0xAF, 0x46, 0x18, 0x33, 0xA1, 0x97, 0x79, 0xB0, 0x82, 
+0x54, 0xFC, 0x45, 0x8E, 0xC9, 0x4D, 0xD3, 0xD8, 0x9D, 0x82, 0x9D, 0xE7, 0xE3, 0xB6, 0xF5, 0xAB, 
+0x72, 0x69, 0xF7, 0xD1, 0xE7, 0xDE, 0x5E, 0x18, 0xD2, 0x0C, 0x86, 0xEA, 0x99, 0x36, 0x0A, 0x8D, 
+0x8B, 0x6D, 0xA1, 0x3E, 0x6E, 0xB9, 0x0F, 0xE5, 0x0E, 0x14, 0xCB, 0xD6, 0x6A, 0x1F, 0xCA, 0x1D, 
+0x28, 0x16, 0xAF, 0xC6, 0x26, 0xCC, 0x88, 0x02, 0xBA, 0x11, 0x0B, 0xBC, 0x57, 0xDF, 0x98, 0xA8, 
+0x02, 0x7A, 0xA8, 0x6D, 0xBC, 0x69, 0x55, 0x39, 0xE8, 0xD1, 0x6E, 0xA3, 0x02, 0x44, 0xAE, 0x82, 
+0x13, 0xB1, 0x7E, 0xC4, 0x0F, 0xAF, 0xA2, 0xB8, 0x72, 0x9A, 0x2D, 0x17, 0xD3, 0x0D, 0xD5, 0x92, 
+0x51, 0x53, 0x41, 0x22, 0x23, 0xB5, 0x3E, 0xA4, 0xCC, 0x96, 0xC4, 0x96, 0xC0, 0x21, 0x84, 0x92, 
+0x24, 0x01, 0xF8, 0x48, 0x70, 0x6B, 0x12, 0xF3, 0xB8, 0x90, 0xFE, 0x50, 0xE8, 0x02, 0x56, 0xBD, 
+0x38, 0x6D, 0x04, 0x20, 0x54, 0x07, 0xCB, 0xF1, 0x06, 0x8A, 0x89, 0xA7, 0xF5, 0x87, 0x18, 0x88, 
+0x30, 0x52, 0x22, 0x8A, 0xC4, 0x46, 0x14, 0x0A, 0x41, 0xA4, 0x44, 0x0C, 0x89, 0x8D, 0x18, 0x6C, 
+0xAC, 0x55, 0x65, 0xCC, 0x75, 0x1C, 0x56, 0xE7, 0xAE, 0xC4, 0x92, 0xA1, 0xBB, 0x0F, 0x92, 0x6D, 
+0x1C, 0x88, 0x33, 0x8F, 0xB4, 0x78, 0xA2, 0xA9, 0x1B, 0x6C, 0xED, 0x73, 0x9B, 0xDF, 0xB3, 0x2D, 
+0x58, 0xAE, 0xFC, 0x66, 0xCD, 0xB6, 0xE0, 0xB8, 0xC6, 0x87, 0x89, 0xDC, 0x21, 0x73, 0x0B, 0x8E, 
+0x13, 0xB9, 0x29, 0xE6, 0x16, 0xCC, 0xA6, 0xF8, 0xFD, 0xC0, 0xFE, 0x7D, 0x8A, 0xDF, 0x0F, 0xCC, 
+0xDF, 0x6F, 0x1A, 0x77, 0x08, 0xE6, 0x65, 0x2E, 0xE4, 0xF5, 0x8F, 0x5F, 0xB3, 0xEF, 0xF1, 0xA0, 
+0x47, 0xF2, 0x20, 0xBD, 0x83, 0x18, 0xC1, 0xA3, 0x23, 0x8C, 0x47, 0xD1, 0x62, 0xBD, 0x88, 0x3D, 
+0xDA, 0x73, 0x66, 0xD1, 0x20, 0x1B, 0x36, 0x9B, 0x6F, 0x98, 0x75, 0xE8, 0xDE, 0xB3, 0x24, 0xE2, 
+0x60, 0x80, 0x4C, 0x7D, 0x77, 0x19, 0xD9, 0xB6, 0x1C, 0xB5, 0x50, 0x69, 0x0F, 0x47, 0xF4, 0x48, 
+0xF0, 0x27, 0xEA, 0x14, 0x7F, 0x5E, 0x9B, 0xAB, 0x8A, 0x89, 0x8F, 0x8F, 0x41, 0x41, 0xB4, 0xED, 
+0x19, 0x82, 0x73, 0xC4, 0x08, 0xE8, 0x2E, 0x35, 0xEF, 0x3D, 0xDA, 0x1B, 0x1D, 0xEE, 0x58, 0xD9, 
+0x9C, 0x68, 0xBB, 0xAE, 0x6B, 0x6B, 0x38, 0xA1, 0x81, 0x0A, 0xD3, 0x37, 0x47, 0xD4, 0x9B, 0x49, 
+0xA8, 0xAE, 0xE5, 0xCB, 0xB5, 0x59, 0x8A, 0xFE, 0x84, 0x37, 0xCF, 0x4E, 0x60, 0x0D, 0xA7, 0xDC, 
+0x34, 0x4B, 0x04, 0xFE, 0x1C, 0x34, 0x17, 0x4C, 0xC1, 0xC6, 0x9F, 0x51, 0x8B, 0x39, 0xCC, 0x17, 
+0x0E, 0x8D, 0x6A, 0x73, 0x4A, 0x36, 0x7D, 0x78, 0x2C, 0x14, 0xDB, 0x81, 0xFA, 0x79, 0xF6, 0xA4, 
+0x25, 0x90, 0xB5, 0xD2, 0xFB, 0xBA, 0xE8, 0x7D, 0xDD, 0xE2, 0xC3, 0x63, 0xA9, 0x34, 0x0F, 0xD4, 
+0xEF, 0xF3, 0x47, 0xF5, 0x60, 0x4C, 0x64, 0x7F, 0x06, 0x26, 0x6D, 0xA5, 0x44, 0x54, 0x7A, 0x3F, 
+0x24, 0xAF, 0xF9, 0x5B, 0xE0, 0xEC, 0xCE, 0xA8, 0x0F, 0x06, 0xB9, 0x98, 0x61, 0x5F, 0xF6, 0x64, 
+0x81, 0x63, 0xB0, 0xAE, 0x25, 0x34, 0xBC, 0x40, 0xF8, 0x03, 0xBF, 0xC2, 0xD0, 0x26, 0x1D, 0x9C, 
+0xDA, 0xDF, 0xFB, 0xF6, 0xE9, 0x8B, 0xC7, 0xDD, 0x43, 0x53, 0x5B, 0xF4, 0x6F, 0xFE, 0x24, 0x6D, 
+0x9F, 0x3D, 0x63, 0x8B, 0x09, 0x5F, 0x78, 0xC1, 0x1B, 0x20, 0xEF, 0xB2, 0x5F, 0xBD, 0xAD, 0x00, 
+0xFB, 0x7B, 0x90, 0x4D, 0x72, 0xAE, 0x98, 0x24, 0x7D, 0x1D, 0x3A, 0x20, 0x98, 0xFA, 0x28, 0x73, 
+0x2C, 0x96, 0xB1, 0x82, 0x3A, 0x68, 0x9C, 0x62, 0xE3, 0xD4, 0xD8, 0x78, 0x53, 0x9B, 0xFA, 0xAA, 
+0xAD, 0x96, 0x63, 0x5B, 0x65, 0x9A, 0xEF, 0xC3, 0x58, 0x63, 0xC3, 0xFA, 0x29, 0x6D, 0xDC, 0x78, 
+0x8A, 0xBB, 0xAD, 0x8F, 0x14, 0xDE, 0x67, 0xCF, 0x88, 0x06, 0xF7, 0x41, 0xE8, 0x10, 0x57, 0x7B, 
+0x73, 0xD1, 0x6B, 0xC7, 0x31, 0x45, 0xC8, 0x7F, 0xB2, 0x96, 0x95, 0xA4, 0x76, 0x2B, 0xA1, 0xD4, 
+0xC2, 0x9D, 0x41, 0xCA, 0xA4, 0x28, 0xD2, 0xDC, 0xCB, 0x06, 0x31, 0xF7, 0x7C, 0xBF, 0x20, 0xDA, 
+0xD1, 0xE3, 0x99, 0x3B, 0x7D, 0xDA, 0x25, 0xA6, 0x7E, 0xBA, 0x76, 0x03, 0x43, 0x55, 0x19, 0x79, 
+0xD4, 0x41, 0x42, 0x13, 0xA9, 0x05, 0x16, 0x68, 0x22, 0xF3, 0x55, 0x40, 0x7B, 0xB3, 0x8A, 0x23, 
+0xC3, 0x39, 0x61, 0x82, 0x67, 0xFC, 0xF8, 0xC9, 0x93, 0x27, 0xE2, 0x4B, 0x30, 0x13, 0xD6, 0xCD, 
+0x98, 0x50, 0x60, 0xD4, 0xA0, 0xBC, 0xBC, 0x49, 0xCD, 0xA7, 0x1B, 0x0D, 0xBB, 0x74, 0xBF, 0x01, 
+0xA4, 0x63, 0xB1, 0xB6, 0x5E, 0x62, 0x3A, 0x50, 0x52, 0x37, 0xDA, 0x62, 0x30, 0xF3, 0xF9, 0xDC, 
+0x3E, 0x18, 0x4C, 0x90, 0xC0, 0x56, 0x98, 0x7F, 0x82, 0x25, 0x1E, 0x92, 0xD0, 0x77, 0x93, 0xAE, 
+0xF5, 0x4E, 0x15, 0xEC, 0x96, 0x2C, 0xEC, 0x4A, 0x69, 0x8E, 0xEF, 0x4C, 0x0F, 0x85, 0x57, 0xEA, 
+0xB0, 0x6E, 0x9C, 0x74, 0x22, 0x9B, 0xE0, 0xF6, 0x85, 0xE4, 0x02, 0x01, 0xDA, 0x17, 0x62, 0x8A, 
+0x3D, 0x6E, 0x8A, 0x50, 0x3F, 0xC0, 0x99, 0xB4, 0x31, 0x9E, 0xC4, 0xB8, 0x22, 0xE7, 0x35, 0x7C, 
+0x90, 0x3F, 0x34, 0x79, 0xBC, 0xF4, 0x53, 0x20, 0xB2, 0x0A, 0x23, 0x9D, 0x4A, 0xC9, 0x6C, 0x83, 
+0x3C, 0xEF, 0xEB, 0x0F, 0x5E, 0xE2, 0xA5, 0x85, 0x8D, 0x50, 0x78, 0x97, 0xAA, 0x35, 0x00, 0xE9, 
+0x36, 0xCB, 0x6E, 0x9F, 0x62, 0x59, 0x95, 0xBD, 0x9F, 0x45, 0x48, 0xA7, 0x69, 0xB9, 0x58, 0x23, 
+0xE9, 0x59, 0xA0, 0xCB, 0x42, 0x97, 0x00, 0x8E, 0xE4, 0x8D, 0x31, 0x47, 0x62, 0x19, 0xAE, 0x12, 
+0xFE, 0x4F, 0xE8, 0x59, 0x05, 0xC9, 0x84, 0x4D, 0xFF, 0x09, 0x94, 0x62, 0x04, 0x38, 0xC4, 0x5C, 
+0x20, 0xEB, 0x17, 0x7F, 0x54, 0xBE, 0xF8, 0x63, 0xF6, 0x45, 0x1A, 0x46, 0x55, 0xCE, 0x76, 0x7A, 
+0xC3, 0x61, 0xCE, 0x53, 0x3C, 0x76, 0x42, 0xAE, 0x8B, 0x3B, 0x0F, 0x48, 0x3B, 0xA8, 0x70, 0x3A, 
+0x25, 0x21, 0x3F, 0x40, 0xAB, 0x3A, 0xE3, 0x7C, 0xF6, 0x54, 0x7C, 0xB2, 0x2E, 0xE4, 0xF0, 0x2D, 
+0x56, 0xA7, 0x62, 0x5C, 0xC8, 0x51, 0x5B, 0x8C, 0x4D, 0x18, 0xE7, 0x8F, 0x18, 0x56, 0x76, 0x67, 
+0xDE, 0x2A, 0x61, 0x7B, 0xFB, 0xA0, 0x90, 0x03, 0x43, 0x0E, 0xB2, 0x07, 0x5E, 0xC2, 0x9E, 0x99, 
+0xCF, 0xAF, 0x6A, 0xD6, 0x07, 0x28, 0x1F, 0x7B, 0x4F, 0x9E, 0xA0, 0xF6, 0x50, 0xA3, 0xEF, 0x47, 
+0xF9, 0x06, 0xA9, 0xB3, 0x0A, 0x3E, 0x7B, 0xDA, 0xF9, 0x27, 0xA5, 0x9C, 0xFF, 0x05, 0x72, 0xC3, 
+0x4D, 0xDD, 0x54, 0x6E, 0x28, 0x88, 0xF9, 0x1C, 0x63, 0x8E, 0x59, 0xBF, 0xE6, 0xAF, 0x26, 0x31, 
+0x77, 0x3F, 0x6C, 0x71, 0x33, 0x49, 0x69, 0x9F, 0xBE, 0x42, 0xC2, 0x80, 0xBF, 0x6F, 0x39, 0xD1, 
+0xE0, 0x29, 0xE5, 0x7E, 0xB6, 0xDA, 0x99, 0x44, 0x52, 0xA8, 0x46, 0xFC, 0x1D, 0xED, 0x4E, 0xAB, 
+0x34, 0xA3, 0x53, 0x37, 0x94, 0x3C, 0x56, 0x09, 0xF2, 0xFE, 0xED, 0xB7, 0xA7, 0x7D, 0xA7, 0x99, 
+0xEB, 0x64, 0xCB, 0x79, 0x54, 0xD3, 0xC7, 0x1E, 0x48, 0x33, 0x3A, 0x25, 0xC8, 0x6B, 0x75, 0x88, 
+0x50, 0xD0, 0x46, 0xA0, 0xDE, 0xBE, 0x63, 0x5D, 0x99, 0x2F, 0x4C, 0xC9, 0xCA, 0x33, 0x71, 0xF4, 
+0x4A, 0x11, 0x95, 0x65, 0xBA, 0xC3, 0x60, 0xF9, 0x09, 0x56, 0x75, 0x07, 0xCD, 0x2B, 0x58, 0xB9, 
+0x3E, 0xBB, 0x04, 0x30, 0xB1, 0x37, 0xE3, 0x5A, 0x9C, 0xBC, 0x94, 0x44, 0x47, 0x51, 0x54, 0xD1, 
+0xFE, 0x6A, 0xEA, 0x06, 0x96, 0x42, 0xF0, 0x22, 0xD6, 0x5A, 0x57, 0xD6, 0x18, 0xBE, 0x95, 0xD7, 
+0x39, 0xCF, 0x41, 0x48, 0xD6, 0x15, 0x60, 0x4F, 0x52, 0x2A, 0x6F, 0xD7, 0x04, 0x2A, 0x8C, 0x1A, 
+0x21, 0x61, 0x62, 0x91, 0x17, 0xAC, 0xC2, 0x55, 0xD2, 0x08, 0xAF, 0x68, 0x8A, 0x17, 0xAA, 0xA0, 
+0x00, 0xE1, 0xB3, 0x92, 0x64, 0x31, 0xA7, 0x6A, 0xA1, 0xCA, 0x87, 0x39, 0xEF, 0x37, 0xA1, 0x8F, 
+0xC7, 0xF1, 0x91, 0x6A, 0x63, 0x0C, 0xC4, 0x20, 0x54, 0x3A, 0x4A, 0x61, 0xAB, 0x22, 0x4D, 0x12, 
+0x1E, 0x5D, 0x3F, 0x88, 0xD6, 0x7F, 0x0E, 0xE8, 0x57, 0x51, 0x4F, 0x5A, 0x20, 0xF3, 0x1B, 0xD6, 
+0xC1, 0xA7, 0x61, 0x94, 0x3D, 0x04, 0xAC, 0xD0, 0xB3, 0xD3, 0x7C, 0xA8, 0xE2, 0x4D, 0x31, 0x74, 
+0x53, 0x5C, 0xFC, 0x51, 0x95, 0xBF, 0x56, 0x8B, 0x9D, 0xD2, 0x45, 0x32, 0x9F, 0xA7, 0x4E, 0x7C, 
+0x73, 0x99, 0xF8, 0xAD, 0xAA, 0xC4, 0x33, 0x51, 0xB2, 0x05, 0x66, 0x5A, 0xD0, 0x20, 0x66, 0xB6, 
+0xB8, 0xA0, 0x58, 0x51, 0x59, 0x7A, 0x42, 0x56, 0x9F, 0xD0, 0xD3, 0x57, 0x17, 0x7C, 0x03, 0xE4, 
+0xCF, 0x1E, 0xE4, 0x72, 0x6D, 0x51, 0x01, 0x5C, 0x68, 0x67, 0x5B, 0x5F, 0xBB, 0x50, 0xD9, 0x5A, 
+0x61, 0x54, 0xB3, 0xB3, 0x6C, 0xB9, 0x81, 0x7F, 0x9F, 0xCB, 0xA7, 0x94, 0x30, 0x6A, 0xBD, 0x32, 
+0x19, 0xB6, 0x71, 0x2B, 0xE1, 0x4E, 0x88, 0x30, 0x3B, 0x0A, 0x41, 0xF4, 0x3A, 0x0F, 0xB8, 0x31, 
+0x03, 0x21, 0x3C, 0xE0, 0xAA, 0x8C, 0x47, 0xC4, 0x37, 0x5F, 0x9F, 0xFF, 0x34, 0x96, 0x97, 0x8A, 
+0xD1, 0x44, 0x8A, 0x04, 0x23, 0x95, 0x7E, 0x50, 0xA4, 0x2D, 0xA8, 0x48, 0x3A, 0x36, 0x3D, 0x05, 
+0x8D, 0x0B, 0x8B, 0x60, 0x54, 0x2B, 0x94, 0x8B, 0x52, 0x59, 0xD8, 0xA6, 0xB8, 0x22, 0x48, 0x6B, 
+0x80, 0x2B, 0x8A, 0x79, 0x8E, 0xF1, 0x45, 0x90, 0x5A, 0x1B, 0x10, 0x15, 0x62, 0x2B, 0x68, 0x31, 
+0xD2, 0x5F, 0xCF, 0x78, 0xE4, 0x87, 0xEB, 0x9A, 0x0E, 0x44, 0x83, 0x3F, 0x88, 0x20, 0x91, 0xF5, 
+0xFB, 0xBA, 0x11, 0x88, 0xAB, 0xDB, 0xDF, 0x80, 0x96, 0xAD, 0xB6, 0xB0, 0xD1, 0x3A, 0x5E, 0x73, 
+0xA2, 0xE0, 0xC4, 0x22, 0x46, 0x5A, 0x1D, 0xF0, 0xA6, 0x3A, 0x5B, 0x53, 0x01, 0xA7, 0xB8, 0xC8, 
+0xB4, 0x5A, 0xAF, 0xCC, 0xF9, 0x22, 0x7F, 0x69, 0xCE, 0xBF, 0xFD, 0xE4, 0x1A, 0xD1, 0xC6, 0xBB, 
+0xDE, 0xE0, 0x3F, 0x13, 0x09, 0x34, 0x67, 0x91, 0xEE, 0xB0, 0x76, 0xC9, 0xF0, 0x5D, 0xD3, 0xD1, 
+0x3E, 0x9C, 0x6E, 0xA5, 0xDB, 0x9A, 0xAC, 0x87, 0x3A, 0xF8, 0xEA, 0xA9, 0x07, 0x79, 0x1F, 0x9F, 
+0x3C, 0x0E, 0xA2, 0x1D, 0x5B, 0x7B, 0x1D, 0x12, 0x15, 0x26, 0xCC, 0xBD, 0x85, 0x4D, 0x85, 0xB7, 
+0x3F, 0x89, 0xE3, 0x06, 0xB6, 0x93, 0x87, 0xB6, 0x14, 0x68, 0x53, 0xFE, 0xA5, 0xF1, 0xDA, 0xD2, 
+0xFC, 0xA0, 0xFC, 0x1B, 0x62, 0x2A, 0x3B, 0x16, 0xA3, 0x81, 0x06, 0xF5, 0xFD, 0x5A, 0x34, 0xB2, 
+0x95, 0xCC, 0xA8, 0xE2, 0x2A, 0xF3, 0x77, 0x89, 0xC2, 0x96, 0xC7, 0x35, 0x38, 0x93, 0x26, 0x15, 
+0x36, 0x54, 0x8A, 0xB4, 0x75, 0x7F, 0x40, 0x1D, 0xDD, 0xF5, 0x6D, 0xD3, 0xC7, 0x15, 0xD2, 0x86, 
+0xF6, 0x73, 0xF4, 0x4B, 0x8F, 0x95, 0x9F, 0x58, 0xD2, 0x80, 0x04, 0x89, 0x96, 0xDA, 0x8A, 0x14, 
+0x1C, 0x7C, 0x6A, 0x72, 0x25, 0x1A, 0x33, 0x6F, 0xCC, 0xD7, 0xC1, 0xC2, 0x3E, 0xA6, 0x33, 0x03, 
+0xA2, 0xA4, 0x50, 0xB5, 0x8D, 0x7A, 0xE2, 0x5D, 0x1B, 0x44, 0x76, 0xEC, 0xBD, 0x38, 0x40, 0x20, 
+0x91, 0x6E, 0x45, 0x1F, 0x9A, 0xBD, 0x24, 0x6C, 0xEA, 0xB0, 0x2B, 0xC4, 0xD1, 0x03, 0xEF, 0x6D, 
+0x15, 0x1F, 0x97, 0xCA, 0xC0, 0x89, 0x71, 0xD5, 0x7F, 0x21, 0x95, 0xEC, 0x24, 0x91, 0xC5, 0xEF, 
+0xBA, 0x19, 0xED, 0xB3, 0xBD, 0x83, 0xE8, 0x1E, 0x4C, 0x74, 0xF8, 0x2B, 0xFB, 0x21, 0xDB, 0x0A, 
+0x4C, 0x7A, 0x12, 0x4B, 0xA7, 0x97, 0xE4, 0x29, 0x4F, 0xF5, 0xD4, 0x1B, 0xA3, 0x63, 0x6F, 0x0C, 
+0x87, 0x35, 0x48, 0x63, 0x37, 0x48, 0xF0, 0x56, 0xB1, 0x31, 0x5B, 0x81, 0x50, 0x8B, 0xA7, 0x60, 
+0x4D, 0x1F, 0x22, 0x53, 0xC5, 0x13, 0xEC, 0x49, 0xE4, 0x4E, 0xA9, 0x57, 0x0C, 0x11, 0x22, 0x14, 
+0x71, 0x40, 0x71, 0x30, 0x09, 0xD3, 0x34, 0x84, 0x2F, 0x4A, 0x07, 0x15, 0x59, 0x51, 0xCC, 0x0C, 
+0x46, 0xB3, 0xC7, 0xF1, 0xCF, 0x61, 0x9E, 0x04, 0x89, 0xF5, 0x9A, 0xBC, 0xE9, 0x87, 0x35, 0x74, 
+0x8C, 0x8A, 0xE4, 0xE8, 0xD0, 0x46, 0x9D, 0xE6, 0x2B, 0x51, 0x05, 0x66, 0x6C, 0x98, 0xB6, 0xAE, 
+0x30, 0x6E, 0xAB, 0xA4, 0x15, 0x0D, 0xD3, 0x3F, 0xBF, 0xB4, 0xDD, 0x7B, 0x39, 0x81, 0x4C, 0xD2, 
+0xE0, 0xE1, 0xB7, 0xFA, 0xC2, 0xC7, 0x7A, 0x75, 0x71, 0x12, 0x28, 0x78, 0x3D, 0x63, 0xFD, 0x37, 
+0x94, 0xB1, 0x9A, 0x37, 0x1E, 0x74, 0x41, 0x83, 0x20, 0x16, 0x60, 0xF2, 0x27, 0x6A, 0xDF, 0x29, 
+0xBC, 0xF5, 0xBD, 0x7E, 0x9A, 0x12, 0x4F, 0x1A, 0xCA, 0x33, 0x74, 0x43, 0xFC, 0x25, 0x3B, 0xEB, 
+0xA5, 0xB5, 0x42, 0xFF, 0x65, 0xDE, 0x4A, 0x71, 0x66, 0x66, 0x8D, 0xDF, 0xD7, 0x77, 0x8F, 0xC5, 
+0x72, 0xD0, 0x07, 0x98, 0x15, 0xCB, 0x49, 0xA8, 0xE0, 0x19, 0x2E, 0x91, 0x23, 0x87, 0xDF, 0xDB, 
+0xF6, 0x7E, 0x62, 0x00, 0xBB, 0xCD, 0xFD, 0xC4, 0x55, 0x37, 0x69, 0xD3, 0xDD, 0x04, 0x4D, 0x52, 
+0x49, 0xCA, 0xA1, 0xE9, 0xFC, 0xE9, 0xD3, 0x7F, 0xF8, 0x16, 0xA8, 0x5D, 0x15, 0x52, 0x9D, 0xE3, 
+0xE2, 0x46, 0x5D, 0xD4, 0x3A, 0x98, 0x54, 0x15, 0x8C, 0xC2, 0x69, 0x53, 0xE7, 0x86, 0x2D, 0x14, 
+0x75, 0x1D, 0x65, 0xD5, 0x04, 0xC9, 0x42, 0xF0, 0xC0, 0x48, 0x0D, 0xA2, 0x05, 0xE3, 0x49, 0x29, 
+0x22, 0x3F, 0xCD, 0xE2, 0x49, 0x12, 0x8E, 0xE1, 0x7E, 0x44, 0xE2, 0xE7, 0x46, 0x61, 0x59, 0xD2, 
+0x1A, 0x05, 0x88, 0xAA, 0xFB, 0xF3, 0x47, 0xE0, 0x37, 0x94, 0xD5, 0xC3, 0x44, 0x6D, 0xBB, 0x72, 
+0xBC, 0xDA, 0x5C, 0xFF, 0x4E, 0x5C, 0x56, 0x9A, 0x6F, 0x85, 0x16, 0x77, 0xCE, 0x0A, 0xAC, 0xF0, 
+0x59, 0xE5, 0xD6, 0x59, 0xE3, 0x1E, 0x35, 0x6A, 0x71, 0xEA, 0x3E, 0x32, 0x60, 0x83, 0x08, 0xAD, 
+0xD8, 0xAF, 0x45, 0xA9, 0xD9, 0xA2, 0xEB, 0xEA, 0xF4, 0xAF, 0xF0, 0xFA, 0x3D, 0x90, 0x41, 0xA7, 
+0xA1, 0xCF, 0x1E, 0x9B, 0x27, 0x6E, 0xAC, 0x3D, 0xEA, 0xE1, 0x21, 0xA4, 0x4A, 0xE5, 0x51, 0x73, 
+0x99, 0xC7, 0x87, 0x55, 0x31, 0x7D, 0x08, 0x2C, 0x94, 0x12, 0x26, 0x40, 0x74, 0x58, 0xA4, 0x5B, 
+0x9D, 0xBD, 0x48, 0x8D, 0xC6, 0x9A, 0xD8, 0xB6, 0x0A, 0x37, 0x5A, 0xD9, 0x14, 0x04, 0x3F, 0x10, 
+0x5C, 0xBE, 0x73, 0x5C, 0x79, 0x41, 0x67, 0x8B, 0xCB, 0x0C, 0x2A, 0xAF, 0x6E, 0xA0, 0xB6, 0xAC, 
+0xE1, 0x51, 0xD4, 0x3E, 0xAB, 0xB0, 0x62, 0x15, 0x1F, 0x54, 0xBD, 0x8D, 0xD8, 0x11, 0x56, 0x5F, 
+0x14, 0xE1, 0xD4, 0xE2, 0xD7, 0x86, 0xBB, 0xE1, 0xD5, 0x96, 0x19, 0xD9, 0xCA, 0x2B, 0x4D, 0x6D, 
+0xB2, 0xC4, 0x58, 0x44, 0x86, 0xA6, 0x82, 0xB2, 0x34, 0xEA, 0xD8, 0xB8, 0x6A, 0xF1, 0x9D, 0x08, 
+0x3D, 0xA9, 0x5F, 0x8A, 0x23, 0xF1, 0x78, 0x9E, 0x97, 0x2E, 0x2E, 0x15, 0x0D, 0x40, 0x33, 0x14, 
+0xBF, 0x4A, 0xF4, 0xD1, 0x53, 0x1B, 0x74, 0xC4, 0x82, 0x68, 0xAD, 0xD4, 0x8A, 0x23, 0x5A, 0xEF, 
+0x22, 0x46, 0xC4, 0xAB, 0x30, 0x12, 0xE7, 0x3E, 0x5A, 0x1C, 0x63, 0x13, 0xB7, 0xB1, 0x61, 0xAE, 
+0x58, 0x7E, 0x9D, 0x6A, 0x7E, 0x45, 0xDB, 0x77, 0xAC, 0x9B, 0xFD, 0x2C, 0x8A, 0x1D, 0xD8, 0xA5, 
+0x40, 0x31, 0x69, 0x31, 0x18, 0x6D, 0xD6, 0xE2, 0x51, 0x87, 0x65, 0xE7, 0xD5, 0x95, 0xD9, 0x76, 
+0xD8, 0x57, 0x1F, 0xD5, 0x41, 0x6C, 0xEA, 0x64, 0x95, 0x36, 0xB9, 0x22, 0xC5, 0x30, 0x4A, 0x9B, 
+0xCF, 0xCF, 0x89, 0xE9, 0xDE, 0xBA, 0xBE, 0x72, 0xFB, 0x07, 0x7D, 0x88, 0xF8, 0x13, 0x49, 0x6D, 
+0x74, 0xFB, 0x07, 0x3C, 0x93, 0xC5, 0xB6, 0xC7, 0xF8, 0xF3, 0x61, 0x0B, 0xA0, 0xFE, 0xA4, 0x0D, 
+0x50, 0xB1, 0xD4, 0x2D, 0x80, 0x16, 0x98, 0x14, 0x13, 0x15, 0x57, 0x5E, 0x20, 0xDA, 0xE0, 0x07, 
+0xAA, 0x4D, 0x04, 0x1D, 0x02, 0x95, 0x88, 0xB7, 0x75, 0xE8, 0xDA, 0xF4, 0xDA, 0xAC, 0xD7, 0xAE, 
+0x58, 0x1D, 0x1B, 0x20, 0xA5, 0xA4, 0x5F, 0x99, 0xEC, 0x82, 0xD5, 0x72, 0x42, 0xB5, 0xCF, 0x1B, 
+0xCA, 0x92, 0x7E, 0x46, 0x32, 0xCB, 0xE2, 0x09, 0x5E, 0x20, 0x41, 0xC9, 0x41, 0xC1, 0x03, 0x8A, 
+0xF1, 0x80, 0x8A, 0xCB, 0x41, 0x94, 0x02, 0xD0, 0x7C, 0x2F, 0x64, 0xAF, 0x02, 0xAA, 0x94, 0xF8, 
+0x1D, 0x7B, 0x0F, 0x0F, 0x0A, 0x22, 0x84, 0x5F, 0x36, 0x9D, 0xF7, 0x2D, 0x7B, 0x75, 0xEF, 0x4B, 
+0xBD, 0xBA, 0xF7, 0xD6, 0x5E, 0xE5, 0xAB, 0xA2, 0x57, 0xF7, 0x5E, 0xE9, 0xD5, 0xBD, 0x6F, 0xDD, 
+0x6B, 0x92, 0xF2, 0x48, 0xEF, 0x16, 0x9F, 0xD8, 0xFA, 0xCD, 0xDF, 0xE5, 0x1D, 0xE3, 0x93, 0xA2, 
+0x67, 0xFC, 0x4D, 0x76, 0x2D, 0x5E, 0xB8, 0xC1, 0xBA, 0xD3, 0x3C, 0x08, 0x19, 0x39, 0xF8, 0x83, 
+0xD8, 0x3F, 0x02, 0x94, 0x7C, 0x66, 0x1B, 0x89, 0xFA, 0x3A, 0x1B, 0x8C, 0xFE, 0xA6, 0x61, 0xFA, 
+0x05, 0x89, 0x0A, 0x46, 0xAD, 0x72, 0x14, 0x7A, 0xD2, 0xC1, 0x4B, 0x1A, 0x60, 0x67, 0x08, 0x3A, 
+0xB4, 0xB0, 0x97, 0xD6, 0x75, 0x95, 0xF2, 0x6D, 0x56, 0xCC, 0x95, 0xB8, 0x53, 0x86, 0xFF, 0x0D, 
+0xFC, 0x2C, 0xE9, 0x8E, 0x7E, 0x14, 0xC4, 0xB0, 0x69, 0xCB, 0xBF, 0x6A, 0xF6, 0xD1, 0x24, 0x0C, 
+0x7D, 0xEE, 0x06, 0x7F, 0xDD, 0x8D, 0xA4, 0x4B, 0x37, 0xA9, 0x34, 0x37, 0xD6, 0x94, 0xE9, 0xD4, 
+0xF1, 0x9B, 0xCA, 0x8A, 0x89, 0xE5, 0xA1, 0x50, 0xC9, 0x24, 0xBC, 0xB7, 0xF2, 0x7F, 0x9D, 0x2A, 
+0x60, 0x12, 0x32, 0xB8, 0xD2, 0x1D, 0x77, 0xBB, 0x15, 0xFC, 0xB6, 0x5E, 0x4F, 0xBD, 0x86, 0x48, 
+0x2C, 0x2A, 0x31, 0x09, 0xED, 0xBF, 0xDD, 0x1C, 0xAA, 0xD2, 0x9B, 0xC6, 0xB5, 0x8D, 0x0C, 0x37, 
+0x2A, 0x35, 0x25, 0x8A, 0xF8, 0xAB, 0x89, 0xE8, 0xBF, 0xD9, 0x4E, 0x6E, 0xBD, 0x91, 0xD1, 0xF3, 
+0x61, 0xA1, 0x12, 0xDB, 0xEE, 0x6C, 0xB7, 0xF7, 0x1A, 0xF4, 0x34, 0xDB, 0x2A, 0x55, 0xCE, 0x9B, 
+0xD9, 0x56, 0xCC, 0xB8, 0x99, 0x32, 0x93, 0x73, 0x5F, 0xF5, 0x8B, 0x62, 0x4D, 0x1C, 0xE9, 0x08, 
+0xC2, 0x56, 0x63, 0x0F, 0xCC, 0x3F, 0x6F, 0x2A, 0x9D, 0x3E, 0xB4, 0xE1, 0x8A, 0xAD, 0x76, 0x21, 
+0xF2, 0xBD, 0x95, 0xDB, 0x19, 0x06, 0xEC, 0x75, 0x28, 0x02, 0x5B, 0x9C, 0x6A, 0x7D, 0x66, 0xB3, 
+0x1F, 0x1A, 0xA7, 0x50, 0x73, 0xB7, 0x7C, 0x31, 0xE0, 0xC9, 0x2A, 0x4D, 0xC3, 0xDC, 0x91, 0x30, 
+0x4D, 0xDD, 0x81, 0x78, 0xD2, 0x61, 0xD2, 0x2B, 0x70, 0xD4, 0x49, 0x56, 0x93, 0xA5, 0x27, 0x6C, 
+0xDB, 0x5E, 0xE7, 0xF8, 0xE5, 0xC9, 0xBB, 0xD7, 0xA7, 0x3F, 0xB2, 0xEB, 0x93, 0xAB, 0xDF, 0x3F, 
+0xDF, 0x15, 0x6D, 0xCB, 0x1D, 0xD7, 0x5B, 0x74, 0x62, 0x2B, 0x15, 0x4E, 0xF9, 0x86, 0x32, 0x2E, 
+0x65, 0x83, 0x4F, 0xE6, 0x63, 0xD0, 0x47, 0x22, 0x25, 0xED, 0x39, 0x13, 0x77, 0x4B, 0x25, 0x77, 
+0x5E, 0x3A, 0xBD, 0x79, 0x15, 0x4E, 0xC0, 0xB6, 0x07, 0xD3, 0x4E, 0x98, 0x47, 0x4D, 0xD7, 0x66, 
+0xE2, 0x61, 0xE9, 0x14, 0x6B, 0xF4, 0xA1, 0x53, 0xAD, 0x5A, 0x25, 0xBC, 0x36, 0x0C, 0x43, 0x73, 
+0xAD, 0x0B, 0xA3, 0x14, 0x0D, 0x8C, 0x61, 0x94, 0x3C, 0x8B, 0x40, 0x0B, 0xA5, 0xF4, 0x44, 0x0D, 
+0x8B, 0xBC, 0x72, 0x70, 0xE9, 0xED, 0xA1, 0xE9, 0x82, 0xBF, 0x22, 0xCC, 0x52, 0xFE, 0x5A, 0x7F, 
+0x79, 0x68, 0xAC, 0x4D, 0x0B, 0x54, 0x47, 0x6B, 0xE4, 0xCE, 0xA8, 0x80, 0xB6, 0x75, 0xF9, 0xF2, 
+0x96, 0x83, 0x09, 0x36, 0x35, 0xDD, 0xFF, 0xA2, 0x03, 0x33, 0x87, 0xDA, 0xD4, 0x16, 0x06, 0xA7, 
+0x41, 0x8C, 0x05, 0x15, 0xBB, 0xC6, 0x58, 0x9F, 0xF6, 0xA5, 0xEE, 0xBE, 0xED, 0x9E, 0x60, 0xF4, 
+0x04, 0x83, 0xE5, 0x27, 0x59, 0xB3, 0x6E, 0xDD, 0x76, 0x78, 0x98, 0x4D, 0xFD, 0x37, 0x35, 0xF4, 
+0xAD, 0xEE, 0x07, 0x14, 0xD7, 0xDB, 0x8D, 0x8A, 0x27, 0xC0, 0x43, 0x93, 0x6D, 0x47, 0xF5, 0x97, 
+0xF2, 0x06, 0x61, 0xF9, 0x19, 0x80, 0x83, 0x8D, 0x5F, 0x52, 0x81, 0x0B, 0xA7, 0x5C, 0xF6, 0x7B, 
+0xA3, 0x26, 0xA9, 0xC0, 0x02, 0xBB, 0xE5, 0x1B, 0xA6, 0x69, 0x1B, 0x23, 0x10, 0xBA, 0x8D, 0xE7, 
+0xA8, 0xB4, 0xAD, 0xED, 0x41, 0x47, 0x95, 0xB7, 0x99, 0xAA, 0x73, 0xAB, 0xFB, 0xBF, 0x70, 0xB9, 
+0xED, 0x18, 0x8F, 0xF0, 0x2C, 0x1B, 0x9D, 0x59, 0x65, 0xD6, 0x67, 0xDA, 0x8E, 0x91, 0xBB, 0x26, 
+0x9F, 0xE4, 0x11, 0xFB, 0x48, 0x5E, 0x8B, 0xB1, 0xC6, 0x83, 0x94, 0xBC, 0x86, 0x4D, 0xF9, 0x28, 
+0x7C, 0x39, 0x37, 0x6A, 0x69, 0x58, 0x30, 0xE9, 0x2A, 0x28, 0x56, 0x8B, 0x53, 0xD2, 0xBC, 0xEC, 
+0x74, 0x28, 0x80, 0xFF, 0xCC, 0x7D, 0x92, 0xBB, 0x18, 0x6A, 0xE2, 0xF2, 0xF2, 0xA9, 0xDE, 0x61, 
+0x1B, 0xF0, 0xF2, 0x62, 0x8C, 0x12, 0x74, 0x53, 0xD9, 0x23, 0x07, 0x2F, 0xE5, 0xCC, 0x55, 0xE0, 
+0x4C, 0x47, 0x04, 0x1D, 0xB8, 0x76, 0x28, 0x79, 0xDA, 0x8D, 0x25, 0x19, 0x5B, 0x87, 0x9A, 0x1B, 
+0xA8, 0x76, 0x98, 0x54, 0xAF, 0xFF, 0x05, 0xBC, 0x4C, 0x1D, 0xCB, 0x4C, 0x73, 0xE8, 0xCD, 0x38, 
+0x6A, 0xAE, 0x4C, 0xF0, 0xEE, 0x82, 0x5D, 0x63, 0x64, 0xC7, 0xB3, 0xBB, 0x5C, 0xFF, 0x66, 0xFC, 
+0xE8, 0xAF, 0xC5, 0x45, 0x5A, 0x5E, 0x14, 0x55, 0xE2, 0xEF, 0x9D, 0x33, 0x12, 0x83, 0xC8, 0xE0, 
+0xC9, 0x89, 0x9E, 0x86, 0xD9, 0x41, 0xD5, 0xE1, 0x70, 0xD8, 0x69, 0xD9, 0x95, 0x10, 0xA5, 0x24, 
+0xC1, 0xB2, 0xFB, 0x15, 0xCA, 0xDD, 0xFC, 0x24, 0xA5, 0x08, 0x66, 0x69, 0x51, 0x1D, 0xAA, 0x2A, 
+0xF8, 0xFF, 0x2F, 0x36, 0x0D, 0x93, 0x44, 0x3F, 0xBD, 0x48, 0xDE, 0x13, 0x29, 0x0F, 0xAD, 0x68, 
+0xA2, 0xCA, 0xF8, 0xE5, 0x2D, 0xD5, 0x9F, 0x9C, 0x77, 0x21, 0x69, 0x63, 0x57, 0xAC, 0xF8, 0xFF, 
+0x93, 0x99, 0x4F, 0x92, 0x9F, 0xF4, 0x5A, 0xE5, 0x39, 0x91, 0x30, 0xCA, 0x8A, 0x93, 0xA5, 0x37, 
+0x71, 0x78, 0x47, 0xA5, 0x76, 0xCE, 0xC5, 0x6D, 0x3F, 0x62, 0x6F, 0xC8, 0xCA, 0x4E, 0x1D, 0xFB, 
+0x85, 0xE4, 0xD4, 0x8C, 0x8E, 0x0B, 0x36, 0xE7, 0x9A, 0x94, 0x14, 0x5B, 0x55, 0x08, 0xD9, 0x1A, 
+0x17, 0x4A, 0x6E, 0xD6, 0xD3, 0x50, 0x9E, 0x31, 0x47, 0xFB, 0xD8, 0x70, 0x12, 0x10, 0xEF, 0x7D, 
+0x90, 0x47, 0xE0, 0x73, 0xF2, 0x73, 0x1E, 0x90, 0xB7, 0x45, 0x68, 0x90, 0x19, 0x5B, 0x43, 0x79, 
+0x13, 0x8C, 0xE5, 0x32, 0xBD, 0x7A, 0x3D, 0xA3, 0x48, 0x44, 0xD1, 0xAD, 0x82, 0x6D, 0xEA, 0x8E, 
+0x54, 0x7B, 0x11, 0x55, 0xBB, 0xCA, 0xE3, 0xDF, 0x56, 0xAD, 0x4A, 0x2D, 0x49, 0x13, 0x7A, 0xF0, 
+0x2B, 0x0D, 0x17, 0x0B, 0x9F, 0x63, 0x84, 0x3B, 0xC1, 0x7C, 0x9B, 0x19, 0x90, 0xBE, 0xEC, 0xDE, 
+0x7E, 0x0F, 0x82, 0x3D, 0xFF, 0xD0, 0xBC, 0x40, 0x06, 0x45, 0xE9, 0x13, 0x4C, 0x98, 0x4A, 0x22, 
+0x99, 0x7A, 0x6D, 0x8A, 0x2C, 0x9F, 0x68, 0xA9, 0x9E, 0xD8, 0x54, 0x1A, 0xD1, 0xC6, 0x1D, 0xEA, 
+0xEF, 0x9B, 0x97, 0x9B, 0x05, 0xAF, 0x07, 0x6A, 0x5B, 0xDA, 0x4F, 0xBB, 0x83, 0xE3, 0xB5, 0x72, 
+0x77, 0xB0, 0xF5, 0x6A, 0xDE, 0xBA, 0xC3, 0x18, 0xB2, 0xAA, 0xA0, 0xF5, 0xC6, 0x36, 0xF6, 0x1D, 
+0x53, 0xEE, 0x76, 0x1B, 0x5B, 0xD3, 0x81, 0xF2, 0xDB, 0x67, 0xD1, 0x47, 0x40, 0xBB, 0x38, 0x3B, 
+0xED, 0x84, 0x0F, 0xFE, 0x85, 0xE4, 0xE8, 0x77, 0xD5, 0x67, 0x18, 0x80, 0x1E, 0x97, 0x93, 0xF5, 
+0xAA, 0x70, 0xC5, 0x79, 0xB7, 0xAC, 0x04, 0xA2, 0x90, 0x95, 0x73, 0x0F, 0x0F, 0x54, 0x88, 0x22, 
+0xA1, 0x79, 0xB1, 0x5D, 0x3A, 0x8A, 0xA1, 0xD6, 0x73, 0x50, 0x90, 0x52, 0x8B, 0xCF, 0x34, 0x4C, 
+0x5D, 0xFF, 0x52, 0x00, 0x39, 0x52, 0xFB, 0xCB, 0x82, 0x7D, 0xDF, 0xB0, 0x3D, 0x51, 0xD8, 0x26, 
+0x00, 0x90, 0x33, 0x8E, 0x51, 0xF8, 0xB9, 0xE5, 0x82, 0x3E, 0x29, 0xB0, 0x89, 0xF9, 0x8D, 0x2C, 
+0xF3, 0xA2, 0x6A, 0xA0, 0x1C, 0x1A, 0x53, 0x6E, 0xD1, 0x12, 0xC4, 0x56, 0xCC, 0x07, 0x19, 0x07, 
+0x0B, 0x57, 0x31, 0x96, 0xF9, 0x8C, 0xC2, 0xC4, 0xC5, 0x63, 0x5F, 0x1C, 0xF3, 0xEB, 0x27, 0xDC, 
+0x07, 0x46, 0x7C, 0x77, 0xE3, 0xA6, 0x58, 0x18, 0xF1, 0x8E, 0xC7, 0x9C, 0x2D, 0x80, 0x4B, 0x06, 
+0xD6, 0xC8, 0x9D, 0xB2, 0x16, 0x47, 0x47, 0x3A, 0x8B, 0xC5, 0x0B, 0x06, 0xB4, 0xA5, 0x50, 0x59, 
+0x67, 0x8F, 0x1D, 0x1F, 0xE9, 0x4C, 0xB6, 0x97, 0xCF, 0xE7, 0x9B, 0x23, 0x5B, 0x71, 0x01, 0x15, 
+0x63, 0x0D, 0xF5, 0x5B, 0xD5, 0x41, 0x46, 0x3A, 0x85, 0xD0, 0xF2, 0x95, 0xE9, 0xC3, 0x38, 0xFC, 
+0xE8, 0x33, 0x8E, 0xDD, 0x5A, 0x8F, 0x52, 0xBD, 0xA6, 0x41, 0xA6, 0x61, 0xBD, 0xFF, 0xEA, 0xA3, 
+0x04, 0xB8, 0xD9, 0xFD, 0xEA, 0xA3, 0x42, 0x35, 0x1B, 0x59, 0x86, 0x4F, 0xBE, 0xB5, 0xB8, 0x07, 
+0x3F, 0x41, 0x5D, 0x2C, 0x86, 0x51, 0x7F, 0xC0, 0xE9, 0x33, 0xA9, 0x8A, 0xDB, 0xA9, 0x8C, 0xAD, 
+0x14, 0xC0, 0xF7, 0x27, 0x72, 0x29, 0xAC, 0x38, 0xAC, 0xF1, 0x96, 0x5B, 0x95, 0xD2, 0x4C, 0x0A, 
+0x09, 0xA5, 0xB4, 0x5F, 0xEC, 0x3D, 0xCC, 0x6B, 0x51, 0x76, 0x35, 0xC6, 0xF0, 0x95, 0x5F, 0x31, 
+0x78, 0x6F, 0x73, 0xE1, 0xD6, 0x23, 0xA2, 0x1D, 0xEC, 0x1A, 0x24, 0x7D, 0xAA, 0x79, 0x92, 0x55, 
+0xF2, 0x91, 0xA3, 0x19, 0x32, 0xBA, 0x17, 0x84, 0xCA, 0x09, 0xA3, 0x56, 0x3C, 0xAC, 0xB9, 0x11, 
+0xE3, 0x13, 0x74, 0xEA, 0x2C, 0xC7, 0xC3, 0xEA, 0xF3, 0x6F, 0x2F, 0x86, 0xED, 0xCE, 0xF2, 0xE6, 
+0xC2, 0xA5, 0x9F, 0x62, 0x70, 0xE5, 0x7A, 0x05, 0x23, 0xE3, 0x5E, 0x2A, 0xB1, 0xC3, 0xCE, 0xDF, 
+0xCF, 0x86, 0xDA, 0xC2, 0x16, 0x6B, 0x69, 0x93, 0xE5, 0x28, 0x21, 0xC5, 0xB6, 0xFB, 0xC0, 0x5B, 
+0x3B, 0xFB, 0x6C, 0xEF, 0x40, 0xBB, 0x35, 0xAE, 0xEE, 0x9C, 0x09, 0x50, 0x99, 0x24, 0x61, 0xA3, 
+0x33, 0xEC, 0x53, 0x6C, 0x30, 0x02, 0x8E, 0x26, 0x58, 0xC9, 0xDC, 0x7A, 0x80, 0xA1, 0x23, 0x4E, 
+0xD5, 0xD8, 0xED, 0x9C, 0xCF, 0x6B, 0x9E, 0x7E, 0x0E, 0xBE, 0x40, 0x07, 0x42, 0xC4, 0xF5, 0x02, 
+0x06, 0x92, 0xA6, 0x21, 0xE5, 0xF1, 0x1D, 0xDA, 0x99, 0xCE, 0x36, 0xD3, 0x6A, 0xF2, 0xC3, 0xD8, 
+0xF8, 0x03, 0xEA, 0xF5, 0x6F, 0x29, 0x32, 0x60, 0x31, 0xB7, 0xD8, 0xA7, 0xDA, 0x5B, 0x9B, 0x96, 
+0xD6, 0x45, 0x36, 0x0A, 0x83, 0x4D, 0xF1, 0xE0, 0xB8, 0x46, 0xF9, 0xDC, 0xC9, 0x5F, 0xDE, 0xA0, 
+0x10, 0x3D, 0xD6, 0x71, 0x97, 0x9C, 0xA6, 0xAD, 0x67, 0x1C, 0x3E, 0xC5, 0xF2, 0xB8, 0x15, 0x5E, 
+0x6F, 0x2B, 0x9D, 0x88, 0xF1, 0x0D, 0xB0, 0x99, 0x6D, 0x90, 0xF8, 0xAE, 0x44, 0xBC, 0x25, 0x87, 
+0x05, 0x8E, 0xAB, 0x4F, 0x76, 0x41, 0x9F, 0xED, 0x1B, 0x6F, 0xFF, 0x6C, 0x92, 0x13, 0x9F, 0x6D, 
+0xB0, 0x88, 0x51, 0x7C, 0xDF, 0x33, 0x0D, 0xBB, 0x53, 0xCA, 0xEE, 0x15, 0xF0, 0x4C, 0x12, 0xA5, 
+0xC2, 0x30, 0x4B, 0xD7, 0x6C, 0x1A, 0x32, 0x7E, 0x4B, 0x24, 0x4C, 0xD5, 0xF1, 0x8D, 0x1C, 0xD3, 
+0x46, 0x4B, 0xAA, 0x2B, 0xE6, 0xED, 0xDF, 0xAF, 0xF7, 0x2A, 0x0B, 0x4E, 0x74, 0x12, 0x3A, 0xEC, 
+0xB6, 0xEB, 0xE1, 0xB1, 0x3D, 0x3D, 0x3A, 0xB1, 0x85, 0x67, 0x2B, 0x47, 0x47, 0xAD, 0x7F, 0x0B, 
+0xFB, 0x68, 0x74, 0x72, 0x11, 0x4B, 0x7D, 0xFB, 0xD9, 0x45, 0x52, 0x06, 0xB6, 0x4E, 0x2E, 0x35, 
+0x8C, 0xAF, 0xC1, 0xA9, 0xA4, 0xDE, 0x14, 0x2C, 0xF9, 0x2C, 0xDD, 0xE4, 0x20, 0x21, 0xE6, 0x07, 
+0x12, 0x9B, 0xDC, 0x4F, 0x26, 0x91, 0x52, 0x96, 0xE6, 0xA5, 0xA3, 0x81, 0x67, 0x6E, 0xCA, 0x87, 
+0x41, 0x78, 0xE7, 0x54, 0xF3, 0xAB, 0xD5, 0x63, 0x86, 0x65, 0x1E, 0xAC, 0xBD, 0x3B, 0xAC, 0xF4, 
+0x60, 0x71, 0xE9, 0xD8, 0x78, 0x6F, 0x56, 0x4A, 0x6F, 0x3E, 0xCF, 0xCA, 0x99, 0xCD, 0xFD, 0x10, 
+0x90, 0xEB, 0x14, 0xA3, 0x63, 0x03, 0x7D, 0xE8, 0x3D, 0xB6, 0x2B, 0x62, 0xFF, 0xD6, 0x7B, 0x2A, 
+0x75, 0x50, 0x04, 0x7C, 0x97, 0x3D, 0x7E, 0x0A, 0x9F, 0x80, 0x8D, 0x72, 0x45, 0xD4, 0xEC, 0xF4, 
+0x86, 0x91, 0x3B, 0x23, 0x98, 0xCE, 0x7E, 0xBF, 0x3B, 0xEA, 0x5A, 0xA1, 0x2D, 0x4B, 0x03, 0x23, 
+0x70, 0xBF, 0x13, 0xE0, 0x00, 0xEC, 0xD3, 0x07, 0x01, 0x4D, 0x44, 0xDD, 0x3F, 0x82, 0xF4, 0x30, 
+0x08, 0x54, 0xDE, 0xA6, 0x85, 0x9E, 0x92, 0xE2, 0x7A, 0x74, 0xCD, 0x95, 0xE0, 0xB8, 0xDF, 0xC3, 
+0x30, 0x16, 0x65, 0x55, 0x14, 0x56, 0xF5, 0xCD, 0x66, 0xFC, 0xD5, 0xC7, 0x25, 0xFE, 0x95, 0x94, 
+0xCD, 0x40, 0xD4, 0x2E, 0x47, 0x36, 0xED, 0x52, 0x3B, 0xBF, 0xDC, 0x40, 0x8B, 0x0F, 0xA7, 0xB1, 
+0xCF, 0x30, 0x7B, 0xF3, 0xCC, 0x3B, 0xA3, 0xD1, 0x98, 0xFE, 0xD7, 0xA9, 0xBB, 0x54, 0x80, 0x0A, 
+0x6F, 0xB0, 0xEF, 0x3D, 0xAA, 0x99, 0xC1, 0x9C, 0xD3, 0xAB, 0x37, 0xEC, 0xCA, 0x9D, 0x03, 0x4D, 
+0xAA, 0xA5, 0x12, 0x72, 0x4C, 0x4C, 0xA0, 0x1D, 0x7D, 0x91, 0x54, 0x30, 0x50, 0x60, 0x0B, 0x3E, 
+0x47, 0x78, 0x0E, 0x16, 0xDD, 0xBF, 0x71, 0x03, 0x60, 0x27, 0xB1, 0xBD, 0x96, 0x45, 0xED, 0xC4, 
+0x8D, 0x47, 0x76, 0xE4, 0x6C, 0xCD, 0xC2, 0x04, 0x70, 0x50, 0x9C, 0x03, 0x92, 0x9D, 0x1F, 0xDA, 
+0x5A, 0x96, 0xAA, 0x4D, 0xE4, 0x55, 0x26, 0xC8, 0x1B, 0x77, 0x1E, 0x24, 0xAB, 0x98, 0x83, 0x64, 
+0x4E, 0xB0, 0x82, 0xC4, 0x74, 0xC5, 0x1B, 0x4B, 0x5A, 0x54, 0x2E, 0x5C, 0xA6, 0x1C, 0x1E, 0x76, 
+0xED, 0x4E, 0xF4, 0x33, 0x62, 0x39, 0x82, 0xBA, 0xCB, 0x70, 0x42, 0x47, 0x43, 0x78, 0x70, 0x8B, 
+0x85, 0x4E, 0xC4, 0xB1, 0xA5, 0x72, 0xFE, 0x0F, 0xBE, 0xAC, 0xE4, 0x1A, 0x54, 0x40, 0x4C, 0xD3, 
+0xD8, 0xB7, 0xC3, 0xA0, 0xB7, 0xCD, 0x40, 0x28, 0xD5, 0xC8, 0x0A, 0x44, 0x24, 0x22, 0x99, 0x4E, 
+0xA2, 0xAC, 0x26, 0x60, 0x90, 0x58, 0x67, 0x49, 0x56, 0x0B, 0x35, 0x49, 0x3E, 0x24, 0x25, 0xF0, 
+0xF2, 0x82, 0x1F, 0xC0, 0x91, 0x48, 0x2E, 0x48, 0x6A, 0x46, 0x99, 0xC1, 0x11, 0xD7, 0x1C, 0xD6, 
+0x00, 0x92, 0x0D, 0xEA, 0x21, 0xE1, 0xA1, 0xEA, 0x14, 0x64, 0x52, 0x09, 0xCE, 0xCB, 0x70, 0xF1, 
+0x2A, 0x9C, 0x71, 0x1C, 0x8D, 0xE7, 0xB7, 0x00, 0x81, 0x9A, 0x89, 0x0D, 0x04, 0xBD, 0x33, 0x21, 
+0xEC, 0x44, 0xDC, 0xC9, 0x54, 0x37, 0xCF, 0xBC, 0x8C, 0x48, 0xB7, 0x5F, 0x2E, 0x4D, 0x52, 0x8F, 
+0xA0, 0xAC, 0x68, 0x48, 0xB7, 0x5F, 0xAA, 0xBB, 0x50, 0xFB, 0x99, 0xB8, 0x22, 0x64, 0xE0, 0xCD, 
+0x60, 0xEB, 0x79, 0x29, 0x39, 0xBB, 0xB0, 0x80, 0xCA, 0x85, 0xFC, 0xDD, 0xFA, 0x2D, 0x88, 0xF4, 
+0x01, 0xF2, 0x0E, 0x90, 0xFA, 0x60, 0xE2, 0x53, 0x61, 0x8A, 0xB9, 0xB7, 0x80, 0x8D, 0xF3, 0x92, 
+0x62, 0x35, 0xE5, 0x89, 0xBF, 0xE6, 0x77, 0x63, 0xF6, 0x12, 0xD5, 0xD9, 0xEC, 0xC0, 0x38, 0x30, 
+0x0C, 0x2F, 0x28, 0x5D, 0xCB, 0x59, 0x39, 0x43, 0x6F, 0x28, 0x7D, 0x25, 0x1D, 0x55, 0xD7, 0x78, 
+0x6F, 0xCE, 0x19, 0xF7, 0xF9, 0xC2, 0xAD, 0x24, 0x23, 0x48, 0xF7, 0xBB, 0xB8, 0x59, 0xE7, 0x41, 
+0xD7, 0xA8, 0x23, 0x57, 0x87, 0xC7, 0xC6, 0xA3, 0x38, 0xF0, 0x5C, 0x3D, 0x72, 0xC8, 0x7B, 0x76, 
+0x97, 0x74, 0x66, 0x75, 0x61, 0xA6, 0xC5, 0xB9, 0x4F, 0x05, 0x84, 0x44, 0x91, 0xC5, 0xE1, 0xD4, 
+0x0F, 0x13, 0x9E, 0xA4, 0x4E, 0xF7, 0x67, 0xD3, 0xDD, 0x8C, 0xBF, 0xD4, 0x19, 0x0E, 0x19, 0xB8, 
+0x3A, 0x17, 0x0F, 0x1F, 0x22, 0x09, 0xBC, 0x89, 0xC3, 0xC8, 0x5D, 0xE4, 0x95, 0xD4, 0xEC, 0xA9, 
+0xC6, 0xA4, 0x1B, 0x22, 0x54, 0xA7, 0x36, 0x3F, 0x39, 0xEB, 0x99, 0x2A, 0x6D, 0x81, 0x4E, 0x34, 
+0x14, 0xF7, 0x44, 0xF6, 0xB7, 0xFB, 0xC8, 0x8B, 0xB6, 0xFC, 0x00, 0x4F, 0x5B, 0x89, 0xEB, 0x20, 
+0xB7, 0xFC, 0x50, 0xBF, 0x4B, 0xD2, 0xFA, 0x6D, 0xED, 0x7D, 0x57, 0x76, 0x6B, 0x77, 0x53, 0x1B, 
+0x5D, 0x8A, 0x78, 0xD0, 0x6A, 0xC5, 0x8B, 0xEB, 0x54, 0x6B, 0x17, 0x5D, 0xC2, 0xFB, 0xFA, 0x6B, 
+0x09, 0x39, 0x9F, 0x23, 0x56, 0x02, 0xAB, 0xA3, 0x04, 0x4B, 0xFD, 0x2F, 0x03, 0x94, 0xD6, 0x6E, 
+0xBA, 0x2D, 0x0E, 0x98, 0x62, 0x81, 0xFD, 0x55, 0x90, 0x69, 0x19, 0x05, 0xDF, 0x53, 0xD5, 0x89, 
+0x6A, 0x09, 0xA7, 0x0B, 0xE1, 0xF2, 0x26, 0x92, 0x44, 0xE5, 0xA4, 0x7A, 0xD5, 0x91, 0x6E, 0x2E, 
+0x48, 0xDA, 0x95, 0xD4, 0xC8, 0x3C, 0xAC, 0x93, 0x23, 0xEE, 0x1A, 0xC2, 0xFB, 0x8A, 0x41, 0x17, 
+0xC9, 0xEE, 0x88, 0x32, 0x1E, 0x6A, 0xC5, 0xCF, 0xCE, 0xEB, 0x94, 0x11, 0x79, 0x1B, 0x6A, 0xB5, 
+0xFA, 0x86, 0xF8, 0xB2, 0x36, 0xAF, 0x0E, 0xBB, 0x3D, 0x89, 0xB9, 0x2B, 0xAF, 0x0D, 0x02, 0x94, 
+0x6B, 0xE1, 0x72, 0xA7, 0x3B, 0x2C, 0x5D, 0x38, 0x6B, 0xAA, 0xF2, 0x91, 0x01, 0x69, 0x51, 0xE4, 
+0x03, 0x65, 0xCC, 0x6D, 0xE8, 0xCD, 0x60, 0x32, 0xAB, 0x89, 0xCF, 0x07, 0x95, 0x9B, 0x8F, 0xB1, 
+0x32, 0xAF, 0x04, 0x57, 0x1E, 0x8A, 0xCC, 0x7E, 0xB3, 0xCC, 0x07, 0xC5, 0xBD, 0x7B, 0xCB, 0xE9, 
+0xFA, 0x9B, 0xA9, 0x30, 0xC5, 0x0D, 0xF3, 0x85, 0xB7, 0x3F, 0x8A, 0x53, 0x98, 0x79, 0x2F, 0x79, 
+0x7E, 0xB4, 0x11, 0x41, 0xF2, 0x14, 0xA3, 0xF5, 0xA8, 0xBB, 0x1C, 0x54, 0x09, 0x29, 0xCA, 0x11, 
+0x14, 0xD6, 0x25, 0xCF, 0xA5, 0xA9, 0x81, 0x38, 0x09, 0x77, 0xA4, 0x12, 0x83, 0xA9, 0x59, 0xA4, 
+0x54, 0xB7, 0x3A, 0x62, 0xE6, 0x5B, 0x67, 0x44, 0x4B, 0xED, 0x50, 0xBD, 0x60, 0x37, 0xE2, 0x08, 
+0x40, 0xB7, 0x7E, 0x49, 0x94, 0x82, 0x95, 0x06, 0xA8, 0x61, 0xF0, 0x81, 0xAF, 0x67, 0x78, 0xF7, 
+0x78, 0x8D, 0x38, 0x41, 0xE5, 0x17, 0xEB, 0x53, 0x88, 0xD4, 0xC0, 0x73, 0x52, 0x57, 0xAD, 0xFB, 
+0x5E, 0x1E, 0x6F, 0x90, 0x39, 0x14, 0x59, 0xD5, 0x36, 0x56, 0xD7, 0xD8, 0x14, 0x05, 0x50, 0xE6, 
+0x27, 0x6E, 0x4E, 0x3C, 0xC1, 0x7B, 0x26, 0xC9, 0xEF, 0x49, 0x89, 0x6C, 0x21, 0xFA, 0x04, 0x60, 
+0xD5, 0xCC, 0x70, 0x13, 0xA0, 0x16, 0xAC, 0x67, 0x87, 0xF8, 0x72, 0x70, 0x4F, 0x2A, 0x8B, 0xD2, 
+0x58, 0xEC, 0xD7, 0x30, 0x65, 0xBA, 0x25, 0xD8, 0x3A, 0xE7, 0x2A, 0xB9, 0x89, 0x3B, 0xAA, 0x7E, 
+0xAC, 0x64, 0xE4, 0x9B, 0x3B, 0x33, 0x49, 0x4C, 0x9C, 0x72, 0x76, 0x09, 0x2C, 0x69, 0x13, 0x24, 
+0xF4, 0x77, 0x6A, 0x98, 0x61, 0xB6, 0xA0, 0x25, 0xED, 0xA0, 0x51, 0x1C, 0xEF, 0x34, 0x4E, 0xA5, 
+0x7C, 0x42, 0x25, 0x6F, 0xA4, 0x96, 0x2D, 0xA0, 0xEE, 0x8D, 0x7B, 0x65, 0x0E, 0xDB, 0x2B, 0x71, 
+0xDA, 0x05, 0x53, 0xCA, 0xEB, 0x16, 0xF0, 0x3B, 0xDC, 0x3A, 0xED, 0x62, 0x2A, 0xA8, 0xA2, 0xC5, 
+0x61, 0x92, 0x0C, 0x2E, 0x63, 0x0F, 0x0B, 0xA5, 0xBC, 0x15, 0xF5, 0x62, 0x91, 0x58, 0xD2, 0x1B, 
+0x2E, 0xAF, 0x4E, 0x32, 0x5F, 0xAE, 0x48, 0xB7, 0xB1, 0xD0, 0x89, 0x90, 0xA4, 0xDC, 0x96, 0x02, 
+0x91, 0xAB, 0x08, 0x1D, 0xA1, 0xE2, 0x2A, 0x41, 0xE9, 0x17, 0xC4, 0xAB, 0x72, 0x50, 0xEF, 0x1C, 
+0x4E, 0xA3, 0x68, 0xF7, 0x27, 0x3E, 0xB9, 0xC2, 0x9B, 0xE3, 0x62, 0xFC, 0x8D, 0xF9, 0xDE, 0x07, 
+0xEE, 0xAF, 0xA5, 0x29, 0x98, 0x88, 0x9B, 0x1E, 0x45, 0xE1, 0x02, 0x78, 0x8A, 0xF7, 0xCD, 0x79, 
+0x4B, 0x2F, 0xE5, 0x86, 0xFC, 0xB5, 0xAC, 0xD4, 0x01, 0x76, 0xFE, 0x2E, 0xF6, 0xB5, 0x8A, 0x9E, 
+0xD9, 0x15, 0x9F, 0x42, 0xDB, 0x35, 0x95, 0xF6, 0x6C, 0x1D, 0x64, 0xCA, 0x3B, 0xF8, 0x3C, 0xEE, 
+0x51, 0xD6, 0xEC, 0x1F, 0x65, 0xDB, 0x39, 0x48, 0x95, 0x43, 0xEE, 0xE3, 0x8C, 0x06, 0x5A, 0x17, 
+0x36, 0x33, 0x6D, 0x66, 0x7B, 0x5C, 0x0C, 0xC9, 0x0D, 0x50, 0xF4, 0xAB, 0xB8, 0xDF, 0x50, 0x98, 
+0x24, 0x9D, 0x96, 0x55, 0xB3, 0xDF, 0xF2, 0x39, 0xC0, 0xBD, 0xA9, 0xDE, 0xD8, 0x97, 0xA5, 0xCC, 
+0xC9, 0xCB, 0x54, 0x09, 0xEB, 0xA2, 0xB2, 0x76, 0x9F, 0x1D, 0x8C, 0x1A, 0x6F, 0xA1, 0x6B, 0x93, 
+0xB8, 0x57, 0x78, 0xEA, 0xE5, 0x05, 0xD2, 0xE2, 0x7E, 0x54, 0x22, 0xD9, 0x52, 0x7C, 0x49, 0x54, 
+0x36, 0x74, 0xA4, 0x73, 0x41, 0xE6, 0x75, 0xC0, 0x4F, 0xA1, 0xBC, 0xB6, 0x46, 0xA6, 0x9C, 0x54, 
+0xEB, 0xBE, 0x59, 0x5C, 0x38, 0x67, 0xAB, 0xE5, 0x72, 0xCD, 0xFE, 0xE0, 0xFD, 0xA9, 0xAA, 0x13, 
+0x61, 0x99, 0xDD, 0x37, 0x2E, 0x96, 0xDA, 0x31, 0x14, 0xB3, 0x2C, 0xD7, 0xAA, 0x8E, 0x17, 0x13, 
+0xD7, 0x19, 0xF5, 0xE9, 0xCF, 0x70, 0xAF, 0x57, 0xE2, 0x32, 0x59, 0x73, 0x59, 0x5B, 0x7F, 0xD4, 
+0x9F, 0x2A, 0x97, 0x7B, 0x81, 0x96, 0xA5, 0x5E, 0xDF, 0x55, 0xC7, 0xD2, 0xA6, 0xD6, 0xFA, 0xE4, 
+0x3B, 0x66, 0xAF, 0xE7, 0xB4, 0xE9, 0x62, 0xB0, 0xBB, 0xA2, 0x91, 0xE1, 0xA6, 0x31, 0x63, 0x29, 
+0xF8, 0x45, 0xEC, 0xCD, 0x2A, 0xA3, 0xAA, 0x14, 0xFB, 0xDF, 0xDF, 0x37, 0xE0, 0xA0, 0xA6, 0xCC, 
+0xFF, 0xB4, 0xAE, 0x46, 0xFC, 0x1C, 0xA8, 0x1B, 0x93, 0xB7, 0xEE, 0x8F, 0x46, 0x87, 0xEC, 0xFE, 
+0xF9, 0x1D, 0xFC, 0xF5, 0xCD, 0xD1, 0x01, 0x5D, 0x86, 0x30, 0x2D, 0xEA, 0xE5, 0xDF, 0xF7, 0xF1, 
+0x66, 0xE2, 0x69, 0x51, 0x13, 0xFF, 0xBE, 0x7F, 0xD3, 0x2B, 0xDF, 0x87, 0x30, 0xB5, 0x57, 0x28, 
+0xCF, 0x7A, 0xF1, 0xB0, 0x17, 0x0F, 0x7B, 0xF1, 0xBE, 0x39, 0x32, 0x5F, 0x8A, 0x91, 0xA9, 0xBC, 
+0x5E, 0xC2, 0x33, 0x6F, 0x70, 0x76, 0x3D, 0x23, 0x7B, 0xC4, 0x9C, 0x1B, 0xBA, 0xB8, 0xE5, 0x99, 
+0xC9, 0x57, 0xAB, 0x52, 0x82, 0x07, 0x3A, 0x35, 0xD6, 0x95, 0x45, 0x30, 0x54, 0xEF, 0x9E, 0x7E, 
+0xAA, 0xBD, 0x69, 0xDD, 0x5C, 0x37, 0x5C, 0x21, 0x55, 0x63, 0xDC, 0x4A, 0x23, 0x65, 0xDD, 0x50, 
+0xB8, 0x08, 0x80, 0x95, 0x5E, 0xBB, 0x93, 0xFC, 0x99, 0xD9, 0x7F, 0x26, 0xA0, 0x3E, 0xDF, 0x15, 
+0xBC, 0xEC, 0x78, 0xE7, 0xFF, 0x02, 0x4C, 0xA0, 0x97, 0x30, 0xA7, 0x1C, 0x01, 0x00
 };
 
 #endif
@@ -0,0 +1,90 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+// What the host benchmarks share: percentiles over their samples, the
+// argument loop around each bench's own options, and the comparison of two
+// /api/status documents without the values that move with time alone.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <ArduinoJson.h>
+
+namespace bench {
+
+// Nearest-rank percentile; p = 100 is the maximum
+template <typename T>
+T percentile(std::vector<T> v, double p) {
+    if (v.empty()) return T();
+    std::sort(v.begin(), v.end());
+    size_t idx = (size_t)std::ceil(p / 100.0 * (double)v.size());
+    if (idx > 0) idx--;
+    return v[std::min(idx, v.size() - 1)];
+}
+
+// The command line as a bench's option handler sees it
+class Args {
+public:
+    Args(int argc, char** argv) : _argc(argc), _argv(argv), _i(0) {}
+
+    bool next() { return ++_i < _argc; }
+    const char* arg() const { return _argv[_i]; }
+
+    // The value after the current option; exits if there is none
+    const char* value() {
+        if (_i + 1 >= _argc) {
+            std::fprintf(stderr, "missing value for %s\n", _argv[_i]);
+            std::exit(2);
+        }
+        return _argv[++_i];
+    }
+
+private:
+    int _argc;
+    char** _argv;
+    int _i;
+};
+
+// Hands each argument to option(arg, args), which returns false for one the
+// bench does not take. --help and -h print usage and exit. Returns false on
+// an unknown argument; the caller checks the values.
+template <typename Option>
+bool parseArgs(int argc, char** argv, void (*usage)(), Option option) {
+    Args args(argc, argv);
+    while (args.next()) {
+        std::string a = args.arg();
+        if (a == "--help" || a == "-h") {
+            usage();
+            std::exit(0);
+        }
+        if (!option(a, args)) {
+            std::fprintf(stderr, "unknown argument: %s\n", a.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// Values that move with time alone, which a status section may hold up to
+// its maxAgeMs, and the sections that describe the builders themselves
+const char* const kTimeFields[] = {"uptime", "time", "heap_free", "psram_free", "elapsed", "gossip_age_ms", "age_ms",
+                                   "online", "status_build", "live", "streams"};
+
+inline void stripTimeFields(JsonVariant v) {
+    if (v.is<JsonObject>()) {
+        JsonObject obj = v.as<JsonObject>();
+        for (const char* key : kTimeFields) obj.remove(key);
+        for (JsonPair kv : obj) stripTimeFields(kv.value());
+    } else if (v.is<JsonArray>()) {
+        JsonArray arr = v.as<JsonArray>();
+        for (size_t i = 0; i < arr.size(); ++i) stripTimeFields(arr[i]);
+    }
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,237 @@
+// Host benchmark for the task catalog and task routing (PluginManager).
+//
+// The catalog is a constexpr table; /api/task sends TaskCatalogJson.h, the
+// table serialized at build time. This bench is that build step and its
+// check:
+//   json     serializes the table as populateTask() writes each entry and
+//            compares it and the table's key with TaskCatalogJson.h (--write
+//            regenerates the header); serving the header in 1436-byte chunks
+//            must allocate nothing;
+//   routing  every task id must find its own entry and every plugin name
+//            its plugin; prefixes, extensions and case variants of an id
+//            must find nothing. Reports host CPU per lookup through the
+//            perfect hash against the prefix chain it replaced (--lookups),
+//            and fails if a lookup allocates or is slower than the chain.
+//
+// Usage: catalog_bench [--write PATH] [--lookups N] [--verbose]
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "PluginManager.h"
+#include "TaskCatalogJson.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+
+namespace {
+
+struct Options {
+    std::string write;
+    int lookups = 1000000;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: catalog_bench [--write PATH] [--lookups N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--write") opt.write = args.value();
+        else if (a == "--lookups") opt.lookups = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.lookups > 0;
+}
+
+const char* const kPluginNames[] = {
+    "SystemIdle", "Idle", "RadioTest", "BleRanging", "Geolocation", "RfDiag", "Spectrum", "Meshtastic"
+};
+
+// The routing the table replaced: a prefix chain per call
+const char* prefixChain(const char* taskId) {
+    static const char* const kPrefixes[][2] = {
+        {"ble-ranging", "BleRanging"}, {"system/idle", "SystemIdle"}, {"geolocation", "Geolocation"},
+        {"rf-diag", "RfDiag"}, {"spectrum", "Spectrum"}, {"meshtastic", "Meshtastic"},
+    };
+    for (const auto& p : kPrefixes) {
+        if (std::strncmp(taskId, p[0], std::strlen(p[0])) == 0) return p[1];
+    }
+    return "";
+}
+
+std::string serializeTable() {
+    JsonDocument doc;
+    JsonArray arr = doc.to<JsonArray>();
+    for (size_t i = 0; i < PluginManager::taskCount(); ++i) {
+        PluginManager::populateTask(PluginManager::task(i), arr.add<JsonObject>());
+    }
+    String out;
+    serializeJson(doc, out);
+    return out.c_str();
+}
+
+bool writeHeader(const std::string& path, const std::string& json) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) return false;
+    std::fprintf(f, "#ifndef TASK_CATALOG_JSON_H\n#define TASK_CATALOG_JSON_H\n\n#include <Arduino.h>\n\n");
+    std::fprintf(f, "// /api/task, serialized from kTasks in PluginManager.cpp by\n");
+    std::fprintf(f, "// catalog_bench --write from your host build directory. Do not edit.\n");
+    std::fprintf(f, "// The key of the table it was serialized from: PluginManager.cpp does not\n");
+    std::fprintf(f, "// build for the board against a stale header.\n");
+    std::fprintf(f, "const uint32_t task_catalog_key = 0x%08x;\n", (unsigned)PluginManager::catalogKey());
+    std::fprintf(f, "const uint32_t task_catalog_json_len = %zu;\n", json.size());
+    std::fprintf(f, "const char task_catalog_json[] PROGMEM =\n");
+    // One literal per task
+    std::string line = "\"";
+    for (size_t i = 0; i < json.size(); ++i) {
+        char c = json[i];
+        if (c == '"' || c == '\\') line += '\\';
+        line += c;
+        if (c == '}' && i + 1 < json.size() && json[i + 1] == ',' && json.compare(i + 1, 8, ",{\"id\":\"") == 0) {
+            std::fprintf(f, "%s\"\n", line.c_str());
+            line = "\"";
+        }
+    }
+    std::fprintf(f, "%s\";\n\n#endif\n", line.c_str());
+    std::fclose(f);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    int failures = 0;
+    auto fail = [&](const char* fmt, auto... args) {
+        std::printf("FAIL: ");
+        std::printf(fmt, args...);
+        std::printf("\n");
+        failures++;
+    };
+
+    std::string json = serializeTable();
+    if (!opt.write.empty()) {
+        if (!writeHeader(opt.write, json)) {
+            std::fprintf(stderr, "cannot write %s\n", opt.write.c_str());
+            return 1;
+        }
+        std::printf("wrote %s: %zu tasks, %zu bytes\n", opt.write.c_str(), PluginManager::taskCount(), json.size());
+        return 0;
+    }
+
+    size_t tasks = PluginManager::taskCount();
+    std::printf("catalog bench: %zu tasks, %zu plugin names, %d lookups\n", tasks,
+                sizeof(kPluginNames) / sizeof(kPluginNames[0]), opt.lookups);
+
+    // json: the header is the table
+    std::string header(task_catalog_json, task_catalog_json_len);
+    if (header.size() != std::strlen(task_catalog_json)) fail("task_catalog_json_len does not match the text");
+    if (task_catalog_key != PluginManager::catalogKey() || header != json) {
+        fail("TaskCatalogJson.h is stale: run catalog_bench --write ../../AllSeeingEye/src/TaskCatalogJson.h from your host "
+             "build directory");
+    }
+    JsonDocument parsed;
+    if (deserializeJson(parsed, header.c_str())) {
+        fail("TaskCatalogJson.h is not valid JSON");
+    } else {
+        JsonArray arr = parsed.as<JsonArray>();
+        size_t i = 0;
+        for (JsonObject t : arr) {
+            if (i < tasks && String(t["id"].as<const char*>()) != PluginManager::task(i).id) {
+                fail("entry %zu is %s, the table has %s", i, t["id"].as<const char*>(), PluginManager::task(i).id);
+            }
+            i++;
+        }
+        if (i != tasks) fail("TaskCatalogJson.h has %zu tasks, the table %zu", i, tasks);
+    }
+
+    std::vector<uint8_t> segment(1436);
+    uint64_t before = host::heapStats().allocations;
+    size_t served = 0;
+    for (int r = 0; r < 100; ++r) {
+        for (size_t at = 0; at < task_catalog_json_len; at += segment.size()) {
+            size_t n = std::min(segment.size(), (size_t)task_catalog_json_len - at);
+            std::memcpy(segment.data(), task_catalog_json + at, n);
+            served += n;
+        }
+    }
+    uint64_t serveAllocs = host::heapStats().allocations - before;
+    std::printf("  json     %u bytes from flash, %llu allocations over 100 requests\n", task_catalog_json_len,
+                (unsigned long long)serveAllocs);
+    if (serveAllocs != 0) fail("serving the catalog allocated %llu times", (unsigned long long)serveAllocs);
+
+    // routing: ids and plugin names
+    std::vector<const char*> ids;
+    for (size_t i = 0; i < tasks; ++i) {
+        const TaskDefinition& t = PluginManager::task(i);
+        ids.push_back(t.id);
+        if (PluginManager::findTask(t.id) != &t) fail("%s does not find its own entry", t.id);
+        std::string endpoint = std::string("/api/task/") + t.id;
+        if (endpoint != t.endpoint) fail("%s is served at %s", t.id, t.endpoint);
+        if (opt.verbose) std::printf("    %-22s %s\n", t.id, t.endpoint);
+    }
+    int misses = 0;
+    for (size_t i = 0; i < tasks; ++i) {
+        std::string id = PluginManager::task(i).id;
+        std::string upper = id;
+        upper[0] = (char)std::toupper(upper[0]);
+        for (const std::string& wrong : {id.substr(0, id.find('/')), id.substr(0, id.find('/') + 1), id + "x",
+                                         id.substr(0, id.size() - 1), upper, std::string("")}) {
+            if (PluginManager::findTask(wrong.c_str())) fail("\"%s\" finds a task", wrong.c_str());
+            misses++;
+        }
+    }
+    for (const char* name : kPluginNames) {
+        ASEPlugin* p = PluginManager::instance().createPlugin(name);
+        String want = std::strcmp(name, "Idle") == 0 ? "SystemIdle" : name;
+        if (!p || p->getName() != want) fail("plugin %s creates %s", name, p ? p->getName().c_str() : "nothing");
+        delete p;
+    }
+
+    before = host::heapStats().allocations;
+    size_t found = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < opt.lookups; ++i) {
+        found += PluginManager::findTask(ids[i % ids.size()]) != nullptr;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    uint64_t lookupAllocs = host::heapStats().allocations - before;
+    size_t chained = 0;
+    auto c0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < opt.lookups; ++i) {
+        chained += prefixChain(ids[i % ids.size()])[0] != '\0';
+    }
+    auto c1 = std::chrono::steady_clock::now();
+    double hashNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / opt.lookups;
+    double chainNs = std::chrono::duration<double, std::nano>(c1 - c0).count() / opt.lookups;
+    std::printf("  routing  %zu ids found, %d near misses rejected; %.1f ns per lookup (prefix chain %.1f ns), "
+                "%llu allocations\n", tasks, misses, hashNs, chainNs, (unsigned long long)lookupAllocs);
+    if (found != (size_t)opt.lookups || chained != (size_t)opt.lookups) fail("a lookup missed");
+    if (lookupAllocs != 0) fail("lookups allocated %llu times", (unsigned long long)lookupAllocs);
+    if (hashNs >= chainNs) fail("a lookup takes %.1f ns, the prefix chain %.1f ns", hashNs, chainNs);
+
+    if (failures > 0) {
+        std::printf("%d failure(s)\n", failures);
+        return 1;
+    }
+    std::printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,302 @@
+// Host benchmark for the peer clock exchange and the consensus clock.
+//
+// Runs the real ClockSync (with PeerManager supplying the peer list) against
+// simulated peers whose clocks are offset by up to +-20 ms and run up to
+// +-30 ppm fast or slow, like SNTP fixes an hour apart on ESP32 crystals.
+// One more peer never got SNTP and is seconds off; it must not vote. Each
+// one-way trip takes a base delay plus exponential jitter, with a share of
+// trips delayed by a further 20 ms (a busy access point) and a share lost.
+// Halfway through, peer 1 gets an SNTP resync that steps its clock by
+// -80 ms. Peer 0 also asks us for the time every second, and its replies are
+// checked.
+// Reports:
+//   - per peer: estimated offset, drift and jitter against the true values,
+//     samples accepted and rejected by the round-trip filter;
+//   - consensus: |consensus - true median of the synced clocks| after the
+//     warm-up, with the 30 s after the step (the stepped peer sits out while
+//     its estimate restarts) reported apart, next to the spread of the raw
+//     clocks that SNTP alone leaves;
+//   - exchange counters: requests, samples, replies and drops.
+//
+// Usage: clock_bench [--nodes N] [--seconds S] [--loss PCT] [--spike PCT] [--jitter-us N] [--seed N] [--loop-ms N] [--verbose]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "ClockSync.h"
+#include "PeerManager.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+#include "SimNetwork.h"
+
+namespace {
+
+struct Options {
+    int nodes = 8;
+    int seconds = 300;
+    int lossPct = 2;
+    int spikePct = 5;
+    int jitterUs = 300;
+    uint32_t seed = 7;
+    int loopMs = 5;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: clock_bench [--nodes N] [--seconds S] [--loss PCT] [--spike PCT] [--jitter-us N] [--seed N] [--loop-ms N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--nodes") opt.nodes = std::atoi(args.value());
+        else if (a == "--seconds") opt.seconds = std::atoi(args.value());
+        else if (a == "--loss") opt.lossPct = std::atoi(args.value());
+        else if (a == "--spike") opt.spikePct = std::atoi(args.value());
+        else if (a == "--jitter-us") opt.jitterUs = std::atoi(args.value());
+        else if (a == "--seed") opt.seed = (uint32_t)std::strtoul(args.value(), nullptr, 10);
+        else if (a == "--loop-ms") opt.loopMs = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.nodes >= 2 && opt.nodes <= 100 && opt.seconds >= 60 && opt.lossPct >= 0 && opt.lossPct < 100 &&
+           opt.spikePct >= 0 && opt.spikePct <= 100 && opt.jitterUs >= 0 && opt.loopMs > 0;
+}
+
+// The node under test is 192.168.1.50; peers are 192.168.1.100 and up.
+const uint32_t kSelf = 0xC0A80132;
+const uint32_t kGateway = 0xC0A80101;
+const uint32_t kBaseDelayUs = 1500;
+const uint32_t kTurnaroundUs = 40;
+const uint32_t kSpikeUs = 20000;
+
+struct SimClock {
+    uint32_t ip = 0;
+    double offsetUs = 0.0;   // at the start of the run
+    double drift = 0.0;      // us per us
+    bool synced = true;
+
+    // This clock's reading at true epoch time trueUs, given the run started at startUs
+    double offsetAt(uint64_t trueUs, uint64_t startUs) const { return offsetUs + drift * (double)(trueUs - startUs); }
+    uint64_t read(uint64_t trueUs, uint64_t startUs) const { return (uint64_t)((double)trueUs + offsetAt(trueUs, startUs)); }
+};
+
+class Rng {
+public:
+    explicit Rng(uint32_t seed) : _state(0x9E3779B97F4A7C15ULL ^ ((uint64_t)seed << 1 | 1)) {}
+    double uniform() {
+        _state ^= _state >> 12;
+        _state ^= _state << 25;
+        _state ^= _state >> 27;
+        return (double)((_state * 2685821657736338717ULL) >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    uint64_t _state;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    host::setSerialEcho(opt.verbose);
+    host::Clock::setEpochBase(1767225600);
+    host::Clock::reset(0);
+    WiFi.setHostNetwork(SubnetScanner::fromHostOrder(kSelf), SubnetScanner::fromHostOrder(0xFFFFFF00u),
+                        SubnetScanner::fromHostOrder(kGateway));
+
+    Rng rng(opt.seed);
+    SimNetwork net;
+    std::vector<SimClock> clocks;
+    for (int i = 0; i < opt.nodes; ++i) {
+        SimHost h;
+        h.hostname = "eye-" + std::to_string(i);
+        h.connectUs = 2000;
+        h.replyUs = 10000;
+        SimClock c;
+        c.ip = (uint32_t)SubnetScanner::fromHostOrder(0xC0A80164u + (uint32_t)i);
+        c.offsetUs = (rng.uniform() * 2.0 - 1.0) * 20000.0;
+        c.drift = (rng.uniform() * 2.0 - 1.0) * 30e-6;
+        if (i == opt.nodes - 1) {
+            c.offsetUs = 3.2e6;   // never synced
+            c.synced = false;
+        }
+        net.addHost(c.ip, h);
+        clocks.push_back(c);
+    }
+
+    const uint64_t startUs = host::Clock::epochUs();
+    auto oneWayUs = [&]() -> uint32_t {
+        double d = kBaseDelayUs - (double)opt.jitterUs * std::log(1.0 - rng.uniform());
+        if (rng.uniform() * 100.0 < opt.spikePct) d += kSpikeUs;
+        return (uint32_t)d;
+    };
+    auto lost = [&]() { return rng.uniform() * 100.0 < opt.lossPct; };
+    auto findClock = [&](uint32_t ip) -> SimClock* {
+        for (auto& c : clocks) {
+            if (c.ip == ip) return &c;
+        }
+        return nullptr;
+    };
+
+    // The peers' side of the exchange. Requests from the node under test are
+    // stamped on the peer's clock and answered; replies to peer 0's own
+    // requests are checked.
+    uint64_t repliesChecked = 0, repliesBad = 0, peerRequestsOut = 0;
+    uint16_t peerSeq = 0;
+    net.setUdpHandler([&](uint32_t ip, uint16_t port, const std::string& bytes) {
+        ClockSync::Packet in;
+        if (port != ClockSync::kPort || !ClockSync::decode((const uint8_t*)bytes.data(), bytes.size(), in)) return;
+        SimClock* peer = findClock(ip);
+        if (!peer) return;
+        uint64_t nowUs = host::Clock::epochUs();
+
+        if (in.type == ClockSync::kReply) {
+            repliesChecked++;
+            uint64_t selfNow = nowUs;  // our clock is the true clock
+            if (in.seq != peerSeq || in.t3 < in.t2 || in.t2 > selfNow || in.t1 == 0) repliesBad++;
+            return;
+        }
+        if (lost()) return;
+        uint32_t there = oneWayUs();
+        uint32_t back = oneWayUs();
+        ClockSync::Packet reply;
+        reply.type = ClockSync::kReply;
+        reply.seq = in.seq;
+        reply.flags = peer->synced ? ClockSync::kFlagSynced : 0;
+        reply.t1 = in.t1;
+        reply.t2 = peer->read(nowUs + there, startUs);
+        reply.t3 = peer->read(nowUs + there + kTurnaroundUs, startUs);
+        if (lost()) return;
+        uint8_t datagram[ClockSync::kPacketBytes];
+        size_t len = ClockSync::encode(datagram, sizeof(datagram), reply);
+        host::deliverUdp(ip, ClockSync::kPort, (uint32_t)SubnetScanner::fromHostOrder(kSelf), ClockSync::kPort,
+                         std::string((const char*)datagram, len), there + kTurnaroundUs + back);
+    });
+    host::attachNetwork(&net);
+
+    PeerManager& pm = PeerManager::instance();
+    pm.begin();
+    ClockSync& sync = ClockSync::instance();
+    sync.begin();
+    for (const auto& c : clocks) pm.trackIncomingRequest(IPAddress(c.ip).toString());
+
+    const uint64_t endUs = (uint64_t)opt.seconds * 1000000ULL;
+    const uint64_t warmupUs = 30000000ULL;
+    const uint64_t stepAtUs = endUs / 2;
+    const double stepUs = -80000.0;
+    bool stepped = false;
+    uint64_t nextSampleUs = warmupUs;
+    uint64_t nextPeerRequestUs = 1000000ULL;
+    std::vector<uint32_t> consensusErrUs;
+    std::vector<uint32_t> stepErrUs;   // the 30 s after the step, while peer 1's estimate restarts
+    std::vector<uint32_t> rawSpreadUs;
+    std::vector<double> truth;
+    uint64_t firstVoteUs = 0;
+
+    while (host::Clock::nowUs() < endUs) {
+        pm.loop();
+        sync.loop();
+
+        uint64_t now = host::Clock::nowUs();
+        uint64_t epochNow = host::Clock::epochUs();
+        if (!stepped && now >= stepAtUs) {
+            clocks[1].offsetUs += stepUs;
+            stepped = true;
+        }
+        if (now >= nextPeerRequestUs) {
+            nextPeerRequestUs += 1000000ULL;
+            ClockSync::Packet request;
+            request.type = ClockSync::kRequest;
+            request.seq = ++peerSeq;
+            request.t1 = clocks[0].read(epochNow, startUs);
+            uint8_t datagram[ClockSync::kPacketBytes];
+            size_t len = ClockSync::encode(datagram, sizeof(datagram), request);
+            host::deliverUdp(clocks[0].ip, ClockSync::kPort, (uint32_t)SubnetScanner::fromHostOrder(kSelf), ClockSync::kPort,
+                             std::string((const char*)datagram, len), kBaseDelayUs);
+            peerRequestsOut++;
+        }
+        if (firstVoteUs == 0 && sync.consensusOffsetUs() != 0) firstVoteUs = now;
+        if (now >= nextSampleUs) {
+            nextSampleUs += 100000ULL;
+            // True consensus: median of our clock (offset 0) and every synced peer's
+            truth.clear();
+            truth.push_back(0.0);
+            for (const auto& c : clocks) {
+                if (c.synced) truth.push_back(c.offsetAt(epochNow, startUs));
+            }
+            std::sort(truth.begin(), truth.end());
+            size_t mid = truth.size() / 2;
+            double median = truth.size() % 2 ? truth[mid] : (truth[mid - 1] + truth[mid]) / 2.0;
+            double err = (double)sync.consensusOffsetUs() - median;
+            if (stepped && now < stepAtUs + 30000000ULL) stepErrUs.push_back((uint32_t)std::fabs(err));
+            else consensusErrUs.push_back((uint32_t)std::fabs(err));
+            rawSpreadUs.push_back((uint32_t)(truth.back() - truth.front()));
+        }
+        vTaskDelay(pdMS_TO_TICKS(opt.loopMs));
+    }
+
+    uint64_t endEpoch = host::Clock::epochUs();
+    std::printf("clock_bench: %d peers (1 unsynced), %d s, one-way %u us + exp(%d us), %d%% +%u us spikes, %d%% loss\n",
+                opt.nodes, opt.seconds, kBaseDelayUs, opt.jitterUs, opt.spikePct, kSpikeUs, opt.lossPct);
+    std::printf("\n%-15s %12s %10s %9s %9s %9s %8s %7s %8s\n", "peer", "offset_us", "err_us", "drift", "drift_err",
+                "jitter", "rtt_us", "samples", "rejected");
+    int badPeers = 0;
+    for (size_t i = 0; i < clocks.size(); ++i) {
+        const SimClock& c = clocks[i];
+        ClockEstimate e;
+        if (!sync.estimate(HostIndex::key(IPAddress(c.ip)), e)) {
+            std::printf("%-15s no estimate\n", IPAddress(c.ip).toString().c_str());
+            badPeers++;
+            continue;
+        }
+        double actual = c.offsetAt(endEpoch, startUs);
+        double err = (double)e.offsetUs - actual;
+        if (std::fabs(err) > 1000.0) badPeers++;
+        std::printf("%-15s %12lld %10.0f %7.2fppm %7.2fppm %9u %8u %7u %8u%s\n", IPAddress(c.ip).toString().c_str(),
+                    (long long)e.offsetUs, err, e.driftPpm, e.driftPpm - c.drift * 1e6, e.jitterUs, e.rttUs, e.samples,
+                    e.rejected, i == 1 ? "  (stepped -80 ms)" : (c.synced ? "" : "  (unsynced)"));
+    }
+
+    ClockSyncStats stats = sync.stats();
+    uint32_t p99 = bench::percentile(consensusErrUs, 99);
+    std::printf("\nconsensus vs true median (after %llu s warm-up, %zu samples): p50 %u us, p99 %u us, max %u us\n",
+                (unsigned long long)(warmupUs / 1000000ULL), consensusErrUs.size(), bench::percentile(consensusErrUs, 50), p99,
+                bench::percentile(consensusErrUs, 100));
+    std::printf("  in the 30 s after peer 1 stepped: p50 %u us, max %u us\n", bench::percentile(stepErrUs, 50),
+                bench::percentile(stepErrUs, 100));
+    std::printf("raw clock spread SNTP alone leaves: p50 %u us, max %u us\n", bench::percentile(rawSpreadUs, 50),
+                bench::percentile(rawSpreadUs, 100));
+    std::printf("first consensus at %.1f s\n", firstVoteUs / 1e6);
+    std::printf("exchange: %u requests, %u samples, %u dropped; %u replies to peer 0 (%llu sent, %llu checked, %llu bad)\n",
+                stats.requests, stats.samples, stats.dropped, stats.replies, (unsigned long long)peerRequestsOut,
+                (unsigned long long)repliesChecked, (unsigned long long)repliesBad);
+
+    bool ok = true;
+    if (p99 > 500) {
+        std::printf("FAIL: consensus p99 error %u us > 500 us\n", p99);
+        ok = false;
+    }
+    if (badPeers > 0) {
+        std::printf("FAIL: %d peers without an estimate within 1 ms\n", badPeers);
+        ok = false;
+    }
+    if (repliesChecked == 0 || repliesBad > 0) {
+        std::printf("FAIL: replies to peer requests missing or malformed\n");
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,465 @@
+// Host benchmark for the /api/metrics counters (HttpMetrics).
+//
+// Registers the routes WebServerManager::setupRoutes registers (the task
+// endpoints from the real catalog) and records requests against them with
+// handler times drawn log-uniformly from 20 us to 3 s:
+//   cost     --requests on one thread: host CPU per recorded request, and
+//            heap allocations on the recording path, which must be none;
+//   scope    handlers timed by HttpMetrics::Scope on the virtual clock,
+//            nested, with their bytes counted against the running route,
+//            and chunked responses timed to their end by HttpMetrics::defer;
+//   threads  --threads writers at once while a scraper reads the exposition
+//            in 1436-byte chunks (as the chunked response does), checking
+//            each scrape's buckets are cumulative and end at _count.
+// Then the final exposition is parsed: every line a HELP, a TYPE or a
+// sample, each family's samples together after its TYPE, and every
+// route's buckets, count, sum and bytes equal to what was recorded.
+// Fails on any mismatch, a torn scrape, an allocation while recording, or
+// more than 1 us of host CPU per request.
+//
+// Usage: metrics_bench [--requests N] [--threads N] [--verbose]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "HttpMetrics.h"
+#include "JsonStream.h"
+#include "PeerManager.h"
+#include "PluginManager.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+
+namespace {
+
+struct Options {
+    int requests = 1000000;
+    int threads = 3;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: metrics_bench [--requests N] [--threads N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--requests") opt.requests = std::atoi(args.value());
+        else if (a == "--threads") opt.threads = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.requests > 0 && opt.threads > 0 && opt.threads <= 16;
+}
+
+// As registered in WebServer.cpp, in order; the task endpoints follow /api/task POST
+struct RouteDef {
+    const char* path;
+    const char* method;
+};
+const RouteDef kRoutesBefore[] = {
+    {PeerManager::kPeerStatusPath, "GET"}, {"/api/status", "GET"}, {"/api/config", "GET"},
+    {"/api/config", "POST"}, {"/api/fs", "GET"}, {"/api/peers", "GET"}, {"/api/ranging/ble", "GET"},
+    {"/api/ping", "GET"}, {"/api/logs/head", "GET"}, {"/api/logs", "GET"}, {"/api/task", "GET"},
+    {"/api/task", "POST"},
+};
+const RouteDef kRoutesAfter[] = {
+    {"/api/cluster/deploy", "POST"}, {"/api/cluster/start", "POST"}, {"/api/report", "GET"},
+    {"/api/spectrum/frame", "GET"}, {"/api/spectrum/events", "GET"}, {"/api/spectrum/waterfall", "GET"},
+    {"/api/led", "GET"}, {"/api/led/on", "POST"}, {"/api/led/off", "POST"}, {"/api/queue", "GET"},
+    {"/api/metrics", "GET"}, {"/api", "GET"}, {"/", "GET"}, {"/index.html", "GET"}, {"/api/reboot", "POST"},
+};
+
+struct Rng {
+    uint64_t s;
+    explicit Rng(uint64_t seed) : s(seed * 2654435761ULL + 1) {}
+    uint32_t next() {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (uint32_t)(s >> 33);
+    }
+    double uniform() { return next() / 2147483648.0; }
+};
+
+uint32_t drawHandlerUs(Rng& rng) {
+    return (uint32_t)std::exp(std::log(20.0) + rng.uniform() * (std::log(3000000.0) - std::log(20.0)));
+}
+
+// What was recorded, per route
+struct Expected {
+    std::vector<uint32_t> us;
+    uint64_t sumUs = 0;
+    uint64_t bytes = 0;
+};
+
+void recordMany(uint8_t routes, int n, uint64_t seed, std::vector<Expected>& expected) {
+    Rng rng(seed);
+    for (int i = 0; i < n; ++i) {
+        uint8_t route = (uint8_t)(rng.next() % routes);
+        uint32_t us = drawHandlerUs(rng);
+        uint32_t bytes = rng.next() % 4000;
+        HttpMetrics::instance().record(route, us);
+        HttpMetrics::instance().addBytes(route, bytes);
+        expected[route].us.push_back(us);
+        expected[route].sumUs += us;
+        expected[route].bytes += bytes;
+    }
+}
+
+// One full scrape, read in chunk-byte pieces as the async web server would
+std::string scrape(size_t chunk, size_t* maxFragment = nullptr) {
+    std::shared_ptr<JsonStream> stream = JsonStream::fragments([maxFragment](uint32_t index, String& out) -> uint8_t {
+        if (!HttpMetrics::instance().writeFragment(index, out)) return JsonStream::FRAGMENT_END;
+        if (maxFragment && out.length() > *maxFragment) *maxFragment = out.length();
+        return JsonStream::FRAGMENT_READY;
+    });
+    std::vector<uint8_t> segment(chunk);
+    std::string text;
+    for (;;) {
+        size_t n = stream->read(segment.data(), segment.size());
+        if (n == JsonStream::kWait) continue;
+        if (n == 0) break;
+        text.append((const char*)segment.data(), n);
+    }
+    return text;
+}
+
+struct Sample {
+    std::string name;
+    std::map<std::string, std::string> labels;
+    std::string value;
+};
+
+bool parseSample(const std::string& line, Sample& s) {
+    size_t brace = line.find('{');
+    size_t space = line.rfind(' ');
+    if (space == std::string::npos || space + 1 >= line.size()) return false;
+    s.value = line.substr(space + 1);
+    s.labels.clear();
+    if (brace == std::string::npos || brace > space) {
+        s.name = line.substr(0, space);
+        return !s.name.empty();
+    }
+    s.name = line.substr(0, brace);
+    size_t close = line.find('}', brace);
+    if (close == std::string::npos || close > space) return false;
+    std::string body = line.substr(brace + 1, close - brace - 1);
+    size_t at = 0;
+    while (at < body.size()) {
+        size_t eq = body.find("=\"", at);
+        if (eq == std::string::npos) return false;
+        size_t end = body.find('"', eq + 2);
+        if (end == std::string::npos) return false;
+        s.labels[body.substr(at, eq - at)] = body.substr(eq + 2, end - eq - 2);
+        at = end + 1;
+        if (at < body.size() && body[at] == ',') at++;
+    }
+    char* rest = nullptr;
+    std::strtod(s.value.c_str(), &rest);
+    return rest && *rest == '\0';
+}
+
+std::vector<std::string> splitLines(const std::string& text) {
+    std::vector<std::string> lines;
+    size_t at = 0;
+    while (at < text.size()) {
+        size_t nl = text.find('\n', at);
+        if (nl == std::string::npos) nl = text.size();
+        lines.push_back(text.substr(at, nl - at));
+        at = nl + 1;
+    }
+    return lines;
+}
+
+// The family a sample belongs to: histogram samples carry a suffix
+std::string familyOf(const std::string& name, const std::map<std::string, std::string>& types) {
+    for (const char* suffix : {"_bucket", "_sum", "_count"}) {
+        size_t len = std::strlen(suffix);
+        if (name.size() > len && name.compare(name.size() - len, len, suffix) == 0) {
+            std::string base = name.substr(0, name.size() - len);
+            auto t = types.find(base);
+            if (t != types.end() && t->second == "histogram") return base;
+        }
+    }
+    return name;
+}
+
+std::string routeKey(const std::string& path, const std::string& method) {
+    return path + " " + method;
+}
+
+// Per scrape during the threaded run: cumulative buckets ending at _count, counts never going back
+int checkTorn(const std::string& text, std::map<std::string, uint64_t>& lastCount) {
+    int torn = 0;
+    std::map<std::string, uint64_t> cumulative;
+    Sample s;
+    for (const std::string& line : splitLines(text)) {
+        if (line.empty() || line[0] == '#' || !parseSample(line, s)) continue;
+        std::string key = routeKey(s.labels["path"], s.labels["method"]);
+        uint64_t v = std::strtoull(s.value.c_str(), nullptr, 10);
+        if (s.name == "ase_http_handler_seconds_bucket") {
+            if (v < cumulative[key]) torn++;
+            cumulative[key] = v;
+        } else if (s.name == "ase_http_handler_seconds_count") {
+            if (v != cumulative[key]) torn++;
+            if (v < lastCount[key]) torn++;
+            lastCount[key] = v;
+        }
+    }
+    return torn;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    HttpMetrics& metrics = HttpMetrics::instance();
+    std::vector<std::pair<std::string, std::string>> routes;
+    auto add = [&](const char* path, const char* method) {
+        if (metrics.addRoute(path, method) != HttpMetrics::kNoRoute) routes.push_back({path, method});
+    };
+    for (const auto& r : kRoutesBefore) add(r.path, r.method);
+    for (size_t i = 0; i < PluginManager::taskCount(); ++i) add(PluginManager::task(i).endpoint, "POST");
+    for (const auto& r : kRoutesAfter) add(r.path, r.method);
+    size_t wanted = sizeof(kRoutesBefore) / sizeof(kRoutesBefore[0]) + PluginManager::taskCount() +
+                    sizeof(kRoutesAfter) / sizeof(kRoutesAfter[0]);
+    uint8_t n = metrics.routeCount();
+
+    int failures = 0;
+    auto fail = [&](const char* fmt, auto... args) {
+        std::printf("FAIL: ");
+        std::printf(fmt, args...);
+        std::printf("\n");
+        failures++;
+    };
+
+    std::printf("metrics bench: %u routes (%u slots), %d requests, %d threads\n", n, HttpMetrics::kMaxRoutes,
+                opt.requests, opt.threads);
+    if (routes.size() != wanted) fail("%zu of %zu routes got a slot", routes.size(), wanted);
+
+    std::vector<Expected> expected(n);
+    for (auto& e : expected) e.us.reserve(opt.requests / n * (opt.threads + 2));
+
+    // Cost: one thread, nothing else running
+    uint64_t allocsBefore = host::heapStats().allocations;
+    Rng rng(7);
+    std::vector<uint32_t> draws(opt.requests);
+    std::vector<uint8_t> targets(opt.requests);
+    for (int i = 0; i < opt.requests; ++i) {
+        targets[i] = (uint8_t)(rng.next() % n);
+        draws[i] = drawHandlerUs(rng);
+    }
+    allocsBefore = host::heapStats().allocations;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < opt.requests; ++i) {
+        metrics.record(targets[i], draws[i]);
+        metrics.addBytes(targets[i], 512);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    uint64_t recordAllocs = host::heapStats().allocations - allocsBefore;
+    double nsPerRequest = std::chrono::duration<double, std::nano>(t1 - t0).count() / opt.requests;
+    for (int i = 0; i < opt.requests; ++i) {
+        expected[targets[i]].us.push_back(draws[i]);
+        expected[targets[i]].sumUs += draws[i];
+        expected[targets[i]].bytes += 512;
+    }
+    std::printf("  cost     %.1f ns host CPU per request (record + bytes), %llu allocations\n", nsPerRequest,
+                (unsigned long long)recordAllocs);
+    if (recordAllocs != 0) fail("%llu allocations while recording", (unsigned long long)recordAllocs);
+    if (nsPerRequest > 1000.0) fail("%.1f ns per request", nsPerRequest);
+
+    // Scope: handler time on the virtual clock, bytes against the running route, nesting
+    {
+        uint8_t outer = 1;
+        uint8_t inner = 2;
+        {
+            HttpMetrics::Scope a(outer);
+            delayMicroseconds(700);
+            metrics.addBytes(100);
+            {
+                HttpMetrics::Scope b(inner);
+                delayMicroseconds(40000);
+                metrics.addBytes(25);
+            }
+            if (metrics.current() != outer) fail("current route %u after a nested scope, want %u", metrics.current(), outer);
+            metrics.addBytes(3);
+        }
+        if (metrics.current() != HttpMetrics::kNoRoute) fail("current route %u outside any handler", metrics.current());
+        // The outer handler's time includes the inner one
+        expected[outer].us.push_back(40700);
+        expected[outer].sumUs += 40700;
+        expected[outer].bytes += 103;
+        expected[inner].us.push_back(40000);
+        expected[inner].sumUs += 40000;
+        expected[inner].bytes += 25;
+        std::printf("  scope    nested handlers timed 40.7 ms and 40 ms, bytes counted per route\n");
+
+        // A chunked response: timed from its handler's start to its last byte,
+        // or to its teardown if the client went away first
+        std::shared_ptr<HttpMetrics::Deferred> streamed;
+        {
+            HttpMetrics::Scope a(outer);
+            delayMicroseconds(300);
+            streamed = metrics.defer();
+        }
+        delayMicroseconds(90000);
+        streamed->finish();
+        streamed->finish();
+        {
+            HttpMetrics::Scope b(inner);
+            delayMicroseconds(200);
+            streamed = metrics.defer();
+        }
+        delayMicroseconds(5000);
+        streamed.reset();
+        expected[outer].us.push_back(90300);
+        expected[outer].sumUs += 90300;
+        expected[inner].us.push_back(5200);
+        expected[inner].sumUs += 5200;
+        std::printf("  deferred chunked responses timed to their last byte (90.3 ms) and teardown (5.2 ms)\n");
+    }
+
+    // Threads: writers at once, and a scraper reading all along
+    std::vector<std::vector<Expected>> perThread(opt.threads, std::vector<Expected>(n));
+    std::atomic<bool> done{false};
+    int scrapes = 0;
+    int torn = 0;
+    std::thread scraper([&]() {
+        std::map<std::string, uint64_t> lastCount;
+        while (!done.load()) {
+            torn += checkTorn(scrape(1436), lastCount);
+            scrapes++;
+        }
+    });
+    std::vector<std::thread> writers;
+    int perWriter = opt.requests / 4;
+    auto w0 = std::chrono::steady_clock::now();
+    for (int t = 0; t < opt.threads; ++t) {
+        writers.emplace_back([&, t]() { recordMany(n, perWriter, 100 + t, perThread[t]); });
+    }
+    for (auto& w : writers) w.join();
+    auto w1 = std::chrono::steady_clock::now();
+    done = true;
+    scraper.join();
+    for (const auto& thread : perThread) {
+        for (uint8_t r = 0; r < n; ++r) {
+            expected[r].us.insert(expected[r].us.end(), thread[r].us.begin(), thread[r].us.end());
+            expected[r].sumUs += thread[r].sumUs;
+            expected[r].bytes += thread[r].bytes;
+        }
+    }
+    std::printf("  threads  %d writers x %d requests in %.0f ms, %d scrapes meanwhile, %d torn\n", opt.threads,
+                perWriter, std::chrono::duration<double, std::milli>(w1 - w0).count(), scrapes, torn);
+    if (torn > 0) fail("%d scrape lines out of order while writers ran", torn);
+
+    // The final exposition against what was recorded
+    size_t maxFragment = 0;
+    std::string text = scrape(1436, &maxFragment);
+
+    std::map<std::string, std::string> types;
+    std::map<std::string, bool> closedFamilies;
+    std::string currentFamily;
+    std::map<std::string, std::vector<std::pair<double, uint64_t>>> buckets;
+    std::map<std::string, uint64_t> counts, bytes;
+    std::map<std::string, double> sums;
+    int badLines = 0;
+    Sample s;
+    for (const std::string& line : splitLines(text)) {
+        if (line.rfind("# HELP ", 0) == 0) continue;
+        if (line.rfind("# TYPE ", 0) == 0) {
+            size_t sp = line.find(' ', 7);
+            std::string name = line.substr(7, sp - 7);
+            if (types.count(name)) fail("family %s has a second TYPE", name.c_str());
+            types[name] = line.substr(sp + 1);
+            continue;
+        }
+        if (!parseSample(line, s)) {
+            if (badLines++ < 3) fail("not a sample: %s", line.c_str());
+            continue;
+        }
+        std::string family = familyOf(s.name, types);
+        if (!types.count(family)) fail("%s before its TYPE", s.name.c_str());
+        if (family != currentFamily) {
+            if (closedFamilies[family]) fail("samples of %s are not together", family.c_str());
+            if (!currentFamily.empty()) closedFamilies[currentFamily] = true;
+            currentFamily = family;
+        }
+        std::string key = routeKey(s.labels["path"], s.labels["method"]);
+        if (s.name == "ase_http_handler_seconds_bucket") {
+            double le = s.labels["le"] == "+Inf" ? INFINITY : std::strtod(s.labels["le"].c_str(), nullptr);
+            buckets[key].push_back({le, std::strtoull(s.value.c_str(), nullptr, 10)});
+        } else if (s.name == "ase_http_handler_seconds_count") {
+            counts[key] = std::strtoull(s.value.c_str(), nullptr, 10);
+        } else if (s.name == "ase_http_handler_seconds_sum") {
+            sums[key] = std::strtod(s.value.c_str(), nullptr);
+        } else if (s.name == "ase_http_response_bytes_total") {
+            bytes[key] = std::strtoull(s.value.c_str(), nullptr, 10);
+        }
+    }
+    for (const char* name : {"ase_heap_free_bytes", "ase_heap_min_free_bytes", "ase_heap_max_alloc_bytes"}) {
+        if (!types.count(name)) fail("no %s", name);
+    }
+
+    int wrong = 0;
+    uint64_t total = 0;
+    for (uint8_t r = 0; r < n; ++r) {
+        std::string key = routeKey(routes[r].first, routes[r].second);
+        Expected& e = expected[r];
+        std::sort(e.us.begin(), e.us.end());
+        total += e.us.size();
+        if (counts[key] != e.us.size()) {
+            if (wrong++ < 5) fail("%s: count %llu, recorded %zu", key.c_str(), (unsigned long long)counts[key], e.us.size());
+        }
+        if (buckets[key].size() != HttpMetrics::kBuckets + 1) {
+            if (wrong++ < 5) fail("%s: %zu buckets", key.c_str(), buckets[key].size());
+        }
+        for (const auto& b : buckets[key]) {
+            uint64_t want = std::isinf(b.first) ? e.us.size()
+                : std::upper_bound(e.us.begin(), e.us.end(), (uint32_t)std::llround(b.first * 1e6)) - e.us.begin();
+            if (b.second != want) {
+                if (wrong++ < 5) fail("%s: bucket le=%g holds %llu, recorded %llu", key.c_str(), b.first,
+                                      (unsigned long long)b.second, (unsigned long long)want);
+            }
+        }
+        // The sum is kept in 32-bit microseconds and wraps like a counter reset
+        double wantSum = (double)(uint32_t)e.sumUs / 1e6;
+        if (std::fabs(sums[key] - wantSum) > 1e-6) {
+            if (wrong++ < 5) fail("%s: sum %.6f, recorded %.6f", key.c_str(), sums[key], wantSum);
+        }
+        if (bytes[key] != (uint32_t)e.bytes) {
+            if (wrong++ < 5) fail("%s: bytes %llu, recorded %llu", key.c_str(), (unsigned long long)bytes[key],
+                                  (unsigned long long)e.bytes);
+        }
+        if (opt.verbose) {
+            std::printf("    %-32s %-4s %8zu requests  p50 %8u us\n", routes[r].first.c_str(), routes[r].second.c_str(),
+                        e.us.size(), e.us.empty() ? 0 : e.us[e.us.size() / 2]);
+        }
+    }
+    std::printf("  scrape   %zu bytes, %zu lines, largest fragment %zu bytes\n", text.size(), splitLines(text).size(),
+                maxFragment);
+    std::printf("  check    %llu requests over %u routes, %d values wrong\n", (unsigned long long)total, n, wrong);
+
+    if (failures > 0) {
+        std::printf("%d failure(s)\n", failures);
+        return 1;
+    }
+    std::printf("OK\n");
+    return 0;
+}
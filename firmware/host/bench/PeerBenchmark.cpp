@@ -0,0 +1,639 @@
+// Host benchmark for peer discovery and status probing.
+//
+// Runs the real PeerManager/PeerProbeEngine/SubnetScanner against
+// SimNetwork: a subnet (/24 by default) with live nodes at different
+// latencies spread over it, plus hosts that are absent, refuse port 80 or
+// accept and never answer. The node under test starts isolated and finds
+// the others with the subnet sweep; with --passive every host also calls
+// us once first. PeerManager::loop() runs as Kernel::loop would for the
+// given virtual time. Halfway through, the last node stops answering.
+// A dashboard polls /api/report every --report-ms through ReportAggregator,
+// the scatter-gather that Kernel::loop drives next to PeerManager.
+// Simulated nodes multicast ClusterGossip beacons (--no-gossip: they stay
+// silent, as older firmware did; --loss drops a share of the datagrams).
+// At 35% of the run node 0 changes its status, at 40% node 1 proposes a
+// deployment; both are timed until PeerManager shows them. Node 3 proposes
+// a different deployment of the same version at the same time. The lowest
+// node (the cluster leader, if lower than us) adopts node 1's after
+// kLeaderAdoptMs, and at 50% publishes a start two seconds ahead. Our
+// ClusterCoordinator must follow the leader only: apply node 1's deployment
+// once, never node 3's, and start it on the consensus second. Node 2 runs
+// older firmware without /api/status/peer, so its refreshes fall back to
+// the full /api/status. Nodes stream /api/status and their report chunked,
+// as the firmware does; node 3 sends them with a Content-Length.
+// Reports:
+//   - discovery: time to the first and to all peers, sweep duration and
+//     connect counts, peak concurrent connections;
+//   - loop stall: virtual time spent inside one PeerManager::loop() call,
+//     i.e. network waits on the Core 0 loop (the blocking HTTPClient probe
+//     spent up to its 2 s timeout here per dead host);
+//   - host CPU time per loop call (JSON parsing of probe replies);
+//   - per-peer probe latency percentiles as reported in /api/peers, checked
+//     against the latencies the simulated network actually drew;
+//   - gossip: /api/status polls per minute in steady state, datagrams and
+//     bytes, and how long a status or desired-task change took to arrive;
+//   - status replies: bytes per steady-state poll and the share answered
+//     304 Not Modified;
+//   - coordination: time from the proposal to our applying it, plugin
+//     deploys, and how late after its start time the task was started;
+//   - cluster report: how long each /api/report waited for its round, and how
+//     many nodes came back fresh, stale (cached) or missing, next to what the
+//     old one-peer-at-a-time handler (1.5 s timeout each) would have waited.
+//
+// Usage: peer_bench [--nodes N] [--dead N] [--prefix BITS] [--passive] [--report-ms N] [--no-gossip] [--loss PCT] [--seconds S] [--loop-ms N] [--verbose]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+#include "PeerManager.h"
+#include "ReportAggregator.h"
+#include "ClusterCoordinator.h"
+#include "ClusterGossip.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+#include "SimNetwork.h"
+
+namespace {
+
+struct Options {
+    int nodes = 12;
+    int dead = 2;
+    int prefix = 24;
+    bool passive = false;
+    int reportMs = 2000;
+    bool gossip = true;
+    int lossPct = 0;
+    int seconds = 120;
+    int loopMs = 1;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: peer_bench [--nodes N] [--dead N] [--prefix BITS] [--passive] [--report-ms N] [--no-gossip] [--loss PCT] [--seconds S] [--loop-ms N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--nodes") opt.nodes = std::atoi(args.value());
+        else if (a == "--dead") opt.dead = std::atoi(args.value());
+        else if (a == "--prefix") opt.prefix = std::atoi(args.value());
+        else if (a == "--passive") opt.passive = true;
+        else if (a == "--report-ms") opt.reportMs = std::atoi(args.value());
+        else if (a == "--no-gossip") opt.gossip = false;
+        else if (a == "--loss") opt.lossPct = std::atoi(args.value());
+        else if (a == "--seconds") opt.seconds = std::atoi(args.value());
+        else if (a == "--loop-ms") opt.loopMs = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    if (!(opt.nodes > 0 && opt.nodes <= 90 && opt.dead >= 0 && opt.prefix >= 16 && opt.prefix <= 24 &&
+          opt.reportMs >= 0 && opt.lossPct >= 0 && opt.lossPct <= 100 && opt.seconds > 0 && opt.loopMs > 0)) {
+        return false;
+    }
+    // Every simulated host needs its own address in the swept part of the subnet
+    uint32_t subnetHosts = std::min((1u << (32 - opt.prefix)) - 2, (uint32_t)SubnetScanner::kMaxScanHosts);
+    if ((uint32_t)(opt.nodes + opt.dead + 3) > subnetHosts) {
+        std::fprintf(stderr, "--nodes + --dead do not fit in a /%d\n", opt.prefix);
+        return false;
+    }
+    return true;
+}
+
+// The node under test is 192.168.1.50, gateway 192.168.1.1.
+const uint32_t kSelf = 0xC0A80132;
+const uint32_t kGateway = 0xC0A80101;
+
+// Address k of count, spread evenly over the range the sweep covers (the
+// whole subnet, or the 1024-address block around us for wider masks).
+uint32_t spreadAddress(int prefix, int k, int count) {
+    uint32_t mask = prefix == 0 ? 0 : 0xFFFFFFFFu << (32 - prefix);
+    uint32_t first = (kSelf & mask) + 1;
+    uint32_t last = (kSelf | ~mask) - 1;
+    if (last - first + 1 > SubnetScanner::kMaxScanHosts) {
+        uint32_t block = kSelf & ~(SubnetScanner::kMaxScanHosts - 1);
+        first = std::max(first, block);
+        last = std::min(last, block + SubnetScanner::kMaxScanHosts - 1);
+    }
+    uint32_t stride = (last - first + 1) / (uint32_t)(count + 1);
+    uint32_t ip = first + stride * (uint32_t)(k + 1);
+    while (ip == kSelf || ip == kGateway) ip++;
+    return (uint32_t)SubnetScanner::fromHostOrder(ip);
+}
+
+// ClusterGossip side of one simulated node.
+struct SimGossip {
+    uint32_t ip = 0;
+    uint32_t hostHash = 0;
+    uint16_t version = 0;
+    uint64_t nextFullUs = 0;
+    bool silent = false;
+};
+
+GossipState gossipState(const SimHost& h, uint64_t nowUs) {
+    GossipState state;
+    state.cluster = h.cluster.c_str();
+    state.status = h.status.c_str();
+    state.task = h.task.c_str();
+    state.desiredVersion = h.desiredVersion;
+    state.desiredOrigin = h.desiredOrigin;
+    state.startAt = h.startAt;
+    state.uptimeS = (uint32_t)(nowUs / 1000000ULL);
+    return state;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    host::setSerialEcho(opt.verbose);
+    host::Clock::setEpochBase(1767225600);
+    host::Clock::reset(0);
+
+    uint32_t mask = 0xFFFFFFFFu << (32 - opt.prefix);
+    WiFi.setHostNetwork(SubnetScanner::fromHostOrder(kSelf), SubnetScanner::fromHostOrder(mask),
+                        SubnetScanner::fromHostOrder(kGateway));
+
+    // Nodes 8..63 ms to first byte. Strangers: hosts that refuse port 80 and
+    // absent hosts (with --passive they called us once, then went away), plus
+    // one closed port and one stalled node. Everything is spread over the subnet.
+    int hostCount = opt.nodes + opt.dead + 2;
+    SimNetwork net;
+    std::vector<uint32_t> nodes;
+    for (int i = 0; i < opt.nodes; ++i) {
+        SimHost h;
+        h.hostname = "eye-" + std::to_string(i);
+        h.connectUs = 2000 + (uint32_t)(i % 4) * 1000;
+        h.replyUs = 8000 + (uint32_t)i * 5000;
+        h.jitterUs = 6000;
+        h.peerStatus = i != 2;
+        h.chunked = i != 3;   // one node on firmware that sent Content-Length
+        uint32_t ip = spreadAddress(opt.prefix, i * hostCount / opt.nodes, hostCount);
+        net.addHost(ip, h);
+        nodes.push_back(ip);
+    }
+    SimHost closed;
+    closed.kind = SimHost::CLOSED;
+    SimHost stalled;
+    stalled.kind = SimHost::STALLED;
+    std::vector<uint32_t> strangers;
+    for (int k = 0; k < hostCount && (int)strangers.size() < opt.dead + 2; ++k) {
+        uint32_t ip = spreadAddress(opt.prefix, k, hostCount);
+        if (std::find(nodes.begin(), nodes.end(), ip) != nodes.end()) continue;
+        int n = (int)strangers.size();
+        if (n == opt.dead + 1) net.addHost(ip, stalled);
+        else if (n == opt.dead || n % 2 == 0) net.addHost(ip, closed);
+        // else absent: nothing answers at ip
+        strangers.push_back(ip);
+    }
+    host::attachNetwork(&net);
+
+    PeerManager& pm = PeerManager::instance();
+    pm.begin();
+    ReportAggregator& agg = ReportAggregator::instance();
+    agg.begin();
+    ClusterGossip& gossip = ClusterGossip::instance();
+    gossip.begin("eye-self");
+    GossipState selfState;
+    selfState.cluster = "Default";
+    selfState.status = "Ready";
+    selfState.task = "System Idle";
+    gossip.setLocalState(selfState);
+    ClusterCoordinator& coordinator = ClusterCoordinator::instance();
+    coordinator.begin("eye-self");
+
+    // Beacons of the simulated nodes, staggered over one interval
+    std::vector<SimGossip> simGossip;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        SimGossip g;
+        g.ip = nodes[i];
+        g.hostHash = ClusterGossip::hash(("eye-" + std::to_string(i)).c_str());
+        g.nextFullUs = (uint64_t)ClusterGossip::kFullIntervalMs * 1000ULL * i / nodes.size();
+        g.silent = !opt.gossip;
+        simGossip.push_back(g);
+    }
+    uint64_t simDatagrams = 0;
+    uint64_t simDatagramsLost = 0;
+    uint32_t lossRng = 12345;
+    auto sendGossip = [&](SimGossip& g, bool full, uint8_t fields) {
+        if (g.silent) return;
+        const SimHost* h = net.host(g.ip);
+        uint8_t datagram[ClusterGossip::kMaxDatagram];
+        size_t len = ClusterGossip::encode(datagram, sizeof(datagram), g.hostHash, g.version, full, fields,
+                                           gossipState(*h, host::Clock::nowUs()));
+        simDatagrams++;
+        lossRng = lossRng * 1103515245u + 12345u;
+        if ((int)((lossRng >> 16) % 100) < opt.lossPct) {
+            simDatagramsLost++;
+            return;
+        }
+        host::deliverUdp(g.ip, ClusterGossip::kPort, (uint32_t)ClusterGossip::group(), ClusterGossip::kPort,
+                         std::string((const char*)datagram, len), 500);
+    };
+    if (opt.passive) {
+        for (uint32_t ip : nodes) pm.trackIncomingRequest(IPAddress(ip).toString());
+        for (uint32_t ip : strangers) pm.trackIncomingRequest(IPAddress(ip).toString());
+    }
+
+    std::vector<uint64_t> stallUs;
+    std::vector<uint64_t> hostNs;
+    uint64_t loops = 0;
+    uint64_t endUs = (uint64_t)opt.seconds * 1000000ULL;
+    uint64_t firstPeerUs = 0;
+    uint64_t allVerifiedUs = 0;
+    bool stalledNode = false;
+    uint64_t stalledAtUs = 0;
+
+    // State changes on simulated nodes, timed until PeerManager shows them
+    const uint64_t statusChangeUs = endUs * 35 / 100;
+    const uint64_t desiredChangeUs = endUs * 40 / 100;
+    const std::string changedStatus = "Working: SpectrumPlugin";
+    const std::string desiredTask = "system/idle";
+    bool statusChanged = false, desiredChanged = false;
+    uint64_t statusSeenUs = 0, desiredSeenUs = 0;
+
+    // Coordination: the leader is the lowest address; if that is us, our
+    // coordinator adopts the proposal itself.
+    const uint64_t kLeaderAdoptMs = 400;  // the leader hearing of the proposal and reading its status
+    const uint64_t startChangeUs = endUs * 50 / 100;
+    const bool simLeader = !nodes.empty() && *std::min_element(nodes.begin(), nodes.end(), [](uint32_t a, uint32_t b) {
+        return ClusterCoordinator::ipBefore(a, b);
+    }) == nodes[0] && ClusterCoordinator::ipBefore(nodes[0], (uint32_t)SubnetScanner::fromHostOrder(kSelf));
+    const bool coordinate = nodes.size() > 3;
+    bool leaderAdopted = false, startPublished = false, rivalApplied = false;
+    uint64_t appliedUs = 0, startedUs = 0;
+    uint32_t startAt = 0;
+    Deployment expected, rival;
+    uint64_t statusPollsBefore = 0, statusPollsWindowStart = 0;
+    uint64_t statusBytesBefore = 0, statusBytesWindowStart = 0;
+    uint64_t notModifiedBefore = 0, notModifiedWindowStart = 0;
+    const uint64_t windowStartUs = endUs * 25 / 100;
+    bool windowStarted = false;
+
+    // Dashboard polling /api/report: one request outstanding at a time, as a
+    // browser's fetch() loop would do.
+    struct ReportSample {
+        uint64_t atUs;
+        uint32_t waitUs;
+        int fresh, stale, missing;
+        bool stalledNodeStale;
+    };
+    std::vector<ReportSample> reports;
+    uint64_t nextReportUs = 0;
+    bool reportPending = false;
+    uint32_t reportRound = 0;
+    unsigned long reportRequestedAt = 0;
+    uint64_t reportRequestedUs = 0;
+    String stalledName = String(("eye-" + std::to_string(opt.nodes - 1)).c_str());
+
+    while (host::Clock::nowUs() < endUs) {
+        uint64_t v0 = host::Clock::nowUs();
+        auto t0 = std::chrono::steady_clock::now();
+        pm.loop();
+        agg.loop();
+        gossip.loop();
+        coordinator.loop();
+        auto t1 = std::chrono::steady_clock::now();
+
+        uint64_t now = host::Clock::nowUs();
+        for (SimGossip& g : simGossip) {
+            if (now < g.nextFullUs) continue;
+            sendGossip(g, true, GOSSIP_ALL);
+            g.nextFullUs += (uint64_t)ClusterGossip::kFullIntervalMs * 1000ULL;
+        }
+        if (!windowStarted && now >= windowStartUs) {
+            windowStarted = true;
+            statusPollsWindowStart = net.statusRequests();
+            statusBytesWindowStart = net.statusBytes();
+            notModifiedWindowStart = net.notModified();
+        }
+        if (!statusChanged && now >= statusChangeUs) {
+            statusChanged = true;
+            statusPollsBefore = net.statusRequests() - statusPollsWindowStart;
+            statusBytesBefore = net.statusBytes() - statusBytesWindowStart;
+            notModifiedBefore = net.notModified() - notModifiedWindowStart;
+            SimHost* h = net.host(nodes[0]);
+            h->status = changedStatus;
+            h->task = "Spectrum Scan";
+            simGossip[0].version++;
+            sendGossip(simGossip[0], false, GOSSIP_STATUS | GOSSIP_TASK | GOSSIP_UPTIME);
+        }
+        if (!desiredChanged && now >= desiredChangeUs && nodes.size() > 1) {
+            desiredChanged = true;
+            SimHost* h = net.host(nodes[1]);
+            h->desiredTask = desiredTask;
+            h->desiredVersion = 1;
+            h->desiredOrigin = ClusterGossip::hash("eye-1");
+            simGossip[1].version++;
+            sendGossip(simGossip[1], false, GOSSIP_DESIRED | GOSSIP_UPTIME);
+            expected.version = h->desiredVersion;
+            expected.origin = h->desiredOrigin;
+            if (coordinate) {
+                // A rival of the same version; only the leader decides between them
+                SimHost* r = net.host(nodes[3]);
+                r->desiredTask = "spectrum/detect";
+                r->desiredVersion = 1;
+                r->desiredOrigin = ClusterGossip::hash("eye-3");
+                simGossip[3].version++;
+                sendGossip(simGossip[3], false, GOSSIP_DESIRED | GOSSIP_UPTIME);
+                rival.version = r->desiredVersion;
+                rival.origin = r->desiredOrigin;
+                // As leader we break the tie ourselves: the lower origin wins
+                if (!simLeader && rival.origin < expected.origin) std::swap(expected, rival);
+            }
+        }
+        if (coordinate && simLeader && desiredChanged && !leaderAdopted && now >= desiredChangeUs + kLeaderAdoptMs * 1000ULL) {
+            leaderAdopted = true;
+            SimHost* leader = net.host(nodes[0]);
+            leader->desiredTask = desiredTask;
+            leader->desiredVersion = expected.version;
+            leader->desiredOrigin = expected.origin;
+            simGossip[0].version++;
+            sendGossip(simGossip[0], false, GOSSIP_DESIRED | GOSSIP_UPTIME);
+        }
+        if (coordinate && simLeader && !startPublished && now >= startChangeUs) {
+            // The leader adopts a start request: same task, new version, a start time ahead
+            startPublished = true;
+            startAt = (uint32_t)(host::Clock::epochUs() / 1000000ULL) + ClusterCoordinator::kStartLeadS;
+            SimHost* leader = net.host(nodes[0]);
+            leader->desiredVersion = expected.version + 1;
+            leader->desiredOrigin = ClusterGossip::hash("eye-0");
+            leader->startAt = startAt;
+            simGossip[0].version++;
+            sendGossip(simGossip[0], false, GOSSIP_DESIRED | GOSSIP_START | GOSSIP_UPTIME);
+        }
+        if (coordinate && desiredChanged) {
+            Deployment applied = coordinator.applied();
+            if (appliedUs == 0 && applied.sameAs(expected)) appliedUs = now;
+            if (applied.sameAs(rival)) rivalApplied = true;
+            if (startedUs == 0 && coordinator.isStarted()) startedUs = host::Clock::epochUs();
+        }
+        if ((statusChanged && statusSeenUs == 0) || (desiredChanged && desiredSeenUs == 0)) {
+            std::vector<Peer> peers;
+            pm.getPeersSnapshot(peers);
+            for (const Peer& p : peers) {
+                IPAddress ip;
+                ip.fromString(p.ip);
+                if (statusChanged && statusSeenUs == 0 && (uint32_t)ip == nodes[0] && p.status == changedStatus.c_str())
+                    statusSeenUs = now;
+                if (desiredChanged && desiredSeenUs == 0 && nodes.size() > 1 && (uint32_t)ip == nodes[1] &&
+                    p.desiredTaskId == desiredTask.c_str())
+                    desiredSeenUs = now;
+            }
+        }
+        if (opt.reportMs > 0 && !reportPending && host::Clock::nowUs() >= nextReportUs) {
+            reportRound = agg.requestRound();
+            reportRequestedAt = millis();
+            reportRequestedUs = host::Clock::nowUs();
+            reportPending = true;
+        }
+        if (reportPending && agg.roundReady(reportRound, reportRequestedAt)) {
+            JsonDocument doc;
+            JsonObject nodesObj = doc["nodes"].to<JsonObject>();
+            agg.populateNodes(nodesObj, "eye-self");
+            ReportSample r{host::Clock::nowUs(), (uint32_t)(host::Clock::nowUs() - reportRequestedUs), 0, 0, 0, false};
+            for (JsonPair kv : nodesObj) {
+                JsonObject n = kv.value().as<JsonObject>();
+                if (n["missing"].as<bool>()) r.missing++;
+                else if (n["stale"].as<bool>()) r.stale++;
+                else r.fresh++;
+                if (stalledName == kv.key().c_str() && n["stale"].as<bool>()) r.stalledNodeStale = true;
+            }
+            reports.push_back(r);
+            reportPending = false;
+            nextReportUs = host::Clock::nowUs() + (uint64_t)opt.reportMs * 1000ULL;
+        }
+        stallUs.push_back(host::Clock::nowUs() - v0);
+        hostNs.push_back((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        loops++;
+        if (allVerifiedUs == 0) {
+            std::vector<Peer> peers;
+            pm.getPeersSnapshot(peers);
+            if (firstPeerUs == 0 && !peers.empty()) firstPeerUs = host::Clock::nowUs();
+            if (peers.size() >= nodes.size()) allVerifiedUs = host::Clock::nowUs();
+        }
+        if (!stalledNode && host::Clock::nowUs() >= endUs / 2) {
+            SimHost gone = stalled;
+            gone.hostname = "eye-" + std::to_string(opt.nodes - 1);
+            net.addHost(nodes.back(), gone);
+            simGossip.back().silent = true;
+            stalledNode = true;
+            stalledAtUs = host::Clock::nowUs();
+        }
+        vTaskDelay(pdMS_TO_TICKS(opt.loopMs));
+    }
+
+    std::vector<Peer> peers;
+    pm.getPeersSnapshot(peers);
+    JsonDocument doc;
+    JsonArray arr = doc.to<JsonArray>();
+    pm.populatePeers(arr);
+
+    size_t verified = 0;
+    size_t strangersAdded = 0;
+    size_t latencyMismatches = 0;
+    uint32_t stalledNodeFailures = 0;
+    uint64_t probesOk = 0;
+    uint64_t probesFailed = 0;
+    std::printf("peer             :     p50 ms (sim)     p90 ms (sim)     max ms   ok  failed\n");
+    for (JsonObject p : arr) {
+        IPAddress ip;
+        ip.fromString(p["ip"].as<String>());
+        bool isNode = std::find(nodes.begin(), nodes.end(), (uint32_t)ip) != nodes.end();
+        if (!isNode) {
+            strangersAdded++;
+            continue;
+        }
+        verified++;
+        JsonObject probe = p["probe"].as<JsonObject>();
+        // The firmware keeps the last 32 successful probes; compare with the same window.
+        std::vector<uint32_t> drawn = net.replyLatencies((uint32_t)ip);
+        if (drawn.size() > PeerProbeStats::kWindow) drawn.erase(drawn.begin(), drawn.end() - PeerProbeStats::kWindow);
+        double simP50 = bench::percentile(drawn, 50) / 1000.0;
+        double simP90 = bench::percentile(drawn, 90) / 1000.0;
+        double p50 = probe["p50_ms"].as<float>();
+        double p90 = probe["p90_ms"].as<float>();
+        if (std::fabs(p50 - simP50) > 1.0 || std::fabs(p90 - simP90) > 1.0) latencyMismatches++;
+        if ((uint32_t)ip == nodes.back()) stalledNodeFailures = probe["failed"].as<uint32_t>();
+        probesOk += probe["ok"].as<uint32_t>();
+        probesFailed += probe["failed"].as<uint32_t>();
+        std::printf("  %-15s: %7.2f (%7.2f)  %7.2f (%7.2f)  %8.2f %4u %6u\n", p["ip"].as<String>().c_str(), p50, simP50,
+                    p90, simP90, probe["max_ms"].as<float>(), probe["ok"].as<uint32_t>(), probe["failed"].as<uint32_t>());
+    }
+
+    host::NetStats ns = host::netStats();
+    const SubnetScanStats& sweep = pm.subnetScanStats();
+    uint64_t maxStall = stallUs.empty() ? 0 : *std::max_element(stallUs.begin(), stallUs.end());
+    std::printf("loops            : %llu over %d s virtual (%d ms apart)\n", (unsigned long long)loops, opt.seconds, opt.loopMs);
+    std::printf("peers            : %zu/%zu nodes verified (first at %.2f s, all by %.2f s), %zu of %zu absent/closed/stalled hosts added\n",
+                verified, nodes.size(), firstPeerUs / 1e6, allVerifiedUs / 1e6, strangersAdded, strangers.size());
+    std::printf("subnet sweep     : /%u, %u hosts in %.2f s (%u sweeps): %u open, %u refused, %u silent, %u skipped\n",
+                sweep.prefixBits, sweep.hosts, sweep.lastSweepMs / 1000.0, sweep.sweeps, sweep.open, sweep.refused,
+                sweep.silent, sweep.skipped);
+    std::printf("probes           : %llu ok, %llu failed on peers, %u started, %u timed out, %llu HTTP requests served\n",
+                (unsigned long long)probesOk, (unsigned long long)probesFailed, pm.probeEngine().started(),
+                pm.probeEngine().timedOut(), (unsigned long long)net.requests());
+    uint32_t connectionLimit = SubnetScanner::kMaxConnects + pm.probeEngine().capacity() + agg.probeEngine().capacity();
+    std::printf("connections      : %llu opened, %llu still open, peak %llu at once (limit %u sweep + %u probe + %u report)\n",
+                (unsigned long long)ns.connects, (unsigned long long)ns.live, (unsigned long long)ns.peakLive,
+                SubnetScanner::kMaxConnects, pm.probeEngine().capacity(), agg.probeEngine().capacity());
+    std::printf("loop stall       : max %llu us virtual (network waits on the loop)\n", (unsigned long long)maxStall);
+    std::printf("loop host cpu    : p50 %.2f us, p99 %.2f us, max %.2f us\n", bench::percentile(hostNs, 50) / 1000.0,
+                bench::percentile(hostNs, 99) / 1000.0,
+                (hostNs.empty() ? 0 : *std::max_element(hostNs.begin(), hostNs.end())) / 1000.0);
+    std::printf("latency match    : %zu/%zu peers within 1 ms of the simulated p50/p90\n", verified - latencyMismatches, verified);
+
+    GossipStats gs = gossip.stats();
+    double windowMin = (statusChangeUs - windowStartUs) / 60e6;
+    std::printf("gossip           : %s, %llu datagrams from simulated nodes (%llu lost), %u received, %u dropped; sent %u full + %u delta (%u B)\n",
+                opt.gossip ? "on" : "off (nodes silent)", (unsigned long long)simDatagrams,
+                (unsigned long long)simDatagramsLost, gs.received, gs.dropped, gs.sentFull, gs.sentDelta, gs.sentBytes);
+    std::printf("                   /api/status polls in steady state: %.1f per minute\n", statusPollsBefore / windowMin);
+    if (statusPollsBefore > 0) {
+        std::printf("                   status replies in steady state: %.0f B per poll, %.0f%% 304 Not Modified\n",
+                    (double)statusBytesBefore / statusPollsBefore, 100.0 * notModifiedBefore / statusPollsBefore);
+    }
+    std::printf("                   status change seen after %.3f s, desired task after %.3f s\n",
+                statusSeenUs ? (statusSeenUs - statusChangeUs) / 1e6 : -1.0,
+                desiredSeenUs ? (desiredSeenUs - desiredChangeUs) / 1e6 : -1.0);
+
+    CoordinatorStats cs = coordinator.stats();
+    if (coordinate) {
+        std::printf("coordination     : leader %s; proposal applied after %.3f s, %u applied, %u plugin deploys, rival %s\n",
+                    simLeader ? "eye-0" : "this node", appliedUs ? (appliedUs - desiredChangeUs) / 1e6 : -1.0, cs.applied,
+                    cs.deploys, rivalApplied ? "APPLIED" : "ignored");
+        if (simLeader) {
+            std::printf("                   start at %u: started %.1f ms after it, %u starts\n", startAt,
+                        startedUs ? ((double)startedUs - (double)startAt * 1e6) / 1000.0 : -1.0, cs.starts);
+        }
+    }
+
+    // Cluster report, once every node was a peer: before and after the last node stalled
+    std::vector<uint32_t> waitBefore, waitAfter;
+    size_t incompleteBefore = 0, stalledMarked = 0, missingAfter = 0, roundsAfter = 0;
+    double sequentialMs = 0;
+    for (uint32_t ip : nodes) {
+        const std::vector<uint32_t>& drawn = net.reportLatencies(ip);
+        double mean = 0;
+        for (uint32_t us : drawn) mean += us;
+        if (!drawn.empty()) sequentialMs += std::min(mean / drawn.size() / 1000.0, 1500.0);
+    }
+    for (const ReportSample& r : reports) {
+        if (allVerifiedUs == 0 || r.atUs < allVerifiedUs + 3000000ULL) continue;
+        if (r.atUs < stalledAtUs) {
+            waitBefore.push_back(r.waitUs);
+            if (r.fresh != (int)nodes.size()) incompleteBefore++;
+        } else if (r.atUs > stalledAtUs + 3000000ULL && r.atUs < stalledAtUs + 60000000ULL) {
+            // Within the window PeerManager still lists the stalled node as online
+            waitAfter.push_back(r.waitUs);
+            roundsAfter++;
+            if (r.stalledNodeStale) stalledMarked++;
+            missingAfter += (size_t)r.missing;
+        }
+    }
+    if (opt.reportMs > 0) {
+        ReportRoundStats last = agg.lastRound();
+        std::printf("cluster report   : %zu requests; all nodes answering: wait p50 %.1f ms, max %.1f ms, %zu/%zu incomplete\n",
+                    reports.size(), bench::percentile(waitBefore, 50) / 1000.0,
+                    (waitBefore.empty() ? 0 : *std::max_element(waitBefore.begin(), waitBefore.end())) / 1000.0,
+                    incompleteBefore, waitBefore.size());
+        std::printf("                   one node stalled: wait p50 %.1f ms, max %.1f ms (deadline %u ms), stalled node stale in %zu/%zu, %zu missing\n",
+                    bench::percentile(waitAfter, 50) / 1000.0,
+                    (waitAfter.empty() ? 0 : *std::max_element(waitAfter.begin(), waitAfter.end())) / 1000.0,
+                    ReportAggregator::kRoundDeadlineMs, stalledMarked, roundsAfter, missingAfter);
+        std::printf("                   sequential 1.5 s/peer handler: ~%.0f ms with all nodes answering, ~%.0f ms with one stalled\n",
+                    sequentialMs, sequentialMs + 1500.0);
+        std::printf("                   last round: %u peers, %u fresh, %u stale, %u missing in %u ms\n", last.peers, last.fresh,
+                    last.stale, last.missing, last.elapsedMs);
+    }
+
+    if (verified < nodes.size() || strangersAdded > 0) {
+        std::fprintf(stderr, "FAIL: peer set differs from the simulated network\n");
+        return 1;
+    }
+    if (!opt.passive && sweep.sweeps == 0) {
+        std::fprintf(stderr, "FAIL: the subnet sweep did not finish\n");
+        return 1;
+    }
+    if (ns.peakLive > connectionLimit) {
+        std::fprintf(stderr, "FAIL: more connections open at once than the sweep, probe and report limits allow\n");
+        return 1;
+    }
+    if (stalledNodeFailures == 0) {
+        std::fprintf(stderr, "FAIL: probes of the node that stopped answering did not fail\n");
+        return 1;
+    }
+    if (maxStall > 0) {
+        std::fprintf(stderr, "FAIL: PeerManager::loop() waited on the network\n");
+        return 1;
+    }
+    if (statusSeenUs == 0 || (nodes.size() > 1 && desiredSeenUs == 0)) {
+        std::fprintf(stderr, "FAIL: a node's state change never reached PeerManager\n");
+        return 1;
+    }
+    if (coordinate && (appliedUs == 0 || rivalApplied || cs.deploys != 1)) {
+        std::fprintf(stderr, "FAIL: the cluster deployment was not applied exactly once from the leader\n");
+        return 1;
+    }
+    if (coordinate && simLeader &&
+        (startedUs == 0 || startedUs < (uint64_t)startAt * 1000000ULL || cs.starts != 1 || cs.deploys != 1)) {
+        std::fprintf(stderr, "FAIL: the staged task was not started once, at its start time, without a redeploy\n");
+        return 1;
+    }
+    if (statusPollsBefore > 0 && nodes.size() > 3 && notModifiedBefore == 0) {
+        std::fprintf(stderr, "FAIL: unchanged peers were sent their full status again\n");
+        return 1;
+    }
+    if (opt.gossip && opt.lossPct == 0) {
+        if (statusSeenUs - statusChangeUs > 1000000ULL || (nodes.size() > 1 && desiredSeenUs - desiredChangeUs > 1000000ULL)) {
+            std::fprintf(stderr, "FAIL: a gossiped change took longer than 1 s to arrive\n");
+            return 1;
+        }
+        if (coordinate && appliedUs - desiredChangeUs > kLeaderAdoptMs * 1000ULL + 1000000ULL) {
+            std::fprintf(stderr, "FAIL: the leader's deployment took longer than 1 s to reach us\n");
+            return 1;
+        }
+        if (coordinate && simLeader && startedUs - (uint64_t)startAt * 1000000ULL > ((uint64_t)opt.loopMs + 5) * 1000ULL) {
+            std::fprintf(stderr, "FAIL: the task started late\n");
+            return 1;
+        }
+        if (statusPollsBefore > 0) {
+            std::fprintf(stderr, "FAIL: peers that gossip were still polled over HTTP\n");
+            return 1;
+        }
+    }
+    if (opt.reportMs > 0) {
+        uint32_t limitUs = (ReportAggregator::kRoundDeadlineMs + 2 * (uint32_t)opt.loopMs) * 1000;
+        bool slow = false;
+        for (uint32_t us : waitBefore) slow |= us > limitUs;
+        for (uint32_t us : waitAfter) slow |= us > limitUs;
+        if (slow || waitBefore.empty() || incompleteBefore > 0) {
+            std::fprintf(stderr, "FAIL: cluster report missed nodes or waited past the round deadline\n");
+            return 1;
+        }
+        if (roundsAfter == 0 || stalledMarked != roundsAfter || missingAfter > 0) {
+            std::fprintf(stderr, "FAIL: the stalled node was not served from the cache as stale\n");
+            return 1;
+        }
+    }
+    if (latencyMismatches > 0) {
+        std::fprintf(stderr, "FAIL: reported probe latency differs from the simulated network\n");
+        return 1;
+    }
+    return 0;
+}
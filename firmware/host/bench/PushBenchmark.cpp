@@ -0,0 +1,380 @@
+// Host benchmark for the /api/live push channel.
+//
+// Runs the real LivePush over a StatusBuilder with the firmware's status
+// sections (WebDocuments.cpp; logs are not pushed), the real Logger, and a sweep source that completes a
+// sweep every --sweep-ms. The node changes as on a device: log lines at
+// --logs-per-s with a burst of 120 lines every 20 s, a Scheduler task every
+// 10 s, and a new description every 7 s; all of it stops at 90% of the run
+// so the last status deltas can settle.
+// Three simulated WebSocket clients drain their socket queue at a byte rate:
+//   fast     the dashboard on the LAN (--fast-kbps)
+//   slow     a phone on a weak link (--slow-kbps)
+//   stalled  a client that stopped reading
+// Reports per client the messages and bytes sent, sweeps sent and dropped,
+// log lines and lines missed, and the sweep latency from completion to the
+// last byte delivered; then status and log traffic against the dashboard's
+// former 2 s /api/status poll.
+// Fails when a socket queue ever holds more than LivePush::kMaxPending
+// messages, a sweep is sent that was superseded before the last read of the
+// sweep source, the fast client drops a sweep or misses a log line, the fast
+// client's status (built from the deltas) differs from a fresh build, or
+// push traffic is not below polling.
+//
+// Usage: push_bench [--seconds S] [--sweep-ms N] [--logs-per-s N] [--fast-kbps N] [--slow-kbps N] [--verbose]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "Config.h"
+#include "LivePush.h"
+#include "Logger.h"
+#include "Scheduler.h"
+#include "SpectrumFrame.h"
+#include "StatusBuilder.h"
+#include "WebDocuments.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+
+namespace {
+
+struct Options {
+    int seconds = 120;
+    int sweepMs = 250;
+    int logsPerS = 5;
+    int fastKbps = 2000;
+    int slowKbps = 16;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: push_bench [--seconds S] [--sweep-ms N] [--logs-per-s N] [--fast-kbps N] [--slow-kbps N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--seconds") opt.seconds = std::atoi(args.value());
+        else if (a == "--sweep-ms") opt.sweepMs = std::atoi(args.value());
+        else if (a == "--logs-per-s") opt.logsPerS = std::atoi(args.value());
+        else if (a == "--fast-kbps") opt.fastKbps = std::atoi(args.value());
+        else if (a == "--slow-kbps") opt.slowKbps = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.seconds >= 30 && opt.sweepMs >= 20 && opt.logsPerS >= 0 && opt.fastKbps > 0 && opt.slowKbps > 0;
+}
+
+std::string serialized(JsonVariant v) {
+    String out;
+    serializeJson(v, out);
+    return out.c_str();
+}
+
+// Sweep source: sweep n completes at n * sweepMs
+uint32_t gSweepMs = 250;
+uint8_t gNodeId[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x32};
+
+uint32_t latestSweep() { return (uint32_t)(millis() / gSweepMs); }
+
+size_t encodeSweep(uint8_t* out, size_t capacity) {
+    uint32_t n = latestSweep();
+    if (n == 0) return 0;
+    static int16_t cdb[128];
+    for (int i = 0; i < 128; ++i) cdb[i] = (int16_t)(-9500 + (int)((n * 37 + (uint32_t)i * 11) % 2500));
+    SpectrumFrameInfo info = {};
+    memcpy(info.nodeId, gNodeId, sizeof(gNodeId));
+    info.sweepSeq = (uint16_t)n;
+    info.epoch = (uint32_t)((uint64_t)n * gSweepMs / 1000);
+    info.startKhz = 433050;
+    info.stepHz = 25000;
+    return spectrumFrameEncode(out, capacity, info, cdb, 128, SPECTRUM_BINS_INT8);
+}
+
+uint16_t frameSeq(const std::string& data) {
+    return (uint16_t)((uint8_t)data[14] | ((uint8_t)data[15] << 8));
+}
+
+// A WebSocket client behind a link of the given rate
+struct SimClient {
+    SimClient(const char* name, uint32_t id, double bytesPerMs) : name(name), id(id), bytesPerMs(bytesPerMs) {}
+
+    const char* name;
+    uint32_t id;
+    double bytesPerMs;            // 0: stalled
+    struct Message {
+        bool binary;
+        std::string data;
+    };
+    std::deque<Message> queue;
+    double credit = 0;
+    size_t maxQueue = 0;
+    uint64_t delivered = 0;
+    uint64_t statusBytes = 0;
+    uint64_t logBytes = 0;
+    uint64_t sweepBytes = 0;
+
+    // What the client made of it
+    JsonDocument status;
+    uint32_t logSeq = 0;
+    bool logSeqKnown = false;
+    uint32_t logGaps = 0;
+    uint32_t logLines = 0;
+    std::vector<double> sweepLatencyMs;
+
+    void deliver(const Message& m, unsigned long now) {
+        if (m.binary) {
+            sweepBytes += m.data.size();
+            uint32_t completedAt = (uint32_t)frameSeq(m.data) * gSweepMs;
+            sweepLatencyMs.push_back((double)(now - completedAt));
+            return;
+        }
+        JsonDocument doc;
+        if (deserializeJson(doc, m.data.c_str())) return;
+        String type = doc["type"].as<String>();
+        if (type == "status") {
+            statusBytes += m.data.size();
+            if (doc["full"].as<bool>()) status.to<JsonObject>();
+            for (JsonPair kv : doc["data"].as<JsonObject>()) status[kv.key().c_str()] = kv.value();
+        } else if (type == "logs") {
+            logBytes += m.data.size();
+            uint32_t seq = doc["seq"].as<uint32_t>();
+            uint32_t lines = (uint32_t)doc["lines"].as<JsonArray>().size();
+            uint32_t missed = doc["missed"].as<uint32_t>();
+            if (logSeqKnown && seq != logSeq + missed + lines) logGaps++;
+            logSeq = seq;
+            logSeqKnown = true;
+            logLines += lines;
+        }
+    }
+
+    void drain(double ms, unsigned long now) {
+        if (bytesPerMs <= 0) return;
+        credit += bytesPerMs * ms;
+        while (!queue.empty() && credit >= (double)queue.front().data.size()) {
+            credit -= (double)queue.front().data.size();
+            delivered += queue.front().data.size();
+            deliver(queue.front(), now);
+            queue.pop_front();
+        }
+        if (queue.empty()) credit = 0;  // an idle link saves nothing up
+    }
+};
+
+class SimTransport : public PushTransport {
+public:
+    std::map<uint32_t, SimClient*> clients;
+    uint32_t staleSweeps = 0;
+
+    size_t pending(uint32_t client) override {
+        auto it = clients.find(client);
+        return it == clients.end() ? LivePush::kMaxPending : it->second->queue.size();
+    }
+    bool sendText(uint32_t client, const char* data, size_t len) override {
+        return push(client, false, std::string(data, len));
+    }
+    bool sendBinary(uint32_t client, const uint8_t* data, size_t len) override {
+        std::string frame((const char*)data, len);
+        // The source is read every kSweepPollMs, on a tick: a newer sweep may have completed since
+        uint32_t supersededAt = ((uint32_t)frameSeq(frame) + 1) * gSweepMs;
+        if (millis() > supersededAt + LivePush::kSweepPollMs + LivePush::kTickMs) staleSweeps++;
+        return push(client, true, frame);
+    }
+
+private:
+    bool push(uint32_t client, bool binary, std::string data) {
+        auto it = clients.find(client);
+        if (it == clients.end()) return false;
+        SimClient* c = it->second;
+        c->queue.push_back({binary, std::move(data)});
+        c->maxQueue = std::max(c->maxQueue, c->queue.size());
+        return true;
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+    gSweepMs = (uint32_t)opt.sweepMs;
+
+    host::setSerialEcho(opt.verbose);
+    host::Clock::setEpochBase(1767225600);
+    host::Clock::reset(0);
+
+    Config::instance().begin();
+    Scheduler::instance().begin();
+
+    StatusBuilder builder;
+    LivePush push;
+    addStatusSections(builder, push);
+
+    SimTransport transport;
+    push.begin(&builder, &transport, encodeSweep);
+
+    SimClient fast{"fast", 1, opt.fastKbps * 1000.0 / 8.0 / 1000.0};
+    SimClient slow{"slow", 2, opt.slowKbps * 1000.0 / 8.0 / 1000.0};
+    SimClient stalled{"stalled", 3, 0};
+    SimClient* clients[] = {&fast, &slow, &stalled};
+    for (SimClient* c : clients) {
+        transport.clients[c->id] = c;
+        push.addClient(c->id);
+    }
+
+    const uint64_t endUs = (uint64_t)opt.seconds * 1000000ULL;
+    const uint64_t quietUs = endUs * 90 / 100;
+    const uint64_t logUs = opt.logsPerS > 0 ? 1000000ULL / (uint64_t)opt.logsPerS : 0;
+    const uint64_t burstUs = 20000000ULL;
+    const uint64_t taskUs = 10000000ULL;
+    const uint64_t describeUs = 7000000ULL;
+    const uint64_t pollUs = 2000000ULL;
+    uint64_t nextLogUs = logUs, nextBurstUs = burstUs, nextTaskUs = taskUs, nextDescribeUs = describeUs;
+    uint64_t nextPollUs = pollUs;
+    uint32_t logLine = 0, taskNo = 0, describeNo = 0;
+    uint64_t polls = 0, pollBytes = 0;
+    String pollOut;
+    uint64_t lastUs = 0;
+
+    while (host::Clock::nowUs() < endUs) {
+        uint64_t now = host::Clock::nowUs();
+        bool quiet = now >= quietUs;
+        Scheduler::instance().loop();
+
+        if (!quiet && logUs > 0 && now >= nextLogUs) {
+            nextLogUs += logUs;
+            Logger::instance().info("Bench", "Line %lu from the radio loop", (unsigned long)logLine++);
+        }
+        if (!quiet && now >= nextBurstUs) {
+            nextBurstUs += burstUs;
+            for (int i = 0; i < 120; ++i) {
+                Logger::instance().warn("Bench", "Burst line %lu: retuning after a lock timeout", (unsigned long)logLine++);
+            }
+        }
+        if (!quiet && now >= nextTaskUs) {
+            nextTaskUs += taskUs;
+            RadioTask task;
+            task.id = "bench-" + String(taskNo);
+            task.type = TASK_USER;
+            task.pluginName = "SystemIdle";
+            task.taskName = "Bench Task " + String(taskNo++);
+            task.durationMs = 6000;
+            task.createdAt = millis();
+            Scheduler::instance().enqueue(task);
+        }
+        if (!quiet && now >= nextDescribeUs) {
+            nextDescribeUs += describeUs;
+            Config::instance().setString("description", "Mast " + String(describeNo++));
+        }
+
+        // What the dashboard fetched before: the whole document every 2 s
+        if (now >= nextPollUs) {
+            nextPollUs += pollUs;
+            builder.build(pollOut);
+            polls++;
+            pollBytes += pollOut.length();
+        }
+
+        push.loop();
+        double ms = (double)(now - lastUs) / 1000.0;
+        lastUs = now;
+        for (SimClient* c : clients) c->drain(ms, millis());
+
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+
+    // The fast client's status against one written now
+    JsonDocument fresh;
+    JsonObject freshRoot = fresh.to<JsonObject>();
+    for (size_t i = 0; i < kStatusSectionCount; ++i) {
+        if (kStatusSections[i].push) kStatusSections[i].write(freshRoot);
+    }
+    bench::stripTimeFields(fresh.as<JsonVariant>());
+    bench::stripTimeFields(fast.status.as<JsonVariant>());
+    std::string statusDiff;
+    JsonObject merged = fast.status.as<JsonObject>();
+    if (merged.size() != freshRoot.size()) {
+        statusDiff = std::to_string(merged.size()) + " members, expected " + std::to_string(freshRoot.size());
+    }
+    for (JsonPair kv : freshRoot) {
+        std::string want = serialized(kv.value());
+        std::string got = merged.containsKey(kv.key().c_str()) ? serialized(merged[kv.key().c_str()]) : "missing";
+        if (want != got && statusDiff.empty()) statusDiff = std::string(kv.key().c_str()) + ": " + got + ", expected " + want;
+    }
+
+    double seconds = (double)opt.seconds;
+    std::printf("push bench: %d s, sweep every %d ms, %d log lines/s (+120 every 20 s), fast %d kbit/s, slow %d kbit/s\n",
+                opt.seconds, opt.sweepMs, opt.logsPerS, opt.fastKbps, opt.slowKbps);
+    std::printf("log lines        : %u written\n", Logger::instance().sequence());
+    bool ok = true;
+    for (SimClient* c : clients) {
+        PushClientStats stats;
+        push.clientStats(c->id, stats);
+        std::printf("%-8s : %6u messages, %8u bytes sent, %8llu delivered, queue max %zu\n", c->name, stats.messages,
+                    stats.bytes, (unsigned long long)c->delivered, c->maxQueue);
+        std::printf("           sweeps %u sent, %u dropped; status %u; log lines %u, %u missed; busy %u ticks\n",
+                    stats.sweepsSent, stats.sweepsDropped, stats.statusSent, stats.logLines, stats.logsMissed, stats.busy);
+        if (!c->sweepLatencyMs.empty()) {
+            std::printf("           sweep latency p50 %.0f ms, p99 %.0f ms, max %.0f ms\n", bench::percentile(c->sweepLatencyMs, 50),
+                        bench::percentile(c->sweepLatencyMs, 99), bench::percentile(c->sweepLatencyMs, 100));
+        }
+        if (c->maxQueue > LivePush::kMaxPending) {
+            std::printf("FAIL: %s client queue reached %zu messages\n", c->name, c->maxQueue);
+            ok = false;
+        }
+        if (c == &fast) {
+            if (stats.sweepsDropped > 0 || stats.logsMissed > 0 || c->logGaps > 0) {
+                std::printf("FAIL: fast client lost data: %u sweeps dropped, %u log lines missed, %u gaps\n",
+                            stats.sweepsDropped, stats.logsMissed, c->logGaps);
+                ok = false;
+            }
+            if (c->logSeq != Logger::instance().sequence()) {
+                std::printf("FAIL: fast client read logs up to line %u of %u\n", c->logSeq, Logger::instance().sequence());
+                ok = false;
+            }
+            if (!statusDiff.empty()) {
+                std::printf("FAIL: fast client status differs from a fresh build: %s\n", statusDiff.c_str());
+                ok = false;
+            }
+        }
+        if (c == &slow && stats.sweepsDropped == 0) {
+            std::printf("FAIL: slow client dropped no sweeps; the link is not slow enough to test backpressure\n");
+            ok = false;
+        }
+        if (c == &stalled && stats.messages > LivePush::kMaxPending) {
+            std::printf("FAIL: %u messages sent to the stalled client\n", stats.messages);
+            ok = false;
+        }
+    }
+
+    // Status and log traffic: what the 2 s poll carried
+    double pushRate = (double)(fast.statusBytes + fast.logBytes) / seconds;
+    double pollRate = (double)pollBytes / seconds;
+    std::printf("status + logs    : push %.0f B/s (status %.0f, logs %.0f), 2 s poll %.0f B/s (%llu polls, %.0f B each)\n",
+                pushRate, (double)fast.statusBytes / seconds, (double)fast.logBytes / seconds, pollRate,
+                (unsigned long long)polls, polls ? (double)pollBytes / polls : 0.0);
+    std::printf("sweeps           : %.0f B/s pushed to the fast client\n", (double)fast.sweepBytes / seconds);
+    std::printf("stale sweeps     : %u\n", transport.staleSweeps);
+    if (transport.staleSweeps > 0) {
+        std::printf("FAIL: sweeps sent that a sweep read since had superseded\n");
+        ok = false;
+    }
+    if (pushRate >= pollRate) {
+        std::printf("FAIL: pushing status and logs costs more than polling\n");
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,275 @@
+// Host benchmark for the incremental /api/status builder.
+//
+// Runs the real StatusBuilder over the /api/status sections the firmware
+// registers (kStatusSections in WebDocuments.cpp). The node around it runs as on a device: PeerManager discovers and
+// re-reads --nodes simulated peers over SimNetwork, its maintenance probe
+// logging every 2 s, other lines go to the log at --logs-per-s, the
+// Scheduler takes a task every 20 s, and at 30% and 40% of the run the
+// description is changed and a deployment proposed. Dashboards poll
+// /api/status every --poll-ms once the peers are in (after 15 s).
+// Each poll is built twice: by the StatusBuilder, and in one document from
+// scratch, as the single-document builder did on every cache miss. The two
+// are compared with the time-derived values (uptime, heap, elapsed and age
+// fields) removed, which a section is allowed to hold for its maxAgeMs, and
+// without the sections on the builders' own counters.
+// Reports:
+//   - build time per request, incremental and from scratch, p50/p99/max
+//     (host CPU time; the JSON stand-in allocates per node, so the ratio
+//     matters more than the figures);
+//   - heap allocations and bytes per request for both;
+//   - per section: how often it was regenerated, as a share of the polls;
+//   - documents that differed.
+//
+// Usage: status_bench [--nodes N] [--seconds S] [--poll-ms N] [--logs-per-s N] [--verbose]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+#include "ClockSync.h"
+#include "ClusterCoordinator.h"
+#include "Config.h"
+#include "HAL.h"
+#include "LivePush.h"
+#include "Logger.h"
+#include "PeerManager.h"
+#include "PluginManager.h"
+#include "RingBuffer.h"
+#include "Scheduler.h"
+#include "StatusBuilder.h"
+#include "WebDocuments.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+#include "SimNetwork.h"
+
+namespace {
+
+struct Options {
+    int nodes = 24;
+    int seconds = 180;
+    int pollMs = 250;
+    int logsPerS = 2;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: status_bench [--nodes N] [--seconds S] [--poll-ms N] [--logs-per-s N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--nodes") opt.nodes = std::atoi(args.value());
+        else if (a == "--seconds") opt.seconds = std::atoi(args.value());
+        else if (a == "--poll-ms") opt.pollMs = std::atoi(args.value());
+        else if (a == "--logs-per-s") opt.logsPerS = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.nodes > 0 && opt.nodes <= 200 && opt.seconds >= 30 && opt.pollMs > 0 && opt.logsPerS >= 0;
+}
+
+// The node under test is 192.168.1.50 on a /24, its peers from .100 up.
+const uint32_t kSelf = 0xC0A80132;
+const uint32_t kMask = 0xFFFFFF00;
+const uint32_t kGateway = 0xC0A80101;
+
+// What the single-document builder did on every cache miss
+void buildFromScratch(String& out) {
+    JsonDocument doc;
+    JsonObject root = doc.to<JsonObject>();
+    for (size_t i = 0; i < kStatusSectionCount; ++i) kStatusSections[i].write(root);
+    serializeJson(doc, out);
+}
+
+std::string normalized(const String& json) {
+    JsonDocument doc;
+    if (deserializeJson(doc, json)) return std::string("invalid: ") + json.c_str();
+    bench::stripTimeFields(doc.as<JsonVariant>());
+    String out;
+    serializeJson(doc, out);
+    return out.c_str();
+}
+
+struct BuildCost {
+    std::vector<double> us;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+template <typename F>
+void measure(BuildCost& cost, F build) {
+    host::HeapStats h0 = host::heapStats();
+    auto t0 = std::chrono::steady_clock::now();
+    build();
+    auto t1 = std::chrono::steady_clock::now();
+    host::HeapStats h1 = host::heapStats();
+    cost.us.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+    cost.allocations += h1.allocations - h0.allocations;
+    cost.bytes += h1.bytesAllocated - h0.bytesAllocated;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    host::setSerialEcho(opt.verbose);
+    host::Clock::setEpochBase(1767225600);
+    host::Clock::reset(0);
+    WiFi.setHostNetwork(SubnetScanner::fromHostOrder(kSelf), SubnetScanner::fromHostOrder(kMask),
+                        SubnetScanner::fromHostOrder(kGateway));
+
+    SimNetwork net;
+    std::vector<uint32_t> nodes;
+    for (int i = 0; i < opt.nodes; ++i) {
+        SimHost h;
+        h.hostname = "eye-" + std::to_string(i);
+        h.connectUs = 2000;
+        h.replyUs = 10000 + (uint32_t)(i % 8) * 4000;
+        h.jitterUs = 4000;
+        uint32_t ip = (uint32_t)SubnetScanner::fromHostOrder((kSelf & kMask) + 100 + (uint32_t)i);
+        net.addHost(ip, h);
+        nodes.push_back(ip);
+    }
+    host::attachNetwork(&net);
+
+    Config::instance().begin();
+    Scheduler::instance().begin();
+    PeerManager& pm = PeerManager::instance();
+    pm.begin();
+    ClusterCoordinator& coordinator = ClusterCoordinator::instance();
+    coordinator.begin("eye-self");
+    for (uint32_t ip : nodes) pm.trackIncomingRequest(IPAddress(ip).toString());
+
+    StatusBuilder builder;
+    LivePush push;
+    addStatusSections(builder, push);
+
+    const uint64_t endUs = (uint64_t)opt.seconds * 1000000ULL;
+    const uint64_t warmupUs = 15000000ULL;
+    const uint64_t pollUs = (uint64_t)opt.pollMs * 1000ULL;
+    const uint64_t logUs = opt.logsPerS > 0 ? 1000000ULL / (uint64_t)opt.logsPerS : 0;
+    const uint64_t taskUs = 20000000ULL;
+    const uint64_t describeUs = endUs * 30 / 100;
+    const uint64_t proposeUs = endUs * 40 / 100;
+    uint64_t nextPollUs = warmupUs, nextLogUs = logUs, nextTaskUs = taskUs;
+    bool described = false, proposed = false;
+    uint32_t logLine = 0, taskNo = 0;
+
+    BuildCost incremental, scratch;
+    std::vector<size_t> docBytes;
+    uint64_t polls = 0, mismatches = 0;
+    std::string firstMismatch;
+    String incOut, fullOut;
+
+    while (host::Clock::nowUs() < endUs) {
+        uint64_t now = host::Clock::nowUs();
+        pm.loop();
+        coordinator.loop();
+        Scheduler::instance().loop();
+
+        if (logUs > 0 && now >= nextLogUs) {
+            nextLogUs += logUs;
+            Logger::instance().info("Bench", "Line %lu from the radio loop", (unsigned long)logLine++);
+        }
+        if (now >= nextTaskUs) {
+            nextTaskUs += taskUs;
+            RadioTask task;
+            task.id = "bench-" + String(taskNo);
+            task.type = TASK_USER;
+            task.pluginName = "SystemIdle";
+            task.taskName = "Bench Task " + String(taskNo++);
+            task.durationMs = 8000;
+            task.createdAt = millis();
+            Scheduler::instance().enqueue(task);
+        }
+        if (!described && now >= describeUs) {
+            described = true;
+            Config::instance().setString("description", "Roof mast, north corner");
+        }
+        if (!proposed && now >= proposeUs) {
+            proposed = true;
+            coordinator.propose("system/idle", "{\"note\":\"status bench\",\"interval_ms\":500}");
+        }
+
+        if (now >= nextPollUs) {
+            nextPollUs += pollUs;
+            polls++;
+            measure(incremental, [&]() { builder.build(incOut); });
+            measure(scratch, [&]() { buildFromScratch(fullOut); });
+            docBytes.push_back(incOut.length());
+            std::string a = normalized(incOut);
+            std::string b = normalized(fullOut);
+            if (a != b) {
+                mismatches++;
+                if (firstMismatch.empty()) {
+                    firstMismatch = "at " + std::to_string(now / 1000) + " ms:\n  incremental " + a + "\n  scratch     " + b;
+                }
+            }
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+
+    std::vector<Peer> peers;
+    pm.getPeersSnapshot(peers);
+    StatusBuildStats stats = builder.stats();
+
+    std::printf("status bench: %d nodes (%zu peers), %d s, poll every %d ms, %d log lines/s\n", opt.nodes, peers.size(),
+                opt.seconds, opt.pollMs, opt.logsPerS);
+    std::printf("polls            : %llu, document %zu bytes p50 (%zu max)\n", (unsigned long long)polls,
+                bench::percentile(docBytes, 50), bench::percentile(docBytes, 100));
+    std::printf("incremental      : p50 %.1f us, p99 %.1f us, max %.1f us, %.1f allocations and %.0f bytes per request\n",
+                bench::percentile(incremental.us, 50), bench::percentile(incremental.us, 99), bench::percentile(incremental.us, 100),
+                polls ? (double)incremental.allocations / polls : 0.0, polls ? (double)incremental.bytes / polls : 0.0);
+    std::printf("from scratch     : p50 %.1f us, p99 %.1f us, max %.1f us, %.1f allocations and %.0f bytes per request\n",
+                bench::percentile(scratch.us, 50), bench::percentile(scratch.us, 99), bench::percentile(scratch.us, 100),
+                polls ? (double)scratch.allocations / polls : 0.0, polls ? (double)scratch.bytes / polls : 0.0);
+    double speedup = bench::percentile(incremental.us, 50) > 0 ? bench::percentile(scratch.us, 50) / bench::percentile(incremental.us, 50) : 0.0;
+    std::printf("speedup          : %.1fx at p50\n", speedup);
+    std::printf("sections         : %u regenerated, %u reused\n", stats.sectionsBuilt, stats.sectionsReused);
+
+    JsonDocument statsDoc;
+    builder.populateStats(statsDoc.to<JsonObject>());
+    JsonObject rebuilt = statsDoc["sections"].as<JsonObject>();
+    for (size_t i = 0; i < kStatusSectionCount; ++i) {
+        const StatusSection& s = kStatusSections[i];
+        uint32_t n = rebuilt[s.name].as<uint32_t>();
+        std::printf("  %-14s : %6u rebuilds (%5.1f%% of polls)\n", s.name, n, polls ? 100.0 * n / polls : 0.0);
+    }
+    std::printf("mismatches       : %llu\n", (unsigned long long)mismatches);
+
+    bool ok = true;
+    if (peers.size() != (size_t)opt.nodes) {
+        std::printf("FAIL: %zu of %d peers found\n", peers.size(), opt.nodes);
+        ok = false;
+    }
+    if (mismatches > 0) {
+        std::printf("FAIL: incremental and scratch documents differ %s\n", firstMismatch.c_str());
+        ok = false;
+    }
+    if (speedup < 2.0) {
+        std::printf("FAIL: incremental build only %.1fx faster than from scratch\n", speedup);
+        ok = false;
+    }
+    if (incremental.allocations >= scratch.allocations) {
+        std::printf("FAIL: incremental build allocates as much as a build from scratch\n");
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,384 @@
+// Host benchmark for chunked JSON responses (JsonStream).
+//
+// Serves the host-built API responses both ways at growing sizes:
+//   logs     /api/logs, with the log buffer a quarter, half and completely full
+//   tasks    /api/task, the task catalog, now served from flash
+//            (TaskCatalogJson.h) rather than streamed
+//   status   /api/status (StatusBuilder), with 8, 32 and 96 peers
+//   report   /api/report, a gather round over 8, 32 and 96 simulated nodes
+// Status and report are the firmware's own (WebDocuments.cpp); logs and
+// tasks are written as their handlers in WebServer.cpp write them.
+// The old way builds the JsonDocument, serializes it into a String and
+// hands that to the response, which keeps a copy (the report served its
+// body String in chunks instead). The streamed way reads the JsonStream in
+// TCP-segment chunks (--chunk), as the async web server's callback does.
+// For each it measures the peak heap above what was live before the
+// request, from the host allocator's counters, and checks both produce the
+// same bytes.
+// Fails when the outputs differ, when a streamed response peaks higher than
+// the old way, or when the streamed peak grows by more than a tenth of what
+// the response grows from the smallest to the largest size, and when a
+// report round finishing mid-stream changes the report being sent.
+//
+// Usage: stream_bench [--chunk N] [--verbose]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+#include "Config.h"
+#include "JsonStream.h"
+#include "LivePush.h"
+#include "Logger.h"
+#include "PeerManager.h"
+#include "PluginManager.h"
+#include "TaskCatalogJson.h"
+#include "ReportAggregator.h"
+#include "StatusBuilder.h"
+#include "WebDocuments.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+#include "SimNetwork.h"
+
+namespace {
+
+struct Options {
+    int chunk = 1436;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: stream_bench [--chunk N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--chunk") opt.chunk = std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.chunk >= 64 && opt.chunk <= 8192;
+}
+
+const uint32_t kSelf = 0xC0A80132;
+const uint32_t kMask = 0xFFFFFF00;
+const uint32_t kGateway = 0xC0A80101;
+
+// Peak heap above what was live when f started
+template <typename F>
+int64_t peakOf(F f) {
+    host::HeapStats before = host::heapStats();
+    host::resetHeapPeak();
+    f();
+    return host::heapStats().peakLiveBytes - before.liveBytes;
+}
+
+// The send buffer the callback writes into belongs to the TCP stack
+std::vector<uint8_t> gSegment;
+
+size_t drain(const std::shared_ptr<JsonStream>& stream, std::string* out) {
+    size_t total = 0;
+    for (;;) {
+        size_t n = stream->read(gSegment.data(), gSegment.size());
+        if (n == JsonStream::kWait) continue;
+        if (n == 0) break;
+        if (out) out->append((const char*)gSegment.data(), n);
+        total += n;
+    }
+    return total;
+}
+
+// Status members that differ between two builds: free heap, and the sections
+// that report on the builder and the streams themselves
+const char* const kVolatileFields[] = {"heap_free", "psram_free", "status_build", "live", "streams"};
+
+std::string comparable(const std::string& endpoint, const std::string& text) {
+    if (endpoint != "status") return text;
+    JsonDocument doc;
+    if (deserializeJson(doc, text)) return "invalid: " + text;
+    for (const char* key : kVolatileFields) doc.remove(key);
+    String out;
+    serializeJson(doc, out);
+    return out.c_str();
+}
+
+struct Case {
+    std::string endpoint;
+    std::string size;
+    size_t bytes = 0;
+    int64_t oldPeak = 0;
+    int64_t streamPeak = 0;
+    bool same = true;
+};
+
+// old: the whole response as a String (with the response's copy); stream: the JsonStream
+Case measureCase(const std::string& endpoint, const std::string& size, std::function<void(String&)> old,
+                 bool responseCopy, std::function<std::shared_ptr<JsonStream>()> stream) {
+    Case c;
+    c.endpoint = endpoint;
+    c.size = size;
+    std::string oldText, streamText;
+    c.oldPeak = peakOf([&]() {
+        String body;
+        old(body);
+        if (responseCopy) {
+            String content(body);
+            oldText = content.c_str();
+        } else {
+            oldText = body.c_str();
+        }
+    });
+    // The collected text is the bench's, not the response's: it is allocated up
+    // front, with room for volatile members to come out longer
+    streamText.reserve(oldText.size() + 1024);
+    c.streamPeak = peakOf([&]() {
+        std::shared_ptr<JsonStream> s = stream();
+        c.bytes = drain(s, &streamText);
+    });
+    oldText = comparable(endpoint, oldText);
+    streamText = comparable(endpoint, streamText);
+    c.same = oldText == streamText;
+    if (!c.same) {
+        size_t at = 0;
+        while (at < oldText.size() && at < streamText.size() && oldText[at] == streamText[at]) at++;
+        std::printf("  %s %s differs at byte %zu:\n    old    ...%s\n    stream ...%s\n", endpoint.c_str(), size.c_str(),
+                    at, oldText.substr(at > 40 ? at - 40 : 0, 120).c_str(),
+                    streamText.substr(at > 40 ? at - 40 : 0, 120).c_str());
+    }
+    return c;
+}
+
+// The logs and tasks handlers of WebServer.cpp, and the old way of each
+
+void oldLogs(String& out) {
+    JsonDocument doc;
+    JsonArray logs = doc.to<JsonArray>();
+    std::deque<String> logBuffer = Logger::instance().getLogs();
+    for (const auto& line : logBuffer) logs.add(line);
+    serializeJson(doc, out);
+}
+
+std::shared_ptr<JsonStream> streamLogs() {
+    uint32_t seq = 0;
+    uint32_t end = Logger::instance().sequence();
+    return JsonStream::array([seq, end](uint32_t, JsonDocument& doc) mutable {
+        String line;
+        if (!Logger::instance().copyLogAfter(seq, end, line)) return false;
+        doc.set(line);
+        return true;
+    });
+}
+
+void oldTasks(String& out) {
+    JsonDocument doc;
+    JsonArray arr = doc.to<JsonArray>();
+    for (size_t i = 0; i < PluginManager::taskCount(); ++i) {
+        PluginManager::populateTask(PluginManager::task(i), arr.add<JsonObject>());
+    }
+    serializeJson(doc, out);
+}
+
+// beginResponse_P copies the flash text into the send buffer
+std::shared_ptr<JsonStream> streamTasks() {
+    return JsonStream::fragments([](uint32_t index, String& out) -> uint8_t {
+        uint32_t at = index * 1436;
+        if (at >= task_catalog_json_len) return JsonStream::FRAGMENT_END;
+        out.concat(task_catalog_json + at, std::min<uint32_t>(1436, task_catalog_json_len - at));
+        return JsonStream::FRAGMENT_READY;
+    });
+}
+
+std::shared_ptr<JsonStream> streamStatus(StatusBuilder& builder) {
+    std::shared_ptr<StatusStream> cursor = std::make_shared<StatusStream>();
+    return JsonStream::fragments([&builder, cursor](uint32_t, String& out) -> uint8_t {
+        return builder.streamFragment(*cursor, out);
+    });
+}
+
+void oldReport(String& out) {
+    JsonDocument doc;
+    buildLocalReport(doc);
+    ReportAggregator::instance().populateNodes(doc["nodes"].as<JsonObject>(), Config::instance().getHostname());
+    ReportAggregator::instance().populateGather(doc.createNestedObject("gather"));
+    serializeJson(doc, out);
+}
+
+// The round the bench just ran is ready: the stream starts at once
+std::shared_ptr<JsonStream> streamReport() {
+    return streamClusterReport(ReportAggregator::instance().lastRound().round, millis(), Config::instance().getHostname());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+    gSegment.resize((size_t)opt.chunk);
+
+    host::setSerialEcho(opt.verbose);
+    host::Clock::setEpochBase(1767225600);
+    host::Clock::reset(0);
+    WiFi.setHostNetwork(SubnetScanner::fromHostOrder(kSelf), SubnetScanner::fromHostOrder(kMask),
+                        SubnetScanner::fromHostOrder(kGateway));
+    SimNetwork net;
+    host::attachNetwork(&net);
+
+    Config::instance().begin();
+    PeerManager& pm = PeerManager::instance();
+    pm.begin();
+    ReportAggregator& agg = ReportAggregator::instance();
+    agg.begin();
+
+    StatusBuilder builder;
+    LivePush push;
+    addStatusSections(builder, push);
+
+    std::vector<Case> cases;
+
+    // Logs: the buffer holds 200 lines or 20 KB
+    uint32_t line = 0;
+    const char* fill[] = {"25%", "50%", "100%"};
+    const int lines[] = {50, 100, 250};
+    for (int k = 0; k < 3; ++k) {
+        while ((int)line < lines[k]) {
+            Logger::instance().info("Bench", "Line %lu: sweep 902-928 MHz, 1040 bins, peak -61 dBm at %lu kHz",
+                                    (unsigned long)line, (unsigned long)(902000 + line * 25));
+            line++;
+        }
+        cases.push_back(measureCase("logs", fill[k], oldLogs, true, streamLogs));
+    }
+
+    cases.push_back(measureCase("tasks", "catalog", oldTasks, true, streamTasks));
+
+    // Peers: more nodes join between the sizes
+    const int nodeCounts[] = {8, 32, 96};
+    int added = 0;
+    std::vector<uint32_t> stalledHosts;   // stop answering for the mid-stream round
+    for (int nodes : nodeCounts) {
+        for (; added < nodes; ++added) {
+            SimHost h;
+            h.hostname = "eye-" + std::to_string(added);
+            h.task = "Detect";
+            h.connectUs = 2000;
+            h.replyUs = 8000 + (uint32_t)(added % 8) * 3000;
+            uint32_t ip = (uint32_t)SubnetScanner::fromHostOrder((kSelf & kMask) + 100 + (uint32_t)added);
+            net.addHost(ip, h);
+            if (added % 8 == 0) stalledHosts.push_back(ip);
+            pm.trackIncomingRequest(IPAddress(ip).toString());
+        }
+        std::vector<Peer> peers;
+        for (int i = 0; i < 6000; ++i) {
+            pm.loop();
+            agg.loop();
+            vTaskDelay(pdMS_TO_TICKS(10));
+            pm.getPeersSnapshot(peers);
+            if ((int)peers.size() >= nodes) break;
+        }
+        // Past the reuse window of the last round: this one asks every node
+        vTaskDelay(pdMS_TO_TICKS(ReportAggregator::kReuseMs + 100));
+        uint32_t round = agg.requestRound();
+        unsigned long requestedAt = millis();
+        while (!agg.roundReady(round, requestedAt)) {
+            pm.loop();
+            agg.loop();
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+        ReportRoundStats stats = agg.lastRound();
+        std::string label = std::to_string(peers.size()) + " peers";
+        if (stats.fresh != peers.size()) {
+            std::printf("  round %u: %u of %zu peers fresh\n", stats.round, stats.fresh, peers.size());
+        }
+
+        cases.push_back(measureCase("status", label, [&](String& out) { builder.build(out); }, true,
+                                    [&]() { return streamStatus(builder); }));
+        cases.push_back(measureCase("report", label, oldReport, false, streamReport));
+    }
+
+    // A round that finishes while a report streams must not cut it short: the
+    // response keeps serving the round it started with, every peer of it
+    std::vector<Peer> peers;
+    pm.getPeersSnapshot(peers);
+    ReportRoundStats pinned = agg.lastRound();
+    std::shared_ptr<JsonStream> midStream = streamReport();
+    std::string midText;
+    size_t firstPart = midStream->read(gSegment.data(), std::min<size_t>(gSegment.size(), 256));
+    midText.append((const char*)gSegment.data(), firstPart);
+    for (uint32_t ip : stalledHosts) net.host(ip)->kind = SimHost::STALLED;
+    vTaskDelay(pdMS_TO_TICKS(ReportAggregator::kReuseMs + 100));
+    uint32_t nextRound = agg.requestRound();
+    unsigned long nextAt = millis();
+    while (!agg.roundReady(nextRound, nextAt)) {
+        pm.loop();
+        agg.loop();
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    drain(midStream, &midText);
+    JsonDocument midDoc;
+    bool midOk = !deserializeJson(midDoc, midText.c_str());
+    size_t midNodes = midOk ? midDoc["nodes"].as<JsonObject>().size() : 0;
+    size_t midStale = 0;
+    if (midOk) {
+        for (JsonPair kv : midDoc["nodes"].as<JsonObject>()) midStale += kv.value()["stale"].is<bool>();
+    }
+    uint32_t midRound = midOk ? midDoc["gather"]["round"].as<uint32_t>() : 0;
+
+    std::printf("stream bench: %d-byte chunks, peak heap per request above what was live before it\n", opt.chunk);
+    std::printf("  %-7s %-9s %9s %12s %12s\n", "", "", "bytes", "old peak", "streamed");
+    bool ok = true;
+    for (const Case& c : cases) {
+        std::printf("  %-7s %-9s %9zu %12lld %12lld%s\n", c.endpoint.c_str(), c.size.c_str(), c.bytes,
+                    (long long)c.oldPeak, (long long)c.streamPeak, c.same ? "" : "  DIFFERS");
+        if (!c.same) {
+            std::printf("FAIL: %s %s: streamed response differs\n", c.endpoint.c_str(), c.size.c_str());
+            ok = false;
+        }
+        if (c.streamPeak > c.oldPeak) {
+            std::printf("FAIL: %s %s: streamed response peaks higher than before\n", c.endpoint.c_str(), c.size.c_str());
+            ok = false;
+        }
+    }
+    // Growth from the smallest to the largest size of each endpoint
+    for (const char* endpoint : {"logs", "status", "report"}) {
+        const Case* smallest = nullptr;
+        const Case* largest = nullptr;
+        for (const Case& c : cases) {
+            if (c.endpoint != endpoint) continue;
+            if (!smallest) smallest = &c;
+            largest = &c;
+        }
+        if (!smallest || smallest == largest) continue;
+        int64_t grew = (int64_t)largest->bytes - (int64_t)smallest->bytes;
+        int64_t oldGrew = largest->oldPeak - smallest->oldPeak;
+        int64_t streamGrew = largest->streamPeak - smallest->streamPeak;
+        std::printf("  %-7s response +%lld bytes: old peak %+lld, streamed peak %+lld\n", endpoint, (long long)grew,
+                    (long long)oldGrew, (long long)streamGrew);
+        if (streamGrew * 10 > grew) {
+            std::printf("FAIL: %s: streamed peak grows with the response\n", endpoint);
+            ok = false;
+        }
+    }
+    std::printf("  report with round %u finishing mid-stream: %zu nodes, %zu stale, gather of round %u\n",
+                agg.lastRound().round, midNodes, midStale, midRound);
+    if (!midOk || midNodes != peers.size() + 1 || midStale != pinned.stale || midRound != pinned.round) {
+        std::printf("FAIL: report: a round finishing mid-stream changed the response (want %zu nodes of round %u)\n",
+                    peers.size() + 1, pinned.round);
+        ok = false;
+    }
+    JsonStreamStats stats = JsonStream::stats();
+    std::printf("  streams: %u responses, %u bytes, largest %u, largest fragment %u\n", stats.responses, stats.bytes,
+                stats.maxBytes, stats.maxFragment);
+    return ok ? 0 : 1;
+}
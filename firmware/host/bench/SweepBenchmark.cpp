@@ -0,0 +1,521 @@
+// Host benchmark for the spectrum sweep path.
+//
+// Runs the real PluginManager/SpectrumPlugin/HAL code against SimCc1101 and
+// reports two kinds of numbers:
+//   - device model: virtual-clock time (SPI wire time, RTOS delays, radio
+//     settling) -> points/sec, sweep duration and per-hop latency as the
+//     ESP32-S3 would see them;
+//   - host: CPU time and heap churn of the same code path, useful to spot
+//     allocations and serialization cost in the report path.
+//
+// Usage: sweep_bench [--scene file] [--sweeps N] [--start MHz] [--stop MHz]
+//                    [--bandwidth kHz] [--warmup N] [--min-pps N] [--samples N]
+//                    [--task id] [--adaptive] [--verbose]
+//
+// Warm-up sweeps (default 1) run before measurement so one-time work such as
+// hop-table calibration is not counted as sweep time.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "Config.h"
+#include "FastHopEngine.h"
+#include "HAL.h"
+#include "PluginManager.h"
+#include "Scheduler.h"
+#include "SpectrumAccumulator.h"
+#include "SpectrumDetector.h"
+#include "SpectrumFrame.h"
+#include "WaterfallStore.h"
+#include "BenchUtil.h"
+#include "HostRuntime.h"
+#include "RfEnvironment.h"
+#include "SimCc1101.h"
+
+namespace {
+
+struct Options {
+    std::string scene;
+    std::string task = "spectrum/scan";
+    int sweeps = 20;
+    int warmup = 1;
+    float startMhz = 902.0f;
+    float stopMhz = 928.0f;
+    float bandwidthKhz = 500.0f;
+    double minPointsPerSec = 0.0;
+    int samples = 1;
+    bool adaptive = false;
+    bool verbose = false;
+};
+
+struct SweepSample {
+    int32_t startOffsetUs;
+    uint64_t points;
+    uint64_t virtualUs;
+    uint64_t hostNs;
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+void usage() {
+    std::printf("usage: sweep_bench [--scene file] [--sweeps N] [--start MHz] [--stop MHz]\n"
+                "                   [--bandwidth kHz] [--warmup N] [--min-pps N] [--samples N]\n"
+                "                   [--task id] [--adaptive] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--scene") opt.scene = args.value();
+        else if (a == "--sweeps") opt.sweeps = std::atoi(args.value());
+        else if (a == "--start") opt.startMhz = (float)std::atof(args.value());
+        else if (a == "--stop") opt.stopMhz = (float)std::atof(args.value());
+        else if (a == "--bandwidth") opt.bandwidthKhz = (float)std::atof(args.value());
+        else if (a == "--warmup") opt.warmup = std::atoi(args.value());
+        else if (a == "--min-pps") opt.minPointsPerSec = std::atof(args.value());
+        else if (a == "--task") opt.task = args.value();
+        else if (a == "--samples") opt.samples = std::atoi(args.value());
+        else if (a == "--adaptive") opt.adaptive = true;
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.sweeps > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    RfEnvironment env;
+    if (!opt.scene.empty()) {
+        std::string err;
+        if (!env.loadScript(opt.scene, &err)) {
+            std::fprintf(stderr, "scene: %s\n", err.c_str());
+            return 2;
+        }
+    } else {
+        env.setNoiseFloor(-105.0f, 1.5f);
+        env.addCarrier({906.4f, -45.0f, 200.0f});
+        env.addCarrier({915.0f, -60.0f, 500.0f});
+        env.addBurst({920.2f, -50.0f, 250.0f, 0, 20, 100});
+    }
+
+    host::setSerialEcho(opt.verbose);
+    // Start one second before a 10 s boundary so the first sweep is aligned.
+    host::Clock::setEpochBase(1767225599);
+    host::Clock::reset(0);
+
+    SimCc1101 radio(env);
+    host::attachSpiDevice(FSPI, &radio);
+
+    Config::instance().begin();
+    WaterfallStore::instance().begin(2048);
+    HAL::instance().init();
+    if (!HAL::instance().hasRadio()) {
+        std::fprintf(stderr, "radio init failed\n");
+        return 1;
+    }
+    Scheduler::instance().begin();
+
+    JsonDocument params;
+    params["start"] = opt.startMhz;
+    params["stop"] = opt.stopMhz;
+    params["bandwidth"] = opt.bandwidthKhz;
+    params["samples"] = opt.samples;
+    if (opt.adaptive) params["adaptive"] = true;
+    if (!PluginManager::instance().startTask(opt.task, params.as<JsonObject>())) {
+        std::fprintf(stderr, "%s did not start\n", opt.task.c_str());
+        return 1;
+    }
+
+    radio.resetStats();
+    std::vector<SweepSample> sweeps;
+    sweeps.reserve(opt.sweeps);
+    int warmupLeft = opt.warmup;
+    uint64_t warmupVirtualUs = 0;
+    size_t timeViolations = 0;
+
+    const uint64_t deadlineUs = host::Clock::nowUs() + (uint64_t)(opt.sweeps + opt.warmup + 1) * 10ULL * 1000000ULL;
+    while ((int)sweeps.size() < opt.sweeps && host::Clock::nowUs() < deadlineUs) {
+        uint64_t hops0 = radio.stats().hops;
+        uint64_t v0 = host::Clock::nowUs();
+        host::HeapStats h0 = host::heapStats();
+        auto t0 = std::chrono::steady_clock::now();
+
+        PluginManager::instance().runLoop();
+
+        auto t1 = std::chrono::steady_clock::now();
+        host::HeapStats h1 = host::heapStats();
+        uint64_t hops = radio.stats().hops - hops0;
+        if (hops == 0) continue; // idle pass waiting for the next 10 s slot
+
+        // Time from the slot boundary, not from the start of the blocking wait before it.
+        uint8_t timed[kSpectrumFrameMaxBytes];
+        ASEPlugin* active = PluginManager::instance().getActivePlugin();
+        size_t timedLen = active ? active->getSpectrumFrame(timed, sizeof(timed), SPECTRUM_BINS_INT8,
+                                                            SWEEP_CHANNEL_LIVE, true) : 0;
+        if (timedLen < kSpectrumFrameHeaderBytes) continue;
+        uint32_t slotEpoch = (uint32_t)(timed[16] | (timed[17] << 8) | (timed[18] << 16) | ((uint32_t)timed[19] << 24));
+        int32_t startOffsetUs = (int32_t)(timed[32] | (timed[33] << 8) | (timed[34] << 16) | ((uint32_t)timed[35] << 24));
+        uint64_t slotVirtualUs = ((uint64_t)slotEpoch - host::Clock::epochBase()) * 1000000ULL;
+        uint64_t sweepStart = std::max(v0, slotVirtualUs);
+        if (warmupLeft > 0) {
+            warmupLeft--;
+            warmupVirtualUs += host::Clock::nowUs() - sweepStart;
+            radio.resetStats();
+            continue;
+        }
+
+        // Bin read times must rise through the sweep and end within it.
+        uint16_t timedBins = (uint16_t)(timed[6] | (timed[7] << 8));
+        const uint8_t* t = timed + kSpectrumFrameHeaderBytes + timedBins;
+        uint32_t prevUs = 0;
+        for (uint16_t i = 0; i < timedBins; ++i, t += 4) {
+            uint32_t us = (uint32_t)(t[0] | (t[1] << 8) | (t[2] << 16) | ((uint32_t)t[3] << 24));
+            if ((i > 0 && us <= prevUs) || (uint64_t)startOffsetUs + us > host::Clock::nowUs() - slotVirtualUs) {
+                timeViolations++;
+            }
+            prevUs = us;
+        }
+
+        SweepSample s;
+        s.startOffsetUs = startOffsetUs;
+        s.points = hops;
+        s.virtualUs = host::Clock::nowUs() - sweepStart;
+        s.hostNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+        s.allocations = h1.allocations - h0.allocations;
+        s.bytes = h1.bytesAllocated - h0.bytesAllocated;
+        sweeps.push_back(s);
+    }
+
+    if (sweeps.empty()) {
+        std::fprintf(stderr, "no sweeps completed\n");
+        return 1;
+    }
+
+    // Report path: the same getJsonData() + serializeJson() /api/report uses.
+    ASEPlugin* plugin = PluginManager::instance().getActivePlugin();
+    host::HeapStats r0 = host::heapStats();
+    host::resetHeapPeak();
+    auto rt0 = std::chrono::steady_clock::now();
+    JsonDocument report;
+    plugin->getJsonData(report.to<JsonObject>());
+    String reportJson;
+    serializeJson(report, reportJson);
+    auto rt1 = std::chrono::steady_clock::now();
+    host::HeapStats r1 = host::heapStats();
+
+    // Binary frame path (/api/spectrum/frame).
+    uint8_t frame[kSpectrumFrameMaxBytes];
+    host::HeapStats f0 = host::heapStats();
+    auto ft0 = std::chrono::steady_clock::now();
+    size_t frameLen = plugin->getSpectrumFrame(frame, sizeof(frame), SPECTRUM_BINS_INT8, SWEEP_CHANNEL_LIVE);
+    auto ft1 = std::chrono::steady_clock::now();
+    host::HeapStats f1 = host::heapStats();
+
+    // Accumulator channels: hold bounds must bracket the average and the live sweep.
+    uint8_t holdFrames[kSweepChannels][kSpectrumFrameMaxBytes];
+    size_t holdViolations = 0;
+    uint16_t accumulated = 0;
+    double occupancySum = 0.0;
+    for (uint8_t c = SWEEP_CHANNEL_MAX_HOLD; c < kSweepChannels; ++c) {
+        if (plugin->getSpectrumFrame(holdFrames[c], kSpectrumFrameMaxBytes, SPECTRUM_BINS_INT16, c) == 0) holdViolations++;
+    }
+    auto bin16 = [&](uint8_t c, size_t i) {
+        const uint8_t* p = holdFrames[c] + kSpectrumFrameHeaderBytes + 2 * i;
+        return (int16_t)(p[0] | (p[1] << 8));
+    };
+    size_t liveBins = frameLen > kSpectrumFrameHeaderBytes ? frameLen - kSpectrumFrameHeaderBytes : 0;
+    if (holdViolations == 0) {
+        accumulated = (uint16_t)(holdFrames[SWEEP_CHANNEL_MAX_HOLD][30] | (holdFrames[SWEEP_CHANNEL_MAX_HOLD][31] << 8));
+        for (size_t i = 0; i < liveBins; ++i) {
+            int16_t hi = bin16(SWEEP_CHANNEL_MAX_HOLD, i);
+            int16_t lo = bin16(SWEEP_CHANNEL_MIN_HOLD, i);
+            int16_t avg = bin16(SWEEP_CHANNEL_AVERAGE, i);
+            int8_t now = (int8_t)frame[kSpectrumFrameHeaderBytes + i];
+            if (lo > hi || avg < lo || avg > hi || now * 100 > hi + 50 || now * 100 < lo - 50) holdViolations++;
+            occupancySum += bin16(SWEEP_CHANNEL_OCCUPANCY, i) / 100.0;
+        }
+    }
+
+    // Multi-sample bins: the strongest sample bounds the mean, and the spread is never negative.
+    size_t sampleViolations = 0;
+    double varianceSum = 0.0;
+    for (size_t i = 0; i < liveBins && holdViolations == 0; ++i) {
+        int8_t mean = (int8_t)frame[kSpectrumFrameHeaderBytes + i];
+        int16_t peak = bin16(SWEEP_CHANNEL_SAMPLE_MAX, i);
+        int16_t variance = bin16(SWEEP_CHANNEL_SAMPLE_VARIANCE, i);
+        if (peak < mean * 100 - 50 || variance < 0 || (opt.samples <= 1 && variance != 0)) sampleViolations++;
+        varianceSum += variance / 100.0;
+    }
+
+    // Host cost of one accumulator update over a full-width sweep.
+    SpectrumAccumulator bench;
+    int16_t synthetic[kSweepMaxBins];
+    for (uint16_t i = 0; i < kSweepMaxBins; ++i) synthetic[i] = (int16_t)(-9500 + (i * 37) % 2000);
+    const int accumulatorRounds = 20000;
+    auto at0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < accumulatorRounds; ++r) {
+        synthetic[r % kSweepMaxBins] ^= 1;
+        bench.update(synthetic, kSweepMaxBins);
+    }
+    auto at1 = std::chrono::steady_clock::now();
+    static SweepSlot sink;
+    sink.binCount = kSweepMaxBins;
+    bench.exportTo(sink);
+
+    // History path (/api/spectrum/waterfall): every stored sweep in one response.
+    WaterfallQuery fullQuery;
+    size_t fullPlanned = WaterfallStore::instance().plan(fullQuery);
+    std::vector<uint8_t> history(fullPlanned);
+    auto wt0 = std::chrono::steady_clock::now();
+    size_t historyLen = WaterfallStore::instance().encode(fullQuery, history.data(), history.size());
+    auto wt1 = std::chrono::steady_clock::now();
+    WaterfallInfo historyInfo = WaterfallStore::instance().info();
+
+    // The newest undecimated row must match the int8 frame bin for bin.
+    size_t historyMismatches = 0;
+    if (historyLen > kWaterfallHeaderBytes && frameLen > kSpectrumFrameHeaderBytes && fullQuery.timeDecimation == 1 &&
+        fullQuery.freqDecimation == 1) {
+        uint16_t cols = (uint16_t)(history[8] | (history[9] << 8));
+        const uint8_t* lastRow = history.data() + historyLen - cols;
+        size_t frameBinCount = frameLen - kSpectrumFrameHeaderBytes;
+        if (cols != frameBinCount) historyMismatches++;
+        for (size_t i = 0; i < std::min<size_t>(cols, frameBinCount); ++i) {
+            if (lastRow[i] != frame[kSpectrumFrameHeaderBytes + i]) historyMismatches++;
+        }
+    }
+
+    // Detector: every continuous carrier clearly above the floor must be an event of the
+    // last sweep, and every event must sit on a carrier or a burst of the scene.
+    JsonObject detection = report["detection"].as<JsonObject>();
+    JsonArray events = detection["events"].as<JsonArray>();
+    float detectStepMhz = report["step_mhz"].as<float>();
+    float detectDb = detection["threshold_db"].as<float>();
+    size_t carriersExpected = 0, carriersFound = 0, falseEvents = 0;
+    for (const RfCarrier& c : env.carriers()) {
+        if (c.freqMhz < opt.startMhz || c.freqMhz > opt.stopMhz) continue;
+        if (env.staticDbm(c.freqMhz, radio.rxBandwidthKhz()) < env.noiseFloorDbm() + detectDb + 6.0f) continue;
+        carriersExpected++;
+        for (JsonObject e : events) {
+            float half = e["width_khz"].as<float>() / 2000.0f + detectStepMhz;
+            if (std::fabs(e["center_mhz"].as<float>() - c.freqMhz) <= half) {
+                carriersFound++;
+                break;
+            }
+        }
+    }
+    for (JsonObject e : events) {
+        float center = e["center_mhz"].as<float>();
+        float half = e["width_khz"].as<float>() / 2000.0f + detectStepMhz;
+        bool known = false;
+        for (const RfCarrier& c : env.carriers()) known |= std::fabs(center - c.freqMhz) <= half + c.widthKhz / 2000.0f;
+        for (const RfBurst& b : env.bursts()) known |= std::fabs(center - b.freqMhz) <= half + b.widthKhz / 2000.0f;
+        if (!known) falseEvents++;
+    }
+    size_t eventsJsonBytes = measureJson(events);
+    size_t pointsJsonBytes = measureJson(report["points"]);
+
+    // Host cost of one detection pass over a full-width sweep.
+    SpectrumDetector detectorBench;
+    static SpectrumEvent eventSink[SpectrumDetector::kMaxEventsPerSweep];
+    SweepHeader syntheticSweep;
+    syntheticSweep.binCount = kSweepMaxBins;
+    syntheticSweep.stepMhz = 0.5f;
+    size_t detectorEvents = 0;
+    const int detectorRounds = 20000;
+    auto dt0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < detectorRounds; ++r) {
+        synthetic[(r * 7) % kSweepMaxBins] = (int16_t)((r & 1) ? -4000 : -9500);
+        detectorEvents += detectorBench.detect(syntheticSweep, synthetic, nullptr, eventSink, SpectrumDetector::kMaxEventsPerSweep);
+    }
+    auto dt1 = std::chrono::steady_clock::now();
+
+    // Accuracy against the scene as it was at each bin's read time (bursts included).
+    double absErr = 0.0;
+    size_t errCount = 0;
+    uint64_t reportSlotUs = ((uint64_t)report["sweep_epoch"].as<uint32_t>() - host::Clock::epochBase()) * 1000000ULL +
+                            report["sweep_start_offset_us"].as<int32_t>();
+    for (JsonObject p : report["points"].as<JsonArray>()) {
+        float f = p["freq_mhz"].as<float>();
+        float measured = p["rssi_dbm"].as<float>();
+        absErr += std::fabs(measured - env.expectedDbm(f, radio.rxBandwidthKhz(), reportSlotUs + p["t_us"].as<uint32_t>()));
+        errCount++;
+    }
+
+    uint64_t totalPoints = 0, totalVirtualUs = 0, totalHostNs = 0, totalAllocs = 0, totalBytes = 0;
+    std::vector<uint64_t> sweepUs;
+    std::vector<int32_t> startOffsets;
+    for (const SweepSample& s : sweeps) {
+        totalPoints += s.points;
+        totalVirtualUs += s.virtualUs;
+        totalHostNs += s.hostNs;
+        totalAllocs += s.allocations;
+        totalBytes += s.bytes;
+        sweepUs.push_back(s.virtualUs);
+        startOffsets.push_back(s.startOffsetUs);
+    }
+    std::vector<uint32_t> hopUs(radio.hopSampleCount());
+    hopUs.resize(radio.copyHopPeriods(hopUs.data(), hopUs.size()));
+    // Drop the gaps between sweeps; only intra-sweep hops are per-hop latency.
+    hopUs.erase(std::remove_if(hopUs.begin(), hopUs.end(), [](uint32_t us) { return us > 1000000; }), hopUs.end());
+
+    const SimCc1101Stats& rs = radio.stats();
+    double n = (double)sweeps.size();
+    double pps = totalVirtualUs ? (double)totalPoints * 1e6 / (double)totalVirtualUs : 0.0;
+    double hostPps = totalHostNs ? (double)totalPoints * 1e9 / (double)totalHostNs : 0.0;
+
+    std::printf("scene            : %s\n", env.describe().c_str());
+    std::printf("sweep            : %.3f-%.3f MHz, bandwidth %.1f kHz, radio rx bw %.1f kHz\n",
+                opt.startMhz, opt.stopMhz, opt.bandwidthKhz, radio.rxBandwidthKhz());
+    std::printf("sweeps           : %zu (%.1f points/sweep), %d warm-up (%.2f ms)\n", sweeps.size(),
+                (double)totalPoints / n, opt.warmup, warmupVirtualUs / 1000.0);
+    std::printf("\n[device model: virtual clock]\n");
+    std::printf("points/sec       : %.1f\n", pps);
+    std::printf("sweep duration   : p50 %.2f ms  p95 %.2f ms  max %.2f ms\n",
+                bench::percentile(sweepUs, 50) / 1000.0, bench::percentile(sweepUs, 95) / 1000.0, bench::percentile(sweepUs, 100) / 1000.0);
+    std::printf("hop period       : p50 %u us  p95 %u us  p99 %u us  max %u us\n",
+                bench::percentile(hopUs, 50), bench::percentile(hopUs, 95), bench::percentile(hopUs, 99), bench::percentile(hopUs, 100));
+    std::printf("spi bytes/point  : %.1f (%.1f transactions)\n",
+                totalPoints ? (double)rs.spiBytes / totalPoints : 0.0,
+                totalPoints ? (double)rs.spiTransactions / totalPoints : 0.0);
+    JsonObject trigger = report["trigger"].as<JsonObject>();
+    std::printf("sweep start      : p50 %+d us  p95 %+d us  max %+d us after the slot boundary "
+                "(fired %u, late %u, missed %u), %zu bin time violations\n",
+                bench::percentile(startOffsets, 50), bench::percentile(startOffsets, 95), bench::percentile(startOffsets, 100),
+                trigger["fired"].as<unsigned>(), trigger["late"].as<unsigned>(), trigger["missed"].as<unsigned>(),
+                timeViolations);
+    std::printf("calibrations     : %llu (%.2f/point)\n", (unsigned long long)rs.calibrations,
+                totalPoints ? (double)rs.calibrations / totalPoints : 0.0);
+    std::printf("rssi reads       : %llu (stale %llu, unlocked %llu, repeated %llu)\n", (unsigned long long)rs.rssiReads,
+                (unsigned long long)rs.staleRssiReads, (unsigned long long)rs.unlockedRssiReads,
+                (unsigned long long)rs.repeatedRssiReads);
+    std::printf("samples per bin  : %d every %u us, mean in-bin variance %.2f dB^2, %zu bound violations\n",
+                report["samples_per_bin"].as<int>(), report["sample_interval_us"].as<unsigned>(),
+                liveBins ? varianceSum / liveBins : 0.0, sampleViolations);
+    std::printf("rssi abs error   : %.2f dB mean over %zu points\n", errCount ? absErr / errCount : 0.0, errCount);
+    std::printf("tx attempts      : %llu\n", (unsigned long long)rs.txAttempts);
+    std::printf("\n[host]\n");
+    std::printf("cpu per sweep    : %.1f us (%.0f points/sec host)\n", (double)totalHostNs / n / 1000.0, hostPps);
+    std::printf("heap per sweep   : %.1f allocations, %.0f bytes\n", (double)totalAllocs / n, (double)totalBytes / n);
+    std::printf("report json      : %u bytes, %.1f us, %llu allocations, peak +%lld bytes\n",
+                (unsigned)reportJson.length(),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(rt1 - rt0).count() / 1000.0,
+                (unsigned long long)(r1.allocations - r0.allocations),
+                (long long)(r1.peakLiveBytes - r0.liveBytes));
+
+    // Compare per bin against the JSON points of the same sweep.
+    double frameBins = (double)(frameLen > kSpectrumFrameHeaderBytes ? frameLen - kSpectrumFrameHeaderBytes : 0);
+    std::printf("spectrum frame   : %zu bytes (%.0fx smaller per sweep than JSON points), %.1f us, %llu allocations\n",
+                frameLen,
+                (frameLen && errCount) ? ((double)measureJson(report["points"]) / errCount * frameBins) / frameLen : 0.0,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(ft1 - ft0).count() / 1000.0,
+                (unsigned long long)(f1.allocations - f0.allocations));
+
+    std::printf("accumulators     : %u sweeps, mean occupancy %.1f %%, %zu bound violations, update %.2f ns/bin\n",
+                accumulated, liveBins ? occupancySum / liveBins : 0.0, holdViolations,
+                (double)std::chrono::duration_cast<std::chrono::nanoseconds>(at1 - at0).count() /
+                    ((double)accumulatorRounds * kSweepMaxBins));
+    std::printf("detector         : %zu events in the last sweep (%zu/%zu carriers found, %zu false), "
+                "%zu bytes of events vs %zu bytes of points, %.2f ns/bin (%zu synthetic events)\n",
+                events.size(), carriersFound, carriersExpected, falseEvents, eventsJsonBytes, pointsJsonBytes,
+                (double)std::chrono::duration_cast<std::chrono::nanoseconds>(dt1 - dt0).count() /
+                    ((double)detectorRounds * kSweepMaxBins), detectorEvents);
+    std::printf("waterfall        : %u rows stored, %zu bytes for all of them (tdec %u fdec %u), %.1f us, %zu row mismatches\n",
+                historyInfo.rows, historyLen, fullQuery.timeDecimation, fullQuery.freqDecimation,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(wt1 - wt0).count() / 1000.0, historyMismatches);
+
+    if (rs.txAttempts > 0) {
+        std::fprintf(stderr, "FAIL: transmit strobe issued (node is RX only)\n");
+        return 1;
+    }
+    if (opt.adaptive && !report["adaptive"].isNull()) {
+        JsonObject adaptive = report["adaptive"].as<JsonObject>();
+        float detailBw = adaptive["detail_rx_bandwidth_khz"].as<float>();
+        double detailErr = 0.0;
+        size_t detailCount = 0;
+        size_t segmentCount = 0;
+        for (JsonObject seg : adaptive["segments"].as<JsonArray>()) {
+            float f0 = seg["start_mhz"].as<float>();
+            float step = seg["step_mhz"].as<float>();
+            size_t k = 0;
+            for (JsonVariant v : seg["rssi_dbm"].as<JsonArray>()) {
+                detailErr += std::fabs(v.as<float>() - env.staticDbm(f0 + step * k++, detailBw));
+                detailCount++;
+            }
+            segmentCount++;
+        }
+
+        // Ground truth for the saving: time every bin of the fine grid on the same radio.
+        FastHopEngine full;
+        full.begin(HAL::instance().getRadioSPI(), HAL::instance().getRadioCsPin());
+        full.prepare(opt.startMhz, opt.stopMhz, adaptive["coarse_step_mhz"].as<float>(),
+                     adaptive["coarse_rx_bandwidth_khz"].as<float>());
+        full.beginDetail(opt.bandwidthKhz);
+        uint64_t fullBins = (uint64_t)((opt.stopMhz - opt.startMhz) / (opt.bandwidthKhz / 1000.0f) + 0.001f) + 1;
+        uint64_t unlocked0 = radio.stats().unlockedRssiReads;
+        uint64_t ft = host::Clock::nowUs();
+        for (uint64_t k = 0; k < fullBins; ++k) full.measureAt(opt.startMhz + (opt.bandwidthKhz / 1000.0f) * k);
+        uint64_t fullUs = host::Clock::nowUs() - ft;
+        uint64_t fullUnlocked = radio.stats().unlockedRssiReads - unlocked0;
+        full.end();
+
+        uint32_t sweepUsTotal = report["sweep_duration_us"].as<uint32_t>();
+        std::printf("\n[adaptive]\n");
+        std::printf("coarse pass      : %u bins @ %.3f MHz, %.2f ms, floor %.1f dBm, threshold %.1f dBm\n",
+                    report["points_count"].as<unsigned>(), adaptive["coarse_step_mhz"].as<float>(),
+                    adaptive["coarse_us"].as<uint32_t>() / 1000.0, adaptive["noise_floor_dbm"].as<float>(),
+                    adaptive["threshold_dbm"].as<float>());
+        std::printf("detail pass      : %u bins in %zu segments (%u flagged, %u dropped, %u scal), %.2f ms, rssi err %.2f dB\n",
+                    adaptive["detail_bins"].as<unsigned>(), segmentCount, adaptive["flagged_bins"].as<unsigned>(),
+                    adaptive["dropped_bins"].as<unsigned>(), adaptive["detail_calibrations"].as<unsigned>(),
+                    adaptive["detail_us"].as<uint32_t>() / 1000.0, detailCount ? detailErr / detailCount : 0.0);
+        std::printf("full fine sweep  : %llu bins (%llu unlocked), %.2f ms measured, %.2f ms reported estimate\n",
+                    (unsigned long long)fullBins, (unsigned long long)fullUnlocked, fullUs / 1000.0,
+                    adaptive["full_detail_sweep_us"].as<uint32_t>() / 1000.0);
+        std::printf("time saved       : %.1f %% reported, %.1f %% vs measured full sweep\n",
+                    adaptive["time_saved_pct"].as<float>(),
+                    fullUs ? 100.0 * (1.0 - (double)sweepUsTotal / (double)fullUs) : 0.0);
+    }
+
+    if (holdViolations > 0) {
+        std::fprintf(stderr, "FAIL: accumulator channels inconsistent with the live sweep\n");
+        return 1;
+    }
+    if (timeViolations > 0) {
+        std::fprintf(stderr, "FAIL: per-bin timestamps out of order or outside the sweep\n");
+        return 1;
+    }
+    if (carriersFound < carriersExpected || falseEvents > 0) {
+        std::fprintf(stderr, "FAIL: detector missed a carrier or reported an emission not in the scene\n");
+        return 1;
+    }
+    if (sampleViolations > 0) {
+        std::fprintf(stderr, "FAIL: sample max/variance inconsistent with the bin mean\n");
+        return 1;
+    }
+    if (historyMismatches > 0) {
+        std::fprintf(stderr, "FAIL: waterfall row differs from the published sweep\n");
+        return 1;
+    }
+    if (opt.minPointsPerSec > 0.0 && pps < opt.minPointsPerSec) {
+        std::fprintf(stderr, "FAIL: %.1f points/sec below --min-pps %.1f\n", pps, opt.minPointsPerSec);
+        return 1;
+    }
+    return 0;
+}
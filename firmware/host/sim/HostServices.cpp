@@ -0,0 +1,51 @@
+// Host stand-ins for the firmware services that own ESP32-only resources
+// (WiFi/SNTP in Kernel, the BLE stack in BleRangingManager). Only the members
+// the plugin/scheduler core and the status sections (WebDocuments.cpp) call
+// are provided; time comes from host::Clock.
+
+#include "Kernel.h"
+#include "BleRangingManager.h"
+#include "HostRuntime.h"
+
+Kernel& Kernel::instance() {
+    static Kernel _instance;
+    return _instance;
+}
+
+Kernel::Kernel() {}
+
+bool Kernel::isTimeSynced() { return true; }
+
+time_t Kernel::getEpochTime() {
+    return static_cast<time_t>(host::Clock::epochUs() / 1000000ULL);
+}
+
+uint64_t Kernel::getEpochTimeUs() { return host::Clock::epochUs(); }
+
+String Kernel::getTimezone() { return "UTC0"; }
+
+void Kernel::applyTimezone(const String& timezone) { (void)timezone; }
+
+// No WiFi or radio POST to report on: an idle, healthy node
+String Kernel::getStatusMessage() { return "Ready"; }
+
+BleRangingManager& BleRangingManager::instance() {
+    static BleRangingManager _instance;
+    return _instance;
+}
+
+void BleRangingManager::begin() {}
+void BleRangingManager::stop() {}
+void BleRangingManager::loop() { vTaskDelay(pdMS_TO_TICKS(100)); }
+
+// No BLE stack: the configuration, nothing scanned
+void BleRangingManager::populateStatus(JsonObject& obj) const {
+    obj["enabled"] = _config.enabled;
+    obj["scan_interval_ms"] = _config.scanIntervalMs;
+    obj["scan_window_ms"] = _config.scanWindowMs;
+    obj["advertise_interval_ms"] = _config.advertiseIntervalMs;
+    obj["last_scan"] = _lastScanEpoch;
+    obj["service_uuid"] = ASE_SERVICE_UUID;
+    obj.createNestedArray("peers");
+    obj.createNestedArray("bssids");
+}
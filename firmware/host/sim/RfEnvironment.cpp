@@ -0,0 +1,140 @@
+#include "RfEnvironment.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+double dbmToMw(double dbm) { return std::pow(10.0, dbm / 10.0); }
+double mwToDbm(double mw) { return 10.0 * std::log10(mw); }
+
+} // namespace
+
+RfEnvironment::RfEnvironment() {}
+
+void RfEnvironment::setNoiseFloor(float dbm, float jitterDb) {
+    _noiseFloorDbm = dbm;
+    _jitterDb = jitterDb;
+}
+
+void RfEnvironment::addCarrier(const RfCarrier& carrier) { _carriers.push_back(carrier); }
+void RfEnvironment::addBurst(const RfBurst& burst) { _bursts.push_back(burst); }
+void RfEnvironment::setSeed(uint32_t seed) { _rng = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)seed << 1 | 1); }
+
+void RfEnvironment::clear() {
+    _carriers.clear();
+    _bursts.clear();
+    _noiseFloorDbm = -105.0f;
+    _jitterDb = 1.5f;
+}
+
+bool RfEnvironment::loadScript(const std::string& path, std::string* error) {
+    std::ifstream in(path);
+    if (!in) {
+        if (error) *error = "cannot open " + path;
+        return false;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return parseScript(ss.str(), error);
+}
+
+bool RfEnvironment::parseScript(const std::string& text, std::string* error) {
+    std::istringstream lines(text);
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(lines, line)) {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.resize(hash);
+        std::istringstream tok(line);
+        std::string directive;
+        if (!(tok >> directive)) continue;
+
+        bool ok = false;
+        if (directive == "noise") {
+            float floorDbm, jitter;
+            ok = static_cast<bool>(tok >> floorDbm >> jitter);
+            if (ok) setNoiseFloor(floorDbm, jitter);
+        } else if (directive == "carrier") {
+            RfCarrier c;
+            ok = static_cast<bool>(tok >> c.freqMhz >> c.powerDbm >> c.widthKhz);
+            if (ok) addCarrier(c);
+        } else if (directive == "burst") {
+            RfBurst b;
+            ok = static_cast<bool>(tok >> b.freqMhz >> b.powerDbm >> b.widthKhz >> b.startMs >> b.onMs >> b.periodMs);
+            if (ok) addBurst(b);
+        } else if (directive == "seed") {
+            uint32_t seed;
+            ok = static_cast<bool>(tok >> seed);
+            if (ok) setSeed(seed);
+        }
+
+        if (!ok) {
+            if (error) *error = "line " + std::to_string(lineNo) + ": cannot parse '" + line + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+double RfEnvironment::gaussian() {
+    // xorshift64* + Box-Muller; deterministic for a given seed.
+    auto next = [this]() {
+        _rng ^= _rng >> 12;
+        _rng ^= _rng << 25;
+        _rng ^= _rng >> 27;
+        return (double)((_rng * 0x2545F4914F6CDD1DULL) >> 11) / 9007199254740992.0;
+    };
+    double u1 = next();
+    double u2 = next();
+    if (u1 < 1e-12) u1 = 1e-12;
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+double RfEnvironment::overlapFraction(float centerMhz, float widthKhz, float freqMhz, float rxBwKhz) {
+    double sigLo = centerMhz * 1000.0 - widthKhz / 2.0;
+    double sigHi = centerMhz * 1000.0 + widthKhz / 2.0;
+    double rxLo = freqMhz * 1000.0 - rxBwKhz / 2.0;
+    double rxHi = freqMhz * 1000.0 + rxBwKhz / 2.0;
+    double overlap = std::fmin(sigHi, rxHi) - std::fmax(sigLo, rxLo);
+    if (overlap <= 0.0) return 0.0;
+    return overlap / (sigHi - sigLo > 0.0 ? sigHi - sigLo : 1.0);
+}
+
+float RfEnvironment::staticDbm(float freqMhz, float rxBwKhz) const {
+    double mw = dbmToMw(_noiseFloorDbm);
+    for (const auto& c : _carriers) {
+        double f = overlapFraction(c.freqMhz, c.widthKhz, freqMhz, rxBwKhz);
+        if (f > 0.0) mw += dbmToMw(c.powerDbm) * f;
+    }
+    return (float)mwToDbm(mw);
+}
+
+float RfEnvironment::expectedDbm(float freqMhz, float rxBwKhz, uint64_t nowUs) const {
+    double mw = dbmToMw(staticDbm(freqMhz, rxBwKhz));
+    uint64_t nowMs = nowUs / 1000;
+    for (const auto& b : _bursts) {
+        if (nowMs < b.startMs) continue;
+        uint64_t t = nowMs - b.startMs;
+        if (b.periodMs > 0) t %= b.periodMs;
+        else if (t >= b.onMs) continue;
+        if (t >= b.onMs) continue;
+        double f = overlapFraction(b.freqMhz, b.widthKhz, freqMhz, rxBwKhz);
+        if (f > 0.0) mw += dbmToMw(b.powerDbm) * f;
+    }
+    return (float)mwToDbm(mw);
+}
+
+float RfEnvironment::sampleDbm(float freqMhz, float rxBwKhz, uint64_t nowUs) {
+    return expectedDbm(freqMhz, rxBwKhz, nowUs) + (float)(gaussian() * _jitterDb);
+}
+
+std::string RfEnvironment::describe() const {
+    char buf[128];
+    std::snprintf(buf, sizeof(buf), "floor %.1f dBm (+/-%.1f dB), %zu carriers, %zu bursts",
+                  _noiseFloorDbm, _jitterDb, _carriers.size(), _bursts.size());
+    return buf;
+}
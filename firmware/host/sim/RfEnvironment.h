@@ -0,0 +1,68 @@
+#ifndef SIM_RF_ENVIRONMENT_H
+#define SIM_RF_ENVIRONMENT_H
+
+// Scripted RF scene for the simulated CC1101.
+//
+// Script format (one directive per line, '#' starts a comment):
+//   noise   <floor_dbm> <jitter_db>
+//   carrier <freq_mhz> <power_dbm> <width_khz>
+//   burst   <freq_mhz> <power_dbm> <width_khz> <start_ms> <on_ms> <period_ms>
+//   seed    <u32>
+// Burst timing is on the virtual clock; period 0 means a single burst.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct RfCarrier {
+    float freqMhz;
+    float powerDbm;
+    float widthKhz;
+};
+
+struct RfBurst {
+    float freqMhz;
+    float powerDbm;
+    float widthKhz;
+    uint32_t startMs;
+    uint32_t onMs;
+    uint32_t periodMs;
+};
+
+class RfEnvironment {
+public:
+    RfEnvironment();
+
+    void setNoiseFloor(float dbm, float jitterDb);
+    void addCarrier(const RfCarrier& carrier);
+    void addBurst(const RfBurst& burst);
+    void setSeed(uint32_t seed);
+    void clear();
+
+    bool loadScript(const std::string& path, std::string* error);
+    bool parseScript(const std::string& text, std::string* error);
+
+    // Noisy sample as the RSSI detector would see it through an rxBwKhz filter.
+    float sampleDbm(float freqMhz, float rxBwKhz, uint64_t nowUs);
+    // Deterministic power at time nowUs (no detector jitter).
+    float expectedDbm(float freqMhz, float rxBwKhz, uint64_t nowUs) const;
+    // Noise floor plus continuous carriers only (ground truth for sweeps).
+    float staticDbm(float freqMhz, float rxBwKhz) const;
+
+    float noiseFloorDbm() const { return _noiseFloorDbm; }
+    const std::vector<RfCarrier>& carriers() const { return _carriers; }
+    const std::vector<RfBurst>& bursts() const { return _bursts; }
+    std::string describe() const;
+
+private:
+    float _noiseFloorDbm = -105.0f;
+    float _jitterDb = 1.5f;
+    uint64_t _rng = 0x9E3779B97F4A7C15ULL;
+    std::vector<RfCarrier> _carriers;
+    std::vector<RfBurst> _bursts;
+
+    double gaussian();
+    static double overlapFraction(float centerMhz, float widthKhz, float freqMhz, float rxBwKhz);
+};
+
+#endif
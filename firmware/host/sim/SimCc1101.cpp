@@ -0,0 +1,310 @@
+#include "SimCc1101.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "RadioLib.h"
+
+namespace {
+
+constexpr float kXoscMhz = 26.0f;
+
+// Status byte STATE field (bits 6:4)
+constexpr uint8_t kStatusIdle = 0x0;
+constexpr uint8_t kStatusRx = 0x1;
+constexpr uint8_t kStatusCalibrate = 0x4;
+constexpr uint8_t kStatusSettling = 0x5;
+
+struct Band {
+    float lo;
+    float hi;
+};
+constexpr Band kBands[] = {{300.0f, 348.0f}, {387.0f, 464.0f}, {779.0f, 928.0f}};
+
+float bandPosition(float mhz) {
+    for (const Band& b : kBands) {
+        if (mhz >= b.lo && mhz <= b.hi) return (mhz - b.lo) / (b.hi - b.lo);
+    }
+    return 0.0f;
+}
+
+} // namespace
+
+SimCc1101::SimCc1101(RfEnvironment& env) : _env(env) { reset(); }
+
+void SimCc1101::reset() {
+    _regs.fill(0);
+    // Datasheet reset values for the registers the firmware touches.
+    _regs[RADIOLIB_CC1101_REG_IOCFG2] = 0x29;
+    _regs[RADIOLIB_CC1101_REG_IOCFG0] = 0x3F;
+    _regs[RADIOLIB_CC1101_REG_FIFOTHR] = 0x07;
+    _regs[RADIOLIB_CC1101_REG_PKTLEN] = 0xFF;
+    _regs[RADIOLIB_CC1101_REG_PKTCTRL1] = 0x04;
+    _regs[RADIOLIB_CC1101_REG_PKTCTRL0] = 0x45;
+    _regs[RADIOLIB_CC1101_REG_FSCTRL1] = 0x0F;
+    _regs[RADIOLIB_CC1101_REG_FREQ2] = 0x1E;
+    _regs[RADIOLIB_CC1101_REG_FREQ1] = 0xC4;
+    _regs[RADIOLIB_CC1101_REG_FREQ0] = 0xEC;
+    _regs[RADIOLIB_CC1101_REG_MDMCFG4] = 0x8C;
+    _regs[RADIOLIB_CC1101_REG_MDMCFG3] = 0x22;
+    _regs[RADIOLIB_CC1101_REG_MDMCFG2] = 0x02;
+    _regs[RADIOLIB_CC1101_REG_MDMCFG1] = 0x22;
+    _regs[RADIOLIB_CC1101_REG_MDMCFG0] = 0xF8;
+    _regs[RADIOLIB_CC1101_REG_DEVIATN] = 0x47;
+    _regs[RADIOLIB_CC1101_REG_MCSM2] = 0x07;
+    _regs[RADIOLIB_CC1101_REG_MCSM1] = 0x30;
+    _regs[RADIOLIB_CC1101_REG_MCSM0] = 0x04;
+    _regs[RADIOLIB_CC1101_REG_FSCAL3] = 0xA9;
+    _regs[RADIOLIB_CC1101_REG_FSCAL2] = 0x0A;
+    _regs[RADIOLIB_CC1101_REG_FSCAL1] = 0x20;
+    _regs[RADIOLIB_CC1101_REG_FSCAL0] = 0x0D;
+    _regs[RADIOLIB_CC1101_REG_PARTNUM] = 0x00;
+    _regs[RADIOLIB_CC1101_REG_VERSION] = RADIOLIB_CC1101_VERSION_CURRENT;
+    _patable.fill(0);
+    _patable[0] = 0xC6;
+    _patableIndex = 0;
+
+    _state = State::Idle;
+    _enterRxWhenReady = false;
+    _locked = false;
+    _rxFreqMhz = 0.0f;
+    _rssiReg = 0x80;
+    _rssiEstimate = 0;
+}
+
+void SimCc1101::resetStats() {
+    _stats = SimCc1101Stats();
+    _hasLastHop = false;
+    _hopHead = 0;
+    _hopCount = 0;
+}
+
+float SimCc1101::frequencyMhz() const {
+    uint32_t word = ((uint32_t)_regs[RADIOLIB_CC1101_REG_FREQ2] << 16) |
+                    ((uint32_t)_regs[RADIOLIB_CC1101_REG_FREQ1] << 8) |
+                    _regs[RADIOLIB_CC1101_REG_FREQ0];
+    return (float)((double)word * kXoscMhz / 65536.0);
+}
+
+float SimCc1101::rxBandwidthKhz() const {
+    uint8_t mdmcfg4 = _regs[RADIOLIB_CC1101_REG_MDMCFG4];
+    uint8_t e = (mdmcfg4 >> 6) & 0x03;
+    uint8_t m = (mdmcfg4 >> 4) & 0x03;
+    return (kXoscMhz * 1000.0f) / (8.0f * (4 + m) * (float)(1u << e));
+}
+
+uint32_t SimCc1101::rssiResponseUs() const {
+    // Approximates the datasheet RSSI response-time curve: the channel filter
+    // and the RSSI averaging window both scale with 1/bandwidth.
+    return 30 + (uint32_t)(18000.0f / rxBandwidthKhz());
+}
+
+uint32_t SimCc1101::rssiWindowUs() const {
+    return (uint32_t)(18000.0f / rxBandwidthKhz());
+}
+
+uint8_t SimCc1101::idealFscal2() const {
+    return bandPosition(frequencyMhz()) >= 0.5f ? 0x2A : 0x0A;
+}
+
+uint8_t SimCc1101::idealFscal1() const {
+    return (uint8_t)std::lround(bandPosition(frequencyMhz()) * 63.0f);
+}
+
+void SimCc1101::select() {
+    _inHeader = true;
+    _stats.spiTransactions++;
+}
+
+void SimCc1101::deselect() { _inHeader = true; }
+
+uint8_t SimCc1101::transfer(uint8_t mosi) {
+    _stats.spiBytes++;
+    advanceState();
+
+    if (_inHeader) {
+        uint8_t status = statusByte();
+        _read = (mosi & RADIOLIB_CC1101_CMD_READ) != 0;
+        _burst = (mosi & RADIOLIB_CC1101_CMD_BURST) != 0;
+        _addr = mosi & 0x3F;
+        _inHeader = false;
+
+        if (_addr >= RADIOLIB_CC1101_CMD_RESET && _addr <= RADIOLIB_CC1101_CMD_NOP && !_burst) {
+            strobe(_addr);
+            _inHeader = true;
+        }
+        if (_addr == RADIOLIB_CC1101_REG_PATABLE) _patableIndex = 0;
+        return status;
+    }
+
+    uint8_t out = 0;
+    if (_addr == RADIOLIB_CC1101_REG_PATABLE) {
+        if (_read) out = _patable[_patableIndex];
+        else _patable[_patableIndex] = mosi;
+        _patableIndex = (_patableIndex + 1) & 0x07;
+        return out;
+    }
+    if (_addr == RADIOLIB_CC1101_REG_FIFO) {
+        return 0; // no packet engine in the model
+    }
+
+    if (_read) out = readRegister(_addr);
+    else writeRegister(_addr, mosi);
+    if (_burst && _addr < RADIOLIB_CC1101_REG_PATABLE - 1) _addr++;
+    return out;
+}
+
+void SimCc1101::advanceState() {
+    if ((_state == State::Calibrating || _state == State::Settling) && host::Clock::nowUs() >= _readyAtUs) {
+        if (_enterRxWhenReady) {
+            _state = State::Rx;
+            _rssiValidAtUs = _readyAtUs + rssiResponseUs();
+            _rssiEstimate = 0;
+        } else {
+            _state = State::Idle;
+        }
+    }
+}
+
+uint8_t SimCc1101::statusByte() {
+    uint8_t state = kStatusIdle;
+    switch (_state) {
+        case State::Idle: state = kStatusIdle; break;
+        case State::Calibrating: state = kStatusCalibrate; break;
+        case State::Settling: state = kStatusSettling; break;
+        case State::Rx: state = kStatusRx; break;
+    }
+    return (uint8_t)(state << 4);
+}
+
+uint8_t SimCc1101::marcState() {
+    switch (_state) {
+        case State::Idle: return RADIOLIB_CC1101_MARC_STATE_IDLE;
+        case State::Calibrating: return RADIOLIB_CC1101_MARC_STATE_MANCAL;
+        case State::Settling: return RADIOLIB_CC1101_MARC_STATE_FS_LOCK;
+        case State::Rx: return RADIOLIB_CC1101_MARC_STATE_RX;
+    }
+    return RADIOLIB_CC1101_MARC_STATE_IDLE;
+}
+
+void SimCc1101::beginRx(uint64_t readyAtUs, bool locked) {
+    _stats.rxEntries++;
+    _readyAtUs = readyAtUs;
+    _enterRxWhenReady = true;
+    _locked = locked;
+    _rxFreqMhz = frequencyMhz();
+}
+
+void SimCc1101::strobe(uint8_t cmd) {
+    uint64_t now = host::Clock::nowUs();
+    switch (cmd) {
+        case RADIOLIB_CC1101_CMD_RESET:
+            reset();
+            break;
+        case RADIOLIB_CC1101_CMD_IDLE:
+            _state = State::Idle;
+            _enterRxWhenReady = false;
+            break;
+        case RADIOLIB_CC1101_CMD_CAL:
+            if (_state != State::Idle) break;
+            _stats.calibrations++;
+            _regs[RADIOLIB_CC1101_REG_FSCAL2] = idealFscal2();
+            _regs[RADIOLIB_CC1101_REG_FSCAL1] = idealFscal1();
+            _state = State::Calibrating;
+            _readyAtUs = now + kManualCalUs;
+            _enterRxWhenReady = false;
+            break;
+        case RADIOLIB_CC1101_CMD_RX: {
+            if (_state == State::Rx || (_state != State::Idle && _enterRxWhenReady)) break;
+            bool autoCal = (_regs[RADIOLIB_CC1101_REG_MCSM0] & 0x30) == RADIOLIB_CC1101_FS_AUTOCAL_IDLE_TO_RXTX;
+            if (_state == State::Calibrating) {
+                // SRX during a manual calibration is honoured once it finishes.
+                beginRx(_readyAtUs + kSettleUs, true);
+                _state = State::Settling;
+            } else if (autoCal) {
+                _stats.calibrations++;
+                _regs[RADIOLIB_CC1101_REG_FSCAL2] = idealFscal2();
+                _regs[RADIOLIB_CC1101_REG_FSCAL1] = idealFscal1();
+                beginRx(now + kAutoCalUs, true);
+                _state = State::Calibrating;
+            } else {
+                int fscal1 = _regs[RADIOLIB_CC1101_REG_FSCAL1] & 0x3F;
+                bool locked = (_regs[RADIOLIB_CC1101_REG_FSCAL2] & 0x20) == (idealFscal2() & 0x20) &&
+                              std::abs(fscal1 - (int)idealFscal1()) <= 1;
+                beginRx(now + kSettleUs, locked);
+                _state = State::Settling;
+            }
+            break;
+        }
+        case RADIOLIB_CC1101_CMD_TX:
+        case RADIOLIB_CC1101_CMD_FSTXON:
+            _stats.txAttempts++; // refused: RX only
+            break;
+        default:
+            break; // SFRX, SFTX, SNOP, SWOR, SPWD, SXOFF: no state effect in the model
+    }
+}
+
+void SimCc1101::recordHop() {
+    uint64_t now = host::Clock::nowUs();
+    _stats.hops++;
+    if (_hasLastHop) {
+        uint64_t period = now - _lastHopUs;
+        _hopPeriods[_hopHead] = period > UINT32_MAX ? UINT32_MAX : (uint32_t)period;
+        _hopHead = (_hopHead + 1) % kHopRing;
+        if (_hopCount < kHopRing) _hopCount++;
+    }
+    _lastHopUs = now;
+    _hasLastHop = true;
+}
+
+void SimCc1101::writeRegister(uint8_t addr, uint8_t value) {
+    if (addr >= RADIOLIB_CC1101_REG_PARTNUM) return; // status registers are read-only
+    bool changed = _regs[addr] != value;
+    _regs[addr] = value;
+    if (addr == RADIOLIB_CC1101_REG_FREQ0 && (changed || _state == State::Idle)) {
+        recordHop();
+    }
+}
+
+uint8_t SimCc1101::readRegister(uint8_t addr) {
+    if (addr == RADIOLIB_CC1101_REG_MARCSTATE) return marcState();
+    if (addr == RADIOLIB_CC1101_REG_RSSI) {
+        _stats.rssiReads++;
+        uint64_t now = host::Clock::nowUs();
+        if (_state != State::Rx || now < _rssiValidAtUs) {
+            _stats.staleRssiReads++;
+            return _rssiReg;
+        }
+        // The register holds one estimate per averaging window; reading faster
+        // returns the same value again.
+        uint64_t estimate = 1 + (now - _rssiValidAtUs) / rssiWindowUs();
+        if (estimate == _rssiEstimate) {
+            _stats.repeatedRssiReads++;
+            return _rssiReg;
+        }
+        _rssiEstimate = estimate;
+        float dbm;
+        if (_locked) {
+            dbm = _env.sampleDbm(_rxFreqMhz, rxBandwidthKhz(), now);
+        } else {
+            // An unlocked synthesiser lands somewhere else: only noise is seen.
+            _stats.unlockedRssiReads++;
+            dbm = _env.noiseFloorDbm() + 1.0f;
+        }
+        int raw = (int)std::lround((dbm + RADIOLIB_CC1101_DEFAULT_RSSI_OFFSET) * 2.0f);
+        raw = std::max(-128, std::min(127, raw));
+        _rssiReg = (uint8_t)(int8_t)raw;
+        return _rssiReg;
+    }
+    return _regs[addr];
+}
+
+size_t SimCc1101::hopSampleCount() const { return _hopCount; }
+
+size_t SimCc1101::copyHopPeriods(uint32_t* out, size_t maxCount) const {
+    size_t n = std::min(maxCount, _hopCount);
+    size_t start = (_hopHead + kHopRing - _hopCount) % kHopRing;
+    for (size_t i = 0; i < n; ++i) out[i] = _hopPeriods[(start + i) % kHopRing];
+    return n;
+}
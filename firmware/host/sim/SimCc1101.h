@@ -0,0 +1,113 @@
+#ifndef SIM_CC1101_H
+#define SIM_CC1101_H
+
+// Register-level CC1101 model that sits behind the host SPIClass.
+//
+// Decodes the CC1101 SPI header byte (R/W, burst, address), keeps the
+// configuration/status register file and PATABLE, and runs a small state
+// machine on the virtual clock:
+//   - SRX from IDLE with MCSM0.FS_AUTOCAL=01 calibrates (~799 us) first.
+//   - SRX without autocal only waits for PLL settle (~90 us); the synthesiser
+//     locks only if FSCAL2/FSCAL1 are close to the values a calibration at
+//     the programmed FREQ word would produce.
+//   - SCAL from IDLE takes ~735 us and writes the ideal FSCAL values.
+//   - RSSI becomes valid a bandwidth-dependent time after RX is reached;
+//     earlier reads return the previous register contents.
+// Timing figures follow the CC1101 datasheet (26 MHz XOSC).
+//
+// STX/SFSTXON are refused and counted: this node is RX only.
+
+#include <array>
+#include <cstdint>
+
+#include "HostRuntime.h"
+#include "RfEnvironment.h"
+
+struct SimCc1101Stats {
+    uint64_t spiBytes = 0;
+    uint64_t spiTransactions = 0;
+    uint64_t hops = 0;
+    uint64_t calibrations = 0;
+    uint64_t rxEntries = 0;
+    uint64_t rssiReads = 0;
+    uint64_t staleRssiReads = 0;
+    uint64_t repeatedRssiReads = 0;  // read again before the next RSSI estimate was ready
+    uint64_t unlockedRssiReads = 0;
+    uint64_t txAttempts = 0;
+};
+
+class SimCc1101 : public host::SpiDevice {
+public:
+    static constexpr uint32_t kAutoCalUs = 809;   // calibrate + settle on IDLE->RX
+    static constexpr uint32_t kManualCalUs = 735; // SCAL strobe
+    static constexpr uint32_t kSettleUs = 90;     // PLL settle when FSCAL is reused
+    static constexpr size_t kHopRing = 4096;
+
+    explicit SimCc1101(RfEnvironment& env);
+
+    // host::SpiDevice
+    void select() override;
+    void deselect() override;
+    uint8_t transfer(uint8_t mosi) override;
+
+    void reset();
+
+    float frequencyMhz() const;      // programmed FREQ word
+    float rxFrequencyMhz() const { return _rxFreqMhz; } // synthesiser frequency in RX
+    float rxBandwidthKhz() const;
+    uint32_t rssiResponseUs() const;
+    uint32_t rssiWindowUs() const;    // RX time between fresh RSSI estimates
+    bool isLocked() const { return _locked; }
+    uint8_t regValue(uint8_t addr) const { return _regs[addr & 0x3F]; }
+
+    // Ideal FSCAL2/FSCAL1 a calibration would produce at the programmed FREQ word.
+    uint8_t idealFscal2() const;
+    uint8_t idealFscal1() const;
+
+    const SimCc1101Stats& stats() const { return _stats; }
+    void resetStats();
+
+    // Hop periods (us between consecutive FREQ0 writes), oldest first.
+    size_t hopSampleCount() const;
+    size_t copyHopPeriods(uint32_t* out, size_t maxCount) const;
+
+private:
+    enum class State : uint8_t { Idle, Calibrating, Settling, Rx };
+
+    RfEnvironment& _env;
+    std::array<uint8_t, 0x40> _regs{};
+    std::array<uint8_t, 8> _patable{};
+
+    bool _inHeader = true;
+    bool _read = false;
+    bool _burst = false;
+    uint8_t _addr = 0;
+    uint8_t _patableIndex = 0;
+
+    State _state = State::Idle;
+    uint64_t _readyAtUs = 0;     // end of calibration / settling
+    bool _enterRxWhenReady = false;
+    bool _locked = false;
+    float _rxFreqMhz = 0.0f;
+    uint64_t _rssiValidAtUs = 0;
+    uint8_t _rssiReg = 0x80;
+    uint64_t _rssiEstimate = 0;  // index of the RSSI estimate held in _rssiReg (0 = none yet)
+
+    SimCc1101Stats _stats;
+    uint64_t _lastHopUs = 0;
+    bool _hasLastHop = false;
+    std::array<uint32_t, kHopRing> _hopPeriods{};
+    size_t _hopHead = 0;
+    size_t _hopCount = 0;
+
+    void advanceState();
+    void strobe(uint8_t cmd);
+    void writeRegister(uint8_t addr, uint8_t value);
+    uint8_t readRegister(uint8_t addr);
+    uint8_t statusByte();
+    uint8_t marcState();
+    void beginRx(uint64_t readyAtUs, bool locked);
+    void recordHop();
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include "SimNetwork.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+// Matches the AsyncTCP stand-in's segment pacing (HostNet.cpp).
+constexpr size_t kSegmentBytes = 1436;
+constexpr uint32_t kSegmentUs = 250;
+
+const std::vector<uint32_t> kNoLatencies;
+
+// A status section is at most 1 KB per chunk (StatusBuilder::streamFragment)
+constexpr size_t kChunkBytes = 1024;
+
+std::string chunked(const std::string& body) {
+    std::string out;
+    char size[12];
+    for (size_t at = 0; at < body.size(); at += kChunkBytes) {
+        size_t n = std::min(kChunkBytes, body.size() - at);
+        std::snprintf(size, sizeof(size), "%zx\r\n", n);
+        out += size;
+        out.append(body, at, n);
+        out += "\r\n";
+    }
+    return out + "0\r\n\r\n";
+}
+
+uint32_t fnv1a(const std::string& text) {
+    uint32_t h = 2166136261u;
+    for (unsigned char c : text) {
+        h ^= c;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+} // namespace
+
+SimNetwork::SimNetwork() { setSeed(1); }
+
+void SimNetwork::udpSend(uint32_t ip, uint16_t port, const std::string& bytes) {
+    if (_udpHandler) _udpHandler(ip, port, bytes);
+}
+
+void SimNetwork::setSeed(uint32_t seed) { _rng = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)seed << 1 | 1); }
+
+double SimNetwork::uniform() {
+    // xorshift64*, deterministic for a given seed.
+    _rng ^= _rng >> 12;
+    _rng ^= _rng << 25;
+    _rng ^= _rng >> 27;
+    return (double)((_rng * 0x2545F4914F6CDD1DULL) >> 11) / 9007199254740992.0;
+}
+
+void SimNetwork::addHost(uint32_t ip, const SimHost& host) { _hosts[ip] = host; }
+
+SimHost* SimNetwork::host(uint32_t ip) {
+    auto it = _hosts.find(ip);
+    return it == _hosts.end() ? nullptr : &it->second;
+}
+
+host::TcpConnectPlan SimNetwork::connect(uint32_t ip, uint16_t port) {
+    _connectAttempts++;
+    host::TcpConnectPlan plan;
+    auto it = _hosts.find(ip);
+    if (it == _hosts.end()) return plan;  // SILENT
+    plan.latencyUs = it->second.connectUs;
+    bool open = port == 80 && it->second.kind != SimHost::CLOSED;
+    plan.outcome = open ? host::TcpConnectPlan::ACCEPT : host::TcpConnectPlan::REFUSE;
+    return plan;
+}
+
+host::TcpReply SimNetwork::request(uint32_t ip, uint16_t, const std::string& request) {
+    host::TcpReply reply;
+    auto it = _hosts.find(ip);
+    if (it == _hosts.end() || it->second.kind != SimHost::NODE) return reply;
+    const SimHost& h = it->second;
+    _requests++;
+
+    std::string body;
+    std::string extraHeaders;
+    int code = 404;
+    bool report = false;
+    bool status = false;
+    if (request.compare(0, 16, "GET /api/status ") == 0) {
+        body = statusBody(h);
+        code = 200;
+        status = true;
+    } else if (request.compare(0, 21, "GET /api/status/peer ") == 0 && h.peerStatus) {
+        std::string etag;
+        const std::string& doc = peerStatusBody(ip, h, etag);
+        extraHeaders = "ETag: " + etag + "\r\n";
+        if (request.find("\r\nIf-None-Match: " + etag + "\r\n") != std::string::npos) {
+            code = 304;
+            _notModified++;
+        } else {
+            body = doc;
+            code = 200;
+        }
+        status = true;
+    } else if (request.compare(0, 24, "GET /api/report?local=1 ") == 0) {
+        body = reportBody(h);
+        code = 200;
+        report = true;
+    }
+
+    char header[160];
+    const char* reason = code == 200 ? "OK" : (code == 304 ? "Not Modified" : "Not Found");
+    bool stream = h.chunked && (report || (status && code == 200 && request.compare(0, 16, "GET /api/status ") == 0));
+    if (code == 304) {
+        std::snprintf(header, sizeof(header), "HTTP/1.1 304 %s\r\n%sConnection: close\r\n\r\n", reason,
+                      extraHeaders.c_str());
+    } else if (stream) {
+        std::snprintf(header, sizeof(header),
+                      "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nTransfer-Encoding: chunked\r\n%sConnection: close\r\n\r\n",
+                      code, reason, extraHeaders.c_str());
+    } else {
+        std::snprintf(header, sizeof(header),
+                      "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\n%sConnection: close\r\n\r\n",
+                      code, reason, body.size(), extraHeaders.c_str());
+    }
+    reply.respond = true;
+    reply.latencyUs = h.replyUs + (uint32_t)(uniform() * h.jitterUs);
+    reply.bytes = header + (stream ? chunked(body) : body);
+    if (status) {
+        _statusRequests++;
+        _statusBytes += reply.bytes.size();
+    }
+
+    if (code == 200 || code == 304) {
+        size_t segments = (reply.bytes.size() + kSegmentBytes - 1) / kSegmentBytes;
+        uint32_t lastByteUs = reply.latencyUs + (uint32_t)(segments - 1) * kSegmentUs;
+        (report ? _reportLatencies : _latencies)[ip].push_back(h.connectUs + lastByteUs);
+    }
+    return reply;
+}
+
+const std::vector<uint32_t>& SimNetwork::replyLatencies(uint32_t ip) const {
+    auto it = _latencies.find(ip);
+    return it == _latencies.end() ? kNoLatencies : it->second;
+}
+
+const std::vector<uint32_t>& SimNetwork::reportLatencies(uint32_t ip) const {
+    auto it = _reportLatencies.find(ip);
+    return it == _reportLatencies.end() ? kNoLatencies : it->second;
+}
+
+std::string SimNetwork::statusBody(const SimHost& h) const {
+    std::string body = "{\"hostname\":\"" + h.hostname + "\",\"clusterName\":\"" + h.cluster + "\",\"status\":\"" +
+                       h.status + "\",\"task\":\"" + h.task + "\",\"description\":\"\",";
+    if (!h.desiredTask.empty()) {
+        body += "\"desired_task\":{\"id\":\"" + h.desiredTask + "\",\"params\":{}},";
+    }
+    body += "\"desired_version\":" + std::to_string(h.desiredVersion) + ",";
+    if (h.coordinated) {
+        body += "\"desired_origin\":" + std::to_string(h.desiredOrigin) + ",\"start_at\":" + std::to_string(h.startAt) + ",";
+    }
+    body += std::string("\"start_requested\":") + (h.startAt != 0 ? "true" : "false") + ",\"logs\":[";
+    // The firmware embeds the 50 head log lines; they dominate the document size.
+    char line[112];
+    for (int i = 0; i < 50; ++i) {
+        std::snprintf(line, sizeof(line), "%s\"[%06d] [INFO] [Peers] Probing 192.168.1.%d for status... (simulated log line)\"",
+                      i ? "," : "", i * 2000, 100 + i % 50);
+        body += line;
+    }
+    body += "]}";
+    return body;
+}
+
+const std::string& SimNetwork::peerStatusBody(uint32_t ip, const SimHost& h, std::string& etag) {
+    std::string key = h.hostname + "\n" + h.cluster + "\n" + h.status + "\n" + h.task + "\n" + h.desiredTask + "\n" +
+                      std::to_string(h.desiredVersion) + "/" + std::to_string(h.desiredOrigin) + "@" +
+                      std::to_string(h.startAt) + (h.coordinated ? "+" : "-");
+    PeerDoc& doc = _peerDocs[ip];
+    if (doc.key != key || doc.body.empty()) {
+        doc.key = key;
+        doc.version++;
+        doc.body = "{\"hostname\":\"" + h.hostname + "\",\"description\":\"\",\"clusterName\":\"" + h.cluster +
+                   "\",\"status\":\"" + h.status + "\",\"task\":\"" + h.task + "\",";
+        if (!h.desiredTask.empty()) doc.body += "\"desired_task\":{\"id\":\"" + h.desiredTask + "\",\"params\":{}},";
+        doc.body += "\"desired_version\":" + std::to_string(h.desiredVersion) + ",";
+        if (h.coordinated) {
+            doc.body += "\"desired_origin\":" + std::to_string(h.desiredOrigin) + ",\"start_at\":" + std::to_string(h.startAt) + ",";
+        }
+        doc.body += std::string("\"start_requested\":") + (h.startAt != 0 ? "true" : "false") +
+                    ",\"version\":" + std::to_string(doc.version) + "}";
+        char tag[12];
+        std::snprintf(tag, sizeof(tag), "\"%08x\"", fnv1a(doc.body));
+        doc.etag = tag;
+    }
+    etag = doc.etag;
+    return doc.body;
+}
+
+std::string SimNetwork::reportBody(const SimHost& h) const {
+    // Shaped like a spectrum/detect node: a handful of events per sweep.
+    std::string body = "{\"task\":{\"id\":\"spectrum/detect\"},\"nodes\":{\"" + h.hostname + "\":{\"task\":\"" + h.task +
+                       "\",\"report\":{\"sweep_seq\":42,\"events\":[";
+    char event[96];
+    for (int i = 0; i < 6; ++i) {
+        std::snprintf(event, sizeof(event), "%s{\"f_mhz\":%.3f,\"peak_dbm\":%d,\"snr_db\":%d,\"bins\":%d}", i ? "," : "",
+                      903.1 + i * 3.7, -60 - i * 4, 24 - i * 2, 1 + i % 3);
+        body += event;
+    }
+    body += "]}}}}";
+    return body;
+}
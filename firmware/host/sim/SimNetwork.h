@@ -0,0 +1,100 @@
+#ifndef SIM_NETWORK_H
+#define SIM_NETWORK_H
+
+// Simulated LAN behind the AsyncTCP stand-in.
+//
+// Every address not added here is absent: a connect to it never completes,
+// as when ARP goes unanswered. Nodes accept on port 80 and answer
+// GET /api/status with a status document shaped like the firmware's
+// (hostname, clusterName, status, task, 50 log lines), GET /api/status/peer
+// with the minimal peer document (ETag, 304 on a matching If-None-Match)
+// and GET /api/report?local=1 with a one-node report. Like the firmware,
+// a node streams /api/status and /api/report?local=1 with chunked transfer
+// encoding (SimHost::chunked). Latencies are drawn
+// per request on the virtual clock; the model records what it drew so a
+// benchmark can compare it with what the firmware measured. Datagrams the
+// firmware sends go to the handler set with setUdpHandler(), which plays the
+// peers' side and answers with host::deliverUdp().
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "HostRuntime.h"
+
+struct SimHost {
+    enum Kind {
+        NODE,     // All-Seeing Eye node
+        CLOSED,   // host up, port 80 closed (RST)
+        STALLED   // accepts, never answers
+    } kind = NODE;
+    std::string hostname;
+    std::string cluster = "Default";
+    std::string task = "System Idle";
+    std::string status = "Ready";
+    std::string desiredTask;        // "desired_task.id", empty for none
+    uint32_t desiredVersion = 0;
+    uint32_t desiredOrigin = 0;
+    uint32_t startAt = 0;           // consensus epoch second, 0: not started
+    bool coordinated = true;        // publishes desired_origin (older firmware: no ClusterCoordinator)
+    bool peerStatus = true;         // serves /api/status/peer (older firmware: 404)
+    bool chunked = true;            // streams /api/status and report bodies (older firmware: Content-Length)
+    uint32_t connectUs = 3000;
+    uint32_t replyUs = 20000;   // request to first byte
+    uint32_t jitterUs = 0;      // uniform, added to replyUs
+};
+
+class SimNetwork : public host::NetworkModel {
+public:
+    SimNetwork();
+
+    void setSeed(uint32_t seed);
+    void addHost(uint32_t ip, const SimHost& host);
+    SimHost* host(uint32_t ip);
+
+    host::TcpConnectPlan connect(uint32_t ip, uint16_t port) override;
+    host::TcpReply request(uint32_t ip, uint16_t port, const std::string& request) override;
+    void udpSend(uint32_t ip, uint16_t port, const std::string& bytes) override;
+
+    typedef std::function<void(uint32_t ip, uint16_t port, const std::string& bytes)> UdpHandler;
+    void setUdpHandler(UdpHandler handler) { _udpHandler = handler; }
+
+    // Connect-to-last-byte latency of each status reply (200 or 304), by host.
+    const std::vector<uint32_t>& replyLatencies(uint32_t ip) const;
+    // The same for /api/report?local=1 replies.
+    const std::vector<uint32_t>& reportLatencies(uint32_t ip) const;
+    uint64_t requests() const { return _requests; }
+    uint64_t statusRequests() const { return _statusRequests; }  // /api/status and /api/status/peer
+    uint64_t statusBytes() const { return _statusBytes; }        // their replies, headers included
+    uint64_t notModified() const { return _notModified; }
+    uint64_t connectAttempts() const { return _connectAttempts; }
+
+private:
+    std::string statusBody(const SimHost& host) const;
+    std::string reportBody(const SimHost& host) const;
+    // The peer document with its state version and ETag, rebuilt when the host's state changed.
+    const std::string& peerStatusBody(uint32_t ip, const SimHost& host, std::string& etag);
+    double uniform();
+
+    std::map<uint32_t, SimHost> _hosts;
+    std::map<uint32_t, std::vector<uint32_t>> _latencies;
+    std::map<uint32_t, std::vector<uint32_t>> _reportLatencies;
+    struct PeerDoc {
+        std::string key;
+        std::string body;
+        std::string etag;
+        uint32_t version = 0;
+    };
+    std::map<uint32_t, PeerDoc> _peerDocs;
+    UdpHandler _udpHandler;
+    uint64_t _rng;
+    uint64_t _requests = 0;
+    uint64_t _statusRequests = 0;
+    uint64_t _statusBytes = 0;
+    uint64_t _notModified = 0;
+    uint64_t _connectAttempts = 0;
+};
+
+#endif
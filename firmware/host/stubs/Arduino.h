@@ -0,0 +1,99 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino-ESP32 core surface for the host build.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include "WString.h"
+#include "HostRuntime.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+typedef uint8_t byte;
+
+// Flash and RAM are one address space on the ESP32: PROGMEM data reads directly
+#define PROGMEM
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+
+// Arduino-ESP32 pulls std::min/std::max into the global namespace.
+using std::max;
+using std::min;
+
+// newlib provides strlcpy on the ESP32; glibc only from 2.38.
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t len = std::strlen(src);
+    if (size > 0) {
+        size_t n = len < size - 1 ? len : size - 1;
+        std::memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+template <typename T, typename L, typename H>
+T constrain(T x, L lo, H hi) { return x < (T)lo ? (T)lo : (x > (T)hi ? (T)hi : x); }
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    size_t print(const String& s);
+    size_t print(const char* s);
+    size_t println(const String& s);
+    size_t println(const char* s = "");
+    size_t printf(const char* format, ...);
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getFreePsram();
+    uint32_t getPsramSize();
+    uint32_t getFlashChipSize();
+    void restart();
+};
+
+extern EspClass ESP;
+
+// ESP-IDF heap_caps subset
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+
+#endif
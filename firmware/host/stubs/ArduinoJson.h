@@ -0,0 +1,673 @@
+#ifndef HOST_ARDUINOJSON_H
+#define HOST_ARDUINOJSON_H
+
+// Host stand-in for the ArduinoJson 7 API subset used by the firmware.
+//
+// A plain heap-allocated tree: JsonObject/JsonArray/JsonVariant are handles
+// into nodes owned by a JsonDocument. Member lookups that miss return a
+// detached variant that creates the member on first write, like ArduinoJson's
+// MemberProxy. Allocation behaviour is not representative of ArduinoJson's
+// pool allocator; benchmarks should treat JSON heap figures as upper bounds.
+
+#include "Arduino.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hostjson {
+
+struct Node {
+    enum Type { Null, Bool, Int, UInt, Float, Double, Str, Object, Array };
+    Type type = Null;
+    bool b = false;
+    long long i = 0;
+    unsigned long long u = 0;
+    double d = 0.0;
+    std::string s;
+    std::vector<std::pair<std::string, std::unique_ptr<Node>>> members;
+    std::vector<std::unique_ptr<Node>> items;
+
+    void reset() {
+        type = Null;
+        s.clear();
+        members.clear();
+        items.clear();
+    }
+
+    Node* find(const char* key) const {
+        for (const auto& m : members) {
+            if (m.first == key) return m.second.get();
+        }
+        return nullptr;
+    }
+
+    Node* member(const char* key) {
+        Node* n = find(key);
+        if (n) return n;
+        if (type != Object) {
+            reset();
+            type = Object;
+        }
+        members.emplace_back(key, std::unique_ptr<Node>(new Node()));
+        return members.back().second.get();
+    }
+
+    Node* append() {
+        if (type != Array) {
+            reset();
+            type = Array;
+        }
+        items.emplace_back(new Node());
+        return items.back().get();
+    }
+
+    void copyFrom(const Node* src) {
+        if (src == this) return;
+        if (!src) {
+            reset();
+            return;
+        }
+        // Copy into a temporary first: src may live inside this subtree.
+        Node tmp;
+        tmp.type = src->type;
+        tmp.b = src->b;
+        tmp.i = src->i;
+        tmp.u = src->u;
+        tmp.d = src->d;
+        tmp.s = src->s;
+        for (const auto& m : src->members) {
+            std::unique_ptr<Node> child(new Node());
+            child->copyFrom(m.second.get());
+            tmp.members.emplace_back(m.first, std::move(child));
+        }
+        for (const auto& it : src->items) {
+            std::unique_ptr<Node> child(new Node());
+            child->copyFrom(it.get());
+            tmp.items.push_back(std::move(child));
+        }
+        type = tmp.type;
+        b = tmp.b;
+        i = tmp.i;
+        u = tmp.u;
+        d = tmp.d;
+        s.swap(tmp.s);
+        members.swap(tmp.members);
+        items.swap(tmp.items);
+    }
+
+    double asDouble() const {
+        switch (type) {
+            case Bool: return b ? 1.0 : 0.0;
+            case Int: return (double)i;
+            case UInt: return (double)u;
+            case Float:
+            case Double: return d;
+            case Str: return std::strtod(s.c_str(), nullptr);
+            default: return 0.0;
+        }
+    }
+
+    long long asInt() const {
+        switch (type) {
+            case Bool: return b ? 1 : 0;
+            case Int: return i;
+            case UInt: return (long long)u;
+            case Float:
+            case Double: return (long long)d;
+            case Str: return std::strtoll(s.c_str(), nullptr, 10);
+            default: return 0;
+        }
+    }
+};
+
+void serialize(const Node* node, std::string& out);
+
+} // namespace hostjson
+
+class JsonObject;
+class JsonArray;
+class JsonDocument;
+
+class JsonVariant {
+public:
+    JsonVariant() {}
+    explicit JsonVariant(hostjson::Node* node) : _node(node) {}
+    JsonVariant(hostjson::Node* parent, const char* key) : _node(parent ? parent->find(key) : nullptr), _parent(parent), _key(key) {}
+    JsonVariant(const JsonVariant& other) = default;
+
+    // Assignment writes through, like ArduinoJson's MemberProxy.
+    JsonVariant& operator=(const JsonVariant& other) { set(other); return *this; }
+    template <typename T>
+    JsonVariant& operator=(const T& value) { set(value); return *this; }
+
+    template <typename T>
+    bool set(const T& value);
+
+    bool isNull() const { return !_node || _node->type == hostjson::Node::Null; }
+    template <typename T>
+    bool is() const;
+
+    template <typename T>
+    T as() const;
+
+    template <typename T>
+    operator T() const { return as<T>(); }
+
+    template <typename T>
+    T to();
+
+    JsonVariant operator[](const char* key) const;
+    JsonVariant operator[](const String& key) const { return (*this)[key.c_str()]; }
+    JsonVariant operator[](int index) const;
+
+    bool containsKey(const char* key) const { return _node && _node->type == hostjson::Node::Object && _node->find(key); }
+    bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+    size_t size() const {
+        if (!_node) return 0;
+        if (_node->type == hostjson::Node::Object) return _node->members.size();
+        if (_node->type == hostjson::Node::Array) return _node->items.size();
+        return 0;
+    }
+
+    template <typename T>
+    typename std::enable_if<!std::is_same<T, JsonObject>::value && !std::is_same<T, JsonArray>::value, bool>::type
+    add(const T& value);
+    template <typename T>
+    typename std::enable_if<std::is_same<T, JsonObject>::value || std::is_same<T, JsonArray>::value, T>::type add();
+
+    const char* operator|(const char* fallback) const {
+        return (_node && _node->type == hostjson::Node::Str) ? _node->s.c_str() : fallback;
+    }
+    template <typename T>
+    typename std::enable_if<!std::is_same<T, const char*>::value && !std::is_same<T, char*>::value, T>::type
+    operator|(const T& fallback) const {
+        if (isNull() || !is<T>()) return fallback;
+        return as<T>();
+    }
+    JsonVariant operator|(const JsonVariant& fallback) const { return isNull() ? fallback : *this; }
+
+    hostjson::Node* node() const { return _node; }
+
+protected:
+    hostjson::Node* _node = nullptr;
+    hostjson::Node* _parent = nullptr;
+    std::string _key;
+
+    hostjson::Node* resolveForWrite() {
+        if (!_node && _parent) _node = _parent->member(_key.c_str());
+        return _node;
+    }
+
+    friend class JsonObject;
+    friend class JsonArray;
+    friend class JsonDocument;
+};
+
+typedef JsonVariant JsonVariantConst;
+
+class JsonString {
+public:
+    explicit JsonString(const char* s) : _s(s) {}
+    const char* c_str() const { return _s; }
+    operator const char*() const { return _s; }
+
+private:
+    const char* _s;
+};
+
+class JsonPair {
+public:
+    JsonPair(const char* key, hostjson::Node* value) : _key(key), _value(value) {}
+    JsonString key() const { return _key; }
+    JsonVariant value() const { return _value; }
+
+private:
+    JsonString _key;
+    JsonVariant _value;
+};
+
+class JsonObject {
+public:
+    JsonObject() {}
+    explicit JsonObject(hostjson::Node* node) : _node(node && node->type == hostjson::Node::Object ? node : nullptr) {}
+
+    JsonVariant operator[](const char* key) const { return JsonVariant(_node, key); }
+    JsonVariant operator[](const String& key) const { return JsonVariant(_node, key.c_str()); }
+
+    bool containsKey(const char* key) const { return _node && _node->find(key); }
+    bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+    bool isNull() const { return _node == nullptr; }
+    size_t size() const { return _node ? _node->members.size() : 0; }
+
+    void remove(const char* key) const {
+        if (!_node) return;
+        for (auto it = _node->members.begin(); it != _node->members.end(); ++it) {
+            if (it->first == key) {
+                _node->members.erase(it);
+                return;
+            }
+        }
+    }
+    void remove(const String& key) const { remove(key.c_str()); }
+    void clear() const { if (_node) _node->members.clear(); }
+
+    JsonArray createNestedArray(const char* key) const;
+    JsonArray createNestedArray(const String& key) const;
+    JsonObject createNestedObject(const char* key) const;
+    JsonObject createNestedObject(const String& key) const;
+
+    class iterator {
+    public:
+        iterator(hostjson::Node* node, size_t index) : _node(node), _index(index) {}
+        JsonPair operator*() const {
+            auto& m = _node->members[_index];
+            return JsonPair(m.first.c_str(), m.second.get());
+        }
+        iterator& operator++() { ++_index; return *this; }
+        bool operator!=(const iterator& o) const { return _index != o._index || _node != o._node; }
+
+    private:
+        hostjson::Node* _node;
+        size_t _index;
+    };
+    iterator begin() const { return iterator(_node, 0); }
+    iterator end() const { return iterator(_node, _node ? _node->members.size() : 0); }
+
+    hostjson::Node* node() const { return _node; }
+
+private:
+    hostjson::Node* _node = nullptr;
+};
+
+class JsonArray {
+public:
+    JsonArray() {}
+    explicit JsonArray(hostjson::Node* node) : _node(node && node->type == hostjson::Node::Array ? node : nullptr) {}
+
+    template <typename T>
+    typename std::enable_if<!std::is_same<T, JsonObject>::value && !std::is_same<T, JsonArray>::value, bool>::type
+    add(const T& value) const {
+        if (!_node) return false;
+        JsonVariant v(_node->append());
+        return v.set(value);
+    }
+    template <typename T>
+    typename std::enable_if<std::is_same<T, JsonObject>::value || std::is_same<T, JsonArray>::value, T>::type
+    add() const {
+        if (!_node) return T();
+        hostjson::Node* n = _node->append();
+        n->type = std::is_same<T, JsonObject>::value ? hostjson::Node::Object : hostjson::Node::Array;
+        return T(n);
+    }
+    JsonObject createNestedObject() const { return add<JsonObject>(); }
+    JsonArray createNestedArray() const { return add<JsonArray>(); }
+
+    JsonVariant operator[](size_t index) const {
+        return (_node && index < _node->items.size()) ? JsonVariant(_node->items[index].get()) : JsonVariant();
+    }
+    size_t size() const { return _node ? _node->items.size() : 0; }
+    bool isNull() const { return _node == nullptr; }
+    void clear() const { if (_node) _node->items.clear(); }
+
+    class iterator {
+    public:
+        iterator(hostjson::Node* node, size_t index) : _node(node), _index(index) {}
+        JsonVariant operator*() const { return JsonVariant(_node->items[_index].get()); }
+        iterator& operator++() { ++_index; return *this; }
+        bool operator!=(const iterator& o) const { return _index != o._index || _node != o._node; }
+
+    private:
+        hostjson::Node* _node;
+        size_t _index;
+    };
+    iterator begin() const { return iterator(_node, 0); }
+    iterator end() const { return iterator(_node, _node ? _node->items.size() : 0); }
+
+    hostjson::Node* node() const { return _node; }
+
+private:
+    hostjson::Node* _node = nullptr;
+};
+
+typedef JsonObject JsonObjectConst;
+typedef JsonArray JsonArrayConst;
+
+class JsonDocument {
+public:
+    JsonDocument() : _root(new hostjson::Node()) {}
+    JsonDocument(const JsonDocument& other) : _root(new hostjson::Node()) { _root->copyFrom(other._root.get()); }
+    JsonDocument& operator=(const JsonDocument& other) {
+        _root->copyFrom(other._root.get());
+        return *this;
+    }
+
+    template <typename T>
+    T to() {
+        _root->reset();
+        if (std::is_same<T, JsonObject>::value) _root->type = hostjson::Node::Object;
+        if (std::is_same<T, JsonArray>::value) _root->type = hostjson::Node::Array;
+        return T(_root.get());
+    }
+    template <typename T>
+    T as() const { return JsonVariant(_root.get()).as<T>(); }
+    template <typename T>
+    bool is() const { return JsonVariant(_root.get()).is<T>(); }
+
+    template <typename T>
+    bool set(const T& value) { return JsonVariant(_root.get()).set(value); }
+
+    JsonVariant operator[](const char* key) {
+        if (_root->type == hostjson::Node::Null) _root->type = hostjson::Node::Object;
+        return JsonVariant(_root.get())[key];
+    }
+    JsonVariant operator[](const String& key) { return (*this)[key.c_str()]; }
+    JsonVariant operator[](int index) { return JsonVariant(_root.get())[index]; }
+
+    bool containsKey(const char* key) const { return _root->type == hostjson::Node::Object && _root->find(key); }
+    bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+    bool isNull() const { return _root->type == hostjson::Node::Null; }
+    size_t size() const { return JsonVariant(_root.get()).size(); }
+    void clear() { _root->reset(); }
+    bool overflowed() const { return false; }
+    void remove(const char* key) { JsonObject(_root.get()).remove(key); }
+
+    JsonObject createNestedObject(const char* key) { return JsonObject(objectRoot()).createNestedObject(key); }
+    JsonArray createNestedArray(const char* key) { return JsonObject(objectRoot()).createNestedArray(key); }
+
+    template <typename T>
+    bool add(const T& value) {
+        hostjson::Node* n = _root->type == hostjson::Node::Array ? _root.get() : (_root->reset(), _root->type = hostjson::Node::Array, _root.get());
+        return JsonArray(n).add(value);
+    }
+
+    operator JsonVariant() const { return JsonVariant(_root.get()); }
+    hostjson::Node* node() const { return _root.get(); }
+
+private:
+    std::unique_ptr<hostjson::Node> _root;
+
+    hostjson::Node* objectRoot() {
+        if (_root->type != hostjson::Node::Object) {
+            _root->reset();
+            _root->type = hostjson::Node::Object;
+        }
+        return _root.get();
+    }
+};
+
+// --------------------------------------------------------------------------
+// JsonVariant templates
+// --------------------------------------------------------------------------
+namespace hostjson {
+
+inline const Node* nodeOf(const JsonVariant& v) { return v.node(); }
+inline const Node* nodeOf(const JsonObject& v) { return v.node(); }
+inline const Node* nodeOf(const JsonArray& v) { return v.node(); }
+inline const Node* nodeOf(const JsonDocument& v) { return v.node(); }
+
+template <typename T>
+struct Converter;
+
+template <>
+struct Converter<bool> {
+    static bool get(const Node* n) { return n && (n->type == Node::Bool ? n->b : n->asInt() != 0); }
+    static void set(Node* n, bool v) { n->reset(); n->type = Node::Bool; n->b = v; }
+    static bool is(const Node* n) { return n && n->type == Node::Bool; }
+};
+
+template <>
+struct Converter<const char*> {
+    static const char* get(const Node* n) { return (n && n->type == Node::Str) ? n->s.c_str() : nullptr; }
+    static void set(Node* n, const char* v) {
+        n->reset();
+        if (!v) return;
+        n->type = Node::Str;
+        n->s = v;
+    }
+    static bool is(const Node* n) { return n && n->type == Node::Str; }
+};
+
+template <>
+struct Converter<char*> : Converter<const char*> {};
+
+template <>
+struct Converter<String> {
+    static String get(const Node* n) {
+        if (!n || n->type == Node::Null) return String("null");
+        if (n->type == Node::Str) return String(n->s);
+        std::string out;
+        serialize(n, out);
+        return String(out);
+    }
+    static void set(Node* n, const String& v) { n->reset(); n->type = Node::Str; n->s = v.str(); }
+    static bool is(const Node* n) { return n && n->type == Node::Str; }
+};
+
+template <>
+struct Converter<std::string> {
+    static std::string get(const Node* n) { return Converter<String>::get(n).str(); }
+    static void set(Node* n, const std::string& v) { n->reset(); n->type = Node::Str; n->s = v; }
+    static bool is(const Node* n) { return n && n->type == Node::Str; }
+};
+
+template <>
+struct Converter<JsonObject> {
+    static JsonObject get(const Node* n) { return JsonObject(const_cast<Node*>(n)); }
+    static void set(Node* n, const JsonObject& v) { n->copyFrom(v.node()); }
+    static bool is(const Node* n) { return n && n->type == Node::Object; }
+};
+
+template <>
+struct Converter<JsonArray> {
+    static JsonArray get(const Node* n) { return JsonArray(const_cast<Node*>(n)); }
+    static void set(Node* n, const JsonArray& v) { n->copyFrom(v.node()); }
+    static bool is(const Node* n) { return n && n->type == Node::Array; }
+};
+
+template <>
+struct Converter<JsonVariant> {
+    static JsonVariant get(const Node* n) { return JsonVariant(const_cast<Node*>(n)); }
+    static void set(Node* n, const JsonVariant& v) { n->copyFrom(v.node()); }
+    static bool is(const Node*) { return true; }
+};
+
+template <>
+struct Converter<JsonDocument> {
+    static void set(Node* n, const JsonDocument& v) { n->copyFrom(v.node()); }
+};
+
+template <>
+struct Converter<std::nullptr_t> {
+    static void set(Node* n, std::nullptr_t) { n->reset(); }
+};
+
+template <typename T, bool Integral = std::is_integral<T>::value, bool Floating = std::is_floating_point<T>::value>
+struct NumberConverter;
+
+template <typename T>
+struct NumberConverter<T, true, false> {
+    static T get(const Node* n) { return n ? (T)n->asInt() : (T)0; }
+    static void set(Node* n, T v) {
+        n->reset();
+        if (std::is_signed<T>::value) {
+            n->type = Node::Int;
+            n->i = (long long)v;
+        } else {
+            n->type = Node::UInt;
+            n->u = (unsigned long long)v;
+        }
+    }
+    static bool is(const Node* n) { return n && (n->type == Node::Int || n->type == Node::UInt); }
+};
+
+template <typename T>
+struct NumberConverter<T, false, true> {
+    static T get(const Node* n) { return n ? (T)n->asDouble() : (T)0; }
+    static void set(Node* n, T v) {
+        n->reset();
+        n->type = std::is_same<T, float>::value ? Node::Float : Node::Double;
+        n->d = (double)v;
+    }
+    static bool is(const Node* n) {
+        return n && (n->type == Node::Float || n->type == Node::Double || n->type == Node::Int || n->type == Node::UInt);
+    }
+};
+
+template <typename T>
+struct Converter : NumberConverter<T> {};
+
+template <typename T>
+struct Decay {
+    typedef typename std::decay<T>::type type;
+};
+template <size_t N>
+struct Decay<char[N]> {
+    typedef const char* type;
+};
+template <size_t N>
+struct Decay<const char[N]> {
+    typedef const char* type;
+};
+
+} // namespace hostjson
+
+template <typename T>
+bool JsonVariant::set(const T& value) {
+    hostjson::Node* n = resolveForWrite();
+    if (!n) return false;
+    typedef typename hostjson::Decay<T>::type D;
+    hostjson::Converter<D>::set(n, value);
+    return true;
+}
+
+template <typename T>
+bool JsonVariant::is() const {
+    return hostjson::Converter<T>::is(_node);
+}
+
+template <typename T>
+T JsonVariant::as() const {
+    return hostjson::Converter<T>::get(_node);
+}
+
+template <typename T>
+T JsonVariant::to() {
+    hostjson::Node* n = resolveForWrite();
+    if (!n) return T();
+    n->reset();
+    if (std::is_same<T, JsonObject>::value) n->type = hostjson::Node::Object;
+    if (std::is_same<T, JsonArray>::value) n->type = hostjson::Node::Array;
+    return T(n);
+}
+
+inline JsonVariant JsonVariant::operator[](const char* key) const {
+    if (_node && _node->type == hostjson::Node::Object) return JsonVariant(_node, key);
+    return JsonVariant();
+}
+
+inline JsonVariant JsonVariant::operator[](int index) const {
+    if (_node && _node->type == hostjson::Node::Array && index >= 0 && (size_t)index < _node->items.size()) {
+        return JsonVariant(_node->items[index].get());
+    }
+    return JsonVariant();
+}
+
+template <typename T>
+typename std::enable_if<!std::is_same<T, JsonObject>::value && !std::is_same<T, JsonArray>::value, bool>::type
+JsonVariant::add(const T& value) {
+    hostjson::Node* n = resolveForWrite();
+    if (!n) return false;
+    return JsonArray(n->type == hostjson::Node::Array ? n : (n->reset(), n->type = hostjson::Node::Array, n)).add(value);
+}
+
+template <typename T>
+typename std::enable_if<std::is_same<T, JsonObject>::value || std::is_same<T, JsonArray>::value, T>::type
+JsonVariant::add() {
+    hostjson::Node* n = resolveForWrite();
+    if (!n) return T();
+    if (n->type != hostjson::Node::Array) {
+        n->reset();
+        n->type = hostjson::Node::Array;
+    }
+    return JsonArray(n).add<T>();
+}
+
+inline JsonArray JsonObject::createNestedArray(const char* key) const {
+    if (!_node) return JsonArray();
+    hostjson::Node* n = _node->member(key);
+    n->reset();
+    n->type = hostjson::Node::Array;
+    return JsonArray(n);
+}
+inline JsonArray JsonObject::createNestedArray(const String& key) const { return createNestedArray(key.c_str()); }
+
+inline JsonObject JsonObject::createNestedObject(const char* key) const {
+    if (!_node) return JsonObject();
+    hostjson::Node* n = _node->member(key);
+    n->reset();
+    n->type = hostjson::Node::Object;
+    return JsonObject(n);
+}
+inline JsonObject JsonObject::createNestedObject(const String& key) const { return createNestedObject(key.c_str()); }
+
+// --------------------------------------------------------------------------
+// Serialization
+// --------------------------------------------------------------------------
+class DeserializationError {
+public:
+    enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+    DeserializationError(Code code = Ok) : _code(code) {}
+    explicit operator bool() const { return _code != Ok; }
+    Code code() const { return _code; }
+    const char* c_str() const {
+        static const char* names[] = {"Ok", "EmptyInput", "IncompleteInput", "InvalidInput", "NoMemory", "TooDeep"};
+        return names[_code];
+    }
+    bool operator==(Code c) const { return _code == c; }
+    bool operator!=(Code c) const { return _code != c; }
+
+private:
+    Code _code;
+};
+
+template <typename T>
+size_t serializeJson(const T& source, String& output) {
+    std::string out;
+    hostjson::serialize(hostjson::nodeOf(source), out);
+    output = String(out);
+    return out.size();
+}
+
+template <typename T>
+size_t serializeJson(const T& source, char* buffer, size_t size) {
+    std::string out;
+    hostjson::serialize(hostjson::nodeOf(source), out);
+    if (size == 0) return 0;
+    size_t n = out.size() < size - 1 ? out.size() : size - 1;
+    std::memcpy(buffer, out.data(), n);
+    buffer[n] = 0;
+    return n;
+}
+
+template <typename T>
+size_t measureJson(const T& source) {
+    std::string out;
+    hostjson::serialize(hostjson::nodeOf(source), out);
+    return out.size();
+}
+
+DeserializationError deserializeJson(JsonDocument& doc, const char* input, size_t length);
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* input) {
+    return deserializeJson(doc, input, input ? std::strlen(input) : 0);
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const String& input) {
+    return deserializeJson(doc, input.c_str(), input.length());
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const uint8_t* input, size_t length) {
+    return deserializeJson(doc, reinterpret_cast<const char*>(input), length);
+}
+
+#endif
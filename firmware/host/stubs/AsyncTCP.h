@@ -0,0 +1,79 @@
+#ifndef HOST_ASYNCTCP_H
+#define HOST_ASYNCTCP_H
+
+// AsyncClient stand-in. Connects, replies and closes come from the
+// host::NetworkModel attached by the benchmark (nothing answers without one)
+// and are delivered on the virtual clock, like the async_tcp task would.
+// As in AsyncTCP, onDisconnect is the last callback and may delete the client,
+// and onPoll runs every 500 ms while the connection exists.
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "WiFi.h"
+
+class AsyncClient;
+
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+typedef std::function<void(void*, AsyncClient*, int8_t error)> AcErrorHandler;
+typedef std::function<void(void*, AsyncClient*, uint32_t time)> AcTimeoutHandler;
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+
+class AsyncClient {
+public:
+    AsyncClient();
+    ~AsyncClient();
+
+    bool connect(IPAddress ip, uint16_t port);
+    size_t write(const char* data, size_t size, uint8_t apiflags = ASYNC_WRITE_FLAG_COPY);
+    void close(bool now = false);
+    int8_t abort();
+    bool connected() const { return _state == CONNECTED; }
+    bool disconnected() const { return _state == IDLE || _state == CLOSED; }
+    IPAddress remoteIP() const { return IPAddress(_ip); }
+
+    void setRxTimeout(uint32_t) {}
+    void setNoDelay(bool) {}
+
+    void onConnect(AcConnectHandler cb, void* arg = nullptr) { _connectCb = cb; _connectArg = arg; }
+    void onDisconnect(AcConnectHandler cb, void* arg = nullptr) { _disconnectCb = cb; _disconnectArg = arg; }
+    void onData(AcDataHandler cb, void* arg = nullptr) { _dataCb = cb; _dataArg = arg; }
+    void onError(AcErrorHandler cb, void* arg = nullptr) { _errorCb = cb; _errorArg = arg; }
+    void onTimeout(AcTimeoutHandler cb, void* arg = nullptr) { _timeoutCb = cb; _timeoutArg = arg; }
+    void onPoll(AcConnectHandler cb, void* arg = nullptr) { _pollCb = cb; _pollArg = arg; }
+
+    // Delivery from the network model (HostNet.cpp).
+    enum State : uint8_t { IDLE, CONNECTING, CONNECTED, CLOSED };
+    enum Event : uint8_t { EV_CONNECTED, EV_REFUSED, EV_DATA, EV_PEER_CLOSED, EV_POLL };
+    void deliver(Event event, const std::string& bytes);
+    struct PendingEvent;
+    void forget(PendingEvent* e);
+
+private:
+    void discard(int8_t error);
+    void schedule(Event event, uint32_t delayUs, std::string bytes = std::string());
+    void cancelEvents();
+
+    State _state = IDLE;
+    uint32_t _ip = 0;
+    uint16_t _port = 0;
+    std::string _request;
+    std::vector<PendingEvent*> _pending;
+
+    AcConnectHandler _connectCb, _disconnectCb, _pollCb;
+    AcDataHandler _dataCb;
+    AcErrorHandler _errorCb;
+    AcTimeoutHandler _timeoutCb;
+    void* _connectArg = nullptr;
+    void* _disconnectArg = nullptr;
+    void* _dataArg = nullptr;
+    void* _errorArg = nullptr;
+    void* _timeoutArg = nullptr;
+    void* _pollArg = nullptr;
+};
+
+#endif
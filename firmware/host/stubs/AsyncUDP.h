@@ -0,0 +1,61 @@
+#ifndef HOST_ASYNCUDP_H
+#define HOST_ASYNCUDP_H
+
+// AsyncUDP stand-in. Datagrams sent with writeTo() go to the attached
+// host::NetworkModel; datagrams injected with host::deliverUdp() arrive in
+// onPacket on the virtual clock, like the async_udp task would deliver them.
+// A socket receives what is sent to its port, unicast or to a group it joined.
+
+#include <functional>
+#include <string>
+
+#include "Arduino.h"
+#include "WiFi.h"
+
+class AsyncUDPPacket {
+public:
+    AsyncUDPPacket(const uint8_t* data, size_t len, IPAddress remote, uint16_t remotePort, IPAddress local, uint16_t localPort)
+        : _data(data), _len(len), _remote(remote), _remotePort(remotePort), _local(local), _localPort(localPort) {}
+
+    uint8_t* data() { return (uint8_t*)_data; }
+    size_t length() { return _len; }
+    IPAddress remoteIP() { return _remote; }
+    uint16_t remotePort() { return _remotePort; }
+    IPAddress localIP() { return _local; }
+    uint16_t localPort() { return _localPort; }
+    bool isMulticast() { return _local[0] >= 224 && _local[0] <= 239; }
+
+private:
+    const uint8_t* _data;
+    size_t _len;
+    IPAddress _remote;
+    uint16_t _remotePort;
+    IPAddress _local;
+    uint16_t _localPort;
+};
+
+typedef std::function<void(AsyncUDPPacket& packet)> AuPacketHandlerFunction;
+
+class AsyncUDP {
+public:
+    AsyncUDP() {}
+    ~AsyncUDP();
+
+    bool listen(uint16_t port);
+    bool listenMulticast(const IPAddress addr, uint16_t port, uint8_t ttl = 1);
+    void onPacket(AuPacketHandlerFunction cb) { _handler = cb; }
+    size_t writeTo(const uint8_t* data, size_t len, const IPAddress addr, uint16_t port);
+    void close();
+    bool connected() { return _port != 0; }
+
+    // Host only: called from the delivery timer.
+    void receive(const std::string& bytes, IPAddress from, uint16_t fromPort, IPAddress to, uint16_t toPort);
+    bool accepts(IPAddress to, uint16_t port) const;
+
+private:
+    AuPacketHandlerFunction _handler;
+    uint16_t _port = 0;
+    IPAddress _group;
+};
+
+#endif
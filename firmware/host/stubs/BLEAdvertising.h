@@ -0,0 +1,12 @@
+#ifndef HOST_BLEADVERTISING_H
+#define HOST_BLEADVERTISING_H
+
+// Declarations only: BLE is not part of the host build.
+
+#include "Arduino.h"
+#include <string>
+
+class BLEScan;
+class BLEAdvertising;
+
+#endif
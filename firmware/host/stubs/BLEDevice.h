@@ -0,0 +1,12 @@
+#ifndef HOST_BLEDEVICE_H
+#define HOST_BLEDEVICE_H
+
+// Declarations only: BLE is not part of the host build.
+
+#include "Arduino.h"
+#include <string>
+
+class BLEScan;
+class BLEAdvertising;
+
+#endif
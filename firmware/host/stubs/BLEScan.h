@@ -0,0 +1,12 @@
+#ifndef HOST_BLESCAN_H
+#define HOST_BLESCAN_H
+
+// Declarations only: BLE is not part of the host build.
+
+#include "Arduino.h"
+#include <string>
+
+class BLEScan;
+class BLEAdvertising;
+
+#endif
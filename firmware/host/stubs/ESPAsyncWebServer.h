@@ -0,0 +1,31 @@
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+// Declarations only: the web server is not part of the host build, but
+// Kernel.h reaches it through WebServer.h.
+
+#include "Arduino.h"
+
+class AsyncWebServerRequest;
+class AsyncWebSocketClient;
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : _port(port) {}
+    void begin() {}
+
+private:
+    uint16_t _port;
+};
+
+class AsyncWebSocket {
+public:
+    explicit AsyncWebSocket(const String& url) : _url(url) {}
+    AsyncWebSocketClient* client(uint32_t id) { return nullptr; }
+    void cleanupClients(uint16_t maxClients = 8) {}
+
+private:
+    String _url;
+};
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef HOST_ESPMDNS_H
+#define HOST_ESPMDNS_H
+
+#include "WiFi.h"
+
+class MDNSResponder {
+public:
+    bool begin(const char*) { return true; }
+    int queryService(const char*, const char*) { return 0; }
+    String hostname(int) { return String(); }
+    IPAddress address(int) { return IPAddress(); }
+    bool hasTxt(int, const char*) { return false; }
+    String txt(int, const char*) { return String(); }
+};
+
+extern MDNSResponder MDNS;
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+// Blocking HTTPClient stand-in: every request fails to connect. Host code
+// paths that matter go through AsyncClient and the simulated network.
+
+#include "Arduino.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient {
+public:
+    bool begin(const String&) { return true; }
+    void setTimeout(uint16_t) {}
+    void setConnectTimeout(int32_t) {}
+    int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    int POST(const String&) { return HTTPC_ERROR_CONNECTION_REFUSED; }
+    void addHeader(const String&, const String&) {}
+    String getString() { return String(); }
+    void end() {}
+};
+
+#endif
@@ -0,0 +1,401 @@
+#include "Arduino.h"
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+// --------------------------------------------------------------------------
+// Heap accounting
+// Every allocation carries a small header so frees can be attributed. The
+// counters back ESP.getFreeHeap() and the benchmark's heap churn figures.
+// --------------------------------------------------------------------------
+namespace {
+
+struct AllocHeader {
+    size_t size;
+    uint32_t caps;
+    uint32_t magic;
+};
+
+constexpr uint32_t kAllocMagic = 0xA5E0A11Cu;
+constexpr size_t kHeaderBytes = (sizeof(AllocHeader) + 15) & ~size_t(15);
+
+std::atomic<uint64_t> gAllocations{0};
+std::atomic<uint64_t> gFrees{0};
+std::atomic<uint64_t> gBytesAllocated{0};
+std::atomic<int64_t> gLiveBytes{0};
+std::atomic<int64_t> gPeakLiveBytes{0};
+std::atomic<int64_t> gPsramLiveBytes{0};
+std::atomic<int64_t> gMinFreeHeap{(int64_t)host::kInternalHeapBytes};
+
+void* trackedAlloc(size_t size, uint32_t caps) {
+    void* raw = std::malloc(kHeaderBytes + size);
+    if (!raw) return nullptr;
+    AllocHeader* h = static_cast<AllocHeader*>(raw);
+    h->size = size;
+    h->caps = caps;
+    h->magic = kAllocMagic;
+    if (caps & MALLOC_CAP_SPIRAM) {
+        gPsramLiveBytes += (int64_t)size;
+    } else {
+        gAllocations++;
+        gBytesAllocated += size;
+        int64_t live = (gLiveBytes += (int64_t)size);
+        int64_t peak = gPeakLiveBytes.load();
+        while (live > peak && !gPeakLiveBytes.compare_exchange_weak(peak, live)) {}
+        int64_t freeNow = (int64_t)host::kInternalHeapBytes - live;
+        int64_t minFree = gMinFreeHeap.load();
+        while (freeNow < minFree && !gMinFreeHeap.compare_exchange_weak(minFree, freeNow)) {}
+    }
+    return static_cast<uint8_t*>(raw) + kHeaderBytes;
+}
+
+void trackedFree(void* ptr) {
+    if (!ptr) return;
+    AllocHeader* h = reinterpret_cast<AllocHeader*>(static_cast<uint8_t*>(ptr) - kHeaderBytes);
+    if (h->magic != kAllocMagic) {
+        std::abort();
+    }
+    h->magic = 0;
+    if (h->caps & MALLOC_CAP_SPIRAM) {
+        gPsramLiveBytes -= (int64_t)h->size;
+    } else {
+        gFrees++;
+        gLiveBytes -= (int64_t)h->size;
+    }
+    std::free(h);
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    void* p = trackedAlloc(size, MALLOC_CAP_8BIT);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size, MALLOC_CAP_8BIT); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size, MALLOC_CAP_8BIT); }
+void operator delete(void* p) noexcept { trackedFree(p); }
+void operator delete[](void* p) noexcept { trackedFree(p); }
+void operator delete(void* p, size_t) noexcept { trackedFree(p); }
+void operator delete[](void* p, size_t) noexcept { trackedFree(p); }
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return trackedAlloc(size, caps);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void* p = trackedAlloc(n * size, caps);
+    if (p) std::memset(p, 0, n * size);
+    return p;
+}
+
+void heap_caps_free(void* ptr) {
+    trackedFree(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) return host::kPsramBytes - (size_t)gPsramLiveBytes.load();
+    return host::kInternalHeapBytes - (size_t)gLiveBytes.load();
+}
+
+namespace host {
+
+HeapStats heapStats() {
+    HeapStats s;
+    s.allocations = gAllocations.load();
+    s.frees = gFrees.load();
+    s.bytesAllocated = gBytesAllocated.load();
+    s.liveBytes = gLiveBytes.load();
+    s.peakLiveBytes = gPeakLiveBytes.load();
+    s.psramLiveBytes = gPsramLiveBytes.load();
+    return s;
+}
+
+void resetHeapPeak() {
+    gPeakLiveBytes = gLiveBytes.load();
+}
+
+// --------------------------------------------------------------------------
+// Virtual clock
+// --------------------------------------------------------------------------
+namespace {
+std::atomic<uint64_t> gNowUs{0};
+std::atomic<uint32_t> gEpochBase{1767225600}; // 2026-01-01T00:00:00Z
+}
+
+uint64_t Clock::nowUs() { return gNowUs.load(); }
+void Clock::advanceUs(uint64_t us) { gNowUs += us; }
+void Clock::reset(uint64_t us) { gNowUs = us; }
+void Clock::setEpochBase(uint32_t epoch) { gEpochBase = epoch; }
+uint32_t Clock::epochBase() { return gEpochBase.load(); }
+uint64_t Clock::epochUs() { return (uint64_t)gEpochBase.load() * 1000000ULL + gNowUs.load(); }
+
+// --------------------------------------------------------------------------
+// SPI / GPIO routing
+// --------------------------------------------------------------------------
+namespace {
+std::map<uint8_t, SpiDevice*>& spiDevices() {
+    static std::map<uint8_t, SpiDevice*> devices;
+    return devices;
+}
+std::map<uint8_t, uint8_t>& chipSelects() {
+    static std::map<uint8_t, uint8_t> pins;
+    return pins;
+}
+std::map<uint8_t, std::function<int()>>& inputSources() {
+    static std::map<uint8_t, std::function<int()>> sources;
+    return sources;
+}
+std::map<uint8_t, uint8_t>& pinLevels() {
+    static std::map<uint8_t, uint8_t> levels;
+    return levels;
+}
+std::atomic<bool> gSerialEcho{true};
+}
+
+void attachSpiDevice(uint8_t bus, SpiDevice* device) { spiDevices()[bus] = device; }
+
+SpiDevice* spiDeviceForBus(uint8_t bus) {
+    auto it = spiDevices().find(bus);
+    return it == spiDevices().end() ? nullptr : it->second;
+}
+
+void bindChipSelect(uint8_t pin, uint8_t bus) { chipSelects()[pin] = bus; }
+
+void setInputSource(uint8_t pin, std::function<int()> source) { inputSources()[pin] = source; }
+
+void writePin(uint8_t pin, uint8_t level) {
+    uint8_t previous = pinLevels().count(pin) ? pinLevels()[pin] : HIGH;
+    pinLevels()[pin] = level;
+    auto cs = chipSelects().find(pin);
+    if (cs == chipSelects().end() || previous == level) return;
+    SpiDevice* dev = spiDeviceForBus(cs->second);
+    if (!dev) return;
+    if (level == LOW) dev->select();
+    else dev->deselect();
+}
+
+int readPin(uint8_t pin) {
+    auto src = inputSources().find(pin);
+    if (src != inputSources().end()) return src->second();
+    auto lvl = pinLevels().find(pin);
+    return lvl == pinLevels().end() ? LOW : lvl->second;
+}
+
+void setSerialEcho(bool enabled) { gSerialEcho = enabled; }
+
+} // namespace host
+
+// --------------------------------------------------------------------------
+// Arduino core
+// --------------------------------------------------------------------------
+unsigned long millis() { return (unsigned long)(host::Clock::nowUs() / 1000ULL); }
+unsigned long micros() { return (unsigned long)host::Clock::nowUs(); }
+void delay(uint32_t ms) { host::Clock::advanceUs((uint64_t)ms * 1000ULL); }
+void delayMicroseconds(uint32_t us) { host::Clock::advanceUs(us); }
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t level) { host::writePin(pin, level); }
+int digitalRead(uint8_t pin) { return host::readPin(pin); }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    if (inMax == inMin) return outMin;
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::print(const String& s) { return print(s.c_str()); }
+size_t HardwareSerial::print(const char* s) {
+    if (!host::gSerialEcho || !s) return 0;
+    return std::fputs(s, stdout) >= 0 ? std::strlen(s) : 0;
+}
+size_t HardwareSerial::println(const String& s) { return println(s.c_str()); }
+size_t HardwareSerial::println(const char* s) {
+    size_t n = print(s);
+    if (host::gSerialEcho) std::fputc('\n', stdout);
+    return n + 1;
+}
+size_t HardwareSerial::printf(const char* format, ...) {
+    char buf[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return print(buf);
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getFreeHeap() { return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getHeapSize() { return (uint32_t)host::kInternalHeapBytes; }
+uint32_t EspClass::getMinFreeHeap() { return (uint32_t)gMinFreeHeap.load(); }
+uint32_t EspClass::getMaxAllocHeap() { return getFreeHeap(); }
+uint32_t EspClass::getFreePsram() { return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getPsramSize() { return (uint32_t)host::kPsramBytes; }
+uint32_t EspClass::getFlashChipSize() { return 16 * 1024 * 1024; }
+void EspClass::restart() { std::exit(0); }
+
+// --------------------------------------------------------------------------
+// FreeRTOS
+// --------------------------------------------------------------------------
+struct HostSemaphore {
+    std::timed_mutex mutex;
+    bool binary = false;
+    std::atomic<bool> given{false};
+};
+
+// --------------------------------------------------------------------------
+// esp_timer (one-shot, virtual clock)
+// --------------------------------------------------------------------------
+struct esp_timer {
+    esp_timer_cb_t callback = nullptr;
+    void* arg = nullptr;
+    uint64_t deadlineUs = 0;
+    bool armed = false;
+};
+
+namespace {
+
+std::mutex gTimerMutex;
+std::vector<esp_timer*> gTimers;
+
+// Fires every armed timer due at or before untilUs, in deadline order, moving
+// the clock to each deadline. Returns true if any callback ran.
+bool runTimersUntil(uint64_t untilUs) {
+    bool fired = false;
+    for (;;) {
+        esp_timer* next = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(gTimerMutex);
+            for (esp_timer* t : gTimers) {
+                if (t->armed && t->deadlineUs <= untilUs && (!next || t->deadlineUs < next->deadlineUs)) next = t;
+            }
+            if (!next) return fired;
+            next->armed = false;
+        }
+        uint64_t now = host::Clock::nowUs();
+        if (next->deadlineUs > now) host::Clock::advanceUs(next->deadlineUs - now);
+        next->callback(next->arg);
+        fired = true;
+    }
+}
+
+void advanceTo(uint64_t targetUs) {
+    runTimersUntil(targetUs);
+    uint64_t now = host::Clock::nowUs();
+    if (targetUs > now) host::Clock::advanceUs(targetUs - now);
+}
+
+} // namespace
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out_handle) {
+    if (!args || !args->callback || !out_handle) return ESP_ERR_INVALID_ARG;
+    esp_timer* t = new esp_timer();
+    t->callback = args->callback;
+    t->arg = args->arg;
+    std::lock_guard<std::mutex> lock(gTimerMutex);
+    gTimers.push_back(t);
+    *out_handle = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(gTimerMutex);
+    if (timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->deadlineUs = host::Clock::nowUs() + timeout_us;
+    timer->armed = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(gTimerMutex);
+    if (!timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->armed = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(gTimerMutex);
+    gTimers.erase(std::remove(gTimers.begin(), gTimers.end(), timer), gTimers.end());
+    delete timer;
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time() { return (int64_t)host::Clock::nowUs(); }
+
+void vTaskDelay(TickType_t ticks) { advanceTo(host::Clock::nowUs() + (uint64_t)ticks * 1000ULL); }
+TickType_t xTaskGetTickCount() { return (TickType_t)millis(); }
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char*, uint32_t, void* param, UBaseType_t, TaskHandle_t* handle) {
+    std::thread(fn, param).detach();
+    if (handle) *handle = nullptr;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t) {
+    return xTaskCreate(fn, name, stack, param, priority, handle);
+}
+
+void vTaskDelete(TaskHandle_t) {}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore(); }
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    HostSemaphore* sem = new HostSemaphore();
+    sem->binary = true;
+    return sem;
+}
+
+// A task blocked on a binary semaphore lets virtual time run up to its
+// timeout, so esp_timer callbacks that give it fire at their deadline.
+static BaseType_t takeBinary(HostSemaphore* sem, TickType_t ticks) {
+    bool forever = ticks == portMAX_DELAY;
+    uint64_t deadline = forever ? UINT64_MAX : host::Clock::nowUs() + (uint64_t)ticks * 1000ULL;
+    for (;;) {
+        if (sem->given.exchange(false)) return pdTRUE;
+        if (runTimersUntil(deadline)) {
+            if (sem->given.exchange(false)) {
+                host::Clock::advanceUs(host::kTimerWakeUs);
+                return pdTRUE;
+            }
+            continue;
+        }
+        if (!forever) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    advanceTo(deadline);
+    return sem->given.exchange(false) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    if (!sem) return pdFALSE;
+    if (sem->binary) return takeBinary(sem, ticks);
+    if (ticks == portMAX_DELAY) {
+        sem->mutex.lock();
+        return pdTRUE;
+    }
+    return sem->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (!sem) return pdFALSE;
+    if (sem->binary) return sem->given.exchange(true) ? pdFALSE : pdTRUE;
+    sem->mutex.unlock();
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) { delete sem; }
@@ -0,0 +1,234 @@
+#include "ArduinoJson.h"
+
+namespace hostjson {
+
+namespace {
+
+void writeString(const std::string& s, std::string& out) {
+    out += '"';
+    for (char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", (unsigned char)c);
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+void writeNumber(double v, bool single, std::string& out) {
+    if (std::isnan(v) || std::isinf(v)) {
+        out += "null";
+        return;
+    }
+    char buf[40];
+    std::snprintf(buf, sizeof(buf), single ? "%.7g" : "%.15g", v);
+    out += buf;
+}
+
+class Parser {
+public:
+    Parser(const char* p, const char* end) : _p(p), _end(end) {}
+
+    DeserializationError parse(Node* root) {
+        skipWs();
+        if (_p >= _end) return DeserializationError::EmptyInput;
+        DeserializationError err = value(root, 0);
+        return err;
+    }
+
+private:
+    const char* _p;
+    const char* _end;
+
+    void skipWs() {
+        while (_p < _end && (*_p == ' ' || *_p == '\n' || *_p == '\r' || *_p == '\t')) _p++;
+    }
+
+    DeserializationError value(Node* n, int depth) {
+        if (depth > 10) return DeserializationError::TooDeep;
+        skipWs();
+        if (_p >= _end) return DeserializationError::IncompleteInput;
+        char c = *_p;
+        if (c == '{') return object(n, depth);
+        if (c == '[') return array(n, depth);
+        if (c == '"') {
+            n->type = Node::Str;
+            return string(n->s);
+        }
+        if (matchWord("true")) { n->type = Node::Bool; n->b = true; return DeserializationError::Ok; }
+        if (matchWord("false")) { n->type = Node::Bool; n->b = false; return DeserializationError::Ok; }
+        if (matchWord("null")) { n->type = Node::Null; return DeserializationError::Ok; }
+        return number(n);
+    }
+
+    bool matchWord(const char* w) {
+        size_t len = std::strlen(w);
+        if ((size_t)(_end - _p) >= len && std::strncmp(_p, w, len) == 0) {
+            _p += len;
+            return true;
+        }
+        return false;
+    }
+
+    DeserializationError number(Node* n) {
+        const char* start = _p;
+        bool isFloat = false;
+        if (_p < _end && (*_p == '-' || *_p == '+')) _p++;
+        while (_p < _end && ((*_p >= '0' && *_p <= '9') || *_p == '.' || *_p == 'e' || *_p == 'E' || *_p == '-' || *_p == '+')) {
+            if (*_p == '.' || *_p == 'e' || *_p == 'E') isFloat = true;
+            _p++;
+        }
+        if (_p == start) return DeserializationError::InvalidInput;
+        std::string text(start, _p);
+        if (isFloat) {
+            n->type = Node::Double;
+            n->d = std::strtod(text.c_str(), nullptr);
+        } else if (text[0] == '-') {
+            n->type = Node::Int;
+            n->i = std::strtoll(text.c_str(), nullptr, 10);
+        } else {
+            n->type = Node::UInt;
+            n->u = std::strtoull(text.c_str(), nullptr, 10);
+        }
+        return DeserializationError::Ok;
+    }
+
+    DeserializationError string(std::string& out) {
+        _p++; // opening quote
+        while (_p < _end && *_p != '"') {
+            char c = *_p++;
+            if (c == '\\') {
+                if (_p >= _end) return DeserializationError::IncompleteInput;
+                char e = *_p++;
+                switch (e) {
+                    case 'n': out += '\n'; break;
+                    case 'r': out += '\r'; break;
+                    case 't': out += '\t'; break;
+                    case 'b': out += '\b'; break;
+                    case 'f': out += '\f'; break;
+                    case 'u': {
+                        if (_end - _p < 4) return DeserializationError::IncompleteInput;
+                        unsigned code = (unsigned)std::strtoul(std::string(_p, _p + 4).c_str(), nullptr, 16);
+                        _p += 4;
+                        out += code < 0x80 ? (char)code : '?';
+                        break;
+                    }
+                    default: out += e;
+                }
+            } else {
+                out += c;
+            }
+        }
+        if (_p >= _end) return DeserializationError::IncompleteInput;
+        _p++; // closing quote
+        return DeserializationError::Ok;
+    }
+
+    DeserializationError object(Node* n, int depth) {
+        n->type = Node::Object;
+        _p++;
+        skipWs();
+        if (_p < _end && *_p == '}') { _p++; return DeserializationError::Ok; }
+        while (_p < _end) {
+            skipWs();
+            if (_p >= _end || *_p != '"') return _p >= _end ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+            std::string key;
+            DeserializationError err = string(key);
+            if (err) return err;
+            skipWs();
+            if (_p >= _end || *_p != ':') return DeserializationError::InvalidInput;
+            _p++;
+            Node* child = n->member(key.c_str());
+            err = value(child, depth + 1);
+            if (err) return err;
+            skipWs();
+            if (_p < _end && *_p == ',') { _p++; continue; }
+            if (_p < _end && *_p == '}') { _p++; return DeserializationError::Ok; }
+            return _p >= _end ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+        }
+        return DeserializationError::IncompleteInput;
+    }
+
+    DeserializationError array(Node* n, int depth) {
+        n->type = Node::Array;
+        _p++;
+        skipWs();
+        if (_p < _end && *_p == ']') { _p++; return DeserializationError::Ok; }
+        while (_p < _end) {
+            Node* child = n->append();
+            DeserializationError err = value(child, depth + 1);
+            if (err) return err;
+            skipWs();
+            if (_p < _end && *_p == ',') { _p++; continue; }
+            if (_p < _end && *_p == ']') { _p++; return DeserializationError::Ok; }
+            return _p >= _end ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+        }
+        return DeserializationError::IncompleteInput;
+    }
+};
+
+} // namespace
+
+void serialize(const Node* node, std::string& out) {
+    if (!node) {
+        out += "null";
+        return;
+    }
+    switch (node->type) {
+        case Node::Null: out += "null"; break;
+        case Node::Bool: out += node->b ? "true" : "false"; break;
+        case Node::Int: out += std::to_string(node->i); break;
+        case Node::UInt: out += std::to_string(node->u); break;
+        case Node::Float: writeNumber(node->d, true, out); break;
+        case Node::Double: writeNumber(node->d, false, out); break;
+        case Node::Str: writeString(node->s, out); break;
+        case Node::Object: {
+            out += '{';
+            bool first = true;
+            for (const auto& m : node->members) {
+                if (!first) out += ',';
+                first = false;
+                writeString(m.first, out);
+                out += ':';
+                serialize(m.second.get(), out);
+            }
+            out += '}';
+            break;
+        }
+        case Node::Array: {
+            out += '[';
+            bool first = true;
+            for (const auto& it : node->items) {
+                if (!first) out += ',';
+                first = false;
+                serialize(it.get(), out);
+            }
+            out += ']';
+            break;
+        }
+    }
+}
+
+} // namespace hostjson
+
+DeserializationError deserializeJson(JsonDocument& doc, const char* input, size_t length) {
+    doc.clear();
+    if (!input || length == 0) return DeserializationError::EmptyInput;
+    hostjson::Parser parser(input, input + length);
+    DeserializationError err = parser.parse(doc.node());
+    if (err) doc.clear();
+    return err;
+}
@@ -0,0 +1,7 @@
+#include "LittleFS.h"
+#include "WiFi.h"
+#include "ESPmDNS.h"
+
+LittleFSFS LittleFS;
+WiFiClass WiFi;
+MDNSResponder MDNS;
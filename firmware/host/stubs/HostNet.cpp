@@ -0,0 +1,262 @@
+#include "AsyncTCP.h"
+#include "AsyncUDP.h"
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+// --------------------------------------------------------------------------
+// Network model registry and connection counters
+// --------------------------------------------------------------------------
+namespace {
+
+host::NetworkModel* gNetwork = nullptr;
+std::mutex gNetMutex;
+host::NetStats gNetStats;
+std::vector<AsyncUDP*> gUdpSockets;
+
+constexpr uint32_t kPollIntervalUs = 500000;  // AsyncTCP polls each pcb every ~500 ms
+constexpr size_t kSegmentBytes = 1436;       // one TCP MSS on WiFi
+constexpr uint32_t kSegmentUs = 250;          // 1436 B at ~46 Mbit/s
+constexpr int8_t kErrAborted = -13;           // lwIP ERR_ABRT
+constexpr int8_t kErrReset = -14;             // lwIP ERR_RST
+
+} // namespace
+
+namespace host {
+
+void attachNetwork(NetworkModel* model) { gNetwork = model; }
+NetworkModel* network() { return gNetwork; }
+
+NetStats netStats() {
+    std::lock_guard<std::mutex> lock(gNetMutex);
+    return gNetStats;
+}
+
+} // namespace host
+
+// --------------------------------------------------------------------------
+// AsyncClient
+// --------------------------------------------------------------------------
+struct AsyncClient::PendingEvent {
+    AsyncClient* client;
+    Event event;
+    std::string bytes;
+    esp_timer_handle_t timer;
+};
+
+static void firePendingEvent(void* arg) {
+    AsyncClient::PendingEvent* e = static_cast<AsyncClient::PendingEvent*>(arg);
+    AsyncClient* client = e->client;
+    AsyncClient::Event event = e->event;
+    std::string bytes = std::move(e->bytes);
+    client->forget(e);
+    esp_timer_delete(e->timer);
+    delete e;
+    client->deliver(event, bytes);  // may delete client
+}
+
+AsyncClient::AsyncClient() {
+    std::lock_guard<std::mutex> lock(gNetMutex);
+    gNetStats.live++;
+    gNetStats.peakLive = std::max(gNetStats.peakLive, gNetStats.live);
+}
+
+AsyncClient::~AsyncClient() {
+    cancelEvents();
+    std::lock_guard<std::mutex> lock(gNetMutex);
+    gNetStats.live--;
+}
+
+void AsyncClient::schedule(Event event, uint32_t delayUs, std::string bytes) {
+    PendingEvent* e = new PendingEvent{this, event, std::move(bytes), nullptr};
+    esp_timer_create_args_t args = {};
+    args.callback = &firePendingEvent;
+    args.arg = e;
+    args.name = "async_tcp";
+    esp_timer_create(&args, &e->timer);
+    esp_timer_start_once(e->timer, delayUs);
+    _pending.push_back(e);
+}
+
+void AsyncClient::forget(PendingEvent* e) {
+    _pending.erase(std::remove(_pending.begin(), _pending.end(), e), _pending.end());
+}
+
+void AsyncClient::cancelEvents() {
+    for (PendingEvent* e : _pending) {
+        esp_timer_stop(e->timer);
+        esp_timer_delete(e->timer);
+        delete e;
+    }
+    _pending.clear();
+}
+
+bool AsyncClient::connect(IPAddress ip, uint16_t port) {
+    if (_state != IDLE && _state != CLOSED) return false;
+    _state = CONNECTING;
+    _ip = (uint32_t)ip;
+    _port = port;
+    _request.clear();
+    {
+        std::lock_guard<std::mutex> lock(gNetMutex);
+        gNetStats.connects++;
+    }
+    host::TcpConnectPlan plan;
+    if (gNetwork) plan = gNetwork->connect(_ip, port);
+    if (plan.outcome == host::TcpConnectPlan::ACCEPT) schedule(EV_CONNECTED, plan.latencyUs);
+    else if (plan.outcome == host::TcpConnectPlan::REFUSE) schedule(EV_REFUSED, plan.latencyUs);
+    schedule(EV_POLL, kPollIntervalUs);
+    return true;
+}
+
+size_t AsyncClient::write(const char* data, size_t size, uint8_t) {
+    if (_state != CONNECTED || !data) return 0;
+    _request.append(data, size);
+    if (gNetwork && _request.find("\r\n\r\n") != std::string::npos) {
+        host::TcpReply reply = gNetwork->request(_ip, _port, _request);
+        _request.clear();
+        if (reply.respond) {
+            uint32_t at = reply.latencyUs;
+            for (size_t off = 0; off < reply.bytes.size(); off += kSegmentBytes, at += kSegmentUs) {
+                schedule(EV_DATA, at, reply.bytes.substr(off, kSegmentBytes));
+            }
+            schedule(EV_PEER_CLOSED, at);
+        }
+    }
+    return size;
+}
+
+void AsyncClient::close(bool) {
+    if (_state == CONNECTING || _state == CONNECTED) discard(0);
+}
+
+int8_t AsyncClient::abort() {
+    if (_state == CONNECTING || _state == CONNECTED) discard(kErrAborted);
+    return kErrAborted;
+}
+
+void AsyncClient::discard(int8_t error) {
+    cancelEvents();
+    _state = CLOSED;
+    if (error != 0 && _errorCb) _errorCb(_errorArg, this, error);
+    if (_disconnectCb) _disconnectCb(_disconnectArg, this);  // may delete this
+}
+
+void AsyncClient::deliver(Event event, const std::string& bytes) {
+    switch (event) {
+        case EV_CONNECTED:
+            if (_state != CONNECTING) return;
+            _state = CONNECTED;
+            if (_connectCb) _connectCb(_connectArg, this);
+            return;
+        case EV_REFUSED:
+            if (_state == CONNECTING) discard(kErrReset);
+            return;
+        case EV_DATA:
+            if (_state == CONNECTED && _dataCb) _dataCb(_dataArg, this, (void*)bytes.data(), bytes.size());
+            return;
+        case EV_PEER_CLOSED:
+            if (_state == CONNECTED) discard(0);
+            return;
+        case EV_POLL:
+            if (_state != CONNECTING && _state != CONNECTED) return;
+            schedule(EV_POLL, kPollIntervalUs);  // cancelled if the callback closes or deletes us
+            if (_pollCb) _pollCb(_pollArg, this);
+            return;
+    }
+}
+
+// --------------------------------------------------------------------------
+// AsyncUDP
+// --------------------------------------------------------------------------
+namespace {
+
+struct PendingDatagram {
+    std::string bytes;
+    uint32_t fromIp;
+    uint16_t fromPort;
+    uint32_t toIp;
+    uint16_t toPort;
+    esp_timer_handle_t timer;
+};
+
+void firePendingDatagram(void* arg) {
+    PendingDatagram* d = static_cast<PendingDatagram*>(arg);
+    std::vector<AsyncUDP*> sockets;
+    {
+        std::lock_guard<std::mutex> lock(gNetMutex);
+        for (AsyncUDP* socket : gUdpSockets) {
+            if (socket->accepts(IPAddress(d->toIp), d->toPort)) sockets.push_back(socket);
+        }
+        if (!sockets.empty()) gNetStats.udpReceived++;
+    }
+    for (AsyncUDP* socket : sockets) {
+        socket->receive(d->bytes, IPAddress(d->fromIp), d->fromPort, IPAddress(d->toIp), d->toPort);
+    }
+    esp_timer_delete(d->timer);
+    delete d;
+}
+
+} // namespace
+
+namespace host {
+
+void deliverUdp(uint32_t fromIp, uint16_t fromPort, uint32_t toIp, uint16_t toPort, const std::string& bytes,
+                uint32_t latencyUs) {
+    PendingDatagram* d = new PendingDatagram{bytes, fromIp, fromPort, toIp, toPort, nullptr};
+    esp_timer_create_args_t args = {};
+    args.callback = &firePendingDatagram;
+    args.arg = d;
+    args.name = "async_udp";
+    esp_timer_create(&args, &d->timer);
+    esp_timer_start_once(d->timer, latencyUs);
+}
+
+} // namespace host
+
+AsyncUDP::~AsyncUDP() { close(); }
+
+bool AsyncUDP::listen(uint16_t port) {
+    close();
+    std::lock_guard<std::mutex> lock(gNetMutex);
+    _port = port;
+    _group = IPAddress();
+    gUdpSockets.push_back(this);
+    return true;
+}
+
+bool AsyncUDP::listenMulticast(const IPAddress addr, uint16_t port, uint8_t) {
+    if (!listen(port)) return false;
+    std::lock_guard<std::mutex> lock(gNetMutex);
+    _group = addr;
+    return true;
+}
+
+void AsyncUDP::close() {
+    std::lock_guard<std::mutex> lock(gNetMutex);
+    gUdpSockets.erase(std::remove(gUdpSockets.begin(), gUdpSockets.end(), this), gUdpSockets.end());
+    _port = 0;
+}
+
+bool AsyncUDP::accepts(IPAddress to, uint16_t port) const {
+    if (_port == 0 || port != _port) return false;
+    return to == _group || to == WiFi.localIP();
+}
+
+size_t AsyncUDP::writeTo(const uint8_t* data, size_t len, const IPAddress addr, uint16_t port) {
+    {
+        std::lock_guard<std::mutex> lock(gNetMutex);
+        gNetStats.udpSent++;
+        gNetStats.udpSentBytes += len;
+    }
+    if (gNetwork) gNetwork->udpSend((uint32_t)addr, port, std::string((const char*)data, len));
+    return len;
+}
+
+void AsyncUDP::receive(const std::string& bytes, IPAddress from, uint16_t fromPort, IPAddress to, uint16_t toPort) {
+    if (!_handler) return;
+    AsyncUDPPacket packet((const uint8_t*)bytes.data(), bytes.size(), from, fromPort, to, toPort);
+    _handler(packet);
+}
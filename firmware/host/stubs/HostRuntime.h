@@ -0,0 +1,115 @@
+#ifndef HOST_RUNTIME_H
+#define HOST_RUNTIME_H
+
+// Host-side runtime hooks behind the Arduino/FreeRTOS stubs.
+//
+// Time is virtual: millis()/micros() read host::Clock, and vTaskDelay()/delay()
+// advance it instead of sleeping. SPI traffic advances it by the modelled wire
+// time, so benchmarks report what the sweep would cost on the ESP32-S3 while
+// running as fast as the host allows.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace host {
+
+class Clock {
+public:
+    static uint64_t nowUs();
+    static void advanceUs(uint64_t us);
+    static void reset(uint64_t us = 0);
+
+    // Wall-clock epoch reported while the virtual clock reads zero.
+    static void setEpochBase(uint32_t epoch);
+    static uint32_t epochBase();
+    static uint64_t epochUs(); // epochBase in us + nowUs()
+};
+
+struct HeapStats {
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytesAllocated = 0;
+    int64_t liveBytes = 0;
+    int64_t peakLiveBytes = 0;
+    int64_t psramLiveBytes = 0;
+};
+
+HeapStats heapStats();
+void resetHeapPeak();
+
+// Modelled latency from an esp_timer deadline to the task blocked on it
+// running again (esp_timer task dispatch plus a context switch).
+static constexpr uint32_t kTimerWakeUs = 25;
+
+static constexpr size_t kInternalHeapBytes = 320 * 1024;
+static constexpr size_t kPsramBytes = 8 * 1024 * 1024;
+
+// SPI peripheral model. A device is bound to an SPIClass bus id; the chip
+// select pin handed to SPIClass::begin() selects it through digitalWrite().
+class SpiDevice {
+public:
+    virtual ~SpiDevice() {}
+    virtual void select() = 0;
+    virtual void deselect() = 0;
+    virtual uint8_t transfer(uint8_t mosi) = 0;
+};
+
+void attachSpiDevice(uint8_t bus, SpiDevice* device);
+SpiDevice* spiDeviceForBus(uint8_t bus);
+
+// GPIO model: outputs may be bound to a chip-select, inputs to a level source.
+void bindChipSelect(uint8_t pin, uint8_t bus);
+void setInputSource(uint8_t pin, std::function<int()> source);
+void writePin(uint8_t pin, uint8_t level);
+int readPin(uint8_t pin);
+
+// Serial echo to stdout (benchmarks mute it).
+void setSerialEcho(bool enabled);
+
+// Network model behind the AsyncTCP stand-in. Connection events are delivered
+// as esp_timer callbacks on the virtual clock, so they run whenever the task
+// driving the benchmark blocks (vTaskDelay, delay, semaphore waits).
+struct TcpConnectPlan {
+    enum Outcome { ACCEPT, REFUSE, SILENT } outcome = SILENT;
+    uint32_t latencyUs = 0;   // SYN to SYN-ACK (or RST)
+};
+
+struct TcpReply {
+    bool respond = false;     // false: the peer never answers
+    uint32_t latencyUs = 0;   // request to first byte
+    std::string bytes;        // sent in MSS-sized segments, then the peer closes
+};
+
+class NetworkModel {
+public:
+    virtual ~NetworkModel() {}
+    virtual TcpConnectPlan connect(uint32_t ip, uint16_t port) = 0;
+    virtual TcpReply request(uint32_t ip, uint16_t port, const std::string& request) = 0;
+    // Datagram sent through the AsyncUDP stand-in (ip may be a multicast group).
+    virtual void udpSend(uint32_t ip, uint16_t port, const std::string& bytes) {}
+};
+
+void attachNetwork(NetworkModel* model);
+NetworkModel* network();
+
+// Datagram from fromIp:fromPort to toIp:toPort (unicast to WiFi.localIP() or
+// a joined group), handed to matching AsyncUDP sockets after latencyUs.
+void deliverUdp(uint32_t fromIp, uint16_t fromPort, uint32_t toIp, uint16_t toPort, const std::string& bytes,
+                uint32_t latencyUs = 0);
+
+// Connections opened through the AsyncTCP stand-in, datagrams through AsyncUDP.
+struct NetStats {
+    uint64_t connects = 0;
+    uint64_t live = 0;
+    uint64_t peakLive = 0;
+    uint64_t udpSent = 0;
+    uint64_t udpSentBytes = 0;
+    uint64_t udpReceived = 0;
+};
+NetStats netStats();
+
+} // namespace host
+
+#endif
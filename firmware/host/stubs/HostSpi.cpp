@@ -0,0 +1,41 @@
+#include "SPI.h"
+
+SPIClass SPI(FSPI);
+
+void SPIClass::begin(int8_t, int8_t miso, int8_t, int8_t ss) {
+    _ss = ss;
+    _miso = miso;
+    if (ss >= 0) {
+        host::bindChipSelect((uint8_t)ss, _bus);
+    }
+}
+
+void SPIClass::beginTransaction(const SPISettings& settings) {
+    _clockHz = settings.clockHz ? settings.clockHz : 1000000;
+}
+
+void SPIClass::endTransaction() {}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+    // 8 clocks per byte plus ~0.25us of inter-byte gap on the ESP32 SPI master.
+    _ns += (8ULL * 1000000000ULL) / _clockHz + 250;
+    host::Clock::advanceUs(_ns / 1000);
+    _ns %= 1000;
+
+    host::SpiDevice* dev = host::spiDeviceForBus(_bus);
+    return dev ? dev->transfer(data) : 0xFF;
+}
+
+void SPIClass::transfer(void* data, uint32_t size) {
+    uint8_t* bytes = static_cast<uint8_t*>(data);
+    for (uint32_t i = 0; i < size; ++i) {
+        bytes[i] = transfer(bytes[i]);
+    }
+}
+
+void SPIClass::transferBytes(const uint8_t* out, uint8_t* in, uint32_t size) {
+    for (uint32_t i = 0; i < size; ++i) {
+        uint8_t r = transfer(out ? out[i] : 0xFF);
+        if (in) in[i] = r;
+    }
+}
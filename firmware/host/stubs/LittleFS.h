@@ -0,0 +1,14 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "Arduino.h"
+
+class LittleFSFS {
+public:
+    bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+    void end() {}
+};
+
+extern LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// In-memory NVS stand-in. Values live for the process lifetime.
+
+#include "Arduino.h"
+#include <map>
+#include <string>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) { (void)name; (void)readOnly; return true; }
+    void end() {}
+    bool clear() { _strings.clear(); _ints.clear(); return true; }
+
+    String getString(const char* key, const String& defaultValue = String()) {
+        auto it = _strings.find(key);
+        return it == _strings.end() ? defaultValue : String(it->second);
+    }
+    size_t putString(const char* key, const String& value) { _strings[key] = value.str(); return value.length(); }
+
+    int32_t getInt(const char* key, int32_t defaultValue = 0) {
+        auto it = _ints.find(key);
+        return it == _ints.end() ? defaultValue : it->second;
+    }
+    size_t putInt(const char* key, int32_t value) { _ints[key] = value; return sizeof(value); }
+
+    bool isKey(const char* key) { return _strings.count(key) || _ints.count(key); }
+    bool remove(const char* key) { return _strings.erase(key) + _ints.erase(key) > 0; }
+
+private:
+    std::map<std::string, std::string> _strings;
+    std::map<std::string, int32_t> _ints;
+};
+
+#endif
@@ -0,0 +1,176 @@
+#include "RadioLib.h"
+
+Module::Module(uint32_t cs, uint32_t irq, uint32_t rst, uint32_t gpio, SPIClass& spi, SPISettings spiSettings)
+    : _cs(cs), _irq(irq), _rst(rst), _gpio(gpio), _spi(spi), _spiSettings(spiSettings) {
+    pinMode((uint8_t)_cs, OUTPUT);
+    digitalWrite((uint8_t)_cs, HIGH);
+}
+
+uint8_t Module::SPItransfer(uint8_t header, const uint8_t* out, uint8_t* in, size_t len) {
+    digitalWrite((uint8_t)_cs, LOW);
+    _spi.beginTransaction(_spiSettings);
+    uint8_t status = _spi.transfer(header);
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t r = _spi.transfer(out ? out[i] : 0x00);
+        if (in) in[i] = r;
+    }
+    _spi.endTransaction();
+    digitalWrite((uint8_t)_cs, HIGH);
+    return status;
+}
+
+CC1101::CC1101(Module* module) : _mod(module) {}
+
+int16_t CC1101::begin(float freq, float br, float freqDev, float rxBw, int8_t pwr, uint8_t preambleLength) {
+    (void)br;
+    (void)freqDev;
+    (void)preambleLength;
+
+    // RadioLib probes the version register up to 10 times before giving up.
+    bool found = false;
+    for (uint8_t i = 0; i < 10 && !found; ++i) {
+        SPIsendCommand(RADIOLIB_CC1101_CMD_RESET);
+        delayMicroseconds(150);
+        int16_t version = SPIgetRegValue(RADIOLIB_CC1101_REG_VERSION);
+        if (version == RADIOLIB_CC1101_VERSION_CURRENT || version == RADIOLIB_CC1101_VERSION_LEGACY || version == 0x17) {
+            found = true;
+        } else {
+            delay(10);
+        }
+    }
+    if (!found) return RADIOLIB_ERR_CHIP_NOT_FOUND;
+
+    // config(): calibrate automatically when going from IDLE to RX/TX
+    int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM0, RADIOLIB_CC1101_FS_AUTOCAL_IDLE_TO_RXTX, 5, 4);
+    if (state != RADIOLIB_ERR_NONE) return state;
+
+    state = setFrequency(freq);
+    if (state != RADIOLIB_ERR_NONE) return state;
+    state = setRxBandwidth(rxBw);
+    if (state != RADIOLIB_ERR_NONE) return state;
+    return setOutputPower(pwr);
+}
+
+int16_t CC1101::setFrequency(float freq) {
+    if (!(((freq >= 300.0f) && (freq <= 348.0f)) ||
+          ((freq >= 387.0f) && (freq <= 464.0f)) ||
+          ((freq >= 779.0f) && (freq <= 928.0f)))) {
+        return RADIOLIB_ERR_INVALID_FREQUENCY;
+    }
+
+    SPIsendCommand(RADIOLIB_CC1101_CMD_IDLE);
+
+    uint32_t frf = (uint32_t)((freq * (float)(1UL << 16)) / RADIOLIB_CC1101_CRYSTAL_FREQ);
+    int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_FREQ2, (frf & 0xFF0000) >> 16, 7, 0);
+    state |= SPIsetRegValue(RADIOLIB_CC1101_REG_FREQ1, (frf & 0x00FF00) >> 8, 7, 0);
+    state |= SPIsetRegValue(RADIOLIB_CC1101_REG_FREQ0, frf & 0x0000FF, 7, 0);
+    if (state == RADIOLIB_ERR_NONE) {
+        _frequency = freq;
+    }
+
+    // PA table depends on the band, so RadioLib re-applies output power.
+    return setOutputPower(_power);
+}
+
+int16_t CC1101::setRxBandwidth(float rxBw) {
+    if (rxBw < 58.0f || rxBw > 812.0f) return RADIOLIB_ERR_INVALID_RX_BANDWIDTH;
+
+    for (int8_t e = 3; e >= 0; e--) {
+        for (int8_t m = 3; m >= 0; m--) {
+            float point = (RADIOLIB_CC1101_CRYSTAL_FREQ * 1000000.0f) / (8 * (m + 4) * ((uint32_t)1 << e));
+            if (fabsf((rxBw * 1000.0f) - point) <= 1000.0f) {
+                return SPIsetRegValue(RADIOLIB_CC1101_REG_MDMCFG4, (uint8_t)((e << 6) | (m << 4)), 7, 4);
+            }
+        }
+    }
+    return RADIOLIB_ERR_INVALID_RX_BANDWIDTH;
+}
+
+int16_t CC1101::setOutputPower(int8_t pwr) {
+    uint8_t raw;
+    switch (pwr) {
+        case -30: raw = 0x03; break;
+        case -20: raw = 0x0E; break;
+        case -15: raw = 0x1E; break;
+        case -10: raw = 0x27; break;
+        case 0: raw = 0x8E; break;
+        case 5: raw = 0x84; break;
+        case 7: raw = 0xCC; break;
+        case 10: raw = 0xC3; break;
+        default: return RADIOLIB_ERR_INVALID_OUTPUT_POWER;
+    }
+    _power = pwr;
+    return SPIsetRegValue(RADIOLIB_CC1101_REG_PATABLE, raw);
+}
+
+int16_t CC1101::standby() {
+    SPIsendCommand(RADIOLIB_CC1101_CMD_IDLE);
+    return RADIOLIB_ERR_NONE;
+}
+
+int16_t CC1101::startReceive() {
+    SPIsendCommand(RADIOLIB_CC1101_CMD_IDLE);
+    SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_RX);
+    SPIsendCommand(RADIOLIB_CC1101_CMD_RX);
+    return RADIOLIB_ERR_NONE;
+}
+
+int16_t CC1101::receiveDirect() {
+    _directModeEnabled = true;
+    SPIsendCommand(RADIOLIB_CC1101_CMD_RX);
+    return RADIOLIB_ERR_NONE;
+}
+
+float CC1101::getRSSI() {
+    // Mirrors RadioLib: in packet mode the value comes from the last received
+    // packet's status bytes; only direct mode reads the live RSSI register.
+    uint8_t raw = _rawRSSI;
+    if (_directModeEnabled) {
+        raw = SPIreadRegister(RADIOLIB_CC1101_REG_RSSI);
+    }
+    if (raw >= 128) {
+        return (((float)raw - 256.0f) / 2.0f) - RADIOLIB_CC1101_DEFAULT_RSSI_OFFSET;
+    }
+    return ((float)raw / 2.0f) - RADIOLIB_CC1101_DEFAULT_RSSI_OFFSET;
+}
+
+int16_t CC1101::SPIgetRegValue(uint8_t reg, uint8_t msb, uint8_t lsb) {
+    if (msb > 7 || lsb > 7 || lsb > msb) return RADIOLIB_ERR_UNKNOWN;
+    uint8_t raw = SPIreadRegister(reg);
+    uint8_t mask = (uint8_t)(~((0xFF << (msb + 1)) | (0xFF >> (8 - lsb))));
+    return raw & mask;
+}
+
+int16_t CC1101::SPIsetRegValue(uint8_t reg, uint8_t value, uint8_t msb, uint8_t lsb, uint8_t checkInterval) {
+    if (msb > 7 || lsb > 7 || lsb > msb) return RADIOLIB_ERR_UNKNOWN;
+    uint8_t current = SPIreadRegister(reg);
+    uint8_t mask = (uint8_t)(~((0xFF << (msb + 1)) | (0xFF >> (8 - lsb))));
+    uint8_t next = (current & ~mask) | (value & mask);
+    SPIwriteRegister(reg, next);
+
+    delayMicroseconds(checkInterval);
+    uint8_t readback = SPIreadRegister(reg);
+    return (readback & mask) == (next & mask) ? RADIOLIB_ERR_NONE : RADIOLIB_ERR_SPI_WRITE_FAILED;
+}
+
+uint8_t CC1101::SPIreadRegister(uint8_t reg) {
+    uint8_t header = reg | RADIOLIB_CC1101_CMD_READ;
+    if (reg >= RADIOLIB_CC1101_REG_PARTNUM && reg <= RADIOLIB_CC1101_REG_RXBYTES) {
+        header |= RADIOLIB_CC1101_CMD_BURST;
+    }
+    uint8_t value = 0;
+    _mod->SPItransfer(header, nullptr, &value, 1);
+    return value;
+}
+
+void CC1101::SPIwriteRegister(uint8_t reg, uint8_t data) {
+    _mod->SPItransfer(reg | RADIOLIB_CC1101_CMD_WRITE, &data, nullptr, 1);
+}
+
+void CC1101::SPIwriteRegisterBurst(uint8_t reg, const uint8_t* data, size_t len) {
+    _mod->SPItransfer(reg | RADIOLIB_CC1101_CMD_WRITE | RADIOLIB_CC1101_CMD_BURST, data, nullptr, len);
+}
+
+void CC1101::SPIsendCommand(uint8_t cmd) {
+    _mod->SPItransfer(cmd | RADIOLIB_CC1101_CMD_WRITE, nullptr, nullptr, 0);
+}
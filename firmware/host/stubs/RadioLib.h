@@ -0,0 +1,168 @@
+#ifndef HOST_RADIOLIB_H
+#define HOST_RADIOLIB_H
+
+// Host stand-in for RadioLib's CC1101 driver.
+//
+// Public methods reproduce the SPI traffic RadioLib 6/7 generates for the
+// same calls (strobes, read-modify-write register updates with verify), so a
+// register-level device model on the other end of SPIClass sees realistic
+// load. Register names match RadioLib's CC1101.h.
+
+#include "Arduino.h"
+#include "SPI.h"
+
+#define RADIOLIB_NC (0xFFFFFFFF)
+
+#define RADIOLIB_ERR_NONE (0)
+#define RADIOLIB_ERR_UNKNOWN (-1)
+#define RADIOLIB_ERR_CHIP_NOT_FOUND (-2)
+#define RADIOLIB_ERR_INVALID_BANDWIDTH (-8)
+#define RADIOLIB_ERR_INVALID_FREQUENCY (-12)
+#define RADIOLIB_ERR_INVALID_OUTPUT_POWER (-13)
+#define RADIOLIB_ERR_SPI_WRITE_FAILED (-16)
+#define RADIOLIB_ERR_INVALID_RX_BANDWIDTH (-104)
+
+#define RADIOLIB_CC1101_CRYSTAL_FREQ (26.0f)
+#define RADIOLIB_CC1101_DEFAULT_RSSI_OFFSET (74)
+
+// SPI header bits
+#define RADIOLIB_CC1101_CMD_READ (0x80)
+#define RADIOLIB_CC1101_CMD_WRITE (0x00)
+#define RADIOLIB_CC1101_CMD_BURST (0x40)
+
+// Command strobes
+#define RADIOLIB_CC1101_CMD_RESET (0x30)
+#define RADIOLIB_CC1101_CMD_FSTXON (0x31)
+#define RADIOLIB_CC1101_CMD_XOFF (0x32)
+#define RADIOLIB_CC1101_CMD_CAL (0x33)
+#define RADIOLIB_CC1101_CMD_RX (0x34)
+#define RADIOLIB_CC1101_CMD_TX (0x35)
+#define RADIOLIB_CC1101_CMD_IDLE (0x36)
+#define RADIOLIB_CC1101_CMD_WOR (0x38)
+#define RADIOLIB_CC1101_CMD_POWER_DOWN (0x39)
+#define RADIOLIB_CC1101_CMD_FLUSH_RX (0x3A)
+#define RADIOLIB_CC1101_CMD_FLUSH_TX (0x3B)
+#define RADIOLIB_CC1101_CMD_WOR_RESET (0x3C)
+#define RADIOLIB_CC1101_CMD_NOP (0x3D)
+
+// Configuration registers
+#define RADIOLIB_CC1101_REG_IOCFG2 (0x00)
+#define RADIOLIB_CC1101_REG_IOCFG1 (0x01)
+#define RADIOLIB_CC1101_REG_IOCFG0 (0x02)
+#define RADIOLIB_CC1101_REG_FIFOTHR (0x03)
+#define RADIOLIB_CC1101_REG_PKTLEN (0x06)
+#define RADIOLIB_CC1101_REG_PKTCTRL1 (0x07)
+#define RADIOLIB_CC1101_REG_PKTCTRL0 (0x08)
+#define RADIOLIB_CC1101_REG_CHANNR (0x0A)
+#define RADIOLIB_CC1101_REG_FSCTRL1 (0x0B)
+#define RADIOLIB_CC1101_REG_FSCTRL0 (0x0C)
+#define RADIOLIB_CC1101_REG_FREQ2 (0x0D)
+#define RADIOLIB_CC1101_REG_FREQ1 (0x0E)
+#define RADIOLIB_CC1101_REG_FREQ0 (0x0F)
+#define RADIOLIB_CC1101_REG_MDMCFG4 (0x10)
+#define RADIOLIB_CC1101_REG_MDMCFG3 (0x11)
+#define RADIOLIB_CC1101_REG_MDMCFG2 (0x12)
+#define RADIOLIB_CC1101_REG_MDMCFG1 (0x13)
+#define RADIOLIB_CC1101_REG_MDMCFG0 (0x14)
+#define RADIOLIB_CC1101_REG_DEVIATN (0x15)
+#define RADIOLIB_CC1101_REG_MCSM2 (0x16)
+#define RADIOLIB_CC1101_REG_MCSM1 (0x17)
+#define RADIOLIB_CC1101_REG_MCSM0 (0x18)
+#define RADIOLIB_CC1101_REG_FOCCFG (0x19)
+#define RADIOLIB_CC1101_REG_BSCFG (0x1A)
+#define RADIOLIB_CC1101_REG_AGCCTRL2 (0x1B)
+#define RADIOLIB_CC1101_REG_AGCCTRL1 (0x1C)
+#define RADIOLIB_CC1101_REG_AGCCTRL0 (0x1D)
+#define RADIOLIB_CC1101_REG_FREND1 (0x21)
+#define RADIOLIB_CC1101_REG_FREND0 (0x22)
+#define RADIOLIB_CC1101_REG_FSCAL3 (0x23)
+#define RADIOLIB_CC1101_REG_FSCAL2 (0x24)
+#define RADIOLIB_CC1101_REG_FSCAL1 (0x25)
+#define RADIOLIB_CC1101_REG_FSCAL0 (0x26)
+#define RADIOLIB_CC1101_REG_TEST2 (0x2C)
+#define RADIOLIB_CC1101_REG_TEST1 (0x2D)
+#define RADIOLIB_CC1101_REG_TEST0 (0x2E)
+
+// Status registers (read with the burst bit set)
+#define RADIOLIB_CC1101_REG_PARTNUM (0x30)
+#define RADIOLIB_CC1101_REG_VERSION (0x31)
+#define RADIOLIB_CC1101_REG_FREQEST (0x32)
+#define RADIOLIB_CC1101_REG_LQI (0x33)
+#define RADIOLIB_CC1101_REG_RSSI (0x34)
+#define RADIOLIB_CC1101_REG_MARCSTATE (0x35)
+#define RADIOLIB_CC1101_REG_PKTSTATUS (0x38)
+#define RADIOLIB_CC1101_REG_RXBYTES (0x3B)
+
+#define RADIOLIB_CC1101_REG_PATABLE (0x3E)
+#define RADIOLIB_CC1101_REG_FIFO (0x3F)
+
+#define RADIOLIB_CC1101_VERSION_CURRENT (0x14)
+#define RADIOLIB_CC1101_VERSION_LEGACY (0x04)
+
+// MCSM0.FS_AUTOCAL
+#define RADIOLIB_CC1101_FS_AUTOCAL_NEVER (0b00000000)
+#define RADIOLIB_CC1101_FS_AUTOCAL_IDLE_TO_RXTX (0b00010000)
+
+// MARCSTATE values
+#define RADIOLIB_CC1101_MARC_STATE_IDLE (0x01)
+#define RADIOLIB_CC1101_MARC_STATE_MANCAL (0x05)
+#define RADIOLIB_CC1101_MARC_STATE_FS_LOCK (0x0A)
+#define RADIOLIB_CC1101_MARC_STATE_RX (0x0D)
+
+class Module {
+public:
+    Module(uint32_t cs, uint32_t irq, uint32_t rst, uint32_t gpio, SPIClass& spi,
+           SPISettings spiSettings = SPISettings(2000000, MSBFIRST, SPI_MODE0));
+
+    uint32_t getCs() const { return _cs; }
+    uint32_t getIrq() const { return _irq; }
+    uint32_t getGpio() const { return _gpio; }
+    SPIClass& getSpi() { return _spi; }
+
+    // One chip-select framed transaction: header byte then len payload bytes.
+    uint8_t SPItransfer(uint8_t header, const uint8_t* out, uint8_t* in, size_t len);
+
+private:
+    uint32_t _cs;
+    uint32_t _irq;
+    uint32_t _rst;
+    uint32_t _gpio;
+    SPIClass& _spi;
+    SPISettings _spiSettings;
+};
+
+class CC1101 {
+public:
+    explicit CC1101(Module* module);
+
+    int16_t begin(float freq = 434.0, float br = 4.8, float freqDev = 5.0, float rxBw = 135.0,
+                  int8_t pwr = 10, uint8_t preambleLength = 16);
+
+    int16_t setFrequency(float freq);
+    int16_t setRxBandwidth(float rxBw);
+    int16_t setOutputPower(int8_t pwr);
+    int16_t standby();
+    int16_t startReceive();
+    int16_t receiveDirect();
+
+    float getRSSI();
+    Module* getMod() { return _mod; }
+
+    // Low-level access (RadioLib exposes these with RADIOLIB_LOW_LEVEL)
+    int16_t SPIgetRegValue(uint8_t reg, uint8_t msb = 7, uint8_t lsb = 0);
+    int16_t SPIsetRegValue(uint8_t reg, uint8_t value, uint8_t msb = 7, uint8_t lsb = 0,
+                           uint8_t checkInterval = 2);
+    uint8_t SPIreadRegister(uint8_t reg);
+    void SPIwriteRegister(uint8_t reg, uint8_t data);
+    void SPIwriteRegisterBurst(uint8_t reg, const uint8_t* data, size_t len);
+    void SPIsendCommand(uint8_t cmd);
+
+private:
+    Module* _mod;
+    float _frequency = 434.0f;
+    int8_t _power = 10;
+    uint8_t _rawRSSI = 0;
+    bool _directModeEnabled = false;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0x00
+
+#define FSPI 0
+#define HSPI 1
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clockHz(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+    uint32_t clockHz;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+// Routes bytes to the host::SpiDevice attached to this bus and advances the
+// virtual clock by the wire time at the active SPISettings clock.
+class SPIClass {
+public:
+    explicit SPIClass(uint8_t bus = FSPI) : _bus(bus) {}
+
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1);
+    void end() {}
+    void beginTransaction(const SPISettings& settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+    void transfer(void* data, uint32_t size);
+    void transferBytes(const uint8_t* out, uint8_t* in, uint32_t size);
+
+    uint8_t bus() const { return _bus; }
+    int8_t ssPin() const { return _ss; }
+    int8_t misoPin() const { return _miso; }
+
+private:
+    uint8_t _bus;
+    int8_t _ss = -1;
+    int8_t _miso = -1;
+    uint32_t _clockHz = 1000000;
+    uint64_t _ns = 0; // sub-microsecond wire time carried between bytes
+};
+
+extern SPIClass SPI;
+
+#endif
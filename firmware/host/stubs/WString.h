@@ -0,0 +1,144 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+// Host stand-in for the Arduino core String class.
+// Backed by std::string; only the subset used by the firmware is provided.
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class String {
+public:
+    String() {}
+    String(const char* s) : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int v, unsigned char base = 10) { fromInteger((long long)v, base); }
+    String(unsigned int v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(long v, unsigned char base = 10) { fromInteger((long long)v, base); }
+    String(unsigned long v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(long long v, unsigned char base = 10) { fromInteger(v, base); }
+    String(unsigned long long v, unsigned char base = 10) { fromUnsigned(v, base); }
+    String(float v, unsigned int decimals = 2) { fromFloat(v, decimals); }
+    String(double v, unsigned int decimals = 2) { fromFloat(v, decimals); }
+
+    unsigned int length() const { return (unsigned int)_s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    const char* c_str() const { return _s.c_str(); }
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+    char operator[](unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+    char& operator[](unsigned int i) { return _s[i]; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+
+    String& operator+=(const String& rhs) { _s += rhs._s; return *this; }
+    String& operator+=(const char* rhs) { if (rhs) _s += rhs; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    template <typename T>
+    String& operator+=(T v) { _s += String(v)._s; return *this; }
+    bool concat(const String& rhs) { _s += rhs._s; return true; }
+    bool concat(const char* rhs) { if (rhs) _s += rhs; return true; }
+    bool concat(const char* rhs, unsigned int len) { if (rhs) _s.append(rhs, len); return true; }
+    bool concat(char c) { _s += c; return true; }
+
+    bool equals(const String& rhs) const { return _s == rhs._s; }
+    bool equalsIgnoreCase(const String& rhs) const {
+        if (_s.size() != rhs._s.size()) return false;
+        for (size_t i = 0; i < _s.size(); ++i) {
+            if (std::tolower((unsigned char)_s[i]) != std::tolower((unsigned char)rhs._s[i])) return false;
+        }
+        return true;
+    }
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return _s.size() >= suffix._s.size() &&
+               _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t p = _s.find(c, from);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    int indexOf(const String& s, unsigned int from = 0) const {
+        size_t p = _s.find(s._s, from);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    int lastIndexOf(char c) const {
+        size_t p = _s.rfind(c);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    String substring(unsigned int from) const { return from >= _s.size() ? String() : String(_s.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= _s.size()) return String();
+        return String(_s.substr(from, to - from));
+    }
+
+    void trim() {
+        size_t b = 0;
+        while (b < _s.size() && std::isspace((unsigned char)_s[b])) b++;
+        size_t e = _s.size();
+        while (e > b && std::isspace((unsigned char)_s[e - 1])) e--;
+        _s = _s.substr(b, e - b);
+    }
+    void toLowerCase() { for (auto& c : _s) c = (char)std::tolower((unsigned char)c); }
+    void toUpperCase() { for (auto& c : _s) c = (char)std::toupper((unsigned char)c); }
+    void replace(const String& find, const String& with) {
+        if (find._s.empty()) return;
+        size_t p = 0;
+        while ((p = _s.find(find._s, p)) != std::string::npos) {
+            _s.replace(p, find._s.size(), with._s);
+            p += with._s.size();
+        }
+    }
+
+    long toInt() const { return std::strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return std::strtof(_s.c_str(), nullptr); }
+    double toDouble() const { return std::strtod(_s.c_str(), nullptr); }
+
+    const std::string& str() const { return _s; }
+
+    friend bool operator==(const String& a, const String& b) { return a._s == b._s; }
+    friend bool operator==(const String& a, const char* b) { return a._s == (b ? b : ""); }
+    friend bool operator==(const char* a, const String& b) { return b == a; }
+    friend bool operator!=(const String& a, const String& b) { return !(a == b); }
+    friend bool operator!=(const String& a, const char* b) { return !(a == b); }
+    friend bool operator!=(const char* a, const String& b) { return !(b == a); }
+    friend bool operator<(const String& a, const String& b) { return a._s < b._s; }
+
+    friend String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+    friend String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+    friend String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+    friend String operator+(const String& a, char b) { String r(a); r += b; return r; }
+
+private:
+    std::string _s;
+
+    void fromInteger(long long v, unsigned char base) {
+        if (base == 10) { _s = std::to_string(v); return; }
+        if (v < 0) { _s = "-"; fromUnsignedAppend((unsigned long long)(-v), base); return; }
+        fromUnsigned((unsigned long long)v, base);
+    }
+    void fromUnsigned(unsigned long long v, unsigned char base) { _s.clear(); fromUnsignedAppend(v, base); }
+    void fromUnsignedAppend(unsigned long long v, unsigned char base) {
+        char buf[72];
+        int i = 70;
+        buf[71] = 0;
+        do {
+            int d = (int)(v % base);
+            buf[i--] = (char)(d < 10 ? '0' + d : 'a' + d - 10);
+            v /= base;
+        } while (v && i >= 0);
+        _s += &buf[i + 1];
+    }
+    void fromFloat(double v, unsigned int decimals) {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        _s = buf;
+    }
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include "Arduino.h"
+
+class IPAddress {
+public:
+    IPAddress() : _addr{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr{a, b, c, d} {}
+    explicit IPAddress(uint32_t raw) {
+        for (int i = 0; i < 4; ++i) _addr[i] = (uint8_t)(raw >> (8 * i));
+    }
+    uint8_t operator[](int i) const { return _addr[i]; }
+    uint8_t& operator[](int i) { return _addr[i]; }
+    operator uint32_t() const {
+        return (uint32_t)_addr[0] | ((uint32_t)_addr[1] << 8) | ((uint32_t)_addr[2] << 16) | ((uint32_t)_addr[3] << 24);
+    }
+    bool operator==(const IPAddress& o) const { return (uint32_t)*this == (uint32_t)o; }
+    bool operator!=(const IPAddress& o) const { return !(*this == o); }
+    bool fromString(const String& s) {
+        unsigned a, b, c, d;
+        if (std::sscanf(s.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) != 4) return false;
+        if (a > 255 || b > 255 || c > 255 || d > 255) return false;
+        _addr[0] = (uint8_t)a; _addr[1] = (uint8_t)b; _addr[2] = (uint8_t)c; _addr[3] = (uint8_t)d;
+        return true;
+    }
+    String toString() const {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr[0], _addr[1], _addr[2], _addr[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t _addr[4];
+};
+
+#define WL_CONNECTED 3
+#define WIFI_STA 1
+
+class WiFiClass {
+public:
+    bool isConnected() { return true; }
+    int status() { return WL_CONNECTED; }
+    IPAddress localIP() { return _local; }
+    IPAddress subnetMask() { return _mask; }
+    IPAddress gatewayIP() { return _gateway; }
+    // Host only: the station address the benchmarks run on.
+    void setHostNetwork(IPAddress local, IPAddress mask, IPAddress gateway) {
+        _local = local;
+        _mask = mask;
+        _gateway = gateway;
+    }
+    bool setHostname(const char*) { return true; }
+    bool mode(int) { return true; }
+
+private:
+    IPAddress _local{192, 168, 1, 50};
+    IPAddress _mask{255, 255, 255, 0};
+    IPAddress _gateway{192, 168, 1, 1};
+};
+
+extern WiFiClass WiFi;
+
+#endif
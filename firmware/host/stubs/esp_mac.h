@@ -0,0 +1,20 @@
+#ifndef HOST_ESP_MAC_H
+#define HOST_ESP_MAC_H
+
+#include <cstdint>
+
+typedef enum {
+    ESP_MAC_WIFI_STA,
+    ESP_MAC_WIFI_SOFTAP,
+    ESP_MAC_BT,
+    ESP_MAC_ETH
+} esp_mac_type_t;
+
+inline int esp_read_mac(uint8_t* mac, esp_mac_type_t type) {
+    const uint8_t base[6] = {0x24, 0x6F, 0x28, 0xA5, 0xE0, 0x01};
+    for (int i = 0; i < 6; ++i) mac[i] = base[i];
+    mac[5] = (uint8_t)(mac[5] + (uint8_t)type);
+    return 0;
+}
+
+#endif
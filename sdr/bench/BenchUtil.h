@@ -0,0 +1,71 @@
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+// What the aggregator benchmarks share: percentiles over their samples and
+// the argument loop around each bench's own options.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Nearest-rank percentile; p = 100 is the maximum
+template <typename T>
+T percentile(std::vector<T> v, double p) {
+    if (v.empty()) return T();
+    std::sort(v.begin(), v.end());
+    size_t idx = (size_t)std::ceil(p / 100.0 * (double)v.size());
+    if (idx > 0) idx--;
+    return v[std::min(idx, v.size() - 1)];
+}
+
+// The command line as a bench's option handler sees it
+class Args {
+public:
+    Args(int argc, char** argv) : _argc(argc), _argv(argv), _i(0) {}
+
+    bool next() { return ++_i < _argc; }
+    const char* arg() const { return _argv[_i]; }
+
+    // The value after the current option; exits if there is none
+    const char* value() {
+        if (_i + 1 >= _argc) {
+            std::fprintf(stderr, "missing value for %s\n", _argv[_i]);
+            std::exit(2);
+        }
+        return _argv[++_i];
+    }
+
+private:
+    int _argc;
+    char** _argv;
+    int _i;
+};
+
+// Hands each argument to option(arg, args), which returns false for one the
+// bench does not take. --help and -h print usage and exit. Returns false on
+// an unknown argument; the caller checks the values.
+template <typename Option>
+bool parseArgs(int argc, char** argv, void (*usage)(), Option option) {
+    Args args(argc, argv);
+    while (args.next()) {
+        std::string a = args.arg();
+        if (a == "--help" || a == "-h") {
+            usage();
+            std::exit(0);
+        }
+        if (!option(a, args)) {
+            std::fprintf(stderr, "unknown argument: %s\n", a.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,452 @@
+// Ingest benchmark for the aggregation daemon.
+//
+// Runs the real NodeCollector, ClusterAggregator and CompositeServer on one
+// EventLoop against ReplayNodes: --nodes simulated nodes on loopback, each
+// replaying recorded sweeps over HTTP. The recording is --replay FILE (as
+// written by `ase_aggregatord --record`), or one synthesized here: a few
+// recording nodes scattered over a 200 m square, a noise floor and three
+// emitters of different power and duty, received with log-distance path
+// loss. Every round moves all nodes to a new slot, polls them all at once
+// and waits for every frame; a stream client follows /api/composite/stream.
+// Reports:
+//   - HTTP ingest: frames/s and MB/s over the rounds, round latency (poll of
+//     every node to the last frame in the cube) p50/p99/max;
+//   - in-process ingest: decode + align + cube write, frames/s and bins/s,
+//     without the network;
+//   - checks: every slot's max composite against one computed here from the
+//     frames the nodes served, the streamed rows against the composites, and
+//     the cube reopened from disk after the daemon side is gone.
+//
+// Usage: ingest_bench [--nodes N] [--rounds N] [--replay FILE] [--bins N] [--inproc-slots N] [--min-fps F] [--seed N] [--verbose]
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <netinet/in.h>
+#include <random>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+#include "BenchUtil.h"
+#include "ClusterAggregator.h"
+#include "CompositeServer.h"
+#include "EventLoop.h"
+#include "NodeCollector.h"
+#include "ReplayLog.h"
+#include "ReplayNodes.h"
+
+namespace {
+
+struct Options {
+    int nodes = 64;
+    int rounds = 30;
+    std::string replay;
+    int bins = 200;
+    int inprocSlots = 200;
+    double minFps = 0;
+    uint32_t seed = 7;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: ingest_bench [--nodes N] [--rounds N] [--replay FILE] [--bins N] [--inproc-slots N] [--min-fps F] [--seed N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--nodes") opt.nodes = std::atoi(args.value());
+        else if (a == "--rounds") opt.rounds = std::atoi(args.value());
+        else if (a == "--replay") opt.replay = args.value();
+        else if (a == "--bins") opt.bins = std::atoi(args.value());
+        else if (a == "--inproc-slots") opt.inprocSlots = std::atoi(args.value());
+        else if (a == "--min-fps") opt.minFps = std::atof(args.value());
+        else if (a == "--seed") opt.seed = (uint32_t)std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.nodes >= 1 && opt.nodes <= kCubeMaxNodes && opt.rounds >= 1 && opt.bins >= 2 &&
+           opt.bins <= kFrameMaxBins && opt.inprocSlots >= 1;
+}
+
+const uint32_t kBaseEpoch = 1700000000;
+const uint32_t kSlotSeconds = 10;
+const int kRecordingNodes = 6;
+const int kRecordedSweeps = 4;
+
+// Sweeps of kRecordingNodes nodes, kRecordedSweeps each, on a 12.5 kHz grid
+// from 433.000 MHz.
+void synthesize(const Options& opt, const std::string& path) {
+    struct Emitter {
+        double x, y;
+        double mhz;
+        double dbm;              // at 1 m
+        int halfWidth;           // bins either side of the peak
+        int period;              // on every period-th sweep
+    };
+    const Emitter emitters[] = {
+        {40, 60, 433.920, -10, 3, 1},
+        {170, 30, 433.450, 0, 1, 2},
+        {100, 180, 434.200, -20, 6, 3},
+    };
+    std::mt19937 rng(opt.seed);
+    std::uniform_real_distribution<double> pos(0, 200), noise(0, 3);
+
+    ReplayWriter writer;
+    writer.open(path);
+    std::vector<uint8_t> bytes;
+    for (int n = 0; n < kRecordingNodes; ++n) {
+        double x = pos(rng), y = pos(rng);
+        for (int s = 0; s < kRecordedSweeps; ++s) {
+            SweepFrame f;
+            const uint8_t id[6] = {0x24, 0x6f, 0x28, 0x00, 0x00, (uint8_t)n};
+            memcpy(f.nodeId, id, sizeof(id));
+            f.seq = (uint16_t)s;
+            f.startKhz = 433000;
+            f.stepHz = 12500;
+            f.cdb.resize((size_t)opt.bins);
+            for (int b = 0; b < opt.bins; ++b) {
+                double dbm = -105.0 + noise(rng);
+                double mhz = 433.0 + b * 0.0125;
+                for (const Emitter& e : emitters) {
+                    if ((s + 1) % e.period != 0) continue;
+                    int off = (int)std::lround((mhz - e.mhz) / 0.0125);
+                    if (std::abs(off) > e.halfWidth) continue;
+                    double d = std::max(1.0, std::hypot(x - e.x, y - e.y));
+                    double rx = e.dbm - 40.0 - 27.0 * std::log10(d) - 3.0 * std::abs(off);
+                    dbm = std::max(dbm, rx);
+                }
+                f.cdb[(size_t)b] = (int16_t)std::lround(dbm * 100.0);
+            }
+            bytes.clear();
+            encodeSpectrumFrame(f, kFrameBinsInt16, bytes);
+            writer.append(bytes.data(), bytes.size(), 1700000000000ULL + (uint64_t)s * 10000ULL);
+        }
+    }
+}
+
+// Body of a chunked response, without the head; false if malformed.
+bool dechunk(const std::string& raw, std::vector<std::string>& chunks) {
+    size_t pos = raw.find("\r\n\r\n");
+    if (pos == std::string::npos) return false;
+    pos += 4;
+    while (pos < raw.size()) {
+        size_t eol = raw.find("\r\n", pos);
+        if (eol == std::string::npos) return true;   // cut mid-stream
+        size_t size = std::strtoul(raw.c_str() + pos, nullptr, 16);
+        if (eol + 2 + size + 2 > raw.size()) return true;
+        chunks.push_back(raw.substr(eol + 2, size));
+        pos = eol + 2 + size + 2;
+        if (size == 0) break;
+    }
+    return true;
+}
+
+// Expected max composite of one slot: the strongest bin any node served.
+// Frames off the cube grid are counted and left out.
+bool expectedMax(const ReplayNodes& sim, const CubeGeometry& g, uint32_t epoch, uint16_t seq, std::vector<int16_t>& out,
+                 int& offGrid) {
+    out.assign(g.bins, kCubeMissing);
+    SweepFrame f;
+    for (size_t i = 0; i < sim.size(); ++i) {
+        sim.frameFor(i, epoch, seq, f);
+        if (f.startKhz != g.startKhz || f.stepHz != g.stepHz || f.cdb.size() > g.bins) {
+            offGrid++;
+            return false;
+        }
+        for (size_t b = 0; b < f.cdb.size(); ++b) out[b] = std::max(out[b], f.cdb[b]);
+    }
+    return true;
+}
+
+int connectStream(uint16_t port, const char* path) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_in sa{};
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (fd < 0 || connect(fd, (sockaddr*)&sa, sizeof(sa)) != 0) return -1;
+    std::string req = std::string("GET ") + path + " HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+    if (send(fd, req.data(), req.size(), MSG_NOSIGNAL) != (ssize_t)req.size()) return -1;
+    EventLoop::setNonBlocking(fd);
+    return fd;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+
+    char dirTemplate[] = "/tmp/ingest_bench.XXXXXX";
+    if (!mkdtemp(dirTemplate)) {
+        std::printf("FAIL: no temporary directory\n");
+        return 1;
+    }
+    const std::string dir = dirTemplate;
+    const std::string replayPath = opt.replay.empty() ? dir + "/recorded.aser" : opt.replay;
+    const std::string cubePath = dir + "/cube.bin";
+    const std::string inprocCubePath = dir + "/inproc.bin";
+    if (opt.replay.empty()) synthesize(opt, replayPath);
+
+    std::vector<ReplayRecord> recorded;
+    if (!loadReplay(replayPath, recorded) || recorded.empty()) {
+        std::printf("FAIL: cannot load %s\n", replayPath.c_str());
+        return 1;
+    }
+    ReplayNodes sim;
+    if (!sim.start(recorded, (size_t)opt.nodes)) {
+        std::printf("FAIL: cannot start %d replay nodes\n", opt.nodes);
+        return 1;
+    }
+    SweepFrame first;
+    for (const ReplayRecord& r : recorded) {
+        if (decodeSpectrumFrame(r.frame.data(), r.frame.size(), first)) break;
+    }
+
+    CubeGeometry geometry;
+    geometry.startKhz = first.startKhz;
+    geometry.stepHz = first.stepHz;
+    geometry.bins = (uint16_t)first.cdb.size();
+    geometry.nodes = (uint16_t)std::max(64, opt.nodes);
+    geometry.slots = (uint32_t)std::max(64, opt.rounds);
+    geometry.slotSeconds = kSlotSeconds;
+
+    std::printf("ingest_bench: %d replay nodes over HTTP (%zu recorded sweeps), %d rounds, grid %u bins of %u Hz from %.3f MHz\n",
+                opt.nodes, recorded.size(), opt.rounds, geometry.bins, geometry.stepHz, geometry.startKhz / 1000.0);
+
+    bool ok = true;
+    std::vector<uint32_t> roundUs;
+    uint64_t httpUs = 0, httpBytes = 0, httpFrames = 0, fetchFailures = 0;
+    int mismatched = 0, offGrid = 0, streamRows = 0, streamBad = 0, timeouts = 0;
+    std::map<uint32_t, std::vector<int16_t>> expected;
+    IngestStats httpStats;
+    uint64_t rowsDropped = 0;
+
+    {
+        EventLoop loop;
+        ClusterAggregator aggregator;
+        if (!aggregator.begin(cubePath, geometry)) {
+            std::printf("FAIL: %s\n", aggregator.error().c_str());
+            return 1;
+        }
+        NodeCollector collector(loop, aggregator);
+        collector.setPollInterval(3600 * 1000);   // rounds poll explicitly
+        for (size_t i = 0; i < sim.size(); ++i) collector.addNode(sim.address(i));
+        CompositeServer server(loop, aggregator, &collector);
+        if (!server.begin(0, "127.0.0.1")) {
+            std::printf("FAIL: composite server did not listen\n");
+            return 1;
+        }
+        aggregator.onSlotClosed([&server](uint32_t epoch) { server.publish(epoch); });
+
+        std::string streamRaw;
+        int streamFd = connectStream(server.port(), "/api/composite/stream?reduce=max");
+        if (streamFd >= 0) {
+            loop.add(streamFd, EPOLLIN, [&](uint32_t) {
+                char buf[16384];
+                ssize_t n;
+                while ((n = recv(streamFd, buf, sizeof(buf), 0)) > 0) streamRaw.append(buf, (size_t)n);
+            });
+        }
+        for (int i = 0; i < 20; ++i) loop.run(5);   // the server accepts the stream client
+
+        for (int r = 0; r < opt.rounds; ++r) {
+            uint32_t epoch = kBaseEpoch + (uint32_t)r * kSlotSeconds;
+            uint16_t seq = (uint16_t)(r + 1);
+            sim.setSlot(epoch, seq);
+            uint64_t target = collector.framesIngested() + sim.size();
+            uint64_t t0 = EventLoop::nowUs();
+            collector.pollAll();
+            while (collector.framesIngested() < target || !collector.idle()) {
+                collector.loop(EventLoop::nowMs());
+                loop.run(1);
+                if (EventLoop::nowUs() - t0 > 5000000ULL) {
+                    timeouts++;
+                    break;
+                }
+            }
+            uint64_t us = EventLoop::nowUs() - t0;
+            roundUs.push_back((uint32_t)us);
+            httpUs += us;
+            aggregator.closeSlots(epoch, kSlotSeconds);   // closes only when every node reported
+
+            std::vector<int16_t>& want = expected[epoch];
+            if (!expectedMax(sim, geometry, epoch, seq, want, offGrid)) {
+                expected.erase(epoch);
+                continue;
+            }
+            CompositeRow row;
+            if (!aggregator.composite(epoch, COMPOSITE_MAX, row) || row.values != want ||
+                row.reporting != sim.size()) {
+                mismatched++;
+                if (opt.verbose) std::printf("slot %u: composite differs (%u reporting)\n", epoch, row.reporting);
+            }
+        }
+        for (int i = 0; i < 40; ++i) loop.run(5);   // drain the stream
+
+        for (const CollectorNode& n : collector.nodes()) {
+            httpBytes += n.bytes;
+            fetchFailures += n.failed;
+        }
+        httpFrames = collector.framesIngested();
+        httpStats = aggregator.stats();
+        rowsDropped = server.rowsDropped();
+
+        std::vector<std::string> chunks;
+        if (streamFd < 0 || !dechunk(streamRaw, chunks) || chunks.empty() || chunks[0].size() != kCompositeHeaderBytes ||
+            chunks[0].compare(0, 4, "ASEM") != 0) {
+            streamBad++;
+        } else {
+            const size_t rowBytes = 8 + 2 * (size_t)geometry.bins;
+            for (size_t c = 1; c < chunks.size(); ++c) {
+                const std::string& ch = chunks[c];
+                if (ch.size() != rowBytes) {
+                    streamBad++;
+                    continue;
+                }
+                uint32_t epoch;
+                memcpy(&epoch, ch.data(), 4);
+                std::vector<int16_t> values(geometry.bins);
+                memcpy(values.data(), ch.data() + 8, 2 * (size_t)geometry.bins);
+                auto it = expected.find(epoch);
+                if (it != expected.end() && it->second != values) streamBad++;
+                streamRows++;
+            }
+        }
+        if (streamFd >= 0) {
+            loop.remove(streamFd);
+            close(streamFd);
+        }
+    }
+    sim.stop();
+
+    // The cube outlives the daemon: reopen it, adopting its geometry
+    int reopenBad = 0;
+    {
+        SpectrumCube cube;
+        CubeGeometry adopt;
+        adopt.bins = 0;
+        if (!cube.open(cubePath, adopt) || !cube.geometry().sameAs(geometry)) {
+            reopenBad = 1;
+        } else {
+            for (const auto& kv : expected) {
+                const CubeSlot* slot = cube.findSlot(kv.first);
+                if (!slot || slot->reported != (uint16_t)opt.nodes) {
+                    reopenBad++;
+                    continue;
+                }
+                for (uint16_t b = 0; b < geometry.bins; ++b) {
+                    const int16_t* col = cube.column(slot, b);
+                    int16_t m = kCubeMissing;
+                    for (uint16_t n = 0; n < geometry.nodes; ++n) m = std::max(m, col[n]);
+                    if (m != kv.second[b]) {
+                        reopenBad++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // In process: decode + align + write, the same frames without the network
+    double inprocFps = 0, inprocBps = 0;
+    {
+        const int distinct = 16;
+        std::vector<std::vector<uint8_t>> frames((size_t)distinct * (size_t)opt.nodes);
+        SweepFrame f;
+        for (int s = 0; s < distinct; ++s) {
+            for (int i = 0; i < opt.nodes; ++i) {
+                sim.frameFor((size_t)i, 0, (uint16_t)s, f);
+                encodeSpectrumFrame(f, kFrameBinsInt16, frames[(size_t)s * (size_t)opt.nodes + (size_t)i]);
+            }
+        }
+        ClusterAggregator aggregator;
+        aggregator.setExpectedNodes((uint16_t)opt.nodes);
+        if (!aggregator.begin(inprocCubePath, geometry)) {
+            std::printf("FAIL: %s\n", aggregator.error().c_str());
+            return 1;
+        }
+        uint64_t t0 = EventLoop::nowUs();
+        for (int k = 0; k < opt.inprocSlots; ++k) {
+            uint32_t epoch = kBaseEpoch + (uint32_t)k * kSlotSeconds;
+            for (int i = 0; i < opt.nodes; ++i) {
+                const std::vector<uint8_t>& bytes = frames[(size_t)(k % distinct) * (size_t)opt.nodes + (size_t)i];
+                decodeSpectrumFrame(bytes.data(), bytes.size(), f);
+                f.epoch = epoch;
+                aggregator.ingest(f, "inproc");
+            }
+            aggregator.closeSlots(epoch, kSlotSeconds);
+        }
+        double s = (EventLoop::nowUs() - t0) / 1e6;
+        const IngestStats& st = aggregator.stats();
+        inprocFps = st.frames / s;
+        inprocBps = st.bins / s;
+        if (st.frames != (uint64_t)opt.inprocSlots * (uint64_t)opt.nodes || st.slotsClosed != (uint64_t)opt.inprocSlots) {
+            std::printf("FAIL: in-process ingest wrote %llu frames, closed %llu slots\n", (unsigned long long)st.frames,
+                        (unsigned long long)st.slotsClosed);
+            ok = false;
+        }
+    }
+
+    unlink(cubePath.c_str());
+    unlink(inprocCubePath.c_str());
+    if (opt.replay.empty()) unlink(replayPath.c_str());
+    rmdir(dir.c_str());
+
+    double httpS = httpUs / 1e6;
+    double fps = httpFrames / httpS;
+    std::printf("\nHTTP ingest: %llu frames in %.3f s: %.0f frames/s, %.2f MB/s, %llu fetch failures\n",
+                (unsigned long long)httpFrames, httpS, fps, httpBytes / httpS / 1e6, (unsigned long long)fetchFailures);
+    std::printf("round (poll %d nodes to last frame in the cube): p50 %.2f ms, p99 %.2f ms, max %.2f ms\n", opt.nodes,
+                bench::percentile(roundUs, 50) / 1000.0, bench::percentile(roundUs, 99) / 1000.0, bench::percentile(roundUs, 100) / 1000.0);
+    std::printf("aggregator: %llu frames, %llu bins, %llu cells, %llu duplicates, %llu late, %llu off grid, %llu slots closed\n",
+                (unsigned long long)httpStats.frames, (unsigned long long)httpStats.bins,
+                (unsigned long long)httpStats.cells, (unsigned long long)httpStats.duplicates,
+                (unsigned long long)httpStats.late, (unsigned long long)httpStats.offGrid,
+                (unsigned long long)httpStats.slotsClosed);
+    std::printf("in-process ingest (decode + align + cube write): %.0f frames/s, %.1f Mbins/s\n", inprocFps, inprocBps / 1e6);
+    std::printf("checks: %zu slots against expected composites, %d mismatched; %d rows streamed (%llu dropped), %d bad; "
+                "reopened cube %s\n",
+                expected.size(), mismatched, streamRows, (unsigned long long)rowsDropped, streamBad,
+                reopenBad ? "differs" : "intact");
+
+    if (timeouts > 0 || httpFrames != (uint64_t)opt.rounds * (uint64_t)opt.nodes) {
+        std::printf("FAIL: %llu of %llu frames ingested, %d rounds timed out\n", (unsigned long long)httpFrames,
+                    (unsigned long long)opt.rounds * (unsigned long long)opt.nodes, timeouts);
+        ok = false;
+    }
+    if (mismatched > 0 || (offGrid == 0 && expected.size() != (size_t)opt.rounds)) {
+        std::printf("FAIL: %d composites differ from the frames served\n", mismatched);
+        ok = false;
+    }
+    if (streamBad > 0 || streamRows != opt.rounds) {
+        std::printf("FAIL: stream carried %d of %d rows, %d bad\n", streamRows, opt.rounds, streamBad);
+        ok = false;
+    }
+    if (reopenBad > 0) {
+        std::printf("FAIL: %d slots differ in the reopened cube\n", reopenBad);
+        ok = false;
+    }
+    if (httpStats.duplicates > 0 || httpStats.late > 0) {
+        std::printf("FAIL: duplicate or late frames in lockstep rounds\n");
+        ok = false;
+    }
+    if (opt.minFps > 0 && fps < opt.minFps) {
+        std::printf("FAIL: %.0f frames/s < --min-fps %.0f\n", fps, opt.minFps);
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,350 @@
+// Emitter location benchmark.
+//
+// Two synthetic scenes, each swept --sweeps times with new emitters:
+//   - site: --nodes nodes on a jittered grid over 300 m, placed with 2.5 m
+//     of GPS error, --emitters emitters per sweep on their own channels
+//     (some two bins wide) anywhere in the area, -10 to +20 dBm. Every node
+//     sweeps a noise floor plus each emitter through log-distance path loss
+//     with --shadowing-db of log-normal shadowing. The sweeps go through
+//     ClusterAggregator into a SpectrumCube, and the slot is located from
+//     the cube, as the daemon does on every slot it closes.
+//   - city: 12 nodes over 5 km with GPS-disciplined arrival times
+//     (--tdoa-ns of timing error), half as many emitters at +20 to +40 dBm,
+//     solved on RSSI alone and again with TDOA.
+// Reports, per scene: emitters located out of those at least three nodes
+// detected, position error p50/p90/max, how often the error falls inside
+// twice the reported 1-sigma radius, and solve time per sweep (detect +
+// locate) and per emitter.
+//
+// Usage: locate_bench [--sweeps N] [--nodes N] [--emitters N] [--shadowing-db F] [--tdoa-ns F] [--seed N] [--verbose]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "BenchUtil.h"
+#include "ClusterAggregator.h"
+#include "EmitterLocator.h"
+#include "EventLoop.h"
+
+namespace {
+
+struct Options {
+    int sweeps = 50;
+    int nodes = 16;
+    int emitters = 40;
+    double shadowingDb = 4.0;
+    double tdoaNs = 100.0;
+    uint32_t seed = 7;
+    bool verbose = false;
+};
+
+void usage() {
+    std::printf("usage: locate_bench [--sweeps N] [--nodes N] [--emitters N] [--shadowing-db F] [--tdoa-ns F] [--seed N] [--verbose]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    bool known = bench::parseArgs(argc, argv, usage, [&](const std::string& a, bench::Args& args) {
+        if (a == "--sweeps") opt.sweeps = std::atoi(args.value());
+        else if (a == "--nodes") opt.nodes = std::atoi(args.value());
+        else if (a == "--emitters") opt.emitters = std::atoi(args.value());
+        else if (a == "--shadowing-db") opt.shadowingDb = std::atof(args.value());
+        else if (a == "--tdoa-ns") opt.tdoaNs = std::atof(args.value());
+        else if (a == "--seed") opt.seed = (uint32_t)std::atoi(args.value());
+        else if (a == "--verbose") opt.verbose = true;
+        else return false;
+        return true;
+    });
+    if (!known) return false;
+    return opt.sweeps >= 1 && opt.nodes >= 3 && opt.nodes <= 64 && opt.emitters >= 1 && opt.emitters <= 60 &&
+           opt.shadowingDb >= 0 && opt.tdoaNs > 0;
+}
+
+const double kPathLossExponent = 2.7;
+const double kNoiseFloorDbm = -105.0;
+const double kSpeedOfLight = 299792458.0;
+const uint16_t kBins = 255;
+
+struct Point {
+    double x, y;
+};
+
+struct Emitter {
+    Point at;
+    double txDbm;
+    uint16_t bin;
+    bool wide;                   // also the next bin, 6 dB down
+};
+
+double received(const Emitter& e, const Point& node, double shadowDb) {
+    double d = std::max(1.0, std::hypot(e.at.x - node.x, e.at.y - node.y));
+    return e.txDbm - 10.0 * kPathLossExponent * std::log10(d) + shadowDb;
+}
+
+struct SceneResult {
+    size_t visible = 0;          // detected by >= 3 nodes
+    size_t located = 0;
+    size_t falseFixes = 0;
+    size_t within2Sigma = 0;
+    std::vector<double> errorM;
+    std::vector<double> sweepMs;
+    uint64_t emittersSolved = 0;
+};
+
+void report(const char* name, const SceneResult& r) {
+    double perEmitterUs = 0;
+    for (double ms : r.sweepMs) perEmitterUs += ms * 1000.0;
+    perEmitterUs = r.emittersSolved ? perEmitterUs / r.emittersSolved : 0;
+    std::printf("%-12s %5zu/%-5zu %8.1f %8.1f %8.1f %7.0f%% %6zu %9.3f %9.3f %8.1f\n", name, r.located, r.visible,
+                bench::percentile(r.errorM, 50), bench::percentile(r.errorM, 90), bench::percentile(r.errorM, 100),
+                r.errorM.empty() ? 0.0 : 100.0 * r.within2Sigma / r.errorM.size(), r.falseFixes,
+                bench::percentile(r.sweepMs, 50), bench::percentile(r.sweepMs, 99), perEmitterUs);
+}
+
+// Distinct channels, at least three bins apart
+std::vector<uint16_t> pickBins(std::mt19937& rng, int count) {
+    std::vector<uint16_t> bins;
+    const int spacing = (kBins - 2) / count;
+    std::uniform_int_distribution<int> jitter(0, std::max(0, spacing - 4));
+    for (int i = 0; i < count; ++i) bins.push_back((uint16_t)(1 + i * spacing + jitter(rng)));
+    return bins;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 2;
+    }
+    std::mt19937 rng(opt.seed);
+    std::normal_distribution<double> gauss(0.0, 1.0);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::printf("locate_bench: %d sweeps, path loss n=%.1f, %.1f dB shadowing, %.0f ns arrival-time error\n",
+                opt.sweeps, kPathLossExponent, opt.shadowingDb, opt.tdoaNs);
+
+    // ---- Site: through the aggregator and the cube ----
+    SceneResult site;
+    {
+        const double side = 300.0;
+        const int perRow = (int)std::ceil(std::sqrt((double)opt.nodes));
+        std::vector<Point> nodes, placed;
+        for (int i = 0; i < opt.nodes; ++i) {
+            double cell = side / perRow;
+            Point p{(i % perRow + 0.2 + 0.6 * unit(rng)) * cell, (i / perRow + 0.2 + 0.6 * unit(rng)) * cell};
+            nodes.push_back(p);
+            placed.push_back({p.x + 2.5 * gauss(rng), p.y + 2.5 * gauss(rng)});
+        }
+
+        char path[] = "/tmp/locate_bench.XXXXXX";
+        int fd = mkstemp(path);
+        if (fd < 0) {
+            std::printf("FAIL: no temporary file\n");
+            return 1;
+        }
+        close(fd);
+        unlink(path);
+        CubeGeometry geometry;
+        geometry.startKhz = 433000;
+        geometry.stepHz = 25000;
+        geometry.bins = kBins;
+        geometry.nodes = 64;
+        geometry.slots = 64;
+        geometry.slotSeconds = 10;
+        ClusterAggregator aggregator;
+        aggregator.setExpectedNodes((uint16_t)opt.nodes);
+        if (!aggregator.begin(path, geometry)) {
+            std::printf("FAIL: %s\n", aggregator.error().c_str());
+            return 1;
+        }
+
+        EmitterLocator locator;
+        PathLossModel model;
+        model.exponent = kPathLossExponent;
+        model.shadowingDb = std::max(opt.shadowingDb, 1.0);
+        locator.setModel(model);
+        std::vector<Detection> detections;
+        std::vector<EmitterFix> fixes;
+        SweepFrame frame;
+        frame.startKhz = geometry.startKhz;
+        frame.stepHz = geometry.stepHz;
+        frame.cdb.resize(kBins);
+        const int threshold = (int)std::lround(locator.options().thresholdDb * 100.0);
+
+        for (int s = 0; s < opt.sweeps; ++s) {
+            uint32_t epoch = 1700000000 + (uint32_t)s * 10;
+            std::vector<Emitter> emitters;
+            for (uint16_t bin : pickBins(rng, opt.emitters)) {
+                emitters.push_back({{side * unit(rng), side * unit(rng)}, -10.0 + 30.0 * unit(rng), bin, unit(rng) < 0.3});
+            }
+            std::vector<int> seenBy(emitters.size(), 0);
+            for (int n = 0; n < opt.nodes; ++n) {
+                std::vector<int16_t> floor(kBins);
+                for (uint16_t b = 0; b < kBins; ++b) {
+                    floor[b] = (int16_t)std::lround((kNoiseFloorDbm + 2.0 * unit(rng)) * 100.0);
+                    frame.cdb[b] = floor[b];
+                }
+                for (size_t e = 0; e < emitters.size(); ++e) {
+                    int16_t rx = (int16_t)std::lround(received(emitters[e], nodes[n], opt.shadowingDb * gauss(rng)) * 100.0);
+                    uint16_t b = emitters[e].bin;
+                    frame.cdb[b] = std::max(frame.cdb[b], rx);
+                    if (emitters[e].wide) frame.cdb[b + 1] = std::max<int16_t>(frame.cdb[b + 1], (int16_t)(rx - 600));
+                    // As the locator sees it: above the node's floor (~-104 dBm) by the threshold
+                    if (rx >= (int)std::lround((kNoiseFloorDbm + 1.0) * 100.0) + threshold) seenBy[e]++;
+                }
+                const uint8_t mac[6] = {0x24, 0x6f, 0x28, 0x10, 0x00, (uint8_t)n};
+                std::copy(mac, mac + 6, frame.nodeId);
+                frame.epoch = epoch;
+                frame.seq = (uint16_t)s;
+                aggregator.ingest(frame, "bench");
+            }
+            aggregator.closeSlots(epoch, 10);
+
+            // Anchors by cube node index
+            const SpectrumCube& cube = aggregator.cube();
+            std::vector<LocatorAnchor> anchors(cube.nodeCount());
+            for (uint16_t i = 0; i < cube.nodeCount(); ++i) {
+                int n = cube.node(i).mac[5];
+                anchors[i].x = placed[n].x;
+                anchors[i].y = placed[n].y;
+                anchors[i].valid = true;
+            }
+            locator.setAnchors(anchors);
+
+            uint64_t t0 = EventLoop::nowUs();
+            detections.clear();
+            locator.detect(cube, epoch, detections);
+            locator.locate(detections, fixes);
+            site.sweepMs.push_back((EventLoop::nowUs() - t0) / 1000.0);
+            site.emittersSolved += fixes.size();
+
+            std::vector<bool> used(fixes.size(), false);
+            for (size_t e = 0; e < emitters.size(); ++e) {
+                if (seenBy[e] >= 3) site.visible++;
+                for (size_t f = 0; f < fixes.size(); ++f) {
+                    if (used[f] || emitters[e].bin < fixes[f].firstBin || emitters[e].bin > fixes[f].lastBin) continue;
+                    used[f] = true;
+                    double err = std::hypot(fixes[f].x - emitters[e].at.x, fixes[f].y - emitters[e].at.y);
+                    site.errorM.push_back(err);
+                    site.located++;
+                    if (err <= 2 * fixes[f].errorM) site.within2Sigma++;
+                    if (opt.verbose)
+                        std::printf("site sweep %d bin %u: %d nodes, error %.1f m (reported %.1f m), P %.1f dBm (true %.1f)\n",
+                                    s, emitters[e].bin, fixes[f].nodes, err, fixes[f].errorM, fixes[f].txDbm,
+                                    emitters[e].txDbm);
+                    break;
+                }
+            }
+            for (bool u : used) site.falseFixes += u ? 0 : 1;
+        }
+        unlink(path);
+    }
+
+    // ---- City: arrival times from GPS-disciplined clocks ----
+    SceneResult cityRssi, cityTdoa;
+    {
+        const double side = 5000.0;
+        const int count = 12;
+        std::vector<Point> nodes, placed;
+        std::vector<LocatorAnchor> anchors(count);
+        for (int i = 0; i < count; ++i) {
+            Point p{side * unit(rng), side * unit(rng)};
+            nodes.push_back(p);
+            placed.push_back({p.x + 2.5 * gauss(rng), p.y + 2.5 * gauss(rng)});
+            anchors[i].x = placed[i].x;
+            anchors[i].y = placed[i].y;
+            anchors[i].valid = true;
+        }
+        EmitterLocator locator;
+        PathLossModel model;
+        model.exponent = kPathLossExponent;
+        model.shadowingDb = std::max(opt.shadowingDb + 2.0, 1.0);
+        locator.setModel(model);
+        LocatorOptions options;
+        options.tdoaSigmaNs = opt.tdoaNs;
+        locator.setOptions(options);
+        locator.setAnchors(anchors);
+
+        const int emitterCount = std::max(1, opt.emitters / 2);
+        std::vector<std::vector<Detection>> timed(emitterCount), untimed(emitterCount);
+        for (int s = 0; s < opt.sweeps; ++s) {
+            std::vector<Emitter> emitters;
+            for (uint16_t bin : pickBins(rng, emitterCount)) {
+                emitters.push_back({{side * unit(rng), side * unit(rng)}, 20.0 + 20.0 * unit(rng), bin, false});
+            }
+            for (size_t e = 0; e < emitters.size(); ++e) {
+                timed[e].clear();
+                untimed[e].clear();
+                int64_t emittedNs = (1700000000LL + s * 10LL) * 1000000000LL + (int64_t)(1e9 * unit(rng));
+                for (int n = 0; n < count; ++n) {
+                    double rx = received(emitters[e], nodes[n], (opt.shadowingDb + 2.0) * gauss(rng));
+                    if (rx < kNoiseFloorDbm + options.thresholdDb) continue;
+                    Detection d;
+                    d.node = (uint16_t)n;
+                    d.bin = emitters[e].bin;
+                    d.rssiDbm = (float)rx;
+                    untimed[e].push_back(d);
+                    double dist = std::hypot(emitters[e].at.x - nodes[n].x, emitters[e].at.y - nodes[n].y);
+                    d.toaNs = emittedNs + std::llround((dist / kSpeedOfLight) * 1e9 + opt.tdoaNs * gauss(rng));
+                    timed[e].push_back(d);
+                }
+                if (untimed[e].size() >= 3) {
+                    cityRssi.visible++;
+                    cityTdoa.visible++;
+                }
+            }
+            for (int pass = 0; pass < 2; ++pass) {
+                SceneResult& r = pass == 0 ? cityRssi : cityTdoa;
+                std::vector<std::vector<Detection>>& set = pass == 0 ? untimed : timed;
+                std::vector<EmitterFix> fixes(emitters.size());
+                std::vector<bool> ok(emitters.size());
+                uint64_t t0 = EventLoop::nowUs();
+                for (size_t e = 0; e < emitters.size(); ++e) ok[e] = locator.solve(set[e].data(), set[e].size(), fixes[e]);
+                r.sweepMs.push_back((EventLoop::nowUs() - t0) / 1000.0);
+                for (size_t e = 0; e < emitters.size(); ++e) {
+                    if (!ok[e]) continue;
+                    r.emittersSolved++;
+                    r.located++;
+                    double err = std::hypot(fixes[e].x - emitters[e].at.x, fixes[e].y - emitters[e].at.y);
+                    r.errorM.push_back(err);
+                    if (err <= 2 * fixes[e].errorM) r.within2Sigma++;
+                }
+            }
+        }
+    }
+
+    std::printf("\n%-12s %11s %8s %8s %8s %8s %6s %9s %9s %8s\n", "scene", "located", "p50_m", "p90_m", "max_m",
+                "in_2sig", "false", "sweep_p50", "sweep_p99", "us/emit");
+    report("site", site);
+    report("city rssi", cityRssi);
+    report("city tdoa", cityTdoa);
+    std::printf("(sweep times in ms; site includes detection over the cube slot)\n");
+
+    bool ok = true;
+    double siteP50 = bench::percentile(site.errorM, 50);
+    if (site.located < site.visible * 9 / 10) {
+        std::printf("FAIL: site located %zu of %zu visible emitters\n", site.located, site.visible);
+        ok = false;
+    }
+    if (siteP50 > 40.0) {
+        std::printf("FAIL: site p50 error %.1f m > 40 m\n", siteP50);
+        ok = false;
+    }
+    if (bench::percentile(cityTdoa.errorM, 50) >= bench::percentile(cityRssi.errorM, 50)) {
+        std::printf("FAIL: TDOA did not improve on RSSI alone\n");
+        ok = false;
+    }
+    double worst = std::max({bench::percentile(site.sweepMs, 100), bench::percentile(cityTdoa.sweepMs, 100)});
+    if (worst > 1000.0) {
+        std::printf("FAIL: a sweep took %.1f ms to locate, the slot is 10 s\n", worst);
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+#include "ReplayNodes.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "HttpMessage.h"
+
+ReplayNodes::ReplayNodes() {}
+
+ReplayNodes::~ReplayNodes() { stop(); }
+
+bool ReplayNodes::start(const std::vector<ReplayRecord>& recorded, size_t count) {
+    std::vector<uint64_t> ids;
+    for (const ReplayRecord& r : recorded) {
+        SweepFrame f;
+        if (!decodeSpectrumFrame(r.frame.data(), r.frame.size(), f) || f.cdb.empty()) continue;
+        uint64_t id = nodeIdKey(f.nodeId);
+        size_t g = std::find(ids.begin(), ids.end(), id) - ids.begin();
+        if (g == ids.size()) {
+            ids.push_back(id);
+            _groups.emplace_back();
+        }
+        _groups[g].push_back(_sweeps.size());
+        _sweeps.push_back(std::move(f));
+    }
+    if (_sweeps.empty() || count == 0 || !_loop.ok()) return false;
+
+    for (size_t i = 0; i < count; ++i) {
+        int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) return false;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in sa{};
+        sa.sin_family = AF_INET;
+        sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(sa);
+        if (bind(fd, (sockaddr*)&sa, sizeof(sa)) != 0 || listen(fd, 64) != 0 ||
+            getsockname(fd, (sockaddr*)&sa, &len) != 0) {
+            ::close(fd);
+            return false;
+        }
+        _listeners.push_back(fd);
+        _ports.push_back(ntohs(sa.sin_port));
+        _loop.add(fd, EPOLLIN, [this, i, fd](uint32_t) { onAccept(i, fd); });
+    }
+    _wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    _loop.add(_wake, EPOLLIN, [this](uint32_t) { _stopping = true; });
+    _thread = std::thread([this] { run(); });
+    return true;
+}
+
+void ReplayNodes::stop() {
+    if (_thread.joinable()) {
+        uint64_t one = 1;
+        if (write(_wake, &one, sizeof(one)) < 0) _stopping = true;
+        _thread.join();
+    }
+    std::vector<int> fds;
+    for (auto& kv : _connections) fds.push_back(kv.first);
+    for (int fd : fds) close(fd);
+    for (int fd : _listeners) {
+        _loop.remove(fd);
+        ::close(fd);
+    }
+    _listeners.clear();
+    _ports.clear();
+    if (_wake >= 0) {
+        _loop.remove(_wake);
+        ::close(_wake);
+        _wake = -1;
+    }
+}
+
+std::string ReplayNodes::address(size_t node) const { return "127.0.0.1:" + std::to_string(_ports[node]); }
+
+void ReplayNodes::setSlot(uint32_t epoch, uint16_t seq) { _slot = (uint64_t)epoch << 16 | seq; }
+
+void ReplayNodes::frameFor(size_t node, uint32_t epoch, uint16_t seq, SweepFrame& out) const {
+    const std::vector<size_t>& group = _groups[node % _groups.size()];
+    out = _sweeps[group[seq % group.size()]];
+    const uint8_t id[6] = {0x02, 0x5e, 0x00, 0x00, (uint8_t)(node >> 8), (uint8_t)node};
+    memcpy(out.nodeId, id, sizeof(id));
+    out.epoch = epoch;
+    out.seq = seq;
+    int16_t offset = offsetCdb(node);
+    for (int16_t& v : out.cdb) v = (int16_t)std::max(-32000, (int)v + offset);
+}
+
+void ReplayNodes::run() {
+    while (!_stopping) _loop.run(100);
+}
+
+void ReplayNodes::onAccept(size_t node, int listener) {
+    while (true) {
+        int fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;
+        Connection& c = _connections[fd];
+        c = Connection();
+        c.node = node;
+        _loop.add(fd, EPOLLIN, [this, fd](uint32_t events) { onConnection(fd, events); });
+    }
+}
+
+void ReplayNodes::onConnection(int fd, uint32_t events) {
+    Connection& c = _connections[fd];
+    if (c.out.empty()) {
+        char buf[2048];
+        ssize_t n;
+        while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) c.in.append(buf, (size_t)n);
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) || (events & (EPOLLERR | EPOLLHUP))) {
+            close(fd);
+            return;
+        }
+        HttpRequest req;
+        HttpParse parsed = parseHttpRequest(c.in.data(), c.in.size(), req);
+        if (parsed == HTTP_INCOMPLETE) return;
+
+        std::vector<uint8_t> body;
+        int status = 404;
+        if (parsed == HTTP_COMPLETE && req.path == "/api/spectrum/frame") {
+            uint64_t slot = _slot.load();
+            SweepFrame frame;
+            frameFor(c.node, (uint32_t)(slot >> 16), (uint16_t)slot, frame);
+            uint8_t format = queryParam(req.query, "bins", "int8") == "int16" ? kFrameBinsInt16 : kFrameBinsInt8;
+            encodeSpectrumFrame(frame, format, body);
+            status = 200;
+            _served++;
+        }
+        char head[160];
+        int len = snprintf(head, sizeof(head),
+                           "HTTP/1.1 %d %s\r\nContent-Type: application/octet-stream\r\nContent-Length: %zu\r\n"
+                           "Connection: close\r\n\r\n",
+                           status, httpStatusText(status).c_str(), body.size());
+        c.out.assign(head, head + len);
+        c.out.insert(c.out.end(), body.begin(), body.end());
+    }
+    while (c.sent < c.out.size()) {
+        ssize_t n = send(fd, c.out.data() + c.sent, c.out.size() - c.sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            c.sent += (size_t)n;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            _loop.modify(fd, EPOLLOUT);
+            return;
+        }
+        break;
+    }
+    close(fd);
+}
+
+void ReplayNodes::close(int fd) {
+    _loop.remove(fd);
+    ::close(fd);
+    _connections.erase(fd);
+}
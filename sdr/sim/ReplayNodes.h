@@ -0,0 +1,73 @@
+#ifndef REPLAYNODES_H
+#define REPLAYNODES_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "EventLoop.h"
+#include "ReplayLog.h"
+#include "SpectrumFrameCodec.h"
+
+// Simulated nodes for the aggregation daemon: `count` HTTP servers on
+// 127.0.0.1 ephemeral ports, all served by one epoll thread, each answering
+// GET /api/spectrum/frame like a node's firmware does.
+//
+// They replay recorded sweeps (a ReplayLog). The recording's nodes are
+// grouped by node id; simulated node i replays group i % groups, sweep
+// seq % (sweeps in the group), as its own node (id 02:5e:00:00:hi:lo),
+// stamped with the current slot and seq and offset by offsetCdb(i), so
+// fifty nodes can be simulated from a recording of a handful.
+//
+// setSlot() moves every node to a new sweep at once, like the cluster's
+// synchronized sweep trigger does.
+
+class ReplayNodes {
+public:
+    ReplayNodes();
+    ~ReplayNodes();
+
+    // False if no record decodes, or a listener cannot be opened.
+    bool start(const std::vector<ReplayRecord>& recorded, size_t count);
+    void stop();
+
+    size_t size() const { return _ports.size(); }
+    std::string address(size_t node) const;           // "127.0.0.1:port"
+    void setSlot(uint32_t epoch, uint16_t seq);
+
+    // The sweep node serves for (epoch, seq), exactly as encoded on the wire.
+    void frameFor(size_t node, uint32_t epoch, uint16_t seq, SweepFrame& out) const;
+    static int16_t offsetCdb(size_t node) { return (int16_t)(-(int)(node % 7) * 150); }
+
+    uint64_t served() const { return _served.load(); }
+
+private:
+    struct Connection {
+        std::string in;
+        std::vector<uint8_t> out;
+        size_t sent = 0;
+        size_t node = 0;
+    };
+
+    void run();
+    void onAccept(size_t node, int listener);
+    void onConnection(int fd, uint32_t events);
+    void close(int fd);
+
+    std::vector<SweepFrame> _sweeps;
+    std::vector<std::vector<size_t>> _groups;        // indices into _sweeps, by recorded node
+    std::vector<int> _listeners;
+    std::vector<uint16_t> _ports;
+    std::unordered_map<int, Connection> _connections;
+    EventLoop _loop;                                  // run on _thread only
+    int _wake = -1;                                   // eventfd, ends run()
+    std::atomic<bool> _stopping{false};
+    std::thread _thread;
+    std::atomic<uint64_t> _slot{0};                  // epoch << 16 | seq
+    std::atomic<uint64_t> _served{0};
+};
+
+#endif
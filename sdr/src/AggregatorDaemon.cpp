@@ -0,0 +1,249 @@
+// ase_aggregatord: cluster spectrum aggregation daemon for the SDR node.
+//
+// Subscribes to the sweep frames of every All-Seeing Eye node (NodeCollector),
+// aligns them by slot epoch and frequency bin into a memory-mapped node x
+// frequency x time cube (ClusterAggregator, SpectrumCube) and serves
+// composite maps, as blocks and as a live stream (CompositeServer). Each
+// closed slot is also handed to EmitterLocator, with the node positions
+// their GeolocationService reports. One thread, one epoll loop. See
+// sdr/README.md.
+//
+// Usage: ase_aggregatord [--node HOST[:PORT]]... [--seed HOST[:PORT]] [--cube FILE] [--port N] [--bind ADDR]
+//                        [--poll-ms N] [--slot-s N] [--slots N] [--max-nodes N] [--grace-s N]
+//                        [--start-mhz F --stop-mhz F --step-khz F] [--query Q] [--record FILE]
+//                        [--path-loss-exp F] [--detect-db F]
+
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "ClusterAggregator.h"
+#include "CompositeServer.h"
+#include "EmitterLocator.h"
+#include "EventLoop.h"
+#include "NodeCollector.h"
+#include "ReplayLog.h"
+
+namespace {
+
+volatile sig_atomic_t gStop = 0;
+
+void onSignal(int) { gStop = 1; }
+
+struct Options {
+    std::vector<std::string> nodes;
+    std::string seed;
+    std::string cube = "ase_cube.bin";
+    uint16_t port = 8080;
+    std::string bind = "0.0.0.0";
+    uint32_t pollMs = 1000;
+    uint32_t graceS = 0;         // 0: one slot
+    CubeGeometry geometry;
+    double startMhz = 0, stopMhz = 0, stepKhz = 0;
+    std::string query = "bins=int16";
+    std::string record;
+    PathLossModel model;
+    LocatorOptions locator;
+};
+
+void usage() {
+    std::printf("usage: ase_aggregatord [--node HOST[:PORT]]... [--seed HOST[:PORT]] [--cube FILE] [--port N] [--bind ADDR]\n"
+                "                       [--poll-ms N] [--slot-s N] [--slots N] [--max-nodes N] [--grace-s N]\n"
+                "                       [--start-mhz F --stop-mhz F --step-khz F] [--query Q] [--record FILE]\n"
+                "                       [--path-loss-exp F] [--detect-db F]\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "missing value for %s\n", name);
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--node") opt.nodes.push_back(next("--node"));
+        else if (a == "--seed") opt.seed = next("--seed");
+        else if (a == "--cube") opt.cube = next("--cube");
+        else if (a == "--port") opt.port = (uint16_t)std::atoi(next("--port"));
+        else if (a == "--bind") opt.bind = next("--bind");
+        else if (a == "--poll-ms") opt.pollMs = (uint32_t)std::atoi(next("--poll-ms"));
+        else if (a == "--slot-s") opt.geometry.slotSeconds = (uint32_t)std::atoi(next("--slot-s"));
+        else if (a == "--slots") opt.geometry.slots = (uint32_t)std::atoi(next("--slots"));
+        else if (a == "--max-nodes") opt.geometry.nodes = (uint16_t)std::atoi(next("--max-nodes"));
+        else if (a == "--grace-s") opt.graceS = (uint32_t)std::atoi(next("--grace-s"));
+        else if (a == "--start-mhz") opt.startMhz = std::atof(next("--start-mhz"));
+        else if (a == "--stop-mhz") opt.stopMhz = std::atof(next("--stop-mhz"));
+        else if (a == "--step-khz") opt.stepKhz = std::atof(next("--step-khz"));
+        else if (a == "--query") opt.query = next("--query");
+        else if (a == "--record") opt.record = next("--record");
+        else if (a == "--path-loss-exp") opt.model.exponent = std::atof(next("--path-loss-exp"));
+        else if (a == "--detect-db") opt.locator.thresholdDb = std::atof(next("--detect-db"));
+        else if (a == "--help" || a == "-h") { usage(); std::exit(0); }
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", a.c_str());
+            usage();
+            return false;
+        }
+    }
+    if (opt.nodes.empty() && opt.seed.empty()) {
+        std::fprintf(stderr, "give --node or --seed\n");
+        return false;
+    }
+    if (opt.stepKhz > 0) {
+        if (!(opt.stopMhz > opt.startMhz)) {
+            std::fprintf(stderr, "--step-khz needs --start-mhz below --stop-mhz\n");
+            return false;
+        }
+        opt.geometry.startKhz = (uint32_t)std::lround(opt.startMhz * 1000.0);
+        opt.geometry.stepHz = (uint32_t)std::lround(opt.stepKhz * 1000.0);
+        opt.geometry.bins = (uint16_t)((opt.stopMhz - opt.startMhz) * 1000.0 / opt.stepKhz + 1.5);
+    }
+    if (opt.geometry.slotSeconds == 0 || opt.geometry.slots == 0 || opt.geometry.nodes == 0 ||
+        opt.geometry.nodes > kCubeMaxNodes || opt.geometry.bins > kCubeMaxBins || opt.pollMs == 0 ||
+        !(opt.model.exponent > 0) || !(opt.locator.thresholdDb > 0)) {
+        std::fprintf(stderr, "invalid geometry or poll interval\n");
+        return false;
+    }
+    if (opt.graceS == 0) opt.graceS = opt.geometry.slotSeconds;
+    return true;
+}
+
+// Anchors by cube node index, from the positions the collector read. Absolute
+// fixes win when three nodes have one; otherwise the relative frame most
+// nodes share.
+uint16_t anchorsFor(const SpectrumCube& cube, const NodeCollector& collector, std::vector<LocatorAnchor>& anchors,
+                    GeoFrame& frame, bool& absolute, std::string& frameId) {
+    const std::vector<CollectorNode>& nodes = collector.nodes();
+    size_t absCount = 0;
+    double lat = 0, lon = 0;
+    for (const CollectorNode& n : nodes) {
+        if (n.fix != 2) continue;
+        lat += n.lat;
+        lon += n.lon;
+        absCount++;
+    }
+    absolute = absCount >= 3;
+    frameId.clear();
+    if (absolute) {
+        frame.lat0 = lat / absCount;
+        frame.lon0 = lon / absCount;
+    } else {
+        size_t best = 0;
+        for (const CollectorNode& n : nodes) {
+            if (n.fix != 1) continue;
+            size_t same = 0;
+            for (const CollectorNode& o : nodes) same += o.fix == 1 && o.frameId == n.frameId;
+            if (same > best) {
+                best = same;
+                frameId = n.frameId;
+            }
+        }
+    }
+
+    anchors.assign(cube.nodeCount(), LocatorAnchor());
+    uint16_t valid = 0;
+    for (uint16_t i = 0; i < cube.nodeCount(); ++i) {
+        for (const CollectorNode& n : nodes) {
+            if (n.address != cube.node(i).address) continue;
+            if (absolute && n.fix == 2) {
+                frame.toLocal(n.lat, n.lon, anchors[i].x, anchors[i].y);
+                anchors[i].valid = true;
+            } else if (!absolute && n.fix == 1 && n.frameId == frameId) {
+                anchors[i].x = n.x;
+                anchors[i].y = n.y;
+                anchors[i].valid = true;
+            }
+            valid += anchors[i].valid;
+            break;
+        }
+    }
+    return valid;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) return 2;
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    EventLoop loop;
+    ClusterAggregator aggregator;
+    if (!loop.ok() || !aggregator.begin(opt.cube, opt.geometry)) {
+        std::fprintf(stderr, "[Aggregator] %s\n", aggregator.error().c_str());
+        return 1;
+    }
+
+    ReplayWriter recorder;
+    if (!opt.record.empty() && !recorder.open(opt.record)) {
+        std::fprintf(stderr, "[Aggregator] cannot record to %s\n", opt.record.c_str());
+        return 1;
+    }
+
+    NodeCollector collector(loop, aggregator);
+    collector.setPollInterval(opt.pollMs);
+    collector.setQuery(opt.query);
+    if (recorder.isOpen()) collector.setRecorder(&recorder);
+    for (const std::string& n : opt.nodes) {
+        if (!collector.addNode(n)) std::fprintf(stderr, "[Aggregator] cannot resolve %s, skipped\n", n.c_str());
+    }
+    if (!opt.seed.empty()) collector.setSeed(opt.seed);
+
+    CompositeServer server(loop, aggregator, &collector);
+    if (!server.begin(opt.port, opt.bind.c_str())) {
+        std::fprintf(stderr, "[Aggregator] cannot listen on %s:%u\n", opt.bind.c_str(), opt.port);
+        return 1;
+    }
+    EmitterLocator locator;
+    locator.setModel(opt.model);
+    locator.setOptions(opt.locator);
+    std::vector<LocatorAnchor> anchors;
+    std::vector<Detection> detections;
+    std::vector<EmitterFix> fixes;
+    aggregator.onSlotClosed([&](uint32_t epoch) {
+        server.publish(epoch);
+        GeoFrame frame;
+        bool absolute;
+        std::string frameId;
+        uint16_t valid = anchorsFor(aggregator.cube(), collector, anchors, frame, absolute, frameId);
+        fixes.clear();
+        if (valid >= 3) {
+            locator.setAnchors(anchors);
+            detections.clear();
+            locator.detect(aggregator.cube(), epoch, detections);
+            locator.locate(detections, fixes);
+        }
+        server.publishEmitters(epoch, fixes, valid, absolute ? &frame : nullptr, frameId);
+    });
+
+    std::fprintf(stderr, "[Aggregator] %zu nodes%s, cube %s, API on %s:%u\n", collector.nodes().size(),
+                 opt.seed.empty() ? "" : " (+ discovery)", opt.cube.c_str(), opt.bind.c_str(), server.port());
+
+    uint64_t lastLog = EventLoop::nowMs();
+    uint64_t lastFrames = 0;
+    while (!gStop) {
+        loop.run(50);
+        uint64_t now = EventLoop::nowMs();
+        collector.loop(now);
+        aggregator.closeSlots((uint32_t)(EventLoop::unixMs() / 1000ULL), opt.graceS);
+        if (now - lastLog >= 60000) {
+            const IngestStats& s = aggregator.stats();
+            std::fprintf(stderr, "[Aggregator] %llu frames in the last minute, %zu nodes, %llu slots closed, %u stream clients, %llu emitters located\n",
+                         (unsigned long long)(s.frames - lastFrames), collector.nodes().size(),
+                         (unsigned long long)s.slotsClosed, server.streamClients(),
+                         (unsigned long long)locator.stats().located);
+            lastFrames = s.frames;
+            lastLog = now;
+        }
+    }
+    std::fprintf(stderr, "[Aggregator] stopping\n");
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include "ClusterAggregator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+const char* compositeReduceName(uint8_t reduce) {
+    switch (reduce) {
+        case COMPOSITE_MAX: return "max";
+        case COMPOSITE_MEAN: return "mean";
+        case COMPOSITE_COUNT: return "count";
+        case COMPOSITE_ARGMAX: return "argmax";
+        default: return "unknown";
+    }
+}
+
+uint8_t compositeReduceFromName(const std::string& name) {
+    for (uint8_t r = COMPOSITE_MAX; r <= COMPOSITE_ARGMAX; ++r) {
+        if (name == compositeReduceName(r)) return r;
+    }
+    return 0;
+}
+
+bool ClusterAggregator::begin(const std::string& cubePath, const CubeGeometry& geometry) {
+    _cubePath = cubePath;
+    _requested = geometry;
+    if (geometry.bins == 0) {
+        // An existing file knows its grid; otherwise wait for the first frame
+        FILE* f = fopen(cubePath.c_str(), "rb");
+        if (!f) return true;
+        fclose(f);
+    }
+    if (!_cube.open(cubePath, geometry)) {
+        _error = _cube.error();
+        return false;
+    }
+    for (uint16_t i = 0; i < _cube.nodeCount(); ++i) _nodes[nodeIdKey(_cube.node(i).mac)] = i;
+    _closedThrough = _cube.newestEpoch();
+    return true;
+}
+
+const ClusterAggregator::GridMap& ClusterAggregator::gridMap(uint32_t startKhz, uint32_t stepHz, uint16_t count) {
+    for (size_t i = 0; i < _maps.size(); ++i) {
+        const GridMap& m = _maps[i];
+        if (m.startKhz == startKhz && m.stepHz == stepHz && m.count == count) return m;
+    }
+
+    const CubeGeometry& g = _cube.geometry();
+    GridMap m;
+    m.startKhz = startKhz;
+    m.stepHz = stepHz;
+    m.count = count;
+    m.spans.resize(count);
+    const double g0 = (double)g.startKhz * 1000.0;
+    const double gs = (double)g.stepHz;
+    for (uint16_t i = 0; i < count; ++i) {
+        double f = (double)startKhz * 1000.0 + (double)i * stepHz;
+        double half = stepHz / 2.0;
+        // Grid bins whose centre lies in [f - half, f + half)
+        int64_t lo = (int64_t)std::ceil((f - half - g0) / gs);
+        int64_t hi = (int64_t)std::ceil((f + half - g0) / gs) - 1;
+        if (lo > hi) lo = hi = (int64_t)std::llround((f - g0) / gs);  // narrower than a grid step
+        lo = std::max<int64_t>(lo, 0);
+        hi = std::min<int64_t>(hi, (int64_t)g.bins - 1);
+        m.spans[i] = {(int32_t)lo, (int32_t)hi};
+    }
+    _maps.push_back(std::move(m));
+    return _maps.back();
+}
+
+bool ClusterAggregator::ingest(const SweepFrame& frame, const char* address) {
+    if (!_cube.isOpen()) {
+        CubeGeometry g = _requested;
+        g.startKhz = frame.startKhz;
+        g.stepHz = frame.stepHz;
+        g.bins = (uint16_t)frame.cdb.size();
+        if (!_cube.open(_cubePath, g)) {
+            _error = _cube.error();
+            return false;
+        }
+    }
+
+    uint64_t key = nodeIdKey(frame.nodeId);
+    auto it = _nodes.find(key);
+    int node;
+    if (it != _nodes.end()) {
+        node = it->second;
+    } else {
+        node = _cube.nodeIndex(frame.nodeId, address, true);
+        if (node < 0) {
+            _stats.nodesFull++;
+            return false;
+        }
+        _nodes[key] = node;
+    }
+
+    CubeSlot* slot = _cube.beginSlot(frame.epoch);
+    if (!slot) {
+        _stats.expired++;
+        return false;
+    }
+    uint64_t bit = 1ULL << (node % 64);
+    if (slot->mask[node / 64] & bit) {
+        _stats.duplicates++;
+        return false;
+    }
+
+    const GridMap& map = gridMap(frame.startKhz, frame.stepHz, (uint16_t)frame.cdb.size());
+    const uint16_t nodes = _cube.geometry().nodes;
+    int16_t* base = _cube.column(slot, 0) + node;
+    uint32_t cells = 0;
+    for (size_t i = 0; i < frame.cdb.size(); ++i) {
+        const BinSpan& span = map.spans[i];
+        int16_t v = frame.cdb[i];
+        for (int32_t b = span.lo; b <= span.hi; ++b) {
+            int16_t& cell = base[(size_t)b * nodes];
+            if (v > cell) cell = v;
+            cells++;
+        }
+    }
+    if (cells == 0) {
+        _stats.offGrid++;
+        return false;
+    }
+
+    slot->mask[node / 64] |= bit;
+    slot->reported++;
+    CubeNode& n = _cube.node((uint16_t)node);
+    if (n.firstEpoch == 0) n.firstEpoch = slot->epoch;
+    n.lastEpoch = std::max(n.lastEpoch, slot->epoch);
+    n.frames++;
+
+    _stats.frames++;
+    _stats.bins += frame.cdb.size();
+    _stats.cells += cells;
+    if (slot->epoch <= _closedThrough) {
+        _stats.late++;
+    } else if (std::find(_open.begin(), _open.end(), slot->epoch) == _open.end()) {
+        _open.insert(std::upper_bound(_open.begin(), _open.end(), slot->epoch), slot->epoch);
+    }
+    return true;
+}
+
+void ClusterAggregator::closeSlots(uint32_t nowEpoch, uint32_t graceS) {
+    if (_open.empty()) return;
+    const uint32_t slotSeconds = _cube.geometry().slotSeconds;
+    // The newest slot that must close: due by time, or complete (which closes the ones before it too)
+    uint32_t through = 0;
+    for (uint32_t epoch : _open) {
+        const CubeSlot* slot = _cube.findSlot(epoch);
+        bool complete = slot && _expectedNodes > 0 && slot->reported >= _expectedNodes;
+        bool due = (uint64_t)epoch + slotSeconds + graceS <= nowEpoch;
+        if (complete || due) through = epoch;
+    }
+    while (!_open.empty() && _open.front() <= through) {
+        uint32_t epoch = _open.front();
+        _open.erase(_open.begin());
+        closeSlot(epoch);
+    }
+}
+
+void ClusterAggregator::closeSlot(uint32_t epoch) {
+    _closedThrough = std::max(_closedThrough, epoch);
+    _stats.slotsClosed++;
+    if (_listener) _listener(epoch);
+}
+
+bool ClusterAggregator::composite(uint32_t epoch, uint8_t reduce, CompositeRow& out) const {
+    if (!_cube.isOpen()) return false;
+    const CubeSlot* slot = _cube.findSlot(epoch);
+    if (!slot) return false;
+    const CubeGeometry& g = _cube.geometry();
+    // Only columns up to the last registered node hold data
+    const uint16_t nodes = std::max<uint16_t>(_nodes.size(), 1);
+    out.epoch = slot->epoch;
+    out.reporting = slot->reported;
+    out.values.resize(g.bins);
+    for (uint16_t b = 0; b < g.bins; ++b) {
+        const int16_t* col = _cube.column(slot, b);
+        int32_t best = kCubeMissing;
+        int32_t bestNode = -1;
+        int32_t count = 0;
+        int64_t sum = 0;
+        for (uint16_t n = 0; n < nodes; ++n) {
+            int16_t v = col[n];
+            if (v == kCubeMissing) continue;
+            count++;
+            sum += v;
+            if (v > best) {
+                best = v;
+                bestNode = n;
+            }
+        }
+        int16_t value;
+        switch (reduce) {
+            case COMPOSITE_MEAN: value = count ? (int16_t)(sum / count) : kCubeMissing; break;
+            case COMPOSITE_COUNT: value = (int16_t)count; break;
+            case COMPOSITE_ARGMAX: value = (int16_t)bestNode; break;
+            default: value = (int16_t)best; break;
+        }
+        out.values[b] = value;
+    }
+    return true;
+}
@@ -0,0 +1,114 @@
+#ifndef CLUSTERAGGREGATOR_H
+#define CLUSTERAGGREGATOR_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SpectrumCube.h"
+#include "SpectrumFrameCodec.h"
+
+// Aligns the sweeps of every node onto one SpectrumCube and builds composites.
+//
+// Time: a frame belongs to the slot of its epoch (the consensus second its
+// sweep started on). Frequency: each frame bin covers its step around its
+// centre and lands on every grid bin whose centre it covers, or on the
+// nearest grid bin when it is narrower than a grid step. Where several
+// frame bins of one sweep land on a grid bin, the strongest is kept.
+// So nodes sweeping other ranges or steps still line up bin for bin. The
+// mapping is computed once per (start, step, count) a node sweeps with.
+//
+// A slot closes once every expected node reported it, or graceS after it
+// ended; slots close in epoch order and each closed slot is announced once
+// (CompositeServer streams it). Late frames are still written to the cube.
+//
+// Composites reduce a (slot, bin) column over nodes, skipping cells a node
+// did not report: the strongest reading (max, the RSSI bitmap), which node
+// saw it (argmax), the mean in dB and the number of nodes.
+
+enum CompositeReduce : uint8_t {
+    COMPOSITE_MAX = 1,
+    COMPOSITE_MEAN = 2,
+    COMPOSITE_COUNT = 3,
+    COMPOSITE_ARGMAX = 4
+};
+
+const char* compositeReduceName(uint8_t reduce);
+uint8_t compositeReduceFromName(const std::string& name);   // 0 if unknown
+
+struct CompositeRow {
+    uint32_t epoch = 0;
+    uint16_t reporting = 0;      // nodes with a sweep in the slot
+    std::vector<int16_t> values; // geometry().bins: centi-dBm, a count, or a node index (-1: none)
+};
+
+struct IngestStats {
+    uint64_t frames = 0;         // written to the cube
+    uint64_t bins = 0;           // frame bins of those
+    uint64_t cells = 0;          // grid cells they set
+    uint64_t duplicates = 0;     // a node's second sweep for one slot
+    uint64_t late = 0;           // written after their slot closed
+    uint64_t expired = 0;        // older than the ring holds
+    uint64_t offGrid = 0;        // no bin on the grid
+    uint64_t nodesFull = 0;      // from a node beyond geometry.nodes
+    uint64_t slotsClosed = 0;
+};
+
+class ClusterAggregator {
+public:
+    // geometry.bins == 0: take the grid from the cube file, or else from the
+    // first frame ingested.
+    bool begin(const std::string& cubePath, const CubeGeometry& geometry);
+    const std::string& error() const { return _error; }
+
+    // Writes one sweep. False when it was dropped; stats() says why.
+    bool ingest(const SweepFrame& frame, const char* address);
+
+    // Nodes a slot waits for before it closes early (the collector's node count).
+    void setExpectedNodes(uint16_t nodes) { _expectedNodes = nodes; }
+    // Closes complete slots, and every slot that ended graceS before nowEpoch.
+    void closeSlots(uint32_t nowEpoch, uint32_t graceS);
+
+    using SlotListener = std::function<void(uint32_t epoch)>;
+    void onSlotClosed(SlotListener listener) { _listener = std::move(listener); }
+
+    // False when the slot is not held.
+    bool composite(uint32_t epoch, uint8_t reduce, CompositeRow& out) const;
+
+    bool ready() const { return _cube.isOpen(); }
+    const SpectrumCube& cube() const { return _cube; }
+    const IngestStats& stats() const { return _stats; }
+    uint32_t closedThrough() const { return _closedThrough; }
+
+private:
+    struct BinSpan {
+        int32_t lo;              // first grid bin, lo > hi: off the grid
+        int32_t hi;
+    };
+    struct GridMap {
+        uint32_t startKhz;
+        uint32_t stepHz;
+        uint16_t count;
+        std::vector<BinSpan> spans;
+    };
+
+    const GridMap& gridMap(uint32_t startKhz, uint32_t stepHz, uint16_t count);
+    void closeSlot(uint32_t epoch);
+
+    SpectrumCube _cube;
+    std::string _cubePath;
+    CubeGeometry _requested;
+    std::string _error;
+
+    std::vector<GridMap> _maps;
+    std::unordered_map<uint64_t, int> _nodes;   // MAC -> cube node index
+    std::vector<uint32_t> _open;                // slot epochs written, not closed yet
+    uint32_t _closedThrough = 0;
+    uint16_t _expectedNodes = 0;
+    SlotListener _listener;
+    IngestStats _stats;
+};
+
+#endif
@@ -0,0 +1,378 @@
+#include "CompositeServer.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+#include "HttpMessage.h"
+#include "NodeCollector.h"
+
+namespace {
+
+void put16(std::string& out, uint16_t v) {
+    out.push_back((char)(v & 0xFF));
+    out.push_back((char)(v >> 8));
+}
+
+void put32(std::string& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) out.push_back((char)(v >> (8 * i)));
+}
+
+void appendf(std::string& out, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+void appendf(std::string& out, const char* fmt, ...) {
+    char buf[512];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n > 0) out.append(buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+}
+
+std::string macString(const uint8_t mac[6]) {
+    char s[18];
+    snprintf(s, sizeof(s), "%02x:%02x:%02x:%02x:%02x:%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return s;
+}
+
+void appendChunk(std::string& out, const std::string& data) {
+    char size[16];
+    snprintf(size, sizeof(size), "%zx\r\n", data.size());
+    out += size;
+    out += data;
+    out += "\r\n";
+}
+
+} // namespace
+
+CompositeServer::CompositeServer(EventLoop& loop, ClusterAggregator& aggregator, NodeCollector* collector)
+    : _loop(loop), _aggregator(aggregator), _collector(collector) {}
+
+CompositeServer::~CompositeServer() {
+    while (!_clients.empty()) drop(_clients.begin()->first);
+    if (_listen >= 0) {
+        _loop.remove(_listen);
+        close(_listen);
+    }
+}
+
+bool CompositeServer::begin(uint16_t port, const char* bindAddress) {
+    _listen = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (_listen < 0) return false;
+    int one = 1;
+    setsockopt(_listen, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in sa{};
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    inet_pton(AF_INET, bindAddress, &sa.sin_addr);
+    if (bind(_listen, (sockaddr*)&sa, sizeof(sa)) != 0 || listen(_listen, 64) != 0) {
+        close(_listen);
+        _listen = -1;
+        return false;
+    }
+    socklen_t len = sizeof(sa);
+    getsockname(_listen, (sockaddr*)&sa, &len);
+    _port = ntohs(sa.sin_port);
+    return _loop.add(_listen, EPOLLIN, [this](uint32_t) { onAccept(); });
+}
+
+void CompositeServer::onAccept() {
+    while (true) {
+        int fd = accept4(_listen, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;
+        if (_clients.size() >= kMaxClients) {
+            close(fd);
+            continue;
+        }
+        Client& c = _clients[fd];
+        c.fd = fd;
+        _loop.add(fd, EPOLLIN, [this, fd](uint32_t events) { onClient(fd, events); });
+    }
+}
+
+void CompositeServer::onClient(int fd, uint32_t events) {
+    auto it = _clients.find(fd);
+    if (it == _clients.end()) return;
+    Client& c = it->second;
+    if (events & (EPOLLERR | EPOLLHUP)) {
+        drop(fd);
+        return;
+    }
+    if (events & EPOLLIN) {
+        char buf[2048];
+        while (true) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n > 0) {
+                if (!c.streaming && c.out.empty()) c.in.append(buf, (size_t)n);
+                continue;
+            }
+            if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                drop(fd);
+                return;
+            }
+            break;
+        }
+        if (!c.streaming && c.out.empty() && !c.in.empty()) handle(c);
+    }
+    if (_clients.count(fd)) flush(_clients[fd]);
+}
+
+void CompositeServer::handle(Client& c) {
+    HttpRequest req;
+    HttpParse parsed = parseHttpRequest(c.in.data(), c.in.size(), req);
+    if (parsed == HTTP_INCOMPLETE) return;
+    c.in.clear();
+    if (parsed == HTTP_MALFORMED) {
+        respond(c, 400, "application/json", "{\"error\":\"Malformed request\"}");
+        return;
+    }
+    if (req.method != "GET") {
+        respond(c, 405, "application/json", "{\"error\":\"GET only\"}");
+        return;
+    }
+    if (req.path == "/api/status") {
+        serveStatus(c);
+    } else if (req.path == "/api/composite") {
+        serveComposite(c, req.query);
+    } else if (req.path == "/api/emitters") {
+        respond(c, 200, "application/json", _emitters);
+    } else if (req.path == "/api/composite/stream") {
+        uint8_t reduce = compositeReduceFromName(queryParam(req.query, "reduce", "max"));
+        if (reduce == 0) {
+            respond(c, 400, "application/json", "{\"error\":\"Unknown reduce\"}");
+            return;
+        }
+        if (!_aggregator.ready()) {
+            respond(c, 503, "application/json", "{\"error\":\"No sweep received yet\"}");
+            return;
+        }
+        c.streaming = true;
+        c.reduce = reduce;
+        c.out = "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nTransfer-Encoding: chunked\r\n"
+                "Cache-Control: no-store\r\n\r\n";
+        std::string header;
+        appendHeader(header, reduce, 0, 0, 0);
+        appendChunk(c.out, header);
+    } else {
+        respond(c, 404, "application/json", "{\"error\":\"Not found\"}");
+    }
+}
+
+void CompositeServer::respond(Client& c, int status, const char* contentType, const std::string& body) {
+    char head[160];
+    snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+             status, httpStatusText(status).c_str(), contentType, body.size());
+    c.out = head;
+    c.out += body;
+    c.outSent = 0;
+    c.closeWhenSent = true;
+}
+
+void CompositeServer::appendHeader(std::string& out, uint8_t reduce, uint16_t rows, uint32_t firstEpoch,
+                                   uint32_t lastEpoch) const {
+    const CubeGeometry& g = _aggregator.cube().geometry();
+    out.append("ASEM", 4);
+    out.push_back((char)kCompositeVersion);
+    out.push_back((char)reduce);
+    put16(out, rows);
+    put16(out, g.bins);
+    put16(out, _aggregator.cube().nodeCount());
+    put32(out, g.startKhz);
+    put32(out, g.stepHz);
+    put32(out, g.slotSeconds);
+    put32(out, firstEpoch);
+    put32(out, lastEpoch);
+}
+
+void CompositeServer::appendRow(std::string& out, const CompositeRow& row) {
+    put32(out, row.epoch);
+    put16(out, row.reporting);
+    put16(out, 0);
+    size_t at = out.size();
+    out.resize(at + row.values.size() * 2);
+    char* p = &out[at];
+    for (int16_t v : row.values) {
+        *p++ = (char)((uint16_t)v & 0xFF);
+        *p++ = (char)((uint16_t)v >> 8);
+    }
+}
+
+void CompositeServer::serveComposite(Client& c, const std::string& query) {
+    uint8_t reduce = compositeReduceFromName(queryParam(query, "reduce", "max"));
+    if (reduce == 0) {
+        respond(c, 400, "application/json", "{\"error\":\"Unknown reduce\"}");
+        return;
+    }
+    if (!_aggregator.ready()) {
+        respond(c, 503, "application/json", "{\"error\":\"No sweep received yet\"}");
+        return;
+    }
+    const SpectrumCube& cube = _aggregator.cube();
+    const uint32_t step = cube.geometry().slotSeconds;
+    uint32_t newest = _aggregator.closedThrough() ? _aggregator.closedThrough() : cube.newestEpoch();
+    uint32_t from, to;
+    std::string last = queryParam(query, "last");
+    if (!last.empty()) {
+        uint32_t n = (uint32_t)strtoul(last.c_str(), nullptr, 10);
+        to = newest;
+        from = n == 0 || (uint64_t)n * step > to ? 0 : to - (n - 1) * step;
+    } else {
+        from = (uint32_t)strtoul(queryParam(query, "from", "0").c_str(), nullptr, 10);
+        to = (uint32_t)strtoul(queryParam(query, "to", std::to_string(newest)).c_str(), nullptr, 10);
+    }
+    from = std::max(from, cube.oldestEpoch());
+    from = cube.slotEpoch(from);
+
+    std::string rows;
+    uint16_t count = 0;
+    uint32_t first = 0, lastEpoch = 0;
+    for (uint32_t e = from; e != 0 && e <= to && count < kMaxRows; e += step) {
+        if (!_aggregator.composite(e, reduce, _row)) continue;
+        appendRow(rows, _row);
+        if (count == 0) first = e;
+        lastEpoch = e;
+        count++;
+    }
+    if (count == 0) {
+        respond(c, 204, "application/octet-stream", "");
+        return;
+    }
+    std::string body;
+    appendHeader(body, reduce, count, first, lastEpoch);
+    body += rows;
+    respond(c, 200, "application/octet-stream", body);
+}
+
+void CompositeServer::serveStatus(Client& c) {
+    const IngestStats& s = _aggregator.stats();
+    const SpectrumCube& cube = _aggregator.cube();
+    std::string json = "{";
+    if (cube.isOpen()) {
+        const CubeGeometry& g = cube.geometry();
+        appendf(json, "\"grid\":{\"start_khz\":%u,\"step_hz\":%u,\"bins\":%u},", g.startKhz, g.stepHz, g.bins);
+        appendf(json, "\"cube\":{\"nodes\":%u,\"slots\":%u,\"slot_seconds\":%u,\"bytes\":%llu,\"oldest_epoch\":%u,\"newest_epoch\":%u,\"closed_through\":%u},",
+                g.nodes, g.slots, g.slotSeconds, (unsigned long long)cube.fileBytes(), cube.oldestEpoch(),
+                cube.newestEpoch(), _aggregator.closedThrough());
+    }
+    appendf(json, "\"ingest\":{\"frames\":%llu,\"bins\":%llu,\"cells\":%llu,\"duplicates\":%llu,\"late\":%llu,\"expired\":%llu,\"off_grid\":%llu,\"nodes_full\":%llu,\"slots_closed\":%llu},",
+            (unsigned long long)s.frames, (unsigned long long)s.bins, (unsigned long long)s.cells,
+            (unsigned long long)s.duplicates, (unsigned long long)s.late, (unsigned long long)s.expired,
+            (unsigned long long)s.offGrid, (unsigned long long)s.nodesFull, (unsigned long long)s.slotsClosed);
+    appendf(json, "\"stream\":{\"clients\":%u,\"rows\":%llu,\"dropped\":%llu},", streamClients(),
+            (unsigned long long)_rowsStreamed, (unsigned long long)_rowsDropped);
+
+    // Cube order: argmax values index this array
+    json += "\"nodes\":[";
+    for (uint16_t i = 0; cube.isOpen() && i < cube.nodeCount(); ++i) {
+        const CubeNode& n = cube.node(i);
+        appendf(json, "%s{\"index\":%u,\"node_id\":\"%s\",\"address\":\"%s\",\"frames\":%u,\"first_epoch\":%u,\"last_epoch\":%u}",
+                i ? "," : "", i, macString(n.mac).c_str(), n.address, n.frames, n.firstEpoch, n.lastEpoch);
+    }
+    json += "]";
+    if (_collector) {
+        json += ",\"subscriptions\":[";
+        const auto& nodes = _collector->nodes();
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const CollectorNode& n = nodes[i];
+            static const char* const fixNames[] = {"none", "relative", "absolute"};
+            appendf(json, "%s{\"address\":\"%s\",\"fetches\":%u,\"frames\":%u,\"unchanged\":%u,\"empty\":%u,\"failed\":%u,\"bytes\":%llu,\"latency_us\":%u,\"last_epoch\":%u,\"fix\":\"%s\"}",
+                    i ? "," : "", n.address.c_str(), n.fetches, n.frames, n.unchanged, n.empty, n.failed,
+                    (unsigned long long)n.bytes, n.lastLatencyUs, n.lastEpoch, fixNames[n.fix < 3 ? n.fix : 0]);
+        }
+        json += "]";
+    }
+    json += "}";
+    respond(c, 200, "application/json", json);
+}
+
+void CompositeServer::publish(uint32_t epoch) {
+    // One composite per reduce with listeners
+    for (uint8_t reduce = COMPOSITE_MAX; reduce <= COMPOSITE_ARGMAX; ++reduce) {
+        bool wanted = false;
+        for (auto& kv : _clients) wanted |= kv.second.streaming && kv.second.reduce == reduce;
+        if (!wanted || !_aggregator.composite(epoch, reduce, _row)) continue;
+        std::string row;
+        appendRow(row, _row);
+        for (auto& kv : _clients) {
+            Client& c = kv.second;
+            if (!c.streaming || c.reduce != reduce) continue;
+            if (c.out.size() - c.outSent > kMaxBacklogBytes) {
+                _rowsDropped++;
+                continue;
+            }
+            appendChunk(c.out, row);
+            _rowsStreamed++;
+        }
+    }
+    // Flushing may drop clients; collect them first
+    std::vector<int> fds;
+    for (auto& kv : _clients) {
+        if (kv.second.streaming) fds.push_back(kv.first);
+    }
+    for (int fd : fds) {
+        if (_clients.count(fd)) flush(_clients[fd]);
+    }
+}
+
+void CompositeServer::publishEmitters(uint32_t epoch, const std::vector<EmitterFix>& fixes, uint16_t anchors,
+                                      const GeoFrame* frame, const std::string& frameId) {
+    const CubeGeometry& g = _aggregator.cube().geometry();
+    std::string& json = _emitters;
+    json.clear();
+    appendf(json, "{\"epoch\":%u,\"anchors\":%u,\"frame\":\"%s\"", epoch, anchors, frame ? "absolute" : "relative");
+    if (!frame) appendf(json, ",\"frame_id\":\"%s\"", frameId.c_str());
+    json += ",\"emitters\":[";
+    for (size_t i = 0; i < fixes.size(); ++i) {
+        const EmitterFix& f = fixes[i];
+        appendf(json, "%s{\"freq_hz\":%llu,\"first_bin\":%u,\"last_bin\":%u,\"peak_dbm\":%.1f,\"x\":%.1f,\"y\":%.1f,",
+                i ? "," : "", (unsigned long long)g.binHz(f.peakBin), f.firstBin, f.lastBin, f.peakDbm, f.x, f.y);
+        if (frame) {
+            double lat, lon;
+            frame->toGeo(f.x, f.y, lat, lon);
+            appendf(json, "\"lat\":%.7f,\"lon\":%.7f,", lat, lon);
+        }
+        appendf(json, "\"tx_dbm\":%.1f,\"error_m\":%.1f,\"rms_db\":%.1f,\"nodes\":%u,\"tdoa\":%s}", f.txDbm,
+                f.errorM, f.rmsDb, f.nodes, f.tdoa ? "true" : "false");
+    }
+    json += "]}";
+}
+
+void CompositeServer::flush(Client& c) {
+    while (c.outSent < c.out.size()) {
+        ssize_t n = send(c.fd, c.out.data() + c.outSent, c.out.size() - c.outSent, MSG_NOSIGNAL);
+        if (n > 0) {
+            c.outSent += (size_t)n;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            _loop.modify(c.fd, EPOLLIN | EPOLLOUT);
+            return;
+        }
+        drop(c.fd);
+        return;
+    }
+    c.out.clear();
+    c.outSent = 0;
+    _loop.modify(c.fd, EPOLLIN);
+    if (c.closeWhenSent) drop(c.fd);
+}
+
+void CompositeServer::drop(int fd) {
+    _loop.remove(fd);
+    close(fd);
+    _clients.erase(fd);
+}
+
+uint32_t CompositeServer::streamClients() const {
+    uint32_t n = 0;
+    for (const auto& kv : _clients) n += kv.second.streaming ? 1 : 0;
+    return n;
+}
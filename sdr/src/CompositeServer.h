@@ -0,0 +1,103 @@
+#ifndef COMPOSITESERVER_H
+#define COMPOSITESERVER_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "ClusterAggregator.h"
+#include "EmitterLocator.h"
+#include "EventLoop.h"
+
+class NodeCollector;
+
+// HTTP API of the aggregation daemon, served from the EventLoop.
+//
+//   GET /api/status                      JSON: grid, cube, ingest and per-node stats
+//   GET /api/composite?from=E&to=E|last=N&reduce=max|mean|count|argmax
+//                                        the composite of held slots as one block
+//   GET /api/composite/stream?reduce=..  chunked: the block header, then one
+//                                        row per slot as it closes
+//   GET /api/emitters                    JSON: the emitters located in the last closed slot
+//
+// Composite block, little-endian, 32-byte header followed by rows:
+//   0  char[4] magic       "ASEM"
+//   4  u8      version     kCompositeVersion
+//   5  u8      reduce      CompositeReduce
+//   6  u16     row_count   0 on the stream
+//   8  u16     bin_count
+//   10 u16     node_count  nodes registered; argmax values index /api/status nodes
+//   12 u32     start_khz   centre of bin 0
+//   16 u32     step_hz
+//   20 u32     slot_seconds
+//   24 u32     first_epoch
+//   28 u32     last_epoch
+//   32 rows    u32 epoch | u16 reporting nodes | u16 reserved | bin_count x int16
+// Values are centi-dBm (max, mean), a node count, or a node index; -32768
+// (max, mean) and -1 (argmax) mean no node reported the bin.
+//
+// A stream client that stops reading is not waited for: once kMaxBacklogBytes
+// are queued for it, new rows are dropped for that client and counted.
+
+static constexpr uint8_t kCompositeVersion = 1;
+static constexpr size_t kCompositeHeaderBytes = 32;
+
+class CompositeServer {
+public:
+    static constexpr size_t kMaxClients = 64;
+    static constexpr size_t kMaxBacklogBytes = 256 * 1024;
+    static constexpr uint32_t kMaxRows = 2048;
+
+    CompositeServer(EventLoop& loop, ClusterAggregator& aggregator, NodeCollector* collector);
+    ~CompositeServer();
+
+    // Listens on port (0: any free port). Call publish() for each closed slot.
+    bool begin(uint16_t port, const char* bindAddress = "0.0.0.0");
+    uint16_t port() const { return _port; }
+    void publish(uint32_t epoch);
+    // The emitters located in a closed slot, served until the next. frame is
+    // null when anchors were relative (frameId names their frame).
+    void publishEmitters(uint32_t epoch, const std::vector<EmitterFix>& fixes, uint16_t anchors, const GeoFrame* frame,
+                         const std::string& frameId);
+
+    uint32_t streamClients() const;
+    uint64_t rowsStreamed() const { return _rowsStreamed; }
+    uint64_t rowsDropped() const { return _rowsDropped; }
+
+    // Appends a block header, and a row, to out (also used by tools reading the cube).
+    void appendHeader(std::string& out, uint8_t reduce, uint16_t rows, uint32_t firstEpoch, uint32_t lastEpoch) const;
+    static void appendRow(std::string& out, const CompositeRow& row);
+
+private:
+    struct Client {
+        int fd = -1;
+        std::string in;
+        std::string out;
+        size_t outSent = 0;
+        bool streaming = false;
+        bool closeWhenSent = false;
+        uint8_t reduce = COMPOSITE_MAX;
+    };
+
+    void onAccept();
+    void onClient(int fd, uint32_t events);
+    void handle(Client& client);
+    void respond(Client& client, int status, const char* contentType, const std::string& body);
+    void serveStatus(Client& client);
+    void serveComposite(Client& client, const std::string& query);
+    void flush(Client& client);
+    void drop(int fd);
+
+    EventLoop& _loop;
+    ClusterAggregator& _aggregator;
+    NodeCollector* _collector;
+    int _listen = -1;
+    uint16_t _port = 0;
+    std::unordered_map<int, Client> _clients;
+    CompositeRow _row;               // reused
+    std::string _emitters = "{\"epoch\":0,\"anchors\":0,\"emitters\":[]}";
+    uint64_t _rowsStreamed = 0;
+    uint64_t _rowsDropped = 0;
+};
+
+#endif
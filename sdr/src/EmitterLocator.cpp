@@ -0,0 +1,362 @@
+#include "EmitterLocator.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+const double kEarthRadiusM = 6371008.8;
+const double kDegToRad = M_PI / 180.0;
+const double kSpeedOfLight = 299792458.0;
+
+// Solves a x = b for n <= 4 by elimination with partial pivoting; a and b
+// are overwritten. False when singular.
+bool solveLinear(double a[4][4], double b[4], int n) {
+    for (int c = 0; c < n; ++c) {
+        int pivot = c;
+        for (int r = c + 1; r < n; ++r) {
+            if (std::fabs(a[r][c]) > std::fabs(a[pivot][c])) pivot = r;
+        }
+        if (!(std::fabs(a[pivot][c]) > 1e-300)) return false;
+        if (pivot != c) {
+            for (int k = 0; k < n; ++k) std::swap(a[c][k], a[pivot][k]);
+            std::swap(b[c], b[pivot]);
+        }
+        for (int r = c + 1; r < n; ++r) {
+            double f = a[r][c] / a[c][c];
+            for (int k = c; k < n; ++k) a[r][k] -= f * a[c][k];
+            b[r] -= f * b[c];
+        }
+    }
+    for (int c = n - 1; c >= 0; --c) {
+        double s = b[c];
+        for (int k = c + 1; k < n; ++k) s -= a[c][k] * b[k];
+        b[c] = s / a[c][c];
+    }
+    return true;
+}
+
+} // namespace
+
+void GeoFrame::toLocal(double lat, double lon, double& x, double& y) const {
+    x = (lon - lon0) * kDegToRad * kEarthRadiusM * std::cos(lat0 * kDegToRad);
+    y = (lat - lat0) * kDegToRad * kEarthRadiusM;
+}
+
+void GeoFrame::toGeo(double x, double y, double& lat, double& lon) const {
+    lat = lat0 + y / kEarthRadiusM / kDegToRad;
+    lon = lon0 + x / (kEarthRadiusM * std::cos(lat0 * kDegToRad)) / kDegToRad;
+}
+
+void EmitterLocator::setAnchors(const std::vector<LocatorAnchor>& anchors) {
+    _anchors = anchors;
+    _validAnchors = 0;
+    for (const LocatorAnchor& a : _anchors) {
+        if (!a.valid) continue;
+        if (_validAnchors == 0) {
+            _minX = _maxX = a.x;
+            _minY = _maxY = a.y;
+        }
+        _minX = std::min(_minX, a.x);
+        _maxX = std::max(_maxX, a.x);
+        _minY = std::min(_minY, a.y);
+        _maxY = std::max(_maxY, a.y);
+        _validAnchors++;
+    }
+    _bestIndex.assign(_anchors.size(), -1);
+}
+
+size_t EmitterLocator::detect(const SpectrumCube& cube, uint32_t epoch, std::vector<Detection>& out) {
+    const CubeSlot* slot = cube.findSlot(epoch);
+    if (!slot) return 0;
+    _stats.slots++;
+    const CubeGeometry& g = cube.geometry();
+    const uint16_t nodes = (uint16_t)std::min<size_t>(g.nodes, _anchors.size());
+    const int threshold = (int)std::lround(_options.thresholdDb * 100.0);
+
+    // Noise floor per node: the 25th percentile of its bins in this slot
+    _floor.assign(nodes, kCubeMissing);
+    for (uint16_t n = 0; n < nodes; ++n) {
+        if (!_anchors[n].valid || !(slot->mask[n / 64] >> (n % 64) & 1)) continue;
+        _values.clear();
+        for (uint16_t b = 0; b < g.bins; ++b) {
+            int16_t v = cube.column(slot, b)[n];
+            if (v != kCubeMissing) _values.push_back(v);
+        }
+        if (_values.empty()) continue;
+        auto q = _values.begin() + _values.size() / 4;
+        std::nth_element(_values.begin(), q, _values.end());
+        _floor[n] = *q;
+    }
+
+    size_t before = out.size();
+    for (uint16_t b = 0; b < g.bins; ++b) {
+        const int16_t* col = cube.column(slot, b);
+        for (uint16_t n = 0; n < nodes; ++n) {
+            if (_floor[n] == kCubeMissing || col[n] == kCubeMissing || col[n] < _floor[n] + threshold) continue;
+            Detection d;
+            d.node = n;
+            d.bin = b;
+            d.rssiDbm = col[n] / 100.0f;
+            out.push_back(d);
+        }
+    }
+    _stats.detections += out.size() - before;
+    return out.size() - before;
+}
+
+size_t EmitterLocator::locate(const std::vector<Detection>& detections, std::vector<EmitterFix>& out) {
+    out.clear();
+    size_t i = 0;
+    while (i < detections.size()) {
+        // A run of adjacent bins is one emitter
+        size_t j = i;
+        while (j + 1 < detections.size() && detections[j + 1].bin <= detections[j].bin + 1) j++;
+        _stats.emitters++;
+
+        // Each node's strongest bin of the run
+        _best.clear();
+        uint16_t peakBin = detections[i].bin;
+        float peakDbm = detections[i].rssiDbm;
+        for (size_t k = i; k <= j; ++k) {
+            const Detection& d = detections[k];
+            if (d.rssiDbm > peakDbm) {
+                peakDbm = d.rssiDbm;
+                peakBin = d.bin;
+            }
+            if (d.node >= _bestIndex.size()) continue;
+            int& idx = _bestIndex[d.node];
+            if (idx < 0) {
+                idx = (int)_best.size();
+                _best.push_back(d);
+            } else if (d.rssiDbm > _best[idx].rssiDbm) {
+                _best[idx] = d;
+            }
+        }
+        for (const Detection& d : _best) _bestIndex[d.node] = -1;
+
+        EmitterFix fix;
+        if (solve(_best.data(), _best.size(), fix)) {
+            fix.firstBin = detections[i].bin;
+            fix.lastBin = detections[j].bin;
+            fix.peakBin = peakBin;
+            fix.peakDbm = peakDbm;
+            out.push_back(fix);
+        }
+        i = j + 1;
+    }
+    return out.size();
+}
+
+double EmitterLocator::gridCost(const Obs* obs, size_t count, double x, double y, double& p, double& t) const {
+    // P and T in closed form: the mean of what each observation implies.
+    // log10 of the squared distance saves a square root per anchor and cell.
+    const double k = 5.0 * _model.exponent;
+    const double min2 = _model.minDistanceM * _model.minDistanceM;
+    double sa = 0, saa = 0, sb = 0, sbb = 0;
+    size_t nt = 0;
+    for (size_t i = 0; i < count; ++i) {
+        double dx = x - obs[i].x, dy = y - obs[i].y;
+        double d2 = std::max(dx * dx + dy * dy, min2);
+        double a = obs[i].rssi + k * std::log10(d2);
+        sa += a;
+        saa += a * a;
+        if (!std::isnan(obs[i].tau)) {
+            double b = obs[i].tau - std::sqrt(d2);
+            sb += b;
+            sbb += b * b;
+            nt++;
+        }
+    }
+    p = sa / count;
+    double sr = _model.shadowingDb;
+    double cost = (saa - sa * sa / count) / (sr * sr);
+    t = 0;
+    if (nt > 0) {
+        t = sb / nt;
+        double st = _options.tdoaSigmaNs * 1e-9 * kSpeedOfLight;
+        cost += (sbb - sb * sb / nt) / (st * st);
+    }
+    return cost;
+}
+
+double EmitterLocator::fitCost(const Obs* obs, size_t count, const double* p) const {
+    const double k = 10.0 * _model.exponent;
+    const double sr = _model.shadowingDb;
+    const double st = _options.tdoaSigmaNs * 1e-9 * kSpeedOfLight;
+    double cost = 0;
+    for (size_t i = 0; i < count; ++i) {
+        double d = std::max(std::hypot(p[0] - obs[i].x, p[1] - obs[i].y), _model.minDistanceM);
+        double r = (obs[i].rssi - p[2] + k * std::log10(d)) / sr;
+        cost += r * r;
+        if (!std::isnan(obs[i].tau)) {
+            double rt = (obs[i].tau - p[3] - d) / st;
+            cost += rt * rt;
+        }
+    }
+    return cost;
+}
+
+bool EmitterLocator::solve(const Detection* detections, size_t count, EmitterFix& out) {
+    // Arrival times relative to the earliest, in metres
+    int64_t toaRef = INT64_MAX;
+    for (size_t i = 0; i < count; ++i) {
+        if (detections[i].toaNs != kNoArrival) toaRef = std::min(toaRef, detections[i].toaNs);
+    }
+    _obs.clear();
+    size_t timed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const Detection& d = detections[i];
+        if (d.node >= _anchors.size() || !_anchors[d.node].valid) continue;
+        Obs o;
+        o.x = _anchors[d.node].x;
+        o.y = _anchors[d.node].y;
+        o.rssi = d.rssiDbm;
+        o.tau = d.toaNs == kNoArrival ? NAN : (double)(d.toaNs - toaRef) * 1e-9 * kSpeedOfLight;
+        if (!std::isnan(o.tau)) timed++;
+        _obs.push_back(o);
+    }
+    const size_t m = _obs.size();
+    if (m < std::max<uint16_t>(_options.minNodes, 3)) {
+        _stats.tooFewNodes++;
+        return false;
+    }
+    if (timed < 2) {
+        for (Obs& o : _obs) o.tau = NAN;
+        timed = 0;
+    }
+    const Obs* obs = _obs.data();
+
+    // Grid likelihood search: the anchors' area, then around its best cell
+    const double extent = std::max({_maxX - _minX, _maxY - _minY, 50.0});
+    const double margin = extent * _options.marginFraction;
+    const int cells = std::max<int>(_options.gridCells, 4);
+    double cx = (_minX + _maxX) / 2, cy = (_minY + _maxY) / 2;
+    double half = extent / 2 + margin;
+    double p[4] = {cx, cy, 0, 0};
+    for (int pass = 0; pass < 2; ++pass) {
+        const double step = 2 * half / cells;
+        double best = INFINITY;
+        double bx = cx, by = cy;
+        for (int iy = 0; iy < cells; ++iy) {
+            double y = cy - half + (iy + 0.5) * step;
+            for (int ix = 0; ix < cells; ++ix) {
+                double x = cx - half + (ix + 0.5) * step;
+                double pw, t;
+                double c = gridCost(obs, m, x, y, pw, t);
+                if (c < best) {
+                    best = c;
+                    bx = x;
+                    by = y;
+                    p[2] = pw;
+                    p[3] = t;
+                }
+            }
+        }
+        cx = bx;
+        cy = by;
+        half = step * 1.5;
+    }
+    p[0] = cx;
+    p[1] = cy;
+
+    // Weighted least squares, Levenberg-Marquardt
+    const int np = timed > 0 ? 4 : 3;
+    const double k = 10.0 * _model.exponent / std::log(10.0);
+    const double sr = _model.shadowingDb;
+    const double st = _options.tdoaSigmaNs * 1e-9 * kSpeedOfLight;
+    double h[4][4], g[4];
+    auto normal = [&](const double* q) {
+        std::memset(h, 0, sizeof(h));
+        std::memset(g, 0, sizeof(g));
+        for (size_t i = 0; i < m; ++i) {
+            double dx = q[0] - obs[i].x, dy = q[1] - obs[i].y;
+            double raw = std::hypot(dx, dy);
+            bool clamped = raw < _model.minDistanceM;
+            double d = clamped ? _model.minDistanceM : raw;
+            double jr[4] = {clamped ? 0 : k * dx / (d * d) / sr, clamped ? 0 : k * dy / (d * d) / sr, -1 / sr, 0};
+            double r = (obs[i].rssi - q[2] + 10.0 * _model.exponent * std::log10(d)) / sr;
+            for (int a = 0; a < np; ++a) {
+                g[a] += jr[a] * r;
+                for (int b = 0; b < np; ++b) h[a][b] += jr[a] * jr[b];
+            }
+            if (std::isnan(obs[i].tau)) continue;
+            double jt[4] = {clamped ? 0 : -dx / d / st, clamped ? 0 : -dy / d / st, 0, -1 / st};
+            double rt = (obs[i].tau - q[3] - d) / st;
+            for (int a = 0; a < np; ++a) {
+                g[a] += jt[a] * rt;
+                for (int b = 0; b < np; ++b) h[a][b] += jt[a] * jt[b];
+            }
+        }
+    };
+
+    double cost = fitCost(obs, m, p);
+    double lambda = 1e-3;
+    for (uint16_t it = 0; it < _options.maxIterations; ++it) {
+        normal(p);
+        bool accepted = false;
+        double move = 0;
+        while (lambda < 1e9) {
+            double a[4][4], delta[4];
+            for (int r = 0; r < np; ++r) {
+                for (int c = 0; c < np; ++c) a[r][c] = h[r][c];
+                a[r][r] += lambda * std::max(h[r][r], 1e-12);
+                delta[r] = -g[r];
+            }
+            double q[4] = {p[0], p[1], p[2], p[3]};
+            if (solveLinear(a, delta, np)) {
+                for (int r = 0; r < np; ++r) q[r] += delta[r];
+                double c = fitCost(obs, m, q);
+                if (c < cost) {
+                    move = std::hypot(delta[0], delta[1]);
+                    std::memcpy(p, q, sizeof(p));
+                    cost = c;
+                    lambda = std::max(lambda * 0.3, 1e-9);
+                    accepted = true;
+                    break;
+                }
+            }
+            lambda *= 10;
+        }
+        if (!accepted || move < 1e-3) break;
+    }
+
+    // Covariance of (x, y) from the undamped normal matrix, scaled by the fit
+    normal(p);
+    double cov[2] = {0, 0};
+    for (int col = 0; col < 2; ++col) {
+        double a[4][4], e[4] = {0, 0, 0, 0};
+        std::memcpy(a, h, sizeof(a));
+        e[col] = 1;
+        if (!solveLinear(a, e, np)) {
+            _stats.diverged++;
+            return false;
+        }
+        cov[col] = e[col];
+    }
+    const size_t residuals = m + timed;
+    double scale = residuals > (size_t)np ? std::max(1.0, cost / (double)(residuals - np)) : 1.0;
+    out.errorM = std::sqrt(std::max(0.0, (cov[0] + cov[1]) * scale));
+
+    // A fix far outside the area the anchors can see is not one
+    if (!std::isfinite(out.errorM) || std::fabs(p[0] - (_minX + _maxX) / 2) > 4 * extent ||
+        std::fabs(p[1] - (_minY + _maxY) / 2) > 4 * extent) {
+        _stats.diverged++;
+        return false;
+    }
+
+    double rss = 0;
+    for (size_t i = 0; i < m; ++i) {
+        double d = std::max(std::hypot(p[0] - obs[i].x, p[1] - obs[i].y), _model.minDistanceM);
+        double r = obs[i].rssi - p[2] + 10.0 * _model.exponent * std::log10(d);
+        rss += r * r;
+    }
+    out.x = p[0];
+    out.y = p[1];
+    out.txDbm = p[2];
+    out.rmsDb = std::sqrt(rss / m);
+    out.nodes = (uint16_t)m;
+    out.tdoa = timed > 0;
+    _stats.located++;
+    return true;
+}
@@ -0,0 +1,139 @@
+#ifndef EMITTERLOCATOR_H
+#define EMITTERLOCATOR_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "SpectrumCube.h"
+
+// Locates emitters from one slot of the cluster's sweeps.
+//
+// Detections: a node detects a bin when its reading stands thresholdDb above
+// that node's noise floor in the slot (the 25th percentile of its bins). A
+// run of adjacent detected bins is one emitter; each node contributes its
+// strongest bin of the run.
+//
+// Solving: RSSI follows a log-distance path loss, rssi = P - 10 n log10(d),
+// with the transmit power P unknown. A grid likelihood search over the
+// anchors' area (P solved in closed form per cell) gives the start for a
+// weighted least-squares fit of (x, y, P) (Levenberg-Marquardt). A detection
+// that carries an arrival time on the consensus clock adds a TDOA term
+// (the emission time is a fourth unknown); that needs GPS-disciplined
+// clocks to be worth having, so the daemon's sweeps solve on RSSI alone.
+// The fit's covariance gives each fix a 1-sigma error radius.
+//
+// Positions are metres east and north in a local frame: GeoFrame maps
+// GeolocationService's absolute fixes onto one; relative fixes already are.
+// One locate() call reuses its buffers and allocates nothing once warm.
+
+struct PathLossModel {
+    double exponent = 2.7;       // n
+    double shadowingDb = 6.0;    // sigma of a reading about the model
+    double minDistanceM = 1.0;   // P is the power at this distance
+};
+
+struct LocatorAnchor {
+    double x = 0;                // metres east
+    double y = 0;                // metres north
+    bool valid = false;
+};
+
+static constexpr int64_t kNoArrival = INT64_MIN;
+
+struct Detection {
+    uint16_t node = 0;           // anchor index (the cube's node index)
+    uint16_t bin = 0;
+    float rssiDbm = 0;
+    int64_t toaNs = kNoArrival;  // arrival time, consensus ns since the epoch
+};
+
+struct EmitterFix {
+    uint16_t firstBin = 0;
+    uint16_t lastBin = 0;
+    uint16_t peakBin = 0;        // strongest reading of any node
+    float peakDbm = 0;
+    double x = 0;
+    double y = 0;
+    double txDbm = 0;            // P, at minDistanceM
+    double errorM = 0;           // 1-sigma radius
+    double rmsDb = 0;            // RSSI residual of the fit
+    uint16_t nodes = 0;
+    bool tdoa = false;
+};
+
+struct LocatorOptions {
+    double thresholdDb = 10.0;
+    uint16_t minNodes = 3;
+    uint16_t gridCells = 24;     // per side, twice: the area, then around the best cell
+    double marginFraction = 0.5; // search beyond the anchors' bounding box
+    double tdoaSigmaNs = 100.0;  // timing error of one arrival time
+    uint16_t maxIterations = 25;
+};
+
+struct LocatorStats {
+    uint64_t slots = 0;
+    uint64_t detections = 0;
+    uint64_t emitters = 0;       // runs of detected bins
+    uint64_t located = 0;
+    uint64_t tooFewNodes = 0;
+    uint64_t diverged = 0;
+};
+
+// Equirectangular projection about a reference point, good to well under a
+// metre across a few kilometres.
+struct GeoFrame {
+    double lat0 = 0;
+    double lon0 = 0;
+    void toLocal(double lat, double lon, double& x, double& y) const;
+    void toGeo(double x, double y, double& lat, double& lon) const;
+};
+
+class EmitterLocator {
+public:
+    void setModel(const PathLossModel& model) { _model = model; }
+    void setOptions(const LocatorOptions& options) { _options = options; }
+    const PathLossModel& model() const { return _model; }
+    const LocatorOptions& options() const { return _options; }
+
+    // Indexed like the detections' node (the cube's node index).
+    void setAnchors(const std::vector<LocatorAnchor>& anchors);
+    uint16_t validAnchors() const { return _validAnchors; }
+
+    // Appends the detections of one held slot, in bin order. Nodes without a
+    // valid anchor are skipped.
+    size_t detect(const SpectrumCube& cube, uint32_t epoch, std::vector<Detection>& out);
+
+    // Groups detections (in bin order) into emitters and solves each. Fills out.
+    size_t locate(const std::vector<Detection>& detections, std::vector<EmitterFix>& out);
+
+    // Solves one emitter from one detection per node.
+    bool solve(const Detection* detections, size_t count, EmitterFix& out);
+
+    const LocatorStats& stats() const { return _stats; }
+
+private:
+    struct Obs {
+        double x, y;             // anchor
+        double rssi;
+        double tau;              // arrival time x c, metres; NaN: none
+    };
+
+    double gridCost(const Obs* obs, size_t count, double x, double y, double& p, double& t) const;
+    double fitCost(const Obs* obs, size_t count, const double* p) const;
+
+    PathLossModel _model;
+    LocatorOptions _options;
+    std::vector<LocatorAnchor> _anchors;
+    uint16_t _validAnchors = 0;
+    double _minX = 0, _minY = 0, _maxX = 0, _maxY = 0;
+
+    std::vector<int16_t> _floor;         // scratch: per node
+    std::vector<int16_t> _values;
+    std::vector<Detection> _best;        // per node, one emitter
+    std::vector<int> _bestIndex;
+    std::vector<Obs> _obs;
+    LocatorStats _stats;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#include "EventLoop.h"
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <unistd.h>
+
+EventLoop::EventLoop() : _epoll(epoll_create1(EPOLL_CLOEXEC)) {}
+
+EventLoop::~EventLoop() {
+    if (_epoll >= 0) close(_epoll);
+}
+
+bool EventLoop::add(int fd, uint32_t events, Handler handler) {
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.fd = fd;
+    if (epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &ev) != 0) return false;
+    _handlers[fd] = std::move(handler);
+    return true;
+}
+
+bool EventLoop::modify(int fd, uint32_t events) {
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.fd = fd;
+    return epoll_ctl(_epoll, EPOLL_CTL_MOD, fd, &ev) == 0;
+}
+
+void EventLoop::remove(int fd) {
+    epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+    _handlers.erase(fd);
+}
+
+int EventLoop::run(int timeoutMs) {
+    epoll_event events[64];
+    int n = epoll_wait(_epoll, events, 64, timeoutMs);
+    int ran = 0;
+    for (int i = 0; i < n; ++i) {
+        // Looked up per event: an earlier handler may have closed this fd
+        auto it = _handlers.find(events[i].data.fd);
+        if (it == _handlers.end()) continue;
+        Handler handler = it->second;
+        handler(events[i].events);
+        ran++;
+    }
+    return ran;
+}
+
+uint64_t EventLoop::nowMs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+uint64_t EventLoop::nowUs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+uint64_t EventLoop::unixMs() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+bool EventLoop::setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
@@ -0,0 +1,40 @@
+#ifndef EVENTLOOP_H
+#define EVENTLOOP_H
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+// One epoll instance driving every socket of the daemon on one thread:
+// NodeCollector's fetches and CompositeServer's clients. Handlers run from
+// run(); nothing in the daemon blocks on the network or takes a lock.
+
+class EventLoop {
+public:
+    using Handler = std::function<void(uint32_t events)>;
+
+    EventLoop();
+    ~EventLoop();
+
+    bool ok() const { return _epoll >= 0; }
+
+    // events: EPOLLIN / EPOLLOUT. A handler may remove its own or any other fd.
+    bool add(int fd, uint32_t events, Handler handler);
+    bool modify(int fd, uint32_t events);
+    void remove(int fd);
+
+    // Waits up to timeoutMs and dispatches what is ready. Returns the number of
+    // handlers run.
+    int run(int timeoutMs);
+
+    static uint64_t nowMs();   // CLOCK_MONOTONIC
+    static uint64_t nowUs();
+    static uint64_t unixMs();  // CLOCK_REALTIME
+    static bool setNonBlocking(int fd);
+
+private:
+    int _epoll;
+    std::unordered_map<int, Handler> _handlers;
+};
+
+#endif
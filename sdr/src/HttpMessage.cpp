@@ -0,0 +1,119 @@
+#include "HttpMessage.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+namespace {
+
+const uint8_t* findHeadEnd(const uint8_t* data, size_t length) {
+    for (size_t i = 3; i < length; ++i) {
+        if (data[i] == '\n' && data[i - 1] == '\r' && data[i - 2] == '\n' && data[i - 3] == '\r') return data + i + 1;
+    }
+    return nullptr;
+}
+
+// Value of a header in the head [data, end), case-insensitive name; empty if absent.
+std::string headerValue(const char* data, const char* end, const char* name) {
+    size_t nameLen = strlen(name);
+    const char* line = (const char*)memchr(data, '\n', end - data);
+    while (line && line + 1 < end) {
+        line++;
+        const char* eol = (const char*)memchr(line, '\n', end - line);
+        if (!eol) break;
+        if ((size_t)(eol - line) > nameLen && strncasecmp(line, name, nameLen) == 0 && line[nameLen] == ':') {
+            const char* v = line + nameLen + 1;
+            while (v < eol && (*v == ' ' || *v == '\t')) v++;
+            const char* e = eol;
+            while (e > v && (e[-1] == '\r' || e[-1] == ' ')) e--;
+            return std::string(v, e);
+        }
+        line = eol;
+    }
+    return "";
+}
+
+} // namespace
+
+HttpParse parseHttpResponse(const uint8_t* data, size_t length, bool eof, HttpResponse& out) {
+    const uint8_t* bodyStart = findHeadEnd(data, length);
+    if (!bodyStart) return eof ? HTTP_MALFORMED : HTTP_INCOMPLETE;
+    if (length < 12 || memcmp(data, "HTTP/1.", 7) != 0) return HTTP_MALFORMED;
+    out.status = atoi((const char*)data + 9);
+
+    const char* head = (const char*)data;
+    const char* headEnd = (const char*)bodyStart;
+    const uint8_t* end = data + length;
+    size_t available = end - bodyStart;
+    out.body.clear();
+
+    if (out.status == 204 || out.status == 304) return HTTP_COMPLETE;
+
+    std::string te = headerValue(head, headEnd, "Transfer-Encoding");
+    if (strncasecmp(te.c_str(), "chunked", 7) == 0) {
+        const uint8_t* p = bodyStart;
+        while (true) {
+            const uint8_t* eol = (const uint8_t*)memchr(p, '\n', end - p);
+            if (!eol) return eof ? HTTP_MALFORMED : HTTP_INCOMPLETE;
+            size_t size = strtoul((const char*)p, nullptr, 16);
+            p = eol + 1;
+            if (size == 0) return HTTP_COMPLETE;
+            if ((size_t)(end - p) < size + 2) return eof ? HTTP_MALFORMED : HTTP_INCOMPLETE;
+            out.body.insert(out.body.end(), p, p + size);
+            p += size + 2;
+        }
+    }
+
+    std::string cl = headerValue(head, headEnd, "Content-Length");
+    if (!cl.empty()) {
+        size_t want = strtoul(cl.c_str(), nullptr, 10);
+        if (available < want) return eof ? HTTP_MALFORMED : HTTP_INCOMPLETE;
+        out.body.assign(bodyStart, bodyStart + want);
+        return HTTP_COMPLETE;
+    }
+    if (!eof) return HTTP_INCOMPLETE;
+    out.body.assign(bodyStart, end);
+    return HTTP_COMPLETE;
+}
+
+HttpParse parseHttpRequest(const char* data, size_t length, HttpRequest& out) {
+    if (!findHeadEnd((const uint8_t*)data, length)) return length > 8192 ? HTTP_MALFORMED : HTTP_INCOMPLETE;
+    const char* sp1 = (const char*)memchr(data, ' ', length);
+    if (!sp1) return HTTP_MALFORMED;
+    const char* target = sp1 + 1;
+    const char* sp2 = (const char*)memchr(target, ' ', data + length - target);
+    if (!sp2) return HTTP_MALFORMED;
+    out.method.assign(data, sp1);
+    std::string t(target, sp2);
+    size_t q = t.find('?');
+    out.path = t.substr(0, q);
+    out.query = q == std::string::npos ? "" : t.substr(q + 1);
+    return HTTP_COMPLETE;
+}
+
+std::string queryParam(const std::string& query, const char* name, const std::string& def) {
+    size_t nameLen = strlen(name);
+    size_t pos = 0;
+    while (pos <= query.size()) {
+        size_t amp = query.find('&', pos);
+        if (amp == std::string::npos) amp = query.size();
+        if (amp - pos > nameLen && query.compare(pos, nameLen, name) == 0 && query[pos + nameLen] == '=') {
+            return query.substr(pos + nameLen + 1, amp - pos - nameLen - 1);
+        }
+        if (amp - pos == nameLen && query.compare(pos, nameLen, name) == 0) return "";
+        pos = amp + 1;
+    }
+    return def;
+}
+
+std::string httpStatusText(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 503: return "Service Unavailable";
+        default: return "Error";
+    }
+}
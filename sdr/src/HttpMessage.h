@@ -0,0 +1,37 @@
+#ifndef HTTPMESSAGE_H
+#define HTTPMESSAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Just enough HTTP/1.1 for the daemon: responses from the nodes'
+// ESPAsyncWebServer (Content-Length, chunked, or close-delimited bodies) and
+// GET requests from API clients.
+
+struct HttpResponse {
+    int status = 0;
+    std::vector<uint8_t> body;
+};
+
+enum HttpParse { HTTP_INCOMPLETE, HTTP_COMPLETE, HTTP_MALFORMED };
+
+// eof: the peer closed the connection, which ends a body without a length.
+HttpParse parseHttpResponse(const uint8_t* data, size_t length, bool eof, HttpResponse& out);
+
+struct HttpRequest {
+    std::string method;
+    std::string path;            // without the query
+    std::string query;           // after '?', undecoded
+};
+
+// Parses the request head; the daemon takes no request bodies.
+HttpParse parseHttpRequest(const char* data, size_t length, HttpRequest& out);
+
+// Value of name in a query string, or def.
+std::string queryParam(const std::string& query, const char* name, const std::string& def = "");
+
+std::string httpStatusText(int status);
+
+#endif
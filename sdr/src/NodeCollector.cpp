@@ -0,0 +1,315 @@
+#include "NodeCollector.h"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "ClusterAggregator.h"
+#include "ReplayLog.h"
+
+NodeCollector::NodeCollector(EventLoop& loop, ClusterAggregator& aggregator)
+    : _loop(loop), _aggregator(aggregator), _fetches(kMaxInFlight) {}
+
+NodeCollector::~NodeCollector() {
+    for (size_t i = 0; i < _fetches.size(); ++i) release(i);
+}
+
+bool NodeCollector::resolve(const std::string& address, uint32_t& ip, uint16_t& port) {
+    std::string host = address;
+    port = 80;
+    size_t colon = address.rfind(':');
+    if (colon != std::string::npos) {
+        host = address.substr(0, colon);
+        port = (uint16_t)atoi(address.c_str() + colon + 1);
+    }
+    in_addr a;
+    if (inet_pton(AF_INET, host.c_str(), &a) == 1) {
+        ip = a.s_addr;
+        return true;
+    }
+    // Names resolve once, when listed (blocking, before the loop runs)
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* res = nullptr;
+    if (getaddrinfo(host.c_str(), nullptr, &hints, &res) != 0 || !res) return false;
+    ip = ((sockaddr_in*)res->ai_addr)->sin_addr.s_addr;
+    freeaddrinfo(res);
+    return true;
+}
+
+bool NodeCollector::addNode(const std::string& address) {
+    CollectorNode n;
+    n.address = address;
+    if (!resolve(address, n.ip, n.port)) return false;
+    for (const CollectorNode& other : _nodes) {
+        if (other.ip == n.ip && other.port == n.port) return true;
+    }
+    // Golden-ratio stagger: any prefix of the nodes is spread evenly over the interval
+    n.nextPollMs = EventLoop::nowMs() + (uint64_t)(_nodes.size() * 618 % 1000) * _pollIntervalMs / 1000;
+    _nodes.push_back(n);
+    _aggregator.setExpectedNodes((uint16_t)_nodes.size());
+    return true;
+}
+
+void NodeCollector::pollAll() {
+    for (CollectorNode& n : _nodes) n.nextPollMs = 0;
+}
+
+void NodeCollector::loop(uint64_t nowMs) {
+    for (size_t i = 0; i < _fetches.size(); ++i) {
+        if (_fetches[i].fd >= 0 && nowMs - _fetches[i].startedMs > kTimeoutMs) fail(i);
+    }
+
+    if (!_seed.empty() && nowMs >= _nextDiscoverMs) {
+        _nextDiscoverMs = nowMs + kDiscoverIntervalMs;
+        uint32_t ip;
+        uint16_t port;
+        if (resolve(_seed, ip, port)) start(-1, FETCH_PEERS, ip, port, "/api/peers");
+    }
+
+    for (size_t k = 0; k < _nodes.size() && _inFlight < kMaxInFlight; ++k) {
+        CollectorNode& n = _nodes[k];
+        if (n.inFlight || n.nextStatusMs > nowMs) continue;
+        n.nextStatusMs = nowMs + kStatusIntervalMs;
+        if (start((int)k, FETCH_STATUS, n.ip, n.port, "/api/status")) n.inFlight = true;
+    }
+
+    const std::string path = "/api/spectrum/frame" + (_query.empty() ? std::string() : "?" + _query);
+    for (size_t k = 0; k < _nodes.size() && _inFlight < kMaxInFlight; ++k) {
+        size_t idx = (_cursor + k) % _nodes.size();
+        CollectorNode& n = _nodes[idx];
+        if (n.inFlight || n.nextPollMs > nowMs) continue;
+        n.nextPollMs = n.nextPollMs == 0 || n.nextPollMs + _pollIntervalMs < nowMs ? nowMs + _pollIntervalMs
+                                                                                  : n.nextPollMs + _pollIntervalMs;
+        if (start((int)idx, FETCH_FRAME, n.ip, n.port, path)) {
+            n.inFlight = true;
+            n.fetches++;
+            _cursor = idx + 1;
+        } else {
+            n.failed++;
+        }
+    }
+}
+
+bool NodeCollector::start(int node, FetchKind kind, uint32_t ip, uint16_t port, const std::string& path) {
+    size_t slot = 0;
+    while (slot < _fetches.size() && _fetches[slot].fd >= 0) slot++;
+    if (slot == _fetches.size()) return false;
+
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return false;
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    sockaddr_in sa{};
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = ip;
+    if (connect(fd, (sockaddr*)&sa, sizeof(sa)) != 0 && errno != EINPROGRESS) {
+        close(fd);
+        return false;
+    }
+
+    Fetch& f = _fetches[slot];
+    f.fd = fd;
+    f.node = node;
+    f.kind = kind;
+    f.startedMs = EventLoop::nowMs();
+    f.startedUs = EventLoop::nowUs();
+    char host[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &sa.sin_addr, host, sizeof(host));
+    f.request = "GET " + path + " HTTP/1.1\r\nHost: " + host + "\r\nConnection: close\r\n\r\n";
+    f.sent = 0;
+    f.response.clear();
+    if (!_loop.add(fd, EPOLLOUT, [this, slot](uint32_t events) { onEvent(slot, events); })) {
+        close(fd);
+        f.fd = -1;
+        return false;
+    }
+    _inFlight++;
+    return true;
+}
+
+void NodeCollector::onEvent(size_t slot, uint32_t events) {
+    Fetch& f = _fetches[slot];
+    if (f.sent < f.request.size()) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if ((events & EPOLLERR) || getsockopt(f.fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+            fail(slot);
+            return;
+        }
+        ssize_t n = send(f.fd, f.request.data() + f.sent, f.request.size() - f.sent, MSG_NOSIGNAL);
+        if (n < 0 && errno != EAGAIN) {
+            fail(slot);
+            return;
+        }
+        if (n > 0) f.sent += (size_t)n;
+        if (f.sent == f.request.size()) _loop.modify(f.fd, EPOLLIN);
+        return;
+    }
+
+    uint8_t buf[4096];
+    while (true) {
+        ssize_t n = recv(f.fd, buf, sizeof(buf), 0);
+        if (n > 0) {
+            f.response.insert(f.response.end(), buf, buf + n);
+            if (f.response.size() > kMaxResponseBytes) {
+                fail(slot);
+                return;
+            }
+            continue;
+        }
+        if (n == 0) {
+            finish(slot, true);
+            return;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        fail(slot);
+        return;
+    }
+    // The node may keep the connection open past a complete response
+    if (parseHttpResponse(f.response.data(), f.response.size(), false, _response) == HTTP_COMPLETE) finish(slot, false);
+}
+
+void NodeCollector::finish(size_t slot, bool eof) {
+    Fetch& f = _fetches[slot];
+    HttpParse parsed = parseHttpResponse(f.response.data(), f.response.size(), eof, _response);
+    if (parsed != HTTP_COMPLETE) {
+        fail(slot);
+        return;
+    }
+    if (f.kind == FETCH_PEERS) {
+        if (_response.status == 200) applyPeers(_response.body);
+        release(slot);
+        return;
+    }
+    CollectorNode& n = _nodes[f.node];
+    if (f.kind == FETCH_STATUS) {
+        if (_response.status == 200) applyStatus(n, _response.body);
+        release(slot);
+        return;
+    }
+    n.bytes += f.response.size();
+    n.lastLatencyUs = (uint32_t)(EventLoop::nowUs() - f.startedUs);
+    if (_response.status == 200) applyFrame(n, _response.body);
+    else if (_response.status == 204) n.empty++;
+    else n.failed++;
+    release(slot);
+}
+
+void NodeCollector::fail(size_t slot) {
+    Fetch& f = _fetches[slot];
+    if (f.kind == FETCH_FRAME) _nodes[f.node].failed++;
+    release(slot);
+}
+
+void NodeCollector::release(size_t slot) {
+    Fetch& f = _fetches[slot];
+    if (f.fd < 0) return;
+    _loop.remove(f.fd);
+    close(f.fd);
+    f.fd = -1;
+    if (f.node >= 0) _nodes[f.node].inFlight = false;
+    _inFlight--;
+}
+
+void NodeCollector::applyFrame(CollectorNode& node, const std::vector<uint8_t>& body) {
+    if (!decodeSpectrumFrame(body.data(), body.size(), _frame)) {
+        node.failed++;
+        return;
+    }
+    if (node.haveFrame && node.lastEpoch == _frame.epoch && node.lastSeq == _frame.seq) {
+        node.unchanged++;
+        return;
+    }
+    node.haveFrame = true;
+    node.lastEpoch = _frame.epoch;
+    node.lastSeq = _frame.seq;
+    if (_recorder) _recorder->append(body.data(), body.size(), EventLoop::unixMs());
+    if (_aggregator.ingest(_frame, node.address.c_str())) {
+        node.frames++;
+        _framesIngested++;
+    }
+}
+
+void NodeCollector::applyPeers(const std::vector<uint8_t>& body) {
+    // /api/peers: [{"hostname":..,"ip":"192.168.1.105",..,"online":true,..},..]
+    std::string json(body.begin(), body.end());
+    const std::string key = "\"ip\":\"";
+    size_t pos = json.find(key);
+    while (pos != std::string::npos) {
+        size_t start = pos + key.size();
+        size_t end = json.find('"', start);
+        if (end == std::string::npos) break;
+        std::string ip = json.substr(start, end - start);
+        size_t next = json.find(key, end);
+        std::string rest = json.substr(end, (next == std::string::npos ? json.size() : next) - end);
+        if (rest.find("\"online\":false") == std::string::npos) addNode(ip);
+        pos = next;
+    }
+    addNode(_seed);  // the seed sweeps too
+}
+
+namespace {
+
+// The number after "key": within [from, to), or NaN.
+double jsonNumber(const std::string& json, const char* key, size_t from, size_t to) {
+    std::string k = std::string("\"") + key + "\":";
+    size_t pos = json.find(k, from);
+    if (pos == std::string::npos || pos >= to) return NAN;
+    const char* start = json.c_str() + pos + k.size();
+    char* end = nullptr;
+    double v = strtod(start, &end);
+    return end == start ? NAN : v;
+}
+
+// The object after "key": as [begin, end), or false when absent or null.
+bool jsonObject(const std::string& json, const char* key, size_t from, size_t& begin, size_t& end) {
+    std::string k = std::string("\"") + key + "\":{";
+    begin = json.find(k, from);
+    if (begin == std::string::npos) return false;
+    begin += k.size() - 1;
+    int depth = 0;
+    for (end = begin; end < json.size(); ++end) {
+        if (json[end] == '{') depth++;
+        if (json[end] == '}' && --depth == 0) return ++end, true;
+    }
+    return false;
+}
+
+} // namespace
+
+void NodeCollector::applyStatus(CollectorNode& node, const std::vector<uint8_t>& body) {
+    // /api/status: .."geolocation":{..,"position":{"lat":..,"lon":..,"accuracy_m":..}|null,
+    //                                  "relative":{"frame_id":"..","x":..,"y":..,"accuracy_m":..}|null,..}
+    std::string json(body.begin(), body.end());
+    size_t geoBegin, geoEnd, begin, end;
+    node.fix = 0;
+    if (!jsonObject(json, "geolocation", 0, geoBegin, geoEnd)) return;
+    if (jsonObject(json, "position", geoBegin, begin, end) && end <= geoEnd) {
+        double lat = jsonNumber(json, "lat", begin, end), lon = jsonNumber(json, "lon", begin, end);
+        if (std::isnan(lat) || std::isnan(lon)) return;
+        node.lat = lat;
+        node.lon = lon;
+        node.accuracyM = (float)jsonNumber(json, "accuracy_m", begin, end);
+        node.fix = 2;
+    } else if (jsonObject(json, "relative", geoBegin, begin, end) && end <= geoEnd) {
+        double x = jsonNumber(json, "x", begin, end), y = jsonNumber(json, "y", begin, end);
+        if (std::isnan(x) || std::isnan(y)) return;
+        node.x = x;
+        node.y = y;
+        node.accuracyM = (float)jsonNumber(json, "accuracy_m", begin, end);
+        size_t id = json.find("\"frame_id\":\"", begin);
+        node.frameId = id < end ? json.substr(id + 12, json.find('"', id + 12) - id - 12) : std::string();
+        node.fix = 1;
+    }
+}
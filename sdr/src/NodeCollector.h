@@ -0,0 +1,121 @@
+#ifndef NODECOLLECTOR_H
+#define NODECOLLECTOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EventLoop.h"
+#include "HttpMessage.h"
+#include "SpectrumFrameCodec.h"
+
+class ClusterAggregator;
+class ReplayWriter;
+
+// Subscribes to every node's sweep output: GET /api/spectrum/frame from each
+// node every pollIntervalMs, all fetches non-blocking on the EventLoop and
+// up to kMaxInFlight at once. A frame whose (epoch, seq) the node already
+// delivered is skipped; a new one goes to ClusterAggregator::ingest.
+//
+// Nodes are listed explicitly, or found from a seed node's /api/peers
+// (re-read every kDiscoverIntervalMs, so nodes that join are picked up).
+// Polls are staggered across the interval so fifty nodes do not all
+// connect in the same millisecond. Every kStatusIntervalMs each node's
+// /api/status is read too, for the position GeolocationService reports.
+
+struct CollectorNode {
+    std::string address;         // host[:port] as given or discovered
+    uint32_t ip = 0;             // network order
+    uint16_t port = 80;
+    uint64_t nextPollMs = 0;
+    bool inFlight = false;
+
+    bool haveFrame = false;
+    uint32_t lastEpoch = 0;
+    uint16_t lastSeq = 0;
+
+    uint32_t fetches = 0;
+    uint32_t frames = 0;         // new sweeps ingested
+    uint32_t unchanged = 0;      // same sweep as last time
+    uint32_t empty = 0;          // 204: no sweep yet
+    uint32_t failed = 0;         // connect, timeout, HTTP or decode errors
+    uint64_t bytes = 0;
+    uint32_t lastLatencyUs = 0;
+
+    // From the node's "geolocation" status block
+    uint64_t nextStatusMs = 0;
+    uint8_t fix = 0;             // 0 none, 1 relative, 2 absolute
+    double lat = 0, lon = 0;     // absolute
+    double x = 0, y = 0;         // relative, metres in frameId
+    std::string frameId;
+    float accuracyM = 0;
+};
+
+class NodeCollector {
+public:
+    static constexpr uint32_t kTimeoutMs = 2000;
+    static constexpr size_t kMaxInFlight = 64;
+    static constexpr size_t kMaxResponseBytes = 64 * 1024;
+    static constexpr uint32_t kDiscoverIntervalMs = 60000;
+    static constexpr uint32_t kStatusIntervalMs = 30000;
+
+    NodeCollector(EventLoop& loop, ClusterAggregator& aggregator);
+    ~NodeCollector();
+
+    // host[:port], IPv4 or a resolvable name. False if it does not resolve.
+    bool addNode(const std::string& address);
+    void setSeed(const std::string& address) { _seed = address; }
+    void setPollInterval(uint32_t ms) { _pollIntervalMs = ms; }
+    void setQuery(const std::string& query) { _query = query; }   // e.g. "bins=int16&channel=max_hold"
+    void setRecorder(ReplayWriter* recorder) { _recorder = recorder; }
+
+    // Starts due fetches and times out stalled ones.
+    void loop(uint64_t nowMs);
+    // Makes every node due now (one round, for benchmarks).
+    void pollAll();
+
+    bool idle() const { return _inFlight == 0; }
+    const std::vector<CollectorNode>& nodes() const { return _nodes; }
+    uint64_t framesIngested() const { return _framesIngested; }
+
+private:
+    enum FetchKind : uint8_t { FETCH_FRAME, FETCH_STATUS, FETCH_PEERS };
+
+    struct Fetch {
+        int fd = -1;
+        int node = -1;           // -1: the seed's /api/peers
+        FetchKind kind = FETCH_FRAME;
+        uint64_t startedMs = 0;
+        uint64_t startedUs = 0;
+        std::string request;
+        size_t sent = 0;
+        std::vector<uint8_t> response;
+    };
+
+    bool start(int node, FetchKind kind, uint32_t ip, uint16_t port, const std::string& path);
+    void onEvent(size_t slot, uint32_t events);
+    void finish(size_t slot, bool eof);
+    void fail(size_t slot);
+    void release(size_t slot);
+    void applyFrame(CollectorNode& node, const std::vector<uint8_t>& body);
+    void applyPeers(const std::vector<uint8_t>& body);
+    void applyStatus(CollectorNode& node, const std::vector<uint8_t>& body);
+    static bool resolve(const std::string& address, uint32_t& ip, uint16_t& port);
+
+    EventLoop& _loop;
+    ClusterAggregator& _aggregator;
+    ReplayWriter* _recorder = nullptr;
+    std::vector<CollectorNode> _nodes;
+    std::vector<Fetch> _fetches;     // kMaxInFlight slots, fd < 0 when free
+    size_t _inFlight = 0;
+    size_t _cursor = 0;
+    std::string _seed;
+    uint64_t _nextDiscoverMs = 0;
+    uint32_t _pollIntervalMs = 1000;
+    std::string _query = "bins=int16";
+    SweepFrame _frame;               // decode target, reused
+    HttpResponse _response;          // reused
+    uint64_t _framesIngested = 0;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#include "ReplayLog.h"
+
+#include <cstring>
+
+namespace {
+
+const uint8_t kReplayMagic[8] = {'A', 'S', 'E', 'R', 1, 0, 0, 0};
+
+} // namespace
+
+ReplayWriter::~ReplayWriter() {
+    close();
+}
+
+bool ReplayWriter::open(const std::string& path) {
+    close();
+    _file = fopen(path.c_str(), "ab");
+    if (!_file) return false;
+    fseek(_file, 0, SEEK_END);
+    if (ftell(_file) == 0) fwrite(kReplayMagic, 1, sizeof(kReplayMagic), _file);
+    return true;
+}
+
+void ReplayWriter::append(const uint8_t* frame, size_t length, uint64_t receivedUnixMs) {
+    if (!_file) return;
+    uint8_t head[12];
+    for (int i = 0; i < 4; ++i) head[i] = (uint8_t)(length >> (8 * i));
+    for (int i = 0; i < 8; ++i) head[4 + i] = (uint8_t)(receivedUnixMs >> (8 * i));
+    fwrite(head, 1, sizeof(head), _file);
+    fwrite(frame, 1, length, _file);
+}
+
+void ReplayWriter::close() {
+    if (_file) fclose(_file);
+    _file = nullptr;
+}
+
+bool loadReplay(const std::string& path, std::vector<ReplayRecord>& out) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    uint8_t magic[8];
+    if (fread(magic, 1, sizeof(magic), f) != sizeof(magic) || memcmp(magic, kReplayMagic, 5) != 0) {
+        fclose(f);
+        return false;
+    }
+    out.clear();
+    uint8_t head[12];
+    while (fread(head, 1, sizeof(head), f) == sizeof(head)) {
+        uint32_t length = 0;
+        uint64_t ms = 0;
+        for (int i = 0; i < 4; ++i) length |= (uint32_t)head[i] << (8 * i);
+        for (int i = 0; i < 8; ++i) ms |= (uint64_t)head[4 + i] << (8 * i);
+        if (length > 65536) break;  // not a frame; the rest is unreadable
+        ReplayRecord r;
+        r.receivedUnixMs = ms;
+        r.frame.resize(length);
+        if (fread(r.frame.data(), 1, length, f) != length) break;  // cut short while recording
+        out.push_back(std::move(r));
+    }
+    fclose(f);
+    return true;
+}
@@ -0,0 +1,35 @@
+#ifndef REPLAYLOG_H
+#define REPLAYLOG_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Recorded sweep frames, as fetched, for replay by the simulated nodes.
+//
+// File: "ASER" u8 version (1) u8[3] reserved, then records, little-endian:
+//   u32 frame_bytes | u64 received_unix_ms | frame (SpectrumFrame.h layout)
+// `ase_aggregatord --record FILE` appends every new frame it ingests.
+
+class ReplayWriter {
+public:
+    ~ReplayWriter();
+    bool open(const std::string& path);
+    void append(const uint8_t* frame, size_t length, uint64_t receivedUnixMs);
+    void close();
+    bool isOpen() const { return _file != nullptr; }
+
+private:
+    FILE* _file = nullptr;
+};
+
+struct ReplayRecord {
+    uint64_t receivedUnixMs = 0;
+    std::vector<uint8_t> frame;
+};
+
+// Loads every record. False if the file is missing or not a replay log.
+bool loadReplay(const std::string& path, std::vector<ReplayRecord>& out);
+
+#endif
@@ -0,0 +1,199 @@
+#include "SpectrumCube.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct CubeFileHeader {
+    char magic[4];               // "ASEC"
+    uint16_t version;
+    uint16_t headerBytes;
+    uint32_t startKhz;
+    uint32_t stepHz;
+    uint16_t bins;
+    uint16_t nodes;
+    uint32_t slots;
+    uint32_t slotSeconds;
+    uint32_t reserved;
+    uint64_t nodeTableOffset;
+    uint64_t slotTableOffset;
+    uint64_t dataOffset;
+    uint64_t fileBytes;
+};
+
+namespace {
+
+constexpr uint64_t kHeaderBytes = 4096;
+constexpr uint64_t kPage = 4096;
+
+uint64_t pageAlign(uint64_t v) { return (v + kPage - 1) / kPage * kPage; }
+
+} // namespace
+
+SpectrumCube::SpectrumCube()
+    : _fd(-1), _base(nullptr), _bytes(0), _header(nullptr), _nodes(nullptr), _slots(nullptr), _data(nullptr) {}
+
+SpectrumCube::~SpectrumCube() {
+    close();
+}
+
+bool SpectrumCube::open(const std::string& path, const CubeGeometry& requested) {
+    close();
+    _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (_fd < 0) {
+        _error = path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    fstat(_fd, &st);
+
+    CubeGeometry g = requested;
+    bool existing = st.st_size >= (off_t)kHeaderBytes;
+    if (existing) {
+        CubeFileHeader h;
+        if (pread(_fd, &h, sizeof(h), 0) != (ssize_t)sizeof(h) || memcmp(h.magic, "ASEC", 4) != 0 ||
+            h.version != kCubeVersion) {
+            _error = path + ": not a version " + std::to_string(kCubeVersion) + " cube file";
+            close();
+            return false;
+        }
+        CubeGeometry held;
+        held.startKhz = h.startKhz;
+        held.stepHz = h.stepHz;
+        held.bins = h.bins;
+        held.nodes = h.nodes;
+        held.slots = h.slots;
+        held.slotSeconds = h.slotSeconds;
+        if (g.bins == 0) g = held;
+        if (!g.sameAs(held)) {
+            _error = path + ": holds a cube of another geometry; remove it or pass the same grid";
+            close();
+            return false;
+        }
+    }
+    if (g.bins == 0 || g.bins > kCubeMaxBins || g.nodes == 0 || g.nodes > kCubeMaxNodes || g.slots == 0 ||
+        g.slotSeconds == 0 || g.stepHz == 0) {
+        _error = "invalid cube geometry";
+        close();
+        return false;
+    }
+
+    uint64_t nodeTable = kHeaderBytes;
+    uint64_t slotTable = nodeTable + (uint64_t)g.nodes * sizeof(CubeNode);
+    uint64_t data = pageAlign(slotTable + (uint64_t)g.slots * sizeof(CubeSlot));
+    uint64_t bytes = data + (uint64_t)g.slots * g.bins * g.nodes * sizeof(int16_t);
+    if (ftruncate(_fd, (off_t)bytes) != 0) {
+        _error = path + ": " + strerror(errno);
+        close();
+        return false;
+    }
+    void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (base == MAP_FAILED) {
+        _error = path + ": mmap: " + strerror(errno);
+        close();
+        return false;
+    }
+
+    _base = (uint8_t*)base;
+    _bytes = bytes;
+    _geometry = g;
+    _header = (CubeFileHeader*)_base;
+    _nodes = (CubeNode*)(_base + nodeTable);
+    _slots = (CubeSlot*)(_base + slotTable);
+    _data = (int16_t*)(_base + data);
+    if (!existing) {
+        memset(_header, 0, kHeaderBytes);
+        memcpy(_header->magic, "ASEC", 4);
+        _header->version = kCubeVersion;
+        _header->headerBytes = (uint16_t)sizeof(CubeFileHeader);
+        _header->startKhz = g.startKhz;
+        _header->stepHz = g.stepHz;
+        _header->bins = g.bins;
+        _header->nodes = g.nodes;
+        _header->slots = g.slots;
+        _header->slotSeconds = g.slotSeconds;
+        _header->nodeTableOffset = nodeTable;
+        _header->slotTableOffset = slotTable;
+        _header->dataOffset = data;
+        _header->fileBytes = bytes;
+    }
+    return true;
+}
+
+void SpectrumCube::close() {
+    if (_base) munmap(_base, _bytes);
+    if (_fd >= 0) ::close(_fd);
+    _fd = -1;
+    _base = nullptr;
+    _bytes = 0;
+    _header = nullptr;
+    _nodes = nullptr;
+    _slots = nullptr;
+    _data = nullptr;
+}
+
+int16_t* SpectrumCube::slotData(const CubeSlot* slot) const {
+    return _data + (size_t)(slot - _slots) * _geometry.bins * _geometry.nodes;
+}
+
+CubeSlot* SpectrumCube::beginSlot(uint32_t epoch) {
+    epoch = slotEpoch(epoch);
+    if (epoch == 0) return nullptr;
+    CubeSlot* slot = &_slots[(epoch / _geometry.slotSeconds) % _geometry.slots];
+    if (slot->epoch == epoch) return slot;
+    if (slot->epoch > epoch) return nullptr;  // the ring moved on
+    int16_t* cells = slotData(slot);
+    std::fill(cells, cells + (size_t)_geometry.bins * _geometry.nodes, kCubeMissing);
+    slot->reported = 0;
+    memset(slot->mask, 0, sizeof(slot->mask));
+    slot->epoch = epoch;
+    return slot;
+}
+
+const CubeSlot* SpectrumCube::findSlot(uint32_t epoch) const {
+    epoch = slotEpoch(epoch);
+    if (epoch == 0) return nullptr;
+    const CubeSlot* slot = &_slots[(epoch / _geometry.slotSeconds) % _geometry.slots];
+    return slot->epoch == epoch ? slot : nullptr;
+}
+
+int SpectrumCube::nodeIndex(const uint8_t mac[6], const char* address, bool create) {
+    static const uint8_t kNone[6] = {0, 0, 0, 0, 0, 0};
+    for (uint16_t i = 0; i < _geometry.nodes; ++i) {
+        if (memcmp(_nodes[i].mac, mac, 6) == 0) return i;
+        if (memcmp(_nodes[i].mac, kNone, 6) != 0) continue;
+        // First free entry: the node is new
+        if (!create) return -1;
+        CubeNode& n = _nodes[i];
+        memset(&n, 0, sizeof(n));
+        memcpy(n.mac, mac, 6);
+        if (address) strncpy(n.address, address, sizeof(n.address) - 1);
+        return i;
+    }
+    return -1;
+}
+
+uint16_t SpectrumCube::nodeCount() const {
+    static const uint8_t kNone[6] = {0, 0, 0, 0, 0, 0};
+    uint16_t n = 0;
+    while (n < _geometry.nodes && memcmp(_nodes[n].mac, kNone, 6) != 0) n++;
+    return n;
+}
+
+uint32_t SpectrumCube::newestEpoch() const {
+    uint32_t newest = 0;
+    for (uint32_t i = 0; i < _geometry.slots; ++i) newest = std::max(newest, _slots[i].epoch);
+    return newest;
+}
+
+uint32_t SpectrumCube::oldestEpoch() const {
+    uint32_t oldest = 0;
+    for (uint32_t i = 0; i < _geometry.slots; ++i) {
+        if (_slots[i].epoch != 0 && (oldest == 0 || _slots[i].epoch < oldest)) oldest = _slots[i].epoch;
+    }
+    return oldest;
+}
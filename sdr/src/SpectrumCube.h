@@ -0,0 +1,116 @@
+#ifndef SPECTRUMCUBE_H
+#define SPECTRUMCUBE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Node x frequency x time cube of sweep bins in a memory-mapped file.
+//
+// Time is a ring of `slots` sweep slots of `slotSeconds` each (the cluster
+// sweeps every slotSeconds of consensus time, so one slot holds one sweep of
+// every node). A slot is found from its epoch, (epoch / slotSeconds) %
+// slots, and a newer epoch reuses the ring position of an older one.
+// Frequency is a fixed grid of `bins` bins from startKhz, stepHz apart.
+//
+// The file is columnar: the bins of one (slot, frequency) pair for every
+// node are one contiguous column of int16 centi-dBm, so composites over
+// nodes read sequential memory. Cells a node did not report hold kMissing.
+// The file is sparse until slots are written, and outlives the daemon: a
+// restart with the same geometry carries on with the history.
+//
+// Layout (host byte order):
+//   0                CubeFileHeader, padded to 4096 bytes
+//   nodeTableOffset  nodes x CubeNode
+//   slotTableOffset  slots x CubeSlot
+//   dataOffset       slots x bins x nodes int16 (page aligned)
+
+static constexpr uint16_t kCubeVersion = 1;
+static constexpr uint16_t kCubeMaxNodes = 256;
+static constexpr uint16_t kCubeMaxBins = 4096;
+static constexpr int16_t kCubeMissing = INT16_MIN;
+
+struct CubeGeometry {
+    uint32_t startKhz = 0;       // centre of bin 0
+    uint32_t stepHz = 0;
+    uint16_t bins = 0;
+    uint16_t nodes = 64;
+    uint32_t slots = 8640;       // 24 h of 10 s slots
+    uint32_t slotSeconds = 10;
+
+    bool sameAs(const CubeGeometry& o) const {
+        return startKhz == o.startKhz && stepHz == o.stepHz && bins == o.bins && nodes == o.nodes && slots == o.slots &&
+               slotSeconds == o.slotSeconds;
+    }
+    uint64_t binHz(uint16_t bin) const { return (uint64_t)startKhz * 1000ULL + (uint64_t)bin * stepHz; }
+};
+
+struct CubeNode {
+    uint8_t mac[6];
+    uint8_t reserved[2];
+    char address[40];            // host[:port] it is fetched from
+    uint32_t firstEpoch;
+    uint32_t lastEpoch;
+    uint32_t frames;
+    uint32_t reserved2;
+};
+
+struct CubeSlot {
+    uint32_t epoch;              // 0: empty
+    uint16_t reported;           // nodes with a sweep in this slot
+    uint16_t reserved;
+    uint64_t mask[kCubeMaxNodes / 64];
+};
+
+class SpectrumCube {
+public:
+    SpectrumCube();
+    ~SpectrumCube();
+
+    // Creates the file, or reopens it when its geometry matches. With
+    // geometry.bins == 0 an existing file's geometry is adopted. False (and
+    // error() says why) on a mismatch or an I/O failure.
+    bool open(const std::string& path, const CubeGeometry& geometry);
+    void close();
+    bool isOpen() const { return _base != nullptr; }
+    const CubeGeometry& geometry() const { return _geometry; }
+    const std::string& error() const { return _error; }
+    uint64_t fileBytes() const { return _bytes; }
+
+    uint32_t slotEpoch(uint32_t epoch) const { return epoch - epoch % _geometry.slotSeconds; }
+
+    // Writer: the slot of epoch, cleared first if it held an older epoch.
+    // nullptr if the ring already moved past epoch.
+    CubeSlot* beginSlot(uint32_t epoch);
+    int16_t* column(const CubeSlot* slot, uint16_t bin) { return slotData(slot) + (size_t)bin * _geometry.nodes; }
+
+    // Reader: the slot holding epoch, nullptr if not held.
+    const CubeSlot* findSlot(uint32_t epoch) const;
+    const int16_t* column(const CubeSlot* slot, uint16_t bin) const {
+        return slotData(slot) + (size_t)bin * _geometry.nodes;
+    }
+
+    // Node registry, by MAC. Returns -1 when full (or not found, create == false).
+    int nodeIndex(const uint8_t mac[6], const char* address, bool create);
+    CubeNode& node(uint16_t index) { return _nodes[index]; }
+    const CubeNode& node(uint16_t index) const { return _nodes[index]; }
+    uint16_t nodeCount() const;
+
+    uint32_t newestEpoch() const;
+    uint32_t oldestEpoch() const;
+
+private:
+    int16_t* slotData(const CubeSlot* slot) const;
+
+    CubeGeometry _geometry;
+    std::string _error;
+    int _fd;
+    uint8_t* _base;
+    uint64_t _bytes;
+    struct CubeFileHeader* _header;
+    CubeNode* _nodes;
+    CubeSlot* _slots;
+    int16_t* _data;
+};
+
+#endif
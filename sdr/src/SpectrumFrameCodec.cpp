@@ -0,0 +1,90 @@
+#include "SpectrumFrameCodec.h"
+
+#include <cstring>
+
+namespace {
+
+uint16_t get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void put16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back((uint8_t)(v & 0xFF));
+    out.push_back((uint8_t)(v >> 8));
+}
+
+void put32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) out.push_back((uint8_t)(v >> (8 * i)));
+}
+
+int8_t cdbToInt8(int16_t cdb) {
+    int32_t d = cdb >= 0 ? (cdb + 50) / 100 : -((-(int32_t)cdb + 50) / 100);
+    if (d < -128) d = -128;
+    if (d > 127) d = 127;
+    return (int8_t)d;
+}
+
+} // namespace
+
+bool decodeSpectrumFrame(const uint8_t* data, size_t length, SweepFrame& out) {
+    // Version 1: 28-byte header; 2 adds channel/flags/accumulated; 3 the start offset
+    if (length < 28 || memcmp(data, "ASEF", 4) != 0) return false;
+    uint8_t version = data[4];
+    uint8_t binFormat = data[5];
+    uint16_t binCount = get16(data + 6);
+    if (version < 1 || version > kFrameVersion || binCount > kFrameMaxBins) return false;
+    if (binFormat != kFrameBinsInt8 && binFormat != kFrameBinsInt16) return false;
+
+    size_t header = version == 1 ? 28 : version == 2 ? 32 : kFrameHeaderBytes;
+    size_t binBytes = binFormat == kFrameBinsInt16 ? 2 : 1;
+    if (length < header + (size_t)binCount * binBytes) return false;
+
+    out.version = version;
+    memcpy(out.nodeId, data + 8, 6);
+    out.seq = get16(data + 14);
+    out.epoch = get32(data + 16);
+    out.startKhz = get32(data + 20);
+    out.stepHz = get32(data + 24);
+    out.channel = version >= 2 ? data[28] : 0;
+    out.accumulated = version >= 2 ? get16(data + 30) : 0;
+    out.startOffsetUs = version >= 3 ? (int32_t)get32(data + 32) : 0;
+
+    out.cdb.resize(binCount);
+    const uint8_t* p = data + header;
+    if (binFormat == kFrameBinsInt16) {
+        for (uint16_t i = 0; i < binCount; ++i, p += 2) out.cdb[i] = (int16_t)get16(p);
+    } else {
+        for (uint16_t i = 0; i < binCount; ++i) out.cdb[i] = (int16_t)((int8_t)p[i] * 100);
+    }
+    return true;
+}
+
+size_t encodeSpectrumFrame(const SweepFrame& frame, uint8_t binFormat, std::vector<uint8_t>& out) {
+    if (binFormat != kFrameBinsInt16) binFormat = kFrameBinsInt8;
+    size_t before = out.size();
+    uint16_t binCount = (uint16_t)(frame.cdb.size() > kFrameMaxBins ? kFrameMaxBins : frame.cdb.size());
+    out.insert(out.end(), {'A', 'S', 'E', 'F', kFrameVersion, binFormat});
+    put16(out, binCount);
+    out.insert(out.end(), frame.nodeId, frame.nodeId + 6);
+    put16(out, frame.seq);
+    put32(out, frame.epoch);
+    put32(out, frame.startKhz);
+    put32(out, frame.stepHz);
+    out.push_back(frame.channel);
+    out.push_back(0);  // flags: no bin times
+    put16(out, frame.accumulated);
+    put32(out, (uint32_t)frame.startOffsetUs);
+    for (uint16_t i = 0; i < binCount; ++i) {
+        if (binFormat == kFrameBinsInt16) put16(out, (uint16_t)frame.cdb[i]);
+        else out.push_back((uint8_t)cdbToInt8(frame.cdb[i]));
+    }
+    return out.size() - before;
+}
+
+uint64_t nodeIdKey(const uint8_t nodeId[6]) {
+    uint64_t key = 0;
+    for (int i = 0; i < 6; ++i) key = (key << 8) | nodeId[i];
+    return key;
+}
@@ -0,0 +1,41 @@
+#ifndef SPECTRUMFRAMECODEC_H
+#define SPECTRUMFRAMECODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Linux side of the node's binary sweep frame (GET /api/spectrum/frame).
+// The layout is defined in firmware/AllSeeingEye/src/SpectrumFrame.h; this
+// decodes versions 1 to 3 and both bin formats, and encodes version 3 for
+// the replay nodes. Bins are kept as centi-dBm like the firmware's sweeps.
+
+static constexpr uint8_t kFrameVersion = 3;
+static constexpr size_t kFrameHeaderBytes = 36;
+static constexpr uint8_t kFrameBinsInt8 = 1;
+static constexpr uint8_t kFrameBinsInt16 = 2;
+static constexpr uint8_t kFrameFlagTimes = 0x01;
+static constexpr uint16_t kFrameMaxBins = 255;
+
+struct SweepFrame {
+    uint8_t version = kFrameVersion;
+    uint8_t nodeId[6] = {0, 0, 0, 0, 0, 0};
+    uint16_t seq = 0;
+    uint32_t epoch = 0;          // UTC second of the sweep slot
+    uint32_t startKhz = 0;       // centre of bin 0
+    uint32_t stepHz = 0;
+    uint8_t channel = 0;         // SweepChannel, 0: live
+    uint16_t accumulated = 0;
+    int32_t startOffsetUs = 0;
+    std::vector<int16_t> cdb;    // centi-dBm per bin
+};
+
+// Reuses out.cdb's capacity. False on a short, truncated or unknown frame.
+bool decodeSpectrumFrame(const uint8_t* data, size_t length, SweepFrame& out);
+
+// Appends one version 3 frame (no bin times) to out. Returns its size.
+size_t encodeSpectrumFrame(const SweepFrame& frame, uint8_t binFormat, std::vector<uint8_t>& out);
+
+uint64_t nodeIdKey(const uint8_t nodeId[6]);   // the MAC as a 48-bit number
+
+#endif